@@ -0,0 +1,550 @@
+/*******************************************************************************
+* bench.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "prand.h"
+#include "prand_inline.h"
+#include "mt19937.h"
+
+/*============================================================================*\
+                      Settings of the benchmark programme
+\*============================================================================*/
+
+#define SEED            1
+#define NUM_SAMPLE      10000000        /* numbers for each throughput test */
+#define BUF_SIZE        4096            /* length of the buffer for sampling */
+#define NUM_STREAM      16              /* streams for lock-step sampling */
+#define NUM_REPEAT      5               /* the best of repetitions is shown */
+#define NUM_JUMP        8               /* streams for the jump benchmarks */
+#define INIT_STEP       UINT64_C(1000000000000)
+
+/* Random number generators to be benchmarked. */
+static const struct {
+  prand_rng_enum type;
+  const char *name;
+} generators[] = {
+  {PRAND_RNG_MRG32K3A, "MRG32k3a"},
+  {PRAND_RNG_MT19937, "MT19937"},
+  {PRAND_RNG_PHILOX4X32, "Philox4x32-10"},
+  {PRAND_RNG_XOSHIRO256PP, "xoshiro256++"},
+  {PRAND_RNG_SFMT19937, "SFMT19937"},
+  {PRAND_RNG_DSFMT19937, "dSFMT19937"}
+};
+#define NUM_GENERATOR   ((int) (sizeof(generators) / sizeof(generators[0])))
+
+/* Number of streams for the initialisation benchmark. */
+static const unsigned int init_nstream[] = {1, 4, 16, 64};
+#define NUM_INIT        ((int) (sizeof(init_nstream) / sizeof(init_nstream[0])))
+
+/* Step sizes for the jump benchmarks. */
+static const uint64_t jump_step[] = {
+  UINT64_C(1000), UINT64_C(1000000), UINT64_C(1000000000),
+  UINT64_C(1000000000000), UINT64_C(1000000000000000)
+};
+#define NUM_JUMP_STEP   ((int) (sizeof(jump_step) / sizeof(jump_step[0])))
+
+/* Thresholds of the Toom-Cook multiplication for the polynomial benchmark,
+ * 0 for the Karatsuba algorithm only. */
+static const unsigned int toom3_thres[] = {0, 12, 24, 48, 96, 160, 320};
+#define NUM_TOOM3       ((int) (sizeof(toom3_thres) / sizeof(toom3_thres[0])))
+#define NUM_POLY_MUL    20      /* multiplications for each timing */
+
+/* Sampling interfaces for the throughput benchmark. */
+typedef enum {
+  BENCH_GET, BENCH_GET_DOUBLE, BENCH_GET_DOUBLE_POS, BENCH_GET_DOUBLE53,
+  BENCH_INLINE_GET_DOUBLE,
+  BENCH_FILL, BENCH_FILL_DOUBLE, BENCH_FILL_DOUBLE_POS, BENCH_FILL_DOUBLE53,
+  BENCH_GET_GAUSSIAN, BENCH_FILL_GAUSSIAN,
+  BENCH_FILL_ALL, BENCH_FILL_ALL_DOUBLE, BENCH_FILL_ALL_DOUBLE_POS,
+  BENCH_NUM_SAMPLER
+} bench_sampler_enum;
+
+static const char *sampler_name[BENCH_NUM_SAMPLER] = {
+  "get", "get_double", "get_double_pos", "get_double53",
+  "inline_get_double",
+  "fill", "fill_double", "fill_double_pos", "fill_double53",
+  "get_gaussian", "fill_gaussian",
+  "fill_all", "fill_all_double", "fill_all_double_pos"
+};
+
+#define CHECK_ERROR(err)                                        \
+  if (PRAND_IS_ERROR(err)) {                                   \
+    fprintf(stderr, "Error: %s\n", prand_errmsg(err));         \
+    exit(EXIT_FAILURE);                                         \
+  }
+
+/* Accumulator of the samples, to prevent the sampling from being optimised
+ * out by the compiler. */
+static volatile uint64_t sink;
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `wall_time`:
+  Read the monotonic clock.
+Return:
+  The time in seconds.
+******************************************************************************/
+static double wall_time(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/******************************************************************************
+Function `print_row`:
+  Print one result of the benchmark, in the CSV format.
+Arguments:
+  * `bench`:    name of the benchmark;
+  * `gen`:      name of the random number generator;
+  * `param`:    the varying parameter of the benchmark;
+  * `value`:    the measured value;
+  * `unit`:     unit of the measured value.
+******************************************************************************/
+static void print_row(const char *bench, const char *gen, const char *param,
+    const double value, const char *unit) {
+  printf("%s,%s,%s,%.6g,%s\n", bench, gen, param, value, unit);
+  fflush(stdout);
+}
+
+/******************************************************************************
+Function `init_rng`:
+  Initialise a random number generator, and abort on errors.
+Arguments:
+  * `type`:     the ID of the random number generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead.
+Return:
+  The interface of the random number generator.
+******************************************************************************/
+static prand_t *init_rng(const prand_rng_enum type,
+    const unsigned int nstream, const uint64_t step) {
+  int err = 0;
+  prand_t *rng = prand_init(type, SEED, nstream, step, &err);
+  CHECK_ERROR(err);
+  return rng;
+}
+
+
+/*============================================================================*\
+                          Benchmark of the throughput
+\*============================================================================*/
+
+/******************************************************************************
+Macro `INLINE_SUM`:
+  Sum up `NUM_SAMPLE` numbers sampled with the inline interface.
+Arguments:
+  * `gen`:      name of the random number generator;
+  * `state`:    the state of the stream to be sampled;
+  * `dsum`:     the variable for storing the sum.
+******************************************************************************/
+#define INLINE_SUM(gen, state, dsum) {                          \
+  prand_##gen##_state_t *stat = (prand_##gen##_state_t *) state;\
+  for (size_t j = 0; j < NUM_SAMPLE; j++)                       \
+    dsum += prand_##gen##_get_double(stat);                     \
+}
+
+/******************************************************************************
+Function `sample_inline`:
+  Sample `NUM_SAMPLE` numbers with the inline interface.
+Arguments:
+  * `type`:     the ID of the random number generator;
+  * `state`:    the state of the stream to be sampled.
+Return:
+  The sum of the samples.
+******************************************************************************/
+static double sample_inline(const prand_rng_enum type, void *state) {
+  double dsum = 0;
+  switch (type) {
+    case PRAND_RNG_MRG32K3A:
+      INLINE_SUM(mrg32k3a, state, dsum);
+      break;
+    case PRAND_RNG_MT19937:
+      INLINE_SUM(mt19937, state, dsum);
+      break;
+    case PRAND_RNG_PHILOX4X32:
+      INLINE_SUM(philox4x32, state, dsum);
+      break;
+    case PRAND_RNG_XOSHIRO256PP:
+      INLINE_SUM(xoshiro256pp, state, dsum);
+      break;
+    case PRAND_RNG_SFMT19937:
+      INLINE_SUM(sfmt19937, state, dsum);
+      break;
+    case PRAND_RNG_DSFMT19937:
+      INLINE_SUM(dsfmt19937, state, dsum);
+      break;
+    default:
+      break;
+  }
+  return dsum;
+}
+
+/******************************************************************************
+Function `sample`:
+  Sample `NUM_SAMPLE` numbers with a given interface.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `sampler`:  the sampling interface;
+  * `ibuf`:     buffer for integers, with `BUF_SIZE` elements;
+  * `dbuf`:     buffer for floating-point numbers, with `BUF_SIZE` elements.
+******************************************************************************/
+static void sample(prand_t *rng, void *state, const bench_sampler_enum sampler,
+    uint64_t *ibuf, double *dbuf) {
+  const size_t nall = BUF_SIZE / NUM_STREAM;    /* numbers for each stream */
+  uint64_t sum = 0;
+  double dsum = 0;
+  size_t i;
+
+  switch (sampler) {
+    case BENCH_GET:
+      for (i = 0; i < NUM_SAMPLE; i++) sum += rng->get(state);
+      break;
+    case BENCH_GET_DOUBLE:
+      for (i = 0; i < NUM_SAMPLE; i++) dsum += rng->get_double(state);
+      break;
+    case BENCH_GET_DOUBLE_POS:
+      for (i = 0; i < NUM_SAMPLE; i++) dsum += rng->get_double_pos(state);
+      break;
+    case BENCH_GET_DOUBLE53:
+      for (i = 0; i < NUM_SAMPLE; i++) dsum += rng->get_double53(state);
+      break;
+    case BENCH_INLINE_GET_DOUBLE:
+      dsum = sample_inline(rng->type, state);
+      break;
+    case BENCH_FILL:
+      for (i = 0; i < NUM_SAMPLE; i += BUF_SIZE) {
+        rng->fill(state, ibuf, BUF_SIZE);
+        sum += ibuf[0];
+      }
+      break;
+    case BENCH_FILL_DOUBLE:
+      for (i = 0; i < NUM_SAMPLE; i += BUF_SIZE) {
+        rng->fill_double(state, dbuf, BUF_SIZE);
+        dsum += dbuf[0];
+      }
+      break;
+    case BENCH_FILL_DOUBLE_POS:
+      for (i = 0; i < NUM_SAMPLE; i += BUF_SIZE) {
+        rng->fill_double_pos(state, dbuf, BUF_SIZE);
+        dsum += dbuf[0];
+      }
+      break;
+    case BENCH_FILL_DOUBLE53:
+      for (i = 0; i < NUM_SAMPLE; i += BUF_SIZE) {
+        rng->fill_double53(state, dbuf, BUF_SIZE);
+        dsum += dbuf[0];
+      }
+      break;
+    case BENCH_GET_GAUSSIAN:
+      for (i = 0; i < NUM_SAMPLE; i++) dsum += rng->get_gaussian(state);
+      break;
+    case BENCH_FILL_GAUSSIAN:
+      for (i = 0; i < NUM_SAMPLE; i += BUF_SIZE) {
+        rng->fill_gaussian(state, dbuf, BUF_SIZE);
+        dsum += dbuf[0];
+      }
+      break;
+    case BENCH_FILL_ALL:
+      for (i = 0; i < NUM_SAMPLE; i += nall * NUM_STREAM) {
+        rng->fill_all(rng, ibuf, nall);
+        sum += ibuf[0];
+      }
+      break;
+    case BENCH_FILL_ALL_DOUBLE:
+      for (i = 0; i < NUM_SAMPLE; i += nall * NUM_STREAM) {
+        rng->fill_all_double(rng, dbuf, nall);
+        dsum += dbuf[0];
+      }
+      break;
+    case BENCH_FILL_ALL_DOUBLE_POS:
+      for (i = 0; i < NUM_SAMPLE; i += nall * NUM_STREAM) {
+        rng->fill_all_double_pos(rng, dbuf, nall);
+        dsum += dbuf[0];
+      }
+      break;
+    default:
+      break;
+  }
+  sink += sum + (uint64_t) dsum;
+}
+
+/******************************************************************************
+Function `bench_throughput`:
+  Measure the number of samples per second for all the sampling interfaces.
+Arguments:
+  * `g`:        index of the random number generator.
+******************************************************************************/
+static void bench_throughput(const int g) {
+  uint64_t *ibuf = malloc(sizeof(uint64_t) * BUF_SIZE);
+  double *dbuf = malloc(sizeof(double) * BUF_SIZE);
+  if (!ibuf || !dbuf) {
+    fprintf(stderr, "Error: failed to allocate memory for the buffers\n");
+    exit(EXIT_FAILURE);
+  }
+
+  prand_t *rng = init_rng(generators[g].type, 0, 0);
+  prand_t *rngs = init_rng(generators[g].type, NUM_STREAM, INIT_STEP);
+
+  for (int s = 0; s < BENCH_NUM_SAMPLER; s++) {
+    prand_t *r = (s < BENCH_FILL_ALL) ? rng : rngs;
+    double best = 0;
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+      sample(r, rng->state, s, ibuf, dbuf);
+      t = wall_time() - t;
+      if (i == 0 || t < best) best = t;
+    }
+    print_row("throughput", generators[g].name, sampler_name[s],
+        NUM_SAMPLE / best * 1e-6, "M/s");
+  }
+
+  prand_destroy(rng);
+  prand_destroy(rngs);
+  free(ibuf);
+  free(dbuf);
+}
+
+
+/*============================================================================*\
+                      Benchmark of initialisation and jumps
+\*============================================================================*/
+
+/******************************************************************************
+Function `bench_init`:
+  Measure the latency of `prand_init` with different numbers of streams.
+Arguments:
+  * `g`:        index of the random number generator.
+******************************************************************************/
+static void bench_init(const int g) {
+  char param[32];
+  for (int n = 0; n < NUM_INIT; n++) {
+    double best = 0;
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+      prand_t *rng = init_rng(generators[g].type, init_nstream[n], INIT_STEP);
+      t = wall_time() - t;
+      prand_destroy(rng);
+      if (i == 0 || t < best) best = t;
+    }
+    sprintf(param, "nstream=%u", init_nstream[n]);
+    print_row("init", generators[g].name, param, best * 1e6, "us");
+  }
+}
+
+/******************************************************************************
+Function `bench_jump`:
+  Measure the latency of `jump` and `jump_all` with different step sizes.
+  `jump` evaluates the jump-ahead polynomial or matrix every time, while
+  the one for `jump_all` is cached after the first call.
+Arguments:
+  * `g`:        index of the random number generator.
+******************************************************************************/
+static void bench_jump(const int g) {
+  char param[32];
+  int err = 0;
+  prand_t *rng = init_rng(generators[g].type, NUM_JUMP, INIT_STEP);
+
+  for (int n = 0; n < NUM_JUMP_STEP; n++) {
+    double best = 0;
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+      for (int j = 0; j < NUM_JUMP; j++)
+        rng->jump(rng->state_stream[j], jump_step[n], &err);
+      t = wall_time() - t;
+      if (i == 0 || t < best) best = t;
+    }
+    CHECK_ERROR(err);
+    sprintf(param, "step=%" PRIu64, jump_step[n]);
+    print_row("jump", generators[g].name, param, best / NUM_JUMP * 1e6, "us");
+
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+      rng->jump_all(rng, jump_step[n], &err);
+      t = wall_time() - t;
+      if (i == 0 || t < best) best = t;
+    }
+    CHECK_ERROR(err);
+    print_row("jump_all", generators[g].name, param,
+        best / NUM_JUMP * 1e6, "us");
+  }
+
+  prand_destroy(rng);
+}
+
+
+/*============================================================================*\
+                   Benchmark of the polynomial multiplication
+\*============================================================================*/
+
+/******************************************************************************
+Function `bench_poly`:
+  Measure the multiplication of two MT19937 jump-ahead polynomials, with the
+  grade-school algorithm, the Karatsuba algorithm, and the Toom-Cook 3-way
+  algorithm with different thresholds, on top of the base case in use, i.e.,
+  carry-less multiply instructions if available.
+******************************************************************************/
+static void bench_poly(void) {
+  const unsigned int n = MT19937_N;
+  const char *base = poly_mul_clmul() ? "clmul" : "bitwise";
+  char param[48];
+  uint32_t *a = malloc(sizeof(uint32_t) * n * 12);
+  if (!a) {
+    fprintf(stderr, "Error: failed to allocate memory for polynomials\n");
+    exit(EXIT_FAILURE);
+  }
+  uint32_t *b = a + n;
+  uint32_t *r = b + n;
+  uint32_t *tmp = r + (n << 1);
+  uint64_t x = SEED;
+  for (unsigned int i = 0; i < (n << 1); i++) {
+    x = x * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+    a[i] = (uint32_t) (x >> 32);
+  }
+
+  /* The grade-school algorithm is only timed once per repetition. */
+  double best = 0;
+  for (int i = 0; i < NUM_REPEAT; i++) {
+    double t = wall_time();
+    poly_mul_school(r, a, b, n);
+    t = wall_time() - t;
+    if (i == 0 || t < best) best = t;
+  }
+  sink += r[n];
+  sprintf(param, "algo=school base=%s", base);
+  print_row("poly_mul", "MT19937", param, best * 1e6, "us");
+
+  const unsigned int thres0 = poly_mul_toom3(0);
+  for (int k = 0; k < NUM_TOOM3; k++) {
+    poly_mul_toom3(toom3_thres[k]);
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+      for (int j = 0; j < NUM_POLY_MUL; j++) poly_mul(r, a, b, n, tmp);
+      t = wall_time() - t;
+      if (i == 0 || t < best) best = t;
+    }
+    sink += r[n];
+    if (toom3_thres[k])
+      sprintf(param, "algo=toom3 thres=%u base=%s", toom3_thres[k], base);
+    else sprintf(param, "algo=karatsuba base=%s", base);
+    print_row("poly_mul", "MT19937", param, best / NUM_POLY_MUL * 1e6, "us");
+  }
+  poly_mul_toom3(thres0);
+  free(a);
+}
+
+
+/*============================================================================*\
+                      Benchmark of the multi-thread scaling
+\*============================================================================*/
+
+/******************************************************************************
+Function `bench_threads`:
+  Measure the aggregated throughput of `fill_double`, with one stream for
+  each thread. Only one thread is used if OpenMP is not enabled.
+Arguments:
+  * `g`:        index of the random number generator.
+******************************************************************************/
+static void bench_threads(const int g) {
+  char param[32];
+#ifdef _OPENMP
+  const int nmax = omp_get_max_threads();
+#else
+  const int nmax = 1;
+#endif
+
+  for (int nt = 1; nt <= nmax; nt = (nt < nmax && (nt << 1) > nmax) ?
+      nmax : nt << 1) {
+    prand_t *rng = init_rng(generators[g].type, nt, INIT_STEP);
+    double best = 0;
+    for (int i = 0; i < NUM_REPEAT; i++) {
+      double t = wall_time();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt)
+#endif
+      {
+#ifdef _OPENMP
+        const int id = omp_get_thread_num();
+#else
+        const int id = 0;
+#endif
+        void *state = rng->state_stream[id];
+        double *dbuf = malloc(sizeof(double) * BUF_SIZE);
+        if (dbuf) {
+          double dsum = 0;
+          for (size_t j = 0; j < NUM_SAMPLE; j += BUF_SIZE) {
+            rng->fill_double(state, dbuf, BUF_SIZE);
+            dsum += dbuf[0];
+          }
+          free(dbuf);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+          sink += (uint64_t) dsum;
+        }
+      }
+      t = wall_time() - t;
+      if (i == 0 || t < best) best = t;
+    }
+    sprintf(param, "threads=%d", nt);
+    print_row("threads", generators[g].name, param,
+        NUM_SAMPLE * (double) nt / best * 1e-6, "M/s");
+    prand_destroy(rng);
+  }
+}
+
+
+/*============================================================================*\
+                                 Main function
+\*============================================================================*/
+
+int main(void) {
+  printf("benchmark,generator,parameter,value,unit\n");
+  bench_poly();
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    bench_throughput(g);
+    bench_init(g);
+    bench_jump(g);
+    bench_threads(g);
+  }
+  return 0;
+}
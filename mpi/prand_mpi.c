@@ -0,0 +1,71 @@
+/*******************************************************************************
+* prand_mpi.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "prand_mpi.h"
+
+/******************************************************************************
+Function `prand_init_mpi`:
+  Initialisation of the interface with only the streams owned by the calling
+  process. The `nstream` streams are distributed over the processes of the
+  communicator in contiguous blocks, and the first (`nstream` mod size)
+  processes own one more stream than the others.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams of all the processes;
+  * `step`:     step size for jumping ahead;
+  * `comm`:     the MPI communicator;
+  * `first`:    index of the first local stream, if not NULL;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal interface with the local streams; NULL on error.
+******************************************************************************/
+prand_t *prand_init_mpi(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int nstream, const uint64_t step, MPI_Comm comm,
+    unsigned int *first, int *err) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  /* Every process has to own at least one stream. */
+  if (nstream < (unsigned int) size) {
+    *err = PRAND_ERR_STREAM;
+    return NULL;
+  }
+
+  const unsigned int nbase = nstream / size;
+  const unsigned int nrem = nstream % size;
+  const unsigned int count = nbase + ((unsigned int) rank < nrem);
+  const unsigned int start = nbase * rank +
+      (((unsigned int) rank < nrem) ? rank : nrem);
+  if (first) *first = start;
+
+  return prand_init_slice(type, seed, start, count, step, err);
+}
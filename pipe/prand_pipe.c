@@ -0,0 +1,351 @@
+/*******************************************************************************
+* prand_pipe.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "prand_pipe.h"
+
+/* Separate the indices written by the producer and consumers. */
+#ifndef PRAND_CACHE_LINE
+#define PRAND_CACHE_LINE        64
+#endif
+
+/*============================================================================*\
+                   Definitions of the ring buffers and control
+\*============================================================================*/
+
+struct prand_pipe_ring_struct {
+  /* Written by the producer. */
+  alignas(PRAND_CACHE_LINE) atomic_size_t head; /* number of blocks produced */
+  size_t nprod;                 /* private copy of `head` */
+  /* Written by the consumer. */
+  alignas(PRAND_CACHE_LINE) atomic_size_t tail; /* number of blocks released */
+  size_t ncons;                 /* private copy of `tail` */
+  size_t avail;                 /* the latest `head` seen by the consumer */
+  size_t base;                  /* offset of the current block */
+  size_t idx;                   /* index of the next number in the block */
+  union {                       /* the blocks, read-only pointers */
+    uint64_t *i;
+    double *d;
+  } buf;
+};
+
+typedef struct {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;          /* wake the producer up */
+  atomic_int idle;              /* indicate whether the producer sleeps */
+  atomic_int stop;              /* indicate whether to stop the producer */
+} prand_pipe_ctrl_t;
+
+
+/*============================================================================*\
+                         Functions of the producer thread
+\*============================================================================*/
+
+/******************************************************************************
+Function `pipe_fill`:
+  Fill a block of the ring buffer of a stream.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `i`:        index of the stream.
+******************************************************************************/
+static void pipe_fill(prand_pipe_t *pipe, const int i) {
+  prand_t *rng = pipe->rng;
+  prand_pipe_ring_t *r = pipe->ring + i;
+  const size_t offset = (r->nprod % pipe->nblock) * pipe->block;
+  switch (pipe->kind) {
+    case PRAND_PIPE_INT:
+      rng->fill(rng->state_stream[i], r->buf.i + offset, pipe->block);
+      break;
+    case PRAND_PIPE_DOUBLE:
+      rng->fill_double(rng->state_stream[i], r->buf.d + offset, pipe->block);
+      break;
+    case PRAND_PIPE_DOUBLE_POS:
+      rng->fill_double_pos(rng->state_stream[i], r->buf.d + offset,
+          pipe->block);
+      break;
+    default:
+      rng->fill_double53(rng->state_stream[i], r->buf.d + offset,
+          pipe->block);
+      break;
+  }
+  /* Publish the block after the numbers are written. */
+  atomic_store_explicit(&r->head, ++r->nprod, memory_order_release);
+}
+
+/******************************************************************************
+Function `pipe_full`:
+  Check whether all the ring buffers are full.
+Arguments:
+  * `pipe`:     the producer pipeline.
+Return:
+  Non-zero if there is no space for a new block.
+******************************************************************************/
+static int pipe_full(prand_pipe_t *pipe) {
+  for (int i = 0; i < pipe->rng->nstream; i++) {
+    if (pipe->ring[i].nprod - atomic_load(&pipe->ring[i].tail) < pipe->nblock)
+      return 0;
+  }
+  return 1;
+}
+
+/******************************************************************************
+Function `pipe_produce`:
+  The producer thread, which fills one block of every ring with space per
+  pass, so that all streams are refilled with the same priority, and sleeps
+  if all the rings are full.
+Arguments:
+  * `arg`:      the producer pipeline.
+Return:
+  NULL.
+******************************************************************************/
+static void *pipe_produce(void *arg) {
+  prand_pipe_t *pipe = (prand_pipe_t *) arg;
+  prand_pipe_ctrl_t *ctrl = (prand_pipe_ctrl_t *) pipe->ctrl;
+  while (!atomic_load_explicit(&ctrl->stop, memory_order_relaxed)) {
+    int work = 0;
+    for (int i = 0; i < pipe->rng->nstream; i++) {
+      prand_pipe_ring_t *r = pipe->ring + i;
+      /* Blocks are overwritten only after they are released. */
+      if (r->nprod - atomic_load_explicit(&r->tail, memory_order_acquire) <
+          pipe->nblock) {
+        pipe_fill(pipe, i);
+        work = 1;
+      }
+    }
+    if (work) continue;
+
+    /* The flag is raised before checking the rings again, and consumers
+     * release blocks before checking the flag, so wake-ups are never lost. */
+    pthread_mutex_lock(&ctrl->lock);
+    atomic_store(&ctrl->idle, 1);
+    if (pipe_full(pipe) && !atomic_load(&ctrl->stop))
+      pthread_cond_wait(&ctrl->cond, &ctrl->lock);
+    atomic_store(&ctrl->idle, 0);
+    pthread_mutex_unlock(&ctrl->lock);
+  }
+  return NULL;
+}
+
+
+/*============================================================================*\
+                        Functions of the consumer threads
+\*============================================================================*/
+
+/******************************************************************************
+Function `pipe_wake`:
+  Wake the producer thread up.
+Arguments:
+  * `ctrl`:     control of the producer thread.
+******************************************************************************/
+static void pipe_wake(prand_pipe_ctrl_t *ctrl) {
+  pthread_mutex_lock(&ctrl->lock);
+  pthread_cond_signal(&ctrl->cond);
+  pthread_mutex_unlock(&ctrl->lock);
+}
+
+/******************************************************************************
+Function `pipe_pop`:
+  Retrieve the position of the next number of a ring buffer, and release
+  the current block if it is exhausted.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `r`:        the ring buffer.
+Return:
+  Index of the number in the buffer.
+******************************************************************************/
+static inline size_t pipe_pop(prand_pipe_t *pipe, prand_pipe_ring_t *r) {
+  if (r->idx == pipe->block) {
+    atomic_store(&r->tail, ++r->ncons);
+    if (atomic_load(&((prand_pipe_ctrl_t *) pipe->ctrl)->idle))
+      pipe_wake((prand_pipe_ctrl_t *) pipe->ctrl);
+    r->base = (r->ncons % pipe->nblock) * pipe->block;
+    r->idx = 0;
+  }
+  /* Wait for the producer only if it is behind. */
+  while (r->ncons == r->avail) {
+    r->avail = atomic_load_explicit(&r->head, memory_order_acquire);
+    if (r->ncons == r->avail) sched_yield();
+  }
+  return r->base + r->idx++;
+}
+
+/******************************************************************************
+Function `prand_pipe_get`:
+  Pop an integer from the ring buffer of a stream, for `PRAND_PIPE_INT`.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `i`:        index of the stream.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+uint64_t prand_pipe_get(prand_pipe_t *pipe, const unsigned int i) {
+  prand_pipe_ring_t *r = pipe->ring + i;
+  return r->buf.i[pipe_pop(pipe, r)];
+}
+
+/******************************************************************************
+Function `prand_pipe_get_double`:
+  Pop a floating-point number from the ring buffer of a stream, for
+  `PRAND_PIPE_DOUBLE`, `PRAND_PIPE_DOUBLE_POS`, and `PRAND_PIPE_DOUBLE53`.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `i`:        index of the stream.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+double prand_pipe_get_double(prand_pipe_t *pipe, const unsigned int i) {
+  prand_pipe_ring_t *r = pipe->ring + i;
+  return r->buf.d[pipe_pop(pipe, r)];
+}
+
+
+/*============================================================================*\
+                  Initialisation and release of the pipeline
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_pipe_destroy`:
+  Stop the producer thread and release the memory of the pipeline.
+Arguments:
+  * `pipe`:     the producer pipeline.
+******************************************************************************/
+void prand_pipe_destroy(prand_pipe_t *pipe) {
+  if (!pipe) return;
+  prand_pipe_ctrl_t *ctrl = (prand_pipe_ctrl_t *) pipe->ctrl;
+  if (ctrl) {
+    atomic_store(&ctrl->stop, 1);
+    pipe_wake(ctrl);
+    pthread_join(ctrl->thread, NULL);
+    pthread_cond_destroy(&ctrl->cond);
+    pthread_mutex_destroy(&ctrl->lock);
+    free(ctrl);
+  }
+  if (pipe->ring) {
+    for (int i = 0; i < pipe->rng->nstream; i++)
+      free(pipe->ring[i].buf.i);
+    free(pipe->ring);
+  }
+  free(pipe);
+}
+
+/******************************************************************************
+Function `prand_pipe_init`:
+  Start a producer thread filling the ring buffers of all streams of an
+  interface.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `kind`:     type of the buffered numbers;
+  * `block`:    number of numbers in every block;
+  * `nblock`:   number of blocks in every ring, at least 2;
+  * `err`:      an integer for storing the error message.
+Return:
+  The producer pipeline; NULL on error.
+******************************************************************************/
+prand_pipe_t *prand_pipe_init(prand_t *rng, const prand_pipe_enum kind,
+    const size_t block, const size_t nblock, int *err) {
+  if (!rng || block == 0 || nblock < 2 || kind < PRAND_PIPE_INT ||
+      kind > PRAND_PIPE_DOUBLE53 || SIZE_MAX / sizeof(uint64_t) / block <
+      nblock) {
+    *err = PRAND_ERR_PIPE;
+    return NULL;
+  }
+
+  prand_pipe_t *pipe = calloc(1, sizeof(prand_pipe_t));
+  if (!pipe) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  pipe->rng = rng;
+  pipe->kind = kind;
+  pipe->block = block;
+  pipe->nblock = nblock;
+
+  /* The size is a multiple of the alignment, as required by `aligned_alloc`. */
+  pipe->ring = aligned_alloc(PRAND_CACHE_LINE,
+      sizeof(prand_pipe_ring_t) * rng->nstream);
+  if (!pipe->ring) {
+    prand_pipe_destroy(pipe);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  for (int i = 0; i < rng->nstream; i++) {
+    prand_pipe_ring_t *r = pipe->ring + i;
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    r->nprod = r->ncons = r->avail = r->base = r->idx = 0;
+    r->buf.i = NULL;
+  }
+  for (int i = 0; i < rng->nstream; i++) {
+    if (!(pipe->ring[i].buf.i = malloc(sizeof(uint64_t) * block * nblock))) {
+      prand_pipe_destroy(pipe);
+      *err = PRAND_ERR_MEMORY;
+      return NULL;
+    }
+  }
+
+  prand_pipe_ctrl_t *ctrl = malloc(sizeof(prand_pipe_ctrl_t));
+  if (!ctrl) {
+    prand_pipe_destroy(pipe);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  atomic_init(&ctrl->idle, 0);
+  atomic_init(&ctrl->stop, 0);
+  if (pthread_mutex_init(&ctrl->lock, NULL)) {
+    free(ctrl);
+    prand_pipe_destroy(pipe);
+    *err = PRAND_ERR_PIPE;
+    return NULL;
+  }
+  if (pthread_cond_init(&ctrl->cond, NULL)) {
+    pthread_mutex_destroy(&ctrl->lock);
+    free(ctrl);
+    prand_pipe_destroy(pipe);
+    *err = PRAND_ERR_PIPE;
+    return NULL;
+  }
+  pipe->ctrl = ctrl;
+  if (pthread_create(&ctrl->thread, NULL, pipe_produce, pipe)) {
+    pipe->ctrl = NULL;
+    pthread_cond_destroy(&ctrl->cond);
+    pthread_mutex_destroy(&ctrl->lock);
+    free(ctrl);
+    prand_pipe_destroy(pipe);
+    *err = PRAND_ERR_PIPE;
+    return NULL;
+  }
+  return pipe;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* prand_pipe.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_PIPE_H__
+#define __PRAND_PIPE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Background producer of random numbers. A worker thread fills a lock-free
+  single-producer single-consumer ring buffer for every stream of an
+  interface, with blocks sampled by the batch functions, and the numbers of
+  stream `i` are popped in exactly the same order as the ones sampled from
+  `rng->state_stream[i]` directly. Every stream can be consumed by one
+  thread at a time, and the interface must not be used elsewhere until the
+  pipeline is destroyed.
+*******************************************************************************/
+
+/*============================================================================*\
+                       Definitions of the numbers buffered
+\*============================================================================*/
+
+typedef enum {
+  PRAND_PIPE_INT = 0,           /* integers of `fill` */
+  PRAND_PIPE_DOUBLE = 1,        /* floating-point numbers of `fill_double` */
+  PRAND_PIPE_DOUBLE_POS = 2,    /* floating-point numbers of
+                                   `fill_double_pos` */
+  PRAND_PIPE_DOUBLE53 = 3       /* floating-point numbers of `fill_double53` */
+} prand_pipe_enum;
+
+/* Ring buffer of one stream. */
+typedef struct prand_pipe_ring_struct prand_pipe_ring_t;
+
+typedef struct {
+  prand_t *rng;                 /* the interface sampled by the producer */
+  prand_pipe_enum kind;         /* type of the buffered numbers */
+  size_t block;                 /* number of numbers in every block */
+  size_t nblock;                /* number of blocks in every ring */
+  prand_pipe_ring_t *ring;      /* ring buffers of all the streams */
+  void *ctrl;                   /* control of the producer thread */
+} prand_pipe_t;
+
+
+/*============================================================================*\
+                      Interfaces of the producer pipeline
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_pipe_init`:
+  Start a producer thread filling the ring buffers of all streams of an
+  interface, ahead of the consumers.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `kind`:     type of the buffered numbers;
+  * `block`:    number of numbers in every block;
+  * `nblock`:   number of blocks in every ring, at least 2;
+  * `err`:      an integer for storing the error message.
+Return:
+  The producer pipeline; NULL on error.
+******************************************************************************/
+prand_pipe_t *prand_pipe_init(prand_t *rng, const prand_pipe_enum kind,
+    const size_t block, const size_t nblock, int *err);
+
+/******************************************************************************
+Function `prand_pipe_get`:
+  Pop an integer from the ring buffer of a stream, for `PRAND_PIPE_INT`.
+  It waits for the producer only if the ring is empty.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `i`:        index of the stream.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+uint64_t prand_pipe_get(prand_pipe_t *pipe, const unsigned int i);
+
+/******************************************************************************
+Function `prand_pipe_get_double`:
+  Pop a floating-point number from the ring buffer of a stream, for
+  `PRAND_PIPE_DOUBLE`, `PRAND_PIPE_DOUBLE_POS`, and `PRAND_PIPE_DOUBLE53`.
+  It waits for the producer only if the ring is empty.
+Arguments:
+  * `pipe`:     the producer pipeline;
+  * `i`:        index of the stream.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+double prand_pipe_get_double(prand_pipe_t *pipe, const unsigned int i);
+
+/******************************************************************************
+Function `prand_pipe_destroy`:
+  Stop the producer thread and release the memory of the pipeline. The
+  numbers remaining in the buffers are discarded, so the states of the
+  interface are ahead of the numbers consumed.
+Arguments:
+  * `pipe`:     the producer pipeline.
+******************************************************************************/
+void prand_pipe_destroy(prand_pipe_t *pipe);
+
+#endif
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* dsfmt19937_simd.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+#include "dsfmt19937.h"
+#include "prand_cpu.h"
+
+/*******************************************************************************
+  Kernels for generating the state array of dSFMT19937, with optional
+  vectorisation. Every 128-bit word is generated with one vector register,
+  and since the recursion depends on the lung updated by the previous word,
+  the kernels do not benefit from wider vectors. All the kernels produce
+  identical results.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define N               DSFMT19937_N
+#define POS1            DSFMT19937_POS1
+#define SL1             DSFMT19937_SL1
+#define SR              DSFMT19937_SR
+
+
+/*============================================================================*\
+                                 Scalar kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `gen_all_scalar`:
+  Generate N 128-bit words at one time.
+Arguments:
+  * `s`:        the state array, followed by the lung.
+******************************************************************************/
+static void gen_all_scalar(uint64_t *s) {
+  uint64_t lung[2] = {s[N << 1], s[(N << 1) + 1]};
+  int i;
+  for (i = 0; i < N - POS1; i++)
+    dsfmt19937_recursion(s + (i << 1), s + (i << 1), s + ((i + POS1) << 1),
+        lung);
+  for (; i < N; i++)
+    dsfmt19937_recursion(s + (i << 1), s + (i << 1),
+        s + ((i + POS1 - N) << 1), lung);
+  s[N << 1] = lung[0];
+  s[(N << 1) + 1] = lung[1];
+}
+
+static const dsfmt19937_kernel_t kernel_scalar = { &gen_all_scalar };
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+/******************************************************************************
+Function `recursion_sse2`:
+  Generate a 128-bit word of the state array.
+Arguments:
+  * `a`:        pointer to the word to be replaced;
+  * `b`:        pointer to the word with the offset POS1;
+  * `lung`:     the lung, to be updated;
+  * `mask`:     the masks for the lung.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline void recursion_sse2(uint64_t *a, const uint64_t *b,
+    __m128i *lung, const __m128i mask) {
+  const __m128i x = _mm_loadu_si128((__m128i *) a);
+  /* swap the 32-bit halves of both 64-bit words, and then the two words */
+  __m128i y = _mm_shuffle_epi32(*lung, 0x1b);
+  const __m128i z = _mm_xor_si128(_mm_slli_epi64(x, SL1),
+      _mm_loadu_si128((__m128i *) b));
+  y = _mm_xor_si128(y, z);
+  __m128i v = _mm_xor_si128(_mm_srli_epi64(y, SR), x);
+  v = _mm_xor_si128(v, _mm_and_si128(y, mask));
+  _mm_storeu_si128((__m128i *) a, v);
+  *lung = y;
+}
+
+PRAND_TARGET("sse2")
+static void gen_all_sse2(uint64_t *s) {
+  const __m128i mask = _mm_set_epi64x((long long) DSFMT19937_MSK2,
+      (long long) DSFMT19937_MSK1);
+  __m128i lung = _mm_loadu_si128((__m128i *) (s + (N << 1)));
+  int i;
+  for (i = 0; i < N - POS1; i++)
+    recursion_sse2(s + (i << 1), s + ((i + POS1) << 1), &lung, mask);
+  for (; i < N; i++)
+    recursion_sse2(s + (i << 1), s + ((i + POS1 - N) << 1), &lung, mask);
+  _mm_storeu_si128((__m128i *) (s + (N << 1)), lung);
+}
+
+static const dsfmt19937_kernel_t kernel_sse2 = { &gen_all_sse2 };
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline void recursion_neon(uint64_t *a, const uint64_t *b,
+    uint64x2_t *lung, const uint64x2_t mask) {
+  const uint64x2_t x = vld1q_u64(a);
+  /* swap the 32-bit halves of both 64-bit words, and then the two words */
+  const uint32x4_t r = vrev64q_u32(vreinterpretq_u32_u64(*lung));
+  uint64x2_t y = vreinterpretq_u64_u32(vextq_u32(r, r, 2));
+  y = veorq_u64(y, veorq_u64(vshlq_n_u64(x, SL1), vld1q_u64(b)));
+  uint64x2_t v = veorq_u64(vshrq_n_u64(y, SR), x);
+  v = veorq_u64(v, vandq_u64(y, mask));
+  vst1q_u64(a, v);
+  *lung = y;
+}
+
+static void gen_all_neon(uint64_t *s) {
+  const uint64_t msk[2] = {DSFMT19937_MSK1, DSFMT19937_MSK2};
+  const uint64x2_t mask = vld1q_u64(msk);
+  uint64x2_t lung = vld1q_u64(s + (N << 1));
+  int i;
+  for (i = 0; i < N - POS1; i++)
+    recursion_neon(s + (i << 1), s + ((i + POS1) << 1), &lung, mask);
+  for (; i < N; i++)
+    recursion_neon(s + (i << 1), s + ((i + POS1 - N) << 1), &lung, mask);
+  vst1q_u64(s + (N << 1), lung);
+}
+
+static const dsfmt19937_kernel_t kernel_neon = { &gen_all_neon };
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `dsfmt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const dsfmt19937_kernel_t *dsfmt19937_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return &kernel_scalar;
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_gen_all`:
+  Generate `DSFMT19937_N` 128-bit words of the state array at one time, with
+  the fastest kernel supported by the CPU.
+Arguments:
+  * `s`:        the state array, followed by the lung.
+******************************************************************************/
+void prand_dsfmt19937_gen_all(uint64_t *s) {
+  dsfmt19937_kernel()->gen_all(s);
+}
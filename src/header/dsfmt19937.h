@@ -0,0 +1,105 @@
+/*******************************************************************************
+* dsfmt19937.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __DSFMT19937_H__
+#define __DSFMT19937_H__
+
+#include "prand.h"
+#include "prand_dsfmt19937_inline.h"
+
+/*============================================================================*\
+                 Definitions of the dSFMT19937 state transition
+\*============================================================================*/
+
+#define DSFMT19937_POS1         117
+#define DSFMT19937_SL1          19
+#define DSFMT19937_SR           12
+#define DSFMT19937_MSK1         0x000ffafffffffb3fULL
+#define DSFMT19937_MSK2         0x000ffdfffc90fffdULL
+
+/******************************************************************************
+Function `dsfmt19937_recursion`:
+  Generate a 128-bit word of the state array, with 64-bit words stored from
+  the least significant one.
+Arguments:
+  * `r`:        the generated word, which can be the same as `a`;
+  * `a`:        the word to be replaced;
+  * `b`:        the word with the offset POS1;
+  * `lung`:     the additional 128-bit word of the state, to be updated.
+******************************************************************************/
+static inline void dsfmt19937_recursion(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, uint64_t *lung) {
+  const uint64_t t0 = a[0], t1 = a[1];
+  const uint64_t l0 = lung[0], l1 = lung[1];
+  lung[0] = (t0 << DSFMT19937_SL1) ^ (l1 >> 32) ^ (l1 << 32) ^ b[0];
+  lung[1] = (t1 << DSFMT19937_SL1) ^ (l0 >> 32) ^ (l0 << 32) ^ b[1];
+  r[0] = (lung[0] >> DSFMT19937_SR) ^ (lung[0] & DSFMT19937_MSK1) ^ t0;
+  r[1] = (lung[1] >> DSFMT19937_SR) ^ (lung[1] & DSFMT19937_MSK2) ^ t1;
+}
+
+
+/*============================================================================*\
+                   Kernels for generating the state array
+\*============================================================================*/
+
+typedef struct {
+  /* generate `DSFMT19937_N` 128-bit words of the state array at one time,
+   * with the lung stored right after the array */
+  void (*gen_all) (uint64_t *);
+} dsfmt19937_kernel_t;
+
+/******************************************************************************
+Function `dsfmt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const dsfmt19937_kernel_t *dsfmt19937_kernel(void);
+
+
+/*============================================================================*\
+                            Initialisation function
+\*============================================================================*/
+
+/******************************************************************************
+Function `dsfmt19937_init`:
+  Initialisation of the dSFMT19937 generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *dsfmt19937_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err);
+
+#endif
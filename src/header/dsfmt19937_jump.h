@@ -0,0 +1,275 @@
+/*******************************************************************************
+* dsfmt19937_jump.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __DSFMT19937_JUMP_H__
+#define __DSFMT19937_JUMP_H__
+
+#include <stdint.h>
+
+/*============================================================================*\
+            Pre-computed polynomials for the modular reduction
+\*============================================================================*/
+
+/*******************************************************************************
+  ref: https://doi.org/10.1007/978-3-540-85912-3_26
+
+  phi is the characteristic polynomial of the state transition of dSFMT19937,
+  with the state being the 191 128-bit words for generating the next words,
+  as well as the 128-bit "lung". Since the exponent bits of the outputs are
+  constant, the transition is affine, and phi is that of the linear part
+  multiplied by (t + 1), so that it annihilates the affine transition.
+
+  The jump-ahead polynomials t^step mod phi are evaluated on the fly, with
+  the Barrett reduction:
+      mu = floor(t^(2 * deg) / phi).
+  The coefficients are stored from the lowest order, with 32-bit words.
+
+*******************************************************************************/
+
+#define DSFMT19937_POLY_DEG     19993   /* degree of phi */
+#define DSFMT19937_POLY_NW      625     /* number of words of phi and mu */
+
+const uint32_t dsfmt19937_phi[DSFMT19937_POLY_NW] = {
+  0x033ffc03UL,0xcc33fccfUL,0xfcffcf0cUL,0xcc73cfc3UL,0x07807e1cUL,0x601f987eUL,
+  0x01f86018UL,0x30412fe0UL,0x300ff0ffUL,0xc3ccf0cfUL,0x33f000ccUL,0xd6164e38UL,
+  0x61042ff3UL,0x7e3e9076UL,0x0be1ff80UL,0xcc2c3c00UL,0x82101c74UL,0x1808ea2cUL,
+  0xb6932bf5UL,0x1490e244UL,0x3192fa7eUL,0xc8f2c434UL,0xfcccf334UL,0x330c3300UL,
+  0xcc3f3c3fUL,0xc3cf00f0UL,0xe93eb150UL,0x7c043c37UL,0x9819e064UL,0x81bafe1fUL,
+  0x1ec0540aUL,0x45e82d90UL,0xc3978d9fUL,0x1f76327dUL,0xa6183119UL,0x50f8e97bUL,
+  0xfca38e92UL,0x3733d04cUL,0x0748ed4fUL,0xcf0dcccfUL,0x6206cdf3UL,0x6cb25dbdUL,
+  0x67d68df2UL,0x1bd3a51eUL,0x91d6dbf2UL,0x9debb945UL,0xcaba309fUL,0x8f571ee3UL,
+  0xf959e4d0UL,0x1fdd59acUL,0xf59da1d3UL,0x1388b2adUL,0xa59ab146UL,0x3ce1cd3fUL,
+  0x70c7d5aaUL,0x423971a8UL,0xd1309734UL,0x96a47674UL,0x53d2f0cbUL,0xa2e122bcUL,
+  0xa59aeab2UL,0x0a5e2b2bUL,0xc67ff030UL,0x86344477UL,0xecebaac5UL,0xcb29247fUL,
+  0xbb93a22aUL,0x80e403a9UL,0x0a8ece3dUL,0xa30e26f8UL,0x48b99ab2UL,0xb0b0bd6bUL,
+  0x7322cf03UL,0x34a75fbdUL,0x7b269877UL,0x0f884573UL,0xe8cd2598UL,0xf6dfc9afUL,
+  0xafecb056UL,0xfd70a55bUL,0x4027cde5UL,0x5313abe7UL,0x17180643UL,0x7e66dc76UL,
+  0x503a6e3fUL,0xfb276214UL,0x53765501UL,0x79ab1d97UL,0x35d1e5bcUL,0xff2cdd7dUL,
+  0x6458ac7aUL,0x02bc88afUL,0xd4c0f288UL,0x61045527UL,0x1a4e7c11UL,0xc1c28ee3UL,
+  0xc81be94eUL,0xaec65174UL,0xa853258fUL,0x877c466aUL,0x3b1fe092UL,0xcfc674c2UL,
+  0x7b02acb3UL,0xb08b46dcUL,0x6fc5dc67UL,0x611af7d7UL,0x7eb14cb1UL,0xa2f61f61UL,
+  0xc2b0b1dbUL,0xa016c4c9UL,0x4af2a324UL,0x02c60bf5UL,0x8a62b690UL,0x5213c27cUL,
+  0x8d090885UL,0xb1a15e45UL,0xddd5317eUL,0xb5815bfbUL,0xa205a419UL,0xeddbd791UL,
+  0xe0edef68UL,0x670affbaUL,0x1f53c28bUL,0x75b74d53UL,0xf3892d5aUL,0xa8dcdca8UL,
+  0x33e708bfUL,0x2da03632UL,0x73c3aa85UL,0xe25f8cbeUL,0x46ae7c0dUL,0x72998f59UL,
+  0x5d1bb8d9UL,0x7b1f7905UL,0x8bddf5bdUL,0xaa5568d8UL,0x0ba7db13UL,0x1a499a58UL,
+  0x0ebac5fbUL,0x3c8db851UL,0xba60d648UL,0x5843f098UL,0x15e42c04UL,0x56c69a3fUL,
+  0x1edf9e24UL,0xcd466ac4UL,0x434144deUL,0xbf0040afUL,0xa3ac95bfUL,0x01a8ac3fUL,
+  0x39572a4aUL,0xac4a5d0fUL,0xabe186d1UL,0x3f878009UL,0x6a36a5dcUL,0x29e71236UL,
+  0x1babbe85UL,0x717fcc25UL,0xc6540842UL,0x89217e5dUL,0xbc9b0d47UL,0x3507eed0UL,
+  0x627555e4UL,0xfbe411d8UL,0xef146b76UL,0xbdb01d31UL,0x169a081cUL,0x8ed0b3c9UL,
+  0xeeff4b2fUL,0x12e78650UL,0x17440809UL,0x52ab9630UL,0x867ed258UL,0x4a3f4349UL,
+  0x7d9834a4UL,0xa53c88a1UL,0x6d6f247cUL,0x66d13ecfUL,0x2607a76cUL,0xff048b8dUL,
+  0xcfcd898bUL,0x77322cefUL,0xffd805f1UL,0x4673757aUL,0x7c4ff1cbUL,0xf1efc607UL,
+  0x425b7340UL,0x750ba75bUL,0x32b16888UL,0xd8d335a2UL,0x9f536f86UL,0x3929080aUL,
+  0x8f67d3a5UL,0xa3854114UL,0xf64aea7bUL,0x72c6c68cUL,0x9c5fc52fUL,0x0073afd0UL,
+  0x4df8d09bUL,0x0741f34bUL,0xe9eb6e36UL,0xb9ec2f7aUL,0x06095fbdUL,0x145f12c0UL,
+  0x431f08ccUL,0xf5c868a1UL,0x8e3a5bc7UL,0x344f1458UL,0xa7aa45c1UL,0x7a2cf1f3UL,
+  0xc1a98815UL,0xff716f98UL,0xed146408UL,0xab675e08UL,0x4426f0eaUL,0xa34843cbUL,
+  0xc3f55c91UL,0xb51427ecUL,0xea298683UL,0xf8916411UL,0x9e196256UL,0xa4ad6d20UL,
+  0x97c34f4aUL,0x2c395137UL,0x4724d17cUL,0x193407d8UL,0x4847407bUL,0x491b6780UL,
+  0x2da3862aUL,0xd6768cd6UL,0x43b2113cUL,0x2688ba7fUL,0x72731d0bUL,0x6f00b9eaUL,
+  0x16005974UL,0x8dff5583UL,0x7df66497UL,0x9d62a98aUL,0xb2ac9ce0UL,0xda290f59UL,
+  0x79fe567bUL,0x32431c2bUL,0x9c18351fUL,0x92a056d3UL,0xc751390bUL,0xf7376890UL,
+  0x4065118aUL,0x288b458aUL,0xd11d896eUL,0x519f4b34UL,0x3dab9168UL,0x66974ffaUL,
+  0xb776a40fUL,0x0592f499UL,0x2f965eb1UL,0xfaee5cb2UL,0x732e0da7UL,0xea587f79UL,
+  0x768061c9UL,0x2f782726UL,0x2995955aUL,0x4fd69544UL,0xcbab978dUL,0x5a332f56UL,
+  0xbf5d7016UL,0xef179c62UL,0xd4185012UL,0xee36c3e0UL,0x91f690adUL,0xeb16a6a5UL,
+  0x6adae8ccUL,0x3b14269cUL,0xe634ca2fUL,0xf42b69b6UL,0x6065364dUL,0xb14f7cefUL,
+  0x42e6042dUL,0xc8c9af02UL,0x6912cbf8UL,0x51078a1fUL,0x20a824e3UL,0x558a8979UL,
+  0x0a754b90UL,0x03151680UL,0x588337ffUL,0x26e2a61aUL,0xf5539359UL,0x8a69f400UL,
+  0xf826aa36UL,0xea525660UL,0xd1a087baUL,0xe91a4c2fUL,0xfb6ba0c8UL,0xcae96d92UL,
+  0xf252ab9aUL,0x88c70c67UL,0x9b703af5UL,0xb033e0fdUL,0xb5afb0d5UL,0x4ac5aa86UL,
+  0x9432b1f5UL,0x9881fad9UL,0x462dbafeUL,0x09ad7ccdUL,0x98641c74UL,0x08337b24UL,
+  0x14915b33UL,0x5b70d6c0UL,0xcb8f66daUL,0xe6979420UL,0x8ba48951UL,0x3ad974deUL,
+  0x7dc80aaaUL,0xb91e9f19UL,0xece6bb5fUL,0xac33c6ccUL,0x8227c4fdUL,0xb1fb1f1eUL,
+  0x60ea8a17UL,0xc6c0f6f8UL,0x54709e18UL,0x65d2a067UL,0x43710722UL,0xe8dfeb38UL,
+  0x0db188d6UL,0x5ba9d38cUL,0xb196855dUL,0x24a2d292UL,0xc7a0355cUL,0xc9956b0dUL,
+  0x25b68001UL,0x77be13adUL,0x5ffcf217UL,0x550ee4f4UL,0xb8d6e6f9UL,0x2c5579c4UL,
+  0x4f324f9aUL,0x180abd02UL,0x3346b62dUL,0x9d94b604UL,0xe23b876cUL,0x2e6f8cc2UL,
+  0x9a233c2eUL,0xb3b95febUL,0xbe036410UL,0x786913eeUL,0x932c231bUL,0x46f8af3dUL,
+  0x312e989cUL,0x725ebd1aUL,0x02a0338dUL,0xe0577235UL,0x565589ffUL,0xcde8e707UL,
+  0xf6c6ecf9UL,0x2d85d80eUL,0xae84ab8eUL,0x2af99708UL,0xc13c8a84UL,0x86c59953UL,
+  0x632d0decUL,0x824efce2UL,0x1f6d4e89UL,0xf0f7f531UL,0x30108121UL,0x8a9f0958UL,
+  0x6e5def5fUL,0x29ddeb93UL,0x113df020UL,0x3ed096faUL,0xbe384352UL,0xd2a2167aUL,
+  0x08a494d2UL,0xea1b5373UL,0x7e11b5b5UL,0x11aa102cUL,0xca0a6b82UL,0xee66fc70UL,
+  0x98a7b3e2UL,0xc1ae4a68UL,0x65d79bc4UL,0x7c59e32bUL,0x77ef23dbUL,0x65cffc7fUL,
+  0xac1f8df9UL,0xa0785394UL,0x8827c5c4UL,0x50d58da5UL,0x106a680dUL,0x26c3018bUL,
+  0x5311f176UL,0x8e005edbUL,0x72515336UL,0xd9e49b2bUL,0xc0e94ea5UL,0xac2fca1eUL,
+  0xc25078edUL,0xf6d95d02UL,0x2752d682UL,0x30d82351UL,0x25d558b8UL,0x44daea35UL,
+  0xba36aef1UL,0x98b1ac63UL,0xf287cf0fUL,0x349847b9UL,0xefec3ef9UL,0xc7a368e6UL,
+  0xbb131acbUL,0x32610765UL,0x2584c85cUL,0x2e09aafdUL,0x6516ddebUL,0x8ac3b4e2UL,
+  0xed762c78UL,0xbcff03d0UL,0x423a9703UL,0x28d857a7UL,0x7706bc7cUL,0xc201bceaUL,
+  0x9f77f451UL,0xc35628daUL,0x73d6c22cUL,0x8114721fUL,0x30295d25UL,0x545056e4UL,
+  0xf8e597ddUL,0x41764e6cUL,0x061c4ed9UL,0xc8ee894aUL,0x0c141076UL,0xdf639bf1UL,
+  0x7c67f77bUL,0xec7e11d8UL,0xfe087f03UL,0x770137c7UL,0x7e4d5ea6UL,0xca2d2991UL,
+  0x80d74aacUL,0x1d87d647UL,0xc194e401UL,0xbc33d301UL,0xc6bcc8fbUL,0x82718e62UL,
+  0x9492acd8UL,0x74e27c75UL,0x8ed34fbbUL,0x2ef64646UL,0xa3f2d976UL,0xf752f2b3UL,
+  0xa28c2a52UL,0x3fc3e342UL,0x78f74547UL,0xf58ce004UL,0xc0cd601eUL,0x4d49782bUL,
+  0xf040123cUL,0x9602b0d1UL,0xaeb816b5UL,0x00379243UL,0xd72652d2UL,0xb91f0d63UL,
+  0x414ca716UL,0x1acfac03UL,0x3152f324UL,0x53002cc0UL,0xc2ffc355UL,0xb7a3998eUL,
+  0xed1b96c1UL,0xf95cd4f0UL,0xa560a14eUL,0x4cdb1c4dUL,0x5f9c69e4UL,0x3add5df4UL,
+  0x660486c8UL,0xf424c6caUL,0x4ca01310UL,0x99177d4cUL,0xc78ce6b8UL,0x30f28fa6UL,
+  0xd3af337fUL,0xb5d61518UL,0xed28a568UL,0x0efdd783UL,0x7efc5843UL,0x610903a6UL,
+  0x9690502fUL,0xb7956700UL,0x640ff2ffUL,0xcec453c2UL,0xbfa0bfc3UL,0xbb0a8204UL,
+  0x5e692dbaUL,0x9c5a48d6UL,0x1bcce3caUL,0x2ebb429fUL,0x0c450fd2UL,0x2f58a301UL,
+  0x1aec6e64UL,0x11d44f6cUL,0x58fc0958UL,0xab4398ebUL,0x9bd1d416UL,0xcf7f78edUL,
+  0x964fc323UL,0x524c5781UL,0x1b820dc9UL,0x71edffb4UL,0x31c42edaUL,0xa369f42bUL,
+  0x10eec89fUL,0xe5cb004eUL,0x88e6eeb3UL,0xf6b60df9UL,0xcf173243UL,0x00dc9f19UL,
+  0x748c596bUL,0x51c339daUL,0x04c6024dUL,0x91caa151UL,0x17a96639UL,0x6f7677b9UL,
+  0x0d0fd6a3UL,0xc925def1UL,0x10fad792UL,0xa98a76a1UL,0x61554052UL,0xbc232cf3UL,
+  0x18448505UL,0x30aaf7e3UL,0x4e847858UL,0xd8e495e3UL,0xedeb08b9UL,0x878b39d2UL,
+  0x327802b8UL,0x0dea9605UL,0x7ad5a172UL,0xfa408a2aUL,0x95235de2UL,0xbcc67c81UL,
+  0x3f242b58UL,0xbf74151eUL,0xa1209dc7UL,0x3cdb1996UL,0xa37ded4eUL,0xb7e3fe17UL,
+  0x447ffd00UL,0x87c7006bUL,0xfd5cf89dUL,0xbd22f1b4UL,0x580a3668UL,0xf0985740UL,
+  0x4bcf8760UL,0x029844abUL,0xb52b4753UL,0x3916dce6UL,0x34fc8d78UL,0x843d8f7dUL,
+  0xeb303d3dUL,0xdfb0cfdfUL,0xf99a3fd4UL,0x8ba3f05cUL,0xeea43f51UL,0xe9d8c773UL,
+  0x0bfa8e07UL,0x77c37578UL,0xc4cb3666UL,0x6db7765aUL,0x2d00122eUL,0x2a80615dUL,
+  0x42aff57fUL,0x279485e7UL,0xa0e3e453UL,0xe75aa124UL,0x3481355cUL,0xf006fdcbUL,
+  0xfcb7f17aUL,0xccf533b9UL,0x30093c75UL,0x39b2cf41UL,0xce8cf9bcUL,0x01fc3570UL,
+  0xcaf60183UL,0xcc7a3249UL,0x1d02213dUL,0x1e3e5d41UL,0xe5c76a8dUL,0xe9f89574UL,
+  0xcf13bf83UL,0xb44c3ff3UL,0xbb700304UL,0xb68e3cc4UL,0x46620135UL,0xc13d3e3aUL,
+  0xb3cf4cc1UL,0x42febfffUL,0x8e017202UL,0x4e3eb2fdUL,0xb030c0ceUL,0x40f88c37UL,
+  0x7fffb334UL,0xbf074ccbUL,0x3cc440f8UL,0xbcbc433cUL,0x70884f43UL,0x708c708cUL,
+  0x8cb3708cUL,0x800f0070UL,0x74bbb488UL,0xb487b4b8UL,0x4b7bb487UL,0x077847b8UL,
+  0xff0100ffUL,0xff3f3f00UL,0xfcfcfcfcUL,0x3c3cfcfcUL,0x0f0ef0fcUL,0xcf0f0f0fUL,
+  0x3333ccccUL,0x33333333UL,0xfcfffff3UL,0xffffffffUL,0x0000ffffUL,0x00000000UL,
+  0x03000000UL
+};
+
+const uint32_t dsfmt19937_mu[DSFMT19937_POLY_NW] = {
+  0x29c77211UL,0x69c1667aUL,0x347bcf11UL,0x3f251168UL,0x1581c6beUL,0x7b70a17bUL,
+  0x5ec9601aUL,0x47ceb732UL,0x86583263UL,0x133988eaUL,0xf161c160UL,0xa3bcdea4UL,
+  0x5426c6fdUL,0x27ce3b36UL,0x3766ccdbUL,0xbe2c9384UL,0x35663f9cUL,0x7d54275dUL,
+  0xdb8fd07aUL,0x503a5941UL,0x7c71ce2eUL,0xa5ffd6b6UL,0xeb413893UL,0xea815831UL,
+  0x38844741UL,0xdfb8c189UL,0x80d6d421UL,0xd8715a4bUL,0xda718d8aUL,0x06524226UL,
+  0x29b7da49UL,0xac00a376UL,0xe66b5c86UL,0x67ce0a77UL,0xdce5f6beUL,0xdd4357c0UL,
+  0xdbd94405UL,0xbb144760UL,0xecdcfe7dUL,0x8f994e50UL,0xd6663382UL,0x5129f018UL,
+  0x9c04f348UL,0x65cbe70aUL,0x8e2d93baUL,0xe98c32aeUL,0x44644d44UL,0x7d99ed5cUL,
+  0xa8ec7af1UL,0xa9893fb9UL,0x8f016361UL,0x7c227455UL,0xc2a74df3UL,0xf7913bdbUL,
+  0xbb6bbec6UL,0x245a55faUL,0x65fc8db1UL,0x8fdadb6dUL,0x0deca517UL,0xe7b089b7UL,
+  0x18304a2fUL,0xf7434557UL,0x76b9cd8bUL,0xa8210ec8UL,0xaba5311aUL,0xe0127fcfUL,
+  0x071b256eUL,0x2063e5faUL,0xebaf22c5UL,0x279343acUL,0x17808d38UL,0x4a7995b0UL,
+  0x5d73cba7UL,0x7283b55cUL,0x76427611UL,0xc002d54aUL,0x809fe6b4UL,0x0380c761UL,
+  0x3dba8313UL,0xfcca3915UL,0xeb5b8ee9UL,0x648ca3a6UL,0xddfdf9d6UL,0x5373212bUL,
+  0xbb4c08f0UL,0x4cdd8d37UL,0xf53355b1UL,0x13807776UL,0x01c964fdUL,0x07857827UL,
+  0xe22653f9UL,0x24a69891UL,0x7af773d5UL,0xf7f543c9UL,0xc3ccc9fdUL,0xa46c6b76UL,
+  0xa2ff242bUL,0xde72f60fUL,0x31772a36UL,0x5362ebe9UL,0x841138eeUL,0xa926409fUL,
+  0x3420f2b1UL,0xd5296d76UL,0x67241f2fUL,0x0339a44aUL,0xfe66e240UL,0xd2722faeUL,
+  0x18e61008UL,0x5b6d0cfdUL,0xb1361e81UL,0x68674009UL,0x6c0644edUL,0xbeab376cUL,
+  0xde39b3b6UL,0xd0be483cUL,0x8480abe6UL,0x9cee7cf2UL,0x1ca036c5UL,0x24ad8e52UL,
+  0x48971c00UL,0xaf2dc393UL,0xb9a23764UL,0x12c2dbbcUL,0xb22d1d01UL,0xa33cb8e8UL,
+  0xb8c840d1UL,0xe11d37c7UL,0xe15237caUL,0x3c9eacbfUL,0xd4383f00UL,0x7c403f28UL,
+  0xf5e24da6UL,0x2ca9548aUL,0xa46abfdbUL,0x4416ca29UL,0x01c3654dUL,0xb4bb2300UL,
+  0xe9947493UL,0xfc6c2c33UL,0xf8be1271UL,0xd98a71acUL,0x4cd12efeUL,0xfe7c8f34UL,
+  0x1df039c5UL,0xc2e6bccfUL,0xd58288bbUL,0x7dc63a28UL,0xed5e4451UL,0x121d9cb0UL,
+  0xfc24d5fdUL,0xce313706UL,0xaa0b0ae1UL,0xc925c561UL,0xdfcbc834UL,0x351fd026UL,
+  0xb880ac7bUL,0x528d9fe7UL,0xca1363b0UL,0xf8117737UL,0xc9694be4UL,0x140b1bcfUL,
+  0x2f950505UL,0x6d5c4895UL,0xeab7dadeUL,0x3e5cdaf9UL,0xc89e0f1dUL,0x86008992UL,
+  0x48e3a523UL,0xa89fb8f9UL,0x497ac6d9UL,0x612c2ca6UL,0x798f75aeUL,0x0a8f12cdUL,
+  0x61504aeaUL,0x606501e8UL,0x405de133UL,0x0626ec7dUL,0x3079bef7UL,0x4a91b3cbUL,
+  0x5d035c80UL,0x0a5739ddUL,0x1c1b32acUL,0xd7be8e10UL,0xbc030809UL,0x55743a10UL,
+  0xd752386fUL,0x490ecd90UL,0x03c8dbefUL,0x899546c9UL,0x7ac4f5b0UL,0xdda8307aUL,
+  0x148a3c10UL,0x8d54bf34UL,0xe7174d15UL,0x7cc52ef8UL,0xe85b1100UL,0x23cc3d04UL,
+  0x364ee3b6UL,0x4631b4c0UL,0x54156ad3UL,0x52e3acf9UL,0x6acb8165UL,0x7e0954d9UL,
+  0x60f6aa62UL,0x03f8cd4aUL,0x9f31fc52UL,0xccbeae18UL,0x85569031UL,0xb8398d58UL,
+  0x9262d0abUL,0xe69f0b7eUL,0x5b8af153UL,0xbdd11d95UL,0xc509b913UL,0xc61fa6f6UL,
+  0x201f381cUL,0x10c8d8f0UL,0x679e1d77UL,0x616f18d4UL,0x8dc00c10UL,0xf4b05e25UL,
+  0x00aeb665UL,0x1ba1e0bbUL,0x462f0673UL,0x10b7878dUL,0x02cb3356UL,0x800c4bf9UL,
+  0x3ee765bdUL,0x9195287cUL,0x9f44bca5UL,0xdca1c07dUL,0x86c0f22fUL,0x5c48b341UL,
+  0x08a15165UL,0x647389abUL,0x7fd11bd9UL,0xe9228fb9UL,0x745da771UL,0xcd0e3a75UL,
+  0x6bd2d45cUL,0x8c282508UL,0x25f2b9baUL,0xcb396285UL,0x079c0ba1UL,0x19ff57d0UL,
+  0x4e92747aUL,0x117df77dUL,0x140d64a6UL,0x840b11c6UL,0x6db862e1UL,0xd98ba531UL,
+  0x9a98ba5eUL,0xe3840903UL,0x8db037a5UL,0x4b384456UL,0x066539c3UL,0x19c93014UL,
+  0xc2a59b6bUL,0xa4d26860UL,0xad874fbcUL,0x3f9e0020UL,0x55342f70UL,0x708f3612UL,
+  0x37d8719cUL,0x90b5a9bdUL,0x5551ed82UL,0xd0b579f8UL,0x5df98457UL,0x83d853edUL,
+  0x25716f80UL,0x8ce51a48UL,0x6c208b0fUL,0x5f566cedUL,0xccf8ccd0UL,0x97e927a2UL,
+  0x8581fe80UL,0x51ced28eUL,0x7f08b285UL,0xbbd1939cUL,0x0db0bf52UL,0x13b9dc77UL,
+  0x45f64576UL,0xdc4d49e0UL,0x17af1ce4UL,0x4bf4b5e3UL,0x761c033bUL,0xba153bd9UL,
+  0x817166c1UL,0xfe91efc0UL,0x3f2c6cdfUL,0x4065a64fUL,0xad3d26e4UL,0x9bcaaf41UL,
+  0x15afc935UL,0xd7648c82UL,0x7b9b7d38UL,0x88fd2585UL,0x555e6c99UL,0xb3de2072UL,
+  0x048dde3dUL,0x6a4f0304UL,0xaae49e34UL,0x0d3eb763UL,0x1bac915eUL,0x4cb56f54UL,
+  0x0b97d511UL,0xddb22357UL,0xf0e27af6UL,0xc25196cfUL,0x3e207a2dUL,0x76fb1e04UL,
+  0x0607b327UL,0xeeed5a3eUL,0x8d41ad7eUL,0xda99918bUL,0xe36c7656UL,0x8223e631UL,
+  0x99db856dUL,0x7025d483UL,0xc05c56caUL,0xed5cd5d7UL,0x03272a35UL,0xa3a06f2aUL,
+  0x5b081859UL,0x1e68d39cUL,0x72eed134UL,0xd729f42fUL,0x2e231b37UL,0xe0fc4f79UL,
+  0x0c0c9502UL,0x4088488fUL,0xc9881d52UL,0x92694575UL,0x96fa93aaUL,0x43e7cedcUL,
+  0xee958c24UL,0x5ba493bdUL,0x222339f3UL,0x1b60b3a7UL,0x8db34068UL,0xa42d125aUL,
+  0xd0c48b05UL,0xc3755c76UL,0xe6a64fc2UL,0x95a2d693UL,0x7767386dUL,0x07c07723UL,
+  0xdbbced1cUL,0x14a6d404UL,0x05400803UL,0x4a4761f3UL,0xbda4abc2UL,0x7977bd8bUL,
+  0xc9c39c73UL,0x8effa52bUL,0x29a3cfb6UL,0x10269cdaUL,0xf47110c7UL,0xe95581b6UL,
+  0x14cf65e1UL,0xcaccfd0cUL,0x52685f1fUL,0xce7f73ffUL,0x85108b32UL,0x1bd63059UL,
+  0x68bc861cUL,0x68c9d310UL,0x75600d2bUL,0x408666b7UL,0x0a56ca5dUL,0xd85ee801UL,
+  0x56ed0bf7UL,0x6bb9811fUL,0x0a52d154UL,0xff4fd7faUL,0x62b0a80aUL,0xcce8aaf7UL,
+  0x79f9f4c0UL,0x69e65a17UL,0x39002f53UL,0x633cfd4bUL,0xdf7ee2f2UL,0x63acd6b0UL,
+  0x2634bcd5UL,0xb04e8964UL,0x08444339UL,0xf4555f03UL,0xcc93d647UL,0xc90fbd85UL,
+  0xf9b79061UL,0xc39b1414UL,0xc2ac143fUL,0x82d5d4aeUL,0x75ca870dUL,0x94b5f895UL,
+  0xbcd4eebaUL,0xbb14b1a0UL,0x91912234UL,0xff47c030UL,0xfcc7fdccUL,0xb1beceadUL,
+  0xe9e4ae86UL,0x5748c59cUL,0x9c390cadUL,0x5bc6fb47UL,0xb25c6d12UL,0xf811af17UL,
+  0x952bdc33UL,0x928eed64UL,0xcb97fe17UL,0xd8edba75UL,0xa625d774UL,0x9504a5ceUL,
+  0xef1367c1UL,0xeaed2fbbUL,0x2fe427eaUL,0x6feb5866UL,0xaa0b8350UL,0xde69afceUL,
+  0x8410fc48UL,0xaf17f89cUL,0xe72db63eUL,0x32c7f62bUL,0xdc329138UL,0xa19c69a9UL,
+  0x921aecf7UL,0x1308bac1UL,0xa71a46a4UL,0x2bb90144UL,0xca6f99d3UL,0xfc746267UL,
+  0x7cb6350fUL,0xb8f4b5e2UL,0x7c642400UL,0x18b5b576UL,0xd608673bUL,0x3194c084UL,
+  0x7658b6faUL,0x57137deeUL,0x1870367aUL,0x7747126eUL,0xcd8e272cUL,0xf9bffe9bUL,
+  0x796619d4UL,0xad68e932UL,0xd0065d3eUL,0xab120c72UL,0x625696e4UL,0x1d94a341UL,
+  0x5c4f4d8dUL,0xf1b0d26fUL,0x5dadf7d9UL,0xb4c2ea4fUL,0x7ccff430UL,0xdb19c6edUL,
+  0xb4dce656UL,0x069d1f0cUL,0x0d2f4205UL,0x2318184aUL,0x25b3c414UL,0xc7ad50deUL,
+  0xab42c896UL,0xfdc48c91UL,0xf8b034a1UL,0xbd93e01aUL,0x4cdcb43aUL,0x3529fbacUL,
+  0x3729eeffUL,0xa63bfda3UL,0xb8a282eeUL,0xc2e23e7aUL,0x630f3813UL,0x6d5ccb1fUL,
+  0x0d8137cbUL,0x08a71421UL,0xeb9a0b85UL,0x1c90313bUL,0x5ee5dea2UL,0x72013d59UL,
+  0x6d42ecdbUL,0xb5d37d6eUL,0x7cd65617UL,0xf4e0d22dUL,0xdfbad034UL,0xb077dec5UL,
+  0xa147c3baUL,0xdf551bc1UL,0x35ed2e93UL,0xfacfde66UL,0x6ea00e75UL,0xebafdb5cUL,
+  0x9711c5c3UL,0x12447b85UL,0x329b64daUL,0x5846be24UL,0xe911d69eUL,0xfdf725e6UL,
+  0x91a36e23UL,0xe3fc0e66UL,0x1cbbf509UL,0x83dca22aUL,0x2a9aa6d2UL,0x5d6c73c0UL,
+  0x523c27eeUL,0x177554daUL,0x0cd40c22UL,0x139dc0e6UL,0x6e1569bcUL,0xed54e3c2UL,
+  0xeaac2711UL,0x57ea5c70UL,0x992e2fd4UL,0xb5dd9facUL,0x4add3054UL,0x363b6e91UL,
+  0x8467d90bUL,0x70ad9ed5UL,0x8c442088UL,0x01d790faUL,0x20b2ec7aUL,0x47fab54fUL,
+  0x714f1e0dUL,0xb51902e5UL,0x1d8b5c8eUL,0x06040afcUL,0x6128d6fdUL,0xb68d3433UL,
+  0x262b908aUL,0x4a30c803UL,0x5198c7b6UL,0x04c46b57UL,0xd4c19bf8UL,0xa5c37a0bUL,
+  0xebdd0bebUL,0xac1a06ceUL,0xfd5f6624UL,0xf45601abUL,0xc93b80caUL,0x29c16454UL,
+  0xf254730bUL,0x04c8691fUL,0xafa0366cUL,0xfee4b853UL,0x0089a301UL,0xd3e41c4bUL,
+  0x0c135d4eUL,0xb36ca4ddUL,0x5f04114aUL,0x6d30dfcaUL,0x2b802cfaUL,0x997018d8UL,
+  0x7b641025UL,0x741fef26UL,0xa820de9aUL,0x9d6cebc5UL,0x0dc59db5UL,0x8fccdc08UL,
+  0x127d6f05UL,0x6769fce7UL,0x4581eb29UL,0x75c6dbd5UL,0x5939d996UL,0xed63cb06UL,
+  0x420a7ebfUL,0x8ebdb1beUL,0xa2bebffeUL,0xe624ae92UL,0x54af18d4UL,0x5b1bd429UL,
+  0x7414d696UL,0xf34d0439UL,0x8239727cUL,0x8d8dbe82UL,0xad8dbdbdUL,0xd6d46f12UL,
+  0x5ba01954UL,0x5414d655UL,0x74d4d56aUL,0x008207c5UL,0x8df67143UL,0x4dbd71beUL,
+  0x6d7eb282UL,0x1929e26dUL,0xf25d94ebUL,0x3270f270UL,0x12b3314cUL,0x99e461a3UL,
+  0xbeacd725UL,0x7e817d42UL,0x6d42be7eUL,0xe5e51da2UL,0x5d4c34c4UL,0x9d619ea2UL,
+  0x8ea25d9eUL,0x3a05fe42UL,0x1b10eb18UL,0xdb24d8e7UL,0x0717d42bUL,0xb5b677f7UL,
+  0xa7ac54abUL,0x6798645bUL,0x776b6897UL,0x0506c747UL,0x171ce41bUL,0xd42bd4ebUL,
+  0x24d8db24UL,0x56aa94ebUL,0x22d0b7b7UL,0xe1e1e121UL,0x1112eeeeUL,0xe2e12121UL,
+  0xaa57cffcUL,0x696969a9UL,0xaaaa6666UL,0x696aaaaaUL,0x3fc25a69UL,0x3c3c3c3cUL,
+  0xffff3333UL,0xffffffffUL,0x30ccccffUL,0x33333333UL,0xffff3333UL,0xffffffffUL,
+  0x03ffffffUL
+};
+
+#endif
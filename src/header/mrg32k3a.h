@@ -32,6 +32,36 @@
 #define __MRG32K3A_H__
 
 #include "prand.h"
+#include "prand_mrg32k3a_inline.h"
+
+/*============================================================================*\
+             Kernels for advancing multiple streams simultaneously
+\*============================================================================*/
+
+/* Number of streams that are advanced simultaneously, must be 4, 8, or 16. */
+#ifndef MRG32K3A_NLANE
+  #define MRG32K3A_NLANE        16
+#endif
+
+typedef struct {
+  /* Advance `MRG32K3A_NLANE` streams with the states stored in lane-major
+   * order, i.e., 6 arrays of `MRG32K3A_NLANE` numbers, for the components
+   * s10, s11, s12, s20, s21, and s22, respectively. The n-th output of the
+   * l-th stream is stored as the (n * MRG32K3A_NLANE + l)-th element of the
+   * output array, and converted by (x + offset) * scale. */
+  void (*lanes) (double *, double *, const size_t, const double,
+      const double);
+} mrg32k3a_kernel_t;
+
+/******************************************************************************
+Function `mrg32k3a_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels, or NULL if vector instructions are not
+  available.
+******************************************************************************/
+const mrg32k3a_kernel_t *mrg32k3a_kernel(void);
+
 
 /*============================================================================*\
                             Initialisation function
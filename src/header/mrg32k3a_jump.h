@@ -40,16 +40,45 @@
 /*******************************************************************************
   ref: https://doi.org/10.1016/B978-0-12-384988-5.00016-4
 
-  The matrices for skip length (g * 8^i) are computed:
-      A_k^(g * 8^i) mod m_k
-  with k in {1,2}, g from 0 to (MRG32K3A_MAX_STEP - 1), and i from 1 to 7.
+  The matrices for skip length (g * r^i) are computed:
+      A_k^(g * r^i) mod m_k
+  with k in {1,2}, g from 1 to (r - 1), and i from 0 to
+  (MRG32K3A_JUMP_NDIGIT - 1), where r is the radix `MRG32K3A_JUMP_RADIX`.
+  A larger radix reduces the number of matrix multiplications for a jump,
+  at the cost of a larger table:
+
+      radix     multiplications     size of the table
+      8         <= 21               21 KB
+      16        <= 16               35 KB
+      256       <= 8                287 KB
 
 *******************************************************************************/
 
-#define MRG32K3A_MAX_STEP_B8    21      /* maximum skip length (in log8) */
 #define MRG32K3A_MAX_STEP       0x7fffffffffffffffULL   /* max skip length */
 
-const uint64_t A1gj8i[MRG32K3A_MAX_STEP_B8][7][9] = {
+#ifndef MRG32K3A_JUMP_RADIX
+  #define MRG32K3A_JUMP_RADIX   8
+#endif
+
+#if MRG32K3A_JUMP_RADIX == 16
+  #define MRG32K3A_JUMP_BITS    4       /* bits of each digit of the step */
+  #define MRG32K3A_JUMP_NDIGIT  16      /* maximum number of digits */
+  #define MRG32K3A_JUMP_A1      A1gj16i
+  #define MRG32K3A_JUMP_A2      A2gj16i
+  #include "mrg32k3a_jump16.h"
+#elif MRG32K3A_JUMP_RADIX == 256
+  #define MRG32K3A_JUMP_BITS    8
+  #define MRG32K3A_JUMP_NDIGIT  8
+  #define MRG32K3A_JUMP_A1      A1gj256i
+  #define MRG32K3A_JUMP_A2      A2gj256i
+  #include "mrg32k3a_jump256.h"
+#elif MRG32K3A_JUMP_RADIX == 8
+  #define MRG32K3A_JUMP_BITS    3
+  #define MRG32K3A_JUMP_NDIGIT  21
+  #define MRG32K3A_JUMP_A1      A1gj8i
+  #define MRG32K3A_JUMP_A2      A2gj8i
+
+const uint64_t A1gj8i[MRG32K3A_JUMP_NDIGIT][7][9] = {
   {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL},
 {0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL},
 {0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL, 0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL},
@@ -199,7 +228,7 @@ const uint64_t A1gj8i[MRG32K3A_MAX_STEP_B8][7][9] = {
 {0x319d8017ULL, 0xfebe1fb0ULL, 0x9405de62ULL, 0x40978459ULL, 0x9c278ee1ULL, 0xfebe1fb0ULL, 0xcdc3df35ULL, 0xb82bd0c7ULL, 0x9c278ee1ULL}}
 };
 
-const uint64_t A2gj8i[MRG32K3A_MAX_STEP_B8][7][9] = {
+const uint64_t A2gj8i[MRG32K3A_JUMP_NDIGIT][7][9] = {
   {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL},
 {0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL},
 {0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL, 0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL},
@@ -349,4 +378,8 @@ const uint64_t A2gj8i[MRG32K3A_MAX_STEP_B8][7][9] = {
 {0x906c7089ULL, 0xb8269735ULL, 0x3b4ed387ULL, 0xd75c4478ULL, 0x906c7089ULL, 0xe613ffbULL, 0xaa558d60ULL, 0xd75c4478ULL, 0x6f5de0b6ULL}}
 };
 
+#else
+  #error "MRG32K3A_JUMP_RADIX must be 8, 16, or 256"
+#endif
+
 #endif
@@ -0,0 +1,531 @@
+/*******************************************************************************
+* mrg32k3a_jump16.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __MRG32K3A_JUMP16_H__
+#define __MRG32K3A_JUMP16_H__
+
+#include <stdint.h>
+
+/*============================================================================*\
+              Pre-computed matrices for jumping ahead with radix 16
+\*============================================================================*/
+
+/*******************************************************************************
+  The matrices A_k^(g * 16^i) mod m_k, with k in {1,2}, g from 1 to 15, and
+  i from 0 to 15. See `mrg32k3a_jump.h`.
+*******************************************************************************/
+
+const uint64_t A1gj16i[MRG32K3A_JUMP_NDIGIT][15][9] = {
+  {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL},
+{0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL},
+{0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL, 0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL},
+{0x0ULL, 0xfff3a047ULL, 0x156abcULL, 0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL, 0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL},
+{0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL, 0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL, 0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL},
+{0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL, 0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL, 0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL},
+{0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL, 0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL, 0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL},
+{0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL, 0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL, 0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL},
+{0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL, 0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL, 0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL},
+{0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL, 0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL, 0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL},
+{0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL, 0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL, 0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL},
+{0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL, 0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL, 0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL},
+{0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL, 0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL, 0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL},
+{0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL, 0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL, 0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL},
+{0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL, 0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL, 0x1715be86ULL, 0x3f53bd2aULL, 0xb089ba24ULL}},
+  {{0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL, 0x1715be86ULL, 0x3f53bd2aULL, 0xb089ba24ULL, 0xb02f22f8ULL, 0x1450198dULL, 0x3f53bd2aULL},
+{0x4a1e55beULL, 0x843f6983ULL, 0x65e08f9dULL, 0x786149acULL, 0xe5551effULL, 0x843f6983ULL, 0xe66ea277ULL, 0x896a5ae7ULL, 0xe5551effULL},
+{0x539ed19fULL, 0x2805f86cULL, 0x10a87b7bULL, 0x3f8cb105ULL, 0x74b4b1f7ULL, 0x2805f86cULL, 0xe2bafdd1ULL, 0x8063a612ULL, 0x74b4b1f7ULL},
+{0xc1399073ULL, 0xcdd5f87eULL, 0xddd73ec0ULL, 0xf22423caULL, 0x2e044aULL, 0xcdd5f87eULL, 0x36d1b0c9ULL, 0x248fd2b2ULL, 0x2e044aULL},
+{0xf76932f6ULL, 0x374f0df7ULL, 0x7e5c7da1ULL, 0x9d84d6b9ULL, 0x66308a58ULL, 0x374f0df7ULL, 0x2f780e12ULL, 0x20657069ULL, 0x66308a58ULL},
+{0xbb67b68aULL, 0x7ce7ac78ULL, 0x403e9bafULL, 0x7b5bcfd7ULL, 0x9f96d0baULL, 0x7ce7ac78ULL, 0xa22a2725ULL, 0x51481c1cULL, 0x9f96d0baULL},
+{0xe1cb6600ULL, 0xf7d7d8f2ULL, 0x3a788390ULL, 0x956b5decULL, 0x8793ff44ULL, 0xf7d7d8f2ULL, 0xed9b6ddfULL, 0xd48a67ceULL, 0x8793ff44ULL},
+{0x748a4e0eULL, 0x544f2468ULL, 0x68126bd2ULL, 0xd9c418cdULL, 0x620c20ddULL, 0x544f2468ULL, 0xd0b55548ULL, 0x8b4008e2ULL, 0x620c20ddULL},
+{0x9d3b90feULL, 0x87d28621ULL, 0x6183b86eULL, 0x99e79dbcULL, 0xec03961cULL, 0x87d28621ULL, 0x4d0e958fULL, 0x8e079fbeULL, 0xec03961cULL},
+{0xcba0cd4dULL, 0xfe868222ULL, 0xbf58201bULL, 0xb3887fd6ULL, 0x7cec32c3ULL, 0xfe868222ULL, 0xceaefd95ULL, 0xe5e8076ULL, 0x7cec32c3ULL},
+{0x3153f76aULL, 0x78d12646ULL, 0x8b78345eULL, 0xfded71f8ULL, 0xb885f514ULL, 0x78d12646ULL, 0xe65b69a7ULL, 0x7d5d0368ULL, 0xb885f514ULL},
+{0xabdea9f8ULL, 0x8ff59011ULL, 0xdfcf9a6cULL, 0xab44025bULL, 0xb86a1a20ULL, 0x8ff59011ULL, 0x98154616ULL, 0xec7af621ULL, 0xb86a1a20ULL},
+{0xa3cae6d2ULL, 0xc9423566ULL, 0xd4629b5ULL, 0x4017ade2ULL, 0xdd579228ULL, 0xc9423566ULL, 0xc3ab8858ULL, 0xe5f01dd1ULL, 0xdd579228ULL},
+{0x8ec3d19aULL, 0xb97ab62dULL, 0x57e4b48cULL, 0xe46949a1ULL, 0xa2f72f52ULL, 0xb97ab62dULL, 0x48791f74ULL, 0xe851cbf3ULL, 0xa2f72f52ULL},
+{0xace72904ULL, 0x31092d9aULL, 0x7ec698b5ULL, 0x276c579ULL, 0x917be9f6ULL, 0x31092d9aULL, 0xbc8e314ULL, 0x93116963ULL, 0x917be9f6ULL}},
+  {{0x45be4217ULL, 0x2edbf5cULL, 0xcd21b053ULL, 0x6ebdfe57ULL, 0x624fd275ULL, 0x2edbf5cULL, 0x13d93875ULL, 0xb951d2f0ULL, 0x624fd275ULL},
+{0x89087a52ULL, 0x88eb2566ULL, 0x336afb70ULL, 0x5371b62cULL, 0x3b688a79ULL, 0x88eb2566ULL, 0xccfbd677ULL, 0x58556b74ULL, 0x3b688a79ULL},
+{0x18e637e1ULL, 0x90388169ULL, 0x864c4fd5ULL, 0x823f173aULL, 0xe7a43a8dULL, 0x90388169ULL, 0x76a99a5aULL, 0x78ca4a5aULL, 0xe7a43a8dULL},
+{0xf723ad80ULL, 0x1b58777dULL, 0x3c0aa3ebULL, 0xfcc8c3d5ULL, 0xed342e7cULL, 0x1b58777dULL, 0x2103a31fULL, 0x8259689aULL, 0xed342e7cULL},
+{0x3fd864f2ULL, 0xec603cefULL, 0x6aee59c4ULL, 0x59a0b9bfULL, 0xdc6f26a4ULL, 0xec603cefULL, 0x8de1bb33ULL, 0xd9487255ULL, 0xdc6f26a4ULL},
+{0x44522b9bULL, 0xb9f2fa13ULL, 0xed0d7eb5ULL, 0x3d689634ULL, 0x65bc0348ULL, 0xb9f2fa13ULL, 0x83c06434ULL, 0xf7a667adULL, 0x65bc0348ULL},
+{0x86e430cfULL, 0x6bb2d113ULL, 0xb5d5dc39ULL, 0x557b09e8ULL, 0xba39e4f6ULL, 0x6bb2d113ULL, 0xec09d778ULL, 0xa5488b0eULL, 0xba39e4f6ULL},
+{0xd85dd475ULL, 0x7efc0fdeULL, 0x11735fe1ULL, 0x53003f67ULL, 0x4d7187cfULL, 0x7efc0fdeULL, 0x9a539ddbULL, 0x4890233eULL, 0x4d7187cfULL},
+{0x75f32ea0ULL, 0x22ebc5c5ULL, 0x65a4420eULL, 0x7638764eULL, 0x9004aee2ULL, 0x22ebc5c5ULL, 0x8119bf78ULL, 0xf6ccdbc0ULL, 0x9004aee2ULL},
+{0xe4ff9431ULL, 0x3889a67dULL, 0xf26bba40ULL, 0xfb6b5e83ULL, 0xdf09906aULL, 0x3889a67dULL, 0x6808372eULL, 0x2b8ef38dULL, 0xdf09906aULL},
+{0x4dce6137ULL, 0x7f92e2e0ULL, 0xe735947dULL, 0xcbf06c8dULL, 0x86aedbbeULL, 0x7f92e2e0ULL, 0xcc0bb4a1ULL, 0xf2d666daULL, 0x86aedbbeULL},
+{0x8b94159fULL, 0x530c10d4ULL, 0xc9d4f4dfULL, 0x62adcae9ULL, 0x15704332ULL, 0x530c10d4ULL, 0x81ac2a95ULL, 0xc59200c6ULL, 0x15704332ULL},
+{0x6d76a406ULL, 0x4508a658ULL, 0x7cebc010ULL, 0x34266c93ULL, 0x91f68af2ULL, 0x4508a658ULL, 0x743bba40ULL, 0x25501211ULL, 0x91f68af2ULL},
+{0xba0cbad6ULL, 0xbf59d1dcULL, 0x3f5ad85cULL, 0x136a49b1ULL, 0xa23977a4ULL, 0xbf59d1dcULL, 0xbdae79c9ULL, 0xe634047ULL, 0xa23977a4ULL},
+{0xfb5c4d72ULL, 0x2567b072ULL, 0x217f3329ULL, 0x88b246d6ULL, 0x749b8aa5ULL, 0x2567b072ULL, 0xc06c7605ULL, 0x6bcf14c8ULL, 0x749b8aa5ULL}},
+  {{0x353115afULL, 0x77290083ULL, 0xb1935f4aULL, 0x76fb09d2ULL, 0x80129927ULL, 0x77290083ULL, 0xe9cff80eULL, 0x63029d2ULL, 0x80129927ULL},
+{0x5e887c48ULL, 0x7e044aa7ULL, 0xc12a4f9bULL, 0xa58a0f9fULL, 0x53799abeULL, 0x7e044aa7ULL, 0xb3e64ffcULL, 0x1fe86d38ULL, 0x53799abeULL},
+{0x167c0286ULL, 0x417d11bbULL, 0x522667ceULL, 0x922e9b6eULL, 0xdb2dec14ULL, 0x417d11bbULL, 0xe2cbdc53ULL, 0xec2f1e52ULL, 0xdb2dec14ULL},
+{0x82725649ULL, 0x6a49f2b8ULL, 0xd52f7d8fULL, 0x71bea0b5ULL, 0x169a4995ULL, 0x6a49f2b8ULL, 0x210b0131ULL, 0xee783d7ULL, 0x169a4995ULL},
+{0x8617f767ULL, 0x871bbc62ULL, 0x79a0440cULL, 0xb8698e95ULL, 0xd1418702ULL, 0x871bbc62ULL, 0x85c4c28cULL, 0xea0cd618ULL, 0xd1418702ULL},
+{0x8c0d0619ULL, 0x8b6b60bfULL, 0xd9aace51ULL, 0x5110f1a4ULL, 0x1a6cf899ULL, 0x8b6b60bfULL, 0xaab61ddfULL, 0x232bd0d8ULL, 0x1a6cf899ULL},
+{0x11d42207ULL, 0xef786ecbULL, 0x2bf497b4ULL, 0x3c767eadULL, 0x1508a0dbULL, 0xef786ecbULL, 0x8736830bULL, 0x1dca08caULL, 0x1508a0dbULL},
+{0xefc7b124ULL, 0xeb8e0000ULL, 0x7fc20ef0ULL, 0x3e5c0a2aULL, 0x5ee3e094ULL, 0xeb8e0000ULL, 0x5a050144ULL, 0x16bab1c6ULL, 0x5ee3e094ULL},
+{0xaf6fd042ULL, 0xb696afbaULL, 0x89cb4ef4ULL, 0xbfe331e2ULL, 0x92dc2563ULL, 0xb696afbaULL, 0xeefe630eULL, 0xb209ce87ULL, 0x92dc2563ULL},
+{0xedb9ae18ULL, 0x1e888fa1ULL, 0x87ebfa72ULL, 0x697a6cfcULL, 0x95b6358ULL, 0x1e888fa1ULL, 0x72c0580fULL, 0x2b877157ULL, 0x95b6358ULL},
+{0x7a607cb1ULL, 0xf7c7e470ULL, 0xbe9d0e78ULL, 0xe135b6b8ULL, 0xba91a91cULL, 0xf7c7e470ULL, 0x4df16155ULL, 0x6ab446bdULL, 0xba91a91cULL},
+{0x5dddaa4cULL, 0xa836f1f2ULL, 0xd6ccd940ULL, 0xe71c3b33ULL, 0xcf2d7868ULL, 0xa836f1f2ULL, 0x362fcc0ULL, 0x13fb55a0ULL, 0xcf2d7868ULL},
+{0x64a5efa4ULL, 0xf89249a7ULL, 0x493d5125ULL, 0x4c0330c1ULL, 0x3e506f31ULL, 0xf89249a7ULL, 0x86bf7935ULL, 0x859dad78ULL, 0x3e506f31ULL},
+{0x2c33ef8dULL, 0x4b4b4f1fULL, 0xac257351ULL, 0xcf2126c4ULL, 0x9adb1f61ULL, 0x4b4b4f1fULL, 0x644679d6ULL, 0xcbe19abaULL, 0x9adb1f61ULL},
+{0xe305cde7ULL, 0xc010aa46ULL, 0xe04ee84dULL, 0xd2bbca9cULL, 0x66cb4ba2ULL, 0xc010aa46ULL, 0xcf843703ULL, 0xca561016ULL, 0x66cb4ba2ULL}},
+  {{0x867f5c9fULL, 0xdd712e32ULL, 0x264ecac3ULL, 0xd77dc082ULL, 0xecedd072ULL, 0xdd712e32ULL, 0x8f634f99ULL, 0x2cf64767ULL, 0xecedd072ULL},
+{0x4cb0f020ULL, 0x25657751ULL, 0x396e18c0ULL, 0x5bdf0d4cULL, 0x1b76c63aULL, 0x25657751ULL, 0x40f670c9ULL, 0xa1fd15d2ULL, 0x1b76c63aULL},
+{0x725d54ffULL, 0xb10adfebULL, 0x2fdf1838ULL, 0x8e6a01fbULL, 0xfa175501ULL, 0xb10adfebULL, 0x9ecbcd3ULL, 0x7d7c5354ULL, 0xfa175501ULL},
+{0xb036363aULL, 0xcee4bf29ULL, 0x8c415929ULL, 0xb295a0c8ULL, 0x191004ddULL, 0xcee4bf29ULL, 0x846c2cdbULL, 0x1637819bULL, 0x191004ddULL},
+{0xdae4f09bULL, 0x141bc8ceULL, 0xeb93559eULL, 0x5c573032ULL, 0xf2984151ULL, 0x141bc8ceULL, 0x28a34aeeULL, 0x1c298c44ULL, 0xf2984151ULL},
+{0xe3d4606eULL, 0xde93eae9ULL, 0x910227ceULL, 0xe80dc3e3ULL, 0x93b25dc9ULL, 0xde93eae9ULL, 0xedfd9f24ULL, 0xf043821eULL, 0x93b25dc9ULL},
+{0x61051d3dULL, 0x3762d10eULL, 0x61c6de4aULL, 0xeed3dfedULL, 0xc9da9de9ULL, 0x3762d10eULL, 0xb6d80735ULL, 0xafe39dd8ULL, 0xc9da9de9ULL},
+{0x1910366aULL, 0x926a17bULL, 0xd099a82cULL, 0x9eb4ab76ULL, 0xc36549bdULL, 0x926a17bULL, 0xf3921243ULL, 0x95a73086ULL, 0xc36549bdULL},
+{0xc50b40c5ULL, 0xeb14e90dULL, 0x850c608fULL, 0x55604200ULL, 0x8eeeb6d6ULL, 0xeb14e90dULL, 0x5197ce76ULL, 0xcf5a2b66ULL, 0x8eeeb6d6ULL},
+{0xea22a4e3ULL, 0xc25cdca3ULL, 0xda7a0a9aULL, 0xa9ab5438ULL, 0xd1b43e35ULL, 0xc25cdca3ULL, 0x6385388fULL, 0xffde4443ULL, 0xd1b43e35ULL},
+{0xb8efe118ULL, 0x2b088035ULL, 0x8aa8bbb6ULL, 0x9028a9efULL, 0xd9f98817ULL, 0x2b088035ULL, 0xdd09bbadULL, 0x36c631bfULL, 0xd9f98817ULL},
+{0x23d17068ULL, 0x2aa33e7cULL, 0xba717240ULL, 0xfee1f7bfULL, 0x746bc892ULL, 0x2aa33e7cULL, 0x7b9f384aULL, 0x9b8b7bbULL, 0x746bc892ULL},
+{0xbdeb0c7dULL, 0x51c7f879ULL, 0xd9a3cc07ULL, 0x5ba77bbULL, 0x3020322fULL, 0x51c7f879ULL, 0xcca47006ULL, 0x48f9fa17ULL, 0x3020322fULL},
+{0x1f13bde9ULL, 0x99184330ULL, 0x46018818ULL, 0x9ac0d289ULL, 0x594dabd9ULL, 0x99184330ULL, 0x2d0d4c8bULL, 0xa1c8e33bULL, 0x594dabd9ULL},
+{0x87ab086eULL, 0x154f71f4ULL, 0x66111c99ULL, 0xdccb12a3ULL, 0xf19903cfULL, 0x154f71f4ULL, 0x2be1e940ULL, 0xc2ca65eaULL, 0xf19903cfULL}},
+  {{0xc54d66d3ULL, 0x84d25219ULL, 0x31115a1bULL, 0xedfcdce6ULL, 0x64ebb329ULL, 0x84d25219ULL, 0x88d6fb1eULL, 0x538ee184ULL, 0x64ebb329ULL},
+{0x96c4055eULL, 0x593bfec4ULL, 0xfd836c7bULL, 0xdf4c2782ULL, 0x259a471dULL, 0x593bfec4ULL, 0x255fec6bULL, 0x2b04a963ULL, 0x259a471dULL},
+{0x18fc6d88ULL, 0x77b39418ULL, 0x4037619eULL, 0xe206f5e8ULL, 0x366c5ab1ULL, 0x77b39418ULL, 0x9f080bb4ULL, 0x535ea06cULL, 0x366c5ab1ULL},
+{0x993f7451ULL, 0xb52dab21ULL, 0x5ed53817ULL, 0x1f5af451ULL, 0x276b50bdULL, 0xb52dab21ULL, 0xfd14f9c8ULL, 0x2bd52e26ULL, 0x276b50bdULL},
+{0x8838811bULL, 0xc3c1925eULL, 0x689bb9c0ULL, 0x4b8aaadbULL, 0x19637bbfULL, 0xc3c1925eULL, 0xa0b3ca4aULL, 0x4361db92ULL, 0x19637bbfULL},
+{0xe166f1abULL, 0xade370dfULL, 0xaf0229bbULL, 0x9f0c02ccULL, 0xc4900734ULL, 0xade370dfULL, 0x951fa1f7ULL, 0xccfaa938ULL, 0xc4900734ULL},
+{0x596e876eULL, 0xfec82eaaULL, 0x4c456523ULL, 0xa5533040ULL, 0x6959e300ULL, 0xfec82eaaULL, 0x5f6e1b69ULL, 0x8900b09eULL, 0x6959e300ULL},
+{0x6e1bc1b5ULL, 0xf0f99be2ULL, 0xfcd44fafULL, 0x24281189ULL, 0x9da46f4dULL, 0xf0f99be2ULL, 0x9e740206ULL, 0x50018d13ULL, 0x9da46f4dULL},
+{0xec17e100ULL, 0xd8d8203eULL, 0xe49d6715ULL, 0x277ff736ULL, 0x80b49697ULL, 0xd8d8203eULL, 0x94d5fc6aULL, 0x9776d151ULL, 0x80b49697ULL},
+{0xd0c550dcULL, 0xdcc7e6b8ULL, 0xef191d5aULL, 0xaecf91feULL, 0x4614bfb4ULL, 0xdcc7e6b8ULL, 0xaac98fb7ULL, 0x93518701ULL, 0x4614bfb4ULL},
+{0x2c5f33d2ULL, 0x2e2ec6a3ULL, 0xb015eb4aULL, 0x51533671ULL, 0xe8fd7940ULL, 0x2e2ec6a3ULL, 0xa735b527ULL, 0xe87313ecULL, 0xe8fd7940ULL},
+{0xc1be4f9bULL, 0xe10b519aULL, 0xde8e77b7ULL, 0x599297f8ULL, 0x1126626aULL, 0xe10b519aULL, 0x9aea89aULL, 0xead2a72ULL, 0x1126626aULL},
+{0x6f5042c7ULL, 0xa19df471ULL, 0x2691344dULL, 0x4612d12dULL, 0x2e8de5b1ULL, 0xa19df471ULL, 0xd6cb9a6ULL, 0x7597fa30ULL, 0x2e8de5b1ULL},
+{0x2cae8c9dULL, 0xc05931c1ULL, 0xba05126fULL, 0xaa17d1f4ULL, 0x71d9966aULL, 0xc05931c1ULL, 0x9243693aULL, 0xfc2a77a3ULL, 0x71d9966aULL},
+{0x7927e2dULL, 0xcc739556ULL, 0x1aea554bULL, 0x8fbd5461ULL, 0xd3f7cb82ULL, 0xcc739556ULL, 0x3e523829ULL, 0xde796c92ULL, 0xd3f7cb82ULL}},
+  {{0x8fa35800ULL, 0x4155be49ULL, 0x546a4289ULL, 0x5984d7e1ULL, 0x839eca6ULL, 0x4155be49ULL, 0x606ce53aULL, 0x75ba2fa3ULL, 0x839eca6ULL},
+{0x23baeeeeULL, 0x468653aULL, 0xb0c05893ULL, 0x34ca54dULL, 0xe5ca53daULL, 0x468653aULL, 0xed547268ULL, 0xc7f0112bULL, 0xe5ca53daULL},
+{0xd18e11d2ULL, 0x73b97072ULL, 0xd6098e0fULL, 0xd408120bULL, 0xab3e07bcULL, 0x73b97072ULL, 0xbebf78c7ULL, 0xda074819ULL, 0xab3e07bcULL},
+{0xfe93741dULL, 0x307ba729ULL, 0xce593ef7ULL, 0x3e483749ULL, 0xb48af4ccULL, 0x307ba729ULL, 0xd0b9cc32ULL, 0xc5faabb0ULL, 0xb48af4ccULL},
+{0x6842315cULL, 0x129cfbc6ULL, 0x393a2a06ULL, 0xcd51bdfeULL, 0xfac62635ULL, 0x129cfbc6ULL, 0xaf4523ddULL, 0x215e134aULL, 0xfac62635ULL},
+{0x12d5daddULL, 0xba960f93ULL, 0xe4c15b47ULL, 0x60e6e299ULL, 0xad130cfdULL, 0xba960f93ULL, 0xc097983ULL, 0xdd5aa1c7ULL, 0xad130cfdULL},
+{0xa2760c06ULL, 0xe2dc2924ULL, 0x80be58a4ULL, 0x422f3309ULL, 0x4d321eb1ULL, 0xe2dc2924ULL, 0x9abc5063ULL, 0x7458f22eULL, 0x4d321eb1ULL},
+{0xb6482d5bULL, 0x381cc13cULL, 0x6a55a692ULL, 0x5c2d8140ULL, 0xf56434afULL, 0x381cc13cULL, 0x85f623c9ULL, 0x570f5fe1ULL, 0xf56434afULL},
+{0x6e7e1d8aULL, 0xfb4411eULL, 0xa5a0f043ULL, 0x8440e2e5ULL, 0x74f94da0ULL, 0xfb4411eULL, 0x86b55daaULL, 0x81fb723ULL, 0x74f94da0ULL},
+{0x71c7b07eULL, 0x8ecf3d9cULL, 0x5f8a79a2ULL, 0xda7b5d26ULL, 0xf2a69d77ULL, 0x8ecf3d9cULL, 0x929e92a7ULL, 0xa1bc3731ULL, 0xf2a69d77ULL},
+{0xd1a6af5bULL, 0x7bc12a6bULL, 0xa9e7f6eULL, 0x33fee092ULL, 0xb38f7cf1ULL, 0x7bc12a6bULL, 0xe9786718ULL, 0x94a52b67ULL, 0xb38f7cf1ULL},
+{0xadac6872ULL, 0x91d82501ULL, 0xdbd18333ULL, 0xace44ea7ULL, 0xae0e619cULL, 0x91d82501ULL, 0xb4bb22a4ULL, 0x59fcf90dULL, 0xae0e619cULL},
+{0x11083395ULL, 0xcf3e6607ULL, 0xfda69c70ULL, 0x944f5857ULL, 0x3aac8601ULL, 0xcf3e6607ULL, 0x757be646ULL, 0x91bcfb2ULL, 0x3aac8601ULL},
+{0xf51b6977ULL, 0xe7e66192ULL, 0x5d131023ULL, 0xe17c8331ULL, 0x8d0427baULL, 0xe7e66192ULL, 0xa365e20aULL, 0xa3e35edfULL, 0x8d0427baULL},
+{0x97640a31ULL, 0x18147594ULL, 0xe46366adULL, 0xad18ced3ULL, 0xf4b16c9dULL, 0x18147594ULL, 0x2665e78dULL, 0x7b9778bbULL, 0xf4b16c9dULL}},
+  {{0xfb56feb2ULL, 0xc7d7b295ULL, 0x89fd8e5eULL, 0x2616d2d5ULL, 0x5a138f0ULL, 0xc7d7b295ULL, 0x4a152155ULL, 0xec4ee4b4ULL, 0x5a138f0ULL},
+{0x86ffb5b2ULL, 0x72d0c94cULL, 0x420cfbe3ULL, 0x8e7f4adfULL, 0x16f692f1ULL, 0x72d0c94cULL, 0xd4c814d5ULL, 0xde4020deULL, 0x16f692f1ULL},
+{0x29f82ef0ULL, 0x9ebcd6cdULL, 0xbe768535ULL, 0x99ae3addULL, 0x16852e9eULL, 0x9ebcd6cdULL, 0xb61ee244ULL, 0x6f55fa6ULL, 0x16852e9eULL},
+{0x10223c21ULL, 0x3f850898ULL, 0xb2606965ULL, 0xfa27e021ULL, 0xac0b5a44ULL, 0x3f850898ULL, 0x2ca6e127ULL, 0x6e37c307ULL, 0xac0b5a44ULL},
+{0x4e7f5182ULL, 0xba516ad4ULL, 0x3361e4caULL, 0xc1c78c0cULL, 0x5b33648eULL, 0xba516ad4ULL, 0x37b39dbcULL, 0x1beb89a9ULL, 0x5b33648eULL},
+{0xbbfdd3fbULL, 0xde6741e9ULL, 0xc3b08e6eULL, 0x1ed2280dULL, 0x49039746ULL, 0xde6741e9ULL, 0x68868a9dULL, 0xab3ebcfbULL, 0x49039746ULL},
+{0x3a41432ULL, 0xfdd03b4ULL, 0x25e02ca4ULL, 0x4344cc43ULL, 0x52cb0530ULL, 0xfdd03b4ULL, 0x4b485642ULL, 0xbbf56a91ULL, 0x52cb0530ULL},
+{0x22095caULL, 0x5224ecc7ULL, 0x38b8b791ULL, 0x282989e8ULL, 0x388e33a3ULL, 0x5224ecc7ULL, 0xe306ba78ULL, 0x37411b03ULL, 0x388e33a3ULL},
+{0x68910f44ULL, 0x2d6b0149ULL, 0x30de5c6fULL, 0xb969ebedULL, 0xf6945cf5ULL, 0x2d6b0149ULL, 0x7b57540dULL, 0x809e38f0ULL, 0xf6945cf5ULL},
+{0x61a10badULL, 0xcd229f06ULL, 0x97acd180ULL, 0x3e794a9bULL, 0x8d25ec37ULL, 0xcd229f06ULL, 0xe5dbe853ULL, 0x533f54c1ULL, 0x8d25ec37ULL},
+{0xadd62a22ULL, 0xb43c1a9fULL, 0xa9b7fa85ULL, 0xde5a0c2cULL, 0x172dba99ULL, 0xb43c1a9fULL, 0x513133d5ULL, 0x58ddd344ULL, 0x172dba99ULL},
+{0x65dbdb1eULL, 0xecb0dd29ULL, 0x7333739ULL, 0x145a4ea6ULL, 0x6c80e76eULL, 0xecb0dd29ULL, 0x27400caeULL, 0x565737c3ULL, 0x6c80e76eULL},
+{0x30e02feeULL, 0x9d86e77fULL, 0xe6e64439ULL, 0xf67d4312ULL, 0xc2ac2572ULL, 0x9d86e77fULL, 0xd4929f0eULL, 0x89973345ULL, 0xc2ac2572ULL},
+{0xa213e690ULL, 0x99dfbc67ULL, 0x9245a725ULL, 0x1ffa89aULL, 0xa47685dfULL, 0x99dfbc67ULL, 0x8b2961cfULL, 0x25462360ULL, 0xa47685dfULL},
+{0x3c7e2110ULL, 0xa6aa39a5ULL, 0x1eb0e5fcULL, 0x72371434ULL, 0xe565feceULL, 0xa6aa39a5ULL, 0xba41eea3ULL, 0x1902db14ULL, 0xe565feceULL}},
+  {{0x70bddc38ULL, 0x4361e6faULL, 0xde9d8105ULL, 0x56deed6eULL, 0xc8721660ULL, 0x4361e6faULL, 0x2616593eULL, 0x53843e26ULL, 0xc8721660ULL},
+{0x8660508fULL, 0x8e2380feULL, 0x671f336fULL, 0xa9912516ULL, 0x6bbc2001ULL, 0x8e2380feULL, 0x14f24cb4ULL, 0x5d98545bULL, 0x6bbc2001ULL},
+{0x4577576bULL, 0x842ee803ULL, 0x774ff509ULL, 0x26fa1edULL, 0x21882eb5ULL, 0x842ee803ULL, 0x16f1a5d4ULL, 0x92397826ULL, 0x21882eb5ULL},
+{0xb5a41494ULL, 0xfd0b0bc3ULL, 0x92018e4aULL, 0x6b1d487cULL, 0x49be1ebdULL, 0xfd0b0bc3ULL, 0x88c1eb4ULL, 0xda601998ULL, 0x49be1ebdULL},
+{0x9ade6a32ULL, 0xd66f8f8fULL, 0x7207faabULL, 0xf63660b1ULL, 0x3e562169ULL, 0xd66f8f8fULL, 0xf105afbdULL, 0x76f56874ULL, 0x3e562169ULL},
+{0x7ffe1a1fULL, 0x506ee630ULL, 0xa2ed149cULL, 0x4dd68fdcULL, 0xc8e94e0ULL, 0x506ee630ULL, 0x958d6d6bULL, 0x3205d95eULL, 0xc8e94e0ULL},
+{0x15b8c28dULL, 0x1e24f49cULL, 0x3c540dfeULL, 0xcc66c351ULL, 0x5b330ae1ULL, 0x1e24f49cULL, 0xa4309867ULL, 0x4fae109bULL, 0x5b330ae1ULL},
+{0xc57d4492ULL, 0xfe24b98aULL, 0x3e700898ULL, 0xddb9ce29ULL, 0xbc0e3bbbULL, 0xfe24b98aULL, 0x7618732fULL, 0xff32e0caULL, 0xbc0e3bbbULL},
+{0x2dd7495dULL, 0x223ac065ULL, 0x97d510d0ULL, 0x5afef389ULL, 0x52b48865ULL, 0x223ac065ULL, 0x6206da66ULL, 0x9c6d8f7cULL, 0x52b48865ULL},
+{0x553576e3ULL, 0x35996b2fULL, 0xc1a43625ULL, 0xa5eda76bULL, 0x67b5a54ULL, 0x35996b2fULL, 0xf4a4758ULL, 0x577e020eULL, 0x67b5a54ULL},
+{0x9b9955f7ULL, 0x323e3dfULL, 0x173442ULL, 0xf2af7d10ULL, 0x91b2a030ULL, 0x323e3dfULL, 0x4b39e4bfULL, 0xcee712e5ULL, 0x91b2a030ULL},
+{0xa35117e7ULL, 0x54d333d8ULL, 0x4c7bff96ULL, 0x29bad6f5ULL, 0x22bc391fULL, 0x54d333d8ULL, 0x22170297ULL, 0x2ecf8216ULL, 0x22bc391fULL},
+{0xfe081547ULL, 0x2624df14ULL, 0x33cadeb4ULL, 0x1fe5004aULL, 0x4f87c044ULL, 0x2624df14ULL, 0x6e3b40d1ULL, 0xb6960c77ULL, 0x4f87c044ULL},
+{0x1abf57c8ULL, 0x32caffeaULL, 0x18946ce8ULL, 0x1da7df0eULL, 0x8d8d2854ULL, 0x32caffeaULL, 0x6d172b47ULL, 0x7a5ccefaULL, 0x8d8d2854ULL},
+{0xe94fdc4fULL, 0xa23a6d9cULL, 0xbe8a8b29ULL, 0xe5e87345ULL, 0xac0da16aULL, 0xa23a6d9cULL, 0x5d16f41eULL, 0x43141674ULL, 0xac0da16aULL}},
+  {{0x7785b941ULL, 0xc2804729ULL, 0x5b8a8a05ULL, 0xafec8ed9ULL, 0x6712bdf5ULL, 0xc2804729ULL, 0x44061589ULL, 0x873da0f3ULL, 0x6712bdf5ULL},
+{0x8d168c4cULL, 0x5005772ULL, 0xfff5f29cULL, 0x509dc474ULL, 0x5470c2d1ULL, 0x5005772ULL, 0x3e0a61a1ULL, 0x4dc4a2d9ULL, 0x5470c2d1ULL},
+{0xb1f97d60ULL, 0xf42b86a3ULL, 0x5b29f91bULL, 0x47a19e84ULL, 0x7b6299e8ULL, 0xf42b86a3ULL, 0x63d820b8ULL, 0xb96446c7ULL, 0x7b6299e8ULL},
+{0xbf93feb9ULL, 0x557c9ee7ULL, 0xaf8668baULL, 0xa4181210ULL, 0xf0e4f596ULL, 0x557c9ee7ULL, 0x4e83cbcfULL, 0x143224f2ULL, 0xf0e4f596ULL},
+{0xcb366330ULL, 0x82b9f995ULL, 0x6b034a43ULL, 0x50635134ULL, 0xdd2ec6b7ULL, 0x82b9f995ULL, 0x85acd399ULL, 0xd4750a02ULL, 0xdd2ec6b7ULL},
+{0xbe2284efULL, 0x57f4b1caULL, 0xa607e278ULL, 0xff85dcc3ULL, 0x8ee18e1eULL, 0x57f4b1caULL, 0x1806649cULL, 0x8469f80aULL, 0x8ee18e1eULL},
+{0x2c37d0c0ULL, 0x712cd9f6ULL, 0x6ca39896ULL, 0x4e656f7eULL, 0x3d43864fULL, 0x712cd9f6ULL, 0xbb532000ULL, 0xe67e3793ULL, 0x3d43864fULL},
+{0x11eb39fcULL, 0x7a78e5a7ULL, 0x59620c2dULL, 0x6909b6bcULL, 0x54c2a787ULL, 0x7a78e5a7ULL, 0xd573a425ULL, 0x47f9ee4bULL, 0x54c2a787ULL},
+{0x986b4b34ULL, 0x8d6956caULL, 0xfb8c4bf1ULL, 0xebc029e2ULL, 0xb6d82603ULL, 0x8d6956caULL, 0x139efc03ULL, 0x8b461bf4ULL, 0xb6d82603ULL},
+{0xcc1ca1fdULL, 0xd19ae805ULL, 0xb191181aULL, 0xa56f442eULL, 0x4ce7d705ULL, 0xd19ae805ULL, 0x41eafb00ULL, 0xcdfda743ULL, 0x4ce7d705ULL},
+{0x816d81fbULL, 0x6ac9aa5dULL, 0x306dfacbULL, 0xf6d10f5bULL, 0x31ff86f6ULL, 0x6ac9aa5dULL, 0x2c1cf3bdULL, 0xe460da88ULL, 0x31ff86f6ULL},
+{0xb3e483fdULL, 0x92534927ULL, 0x565cc550ULL, 0x685196c2ULL, 0xbf2e94bbULL, 0x92534927ULL, 0x5c0f90d1ULL, 0x63f6f1edULL, 0xbf2e94bbULL},
+{0x6b93a6bfULL, 0x5cb5f457ULL, 0x51156811ULL, 0xc46489b7ULL, 0x6351dacbULL, 0x5cb5f457ULL, 0xb3a64891ULL, 0x42a80a40ULL, 0x6351dacbULL},
+{0x61677afeULL, 0xd1e64182ULL, 0x34058c4ULL, 0x43c6bfd7ULL, 0xb1b6ac30ULL, 0xd1e64182ULL, 0x20e702d4ULL, 0x2dfec266ULL, 0xb1b6ac30ULL},
+{0x22d96853ULL, 0xb1c1c897ULL, 0x709a1644ULL, 0x508d9fe8ULL, 0x7c7ebfb9ULL, 0xb1c1c897ULL, 0x52a3816cULL, 0x9872856eULL, 0x7c7ebfb9ULL}},
+  {{0xf8a7c87cULL, 0xf24aba28ULL, 0x734e40e9ULL, 0xb5c7157dULL, 0x67fd0a47ULL, 0xf24aba28ULL, 0x387d922cULL, 0xeb90cee3ULL, 0x67fd0a47ULL},
+{0x60e12a3cULL, 0xd5351093ULL, 0xa59f400bULL, 0x671d36caULL, 0x3e8fa3ceULL, 0xd5351093ULL, 0x7c85b4c0ULL, 0x5d912a2dULL, 0x3e8fa3ceULL},
+{0x3314a90ULL, 0x8100e82cULL, 0x130c955dULL, 0x1ca41a61ULL, 0x78358f25ULL, 0x8100e82cULL, 0xdac68f11ULL, 0x4ddc704dULL, 0x78358f25ULL},
+{0x51d75dddULL, 0xebf39f76ULL, 0x21ec0a60ULL, 0x1870c01cULL, 0xd3abdbaeULL, 0xebf39f76ULL, 0x33d3281bULL, 0x642c4ee0ULL, 0xd3abdbaeULL},
+{0x1bc38c30ULL, 0x490b0244ULL, 0xe3fa2d3aULL, 0x60f54001ULL, 0xe38aeffaULL, 0x490b0244ULL, 0xa51f4677ULL, 0xc88c383cULL, 0xe38aeffaULL},
+{0xa44a9dc5ULL, 0xb07fb563ULL, 0x10cf8ec5ULL, 0xdb947ed1ULL, 0xa523f7caULL, 0xb07fb563ULL, 0xa00eb51cULL, 0x47a5c366ULL, 0xa523f7caULL},
+{0xfbb4b02aULL, 0xedc8f5bbULL, 0xa18a1a4eULL, 0xa3280b63ULL, 0xff72ce80ULL, 0xedc8f5bbULL, 0x29811f85ULL, 0xb1109557ULL, 0xff72ce80ULL},
+{0x7daef76aULL, 0x979cf242ULL, 0x36763a49ULL, 0x7de2555cULL, 0x3c5941eeULL, 0x979cf242ULL, 0x97bcfecfULL, 0xbb3882caULL, 0x3c5941eeULL},
+{0x203872a9ULL, 0x2b72e4bfULL, 0x659bc7cbULL, 0x55f032bfULL, 0xa9f0d721ULL, 0x2b72e4bfULL, 0xb537c039ULL, 0x97a9f7adULL, 0xa9f0d721ULL},
+{0x8540fb4ULL, 0x38dd85a1ULL, 0xbe6e59abULL, 0xab8aae62ULL, 0xfa87625aULL, 0x38dd85a1ULL, 0xda637720ULL, 0x21a4c420ULL, 0xfa87625aULL},
+{0xb392a8dbULL, 0xc1d40944ULL, 0x981103eaULL, 0xbc2cba33ULL, 0xc8454b3fULL, 0xc1d40944ULL, 0x59b0ed4ULL, 0xaf8ac268ULL, 0xc8454b3fULL},
+{0x47881a4fULL, 0xd09e5cf5ULL, 0x52426493ULL, 0x58c4186cULL, 0x739c2061ULL, 0xd09e5cf5ULL, 0x66a2d7f4ULL, 0xcde67bd0ULL, 0x739c2061ULL},
+{0xc1d2b12dULL, 0xf7ea65a6ULL, 0x7e164d23ULL, 0xe8d9d18dULL, 0xf29f7427ULL, 0xf7ea65a6ULL, 0x74b117caULL, 0x6e9ffc8dULL, 0xf29f7427ULL},
+{0x2a33b5e2ULL, 0x40118037ULL, 0x6e0a23cbULL, 0xdbcfabe2ULL, 0x23a3158cULL, 0x40118037ULL, 0x7df48c25ULL, 0xb0a3d54cULL, 0x23a3158cULL},
+{0xb5cd620bULL, 0x6964955eULL, 0x8a0aa106ULL, 0x6d83b653ULL, 0xbb33c370ULL, 0x6964955eULL, 0x896fb2e6ULL, 0xc1231c5cULL, 0xbb33c370ULL}},
+  {{0x44fae61eULL, 0x22dc2319ULL, 0x87799915ULL, 0x6143527bULL, 0xb3a3c80fULL, 0x22dc2319ULL, 0xed10f0e9ULL, 0x4e3f8efULL, 0xb3a3c80fULL},
+{0xd5660a5eULL, 0xbb02db86ULL, 0x8f483b25ULL, 0xd56fba56ULL, 0xdac11254ULL, 0xbb02db86ULL, 0x27252069ULL, 0x69324d03ULL, 0xdac11254ULL},
+{0x20061aebULL, 0xb3f0234dULL, 0x7dd25739ULL, 0xa1b74836ULL, 0xcee0bd5dULL, 0xb3f0234dULL, 0x12b47191ULL, 0x264a4acbULL, 0xcee0bd5dULL},
+{0xa6721eddULL, 0xd89d43ecULL, 0xe7af657fULL, 0xd6af786aULL, 0xce853cddULL, 0xd89d43ecULL, 0xbaee1512ULL, 0xa9748da1ULL, 0xce853cddULL},
+{0xb6a26a6eULL, 0xf6063838ULL, 0x1c075db4ULL, 0x7f5fe893ULL, 0xa85d7d9ULL, 0xf6063838ULL, 0x1563c1c0ULL, 0x6c9e18a9ULL, 0xa85d7d9ULL},
+{0x334fd35eULL, 0x3a7d895cULL, 0x38ed2b06ULL, 0x4cbde007ULL, 0xc0ad41f6ULL, 0x3a7d895cULL, 0x732d026eULL, 0x84598a76ULL, 0xc0ad41f6ULL},
+{0x1ad88248ULL, 0x96e50e0cULL, 0x65c1793ULL, 0x50be6d8bULL, 0xd7bae2b0ULL, 0x96e50e0cULL, 0x76bee512ULL, 0x2a10184fULL, 0xd7bae2b0ULL},
+{0x5136fa28ULL, 0xc08639faULL, 0xff0816d4ULL, 0xcc49c392ULL, 0xe56aba36ULL, 0xc08639faULL, 0x7dc140d5ULL, 0x918620f2ULL, 0xe56aba36ULL},
+{0x371ed98ULL, 0x63fa6f8aULL, 0xa890289cULL, 0x607b8160ULL, 0xde6fa762ULL, 0x63fa6f8aULL, 0x31ac82c2ULL, 0xabbaab12ULL, 0xde6fa762ULL},
+{0xa1711f50ULL, 0xff1aee1ULL, 0x9eb0da0dULL, 0xcae9e9ULL, 0x53825548ULL, 0xff1aee1ULL, 0x9b95de7aULL, 0x223c48eeULL, 0x53825548ULL},
+{0xcee7fa91ULL, 0xc68c5099ULL, 0x6ec6d424ULL, 0xa3dbbbbcULL, 0xeb4798b0ULL, 0xc68c5099ULL, 0xbc3d8828ULL, 0x3662df53ULL, 0xeb4798b0ULL},
+{0xf2437e36ULL, 0x3edee309ULL, 0xab3f68c4ULL, 0x961f900aULL, 0x99fbd6e0ULL, 0x3edee309ULL, 0x87bdfa76ULL, 0xafd84e55ULL, 0x99fbd6e0ULL},
+{0xa0a2c872ULL, 0x11f83953ULL, 0x58b363d5ULL, 0xd497abdULL, 0x423e3801ULL, 0x11f83953ULL, 0xe16615ebULL, 0xbc5923abULL, 0x423e3801ULL},
+{0x2985c76ULL, 0xd5bd35ceULL, 0x5c7ea3faULL, 0xf9a77145ULL, 0xd9518e71ULL, 0xd5bd35ceULL, 0x44aeee74ULL, 0xc16176a0ULL, 0xd9518e71ULL},
+{0xaacee218ULL, 0x60e71ee9ULL, 0xfb4cd1b2ULL, 0x2f2096acULL, 0x4ad08b24ULL, 0x60e71ee9ULL, 0xda73c1a5ULL, 0x9b6319e4ULL, 0x4ad08b24ULL}},
+  {{0x476ff35fULL, 0x77aed0b9ULL, 0x3b0741ULL, 0xc6c93a4dULL, 0x7c23390bULL, 0x77aed0b9ULL, 0x8b8a2bf7ULL, 0x34f0c1c7ULL, 0x7c23390bULL},
+{0xcf0fe50bULL, 0xbe571edaULL, 0x21af55abULL, 0x124d5f43ULL, 0x2e9f976dULL, 0xbe571edaULL, 0x9fda4eaULL, 0x81f060acULL, 0x2e9f976dULL},
+{0xeb35d7bbULL, 0x37ef03f1ULL, 0x99f96353ULL, 0x358e7122ULL, 0x71ce60d7ULL, 0x37ef03f1ULL, 0x5a7107d7ULL, 0x974e1e9bULL, 0x71ce60d7ULL},
+{0xe3303b1fULL, 0xc4e7e636ULL, 0xa4e6b792ULL, 0x36289a4dULL, 0x9edec765ULL, 0xc4e7e636ULL, 0x9502e201ULL, 0xc5a8e773ULL, 0x9edec765ULL},
+{0xa8945d57ULL, 0x11abb055ULL, 0xcab1d7c5ULL, 0xdc5eff3cULL, 0xe7877d6cULL, 0x11abb055ULL, 0xacfa853eULL, 0x65a5a85cULL, 0xe7877d6cULL},
+{0xeb979bceULL, 0x5729b9eULL, 0x57c7788aULL, 0x8b098efbULL, 0xe34e14fcULL, 0x5729b9eULL, 0xaf5fef5bULL, 0xc3f8836fULL, 0xe34e14fcULL},
+{0x4f8a416cULL, 0x33556538ULL, 0xa7eee9c1ULL, 0x19fb3e93ULL, 0xc8152155ULL, 0x33556538ULL, 0x5ecb42e7ULL, 0x79b4539bULL, 0xc8152155ULL},
+{0xffa3d4f8ULL, 0xb4c90d5dULL, 0x59bfa8f4ULL, 0x5b4adefeULL, 0x267e305dULL, 0xb4c90d5dULL, 0xaf65e3d5ULL, 0x83733588ULL, 0x267e305dULL},
+{0xfc310357ULL, 0xcdff7820ULL, 0x5284683fULL, 0xb385018bULL, 0xfb65761fULL, 0xcdff7820ULL, 0xd8bee657ULL, 0xab905463ULL, 0xfb65761fULL},
+{0x9ea7ebceULL, 0xac3763abULL, 0x5f6ad827ULL, 0x26361ea6ULL, 0xb0562bbeULL, 0xac3763abULL, 0xe46593f6ULL, 0xc6f24e12ULL, 0xb0562bbeULL},
+{0xfe92d9bbULL, 0x7051a4b8ULL, 0xdd2eb47cULL, 0xe8dd0f9fULL, 0xa0e21868ULL, 0x7051a4b8ULL, 0x7e78ca48ULL, 0xbdca19f6ULL, 0xa0e21868ULL},
+{0x8ea2d5d5ULL, 0x5c4ec18fULL, 0x161471d3ULL, 0x24ea5f93ULL, 0x9498db4bULL, 0x5c4ec18fULL, 0x5735d05eULL, 0x71eeb829ULL, 0x9498db4bULL},
+{0xf8f331f7ULL, 0xd212962bULL, 0x5aa20c8ULL, 0xdc2fa46cULL, 0x444120c9ULL, 0xd212962bULL, 0xb9b67b77ULL, 0x33e3d4adULL, 0x444120c9ULL},
+{0xace005a9ULL, 0xf6a933d9ULL, 0x6dc6550cULL, 0xb023d7f1ULL, 0x6b38d9a3ULL, 0xf6a933d9ULL, 0xddb82b27ULL, 0x35839e56ULL, 0x6b38d9a3ULL},
+{0x639f6613ULL, 0x3d1857aULL, 0x360854dbULL, 0xfce4fa8bULL, 0x7e8825fdULL, 0x3d1857aULL, 0x593daca3ULL, 0x7f4c486bULL, 0x7e8825fdULL}},
+  {{0xecfff183ULL, 0xd9a41e42ULL, 0x627e1615ULL, 0x64c18bfbULL, 0x4d2ffda8ULL, 0xd9a41e42ULL, 0xc7a44ffULL, 0xb81687e7ULL, 0x4d2ffda8ULL},
+{0xbd0a9dacULL, 0x888fe2beULL, 0x7cccc007ULL, 0xb2aefb6aULL, 0xf403a5e4ULL, 0x888fe2beULL, 0xc20d8870ULL, 0x3325f210ULL, 0xf403a5e4ULL},
+{0xcbcf3faaULL, 0x97da7ceeULL, 0xbdf51672ULL, 0xc6cf50a6ULL, 0xab6a5310ULL, 0x97da7ceeULL, 0x46f9bda6ULL, 0xce2c13bULL, 0xab6a5310ULL},
+{0xf527a629ULL, 0xb2cb4b17ULL, 0xee1f85f2ULL, 0x4f82d14eULL, 0xeee1c81fULL, 0xb2cb4b17ULL, 0xc60fc387ULL, 0xfefeaeeaULL, 0xeee1c81fULL},
+{0x52c8f60dULL, 0xe74a6e18ULL, 0x873e70dULL, 0xf32e7706ULL, 0x7a36d121ULL, 0xe74a6e18ULL, 0xdddf7b73ULL, 0xb7315a50ULL, 0x7a36d121ULL},
+{0x55c9a054ULL, 0x9d9130bbULL, 0x673defc1ULL, 0x70b7288aULL, 0x7e6dc930ULL, 0x9d9130bbULL, 0x958bd0ffULL, 0x4f9e6c69ULL, 0x7e6dc930ULL},
+{0x21a7e0baULL, 0xd3e7e3bfULL, 0x8dd15b80ULL, 0x4b13c85cULL, 0x8279be97ULL, 0xd3e7e3bfULL, 0x1ae9521aULL, 0xaad0462fULL, 0x8279be97ULL},
+{0x372e60ebULL, 0x7dbf1a04ULL, 0x700e3bf0ULL, 0x656bd86aULL, 0x58cb0d7eULL, 0x7dbf1a04ULL, 0xa21cf88cULL, 0x9734665ULL, 0x58cb0d7eULL},
+{0x1710a117ULL, 0x9e91140bULL, 0x8d847b6ULL, 0x34c8dab5ULL, 0x61f4d8dULL, 0x9e91140bULL, 0x10645892ULL, 0x695ba73cULL, 0x61f4d8dULL},
+{0x78f6d54aULL, 0x42675864ULL, 0x6543493eULL, 0x133a267eULL, 0xbbb4dd1fULL, 0x42675864ULL, 0xb8948739ULL, 0xe6758767ULL, 0xbbb4dd1fULL},
+{0x35738508ULL, 0xf5f50cd7ULL, 0x1ec39adcULL, 0x8582c9dULL, 0x815e3ea7ULL, 0xf5f50cd7ULL, 0x7b6d5cbcULL, 0x3e0e2b07ULL, 0x815e3ea7ULL},
+{0x3af2ead8ULL, 0xfbd43256ULL, 0xa1445257ULL, 0xe168b5caULL, 0xbf5e2543ULL, 0xfbd43256ULL, 0x773f7291ULL, 0xe0567e09ULL, 0xbf5e2543ULL},
+{0x8fc35d53ULL, 0x556fd37ULL, 0x8fadf679ULL, 0x56811b2cULL, 0x5d4fb1ecULL, 0x556fd37ULL, 0x596665e9ULL, 0xd1c337dULL, 0x5d4fb1ecULL},
+{0x5c7f5e6cULL, 0x96c85624ULL, 0xc9212560ULL, 0xc5cd8fb1ULL, 0xe8ed4befULL, 0x96c85624ULL, 0xbb2de125ULL, 0x8fd825feULL, 0xe8ed4befULL},
+{0x4bc431efULL, 0xf7189547ULL, 0x1a94e7e7ULL, 0x5c068df2ULL, 0x80e7ec9fULL, 0xf7189547ULL, 0x1d51746ULL, 0x4f970840ULL, 0x80e7ec9fULL}},
+  {{0x866ec0d1ULL, 0xce3f2b55ULL, 0xcfeed2dULL, 0x7f434863ULL, 0x156dcb42ULL, 0xce3f2b55ULL, 0xd4b884fbULL, 0xb9a781bbULL, 0x156dcb42ULL},
+{0x2e154f37ULL, 0xf56caa53ULL, 0xb733c12bULL, 0xe2ece45fULL, 0xb1d3f3cULL, 0xf56caa53ULL, 0xa9687da3ULL, 0x26d291f1ULL, 0xb1d3f3cULL},
+{0xf4d31bbULL, 0xf18840c2ULL, 0x5972c12bULL, 0xbb87c38dULL, 0x2231da14ULL, 0xf18840c2ULL, 0x21eb6e2ULL, 0xe6d0d1b6ULL, 0x2231da14ULL},
+{0x24abdcc7ULL, 0x57ee8c3fULL, 0xd5c4b7bdULL, 0x64f71fefULL, 0xb651c646ULL, 0x57ee8c3fULL, 0x21e5b2a0ULL, 0x4564af5eULL, 0xb651c646ULL},
+{0xf32bc705ULL, 0xa31358f8ULL, 0x36265562ULL, 0xd72dbf50ULL, 0x9b69dd06ULL, 0xa31358f8ULL, 0xe9bd5182ULL, 0xf3b52244ULL, 0x9b69dd06ULL},
+{0xde48a2c8ULL, 0x3e174159ULL, 0x9dd060daULL, 0xe7265479ULL, 0x81364d5ULL, 0x3e174159ULL, 0x1e4f027cULL, 0x81d3d361ULL, 0x81364d5ULL},
+{0x4411768fULL, 0x7607445eULL, 0x4e142be2ULL, 0xc3eeaf3bULL, 0x93ec77ccULL, 0x7607445eULL, 0x253f7e67ULL, 0x17598842ULL, 0x93ec77ccULL},
+{0x61500d2cULL, 0xea8823ULL, 0x7ae0d73bULL, 0xf998441fULL, 0x67c80ebdULL, 0xea8823ULL, 0xabca8512ULL, 0xed21c0a2ULL, 0x67c80ebdULL},
+{0xe762bcfaULL, 0x5f5b9365ULL, 0x327ba960ULL, 0xe53f653cULL, 0x16a7914cULL, 0x5f5b9365ULL, 0x86444c3ULL, 0xf553c7bdULL, 0x16a7914cULL},
+{0xfa51d8dfULL, 0xfcc5ccc2ULL, 0xb808ef52ULL, 0xb0ec562aULL, 0x8245633eULL, 0xfcc5ccc2ULL, 0xa87e5074ULL, 0x1624bea0ULL, 0x8245633eULL},
+{0x97932f3aULL, 0xfb685b5dULL, 0x6bdc05c0ULL, 0x2d3cf523ULL, 0x67a6d24fULL, 0xfb685b5dULL, 0x8599f34fULL, 0x938166a0ULL, 0x67a6d24fULL},
+{0xee904ec9ULL, 0x56bd6b74ULL, 0x4b85183fULL, 0x8a8c2d1bULL, 0x82aba8f5ULL, 0x56bd6b74ULL, 0xca05fdb6ULL, 0x8295c23fULL, 0x82aba8f5ULL},
+{0x878aa5b5ULL, 0x8b33af47ULL, 0x214717d6ULL, 0x9d79baa4ULL, 0x5e729ea2ULL, 0x8b33af47ULL, 0xa1fb3520ULL, 0xa856c7bfULL, 0x5e729ea2ULL},
+{0xdde147d2ULL, 0xbe526586ULL, 0x5b05a414ULL, 0xbc1cad6dULL, 0x87d1920cULL, 0xbe526586ULL, 0x7a42a064ULL, 0xffa67ab1ULL, 0x87d1920cULL},
+{0x784a5be2ULL, 0x735f8577ULL, 0x8d0ba3b1ULL, 0x357c2ae2ULL, 0x55c50711ULL, 0x735f8577ULL, 0x184c22e8ULL, 0x7789be36ULL, 0x55c50711ULL}},
+  {{0xcd66ce0fULL, 0x148d8b2cULL, 0x46c698fULL, 0x3c1d275fULL, 0x99c1e160ULL, 0x148d8b2cULL, 0xdfc0243eULL, 0x5bb2f13dULL, 0x99c1e160ULL},
+{0xd6a0c2f4ULL, 0x4bb17500ULL, 0xf28f0348ULL, 0x7a3edb4fULL, 0x847c1a41ULL, 0x4bb17500ULL, 0xbf3b7ffeULL, 0x292e44cdULL, 0x847c1a41ULL},
+{0x99d69cd0ULL, 0x994efc9dULL, 0xc6bb0062ULL, 0x2ff494efULL, 0xef0426bULL, 0x994efc9dULL, 0x3241130eULL, 0x3de8b081ULL, 0xef0426bULL},
+{0x23ba3b5bULL, 0xa743d22cULL, 0x67d81ba6ULL, 0x3a1f361fULL, 0x2d96fa29ULL, 0xa743d22cULL, 0xa2b4131fULL, 0x6dfc634cULL, 0x2d96fa29ULL},
+{0x71490c14ULL, 0x49c7a698ULL, 0xe54f6ba0ULL, 0xf1f5c8b3ULL, 0x9df5cde3ULL, 0x49c7a698ULL, 0x1dc11aaULL, 0x7b1119b7ULL, 0x9df5cde3ULL},
+{0x504e8bd0ULL, 0xb4da2b1cULL, 0xccc04524ULL, 0x929a3ab4ULL, 0x41248a4ULL, 0xb4da2b1cULL, 0xf2021fa9ULL, 0x4e51ab21ULL, 0x41248a4ULL},
+{0x319d8017ULL, 0xfebe1fb0ULL, 0x9405de62ULL, 0x40978459ULL, 0x9c278ee1ULL, 0xfebe1fb0ULL, 0xcdc3df35ULL, 0xb82bd0c7ULL, 0x9c278ee1ULL},
+{0x39a849aaULL, 0xce85ef3cULL, 0xcd4e177eULL, 0x2298f52aULL, 0x50177403ULL, 0xce85ef3cULL, 0x69d15f48ULL, 0xf00a8701ULL, 0x50177403ULL},
+{0x6d205bbbULL, 0x2a7ea3b0ULL, 0x4c0889b9ULL, 0x7e055b11ULL, 0x1dca89aeULL, 0x2a7ea3b0ULL, 0x4f33daffULL, 0x9323745cULL, 0x1dca89aeULL},
+{0x86720cdaULL, 0x313e033dULL, 0xd7601276ULL, 0xa420bf96ULL, 0xb084990ULL, 0x313e033dULL, 0x71cf576eULL, 0xc2606160ULL, 0xb084990ULL},
+{0x398ed807ULL, 0x7f11755aULL, 0xc4b23421ULL, 0xd60e1921ULL, 0xca2700e3ULL, 0x7f11755aULL, 0xe9db4522ULL, 0xa8752c3ULL, 0xca2700e3ULL},
+{0x27aa15d2ULL, 0x7294ce99ULL, 0xf8208611ULL, 0xdeb649d4ULL, 0xe7670eccULL, 0x7294ce99ULL, 0xd1975ed3ULL, 0x9be9ce1bULL, 0xe7670eccULL},
+{0x871f1c73ULL, 0xe4b5dbaaULL, 0x3e49646aULL, 0xe3310217ULL, 0xe98bd1d8ULL, 0xe4b5dbaaULL, 0x9f8aa2cfULL, 0x3a43b2e6ULL, 0xe98bd1d8ULL},
+{0x89513d37ULL, 0x3b39dc8aULL, 0xb6ca18b4ULL, 0xf4216d42ULL, 0x8735f851ULL, 0x3b39dc8aULL, 0xbbc74e84ULL, 0x834e16dbULL, 0x8735f851ULL},
+{0xb8020d6bULL, 0xff958f6fULL, 0x608dec52ULL, 0x4af491cdULL, 0xcd67cc69ULL, 0xff958f6fULL, 0xb281f864ULL, 0xbfbdbb65ULL, 0xcd67cc69ULL}}
+};
+
+const uint64_t A2gj16i[MRG32K3A_JUMP_NDIGIT][15][9] = {
+  {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL},
+{0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL},
+{0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL, 0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL},
+{0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL, 0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL, 0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL},
+{0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL, 0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL, 0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL},
+{0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL, 0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL, 0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL},
+{0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL, 0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL, 0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL},
+{0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL, 0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL, 0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL},
+{0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL, 0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL, 0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL},
+{0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL, 0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL, 0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL},
+{0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL, 0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL, 0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL},
+{0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL, 0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL, 0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL},
+{0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL, 0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL, 0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL},
+{0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL, 0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL, 0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL},
+{0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL, 0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL, 0x6c4f4699ULL, 0x30c751b6ULL, 0xc600cb66ULL}},
+  {{0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL, 0x6c4f4699ULL, 0x30c751b6ULL, 0xc600cb66ULL, 0xd03a3c1aULL, 0x6c4f4699ULL, 0xaa26943dULL},
+{0x1db94a63ULL, 0xae8fa4a9ULL, 0x305d9cd7ULL, 0x69eb70a0ULL, 0x1db94a63ULL, 0x1c9021b7ULL, 0xb6495839ULL, 0x69eb70a0ULL, 0x5b16dd4bULL},
+{0x5f8c0771ULL, 0x1d6d6d18ULL, 0x770019a5ULL, 0xc8d688e3ULL, 0x5f8c0771ULL, 0x5df6737bULL, 0xe047508aULL, 0xc8d688e3ULL, 0xf316e22ULL},
+{0xe80f389fULL, 0xbb36aae5ULL, 0x3d12911ULL, 0x4e4db2fULL, 0xe80f389fULL, 0x9e472f08ULL, 0x63d4a03cULL, 0x4e4db2fULL, 0x40eea38eULL},
+{0x8ffc488bULL, 0x5c384490ULL, 0xe0f706edULL, 0x24ed0b9ULL, 0x8ffc488bULL, 0x12adde90ULL, 0xb4dc73adULL, 0x24ed0b9ULL, 0x4282b8b5ULL},
+{0x126ac6dcULL, 0x14b9a523ULL, 0x9f50d920ULL, 0x613b8400ULL, 0x126ac6dcULL, 0x3abf29f4ULL, 0x584c5250ULL, 0x613b8400ULL, 0xd11bd0d0ULL},
+{0xd5a4d08ULL, 0x5058036dULL, 0x42e3945fULL, 0xa043ca44ULL, 0xd5a4d08ULL, 0x3212dbfbULL, 0xfeb738afULL, 0xa043ca44ULL, 0xa6a5bd01ULL},
+{0x1b4ffb0ULL, 0xd0615dc7ULL, 0x85084172ULL, 0xbd39d261ULL, 0x1b4ffb0ULL, 0xa89bd8ceULL, 0xdb69c088ULL, 0xbd39d261ULL, 0xe910d5d9ULL},
+{0x216cff43ULL, 0x2274d38aULL, 0x811c34dULL, 0x610c09f8ULL, 0x216cff43ULL, 0x1a2810e9ULL, 0xe3101cb3ULL, 0x610c09f8ULL, 0x925ec683ULL},
+{0xee3f8ce9ULL, 0x879b126fULL, 0xd05945baULL, 0x807f8785ULL, 0xee3f8ce9ULL, 0x457a35ddULL, 0x9a864954ULL, 0x807f8785ULL, 0x7f07a272ULL},
+{0x4f39aa77ULL, 0x26ff1f79ULL, 0xab93e031ULL, 0xe32f89deULL, 0x4f39aa77ULL, 0xde489f59ULL, 0x3a41a79cULL, 0xe32f89deULL, 0xf0ff0e14ULL},
+{0xcff11b6eULL, 0x4a850425ULL, 0x2d7f148fULL, 0x289d7d52ULL, 0xcff11b6eULL, 0x2cc5b651ULL, 0xe189df8cULL, 0x289d7d52ULL, 0x5755da6eULL},
+{0x3125b2f8ULL, 0x7c6bd9b8ULL, 0xcab95ea9ULL, 0x1b3180dcULL, 0x3125b2f8ULL, 0xe9bc26bdULL, 0x49f8c097ULL, 0x1b3180dcULL, 0xde42ef3aULL},
+{0x340ef308ULL, 0x5c09684cULL, 0x6f22313ULL, 0xaee7a245ULL, 0x340ef308ULL, 0xb8209857ULL, 0x3b9c9087ULL, 0xaee7a245ULL, 0xc2eadcbdULL},
+{0xc7f53db3ULL, 0x97004f53ULL, 0x4a453f76ULL, 0xc89a2c89ULL, 0xc7f53db3ULL, 0xbe558fe6ULL, 0x2621bf49ULL, 0xc89a2c89ULL, 0xbc749549ULL}},
+  {{0x57403695ULL, 0x11ee7c4bULL, 0xc5841c2eULL, 0x6b44e662ULL, 0x57403695ULL, 0xbd3c8916ULL, 0x70314de2ULL, 0x6b44e662ULL, 0xd135f878ULL},
+{0x7cb458e4ULL, 0xaf8cabbULL, 0x8345f9e4ULL, 0xb8fda124ULL, 0x7cb458e4ULL, 0xcb39c2a8ULL, 0xfdc374c3ULL, 0xb8fda124ULL, 0x8e77999fULL},
+{0xf2d0872aULL, 0x8f17192bULL, 0x602097d0ULL, 0xc0676590ULL, 0xf2d0872aULL, 0x82a7d6e9ULL, 0xef75752aULL, 0xc0676590ULL, 0x942fbd2bULL},
+{0x30742163ULL, 0x996c4b8cULL, 0xf87ae05bULL, 0xc819096ULL, 0x30742163ULL, 0xb150ec64ULL, 0xc10c3308ULL, 0xc819096ULL, 0xdc1c3636ULL},
+{0xc0e5cebfULL, 0x5bdc41aaULL, 0x666b4329ULL, 0xcb273492ULL, 0xc0e5cebfULL, 0x6d678d07ULL, 0x2bd702b9ULL, 0xcb273492ULL, 0xe8cc9615ULL},
+{0x60ace519ULL, 0x85ca41f8ULL, 0x2510485ULL, 0xd7a90230ULL, 0x60ace519ULL, 0xc469ada2ULL, 0x18af945dULL, 0xd7a90230ULL, 0x414ef26fULL},
+{0xa2495104ULL, 0x40be518bULL, 0x4a7431efULL, 0xf2984a66ULL, 0xa2495104ULL, 0x5df3bd1cULL, 0x9a1b17eaULL, 0xf2984a66ULL, 0x7bb71243ULL},
+{0x1c732b2aULL, 0xc58f9d15ULL, 0xcd2c7266ULL, 0xa4411fccULL, 0x1c732b2aULL, 0xa5dcd603ULL, 0x5fbcfeb2ULL, 0xa4411fccULL, 0x3d996538ULL},
+{0x9ba1f8c7ULL, 0xae9e6332ULL, 0x388172daULL, 0xd199dd98ULL, 0x9ba1f8c7ULL, 0x94dfa0dcULL, 0x22a64263ULL, 0xd199dd98ULL, 0x4c205913ULL},
+{0xc0bb47b5ULL, 0x94b0d760ULL, 0x3bc1353bULL, 0xb45efb5cULL, 0xc0bb47b5ULL, 0xc6f8ed4eULL, 0x75f75b39ULL, 0xb45efb5cULL, 0xe1eb8322ULL},
+{0xba7171abULL, 0xb8818c07ULL, 0x608dacf2ULL, 0x703ccd69ULL, 0xba7171abULL, 0xdeb2d9e3ULL, 0x9976af94ULL, 0x703ccd69ULL, 0x95016bd8ULL},
+{0x99030999ULL, 0x2e973c10ULL, 0xee0d9c89ULL, 0x18019530ULL, 0x99030999ULL, 0xa7e97ff6ULL, 0xbe31ba5aULL, 0x18019530ULL, 0xabf0e55bULL},
+{0x1adc32cbULL, 0xf72979c1ULL, 0xa4c951a4ULL, 0x7055febfULL, 0x1adc32cbULL, 0xf8e78279ULL, 0x21bc0a50ULL, 0x7055febfULL, 0xc76a96bdULL},
+{0x848ab8ccULL, 0xfa161935ULL, 0xa3381afeULL, 0x45d546b0ULL, 0x848ab8ccULL, 0xe8bc39efULL, 0x9cd1f6f5ULL, 0x45d546b0ULL, 0xcd62db0aULL},
+{0x8ececb00ULL, 0x3a4543c3ULL, 0xcc875a37ULL, 0x5e29df10ULL, 0x8ececb00ULL, 0xf7a4b1f3ULL, 0x5bde2699ULL, 0x5e29df10ULL, 0x5417b0ccULL}},
+  {{0x8079db23ULL, 0xc6469b94ULL, 0xe5152b3aULL, 0x1133c12aULL, 0x8079db23ULL, 0x22130be3ULL, 0x5981c82eULL, 0x1133c12aULL, 0xae88fdf6ULL},
+{0x7c1ff4a5ULL, 0x2cb05823ULL, 0xec4547b4ULL, 0xa4cc6934ULL, 0x7c1ff4a5ULL, 0xd52bf61bULL, 0xa9549cf2ULL, 0xa4cc6934ULL, 0x6a3b6eb3ULL},
+{0x5e60e161ULL, 0x7a8c7e9dULL, 0x3509b22ULL, 0x8f633e02ULL, 0x5e60e161ULL, 0x67892d85ULL, 0x42b1389fULL, 0x8f633e02ULL, 0x465de9c4ULL},
+{0xe01f8bb6ULL, 0x3e1b7222ULL, 0x6b3d8e20ULL, 0x3cec73eeULL, 0xe01f8bb6ULL, 0x4f6d3bf8ULL, 0x1080c0e6ULL, 0x3cec73eeULL, 0xed312f90ULL},
+{0x55bfb306ULL, 0xd7b6d0f9ULL, 0x5d91ccd3ULL, 0xdad81fefULL, 0x55bfb306ULL, 0x361dd5f8ULL, 0xde765545ULL, 0xdad81fefULL, 0x48d2df0cULL},
+{0x1cd60494ULL, 0xb9b46295ULL, 0x8d8b1b63ULL, 0x701b399ULL, 0x1cd60494ULL, 0xfc6167b1ULL, 0x2e275db9ULL, 0x701b399ULL, 0x1fa32bd7ULL},
+{0x38fa42e8ULL, 0x74edef9aULL, 0xd93f9163ULL, 0xcb87445ULL, 0x38fa42e8ULL, 0x374f7f22ULL, 0x63a31f2bULL, 0xcb87445ULL, 0xf987bf52ULL},
+{0x3ce0008fULL, 0x4e3bd724ULL, 0x664de85bULL, 0xb51231e6ULL, 0x3ce0008fULL, 0xbddcc1dULL, 0x99f2361bULL, 0xb51231e6ULL, 0xd2fe50c3ULL},
+{0x90960a0aULL, 0x9664da62ULL, 0xa4c03c0aULL, 0x6d210fe7ULL, 0x90960a0aULL, 0x7544f2d5ULL, 0xb29a3077ULL, 0x6d210fe7ULL, 0x1bb74342ULL},
+{0x124cf208ULL, 0x7111ab7bULL, 0xd118b791ULL, 0xb25d56b6ULL, 0x124cf208ULL, 0x758c4ee6ULL, 0x4ed7f6a6ULL, 0xb25d56b6ULL, 0x1d4dc0b2ULL},
+{0x309db38dULL, 0x185e140ULL, 0x1be6fdedULL, 0xa79d335ULL, 0x309db38dULL, 0x8a8bd036ULL, 0xee30f158ULL, 0xa79d335ULL, 0x26a4a278ULL},
+{0x1f97d89bULL, 0xf4ad4e48ULL, 0xaf0332a2ULL, 0x102c1be8ULL, 0x1f97d89bULL, 0xe2961dacULL, 0xfd84d8c4ULL, 0x102c1be8ULL, 0x9e3dd420ULL},
+{0xac8c25bdULL, 0xf85b678dULL, 0xeda58e7fULL, 0x425b9852ULL, 0xac8c25bdULL, 0xb9238302ULL, 0x57c61565ULL, 0x425b9852ULL, 0xb57622bfULL},
+{0xffacf2eaULL, 0x9ac7f98fULL, 0xd05588cdULL, 0xad4c8824ULL, 0xffacf2eaULL, 0x40ab919bULL, 0xcca0e23bULL, 0xad4c8824ULL, 0xf5c93cf7ULL},
+{0x140b43ccULL, 0xdd6f04a2ULL, 0x702c87a6ULL, 0xd71147daULL, 0x140b43ccULL, 0xd7ba62f8ULL, 0x3f630e5bULL, 0xd71147daULL, 0xa189434aULL}},
+  {{0x992621a6ULL, 0x613c364fULL, 0x9aabadc3ULL, 0x3d6dfd87ULL, 0x992621a6ULL, 0xceb02516ULL, 0x77225880ULL, 0x3d6dfd87ULL, 0xbd37d209ULL},
+{0x8b27c4cdULL, 0xb99d4e7bULL, 0x23dcec33ULL, 0x7dc71616ULL, 0x8b27c4cdULL, 0x286eb0d1ULL, 0x6251b9e0ULL, 0x7dc71616ULL, 0x8071e5d8ULL},
+{0x9e387cedULL, 0x26fd224eULL, 0xebb31c6aULL, 0x9254230bULL, 0x9e387cedULL, 0x9a49676ULL, 0xd86d8ec6ULL, 0x9254230bULL, 0xa20c5fbfULL},
+{0x2198b9d8ULL, 0xb6778a9ULL, 0x61d8c37eULL, 0x2e867451ULL, 0x2198b9d8ULL, 0xb492d7a2ULL, 0x796f33e2ULL, 0x2e867451ULL, 0x7c408355ULL},
+{0x6e8eb29dULL, 0xe76da9b2ULL, 0x30ba4b27ULL, 0x1e5e5936ULL, 0x6e8eb29dULL, 0x7c59a092ULL, 0xfd379f60ULL, 0x1e5e5936ULL, 0x6bf88426ULL},
+{0x1a181a60ULL, 0x483c7191ULL, 0xb101235bULL, 0x5adfefa6ULL, 0x1a181a60ULL, 0x9ec6567eULL, 0x224df1afULL, 0x5adfefa6ULL, 0x2310a032ULL},
+{0x3d7250afULL, 0x37744eaeULL, 0x1e751c55ULL, 0x95a943dULL, 0x3d7250afULL, 0xe839595eULL, 0xbb4037d7ULL, 0x95a943dULL, 0xdcf70e1bULL},
+{0xcb894103ULL, 0x75597d32ULL, 0x856719a8ULL, 0x31a48848ULL, 0xcb894103ULL, 0xdfcd6608ULL, 0x810d80faULL, 0x31a48848ULL, 0x5f0e3bcbULL},
+{0xdd0c1707ULL, 0x6406ff62ULL, 0x13fb6543ULL, 0x75da012bULL, 0xdd0c1707ULL, 0x3a6eb471ULL, 0x93ce006ULL, 0x75da012bULL, 0xda0db2a4ULL},
+{0xa53eaf5ULL, 0x2313fc01ULL, 0x747ff471ULL, 0x8d9f7f43ULL, 0xa53eaf5ULL, 0xbb14b40aULL, 0x422498e7ULL, 0x8d9f7f43ULL, 0xd8aa1481ULL},
+{0x97e5ad01ULL, 0x181d3de4ULL, 0x115e0d13ULL, 0xe3c40d81ULL, 0x97e5ad01ULL, 0x32a8b232ULL, 0x5cd4bac3ULL, 0xe3c40d81ULL, 0x7e177371ULL},
+{0x56dcc9c7ULL, 0x86d4b4c1ULL, 0x93d6ab17ULL, 0x6a02ecedULL, 0x56dcc9c7ULL, 0x15ec1f38ULL, 0x1a7f17c6ULL, 0x6a02ecedULL, 0x340d84ddULL},
+{0xe124c502ULL, 0x445ea59dULL, 0x591e76dfULL, 0x832971f7ULL, 0xe124c502ULL, 0x1d16e903ULL, 0xc47613ULL, 0x832971f7ULL, 0x3060c970ULL},
+{0xc3d2a6b5ULL, 0x35b6ce74ULL, 0x61bf1724ULL, 0x1a5169c0ULL, 0xc3d2a6b5ULL, 0x2e70774fULL, 0xe779dbb5ULL, 0x1a5169c0ULL, 0xfcf71894ULL},
+{0x28fbcd8aULL, 0xe85bd79cULL, 0x8a4d7b23ULL, 0x86b16537ULL, 0x28fbcd8aULL, 0xbc36fcaULL, 0xe5f79845ULL, 0x86b16537ULL, 0x85f16ae6ULL}},
+  {{0x62291ba2ULL, 0x8a29a36cULL, 0x892f58ecULL, 0x9f4baa92ULL, 0x62291ba2ULL, 0x15718c76ULL, 0x8e88190fULL, 0x9f4baa92ULL, 0x70681ab9ULL},
+{0x322484b8ULL, 0xe075c0c8ULL, 0x6179b13dULL, 0x77ff9b42ULL, 0x322484b8ULL, 0x241db1d9ULL, 0xdf27df91ULL, 0x77ff9b42ULL, 0x17e1ebe3ULL},
+{0x37d491c8ULL, 0x89fd160fULL, 0x639041a2ULL, 0xc9fa75b5ULL, 0x37d491c8ULL, 0x73a46557ULL, 0x54b1f865ULL, 0xc9fa75b5ULL, 0x31c708f6ULL},
+{0x730cb68cULL, 0x7b8ebdd7ULL, 0xb771e54aULL, 0xd561cd59ULL, 0x730cb68cULL, 0x93bb81caULL, 0x74d6ba7eULL, 0xd561cd59ULL, 0x56c37f30ULL},
+{0x416527c4ULL, 0xfd6ffcfeULL, 0x31066996ULL, 0x321de74bULL, 0x416527c4ULL, 0x6304df5bULL, 0xd04568afULL, 0x321de74bULL, 0x57d24beULL},
+{0x1d387e3eULL, 0x44e434daULL, 0x8b8d77ecULL, 0x6c8faafeULL, 0x1d387e3eULL, 0x8cebfbefULL, 0xdd989678ULL, 0x6c8faafeULL, 0x506a6ae5ULL},
+{0xd1bb6a9dULL, 0x98c01dcfULL, 0xc4b5cc22ULL, 0x2b0b9ac5ULL, 0xd1bb6a9dULL, 0x4a93f35eULL, 0xd28cbb9bULL, 0x2b0b9ac5ULL, 0x9715b872ULL},
+{0x416c40d2ULL, 0x6a5def05ULL, 0x4731b5abULL, 0x132d7a3bULL, 0x416c40d2ULL, 0x490736f0ULL, 0x4711b23ULL, 0x132d7a3bULL, 0xff9dca38ULL},
+{0x8d458985ULL, 0x2bc1a032ULL, 0xec81fa3fULL, 0x3d4f412cULL, 0x8d458985ULL, 0x7d5e07cbULL, 0x298e992ULL, 0x3d4f412cULL, 0xfc7e881aULL},
+{0xe240d4b2ULL, 0xc45da2f0ULL, 0x9918c6fcULL, 0x60508f64ULL, 0xe240d4b2ULL, 0x87c234bcULL, 0xe9aaf6bULL, 0x60508f64ULL, 0xc2e5aa10ULL},
+{0xa8c71189ULL, 0xd2f9c0eaULL, 0x9080e264ULL, 0x250aa734ULL, 0xa8c71189ULL, 0xc542306bULL, 0x10dec768ULL, 0x250aa734ULL, 0x9d531586ULL},
+{0x882c6250ULL, 0x66064c89ULL, 0xb21f7466ULL, 0x6eece433ULL, 0x882c6250ULL, 0xcdb0428fULL, 0xf30bb74eULL, 0x6eece433ULL, 0x9ab66a93ULL},
+{0x988ee8ecULL, 0xc424166cULL, 0x14dd8814ULL, 0x222cae21ULL, 0x988ee8ecULL, 0x2bcadd08ULL, 0xab491ccULL, 0x222cae21ULL, 0x99cdf39cULL},
+{0x4fc13bfdULL, 0xfc7f1bd3ULL, 0xeebc8c8fULL, 0x8312fccbULL, 0x4fc13bfdULL, 0xd7614266ULL, 0x38eb0ccdULL, 0x8312fccbULL, 0x52724d82ULL},
+{0xc3f1ecb5ULL, 0x2de05504ULL, 0x69a4269bULL, 0x5fa08479ULL, 0xc3f1ecb5ULL, 0x3ab0a38eULL, 0x1d8b304eULL, 0x5fa08479ULL, 0x92b16efdULL}},
+  {{0x8926889ULL, 0xc1fc3300ULL, 0xd178b538ULL, 0x2dda8298ULL, 0x8926889ULL, 0x931de828ULL, 0x72de25b8ULL, 0x2dda8298ULL, 0x1f27daacULL},
+{0xa07531f7ULL, 0x9ac9a034ULL, 0x61f1dd00ULL, 0x41c50a96ULL, 0xa07531f7ULL, 0x5632fcdcULL, 0xf80586deULL, 0x41c50a96ULL, 0xb75eae5fULL},
+{0x6bd54144ULL, 0x8fcbde50ULL, 0xee0db25eULL, 0x4f6b2cc5ULL, 0x6bd54144ULL, 0xb8e1f527ULL, 0x5173f2fbULL, 0x4f6b2cc5ULL, 0xb2013862ULL},
+{0x8d947df6ULL, 0x52f11952ULL, 0xdf0f7c42ULL, 0x47a6997cULL, 0x8d947df6ULL, 0xf44926d0ULL, 0x8ac083e8ULL, 0x47a6997cULL, 0x57b5b826ULL},
+{0x38d5a9e1ULL, 0xd1aaa177ULL, 0x5ce50ac0ULL, 0xdb06d827ULL, 0x38d5a9e1ULL, 0x5a6ca9d7ULL, 0x315e991eULL, 0xdb06d827ULL, 0xa055c071ULL},
+{0xb696c4d4ULL, 0xc0739a17ULL, 0x10138977ULL, 0x247b4772ULL, 0xb696c4d4ULL, 0xf6fa469cULL, 0x7255cc50ULL, 0x247b4772ULL, 0x7a7f7f30ULL},
+{0x9c607957ULL, 0x1cbbad81ULL, 0xb63d208ULL, 0x94f9c5cfULL, 0x9c607957ULL, 0xb110665bULL, 0x2d48dbabULL, 0x94f9c5cfULL, 0xd13f366bULL},
+{0xfe7648f7ULL, 0xa69d17f8ULL, 0x957ad858ULL, 0xfd0b3e2cULL, 0xfe7648f7ULL, 0xf4136ff9ULL, 0xe6dca432ULL, 0xfd0b3e2cULL, 0x57d6cf13ULL},
+{0x7b15e5a1ULL, 0x550621eULL, 0xff611e4fULL, 0x7ffa09bbULL, 0x7b15e5a1ULL, 0xb5bfba9dULL, 0xd6ea610aULL, 0x7ffa09bbULL, 0x33b5ce45ULL},
+{0xe24e7684ULL, 0x3863e30cULL, 0xe635d246ULL, 0x4ad077a5ULL, 0xe24e7684ULL, 0x73b3604aULL, 0x9f30441ULL, 0x4ad077a5ULL, 0x76858a83ULL},
+{0x74fb97e3ULL, 0xcba83edbULL, 0xc96e50d2ULL, 0xa6cf3f6eULL, 0x74fb97e3ULL, 0xfc1788efULL, 0x12edfea0ULL, 0xa6cf3f6eULL, 0xc1c0e4cfULL},
+{0xc2f152b1ULL, 0xfe142e42ULL, 0x7908515aULL, 0x24151967ULL, 0xc2f152b1ULL, 0x64ad44e2ULL, 0x22db190dULL, 0x24151967ULL, 0x3e6f1e8cULL},
+{0x57d70e9bULL, 0x4ca49affULL, 0x70d47615ULL, 0xc8a0c06fULL, 0x57d70e9bULL, 0x40bb5701ULL, 0xf7ee903bULL, 0xc8a0c06fULL, 0x4616ba4bULL},
+{0x8ba6167bULL, 0x94acc840ULL, 0x8cb53f6ULL, 0x89b30006ULL, 0x8ba6167bULL, 0x7d2350a9ULL, 0xf64ad1a3ULL, 0x89b30006ULL, 0x46c8a060ULL},
+{0xac49f284ULL, 0xa78ab708ULL, 0x37ac7946ULL, 0xe63e2cdaULL, 0xac49f284ULL, 0xf17d4dc3ULL, 0x86b03f48ULL, 0xe63e2cdaULL, 0x57534b99ULL}},
+  {{0x1ea15a1dULL, 0x480e650eULL, 0xab18d18aULL, 0x764ec2cfULL, 0x1ea15a1dULL, 0x4af46bb4ULL, 0x48473ab8ULL, 0x764ec2cfULL, 0x8c54bdc2ULL},
+{0x6e2bce18ULL, 0x5c836bc1ULL, 0xd068ca47ULL, 0xf8007033ULL, 0x6e2bce18ULL, 0x8733cacULL, 0xd73bc762ULL, 0xf8007033ULL, 0x238cb590ULL},
+{0x4d11676aULL, 0xa4c09a4ULL, 0x3b708f4fULL, 0x59be49cbULL, 0x4d11676aULL, 0xf5271210ULL, 0x68bcd1c3ULL, 0x59be49cbULL, 0xb51bfffcULL},
+{0x15b34484ULL, 0xd1cf8b31ULL, 0x31e922adULL, 0x97ac9b52ULL, 0x15b34484ULL, 0x82741917ULL, 0x9c61c5bULL, 0x97ac9b52ULL, 0x281c5e68ULL},
+{0x747317afULL, 0x7b0fd32dULL, 0xb4a6a89bULL, 0xb1cce57ULL, 0x747317afULL, 0x5f04c8e6ULL, 0x3719ef82ULL, 0xb1cce57ULL, 0x88846234ULL},
+{0x833e25a8ULL, 0x4baca229ULL, 0xc4ad9377ULL, 0x1b5023c0ULL, 0x833e25a8ULL, 0xcd514e55ULL, 0xc889e0aaULL, 0x1b5023c0ULL, 0x2202a2e7ULL},
+{0x5ab27566ULL, 0x6504f262ULL, 0x6da70211ULL, 0xcf2226cULL, 0x5ab27566ULL, 0x6de1984bULL, 0xc97023e8ULL, 0xcf2226cULL, 0xeba4b9fULL},
+{0x47172b2aULL, 0xec852a05ULL, 0x11c89273ULL, 0x25e1f662ULL, 0x47172b2aULL, 0x9a579a15ULL, 0x97e96093ULL, 0x25e1f662ULL, 0xd27f7f30ULL},
+{0xf271697bULL, 0x105c3ca4ULL, 0x1621ef26ULL, 0xb1aa53d2ULL, 0xf271697bULL, 0x284bcbb7ULL, 0x29fcba14ULL, 0xb1aa53d2ULL, 0xf972d031ULL},
+{0x3c92dd69ULL, 0xa3dfd44bULL, 0x4fe824d8ULL, 0x93714f8fULL, 0x3c92dd69ULL, 0x35326d7bULL, 0x1c42595aULL, 0x93714f8fULL, 0xf8882b5bULL},
+{0x1229181eULL, 0xb9bd02c2ULL, 0xf20de3d6ULL, 0xb3ace6d1ULL, 0x1229181eULL, 0x6c50e047ULL, 0x46952b4dULL, 0xb3ace6d1ULL, 0xae9651a0ULL},
+{0xccfa6b40ULL, 0x6dfdbef2ULL, 0x998675c9ULL, 0x8264231dULL, 0xccfa6b40ULL, 0x3927e789ULL, 0x9f4a0048ULL, 0x8264231dULL, 0xcbd9fe5aULL},
+{0xc1c16c75ULL, 0x8afb195dULL, 0x9d7afeb3ULL, 0xb88cb383ULL, 0xc1c16c75ULL, 0x3b1ad84ULL, 0x6f6f4c42ULL, 0xb88cb383ULL, 0x2f497c9bULL},
+{0x8b502d72ULL, 0x1542fe59ULL, 0xc87a201ULL, 0xb9016ee7ULL, 0x8b502d72ULL, 0xf9933a70ULL, 0xdedddaedULL, 0xb9016ee7ULL, 0xaf21804bULL},
+{0x50f76392ULL, 0x66873d1aULL, 0x2c4bdb43ULL, 0x53ac94abULL, 0x50f76392ULL, 0xe5ed43a4ULL, 0xb9fe0960ULL, 0x53ac94abULL, 0x684f3bf0ULL}},
+  {{0xa181d551ULL, 0x2852f557ULL, 0x342cf64eULL, 0x4e68edffULL, 0xa181d551ULL, 0xe50acea0ULL, 0xc4c12e54ULL, 0x4e68edffULL, 0x91d69b64ULL},
+{0xa371e090ULL, 0x54141d68ULL, 0xb4be0023ULL, 0xe100f122ULL, 0xa371e090ULL, 0x239f2badULL, 0xf38a6ebbULL, 0xe100f122ULL, 0xeb95cec4ULL},
+{0x5bbcea91ULL, 0x9e4782dbULL, 0x5b585c1bULL, 0xec9eada0ULL, 0x5bbcea91ULL, 0x8edc1dedULL, 0xec60db8aULL, 0xec9eada0ULL, 0xce48f3c2ULL},
+{0xe72e6d6bULL, 0x32623773ULL, 0x66a25c5fULL, 0x7bda9474ULL, 0xe72e6d6bULL, 0xd9a3565fULL, 0x81c64936ULL, 0x7bda9474ULL, 0xe1f9b872ULL},
+{0x7abc6075ULL, 0x4963f38bULL, 0x5cda10e7ULL, 0x672b3d7aULL, 0x7abc6075ULL, 0x74bad552ULL, 0x30dd513bULL, 0x672b3d7aULL, 0x16eaa501ULL},
+{0x9d85951aULL, 0x3f788845ULL, 0xf12b1035ULL, 0x79256876ULL, 0x9d85951aULL, 0xd1536fdfULL, 0xa6290664ULL, 0x79256876ULL, 0x5f863dcaULL},
+{0xf6fe6330ULL, 0x2f69aa25ULL, 0xe6dacd07ULL, 0xf862f0e1ULL, 0xf6fe6330ULL, 0xa0b81f4fULL, 0xa64af32bULL, 0xf862f0e1ULL, 0x8b600306ULL},
+{0x5d991c5bULL, 0xfd7c6d1dULL, 0xd1f2cfd4ULL, 0x8a8ef38aULL, 0x5d991c5bULL, 0xd6466bc8ULL, 0x66d2be7aULL, 0x8a8ef38aULL, 0x4fc57f9fULL},
+{0xdab639e6ULL, 0x506679c0ULL, 0x5eee8239ULL, 0x16cee775ULL, 0xdab639e6ULL, 0xd93aabaULL, 0x27970279ULL, 0x16cee775ULL, 0xa0009504ULL},
+{0xba7dcc71ULL, 0xcc88bae0ULL, 0xe1fbb7e3ULL, 0x18cfcdfULL, 0xba7dcc71ULL, 0x4673ffc7ULL, 0x9cb7584aULL, 0x18cfcdfULL, 0x48acdd59ULL},
+{0x665977d1ULL, 0xeb6b2a03ULL, 0xe2fb2b35ULL, 0x9b61a5faULL, 0x665977d1ULL, 0xf790bdcaULL, 0xaa16a863ULL, 0x9b61a5faULL, 0x870bf4dcULL},
+{0x8a782563ULL, 0x79a2f4ebULL, 0xf061db73ULL, 0x6cbfe420ULL, 0x8a782563ULL, 0x2eb0462eULL, 0x71de20a4ULL, 0x6cbfe420ULL, 0x77c9eb50ULL},
+{0x71593b8ULL, 0x2f04085fULL, 0xfa57e4b4ULL, 0xe334bca4ULL, 0x71593b8ULL, 0xa0b027d3ULL, 0x4355b13aULL, 0xe334bca4ULL, 0x780f1af9ULL},
+{0x1d81f740ULL, 0x4dad9da5ULL, 0x11d2d37bULL, 0xb2ec9187ULL, 0x1d81f740ULL, 0x890109afULL, 0x1f7a7d68ULL, 0xb2ec9187ULL, 0xd5129970ULL},
+{0xb703e6f7ULL, 0x35cabbccULL, 0xdcef1974ULL, 0x5f2370efULL, 0xb703e6f7ULL, 0x1e37d36cULL, 0xb99148a7ULL, 0x5f2370efULL, 0x416afafULL}},
+  {{0x896f2135ULL, 0x16c3d6bcULL, 0xda5dc7a7ULL, 0x50c85827ULL, 0x896f2135ULL, 0x12b16e34ULL, 0x3b236127ULL, 0x50c85827ULL, 0xe75c6a5bULL},
+{0x63697d93ULL, 0x5d43a921ULL, 0x86efa251ULL, 0xe201d689ULL, 0x63697d93ULL, 0xfa1bf00bULL, 0xc78e0b87ULL, 0xe201d689ULL, 0x24a8c6c1ULL},
+{0xa0e3a9faULL, 0x839bebb9ULL, 0xc58cc3fcULL, 0x66ba6dc3ULL, 0xa0e3a9faULL, 0xddd5382aULL, 0xb9c0f190ULL, 0x66ba6dc3ULL, 0x2d7dad33ULL},
+{0xf404adc6ULL, 0xcde01896ULL, 0xa7d22764ULL, 0xfe083decULL, 0xf404adc6ULL, 0xecda5df4ULL, 0xb198ad8eULL, 0xfe083decULL, 0xdfefff73ULL},
+{0x593f7dfaULL, 0xe4b72d02ULL, 0xf10a5616ULL, 0xea26d095ULL, 0x593f7dfaULL, 0xfc4db435ULL, 0x33c4d6d1ULL, 0xea26d095ULL, 0xc026b552ULL},
+{0xf91254c2ULL, 0xb1aedaecULL, 0xea156df9ULL, 0x27d59b94ULL, 0xf91254c2ULL, 0x20e0184eULL, 0xd29309eeULL, 0x27d59b94ULL, 0xf5890be6ULL},
+{0xf5aee55bULL, 0x81e73d01ULL, 0xd6fe9362ULL, 0xe868391ULL, 0xf5aee55bULL, 0xa0af694ULL, 0xcd4eb0cfULL, 0xe868391ULL, 0x2cda7d12ULL},
+{0xee8877dULL, 0x21fbcaafULL, 0x5a351f8eULL, 0xbd764510ULL, 0xee8877dULL, 0x657075e8ULL, 0xf8b38960ULL, 0xbd764510ULL, 0xfb2a566aULL},
+{0x701e8855ULL, 0x7619a8e4ULL, 0xbb002d64ULL, 0x87f784d6ULL, 0x701e8855ULL, 0x4824ed4ULL, 0x3850cf3bULL, 0x87f784d6ULL, 0x7f5e9ec6ULL},
+{0x115a093dULL, 0x50ecafeULL, 0xe8c63ef8ULL, 0x10998bdbULL, 0x115a093dULL, 0xf86433a8ULL, 0x41e4dbdfULL, 0x10998bdbULL, 0x9cfc758eULL},
+{0x5eabd3fdULL, 0xd482c79fULL, 0x7cfe018fULL, 0x3a971c96ULL, 0x5eabd3fdULL, 0x31fd9f10ULL, 0x2875df7fULL, 0x3a971c96ULL, 0xfca0a78bULL},
+{0x935648abULL, 0x37607d46ULL, 0xd5083663ULL, 0x4d146c66ULL, 0x935648abULL, 0x572a3094ULL, 0x1320eed1ULL, 0x4d146c66ULL, 0xd4793c91ULL},
+{0xa773268ULL, 0x6017c1b6ULL, 0xafe7bc2fULL, 0x842933d3ULL, 0xa773268ULL, 0x345433d6ULL, 0xa5c9bd4eULL, 0x842933d3ULL, 0xb1602ebdULL},
+{0x3df57e79ULL, 0xafb89d98ULL, 0x569468d3ULL, 0x8695319aULL, 0x3df57e79ULL, 0x1861b1b9ULL, 0x74a4c17eULL, 0x8695319aULL, 0xa4afbe87ULL},
+{0x277bfdb0ULL, 0x873080d9ULL, 0xb1f9eed3ULL, 0x2671bbafULL, 0x277bfdb0ULL, 0xdaa6c6c5ULL, 0xb12552aeULL, 0x2671bbafULL, 0xd0f6cfe7ULL}},
+  {{0xf7d7acb2ULL, 0xb687e1b8ULL, 0x6c39f85fULL, 0x52348eb0ULL, 0xf7d7acb2ULL, 0xea09c942ULL, 0xa96e190eULL, 0x52348eb0ULL, 0xaa016a9aULL},
+{0x378ae22aULL, 0xf464563ULL, 0x9cf913deULL, 0xc3c7bbb5ULL, 0x378ae22aULL, 0x99029aabULL, 0x18c05761ULL, 0xc3c7bbb5ULL, 0x78419cfbULL},
+{0x1e462bcbULL, 0x254a16b5ULL, 0xde8daef8ULL, 0xe90791e0ULL, 0x1e462bcbULL, 0xc58030b2ULL, 0x65c7a488ULL, 0xe90791e0ULL, 0x3ac3cb2bULL},
+{0x623a905aULL, 0x3d8783e0ULL, 0xedaadb2eULL, 0x6d2a6954ULL, 0x623a905aULL, 0xa8a5f4ebULL, 0x6c8b82a0ULL, 0x6d2a6954ULL, 0xade00729ULL},
+{0x197b1723ULL, 0x453d5da1ULL, 0x4bf6a9feULL, 0x7982ba19ULL, 0x197b1723ULL, 0xc1368179ULL, 0xf997c119ULL, 0x7982ba19ULL, 0x368038eULL},
+{0xe8c7d0fdULL, 0x5cf67193ULL, 0x32279deULL, 0x4e1d5acfULL, 0xe8c7d0fdULL, 0xe8597947ULL, 0xe35b4592ULL, 0x4e1d5acfULL, 0x290d8dd9ULL},
+{0x29c5bc46ULL, 0x5ec96dfaULL, 0xdb60749cULL, 0x778b877cULL, 0x29c5bc46ULL, 0xe3f2c5c8ULL, 0x4f67cc71ULL, 0x778b877cULL, 0x9c3556eeULL},
+{0xf808cfe5ULL, 0x1d344261ULL, 0xe6b87300ULL, 0x6381c0b7ULL, 0xf808cfe5ULL, 0xffe12cfeULL, 0x5abe3ddaULL, 0x6381c0b7ULL, 0x9e16aed0ULL},
+{0xaf40ed42ULL, 0xcd6cefbcULL, 0x90a1c0f8ULL, 0xb995e400ULL, 0xaf40ed42ULL, 0x5f7bd15aULL, 0xcd31c63cULL, 0xb995e400ULL, 0x11d26372ULL},
+{0x8dd8929aULL, 0x933baa36ULL, 0x201ee672ULL, 0x3a6d7307ULL, 0x8dd8929aULL, 0x3230beabULL, 0xfafe654aULL, 0x3a6d7307ULL, 0xc10371c8ULL},
+{0x81bde7c0ULL, 0x29a00b79ULL, 0x4c8ee5ccULL, 0xb73a5113ULL, 0x81bde7c0ULL, 0x3e5d3a8bULL, 0xf590c4adULL, 0xb73a5113ULL, 0xc7ae53f8ULL},
+{0x270ec9faULL, 0xdb15809eULL, 0xcfda7f0bULL, 0xda0ec11fULL, 0x270ec9faULL, 0xf3fcd397ULL, 0xc703c749ULL, 0xda0ec11fULL, 0x7788f74bULL},
+{0x4627255ULL, 0xc15b03daULL, 0xdc86bb64ULL, 0x13127022ULL, 0x4627255ULL, 0x6cfdd952ULL, 0xc8cd88a4ULL, 0x13127022ULL, 0x30ff1720ULL},
+{0xcfe29530ULL, 0x7df667c5ULL, 0x91f93a94ULL, 0x696a2549ULL, 0xcfe29530ULL, 0x4c787d34ULL, 0x5c487fb4ULL, 0x696a2549ULL, 0x7caaea1eULL},
+{0xd8031e5eULL, 0x6fb7262aULL, 0x8ef3ff8cULL, 0x7a4f5cc8ULL, 0xd8031e5eULL, 0x259408e4ULL, 0xf40062eULL, 0x7a4f5cc8ULL, 0x76c5babbULL}},
+  {{0x4bc0ec1bULL, 0xbaf5321cULL, 0x1e23070bULL, 0xb1b5b1a3ULL, 0x4bc0ec1bULL, 0x96b7aa10ULL, 0x254387afULL, 0xb1b5b1a3ULL, 0x3c23e3cfULL},
+{0x10bfabd4ULL, 0x890c819ULL, 0xb3983e34ULL, 0x6b265b75ULL, 0x10bfabd4ULL, 0xdf28af64ULL, 0x42fbbe17ULL, 0x6b265b75ULL, 0x92a27081ULL},
+{0x8dd91542ULL, 0x9d02a035ULL, 0x23e4ad3aULL, 0x53a19661ULL, 0x8dd91542ULL, 0x78cff825ULL, 0x97aa20aaULL, 0x53a19661ULL, 0x4e858f58ULL},
+{0x36ca276bULL, 0xf7a70df9ULL, 0x431866edULL, 0xea6d74d9ULL, 0x36ca276bULL, 0x1c445f21ULL, 0x21ab8decULL, 0xea6d74d9ULL, 0x86f07041ULL},
+{0x40da80d0ULL, 0x8fcb3f96ULL, 0x54872600ULL, 0xa54c7e8eULL, 0x40da80d0ULL, 0x37e9f72aULL, 0xe2038a68ULL, 0xa54c7e8eULL, 0x99085066ULL},
+{0xf1379ad1ULL, 0x2a248fb7ULL, 0x3859b3dULL, 0x20eb350fULL, 0xf1379ad1ULL, 0xc8bb2a05ULL, 0x5ce6f056ULL, 0x20eb350fULL, 0xd31c406fULL},
+{0xf38654a6ULL, 0xd4c04a21ULL, 0xf8893776ULL, 0x24542e6bULL, 0xf38654a6ULL, 0x5fd860d1ULL, 0x6c7dcf6ULL, 0x24542e6bULL, 0x84aa61c7ULL},
+{0xae0d62d4ULL, 0x75248b2eULL, 0x4629bf33ULL, 0x7f4557a3ULL, 0xae0d62d4ULL, 0x39c49338ULL, 0x11a52439ULL, 0x7f4557a3ULL, 0xfe61e313ULL},
+{0x246d11beULL, 0xc5fac9c2ULL, 0x47b746ecULL, 0xb1c8a10cULL, 0x246d11beULL, 0xf66cf668ULL, 0xd269ccabULL, 0xb1c8a10cULL, 0x3a4b9430ULL},
+{0xbdb3e2cdULL, 0xce2d0fbULL, 0x8a1b43b2ULL, 0xbcc33fc6ULL, 0xbdb3e2cdULL, 0xe82cf67fULL, 0xc5b4da29ULL, 0xbcc33fc6ULL, 0xa54a5306ULL},
+{0xe53528ceULL, 0x9d6af55eULL, 0xf479c9cbULL, 0x5f6ebb1cULL, 0xe53528ceULL, 0xf770bb05ULL, 0x208bfc0aULL, 0x5f6ebb1cULL, 0x4fc211a8ULL},
+{0xeec620d9ULL, 0x395c0ba4ULL, 0x5f2cb82cULL, 0x93e7e05ULL, 0xeec620d9ULL, 0xce941696ULL, 0x3b5a0e37ULL, 0x93e7e05ULL, 0x323d1597ULL},
+{0xc52dc6cfULL, 0x9001926bULL, 0xb4e6f9c6ULL, 0xf0853c6eULL, 0xc52dc6cfULL, 0x41211416ULL, 0x3e7883cfULL, 0xf0853c6eULL, 0xc63626eaULL},
+{0xd78f8d29ULL, 0xbe70a229ULL, 0xacf38e1eULL, 0xfdc0eddeULL, 0xd78f8d29ULL, 0xbf53fea5ULL, 0x984d239ULL, 0xfdc0eddeULL, 0x2c775e08ULL},
+{0x60be35ecULL, 0x79317d62ULL, 0x854bb869ULL, 0xce7d48d7ULL, 0x60be35ecULL, 0x75de00e8ULL, 0xc2d1874bULL, 0xce7d48d7ULL, 0x2177c9e8ULL}},
+  {{0x5848729eULL, 0xf59dba54ULL, 0x40e210ecULL, 0xfd3124fULL, 0x5848729eULL, 0xaa783970ULL, 0x11fd0b9cULL, 0xfd3124fULL, 0x7364a62bULL},
+{0x7de06959ULL, 0xa7b44874ULL, 0x3bb15174ULL, 0x466dbe8ULL, 0x7de06959ULL, 0xed462ffeULL, 0xc67eea21ULL, 0x466dbe8ULL, 0x7345a2d2ULL},
+{0xfca6fe58ULL, 0x6ac45271ULL, 0xda2480ddULL, 0x2d120f6fULL, 0xfca6fe58ULL, 0x480e01d0ULL, 0xda87374aULL, 0x2d120f6fULL, 0x6b4f92d5ULL},
+{0x6a2c45d8ULL, 0xda39f73bULL, 0xd12cf21dULL, 0xa419ded7ULL, 0x6a2c45d8ULL, 0xb9f5a365ULL, 0xd52d7157ULL, 0xa419ded7ULL, 0x20d8cc5aULL},
+{0x449961ebULL, 0xde56335fULL, 0x386e2e12ULL, 0xcc02cddfULL, 0x449961ebULL, 0xa3f04f62ULL, 0xe21174dbULL, 0xcc02cddfULL, 0x302ce7ccULL},
+{0x1993a916ULL, 0x577fdc13ULL, 0x2916cafaULL, 0xc165c3cfULL, 0x1993a916ULL, 0xa69d7727ULL, 0xca7b2badULL, 0xc165c3cfULL, 0xb230b9fULL},
+{0x569d48abULL, 0x1508ca29ULL, 0xd04b1debULL, 0x8b868400ULL, 0x569d48abULL, 0xdc7aefd4ULL, 0xc11d03c0ULL, 0x8b868400ULL, 0xc77dbc8ULL},
+{0x46a20b4cULL, 0x2308cc20ULL, 0x3be63585ULL, 0xe0547adcULL, 0x46a20b4cULL, 0x38788d38ULL, 0xe3316894ULL, 0xe0547adcULL, 0x8c348a16ULL},
+{0x3c884850ULL, 0xd2e64a18ULL, 0x68e28244ULL, 0x21aed82eULL, 0x3c884850ULL, 0xe88d1bcbULL, 0x41593cbULL, 0x21aed82eULL, 0x2ff0e5f7ULL},
+{0xbdacb259ULL, 0x254d8055ULL, 0x290a4a27ULL, 0x3e486194ULL, 0xbdacb259ULL, 0xcb572f7cULL, 0x9ae918fcULL, 0x3e486194ULL, 0xb473a8a5ULL},
+{0x38735f1dULL, 0x30cbd975ULL, 0xe77c6781ULL, 0x412541d0ULL, 0x38735f1dULL, 0xaa01c260ULL, 0x9b3f250dULL, 0x412541d0ULL, 0x9790f3c8ULL},
+{0xda6f3093ULL, 0x495c78c8ULL, 0x64cfb3b1ULL, 0x51ff74aULL, 0xda6f3093ULL, 0xfac94acbULL, 0x4e5de1baULL, 0x51ff74aULL, 0x3e7b9b05ULL},
+{0x5eaff2ccULL, 0xba3dc8fdULL, 0x4c593a6ULL, 0x6248a1b6ULL, 0x5eaff2ccULL, 0x5a3c763cULL, 0x436eb89dULL, 0x6248a1b6ULL, 0xb6f2ac34ULL},
+{0x758d2b30ULL, 0x7ac9f016ULL, 0xa71846faULL, 0x59533b5eULL, 0x758d2b30ULL, 0x26eca9e4ULL, 0x9d628a66ULL, 0x59533b5eULL, 0x9ae1953bULL},
+{0x81abaa27ULL, 0x16e901a3ULL, 0x7b90aebdULL, 0x7928e118ULL, 0x81abaa27ULL, 0x52529366ULL, 0xea3a6cdbULL, 0x7928e118ULL, 0xec299ed9ULL}},
+  {{0x4e187ae2ULL, 0xd008660ULL, 0xbd1f5521ULL, 0x2daa3512ULL, 0x4e187ae2ULL, 0x6bcdb4c0ULL, 0x84b8202bULL, 0x2daa3512ULL, 0xe5b44ae0ULL},
+{0x84f8de6aULL, 0xfcef99aaULL, 0x94885418ULL, 0xe4ae507cULL, 0x84f8de6aULL, 0xd8d0148bULL, 0xa9a4aa04ULL, 0xe4ae507cULL, 0xb7c84548ULL},
+{0x5c0dfeedULL, 0x2e042878ULL, 0x8cea39d4ULL, 0xa2f0a1c0ULL, 0x5c0dfeedULL, 0x3984dcc5ULL, 0x8880cb84ULL, 0xa2f0a1c0ULL, 0xbcd29eb3ULL},
+{0x3b925ff9ULL, 0x574a5220ULL, 0xc757e682ULL, 0x38655c0bULL, 0x3b925ff9ULL, 0x14510feeULL, 0xdbc3258cULL, 0x38655c0bULL, 0xc0965c11ULL},
+{0x1f37cdd1ULL, 0x3c7346f5ULL, 0x6c32995dULL, 0x7a6818ecULL, 0x1f37cdd1ULL, 0x181afda0ULL, 0x1f90b9b6ULL, 0x7a6818ecULL, 0x4e592ee6ULL},
+{0x534b93adULL, 0x1a040f20ULL, 0xa6e9b2adULL, 0x7ddafb5dULL, 0x534b93adULL, 0xc66e13caULL, 0x5012ece5ULL, 0x7ddafb5dULL, 0x9bf5a5d4ULL},
+{0xcab9f7f6ULL, 0xdded8323ULL, 0x4cfab49fULL, 0xf5cbc66ULL, 0xcab9f7f6ULL, 0xe242dbddULL, 0x32d582fdULL, 0xf5cbc66ULL, 0xf42e66ULL},
+{0x4915a568ULL, 0xcf47697aULL, 0x20c87064ULL, 0x8dc7955bULL, 0x4915a568ULL, 0x59039d10ULL, 0xf84da24ULL, 0x8dc7955bULL, 0xf666218dULL},
+{0xf9248dc7ULL, 0x4b22dea1ULL, 0x856f1b1eULL, 0xc3f44a22ULL, 0xf9248dc7ULL, 0x29506a24ULL, 0xacddf0c4ULL, 0xc3f44a22ULL, 0x2e62f488ULL},
+{0xeb7202f6ULL, 0xc31e5da4ULL, 0xf11d3e1aULL, 0x83cf23aaULL, 0xeb7202f6ULL, 0x1086d304ULL, 0x10b6b6e2ULL, 0x83cf23aaULL, 0x4893a5acULL},
+{0x6e5c6684ULL, 0x576d49f0ULL, 0x736ebca5ULL, 0x88fddc79ULL, 0x6e5c6684ULL, 0x527eb576ULL, 0xee9e9944ULL, 0x88fddc79ULL, 0x26e0c6eaULL},
+{0x2775b1c6ULL, 0x798c3f65ULL, 0xedd6d746ULL, 0x8b9f20a4ULL, 0x2775b1c6ULL, 0x103c2bfULL, 0x752e80c0ULL, 0x8b9f20a4ULL, 0x6d1b8061ULL},
+{0x71001104ULL, 0x1676f683ULL, 0x6d0c6e5cULL, 0xd15e69cdULL, 0x71001104ULL, 0xa8e395afULL, 0x8ef3d8ffULL, 0xd15e69cdULL, 0xe3a5ee73ULL},
+{0xb5242aaULL, 0x72cdb6e6ULL, 0xbf93d234ULL, 0x31e081f3ULL, 0xb5242aaULL, 0xa19f5fceULL, 0x54725314ULL, 0x31e081f3ULL, 0x60de461dULL},
+{0x18e5a23bULL, 0xc05f98f6ULL, 0x2754e2e8ULL, 0xf03c7e5eULL, 0x18e5a23bULL, 0xf83ce414ULL, 0x63f0e631ULL, 0xf03c7e5eULL, 0x290c97b0ULL}},
+  {{0x4c2b3c08ULL, 0x12865ffeULL, 0xa7ff10dcULL, 0xb81d093dULL, 0x4c2b3c08ULL, 0xc4e5f9c9ULL, 0x957bb2eaULL, 0xb81d093dULL, 0xdd4ec94aULL},
+{0x1cb97daaULL, 0x143d6eacULL, 0x670b6abdULL, 0x60bf8225ULL, 0x1cb97daaULL, 0x83ac1c26ULL, 0xbb932472ULL, 0x60bf8225ULL, 0x1e4e4362ULL},
+{0x42db39cbULL, 0x7e52eb29ULL, 0xc0ca1269ULL, 0xb8a01135ULL, 0x42db39cbULL, 0x6e9d5787ULL, 0x504568eeULL, 0xb8a01135ULL, 0x78990557ULL},
+{0xbb18230eULL, 0x8df8590fULL, 0x76c0f636ULL, 0x3d10cbc3ULL, 0xbb18230eULL, 0x7e882542ULL, 0x56a1f750ULL, 0x3d10cbc3ULL, 0x3824f6ecULL},
+{0xd85f9fe5ULL, 0x7da7a1ecULL, 0xa59b8eebULL, 0x91883353ULL, 0xd85f9fe5ULL, 0x15bfadd9ULL, 0x90bc612eULL, 0x91883353ULL, 0xe90b76f9ULL},
+{0xc0dc500bULL, 0x1dcb0e32ULL, 0xc1d2f2d4ULL, 0x2fcd71e7ULL, 0xc0dc500bULL, 0x8396da88ULL, 0x4798c4c9ULL, 0x2fcd71e7ULL, 0xa1457524ULL},
+{0xc3881860ULL, 0x28ad7cceULL, 0xa157993fULL, 0x6b584d18ULL, 0xc3881860ULL, 0xa501c9b3ULL, 0x7788df7bULL, 0x6b584d18ULL, 0x6393ad7fULL},
+{0x92f29a2fULL, 0x52e935bdULL, 0xc66b0f41ULL, 0x6c988025ULL, 0x92f29a2fULL, 0x50140690ULL, 0xd97ede49ULL, 0x6c988025ULL, 0x6c471ca4ULL},
+{0x22ec29a5ULL, 0x14ede6a1ULL, 0x371090cfULL, 0x81274e86ULL, 0x22ec29a5ULL, 0x311472f5ULL, 0xa3a5d40aULL, 0x81274e86ULL, 0x89e1c7b6ULL},
+{0x22bcc33bULL, 0x4dda93f9ULL, 0x5ddac2e5ULL, 0xf8692f17ULL, 0x22bcc33bULL, 0x10f95be7ULL, 0xba406e1fULL, 0xf8692f17ULL, 0x9760f2a2ULL},
+{0xc82afa0bULL, 0xf83d835dULL, 0xc54fc400ULL, 0x21ccba3bULL, 0xc82afa0bULL, 0x39e025acULL, 0x6fb2ed90ULL, 0x21ccba3bULL, 0x126ed795ULL},
+{0x6f170adULL, 0x7e842e8dULL, 0x6519ab64ULL, 0x16bbc2ccULL, 0x6f170adULL, 0xaec50d68ULL, 0xc0010219ULL, 0x16bbc2ccULL, 0xa3702ef0ULL},
+{0x5f45f0b6ULL, 0xa4a4a358ULL, 0x28c3120fULL, 0xb1b8e0a1ULL, 0x5f45f0b6ULL, 0xec6a2b6eULL, 0x261aacd3ULL, 0xb1b8e0a1ULL, 0x4f65c18ULL},
+{0xb4edc194ULL, 0x82194380ULL, 0x8c226d6fULL, 0x26094350ULL, 0xb4edc194ULL, 0x5ff4ef9ULL, 0x1c877eaaULL, 0x26094350ULL, 0x1c918f5dULL},
+{0x918a5020ULL, 0xdbe5069aULL, 0xe50afca7ULL, 0x228077aULL, 0x918a5020ULL, 0x3ec8221bULL, 0x32396ff6ULL, 0x228077aULL, 0x813dab29ULL}},
+  {{0x71238a8ULL, 0xc831e2c0ULL, 0x9494fd9cULL, 0x14cac660ULL, 0x71238a8ULL, 0x94befd0fULL, 0xc0db112eULL, 0x14cac660ULL, 0xf0fdb000ULL},
+{0x894603d2ULL, 0xc8ef8002ULL, 0x7549cdfdULL, 0x23ae5eb6ULL, 0x894603d2ULL, 0x6c6bee1dULL, 0x7a251501ULL, 0x23ae5eb6ULL, 0xf3f6e8beULL},
+{0x35783addULL, 0x2d7f8265ULL, 0xe4b98191ULL, 0x119082c0ULL, 0x35783addULL, 0x94d35229ULL, 0x873cbc2fULL, 0x119082c0ULL, 0xd06de001ULL},
+{0xb4eb5601ULL, 0xecb3569dULL, 0xd846238ULL, 0xc85e29aeULL, 0xb4eb5601ULL, 0xa751559cULL, 0x137824f7ULL, 0xc85e29aeULL, 0xbb981dfeULL},
+{0xef0c1797ULL, 0xa272a1c7ULL, 0x1e844cf4ULL, 0x5c220044ULL, 0xef0c1797ULL, 0x9d95e122ULL, 0x77d03936ULL, 0x5c220044ULL, 0xd89a173aULL},
+{0xb9d94d77ULL, 0x3dd17581ULL, 0x5f61ab02ULL, 0xb049b6a3ULL, 0xb9d94d77ULL, 0x19cf7932ULL, 0xae72cd1fULL, 0xb049b6a3ULL, 0xedc88766ULL},
+{0x906c7089ULL, 0xb8269735ULL, 0x3b4ed387ULL, 0xd75c4478ULL, 0x906c7089ULL, 0xe613ffbULL, 0xaa558d60ULL, 0xd75c4478ULL, 0x6f5de0b6ULL},
+{0x69c1a425ULL, 0xf920177bULL, 0xbb74ff64ULL, 0x64a8555fULL, 0x69c1a425ULL, 0x5a7980cULL, 0x8ac1a695ULL, 0x64a8555fULL, 0xa61bbb13ULL},
+{0x5228de16ULL, 0x89e933e6ULL, 0x284f0457ULL, 0xcc1381a0ULL, 0x5228de16ULL, 0x7fc6e91eULL, 0xcceace6dULL, 0xcc1381a0ULL, 0x1c8b9822ULL},
+{0xd3da3095ULL, 0x3167d63cULL, 0x6407031dULL, 0x2c5ea347ULL, 0xd3da3095ULL, 0x2e2cbc44ULL, 0x65f97621ULL, 0x2c5ea347ULL, 0xc477f3bbULL},
+{0x33192c5cULL, 0x37a5aedfULL, 0x558b3a0fULL, 0x75f0e5a0ULL, 0x33192c5cULL, 0xb40ab258ULL, 0xc690851fULL, 0x75f0e5a0ULL, 0x7a2e9999ULL},
+{0xfe73965eULL, 0x709e9dbeULL, 0x66769182ULL, 0x57cf4521ULL, 0xfe73965eULL, 0x87def03eULL, 0x2829eb34ULL, 0x57cf4521ULL, 0x308bfe3cULL},
+{0x9ad022c8ULL, 0xfc4c0740ULL, 0xd6b1e675ULL, 0x9ece7c39ULL, 0x9ad022c8ULL, 0x389b443aULL, 0xdf83702cULL, 0x9ece7c39ULL, 0x5b948302ULL},
+{0xe4a599b0ULL, 0x93d0d911ULL, 0xa69fb3b8ULL, 0x408df1aULL, 0xe4a599b0ULL, 0x86f8ed30ULL, 0x8b2796bcULL, 0x408df1aULL, 0x5138889aULL},
+{0xe15da4e6ULL, 0xa67927d5ULL, 0xbb30b904ULL, 0x45186b23ULL, 0xe15da4e6ULL, 0x8bf17a8ULL, 0x6d97525cULL, 0x45186b23ULL, 0x4862fc1dULL}}
+};
+
+#endif
@@ -0,0 +1,4131 @@
+/*******************************************************************************
+* mrg32k3a_jump256.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __MRG32K3A_JUMP256_H__
+#define __MRG32K3A_JUMP256_H__
+
+#include <stdint.h>
+
+/*============================================================================*\
+              Pre-computed matrices for jumping ahead with radix 256
+\*============================================================================*/
+
+/*******************************************************************************
+  The matrices A_k^(g * 256^i) mod m_k, with k in {1,2}, g from 1 to 255, and
+  i from 0 to 7. See `mrg32k3a_jump.h`.
+*******************************************************************************/
+
+const uint64_t A1gj256i[MRG32K3A_JUMP_NDIGIT][255][9] = {
+  {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL},
+{0x0ULL, 0x0ULL, 0x1ULL, 0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL},
+{0xfff3a047ULL, 0x156abcULL, 0x0ULL, 0x0ULL, 0xfff3a047ULL, 0x156abcULL, 0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL},
+{0x0ULL, 0xfff3a047ULL, 0x156abcULL, 0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL, 0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL},
+{0xe956547ULL, 0xaf59affaULL, 0xfff3a047ULL, 0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL, 0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL},
+{0x8efaf29ULL, 0x1d2aca8eULL, 0xaf59affaULL, 0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL, 0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL},
+{0xe177c389ULL, 0x6d266ae8ULL, 0x1d2aca8eULL, 0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL, 0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL},
+{0x5b09b7deULL, 0xa4674c3dULL, 0x6d266ae8ULL, 0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL, 0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL},
+{0xf2bf8f6bULL, 0x3800c537ULL, 0xa4674c3dULL, 0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL, 0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL},
+{0x7b0c1bfdULL, 0xc068634cULL, 0x3800c537ULL, 0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL, 0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL},
+{0xb61978cbULL, 0x1e9bebebULL, 0xc068634cULL, 0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL, 0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL},
+{0x9dc8dfc6ULL, 0x6e4018b4ULL, 0x1e9bebebULL, 0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL, 0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL},
+{0xf1d8c50fULL, 0x457a148ULL, 0x6e4018b4ULL, 0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL, 0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL},
+{0x600e0a2fULL, 0x81712999ULL, 0x457a148ULL, 0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL, 0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL},
+{0x53d18b88ULL, 0x1464380fULL, 0x81712999ULL, 0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL, 0x1715be86ULL, 0x3f53bd2aULL, 0xb089ba24ULL},
+{0x2be4d11dULL, 0xb089ba24ULL, 0x1464380fULL, 0x1715be86ULL, 0x3f53bd2aULL, 0xb089ba24ULL, 0xb02f22f8ULL, 0x1450198dULL, 0x3f53bd2aULL},
+{0x1715be86ULL, 0x3f53bd2aULL, 0xb089ba24ULL, 0xb02f22f8ULL, 0x1450198dULL, 0x3f53bd2aULL, 0xfc2f9208ULL, 0x66c6b6f6ULL, 0x1450198dULL},
+{0xb02f22f8ULL, 0x1450198dULL, 0x3f53bd2aULL, 0xfc2f9208ULL, 0x66c6b6f6ULL, 0x1450198dULL, 0xfa9deaceULL, 0x2b8ae38fULL, 0x66c6b6f6ULL},
+{0xfc2f9208ULL, 0x66c6b6f6ULL, 0x1450198dULL, 0xfa9deaceULL, 0x2b8ae38fULL, 0x66c6b6f6ULL, 0x4d25deb5ULL, 0xc5812c4dULL, 0x2b8ae38fULL},
+{0xfa9deaceULL, 0x2b8ae38fULL, 0x66c6b6f6ULL, 0x4d25deb5ULL, 0xc5812c4dULL, 0x2b8ae38fULL, 0xde278140ULL, 0x77128805ULL, 0xc5812c4dULL},
+{0x4d25deb5ULL, 0xc5812c4dULL, 0x2b8ae38fULL, 0xde278140ULL, 0x77128805ULL, 0xc5812c4dULL, 0x7944df41ULL, 0x152a465eULL, 0x77128805ULL},
+{0xde278140ULL, 0x77128805ULL, 0xc5812c4dULL, 0x7944df41ULL, 0x152a465eULL, 0x77128805ULL, 0xe4545134ULL, 0xc7bdcd37ULL, 0x152a465eULL},
+{0x7944df41ULL, 0x152a465eULL, 0x77128805ULL, 0xe4545134ULL, 0xc7bdcd37ULL, 0x152a465eULL, 0xfe9bf3ebULL, 0xb7aafc77ULL, 0xc7bdcd37ULL},
+{0xe4545134ULL, 0xc7bdcd37ULL, 0x152a465eULL, 0xfe9bf3ebULL, 0xb7aafc77ULL, 0xc7bdcd37ULL, 0xa42e87c5ULL, 0x281ee549ULL, 0xb7aafc77ULL},
+{0xfe9bf3ebULL, 0xb7aafc77ULL, 0xc7bdcd37ULL, 0xa42e87c5ULL, 0x281ee549ULL, 0xb7aafc77ULL, 0xe7848b4cULL, 0x1497a0b4ULL, 0x281ee549ULL},
+{0xa42e87c5ULL, 0x281ee549ULL, 0xb7aafc77ULL, 0xe7848b4cULL, 0x1497a0b4ULL, 0x281ee549ULL, 0x8ace3415ULL, 0xfadfa89bULL, 0x1497a0b4ULL},
+{0xe7848b4cULL, 0x1497a0b4ULL, 0x281ee549ULL, 0x8ace3415ULL, 0xfadfa89bULL, 0x1497a0b4ULL, 0x20544bc2ULL, 0xa2dece2bULL, 0xfadfa89bULL},
+{0x8ace3415ULL, 0xfadfa89bULL, 0x1497a0b4ULL, 0x20544bc2ULL, 0xa2dece2bULL, 0xfadfa89bULL, 0x943c93aaULL, 0xde3dcc57ULL, 0xa2dece2bULL},
+{0x20544bc2ULL, 0xa2dece2bULL, 0xfadfa89bULL, 0x943c93aaULL, 0xde3dcc57ULL, 0xa2dece2bULL, 0xe5f073f4ULL, 0x65e08f9dULL, 0xde3dcc57ULL},
+{0x943c93aaULL, 0xde3dcc57ULL, 0xa2dece2bULL, 0xe5f073f4ULL, 0x65e08f9dULL, 0xde3dcc57ULL, 0x4a1e55beULL, 0x843f6983ULL, 0x65e08f9dULL},
+{0xe5f073f4ULL, 0x65e08f9dULL, 0xde3dcc57ULL, 0x4a1e55beULL, 0x843f6983ULL, 0x65e08f9dULL, 0x786149acULL, 0xe5551effULL, 0x843f6983ULL},
+{0x4a1e55beULL, 0x843f6983ULL, 0x65e08f9dULL, 0x786149acULL, 0xe5551effULL, 0x843f6983ULL, 0xe66ea277ULL, 0x896a5ae7ULL, 0xe5551effULL},
+{0x786149acULL, 0xe5551effULL, 0x843f6983ULL, 0xe66ea277ULL, 0x896a5ae7ULL, 0xe5551effULL, 0x6c7a1f75ULL, 0x2a5bd875ULL, 0x896a5ae7ULL},
+{0xe66ea277ULL, 0x896a5ae7ULL, 0xe5551effULL, 0x6c7a1f75ULL, 0x2a5bd875ULL, 0x896a5ae7ULL, 0x21fcf75aULL, 0xde8e395dULL, 0x2a5bd875ULL},
+{0x6c7a1f75ULL, 0x2a5bd875ULL, 0x896a5ae7ULL, 0x21fcf75aULL, 0xde8e395dULL, 0x2a5bd875ULL, 0xbc211185ULL, 0x98e0318ULL, 0xde8e395dULL},
+{0x21fcf75aULL, 0xde8e395dULL, 0x2a5bd875ULL, 0xbc211185ULL, 0x98e0318ULL, 0xde8e395dULL, 0x5ce827fbULL, 0xd4281156ULL, 0x98e0318ULL},
+{0xbc211185ULL, 0x98e0318ULL, 0xde8e395dULL, 0x5ce827fbULL, 0xd4281156ULL, 0x98e0318ULL, 0xca9e29dULL, 0x70196dddULL, 0xd4281156ULL},
+{0x5ce827fbULL, 0xd4281156ULL, 0x98e0318ULL, 0xca9e29dULL, 0x70196dddULL, 0xd4281156ULL, 0x2cec0708ULL, 0xebcfc312ULL, 0x70196dddULL},
+{0xca9e29dULL, 0x70196dddULL, 0xd4281156ULL, 0x2cec0708ULL, 0xebcfc312ULL, 0x70196dddULL, 0xe7d52227ULL, 0x11df4397ULL, 0xebcfc312ULL},
+{0x2cec0708ULL, 0xebcfc312ULL, 0x70196dddULL, 0xe7d52227ULL, 0x11df4397ULL, 0xebcfc312ULL, 0xd3f10466ULL, 0x2bc2fd4cULL, 0x11df4397ULL},
+{0xe7d52227ULL, 0x11df4397ULL, 0xebcfc312ULL, 0xd3f10466ULL, 0x2bc2fd4cULL, 0x11df4397ULL, 0xa710cc90ULL, 0xf27eab4eULL, 0x2bc2fd4cULL},
+{0xd3f10466ULL, 0x2bc2fd4cULL, 0x11df4397ULL, 0xa710cc90ULL, 0xf27eab4eULL, 0x2bc2fd4cULL, 0xdcfe9162ULL, 0x515d73feULL, 0xf27eab4eULL},
+{0xa710cc90ULL, 0xf27eab4eULL, 0x2bc2fd4cULL, 0xdcfe9162ULL, 0x515d73feULL, 0xf27eab4eULL, 0xa91506c9ULL, 0x82e8ab59ULL, 0x515d73feULL},
+{0xdcfe9162ULL, 0x515d73feULL, 0xf27eab4eULL, 0xa91506c9ULL, 0x82e8ab59ULL, 0x515d73feULL, 0x7f99dd84ULL, 0xa5220a98ULL, 0x82e8ab59ULL},
+{0xa91506c9ULL, 0x82e8ab59ULL, 0x515d73feULL, 0x7f99dd84ULL, 0xa5220a98ULL, 0x82e8ab59ULL, 0xe0e3ea17ULL, 0x10a87b7bULL, 0xa5220a98ULL},
+{0x7f99dd84ULL, 0xa5220a98ULL, 0x82e8ab59ULL, 0xe0e3ea17ULL, 0x10a87b7bULL, 0xa5220a98ULL, 0x539ed19fULL, 0x2805f86cULL, 0x10a87b7bULL},
+{0xe0e3ea17ULL, 0x10a87b7bULL, 0xa5220a98ULL, 0x539ed19fULL, 0x2805f86cULL, 0x10a87b7bULL, 0x3f8cb105ULL, 0x74b4b1f7ULL, 0x2805f86cULL},
+{0x539ed19fULL, 0x2805f86cULL, 0x10a87b7bULL, 0x3f8cb105ULL, 0x74b4b1f7ULL, 0x2805f86cULL, 0xe2bafdd1ULL, 0x8063a612ULL, 0x74b4b1f7ULL},
+{0x3f8cb105ULL, 0x74b4b1f7ULL, 0x2805f86cULL, 0xe2bafdd1ULL, 0x8063a612ULL, 0x74b4b1f7ULL, 0x86b758dbULL, 0xa598d71ULL, 0x8063a612ULL},
+{0xe2bafdd1ULL, 0x8063a612ULL, 0x74b4b1f7ULL, 0x86b758dbULL, 0xa598d71ULL, 0x8063a612ULL, 0x40ce375bULL, 0xbae7a207ULL, 0xa598d71ULL},
+{0x86b758dbULL, 0xa598d71ULL, 0x8063a612ULL, 0x40ce375bULL, 0xbae7a207ULL, 0xa598d71ULL, 0x1b33cc3fULL, 0x8a1cd750ULL, 0xbae7a207ULL},
+{0x40ce375bULL, 0xbae7a207ULL, 0xa598d71ULL, 0x1b33cc3fULL, 0x8a1cd750ULL, 0xbae7a207ULL, 0xf0e2efd1ULL, 0x9dbcb2e0ULL, 0x8a1cd750ULL},
+{0x1b33cc3fULL, 0x8a1cd750ULL, 0xbae7a207ULL, 0xf0e2efd1ULL, 0x9dbcb2e0ULL, 0x8a1cd750ULL, 0x219a9f92ULL, 0x23712c5ULL, 0x9dbcb2e0ULL},
+{0xf0e2efd1ULL, 0x9dbcb2e0ULL, 0x8a1cd750ULL, 0x219a9f92ULL, 0x23712c5ULL, 0x9dbcb2e0ULL, 0x5a96923dULL, 0xd164c0b0ULL, 0x23712c5ULL},
+{0x219a9f92ULL, 0x23712c5ULL, 0x9dbcb2e0ULL, 0x5a96923dULL, 0xd164c0b0ULL, 0x23712c5ULL, 0xe3e04790ULL, 0x531da82aULL, 0xd164c0b0ULL},
+{0x5a96923dULL, 0xd164c0b0ULL, 0x23712c5ULL, 0xe3e04790ULL, 0x531da82aULL, 0xd164c0b0ULL, 0x2d6df906ULL, 0x3e63e402ULL, 0x531da82aULL},
+{0xe3e04790ULL, 0x531da82aULL, 0xd164c0b0ULL, 0x2d6df906ULL, 0x3e63e402ULL, 0x531da82aULL, 0xe420beabULL, 0x4ff621d4ULL, 0x3e63e402ULL},
+{0x2d6df906ULL, 0x3e63e402ULL, 0x531da82aULL, 0xe420beabULL, 0x4ff621d4ULL, 0x3e63e402ULL, 0x15328560ULL, 0xca51e768ULL, 0x4ff621d4ULL},
+{0xe420beabULL, 0x4ff621d4ULL, 0x3e63e402ULL, 0x15328560ULL, 0xca51e768ULL, 0x4ff621d4ULL, 0x8f6dec81ULL, 0x83cf4347ULL, 0xca51e768ULL},
+{0x15328560ULL, 0xca51e768ULL, 0x4ff621d4ULL, 0x8f6dec81ULL, 0x83cf4347ULL, 0xca51e768ULL, 0xb1f2c297ULL, 0x16be7964ULL, 0x83cf4347ULL},
+{0x8f6dec81ULL, 0x83cf4347ULL, 0xca51e768ULL, 0xb1f2c297ULL, 0x16be7964ULL, 0x83cf4347ULL, 0x44efbe03ULL, 0xddd73ec0ULL, 0x16be7964ULL},
+{0xb1f2c297ULL, 0x16be7964ULL, 0x83cf4347ULL, 0x44efbe03ULL, 0xddd73ec0ULL, 0x16be7964ULL, 0xc1399073ULL, 0xcdd5f87eULL, 0xddd73ec0ULL},
+{0x44efbe03ULL, 0xddd73ec0ULL, 0x16be7964ULL, 0xc1399073ULL, 0xcdd5f87eULL, 0xddd73ec0ULL, 0xf22423caULL, 0x2e044aULL, 0xcdd5f87eULL},
+{0xc1399073ULL, 0xcdd5f87eULL, 0xddd73ec0ULL, 0xf22423caULL, 0x2e044aULL, 0xcdd5f87eULL, 0x36d1b0c9ULL, 0x248fd2b2ULL, 0x2e044aULL},
+{0xf22423caULL, 0x2e044aULL, 0xcdd5f87eULL, 0x36d1b0c9ULL, 0x248fd2b2ULL, 0x2e044aULL, 0xbd3f1f96ULL, 0xc0789f4aULL, 0x248fd2b2ULL},
+{0x36d1b0c9ULL, 0x248fd2b2ULL, 0x2e044aULL, 0xbd3f1f96ULL, 0xc0789f4aULL, 0x248fd2b2ULL, 0x2c8270a4ULL, 0x6f34d649ULL, 0xc0789f4aULL},
+{0xbd3f1f96ULL, 0xc0789f4aULL, 0x248fd2b2ULL, 0x2c8270a4ULL, 0x6f34d649ULL, 0xc0789f4aULL, 0xc922997dULL, 0x95436660ULL, 0x6f34d649ULL},
+{0x2c8270a4ULL, 0x6f34d649ULL, 0xc0789f4aULL, 0xc922997dULL, 0x95436660ULL, 0x6f34d649ULL, 0xc19fdd13ULL, 0xf03fa03cULL, 0x95436660ULL},
+{0xc922997dULL, 0x95436660ULL, 0x6f34d649ULL, 0xc19fdd13ULL, 0xf03fa03cULL, 0x95436660ULL, 0x28f07b51ULL, 0xb794a6c6ULL, 0xf03fa03cULL},
+{0xc19fdd13ULL, 0xf03fa03cULL, 0x95436660ULL, 0x28f07b51ULL, 0xb794a6c6ULL, 0xf03fa03cULL, 0x5d365b03ULL, 0x2557b934ULL, 0xb794a6c6ULL},
+{0x28f07b51ULL, 0xb794a6c6ULL, 0xf03fa03cULL, 0x5d365b03ULL, 0x2557b934ULL, 0xb794a6c6ULL, 0x338613d9ULL, 0x7636b4e7ULL, 0x2557b934ULL},
+{0x5d365b03ULL, 0x2557b934ULL, 0xb794a6c6ULL, 0x338613d9ULL, 0x7636b4e7ULL, 0x2557b934ULL, 0x4295ebdbULL, 0x26728d0dULL, 0x7636b4e7ULL},
+{0x338613d9ULL, 0x7636b4e7ULL, 0x2557b934ULL, 0x4295ebdbULL, 0x26728d0dULL, 0x7636b4e7ULL, 0x48815504ULL, 0x98b06025ULL, 0x26728d0dULL},
+{0x4295ebdbULL, 0x26728d0dULL, 0x7636b4e7ULL, 0x48815504ULL, 0x98b06025ULL, 0x26728d0dULL, 0x7a451898ULL, 0x87b98c8dULL, 0x98b06025ULL},
+{0x48815504ULL, 0x98b06025ULL, 0x26728d0dULL, 0x7a451898ULL, 0x87b98c8dULL, 0x98b06025ULL, 0x55193198ULL, 0x9111c6b5ULL, 0x87b98c8dULL},
+{0x7a451898ULL, 0x87b98c8dULL, 0x98b06025ULL, 0x55193198ULL, 0x9111c6b5ULL, 0x87b98c8dULL, 0x424617f4ULL, 0x6664ee23ULL, 0x9111c6b5ULL},
+{0x55193198ULL, 0x9111c6b5ULL, 0x87b98c8dULL, 0x424617f4ULL, 0x6664ee23ULL, 0x9111c6b5ULL, 0xaab852faULL, 0x7e5c7da1ULL, 0x6664ee23ULL},
+{0x424617f4ULL, 0x6664ee23ULL, 0x9111c6b5ULL, 0xaab852faULL, 0x7e5c7da1ULL, 0x6664ee23ULL, 0xf76932f6ULL, 0x374f0df7ULL, 0x7e5c7da1ULL},
+{0xaab852faULL, 0x7e5c7da1ULL, 0x6664ee23ULL, 0xf76932f6ULL, 0x374f0df7ULL, 0x7e5c7da1ULL, 0x9d84d6b9ULL, 0x66308a58ULL, 0x374f0df7ULL},
+{0xf76932f6ULL, 0x374f0df7ULL, 0x7e5c7da1ULL, 0x9d84d6b9ULL, 0x66308a58ULL, 0x374f0df7ULL, 0x2f780e12ULL, 0x20657069ULL, 0x66308a58ULL},
+{0x9d84d6b9ULL, 0x66308a58ULL, 0x374f0df7ULL, 0x2f780e12ULL, 0x20657069ULL, 0x66308a58ULL, 0x110e3ec7ULL, 0xb498dd28ULL, 0x20657069ULL},
+{0x2f780e12ULL, 0x20657069ULL, 0x66308a58ULL, 0x110e3ec7ULL, 0xb498dd28ULL, 0x20657069ULL, 0x1e9862d4ULL, 0x16ebb7f7ULL, 0xb498dd28ULL},
+{0x110e3ec7ULL, 0xb498dd28ULL, 0x20657069ULL, 0x1e9862d4ULL, 0x16ebb7f7ULL, 0xb498dd28ULL, 0xcf42f071ULL, 0x3b0b15eaULL, 0x16ebb7f7ULL},
+{0x1e9862d4ULL, 0x16ebb7f7ULL, 0xb498dd28ULL, 0xcf42f071ULL, 0x3b0b15eaULL, 0x16ebb7f7ULL, 0xc5918dcULL, 0x575e14caULL, 0x3b0b15eaULL},
+{0xcf42f071ULL, 0x3b0b15eaULL, 0x16ebb7f7ULL, 0xc5918dcULL, 0x575e14caULL, 0x3b0b15eaULL, 0x629be837ULL, 0xcfca721aULL, 0x575e14caULL},
+{0xc5918dcULL, 0x575e14caULL, 0x3b0b15eaULL, 0x629be837ULL, 0xcfca721aULL, 0x575e14caULL, 0x4a309d93ULL, 0x3ad86dc4ULL, 0xcfca721aULL},
+{0x629be837ULL, 0xcfca721aULL, 0x575e14caULL, 0x4a309d93ULL, 0x3ad86dc4ULL, 0xcfca721aULL, 0xf9387439ULL, 0x206e6149ULL, 0x3ad86dc4ULL},
+{0x4a309d93ULL, 0x3ad86dc4ULL, 0xcfca721aULL, 0xf9387439ULL, 0x206e6149ULL, 0x3ad86dc4ULL, 0xc0c3e8aULL, 0xd2b52093ULL, 0x206e6149ULL},
+{0xf9387439ULL, 0x206e6149ULL, 0x3ad86dc4ULL, 0xc0c3e8aULL, 0xd2b52093ULL, 0x206e6149ULL, 0x838b7d35ULL, 0x8e97f829ULL, 0xd2b52093ULL},
+{0xc0c3e8aULL, 0xd2b52093ULL, 0x206e6149ULL, 0x838b7d35ULL, 0x8e97f829ULL, 0xd2b52093ULL, 0xfab0736cULL, 0xfa7f7aeeULL, 0x8e97f829ULL},
+{0x838b7d35ULL, 0x8e97f829ULL, 0xd2b52093ULL, 0xfab0736cULL, 0xfa7f7aeeULL, 0x8e97f829ULL, 0x519beb4bULL, 0x425e934ULL, 0xfa7f7aeeULL},
+{0xfab0736cULL, 0xfa7f7aeeULL, 0x8e97f829ULL, 0x519beb4bULL, 0x425e934ULL, 0xfa7f7aeeULL, 0x604b49f8ULL, 0x36c2add9ULL, 0x425e934ULL},
+{0x519beb4bULL, 0x425e934ULL, 0xfa7f7aeeULL, 0x604b49f8ULL, 0x36c2add9ULL, 0x425e934ULL, 0x6369abbfULL, 0x403e9bafULL, 0x36c2add9ULL},
+{0x604b49f8ULL, 0x36c2add9ULL, 0x425e934ULL, 0x6369abbfULL, 0x403e9bafULL, 0x36c2add9ULL, 0xbb67b68aULL, 0x7ce7ac78ULL, 0x403e9bafULL},
+{0x6369abbfULL, 0x403e9bafULL, 0x36c2add9ULL, 0xbb67b68aULL, 0x7ce7ac78ULL, 0x403e9bafULL, 0x7b5bcfd7ULL, 0x9f96d0baULL, 0x7ce7ac78ULL},
+{0xbb67b68aULL, 0x7ce7ac78ULL, 0x403e9bafULL, 0x7b5bcfd7ULL, 0x9f96d0baULL, 0x7ce7ac78ULL, 0xa22a2725ULL, 0x51481c1cULL, 0x9f96d0baULL},
+{0x7b5bcfd7ULL, 0x9f96d0baULL, 0x7ce7ac78ULL, 0xa22a2725ULL, 0x51481c1cULL, 0x9f96d0baULL, 0x2faac474ULL, 0x7180daf6ULL, 0x51481c1cULL},
+{0xa22a2725ULL, 0x51481c1cULL, 0x9f96d0baULL, 0x2faac474ULL, 0x7180daf6ULL, 0x51481c1cULL, 0x87cf55dcULL, 0x101c3532ULL, 0x7180daf6ULL},
+{0x2faac474ULL, 0x7180daf6ULL, 0x51481c1cULL, 0x87cf55dcULL, 0x101c3532ULL, 0x7180daf6ULL, 0x8ad0e7c1ULL, 0x3b089779ULL, 0x101c3532ULL},
+{0x87cf55dcULL, 0x101c3532ULL, 0x7180daf6ULL, 0x8ad0e7c1ULL, 0x3b089779ULL, 0x101c3532ULL, 0x8becb9a4ULL, 0x6bc25c01ULL, 0x3b089779ULL},
+{0x8ad0e7c1ULL, 0x3b089779ULL, 0x101c3532ULL, 0x8becb9a4ULL, 0x6bc25c01ULL, 0x3b089779ULL, 0x3c9815eeULL, 0xe5e942a1ULL, 0x6bc25c01ULL},
+{0x8becb9a4ULL, 0x6bc25c01ULL, 0x3b089779ULL, 0x3c9815eeULL, 0xe5e942a1ULL, 0x6bc25c01ULL, 0xa5c7ef08ULL, 0x6cdd39b9ULL, 0xe5e942a1ULL},
+{0x3c9815eeULL, 0xe5e942a1ULL, 0x6bc25c01ULL, 0xa5c7ef08ULL, 0x6cdd39b9ULL, 0xe5e942a1ULL, 0xd586802cULL, 0x999481a2ULL, 0x6cdd39b9ULL},
+{0xa5c7ef08ULL, 0x6cdd39b9ULL, 0xe5e942a1ULL, 0xd586802cULL, 0x999481a2ULL, 0x6cdd39b9ULL, 0x635a47adULL, 0x257ff9b2ULL, 0x999481a2ULL},
+{0xd586802cULL, 0x999481a2ULL, 0x6cdd39b9ULL, 0x635a47adULL, 0x257ff9b2ULL, 0x999481a2ULL, 0x3029f26aULL, 0x56dde48cULL, 0x257ff9b2ULL},
+{0x635a47adULL, 0x257ff9b2ULL, 0x999481a2ULL, 0x3029f26aULL, 0x56dde48cULL, 0x257ff9b2ULL, 0x50839f19ULL, 0x35b2b3e4ULL, 0x56dde48cULL},
+{0x3029f26aULL, 0x56dde48cULL, 0x257ff9b2ULL, 0x50839f19ULL, 0x35b2b3e4ULL, 0x56dde48cULL, 0x13002895ULL, 0xc1844944ULL, 0x35b2b3e4ULL},
+{0x50839f19ULL, 0x35b2b3e4ULL, 0x56dde48cULL, 0x13002895ULL, 0xc1844944ULL, 0x35b2b3e4ULL, 0x4730edc7ULL, 0x461793d1ULL, 0xc1844944ULL},
+{0x13002895ULL, 0xc1844944ULL, 0x35b2b3e4ULL, 0x4730edc7ULL, 0x461793d1ULL, 0xc1844944ULL, 0x966433ceULL, 0x3a788390ULL, 0x461793d1ULL},
+{0x4730edc7ULL, 0x461793d1ULL, 0xc1844944ULL, 0x966433ceULL, 0x3a788390ULL, 0x461793d1ULL, 0xe1cb6600ULL, 0xf7d7d8f2ULL, 0x3a788390ULL},
+{0x966433ceULL, 0x3a788390ULL, 0x461793d1ULL, 0xe1cb6600ULL, 0xf7d7d8f2ULL, 0x3a788390ULL, 0x956b5decULL, 0x8793ff44ULL, 0xf7d7d8f2ULL},
+{0xe1cb6600ULL, 0xf7d7d8f2ULL, 0x3a788390ULL, 0x956b5decULL, 0x8793ff44ULL, 0xf7d7d8f2ULL, 0xed9b6ddfULL, 0xd48a67ceULL, 0x8793ff44ULL},
+{0x956b5decULL, 0x8793ff44ULL, 0xf7d7d8f2ULL, 0xed9b6ddfULL, 0xd48a67ceULL, 0x8793ff44ULL, 0xcd9c6aecULL, 0xbfd39e6aULL, 0xd48a67ceULL},
+{0xed9b6ddfULL, 0xd48a67ceULL, 0x8793ff44ULL, 0xcd9c6aecULL, 0xbfd39e6aULL, 0xd48a67ceULL, 0xaa69b8b7ULL, 0xc4a633acULL, 0xbfd39e6aULL},
+{0xcd9c6aecULL, 0xbfd39e6aULL, 0xd48a67ceULL, 0xaa69b8b7ULL, 0xc4a633acULL, 0xbfd39e6aULL, 0xff8426c6ULL, 0x35360596ULL, 0xc4a633acULL},
+{0xaa69b8b7ULL, 0xc4a633acULL, 0xbfd39e6aULL, 0xff8426c6ULL, 0x35360596ULL, 0xc4a633acULL, 0x4e95f2ceULL, 0x8581b6b6ULL, 0x35360596ULL},
+{0xff8426c6ULL, 0x35360596ULL, 0xc4a633acULL, 0x4e95f2ceULL, 0x8581b6b6ULL, 0x35360596ULL, 0xabdc735dULL, 0x39828cf4ULL, 0x8581b6b6ULL},
+{0x4e95f2ceULL, 0x8581b6b6ULL, 0x35360596ULL, 0xabdc735dULL, 0x39828cf4ULL, 0x8581b6b6ULL, 0xcb8f3b3cULL, 0x72d257b3ULL, 0x39828cf4ULL},
+{0xabdc735dULL, 0x39828cf4ULL, 0x8581b6b6ULL, 0xcb8f3b3cULL, 0x72d257b3ULL, 0x39828cf4ULL, 0x5439d79fULL, 0xa9bd551cULL, 0x72d257b3ULL},
+{0xcb8f3b3cULL, 0x72d257b3ULL, 0x39828cf4ULL, 0x5439d79fULL, 0xa9bd551cULL, 0x72d257b3ULL, 0x944125faULL, 0xf8890233ULL, 0xa9bd551cULL},
+{0x5439d79fULL, 0xa9bd551cULL, 0x72d257b3ULL, 0x944125faULL, 0xf8890233ULL, 0xa9bd551cULL, 0xa3284b72ULL, 0xa76d2067ULL, 0xf8890233ULL},
+{0x944125faULL, 0xf8890233ULL, 0xa9bd551cULL, 0xa3284b72ULL, 0xa76d2067ULL, 0xf8890233ULL, 0x50d53038ULL, 0x21d7a553ULL, 0xa76d2067ULL},
+{0xa3284b72ULL, 0xa76d2067ULL, 0xf8890233ULL, 0x50d53038ULL, 0x21d7a553ULL, 0xa76d2067ULL, 0xa7c5e278ULL, 0x2846113eULL, 0x21d7a553ULL},
+{0x50d53038ULL, 0x21d7a553ULL, 0xa76d2067ULL, 0xa7c5e278ULL, 0x2846113eULL, 0x21d7a553ULL, 0x64a3e7a0ULL, 0x5eb664c9ULL, 0x2846113eULL},
+{0xa7c5e278ULL, 0x2846113eULL, 0x21d7a553ULL, 0x64a3e7a0ULL, 0x5eb664c9ULL, 0x2846113eULL, 0xf5acdc18ULL, 0x68126bd2ULL, 0x5eb664c9ULL},
+{0x64a3e7a0ULL, 0x5eb664c9ULL, 0x2846113eULL, 0xf5acdc18ULL, 0x68126bd2ULL, 0x5eb664c9ULL, 0x748a4e0eULL, 0x544f2468ULL, 0x68126bd2ULL},
+{0xf5acdc18ULL, 0x68126bd2ULL, 0x5eb664c9ULL, 0x748a4e0eULL, 0x544f2468ULL, 0x68126bd2ULL, 0xd9c418cdULL, 0x620c20ddULL, 0x544f2468ULL},
+{0x748a4e0eULL, 0x544f2468ULL, 0x68126bd2ULL, 0xd9c418cdULL, 0x620c20ddULL, 0x544f2468ULL, 0xd0b55548ULL, 0x8b4008e2ULL, 0x620c20ddULL},
+{0xd9c418cdULL, 0x620c20ddULL, 0x544f2468ULL, 0xd0b55548ULL, 0x8b4008e2ULL, 0x620c20ddULL, 0x22b6d5ddULL, 0x900c5374ULL, 0x8b4008e2ULL},
+{0xd0b55548ULL, 0x8b4008e2ULL, 0x620c20ddULL, 0x22b6d5ddULL, 0x900c5374ULL, 0x8b4008e2ULL, 0xda9e99bfULL, 0xad77b654ULL, 0x900c5374ULL},
+{0x22b6d5ddULL, 0x900c5374ULL, 0x8b4008e2ULL, 0xda9e99bfULL, 0xad77b654ULL, 0x900c5374ULL, 0xff10f424ULL, 0xa09496a1ULL, 0xad77b654ULL},
+{0xda9e99bfULL, 0xad77b654ULL, 0x900c5374ULL, 0xff10f424ULL, 0xa09496a1ULL, 0xad77b654ULL, 0x43c7fa34ULL, 0xf536b309ULL, 0xa09496a1ULL},
+{0xff10f424ULL, 0xa09496a1ULL, 0xad77b654ULL, 0x43c7fa34ULL, 0xf536b309ULL, 0xa09496a1ULL, 0xd4269598ULL, 0x1d71fed4ULL, 0xf536b309ULL},
+{0x43c7fa34ULL, 0xf536b309ULL, 0xa09496a1ULL, 0xd4269598ULL, 0x1d71fed4ULL, 0xf536b309ULL, 0x4297e60fULL, 0x4ef0550eULL, 0x1d71fed4ULL},
+{0xd4269598ULL, 0x1d71fed4ULL, 0xf536b309ULL, 0x4297e60fULL, 0x4ef0550eULL, 0x1d71fed4ULL, 0x8205d52dULL, 0xff39aa5fULL, 0x4ef0550eULL},
+{0x4297e60fULL, 0x4ef0550eULL, 0x1d71fed4ULL, 0x8205d52dULL, 0xff39aa5fULL, 0x4ef0550eULL, 0x37328848ULL, 0xfd465415ULL, 0xff39aa5fULL},
+{0x8205d52dULL, 0xff39aa5fULL, 0x4ef0550eULL, 0x37328848ULL, 0xfd465415ULL, 0xff39aa5fULL, 0x80a90f25ULL, 0x91509370ULL, 0xfd465415ULL},
+{0x37328848ULL, 0xfd465415ULL, 0xff39aa5fULL, 0x80a90f25ULL, 0x91509370ULL, 0xfd465415ULL, 0xaa6a2126ULL, 0x9624fd4fULL, 0x91509370ULL},
+{0x80a90f25ULL, 0x91509370ULL, 0xfd465415ULL, 0xaa6a2126ULL, 0x9624fd4fULL, 0x91509370ULL, 0xc9dba529ULL, 0xe0bf9838ULL, 0x9624fd4fULL},
+{0xaa6a2126ULL, 0x9624fd4fULL, 0x91509370ULL, 0xc9dba529ULL, 0xe0bf9838ULL, 0x9624fd4fULL, 0x73d70a22ULL, 0x2fa4a540ULL, 0xe0bf9838ULL},
+{0xc9dba529ULL, 0xe0bf9838ULL, 0x9624fd4fULL, 0x73d70a22ULL, 0x2fa4a540ULL, 0xe0bf9838ULL, 0xccfba192ULL, 0x6183b86eULL, 0x2fa4a540ULL},
+{0x73d70a22ULL, 0x2fa4a540ULL, 0xe0bf9838ULL, 0xccfba192ULL, 0x6183b86eULL, 0x2fa4a540ULL, 0x9d3b90feULL, 0x87d28621ULL, 0x6183b86eULL},
+{0xccfba192ULL, 0x6183b86eULL, 0x2fa4a540ULL, 0x9d3b90feULL, 0x87d28621ULL, 0x6183b86eULL, 0x99e79dbcULL, 0xec03961cULL, 0x87d28621ULL},
+{0x9d3b90feULL, 0x87d28621ULL, 0x6183b86eULL, 0x99e79dbcULL, 0xec03961cULL, 0x87d28621ULL, 0x4d0e958fULL, 0x8e079fbeULL, 0xec03961cULL},
+{0x99e79dbcULL, 0xec03961cULL, 0x87d28621ULL, 0x4d0e958fULL, 0x8e079fbeULL, 0xec03961cULL, 0xb9020c05ULL, 0x7c431971ULL, 0x8e079fbeULL},
+{0x4d0e958fULL, 0x8e079fbeULL, 0xec03961cULL, 0xb9020c05ULL, 0x7c431971ULL, 0x8e079fbeULL, 0xf9ed078cULL, 0x530968e5ULL, 0x7c431971ULL},
+{0xb9020c05ULL, 0x7c431971ULL, 0x8e079fbeULL, 0xf9ed078cULL, 0x530968e5ULL, 0x7c431971ULL, 0x89a675b1ULL, 0x227e37a9ULL, 0x530968e5ULL},
+{0xf9ed078cULL, 0x530968e5ULL, 0x7c431971ULL, 0x89a675b1ULL, 0x227e37a9ULL, 0x530968e5ULL, 0x5cf2381eULL, 0xa733452ULL, 0x227e37a9ULL},
+{0x89a675b1ULL, 0x227e37a9ULL, 0x530968e5ULL, 0x5cf2381eULL, 0xa733452ULL, 0x227e37a9ULL, 0xc7e52313ULL, 0x87e72db6ULL, 0xa733452ULL},
+{0x5cf2381eULL, 0xa733452ULL, 0x227e37a9ULL, 0xc7e52313ULL, 0x87e72db6ULL, 0xa733452ULL, 0xc620eeb9ULL, 0x739a3b4aULL, 0x87e72db6ULL},
+{0xc7e52313ULL, 0x87e72db6ULL, 0xa733452ULL, 0xc620eeb9ULL, 0x739a3b4aULL, 0x87e72db6ULL, 0xc9d12f87ULL, 0x160a1dd2ULL, 0x739a3b4aULL},
+{0xc620eeb9ULL, 0x739a3b4aULL, 0x87e72db6ULL, 0xc9d12f87ULL, 0x160a1dd2ULL, 0x739a3b4aULL, 0xce6d9029ULL, 0x7098aad9ULL, 0x160a1dd2ULL},
+{0xc9d12f87ULL, 0x160a1dd2ULL, 0x739a3b4aULL, 0xce6d9029ULL, 0x7098aad9ULL, 0x160a1dd2ULL, 0xe92b462aULL, 0xa1efc676ULL, 0x7098aad9ULL},
+{0xce6d9029ULL, 0x7098aad9ULL, 0x160a1dd2ULL, 0xe92b462aULL, 0xa1efc676ULL, 0x7098aad9ULL, 0xe04c50c1ULL, 0xdb84547eULL, 0xa1efc676ULL},
+{0xe92b462aULL, 0xa1efc676ULL, 0x7098aad9ULL, 0xe04c50c1ULL, 0xdb84547eULL, 0xa1efc676ULL, 0xdfe95419ULL, 0x674c5e99ULL, 0xdb84547eULL},
+{0xe04c50c1ULL, 0xdb84547eULL, 0xa1efc676ULL, 0xdfe95419ULL, 0x674c5e99ULL, 0xdb84547eULL, 0x7a7c245aULL, 0xdd67c8d2ULL, 0x674c5e99ULL},
+{0xdfe95419ULL, 0x674c5e99ULL, 0xdb84547eULL, 0x7a7c245aULL, 0xdd67c8d2ULL, 0x674c5e99ULL, 0xe4ced2a7ULL, 0xbf58201bULL, 0xdd67c8d2ULL},
+{0x7a7c245aULL, 0xdd67c8d2ULL, 0x674c5e99ULL, 0xe4ced2a7ULL, 0xbf58201bULL, 0xdd67c8d2ULL, 0xcba0cd4dULL, 0xfe868222ULL, 0xbf58201bULL},
+{0xe4ced2a7ULL, 0xbf58201bULL, 0xdd67c8d2ULL, 0xcba0cd4dULL, 0xfe868222ULL, 0xbf58201bULL, 0xb3887fd6ULL, 0x7cec32c3ULL, 0xfe868222ULL},
+{0xcba0cd4dULL, 0xfe868222ULL, 0xbf58201bULL, 0xb3887fd6ULL, 0x7cec32c3ULL, 0xfe868222ULL, 0xceaefd95ULL, 0xe5e8076ULL, 0x7cec32c3ULL},
+{0xb3887fd6ULL, 0x7cec32c3ULL, 0xfe868222ULL, 0xceaefd95ULL, 0xe5e8076ULL, 0x7cec32c3ULL, 0xa93cbb75ULL, 0x8bb0461fULL, 0xe5e8076ULL},
+{0xceaefd95ULL, 0xe5e8076ULL, 0x7cec32c3ULL, 0xa93cbb75ULL, 0x8bb0461fULL, 0xe5e8076ULL, 0x411721aeULL, 0xe27d2c3bULL, 0x8bb0461fULL},
+{0xa93cbb75ULL, 0x8bb0461fULL, 0xe5e8076ULL, 0x411721aeULL, 0xe27d2c3bULL, 0x8bb0461fULL, 0x5f8a474bULL, 0x9da8e795ULL, 0xe27d2c3bULL},
+{0x411721aeULL, 0xe27d2c3bULL, 0x8bb0461fULL, 0x5f8a474bULL, 0x9da8e795ULL, 0xe27d2c3bULL, 0xac9ed0d2ULL, 0x381654c2ULL, 0x9da8e795ULL},
+{0x5f8a474bULL, 0x9da8e795ULL, 0xe27d2c3bULL, 0xac9ed0d2ULL, 0x381654c2ULL, 0x9da8e795ULL, 0x38b1203aULL, 0x6e8a3f85ULL, 0x381654c2ULL},
+{0xac9ed0d2ULL, 0x381654c2ULL, 0x9da8e795ULL, 0x38b1203aULL, 0x6e8a3f85ULL, 0x381654c2ULL, 0xfd557ed8ULL, 0x9fee6099ULL, 0x6e8a3f85ULL},
+{0x38b1203aULL, 0x6e8a3f85ULL, 0x381654c2ULL, 0xfd557ed8ULL, 0x9fee6099ULL, 0x6e8a3f85ULL, 0x10cb3222ULL, 0xa69eff52ULL, 0x9fee6099ULL},
+{0xfd557ed8ULL, 0x9fee6099ULL, 0x6e8a3f85ULL, 0x10cb3222ULL, 0xa69eff52ULL, 0x9fee6099ULL, 0xfb050b60ULL, 0x2f52de7aULL, 0xa69eff52ULL},
+{0x10cb3222ULL, 0xa69eff52ULL, 0x9fee6099ULL, 0xfb050b60ULL, 0x2f52de7aULL, 0xa69eff52ULL, 0x9fbdb556ULL, 0x2a9bdb5cULL, 0x2f52de7aULL},
+{0xfb050b60ULL, 0x2f52de7aULL, 0xa69eff52ULL, 0x9fbdb556ULL, 0x2a9bdb5cULL, 0x2f52de7aULL, 0x3f9fa2a2ULL, 0xf3f50e25ULL, 0x2a9bdb5cULL},
+{0x9fbdb556ULL, 0x2a9bdb5cULL, 0x2f52de7aULL, 0x3f9fa2a2ULL, 0xf3f50e25ULL, 0x2a9bdb5cULL, 0xde371795ULL, 0x145dd54fULL, 0xf3f50e25ULL},
+{0x3f9fa2a2ULL, 0xf3f50e25ULL, 0x2a9bdb5cULL, 0xde371795ULL, 0x145dd54fULL, 0xf3f50e25ULL, 0x3b5dbd2aULL, 0xb7bb5f62ULL, 0x145dd54fULL},
+{0xde371795ULL, 0x145dd54fULL, 0xf3f50e25ULL, 0x3b5dbd2aULL, 0xb7bb5f62ULL, 0x145dd54fULL, 0x1621fd05ULL, 0x8b78345eULL, 0xb7bb5f62ULL},
+{0x3b5dbd2aULL, 0xb7bb5f62ULL, 0x145dd54fULL, 0x1621fd05ULL, 0x8b78345eULL, 0xb7bb5f62ULL, 0x3153f76aULL, 0x78d12646ULL, 0x8b78345eULL},
+{0x1621fd05ULL, 0x8b78345eULL, 0xb7bb5f62ULL, 0x3153f76aULL, 0x78d12646ULL, 0x8b78345eULL, 0xfded71f8ULL, 0xb885f514ULL, 0x78d12646ULL},
+{0x3153f76aULL, 0x78d12646ULL, 0x8b78345eULL, 0xfded71f8ULL, 0xb885f514ULL, 0x78d12646ULL, 0xe65b69a7ULL, 0x7d5d0368ULL, 0xb885f514ULL},
+{0xfded71f8ULL, 0xb885f514ULL, 0x78d12646ULL, 0xe65b69a7ULL, 0x7d5d0368ULL, 0xb885f514ULL, 0x1264f430ULL, 0x7740cd4ULL, 0x7d5d0368ULL},
+{0xe65b69a7ULL, 0x7d5d0368ULL, 0xb885f514ULL, 0x1264f430ULL, 0x7740cd4ULL, 0x7d5d0368ULL, 0xea29d0aULL, 0xf6347b85ULL, 0x7740cd4ULL},
+{0x1264f430ULL, 0x7740cd4ULL, 0x7d5d0368ULL, 0xea29d0aULL, 0xf6347b85ULL, 0x7740cd4ULL, 0x7e3416cULL, 0xa312225aULL, 0xf6347b85ULL},
+{0xea29d0aULL, 0xf6347b85ULL, 0x7740cd4ULL, 0x7e3416cULL, 0xa312225aULL, 0xf6347b85ULL, 0xc722aa2bULL, 0xc44ce84cULL, 0xa312225aULL},
+{0x7e3416cULL, 0xa312225aULL, 0xf6347b85ULL, 0xc722aa2bULL, 0xc44ce84cULL, 0xa312225aULL, 0xec4ce0f1ULL, 0xe7326fddULL, 0xc44ce84cULL},
+{0xc722aa2bULL, 0xc44ce84cULL, 0xa312225aULL, 0xec4ce0f1ULL, 0xe7326fddULL, 0xc44ce84cULL, 0xf1b3071eULL, 0x89b3d69ULL, 0xe7326fddULL},
+{0xec4ce0f1ULL, 0xe7326fddULL, 0xc44ce84cULL, 0xf1b3071eULL, 0x89b3d69ULL, 0xe7326fddULL, 0xadbc7d64ULL, 0xd9fa2572ULL, 0x89b3d69ULL},
+{0xf1b3071eULL, 0x89b3d69ULL, 0xe7326fddULL, 0xadbc7d64ULL, 0xd9fa2572ULL, 0x89b3d69ULL, 0x5180dee0ULL, 0x515e8c43ULL, 0xd9fa2572ULL},
+{0xadbc7d64ULL, 0xd9fa2572ULL, 0x89b3d69ULL, 0x5180dee0ULL, 0x515e8c43ULL, 0xd9fa2572ULL, 0xd19cbc06ULL, 0x19f2e2afULL, 0x515e8c43ULL},
+{0x5180dee0ULL, 0x515e8c43ULL, 0xd9fa2572ULL, 0xd19cbc06ULL, 0x19f2e2afULL, 0x515e8c43ULL, 0xf4767d8eULL, 0x402d3819ULL, 0x19f2e2afULL},
+{0xd19cbc06ULL, 0x19f2e2afULL, 0x515e8c43ULL, 0xf4767d8eULL, 0x402d3819ULL, 0x19f2e2afULL, 0xab6c3cc6ULL, 0x2ed22301ULL, 0x402d3819ULL},
+{0xf4767d8eULL, 0x402d3819ULL, 0x19f2e2afULL, 0xab6c3cc6ULL, 0x2ed22301ULL, 0x402d3819ULL, 0x98b7d34eULL, 0x244ae91aULL, 0x2ed22301ULL},
+{0xab6c3cc6ULL, 0x2ed22301ULL, 0x402d3819ULL, 0x98b7d34eULL, 0x244ae91aULL, 0x2ed22301ULL, 0xc2d10a02ULL, 0xdfcf9a6cULL, 0x244ae91aULL},
+{0x98b7d34eULL, 0x244ae91aULL, 0x2ed22301ULL, 0xc2d10a02ULL, 0xdfcf9a6cULL, 0x244ae91aULL, 0xabdea9f8ULL, 0x8ff59011ULL, 0xdfcf9a6cULL},
+{0xc2d10a02ULL, 0xdfcf9a6cULL, 0x244ae91aULL, 0xabdea9f8ULL, 0x8ff59011ULL, 0xdfcf9a6cULL, 0xab44025bULL, 0xb86a1a20ULL, 0x8ff59011ULL},
+{0xabdea9f8ULL, 0x8ff59011ULL, 0xdfcf9a6cULL, 0xab44025bULL, 0xb86a1a20ULL, 0x8ff59011ULL, 0x98154616ULL, 0xec7af621ULL, 0xb86a1a20ULL},
+{0xab44025bULL, 0xb86a1a20ULL, 0x8ff59011ULL, 0x98154616ULL, 0xec7af621ULL, 0xb86a1a20ULL, 0xa97a1228ULL, 0x260a2eaeULL, 0xec7af621ULL},
+{0x98154616ULL, 0xec7af621ULL, 0xb86a1a20ULL, 0xa97a1228ULL, 0x260a2eaeULL, 0xec7af621ULL, 0xf7507ba8ULL, 0x7e8c5343ULL, 0x260a2eaeULL},
+{0xa97a1228ULL, 0x260a2eaeULL, 0xec7af621ULL, 0xf7507ba8ULL, 0x7e8c5343ULL, 0x260a2eaeULL, 0x97f99eabULL, 0xf4fdeec2ULL, 0x7e8c5343ULL},
+{0xf7507ba8ULL, 0x7e8c5343ULL, 0x260a2eaeULL, 0x97f99eabULL, 0xf4fdeec2ULL, 0x7e8c5343ULL, 0xde1fdc99ULL, 0x7ea43105ULL, 0xf4fdeec2ULL},
+{0x97f99eabULL, 0xf4fdeec2ULL, 0x7e8c5343ULL, 0xde1fdc99ULL, 0x7ea43105ULL, 0xf4fdeec2ULL, 0x81721585ULL, 0x941d312bULL, 0x7ea43105ULL},
+{0xde1fdc99ULL, 0x7ea43105ULL, 0xf4fdeec2ULL, 0x81721585ULL, 0x941d312bULL, 0x7ea43105ULL, 0x9ff8b7f2ULL, 0x8c617786ULL, 0x941d312bULL},
+{0x81721585ULL, 0x941d312bULL, 0x7ea43105ULL, 0x9ff8b7f2ULL, 0x8c617786ULL, 0x941d312bULL, 0xb9a1c440ULL, 0x8e69648cULL, 0x8c617786ULL},
+{0x9ff8b7f2ULL, 0x8c617786ULL, 0x941d312bULL, 0xb9a1c440ULL, 0x8e69648cULL, 0x8c617786ULL, 0x5df6b263ULL, 0x44792dfULL, 0x8e69648cULL},
+{0xb9a1c440ULL, 0x8e69648cULL, 0x8c617786ULL, 0x5df6b263ULL, 0x44792dfULL, 0x8e69648cULL, 0x81632dd3ULL, 0xe0348f48ULL, 0x44792dfULL},
+{0x5df6b263ULL, 0x44792dfULL, 0x8e69648cULL, 0x81632dd3ULL, 0xe0348f48ULL, 0x44792dfULL, 0xf495ca56ULL, 0x555933bfULL, 0xe0348f48ULL},
+{0x81632dd3ULL, 0xe0348f48ULL, 0x44792dfULL, 0xf495ca56ULL, 0x555933bfULL, 0xe0348f48ULL, 0xc389574aULL, 0x2ebb09f1ULL, 0x555933bfULL},
+{0xf495ca56ULL, 0x555933bfULL, 0xe0348f48ULL, 0xc389574aULL, 0x2ebb09f1ULL, 0x555933bfULL, 0x75d6fda5ULL, 0xa4f7bd25ULL, 0x2ebb09f1ULL},
+{0xc389574aULL, 0x2ebb09f1ULL, 0x555933bfULL, 0x75d6fda5ULL, 0xa4f7bd25ULL, 0x2ebb09f1ULL, 0x7fb48a00ULL, 0xd4629b5ULL, 0xa4f7bd25ULL},
+{0x75d6fda5ULL, 0xa4f7bd25ULL, 0x2ebb09f1ULL, 0x7fb48a00ULL, 0xd4629b5ULL, 0xa4f7bd25ULL, 0xa3cae6d2ULL, 0xc9423566ULL, 0xd4629b5ULL},
+{0x7fb48a00ULL, 0xd4629b5ULL, 0xa4f7bd25ULL, 0xa3cae6d2ULL, 0xc9423566ULL, 0xd4629b5ULL, 0x4017ade2ULL, 0xdd579228ULL, 0xc9423566ULL},
+{0xa3cae6d2ULL, 0xc9423566ULL, 0xd4629b5ULL, 0x4017ade2ULL, 0xdd579228ULL, 0xc9423566ULL, 0xc3ab8858ULL, 0xe5f01dd1ULL, 0xdd579228ULL},
+{0x4017ade2ULL, 0xdd579228ULL, 0xc9423566ULL, 0xc3ab8858ULL, 0xe5f01dd1ULL, 0xdd579228ULL, 0x5e5d6776ULL, 0x9ee593b0ULL, 0xe5f01dd1ULL},
+{0xc3ab8858ULL, 0xe5f01dd1ULL, 0xdd579228ULL, 0x5e5d6776ULL, 0x9ee593b0ULL, 0xe5f01dd1ULL, 0x493f818ULL, 0x28e54953ULL, 0x9ee593b0ULL},
+{0x5e5d6776ULL, 0x9ee593b0ULL, 0xe5f01dd1ULL, 0x493f818ULL, 0x28e54953ULL, 0x9ee593b0ULL, 0xc132bf14ULL, 0xec9d98acULL, 0x28e54953ULL},
+{0x493f818ULL, 0x28e54953ULL, 0x9ee593b0ULL, 0xc132bf14ULL, 0xec9d98acULL, 0x28e54953ULL, 0x4dc80b8fULL, 0xc08b04a4ULL, 0xec9d98acULL},
+{0xc132bf14ULL, 0xec9d98acULL, 0x28e54953ULL, 0x4dc80b8fULL, 0xc08b04a4ULL, 0xec9d98acULL, 0x81b8c644ULL, 0xe90095b3ULL, 0xc08b04a4ULL},
+{0x4dc80b8fULL, 0xc08b04a4ULL, 0xec9d98acULL, 0x81b8c644ULL, 0xe90095b3ULL, 0xc08b04a4ULL, 0x3706fa9aULL, 0xe656afc2ULL, 0xe90095b3ULL},
+{0x81b8c644ULL, 0xe90095b3ULL, 0xc08b04a4ULL, 0x3706fa9aULL, 0xe656afc2ULL, 0xe90095b3ULL, 0x92eb640fULL, 0xe90a0e0fULL, 0xe656afc2ULL},
+{0x3706fa9aULL, 0xe656afc2ULL, 0xe90095b3ULL, 0x92eb640fULL, 0xe90a0e0fULL, 0xe656afc2ULL, 0x26b92babULL, 0x1a003e8dULL, 0xe90a0e0fULL},
+{0x92eb640fULL, 0xe90a0e0fULL, 0xe656afc2ULL, 0x26b92babULL, 0x1a003e8dULL, 0xe90a0e0fULL, 0x6bd4292aULL, 0xab13606bULL, 0x1a003e8dULL},
+{0x26b92babULL, 0x1a003e8dULL, 0xe90a0e0fULL, 0x6bd4292aULL, 0xab13606bULL, 0x1a003e8dULL, 0x692cf0e1ULL, 0xc1401a52ULL, 0xab13606bULL},
+{0x6bd4292aULL, 0xab13606bULL, 0x1a003e8dULL, 0x692cf0e1ULL, 0xc1401a52ULL, 0xab13606bULL, 0x4d458ba3ULL, 0x5ca4c50ULL, 0xc1401a52ULL},
+{0x692cf0e1ULL, 0xc1401a52ULL, 0xab13606bULL, 0x4d458ba3ULL, 0x5ca4c50ULL, 0xc1401a52ULL, 0x10c64c2aULL, 0xf92bcaefULL, 0x5ca4c50ULL},
+{0x4d458ba3ULL, 0x5ca4c50ULL, 0xc1401a52ULL, 0x10c64c2aULL, 0xf92bcaefULL, 0x5ca4c50ULL, 0xe4aafc3eULL, 0x57e4b48cULL, 0xf92bcaefULL},
+{0x10c64c2aULL, 0xf92bcaefULL, 0x5ca4c50ULL, 0xe4aafc3eULL, 0x57e4b48cULL, 0xf92bcaefULL, 0x8ec3d19aULL, 0xb97ab62dULL, 0x57e4b48cULL},
+{0xe4aafc3eULL, 0x57e4b48cULL, 0xf92bcaefULL, 0x8ec3d19aULL, 0xb97ab62dULL, 0x57e4b48cULL, 0xe46949a1ULL, 0xa2f72f52ULL, 0xb97ab62dULL},
+{0x8ec3d19aULL, 0xb97ab62dULL, 0x57e4b48cULL, 0xe46949a1ULL, 0xa2f72f52ULL, 0xb97ab62dULL, 0x48791f74ULL, 0xe851cbf3ULL, 0xa2f72f52ULL},
+{0xe46949a1ULL, 0xa2f72f52ULL, 0xb97ab62dULL, 0x48791f74ULL, 0xe851cbf3ULL, 0xa2f72f52ULL, 0x4e5720dfULL, 0x3c734435ULL, 0xe851cbf3ULL},
+{0x48791f74ULL, 0xe851cbf3ULL, 0xa2f72f52ULL, 0x4e5720dfULL, 0x3c734435ULL, 0xe851cbf3ULL, 0xd46d9f21ULL, 0x93a89b85ULL, 0x3c734435ULL},
+{0x4e5720dfULL, 0x3c734435ULL, 0xe851cbf3ULL, 0xd46d9f21ULL, 0x93a89b85ULL, 0x3c734435ULL, 0xafa03457ULL, 0x8fcba006ULL, 0x93a89b85ULL},
+{0xd46d9f21ULL, 0x93a89b85ULL, 0x3c734435ULL, 0xafa03457ULL, 0x8fcba006ULL, 0x93a89b85ULL, 0xf608eff2ULL, 0xbbd64878ULL, 0x8fcba006ULL},
+{0xafa03457ULL, 0x8fcba006ULL, 0x93a89b85ULL, 0xf608eff2ULL, 0xbbd64878ULL, 0x8fcba006ULL, 0x64c081c5ULL, 0xa253153ULL, 0xbbd64878ULL},
+{0xf608eff2ULL, 0xbbd64878ULL, 0x8fcba006ULL, 0x64c081c5ULL, 0xa253153ULL, 0xbbd64878ULL, 0xaa293161ULL, 0xecbbadaULL, 0xa253153ULL},
+{0x64c081c5ULL, 0xa253153ULL, 0xbbd64878ULL, 0xaa293161ULL, 0xecbbadaULL, 0xa253153ULL, 0xd5e45ba6ULL, 0x90662c1dULL, 0xecbbadaULL},
+{0xaa293161ULL, 0xecbbadaULL, 0xa253153ULL, 0xd5e45ba6ULL, 0x90662c1dULL, 0xecbbadaULL, 0x5f53017ULL, 0x63c48c40ULL, 0x90662c1dULL},
+{0xd5e45ba6ULL, 0x90662c1dULL, 0xecbbadaULL, 0x5f53017ULL, 0x63c48c40ULL, 0x90662c1dULL, 0x882701f5ULL, 0x77f65d9ULL, 0x63c48c40ULL},
+{0x5f53017ULL, 0x63c48c40ULL, 0x90662c1dULL, 0x882701f5ULL, 0x77f65d9ULL, 0x63c48c40ULL, 0xd371c98cULL, 0xb6a0ef2dULL, 0x77f65d9ULL},
+{0x882701f5ULL, 0x77f65d9ULL, 0x63c48c40ULL, 0xd371c98cULL, 0xb6a0ef2dULL, 0x77f65d9ULL, 0xa6ae4bc7ULL, 0x707c87bcULL, 0xb6a0ef2dULL},
+{0xd371c98cULL, 0xb6a0ef2dULL, 0x77f65d9ULL, 0xa6ae4bc7ULL, 0x707c87bcULL, 0xb6a0ef2dULL, 0x290441f8ULL, 0x1310d27cULL, 0x707c87bcULL},
+{0xa6ae4bc7ULL, 0x707c87bcULL, 0xb6a0ef2dULL, 0x290441f8ULL, 0x1310d27cULL, 0x707c87bcULL, 0xf40de525ULL, 0x7ec698b5ULL, 0x1310d27cULL},
+{0x290441f8ULL, 0x1310d27cULL, 0x707c87bcULL, 0xf40de525ULL, 0x7ec698b5ULL, 0x1310d27cULL, 0xace72904ULL, 0x31092d9aULL, 0x7ec698b5ULL},
+{0xf40de525ULL, 0x7ec698b5ULL, 0x1310d27cULL, 0xace72904ULL, 0x31092d9aULL, 0x7ec698b5ULL, 0x276c579ULL, 0x917be9f6ULL, 0x31092d9aULL},
+{0xace72904ULL, 0x31092d9aULL, 0x7ec698b5ULL, 0x276c579ULL, 0x917be9f6ULL, 0x31092d9aULL, 0xbc8e314ULL, 0x93116963ULL, 0x917be9f6ULL},
+{0x276c579ULL, 0x917be9f6ULL, 0x31092d9aULL, 0xbc8e314ULL, 0x93116963ULL, 0x917be9f6ULL, 0xaa865221ULL, 0x6cc6562eULL, 0x93116963ULL},
+{0xbc8e314ULL, 0x93116963ULL, 0x917be9f6ULL, 0xaa865221ULL, 0x6cc6562eULL, 0x93116963ULL, 0x5d14d241ULL, 0x901d2dc4ULL, 0x6cc6562eULL},
+{0xaa865221ULL, 0x6cc6562eULL, 0x93116963ULL, 0x5d14d241ULL, 0x901d2dc4ULL, 0x6cc6562eULL, 0x8a2a6eb0ULL, 0x779f12d8ULL, 0x901d2dc4ULL},
+{0x5d14d241ULL, 0x901d2dc4ULL, 0x6cc6562eULL, 0x8a2a6eb0ULL, 0x779f12d8ULL, 0x901d2dc4ULL, 0x83e111d4ULL, 0x3f77050bULL, 0x779f12d8ULL},
+{0x8a2a6eb0ULL, 0x779f12d8ULL, 0x901d2dc4ULL, 0x83e111d4ULL, 0x3f77050bULL, 0x779f12d8ULL, 0x48137d12ULL, 0xce63ea20ULL, 0x3f77050bULL},
+{0x83e111d4ULL, 0x3f77050bULL, 0x779f12d8ULL, 0x48137d12ULL, 0xce63ea20ULL, 0x3f77050bULL, 0x89446c2cULL, 0x99ce6cafULL, 0xce63ea20ULL},
+{0x48137d12ULL, 0xce63ea20ULL, 0x3f77050bULL, 0x89446c2cULL, 0x99ce6cafULL, 0xce63ea20ULL, 0x43d7a05dULL, 0xbc4e531bULL, 0x99ce6cafULL},
+{0x89446c2cULL, 0x99ce6cafULL, 0xce63ea20ULL, 0x43d7a05dULL, 0xbc4e531bULL, 0x99ce6cafULL, 0xb2bfdf45ULL, 0xa54c3120ULL, 0xbc4e531bULL},
+{0x43d7a05dULL, 0xbc4e531bULL, 0x99ce6cafULL, 0xb2bfdf45ULL, 0xa54c3120ULL, 0xbc4e531bULL, 0xa9cef74cULL, 0x48c19909ULL, 0xa54c3120ULL},
+{0xb2bfdf45ULL, 0xa54c3120ULL, 0xbc4e531bULL, 0xa9cef74cULL, 0x48c19909ULL, 0xa54c3120ULL, 0xe4e44c35ULL, 0xad0481e7ULL, 0x48c19909ULL},
+{0xa9cef74cULL, 0x48c19909ULL, 0xa54c3120ULL, 0xe4e44c35ULL, 0xad0481e7ULL, 0x48c19909ULL, 0xcb11333bULL, 0xf238c89ULL, 0xad0481e7ULL},
+{0xe4e44c35ULL, 0xad0481e7ULL, 0x48c19909ULL, 0xcb11333bULL, 0xf238c89ULL, 0xad0481e7ULL, 0x6e900e5dULL, 0x6bee7201ULL, 0xf238c89ULL},
+{0xcb11333bULL, 0xf238c89ULL, 0xad0481e7ULL, 0x6e900e5dULL, 0x6bee7201ULL, 0xf238c89ULL, 0xa3297010ULL, 0xcd21b053ULL, 0x6bee7201ULL},
+{0x6e900e5dULL, 0x6bee7201ULL, 0xf238c89ULL, 0xa3297010ULL, 0xcd21b053ULL, 0x6bee7201ULL, 0x45be4217ULL, 0x2edbf5cULL, 0xcd21b053ULL},
+{0xa3297010ULL, 0xcd21b053ULL, 0x6bee7201ULL, 0x45be4217ULL, 0x2edbf5cULL, 0xcd21b053ULL, 0x6ebdfe57ULL, 0x624fd275ULL, 0x2edbf5cULL}},
+  {{0x45be4217ULL, 0x2edbf5cULL, 0xcd21b053ULL, 0x6ebdfe57ULL, 0x624fd275ULL, 0x2edbf5cULL, 0x13d93875ULL, 0xb951d2f0ULL, 0x624fd275ULL},
+{0x89087a52ULL, 0x88eb2566ULL, 0x336afb70ULL, 0x5371b62cULL, 0x3b688a79ULL, 0x88eb2566ULL, 0xccfbd677ULL, 0x58556b74ULL, 0x3b688a79ULL},
+{0x18e637e1ULL, 0x90388169ULL, 0x864c4fd5ULL, 0x823f173aULL, 0xe7a43a8dULL, 0x90388169ULL, 0x76a99a5aULL, 0x78ca4a5aULL, 0xe7a43a8dULL},
+{0xf723ad80ULL, 0x1b58777dULL, 0x3c0aa3ebULL, 0xfcc8c3d5ULL, 0xed342e7cULL, 0x1b58777dULL, 0x2103a31fULL, 0x8259689aULL, 0xed342e7cULL},
+{0x3fd864f2ULL, 0xec603cefULL, 0x6aee59c4ULL, 0x59a0b9bfULL, 0xdc6f26a4ULL, 0xec603cefULL, 0x8de1bb33ULL, 0xd9487255ULL, 0xdc6f26a4ULL},
+{0x44522b9bULL, 0xb9f2fa13ULL, 0xed0d7eb5ULL, 0x3d689634ULL, 0x65bc0348ULL, 0xb9f2fa13ULL, 0x83c06434ULL, 0xf7a667adULL, 0x65bc0348ULL},
+{0x86e430cfULL, 0x6bb2d113ULL, 0xb5d5dc39ULL, 0x557b09e8ULL, 0xba39e4f6ULL, 0x6bb2d113ULL, 0xec09d778ULL, 0xa5488b0eULL, 0xba39e4f6ULL},
+{0xd85dd475ULL, 0x7efc0fdeULL, 0x11735fe1ULL, 0x53003f67ULL, 0x4d7187cfULL, 0x7efc0fdeULL, 0x9a539ddbULL, 0x4890233eULL, 0x4d7187cfULL},
+{0x75f32ea0ULL, 0x22ebc5c5ULL, 0x65a4420eULL, 0x7638764eULL, 0x9004aee2ULL, 0x22ebc5c5ULL, 0x8119bf78ULL, 0xf6ccdbc0ULL, 0x9004aee2ULL},
+{0xe4ff9431ULL, 0x3889a67dULL, 0xf26bba40ULL, 0xfb6b5e83ULL, 0xdf09906aULL, 0x3889a67dULL, 0x6808372eULL, 0x2b8ef38dULL, 0xdf09906aULL},
+{0x4dce6137ULL, 0x7f92e2e0ULL, 0xe735947dULL, 0xcbf06c8dULL, 0x86aedbbeULL, 0x7f92e2e0ULL, 0xcc0bb4a1ULL, 0xf2d666daULL, 0x86aedbbeULL},
+{0x8b94159fULL, 0x530c10d4ULL, 0xc9d4f4dfULL, 0x62adcae9ULL, 0x15704332ULL, 0x530c10d4ULL, 0x81ac2a95ULL, 0xc59200c6ULL, 0x15704332ULL},
+{0x6d76a406ULL, 0x4508a658ULL, 0x7cebc010ULL, 0x34266c93ULL, 0x91f68af2ULL, 0x4508a658ULL, 0x743bba40ULL, 0x25501211ULL, 0x91f68af2ULL},
+{0xba0cbad6ULL, 0xbf59d1dcULL, 0x3f5ad85cULL, 0x136a49b1ULL, 0xa23977a4ULL, 0xbf59d1dcULL, 0xbdae79c9ULL, 0xe634047ULL, 0xa23977a4ULL},
+{0xfb5c4d72ULL, 0x2567b072ULL, 0x217f3329ULL, 0x88b246d6ULL, 0x749b8aa5ULL, 0x2567b072ULL, 0xc06c7605ULL, 0x6bcf14c8ULL, 0x749b8aa5ULL},
+{0x353115afULL, 0x77290083ULL, 0xb1935f4aULL, 0x76fb09d2ULL, 0x80129927ULL, 0x77290083ULL, 0xe9cff80eULL, 0x63029d2ULL, 0x80129927ULL},
+{0x5a7eff4bULL, 0x60ecad6fULL, 0x33bf919cULL, 0xed921f85ULL, 0xa2cd5645ULL, 0x60ecad6fULL, 0x1ccd2cb1ULL, 0x5beb2b1dULL, 0xa2cd5645ULL},
+{0x43494bc1ULL, 0xf2ba0f19ULL, 0x3e588b41ULL, 0x731e4494ULL, 0x268f965fULL, 0xf2ba0f19ULL, 0xf717b4c2ULL, 0xba2c417ULL, 0x268f965fULL},
+{0x879bb9d8ULL, 0xfce0c74bULL, 0x8ea2005bULL, 0x3729bcbfULL, 0x6bee970eULL, 0xfce0c74bULL, 0xe99fe59eULL, 0x692db2e2ULL, 0x6bee970eULL},
+{0xfb7b20d9ULL, 0x29881cefULL, 0x7185c2b7ULL, 0xdc39d10cULL, 0xbd19d3ebULL, 0x29881cefULL, 0x52e91f1ULL, 0x1a9b34ccULL, 0xbd19d3ebULL},
+{0xfd57d41fULL, 0xdf9db19fULL, 0x912972faULL, 0xd0c5ef3dULL, 0x39cfed34ULL, 0xdf9db19fULL, 0x15983aadULL, 0xf5711e1cULL, 0x39cfed34ULL},
+{0xa60d3efULL, 0xd4c5c5e2ULL, 0x3f5d17d2ULL, 0x448b5be5ULL, 0x17292e95ULL, 0xd4c5c5e2ULL, 0x3f1ec759ULL, 0xb3ca90fcULL, 0x17292e95ULL},
+{0xe97a3622ULL, 0x6c040b09ULL, 0x553f0b03ULL, 0x1151f889ULL, 0x8b6710bdULL, 0x6c040b09ULL, 0x1799c8dcULL, 0xfff97212ULL, 0x8b6710bdULL},
+{0x56f667a6ULL, 0xb6d358acULL, 0xbcf96391ULL, 0x792df8d8ULL, 0x9922c291ULL, 0xb6d358acULL, 0x86a20770ULL, 0x91b2ffb8ULL, 0x9922c291ULL},
+{0x28a71c83ULL, 0x53540ea5ULL, 0xbb9eed77ULL, 0x73cc3786ULL, 0x47444e9aULL, 0x53540ea5ULL, 0xeb6c8fc2ULL, 0xacd147c5ULL, 0x47444e9aULL},
+{0x9dbbe11dULL, 0x3706c0b1ULL, 0x4dfdd977ULL, 0xe7718b87ULL, 0xdc498788ULL, 0x3706c0b1ULL, 0x9ca8a360ULL, 0xee777932ULL, 0xdc498788ULL},
+{0x302e14fULL, 0x60a3884dULL, 0xd4c6054dULL, 0x2e9801eeULL, 0xc079fb0fULL, 0x60a3884dULL, 0xf8543189ULL, 0x120ab53fULL, 0xc079fb0fULL},
+{0x601377c5ULL, 0x99677053ULL, 0x2a71fc6fULL, 0xd721cb43ULL, 0x764ff615ULL, 0x99677053ULL, 0xb5126abfULL, 0x94e3e849ULL, 0x764ff615ULL},
+{0xc6ba61bbULL, 0x54ea8b8aULL, 0x8dc319d6ULL, 0xa814461cULL, 0xd2f0a9bfULL, 0x54ea8b8aULL, 0x5e634156ULL, 0x9a38a429ULL, 0xd2f0a9bfULL},
+{0x24d2bc59ULL, 0x8ade1f93ULL, 0xa79c6a37ULL, 0xaa0ec05fULL, 0xc1a12c53ULL, 0x8ade1f93ULL, 0x16bce8d3ULL, 0x3ecbe5a2ULL, 0xc1a12c53ULL},
+{0x400d41ddULL, 0xf563bb47ULL, 0xf0b3eb3ULL, 0x4bcd83bdULL, 0x19fb7623ULL, 0xf563bb47ULL, 0x2dd7e322ULL, 0x3a2c0fbfULL, 0x19fb7623ULL},
+{0x5e887c48ULL, 0x7e044aa7ULL, 0xc12a4f9bULL, 0xa58a0f9fULL, 0x53799abeULL, 0x7e044aa7ULL, 0xb3e64ffcULL, 0x1fe86d38ULL, 0x53799abeULL},
+{0x8fb0dd02ULL, 0xec4166fULL, 0x8a09bfeeULL, 0x4e168d0eULL, 0xc045f144ULL, 0xec4166fULL, 0x9045c7cdULL, 0x2f7e2b30ULL, 0xc045f144ULL},
+{0x64cc3c40ULL, 0xe9cf28dcULL, 0x5a7099aeULL, 0x79cd6f51ULL, 0x1092799aULL, 0xe9cf28dcULL, 0x17b8d2fcULL, 0x5edeab7bULL, 0x1092799aULL},
+{0x3cfb2d77ULL, 0xb8a82addULL, 0x745a59e4ULL, 0x25d5b4d1ULL, 0x80340493ULL, 0xb8a82addULL, 0xde370de0ULL, 0xf3d26665ULL, 0x80340493ULL},
+{0x783d84f4ULL, 0x24b63f05ULL, 0x4246bdfcULL, 0xbb3ef4dULL, 0x90e3874ULL, 0x24b63f05ULL, 0xda0446d0ULL, 0xa58d300aULL, 0x90e3874ULL},
+{0x7e0150d8ULL, 0xee0f15d0ULL, 0x8de580f1ULL, 0x11c590abULL, 0x5765d861ULL, 0xee0f15d0ULL, 0xa92d91d9ULL, 0xfe342578ULL, 0x5765d861ULL},
+{0x8cf8750fULL, 0x40c31267ULL, 0x1477373cULL, 0x160f37e3ULL, 0x7ab5b46fULL, 0x40c31267ULL, 0xcf136f00ULL, 0xf1cebc87ULL, 0x7ab5b46fULL},
+{0x45278075ULL, 0xc7ffad12ULL, 0xae5ff324ULL, 0x5133542bULL, 0xc27e4e8ULL, 0xc7ffad12ULL, 0xba02a5eeULL, 0x4ec2d77fULL, 0xc27e4e8ULL},
+{0xef2b98faULL, 0x237a5502ULL, 0xd28c07deULL, 0x5f7eed01ULL, 0x3cdab228ULL, 0x237a5502ULL, 0xf06dea0cULL, 0x101e828dULL, 0x3cdab228ULL},
+{0xc1a2d8acULL, 0x95d1a9e1ULL, 0x7a95e705ULL, 0x440beafULL, 0xd528f840ULL, 0x95d1a9e1ULL, 0x41285389ULL, 0xd4413be4ULL, 0xd528f840ULL},
+{0x57696f0dULL, 0xde2e52b8ULL, 0x677ec5a2ULL, 0x60de27e0ULL, 0x13b34122ULL, 0xde2e52b8ULL, 0xba418bc5ULL, 0x9167e79fULL, 0x13b34122ULL},
+{0x999f2704ULL, 0xc2026a7bULL, 0xfae63c7eULL, 0x3554f1d1ULL, 0x3738b43bULL, 0xc2026a7bULL, 0x454aee5eULL, 0x78894f1bULL, 0x3738b43bULL},
+{0xe4188176ULL, 0x84d188b0ULL, 0xeda578fbULL, 0x2a7a13ecULL, 0xea8781f2ULL, 0x84d188b0ULL, 0x446e1870ULL, 0xb675a6bcULL, 0xea8781f2ULL},
+{0xf165a962ULL, 0x974f7aa9ULL, 0xb2b2248cULL, 0xe786b966ULL, 0xfb0af3b0ULL, 0x974f7aa9ULL, 0xeb0a9d95ULL, 0x8e16edeULL, 0xfb0af3b0ULL},
+{0xedb2fe42ULL, 0xc6ba88e6ULL, 0xd784a6bULL, 0x221d3ac6ULL, 0xbc8c7812ULL, 0xc6ba88e6ULL, 0xf6106964ULL, 0x9839c056ULL, 0xbc8c7812ULL},
+{0xe85950f8ULL, 0xab0bba16ULL, 0x366eeb0aULL, 0xea8f91eeULL, 0x1aa9d3dcULL, 0xab0bba16ULL, 0xef43cb69ULL, 0xb1b60f0dULL, 0x1aa9d3dcULL},
+{0x167c0286ULL, 0x417d11bbULL, 0x522667ceULL, 0x922e9b6eULL, 0xdb2dec14ULL, 0x417d11bbULL, 0xe2cbdc53ULL, 0xec2f1e52ULL, 0xdb2dec14ULL},
+{0x53913a89ULL, 0x184224aaULL, 0xeb682b23ULL, 0x5ad48da0ULL, 0xefe077beULL, 0x184224aaULL, 0x1ab5a58ULL, 0x92300622ULL, 0xefe077beULL},
+{0xe5f8402bULL, 0xfb92fe2eULL, 0xfaafff60ULL, 0x2e577cd0ULL, 0xe2f4cab0ULL, 0xfb92fe2eULL, 0x155ff9a8ULL, 0xb67df32aULL, 0xe2f4cab0ULL},
+{0x2bf811d0ULL, 0xf57c32c0ULL, 0x953c4b00ULL, 0x13eed229ULL, 0xec7e841aULL, 0xf57c32c0ULL, 0x8220381bULL, 0x2abe0d3ULL, 0xec7e841aULL},
+{0xb3cf6c18ULL, 0xe8cc72feULL, 0xaf4b1e35ULL, 0x1d6ec7d6ULL, 0xfcd8b44ULL, 0xe8cc72feULL, 0x87675cacULL, 0x39ecdd43ULL, 0xfcd8b44ULL},
+{0xb87400afULL, 0x8ba556b7ULL, 0xcd95a787ULL, 0xda6c4bacULL, 0x75d68f31ULL, 0x8ba556b7ULL, 0xa63bdbc2ULL, 0x44c72faULL, 0x75d68f31ULL},
+{0x63adc5ccULL, 0x2c4e924aULL, 0x8ec1cc0eULL, 0xe12826ddULL, 0x3f63846fULL, 0x2c4e924aULL, 0x21dcc614ULL, 0xf686ed10ULL, 0x3f63846fULL},
+{0xdb46239cULL, 0xa3a7588ULL, 0x2007859bULL, 0xf198855dULL, 0x760577b9ULL, 0xa3a7588ULL, 0xc1163ee7ULL, 0x4e0bfd4dULL, 0x760577b9ULL},
+{0x652a1c6aULL, 0xf225a6d1ULL, 0xf1fc9915ULL, 0xbc579a0aULL, 0x514d5803ULL, 0xf225a6d1ULL, 0xdf4680eeULL, 0xe6bf9152ULL, 0x514d5803ULL},
+{0xb93b250eULL, 0x82dfd339ULL, 0xdf542596ULL, 0xea1956f2ULL, 0xb725bd7aULL, 0x82dfd339ULL, 0x49c3e0e5ULL, 0x108b631cULL, 0xb725bd7aULL},
+{0x2cfb03afULL, 0xf821dbd7ULL, 0x416c36baULL, 0x66895ddcULL, 0x88d6211eULL, 0xf821dbd7ULL, 0x5ab9cd54ULL, 0xbe0367ebULL, 0x88d6211eULL},
+{0xcee5fb4cULL, 0x42c1fdcfULL, 0x6ba5297cULL, 0xd707b449ULL, 0xade3f52aULL, 0x42c1fdcfULL, 0x5ca9c110ULL, 0x720100dULL, 0xade3f52aULL},
+{0x779598c7ULL, 0x27949c1ULL, 0x6f8515f2ULL, 0x596f40bULL, 0x4cdfd509ULL, 0x27949c1ULL, 0xc3db4e8dULL, 0x1c3348b2ULL, 0x4cdfd509ULL},
+{0x12edd8d3ULL, 0x32cfa88eULL, 0x9ba150b6ULL, 0xeb803b5dULL, 0xd25fa7f9ULL, 0x32cfa88eULL, 0xcb41ef4dULL, 0xee93e2eULL, 0xd25fa7f9ULL},
+{0xebbd57d4ULL, 0xf553c7caULL, 0x9b20a44aULL, 0xb48138f5ULL, 0xe0670677ULL, 0xf553c7caULL, 0x8191133fULL, 0x3151cc6ULL, 0xe0670677ULL},
+{0xcd155e8aULL, 0x3f881ba2ULL, 0xbfc4438eULL, 0xf31be144ULL, 0x7ceecd40ULL, 0x3f881ba2ULL, 0x2467d511ULL, 0x3f221964ULL, 0x7ceecd40ULL},
+{0x82725649ULL, 0x6a49f2b8ULL, 0xd52f7d8fULL, 0x71bea0b5ULL, 0x169a4995ULL, 0x6a49f2b8ULL, 0x210b0131ULL, 0xee783d7ULL, 0x169a4995ULL},
+{0x928bf600ULL, 0xa287e736ULL, 0x98c0507ULL, 0xb28e739dULL, 0xf9ae7a4bULL, 0xa287e736ULL, 0xf0ff259fULL, 0x56a0724fULL, 0xf9ae7a4bULL},
+{0x2de3acdfULL, 0xbcfb200ULL, 0x8f471f20ULL, 0x8ef7004cULL, 0x706afb91ULL, 0xbcfb200ULL, 0xaff36582ULL, 0xd6003d22ULL, 0x706afb91ULL},
+{0xf9a7588bULL, 0x4a9f61caULL, 0xfcf3a401ULL, 0x92f44e75ULL, 0x23d80afbULL, 0x4a9f61caULL, 0x413d8d5dULL, 0x692887fdULL, 0x23d80afbULL},
+{0x2204f4ddULL, 0xd3775a40ULL, 0x571a5593ULL, 0x5e62c591ULL, 0xbcca76bULL, 0xd3775a40ULL, 0x455affa2ULL, 0x8b190496ULL, 0xbcca76bULL},
+{0xd493bb36ULL, 0xe83ed73bULL, 0xb375ee83ULL, 0xda534638ULL, 0x10f1fceaULL, 0xe83ed73bULL, 0x5417b5bcULL, 0x254b8f19ULL, 0x10f1fceaULL},
+{0x97970b6aULL, 0x874bc98ULL, 0xf002454bULL, 0x5f83af12ULL, 0x897e858fULL, 0x874bc98ULL, 0xa17fdee4ULL, 0x6460f8ecULL, 0x897e858fULL},
+{0x3c0ae308ULL, 0x7c27e0e8ULL, 0x68ad6950ULL, 0x824bfd90ULL, 0x93b5a006ULL, 0x7c27e0e8ULL, 0x478112faULL, 0xae381249ULL, 0x93b5a006ULL},
+{0x288535c9ULL, 0x7d2c992bULL, 0x7ec4d69eULL, 0xc2672d76ULL, 0x658ec8d1ULL, 0x7d2c992bULL, 0xfc633288ULL, 0xbfa72033ULL, 0x658ec8d1ULL},
+{0x5033d279ULL, 0xc7448b5fULL, 0x8c00577aULL, 0xe053f9c4ULL, 0x7b3e7d57ULL, 0xc7448b5fULL, 0xae644c21ULL, 0x14c6d84dULL, 0x7b3e7d57ULL},
+{0x2c553430ULL, 0x4c73a17cULL, 0x5d1418a9ULL, 0x19238bf5ULL, 0xe585c200ULL, 0x4c73a17cULL, 0xad15fe9cULL, 0x63503b21ULL, 0xe585c200ULL},
+{0xf73838f5ULL, 0x5bb9b632ULL, 0x8f0a5f05ULL, 0x15d568b4ULL, 0x235c207fULL, 0x5bb9b632ULL, 0x20d6241aULL, 0x5005b906ULL, 0x235c207fULL},
+{0x6f5d134bULL, 0xf4357e09ULL, 0x794c4067ULL, 0x9a2c32dULL, 0x66c2e703ULL, 0xf4357e09ULL, 0x193013ddULL, 0xee86043dULL, 0x66c2e703ULL},
+{0x90ab872dULL, 0x1cc07e98ULL, 0x84dcbcecULL, 0xaa484895ULL, 0x116f12ceULL, 0x1cc07e98ULL, 0x52cf1461ULL, 0xe07ee9acULL, 0x116f12ceULL},
+{0x9def0d4aULL, 0x9a9f5bc3ULL, 0xa1f68a66ULL, 0x2e955ed6ULL, 0x9b8d5c3ULL, 0x9a9f5bc3ULL, 0x8a59f8dULL, 0x492a0fb4ULL, 0x9b8d5c3ULL},
+{0xa5ff613fULL, 0x9aeac0a5ULL, 0x5a76a32ULL, 0x6cb84c1eULL, 0xd566edbeULL, 0x9aeac0a5ULL, 0x5aac3d08ULL, 0x3cffcd73ULL, 0xd566edbeULL},
+{0x8617f767ULL, 0x871bbc62ULL, 0x79a0440cULL, 0xb8698e95ULL, 0xd1418702ULL, 0x871bbc62ULL, 0x85c4c28cULL, 0xea0cd618ULL, 0xd1418702ULL},
+{0xaf9c8097ULL, 0x41271265ULL, 0x80f2886bULL, 0xac02c54bULL, 0x7caa024ULL, 0x41271265ULL, 0xbc883aebULL, 0x390e4a06ULL, 0x7caa024ULL},
+{0xf1decd97ULL, 0xdfa84e63ULL, 0x45d04a85ULL, 0xbee28af2ULL, 0x975e4915ULL, 0xdfa84e63ULL, 0xcd39c549ULL, 0x2c56bbe5ULL, 0x975e4915ULL},
+{0x947c5c01ULL, 0xaea24578ULL, 0x31688179ULL, 0xc6213ba0ULL, 0xc52470c9ULL, 0xaea24578ULL, 0xdeeb41c6ULL, 0xf4d5650fULL, 0xc52470c9ULL},
+{0x27f0349aULL, 0x6cbdd064ULL, 0x3872210aULL, 0x61be4ef9ULL, 0x971b8ee7ULL, 0x6cbdd064ULL, 0xf87c2f79ULL, 0xf50e15d1ULL, 0x971b8ee7ULL},
+{0x8a7e7256ULL, 0x8254cd72ULL, 0xe07d06adULL, 0x4d473242ULL, 0xc699245cULL, 0x8254cd72ULL, 0x1939ab75ULL, 0x3e01b06ULL, 0xc699245cULL},
+{0xa9734ea9ULL, 0xc85009ccULL, 0x48431cf6ULL, 0x80299c20ULL, 0xe9d7ee93ULL, 0xc85009ccULL, 0x966725dcULL, 0x9a69b915ULL, 0xe9d7ee93ULL},
+{0xc7c95f02ULL, 0x3860018fULL, 0x9e6460fdULL, 0x74f84bbULL, 0xa93bd3f4ULL, 0x3860018fULL, 0x937eb751ULL, 0x530a95f0ULL, 0xa93bd3f4ULL},
+{0xa388075cULL, 0x42b331f4ULL, 0xe98e04ceULL, 0xeea934e1ULL, 0x6aaa8a5bULL, 0x42b331f4ULL, 0x67317eefULL, 0x3a832b04ULL, 0x6aaa8a5bULL},
+{0x16ddd730ULL, 0x6869e78aULL, 0x63db064fULL, 0xc58cc6feULL, 0xa7a0261dULL, 0x6869e78aULL, 0x9e6af6b3ULL, 0x52a59edfULL, 0xa7a0261dULL},
+{0xbc498e5dULL, 0x88103dbfULL, 0xd00e1e9bULL, 0xcc7e15fcULL, 0xf04109c8ULL, 0x88103dbfULL, 0xd049baa3ULL, 0x8bf29350ULL, 0xf04109c8ULL},
+{0x57837c78ULL, 0x750e7df8ULL, 0x3cc703e2ULL, 0xa739abc3ULL, 0xb6f69a3aULL, 0x750e7df8ULL, 0xac5e8eecULL, 0xfb5d9741ULL, 0xb6f69a3aULL},
+{0x3c494738ULL, 0x22d78bb7ULL, 0x7d551ff9ULL, 0xa47fcad3ULL, 0x2e0649e1ULL, 0x22d78bb7ULL, 0xb9684c42ULL, 0xf308607cULL, 0x2e0649e1ULL},
+{0xe01b7960ULL, 0x8fb12322ULL, 0x6b019692ULL, 0x5e3538c1ULL, 0x7ee77f87ULL, 0x8fb12322ULL, 0x114e742dULL, 0x28718afaULL, 0x7ee77f87ULL},
+{0x653d72aaULL, 0x254ba929ULL, 0xb8ed7115ULL, 0xe5041f77ULL, 0xd7c9a0eaULL, 0x254ba929ULL, 0x7becf978ULL, 0x7f886ff5ULL, 0xd7c9a0eaULL},
+{0x602d80aeULL, 0xc053e531ULL, 0x8c6c4d2eULL, 0x55d0f4bdULL, 0xb6088344ULL, 0xc053e531ULL, 0x1fede19cULL, 0x2a7b646bULL, 0xb6088344ULL},
+{0x8c0d0619ULL, 0x8b6b60bfULL, 0xd9aace51ULL, 0x5110f1a4ULL, 0x1a6cf899ULL, 0x8b6b60bfULL, 0xaab61ddfULL, 0x232bd0d8ULL, 0x1a6cf899ULL},
+{0x87257568ULL, 0x50f4f7f7ULL, 0xe0cc568eULL, 0x27830f75ULL, 0x620c65bdULL, 0x50f4f7f7ULL, 0xc2cf579ULL, 0x66dff502ULL, 0x620c65bdULL},
+{0xf64ec628ULL, 0xeb72fe81ULL, 0x6aa5784cULL, 0xf019fe14ULL, 0xb1274a22ULL, 0xeb72fe81ULL, 0x6f000f0aULL, 0x66981e8aULL, 0xb1274a22ULL},
+{0xf5c20864ULL, 0xc2fe476aULL, 0x154e834cULL, 0xb43bea7bULL, 0xe47877f7ULL, 0xc2fe476aULL, 0x8aad03daULL, 0x198db1ccULL, 0xe47877f7ULL},
+{0xd63ff6c5ULL, 0xd348f998ULL, 0xff059213ULL, 0xf45d09c9ULL, 0x79cd23d2ULL, 0xd348f998ULL, 0xfec21bafULL, 0xdd3392bdULL, 0x79cd23d2ULL},
+{0x31de8118ULL, 0xe9db54d2ULL, 0x329a8614ULL, 0x1bcc130fULL, 0x59f60c6eULL, 0xe9db54d2ULL, 0x85042cc5ULL, 0xaf304825ULL, 0x59f60c6eULL},
+{0x6590dd9ULL, 0xc3918bbbULL, 0x70a12eb1ULL, 0x8a0b2f48ULL, 0x5642f363ULL, 0xc3918bbbULL, 0xbe4f8cf4ULL, 0xf07bba36ULL, 0x5642f363ULL},
+{0xbcb5cbcfULL, 0x26e38cc9ULL, 0xaf3de208ULL, 0xd7a25bb1ULL, 0xa45f3013ULL, 0x26e38cc9ULL, 0x9921d8e2ULL, 0x2e2df1cfULL, 0xa45f3013ULL},
+{0xcb049d17ULL, 0x746aef62ULL, 0x488892b7ULL, 0x3aeb49edULL, 0xaa075f8dULL, 0x746aef62ULL, 0xfe014e73ULL, 0xab8f3764ULL, 0xaa075f8dULL},
+{0x8e2ee759ULL, 0x4a585379ULL, 0xd11a4c49ULL, 0x3c7c3847ULL, 0x515a4bfcULL, 0x4a585379ULL, 0x44b31264ULL, 0x45ea89c1ULL, 0x515a4bfcULL},
+{0x98618f23ULL, 0x30ddeb03ULL, 0x2b436d37ULL, 0xe881e2b4ULL, 0x4195feb9ULL, 0x30ddeb03ULL, 0x348662b3ULL, 0xf95f25bcULL, 0x4195feb9ULL},
+{0x2a50f112ULL, 0xdeb0da0bULL, 0x3a6ec5d7ULL, 0x16959e5dULL, 0x3035f1d9ULL, 0xdeb0da0bULL, 0xfe5d480eULL, 0xccdb06ebULL, 0x3035f1d9ULL},
+{0xa568677bULL, 0xa1613e73ULL, 0xcb1be035ULL, 0x27ea0b6dULL, 0xcaef57dfULL, 0xa1613e73ULL, 0x172f50f5ULL, 0x19a43c94ULL, 0xcaef57dfULL},
+{0x20cf2af0ULL, 0x9f632103ULL, 0x11b353d9ULL, 0x2dd390e0ULL, 0x433b1613ULL, 0x9f632103ULL, 0x959d3dfbULL, 0x66cec8aULL, 0x433b1613ULL},
+{0x4cf214fbULL, 0x43ce71f0ULL, 0x40badf16ULL, 0x412601aeULL, 0x87c6d144ULL, 0x43ce71f0ULL, 0x6525cddfULL, 0xe540a462ULL, 0x87c6d144ULL},
+{0x5385f32ULL, 0xb8baa52aULL, 0x3c7f3062ULL, 0x31fd2d8cULL, 0x18d44352ULL, 0xb8baa52aULL, 0x48f337f4ULL, 0xbc81d4f8ULL, 0x18d44352ULL},
+{0x11d42207ULL, 0xef786ecbULL, 0x2bf497b4ULL, 0x3c767eadULL, 0x1508a0dbULL, 0xef786ecbULL, 0x8736830bULL, 0x1dca08caULL, 0x1508a0dbULL},
+{0x32625a1dULL, 0x86c2444aULL, 0xd10c1705ULL, 0x1c0597ULL, 0xaa7b7fcfULL, 0x86c2444aULL, 0x5215f00fULL, 0xa530f3eULL, 0xaa7b7fcfULL},
+{0x70bd43d2ULL, 0x8d6ea645ULL, 0x3284225aULL, 0x156da1c4ULL, 0x14d50781ULL, 0x8d6ea645ULL, 0x61db94a9ULL, 0x70da3c6bULL, 0x14d50781ULL},
+{0x1fdaeac4ULL, 0x30f68774ULL, 0xdf5862d3ULL, 0x78e94736ULL, 0xe83f0776ULL, 0x30f68774ULL, 0xbf7a254aULL, 0xa1e6e579ULL, 0xe83f0776ULL},
+{0xd01a8e55ULL, 0xc0e09d80ULL, 0xe5cfffaULL, 0xd57128c0ULL, 0xdee131ebULL, 0xc0e09d80ULL, 0x51004aa7ULL, 0x74484518ULL, 0xdee131ebULL},
+{0x88c467c5ULL, 0x5b89d5feULL, 0xd8120a64ULL, 0xa9fa6fdULL, 0x97476a96ULL, 0x5b89d5feULL, 0x62fe4e8aULL, 0xea8a837dULL, 0x97476a96ULL},
+{0x62493b20ULL, 0x101a9785ULL, 0x701611b7ULL, 0x787ebae1ULL, 0x517ed4ffULL, 0x101a9785ULL, 0x896534c0ULL, 0xbdc5a582ULL, 0x517ed4ffULL},
+{0x61c3c5dcULL, 0x969f2c2ULL, 0xd73000e1ULL, 0x49234a61ULL, 0x6a891e40ULL, 0x969f2c2ULL, 0x2f61b0abULL, 0xfc047e06ULL, 0x6a891e40ULL},
+{0x498af834ULL, 0x845c0a8aULL, 0x4b73e69bULL, 0x3e0c0fa0ULL, 0xa002c8afULL, 0x845c0a8aULL, 0xbd07011dULL, 0x745d3c74ULL, 0xa002c8afULL},
+{0xbd4e4fbeULL, 0xf17814c7ULL, 0x27d4f155ULL, 0x64d9cc38ULL, 0xf84e30adULL, 0xf17814c7ULL, 0x10b15fa2ULL, 0x36748593ULL, 0xf84e30adULL},
+{0x35c75dc9ULL, 0xb474a4fULL, 0x48a8a414ULL, 0x871e2388ULL, 0xe02a9299ULL, 0xb474a4fULL, 0x1df5be02ULL, 0x6d7d9fa9ULL, 0xe02a9299ULL},
+{0x97a8392cULL, 0x1473eb8bULL, 0x1a2aa57dULL, 0xddb1dac4ULL, 0xc8a08b1ULL, 0x1473eb8bULL, 0xdb22eef3ULL, 0x36270102ULL, 0xc8a08b1ULL},
+{0x54370e47ULL, 0x1f545bb1ULL, 0xe1a39658ULL, 0x5d84964eULL, 0x293b2e96ULL, 0x1f545bb1ULL, 0x54597f66ULL, 0xd5180135ULL, 0x293b2e96ULL},
+{0x8bde8d33ULL, 0x8a5729e8ULL, 0xd87295c3ULL, 0xb77ca74aULL, 0x49ced81cULL, 0x8a5729e8ULL, 0xa349a860ULL, 0xe0545cbeULL, 0x49ced81cULL},
+{0xaf014bc8ULL, 0xb7f772c8ULL, 0x2ff6cd21ULL, 0x4993919eULL, 0xf02b3fa2ULL, 0xb7f772c8ULL, 0x2f89063ULL, 0x4fcb507eULL, 0xf02b3fa2ULL},
+{0x16b402daULL, 0x75071f6eULL, 0xaa125fc0ULL, 0x9c7b13f6ULL, 0x7e358464ULL, 0x75071f6eULL, 0xd63b3247ULL, 0x1cbdedefULL, 0x7e358464ULL},
+{0xefc7b124ULL, 0xeb8e0000ULL, 0x7fc20ef0ULL, 0x3e5c0a2aULL, 0x5ee3e094ULL, 0xeb8e0000ULL, 0x5a050144ULL, 0x16bab1c6ULL, 0x5ee3e094ULL},
+{0x10a7fefcULL, 0x4c108934ULL, 0x77b8f7ddULL, 0xf2471479ULL, 0xf06ddd3eULL, 0x4c108934ULL, 0x8d3258c6ULL, 0xedb15a5bULL, 0xf06ddd3eULL},
+{0xb38fe6dfULL, 0xcb3a846eULL, 0x58482527ULL, 0xbfaa66fbULL, 0x7a27ef5dULL, 0xcb3a846eULL, 0x192b145aULL, 0x2460a39cULL, 0x7a27ef5dULL},
+{0xaa3bdf0bULL, 0xafd4855dULL, 0x9b4ef444ULL, 0xc9711e98ULL, 0x7d8af726ULL, 0xafd4855dULL, 0x57232fb2ULL, 0xe55ef102ULL, 0x7d8af726ULL},
+{0x69eaf29dULL, 0x2c622c5dULL, 0xb69ccbfcULL, 0x57fc4e03ULL, 0x39ac0eadULL, 0x2c622c5dULL, 0xa4a16479ULL, 0x3d1c6f0eULL, 0x39ac0eadULL},
+{0xd5d0c266ULL, 0x99f2f67dULL, 0x509a6c65ULL, 0x2856a029ULL, 0xe1e485b8ULL, 0x99f2f67dULL, 0xb15fe791ULL, 0x13982f73ULL, 0xe1e485b8ULL},
+{0xe60bfb36ULL, 0x5e753a28ULL, 0x906a107fULL, 0x622be5f5ULL, 0x430cc184ULL, 0x5e753a28ULL, 0x9cce9ffcULL, 0x1612c255ULL, 0x430cc184ULL},
+{0x9276fde4ULL, 0xb2498219ULL, 0x604aa7b5ULL, 0x727b0d55ULL, 0xfb27bf25ULL, 0xb2498219ULL, 0x4f684cddULL, 0x888f479eULL, 0xfb27bf25ULL},
+{0x9b0b8a6cULL, 0x4b9ff9a6ULL, 0x1d2488a5ULL, 0xc3d53fe3ULL, 0x59fac49eULL, 0x4b9ff9a6ULL, 0x29706b7ULL, 0xa779df3ULL, 0x59fac49eULL},
+{0x3c903c59ULL, 0xd8d03e9eULL, 0x5f5cb123ULL, 0x398d8125ULL, 0x345d35faULL, 0xd8d03e9eULL, 0x1453856cULL, 0xde2ddfc7ULL, 0x345d35faULL},
+{0x82d4a4a1ULL, 0x5883b008ULL, 0x90044883ULL, 0x7dabae30ULL, 0x895421bULL, 0x5883b008ULL, 0x2a279433ULL, 0x7bf7eed5ULL, 0x895421bULL},
+{0xb6e88bdeULL, 0x6daa180eULL, 0x45e0b17eULL, 0xd689258fULL, 0xa584dec7ULL, 0x6daa180eULL, 0x4097fdfULL, 0xce0c1514ULL, 0xa584dec7ULL},
+{0x90c9680aULL, 0x51d83f20ULL, 0x86f0c649ULL, 0xfc3ea8b7ULL, 0xa8e9ac19ULL, 0x51d83f20ULL, 0x741e7295ULL, 0xd46750a4ULL, 0xa8e9ac19ULL},
+{0xea14108ULL, 0x7e717f0aULL, 0x60a7e667ULL, 0xf09931e3ULL, 0x7c621f5eULL, 0x7e717f0aULL, 0xc30a2d4dULL, 0x3f017bc3ULL, 0x7c621f5eULL},
+{0xdab7f350ULL, 0x575277edULL, 0xb19be61aULL, 0xfc0026c8ULL, 0xc2bf2cefULL, 0x575277edULL, 0xf2ac609aULL, 0x1ea02d91ULL, 0xc2bf2cefULL},
+{0x13b72a7bULL, 0x653b9292ULL, 0x31d83b1cULL, 0xa70ebda2ULL, 0x13afb2a0ULL, 0x653b9292ULL, 0x7f5b27edULL, 0xb662e072ULL, 0x13afb2a0ULL},
+{0xaf6fd042ULL, 0xb696afbaULL, 0x89cb4ef4ULL, 0xbfe331e2ULL, 0x92dc2563ULL, 0xb696afbaULL, 0xeefe630eULL, 0xb209ce87ULL, 0x92dc2563ULL},
+{0xdf9ad8efULL, 0xddd7ab1aULL, 0xd4285d60ULL, 0x80436eb4ULL, 0x1b46bb44ULL, 0xddd7ab1aULL, 0xb5c0e225ULL, 0xcfc6bf2bULL, 0x1b46bb44ULL},
+{0xe152c6c0ULL, 0x9a65ec7aULL, 0xd090d2dULL, 0x3e55e256ULL, 0x4902025aULL, 0x9a65ec7aULL, 0x8afd8b5bULL, 0x45a7b36aULL, 0x4902025aULL},
+{0x5dc64205ULL, 0xa2d7a4d2ULL, 0x598c5d93ULL, 0xe802d280ULL, 0xf2c69622ULL, 0xa2d7a4d2ULL, 0x7dc8e345ULL, 0x58f81a2eULL, 0xf2c69622ULL},
+{0xffc947d6ULL, 0x23342d5cULL, 0x5a928ecULL, 0xd6631598ULL, 0x8eb407f3ULL, 0x23342d5cULL, 0xce5b9120ULL, 0x67006feULL, 0x8eb407f3ULL},
+{0x19164d92ULL, 0xb7e80899ULL, 0xfcef75abULL, 0x4bca0ad9ULL, 0xb7f7128fULL, 0xb7e80899ULL, 0xb422a819ULL, 0x2edc4bcbULL, 0xb7f7128fULL},
+{0xb107b6afULL, 0xf760c491ULL, 0xfad66559ULL, 0x2a6c215dULL, 0xddfddf7ULL, 0xf760c491ULL, 0x7923729ULL, 0x17aae82dULL, 0xddfddf7ULL},
+{0xd3656276ULL, 0x58c16c7fULL, 0x3792bb87ULL, 0xf5a5376cULL, 0xcaabb0dfULL, 0x58c16c7fULL, 0x716aa69fULL, 0x27185d90ULL, 0xcaabb0dfULL},
+{0x1d57665bULL, 0x606a9a4ULL, 0xeda86cfdULL, 0xa21c17e7ULL, 0x63249fbeULL, 0x606a9a4ULL, 0x23bf2f14ULL, 0xbc1bf196ULL, 0x63249fbeULL},
+{0x5a4f20baULL, 0x79b9a48fULL, 0x28e7a6c3ULL, 0xc142662ULL, 0x448e2dULL, 0x79b9a48fULL, 0xc9d4fd83ULL, 0xd6978f80ULL, 0x448e2dULL},
+{0x4b59bf42ULL, 0xec500023ULL, 0x6e27088dULL, 0x6c87fc9dULL, 0x14a56abfULL, 0xec500023ULL, 0x6c7c602cULL, 0x2a597c18ULL, 0x14a56abfULL},
+{0x413bfdd6ULL, 0x778e2278ULL, 0xa9db0815ULL, 0x3cd9802bULL, 0x64c1885bULL, 0x778e2278ULL, 0xd4313eb3ULL, 0xbf82e99cULL, 0x64c1885bULL},
+{0x8044fdd6ULL, 0xce3239f4ULL, 0x395df8e6ULL, 0xd4669953ULL, 0xf920115eULL, 0xce3239f4ULL, 0xf1a16583ULL, 0xdc61834aULL, 0xf920115eULL},
+{0xbaf7a548ULL, 0x8d0a810dULL, 0x3990f4a0ULL, 0x210a2a6dULL, 0x1bc415bdULL, 0x8d0a810dULL, 0x40ebd2f0ULL, 0xade368c3ULL, 0x1bc415bdULL},
+{0x3a05affeULL, 0x4db59fddULL, 0x91c8c51cULL, 0xe69cbb4aULL, 0xa0550eceULL, 0x4db59fddULL, 0x614724f5ULL, 0x4e9f6273ULL, 0xa0550eceULL},
+{0xa4563630ULL, 0x7b15f753ULL, 0x39a16cb5ULL, 0x6508fad9ULL, 0xbcada771ULL, 0x7b15f753ULL, 0xc68845feULL, 0x33ca1f1cULL, 0xbcada771ULL},
+{0xedb9ae18ULL, 0x1e888fa1ULL, 0x87ebfa72ULL, 0x697a6cfcULL, 0x95b6358ULL, 0x1e888fa1ULL, 0x72c0580fULL, 0x2b877157ULL, 0x95b6358ULL},
+{0xc04ce122ULL, 0x306a616ULL, 0x842fe088ULL, 0x14938d80ULL, 0x1a9d5cfdULL, 0x306a616ULL, 0x7d6d871ULL, 0xae3d89d6ULL, 0x1a9d5cfdULL},
+{0x8fb25e34ULL, 0xf4adc36ULL, 0xbd58f1feULL, 0x5f291b12ULL, 0x57fbfa5aULL, 0xf4adc36ULL, 0x542a2882ULL, 0xaaca917eULL, 0x57fbfa5aULL},
+{0x6661fefeULL, 0xd34f3eULL, 0x9012a6ceULL, 0xbe821ee6ULL, 0xa5e2e42fULL, 0xd34f3eULL, 0xf27714e9ULL, 0x58a46b7cULL, 0xa5e2e42fULL},
+{0xcb350d5ULL, 0x3d88c494ULL, 0x44eecf1aULL, 0x1f9893b0ULL, 0x8fab7481ULL, 0x3d88c494ULL, 0xca820986ULL, 0x15c62440ULL, 0x8fab7481ULL},
+{0x40d334d8ULL, 0x78e5b72fULL, 0x71d9be72ULL, 0xece7b555ULL, 0xacb6ef24ULL, 0x78e5b72fULL, 0x7b95b921ULL, 0xe2909319ULL, 0xacb6ef24ULL},
+{0x9955733ULL, 0x7d231847ULL, 0x169616d0ULL, 0x58f6d6c7ULL, 0xa5db22cdULL, 0x7d231847ULL, 0x8d04197eULL, 0xcd291388ULL, 0xa5db22cdULL},
+{0x4a768227ULL, 0x23f919ebULL, 0xabdc424fULL, 0x3d8f303eULL, 0x2fe3e134ULL, 0x23f919ebULL, 0xb64ce8c4ULL, 0xeff582a0ULL, 0x2fe3e134ULL},
+{0xc93a1582ULL, 0x21712ed6ULL, 0x1914390dULL, 0x2b203cc9ULL, 0x437ade8cULL, 0x21712ed6ULL, 0xeee1394bULL, 0x7179f94bULL, 0x437ade8cULL},
+{0x9d71c81fULL, 0xd0f71ff0ULL, 0xfda3d551ULL, 0xf1654a31ULL, 0x490dd99cULL, 0xd0f71ff0ULL, 0x5ad27a12ULL, 0x670fdcb7ULL, 0x490dd99cULL},
+{0xbd5b821fULL, 0x98ee9e7ULL, 0x6ee0c9efULL, 0x7e8f6bb3ULL, 0xd63a753eULL, 0x98ee9e7ULL, 0xe564ab39ULL, 0xe0f6f71cULL, 0xd63a753eULL},
+{0xca2160b7ULL, 0x7d7f3ceeULL, 0xeb02fddfULL, 0xfc588893ULL, 0x80ca4fa6ULL, 0x7d7f3ceeULL, 0xac35ed72ULL, 0xdd1c218eULL, 0x80ca4fa6ULL},
+{0xf9a4aaddULL, 0x891aee4dULL, 0x7271c6e3ULL, 0x2ab49215ULL, 0x79fcc52eULL, 0x891aee4dULL, 0xab1310a0ULL, 0x96d5ba30ULL, 0x79fcc52eULL},
+{0x69e2e1bbULL, 0xccbb7ba7ULL, 0x1ca388b6ULL, 0x95f00977ULL, 0x617962aeULL, 0xccbb7ba7ULL, 0xcac8ea27ULL, 0xc380b868ULL, 0x617962aeULL},
+{0x821166a7ULL, 0x19312731ULL, 0xa620721dULL, 0x28c821dcULL, 0x58deec70ULL, 0x19312731ULL, 0x47c60fe3ULL, 0x3bd8aeb1ULL, 0x58deec70ULL},
+{0xefa44896ULL, 0x77ad6e36ULL, 0xc0efae9cULL, 0xedbfe89cULL, 0x3dee9531ULL, 0x77ad6e36ULL, 0xad1b9a90ULL, 0xb359c164ULL, 0x3dee9531ULL},
+{0x7a607cb1ULL, 0xf7c7e470ULL, 0xbe9d0e78ULL, 0xe135b6b8ULL, 0xba91a91cULL, 0xf7c7e470ULL, 0x4df16155ULL, 0x6ab446bdULL, 0xba91a91cULL},
+{0xdee96683ULL, 0xb01ef8adULL, 0xda8d4770ULL, 0xaddcdbfaULL, 0xc95b9959ULL, 0xb01ef8adULL, 0x55905f49ULL, 0x49cb934fULL, 0xc95b9959ULL},
+{0x5fc761e9ULL, 0xd49484b3ULL, 0x8361c474ULL, 0xcea478a5ULL, 0x7d68e2a5ULL, 0xd49484b3ULL, 0x8fe70d22ULL, 0x5bdbfcbaULL, 0x7d68e2a5ULL},
+{0x395bff25ULL, 0xa6a91e8aULL, 0xe52cfa91ULL, 0x3651ce6ULL, 0xc3b0296eULL, 0xa6a91e8aULL, 0x687a7489ULL, 0xfaf0b989ULL, 0xc3b0296eULL},
+{0x58f7a7c2ULL, 0xf24fd9abULL, 0x2fdc7fd0ULL, 0xa99a6a5bULL, 0x4b267e7dULL, 0xf24fd9abULL, 0xd822b534ULL, 0x97f2dfc3ULL, 0x4b267e7dULL},
+{0xabb57b40ULL, 0x97230acULL, 0xe11e9d01ULL, 0x59adbe23ULL, 0x9ba8648bULL, 0x97230acULL, 0x3a355555ULL, 0x9071de21ULL, 0x9ba8648bULL},
+{0xceb4f428ULL, 0xbcdd501fULL, 0x66ef8c2eULL, 0x2b3877acULL, 0x1d78c522ULL, 0xbcdd501fULL, 0xcb1c8f73ULL, 0x205d6c36ULL, 0x1d78c522ULL},
+{0x54a11915ULL, 0xad83103bULL, 0x4268bc8ULL, 0x8833f717ULL, 0xce812219ULL, 0xad83103bULL, 0xd7a73bbfULL, 0x99dd2803ULL, 0xce812219ULL},
+{0xc6b8bc8aULL, 0x5059b794ULL, 0x5ef1f214ULL, 0xc12a5e65ULL, 0x90c2e6d9ULL, 0x5059b794ULL, 0x9f2dc8b1ULL, 0xfdb162b1ULL, 0x90c2e6d9ULL},
+{0xa50b849fULL, 0x2fe6edd8ULL, 0xe98ce33dULL, 0xeccee9b7ULL, 0x328e438aULL, 0x2fe6edd8ULL, 0xa35f59caULL, 0x3ede9532ULL, 0x328e438aULL},
+{0x2d85f01ULL, 0x6efed8f5ULL, 0xaa7c326cULL, 0x8124d369ULL, 0xd16f08d5ULL, 0x6efed8f5ULL, 0xa5846a8fULL, 0x5dcf58b4ULL, 0xd16f08d5ULL},
+{0x4f8d9a5aULL, 0x3be3b5d3ULL, 0x92bddbf2ULL, 0xf80bca02ULL, 0xc4ed17a3ULL, 0x3be3b5d3ULL, 0x949ee317ULL, 0x2af4d94dULL, 0xc4ed17a3ULL},
+{0xc911af7eULL, 0xeb37a18eULL, 0x702f6a50ULL, 0xebd141dfULL, 0x8e226f08ULL, 0xeb37a18eULL, 0xcc53dc80ULL, 0x247743aULL, 0x8e226f08ULL},
+{0xd8c9d891ULL, 0xb3ba259dULL, 0x1606e67dULL, 0xb262c1daULL, 0xcb0d021dULL, 0xb3ba259dULL, 0xfb0b199cULL, 0xe4d0e69aULL, 0xcb0d021dULL},
+{0xa5731fa0ULL, 0xa416e76dULL, 0xb7843da9ULL, 0x365aa1dcULL, 0x477e27a9ULL, 0xa416e76dULL, 0x2af04d0ULL, 0x3a25cf23ULL, 0x477e27a9ULL},
+{0x4d04bed5ULL, 0x6b36609eULL, 0x87778652ULL, 0x72c026dULL, 0x5463f7a6ULL, 0x6b36609eULL, 0x539ba0c4ULL, 0x3b64fbeeULL, 0x5463f7a6ULL},
+{0x5dddaa4cULL, 0xa836f1f2ULL, 0xd6ccd940ULL, 0xe71c3b33ULL, 0xcf2d7868ULL, 0xa836f1f2ULL, 0x362fcc0ULL, 0x13fb55a0ULL, 0xcf2d7868ULL},
+{0x83ba57afULL, 0x9705603eULL, 0x9fdd00eULL, 0xfe8965c5ULL, 0x419a184ULL, 0x9705603eULL, 0xa0ecc532ULL, 0xfbc5706ULL, 0x419a184ULL},
+{0x39ee9b5dULL, 0xc7ebea86ULL, 0x2dfb32baULL, 0xb531572dULL, 0x2dceda6cULL, 0xc7ebea86ULL, 0x2beb24d3ULL, 0x8032aa5aULL, 0x2dceda6cULL},
+{0x95d5b1ULL, 0xfec1b7e4ULL, 0x774ada74ULL, 0x25cea264ULL, 0x8dac1bc1ULL, 0xfec1b7e4ULL, 0x562eb429ULL, 0x99507bdfULL, 0x8dac1bc1ULL},
+{0xd4f686a8ULL, 0x2737cdfdULL, 0x803f3d86ULL, 0xa6c1cd9dULL, 0x47a19509ULL, 0x2737cdfdULL, 0x4e625710ULL, 0x77768eb7ULL, 0x47a19509ULL},
+{0x46608535ULL, 0xc80cc69ULL, 0x7e18bbf6ULL, 0xd00fcfd7ULL, 0x92293397ULL, 0xc80cc69ULL, 0xcacdeb9bULL, 0x18c1053bULL, 0x92293397ULL},
+{0x1a528d33ULL, 0x8906c7deULL, 0x38ea6ed3ULL, 0x22b74401ULL, 0x139178fdULL, 0x8906c7deULL, 0xf0a77281ULL, 0x105dcb9ULL, 0x139178fdULL},
+{0x2e2036b4ULL, 0x13623f75ULL, 0x9ba70bfULL, 0x704d703fULL, 0xc60f31a1ULL, 0x13623f75ULL, 0x6169c33dULL, 0x90a6688fULL, 0xc60f31a1ULL},
+{0x7395a207ULL, 0x80ba9d67ULL, 0xecc05ac0ULL, 0x86042d16ULL, 0x78575b14ULL, 0x80ba9d67ULL, 0x6b2d6ddfULL, 0x467a3ba5ULL, 0x78575b14ULL},
+{0x15b0ffd6ULL, 0xb8e15d5eULL, 0x66506339ULL, 0x1801d335ULL, 0xac796af2ULL, 0xb8e15d5eULL, 0x4bc7a9c5ULL, 0xe381ed9eULL, 0xac796af2ULL},
+{0x2c3d8302ULL, 0x9e80fe30ULL, 0xf5f2f12eULL, 0x8f6a911eULL, 0x3c161293ULL, 0x9e80fe30ULL, 0xd433381ULL, 0x442889f9ULL, 0x3c161293ULL},
+{0x87eec678ULL, 0xbf04921ULL, 0x492af9f7ULL, 0x2ecdcfc4ULL, 0x9540f364ULL, 0xbf04921ULL, 0x855f0897ULL, 0x7210ecb0ULL, 0x9540f364ULL},
+{0x30d27373ULL, 0x21b71918ULL, 0xcba20a19ULL, 0x743d1191ULL, 0xb5f5b8d0ULL, 0x21b71918ULL, 0x865f01bULL, 0x185cf185ULL, 0xb5f5b8d0ULL},
+{0xdf2aa27fULL, 0x57aed268ULL, 0x672c1089ULL, 0x8780b7b7ULL, 0x44a8765dULL, 0x57aed268ULL, 0x77f992ccULL, 0x97876cddULL, 0x44a8765dULL},
+{0x43f71c7fULL, 0x51b84040ULL, 0xdd55a558ULL, 0x2ed0778eULL, 0xe4a8fccdULL, 0x51b84040ULL, 0x4334f0e1ULL, 0xc78f02edULL, 0xe4a8fccdULL},
+{0x471f294eULL, 0xb7a80335ULL, 0xdbd6ccdcULL, 0x43214a6eULL, 0x86c090d5ULL, 0xb7a80335ULL, 0xb0d4c951ULL, 0x3bbcea5ULL, 0x86c090d5ULL},
+{0x64a5efa4ULL, 0xf89249a7ULL, 0x493d5125ULL, 0x4c0330c1ULL, 0x3e506f31ULL, 0xf89249a7ULL, 0x86bf7935ULL, 0x859dad78ULL, 0x3e506f31ULL},
+{0xdcb73985ULL, 0xe842f7eaULL, 0x2aeb33ULL, 0x10586e45ULL, 0xcd10011ULL, 0xe842f7eaULL, 0x4425ab81ULL, 0xc23c74b1ULL, 0xcd10011ULL},
+{0x4eb3c69cULL, 0x1959caabULL, 0x3844e524ULL, 0xf584d3c8ULL, 0xf7f8d0e8ULL, 0x1959caabULL, 0x8d3182acULL, 0x6322b94cULL, 0xf7f8d0e8ULL},
+{0x641b776aULL, 0x78673364ULL, 0xca8536c3ULL, 0xf40967b4ULL, 0xd270798bULL, 0x78673364ULL, 0x902ab0c6ULL, 0x5a87cabfULL, 0xd270798bULL},
+{0xb1689e83ULL, 0x6e87ba04ULL, 0xbb58b35eULL, 0x35f4d1a3ULL, 0xc453005eULL, 0x6e87ba04ULL, 0x4225a659ULL, 0xde87b07aULL, 0xc453005eULL},
+{0x8af85bb0ULL, 0x7c6d6c43ULL, 0x8ea4b533ULL, 0xbc2e6d3dULL, 0x65e1a6e0ULL, 0x7c6d6c43ULL, 0xf7089f95ULL, 0x555c473cULL, 0x65e1a6e0ULL},
+{0xe98c265ULL, 0xd2cafde9ULL, 0x34dc6121ULL, 0x9cfbfccaULL, 0x1bf9051fULL, 0xd2cafde9ULL, 0x7f916d0eULL, 0x59b3a090ULL, 0x1bf9051fULL},
+{0xff4a4a32ULL, 0xc3686b40ULL, 0x6b23cb45ULL, 0x37766332ULL, 0x33b8783aULL, 0xc3686b40ULL, 0x8347c5f9ULL, 0xce26568bULL, 0x33b8783aULL},
+{0x1e5f5815ULL, 0xc4119b22ULL, 0x42e261b0ULL, 0xac1557c7ULL, 0x1136cdaULL, 0xc4119b22ULL, 0x8bc0b86cULL, 0xba6d97c0ULL, 0x1136cdaULL},
+{0xc6c656b2ULL, 0x7d2cc18bULL, 0x83391800ULL, 0xf844f46cULL, 0xc99a6327ULL, 0x7d2cc18bULL, 0x8eb5ab7ULL, 0x563a50edULL, 0xc99a6327ULL},
+{0x6801e29eULL, 0x7b6435eULL, 0xb852a27fULL, 0xf83886d2ULL, 0x5cfbac53ULL, 0x7b6435eULL, 0xed608ae8ULL, 0xa133c3f5ULL, 0x5cfbac53ULL},
+{0x3426d246ULL, 0xbb88b534ULL, 0x4da21d18ULL, 0xbe36c23eULL, 0xbf8588b0ULL, 0xbb88b534ULL, 0x53bcaec1ULL, 0xfbb66085ULL, 0xbf8588b0ULL},
+{0x3f9b5642ULL, 0x137b2af9ULL, 0x264cd50aULL, 0x162a7293ULL, 0xacad99efULL, 0x137b2af9ULL, 0x1a28e029ULL, 0xec2abaf8ULL, 0xacad99efULL},
+{0x34532a4fULL, 0x8cf69255ULL, 0xe9e3e15eULL, 0xc3190f5bULL, 0xdfad239cULL, 0x8cf69255ULL, 0xd5448286ULL, 0x6b5d72c7ULL, 0xdfad239cULL},
+{0xecd1b6b0ULL, 0x619eb771ULL, 0xda3ff828ULL, 0xe6c3287ULL, 0x1abc997fULL, 0x619eb771ULL, 0xa3a85856ULL, 0x89df93bbULL, 0x1abc997fULL},
+{0x8103c0dULL, 0x117e6a2cULL, 0x7e30595ULL, 0x3aea9397ULL, 0x48daedb2ULL, 0x117e6a2cULL, 0xbfb2f196ULL, 0x2284a4b1ULL, 0x48daedb2ULL},
+{0x2c33ef8dULL, 0x4b4b4f1fULL, 0xac257351ULL, 0xcf2126c4ULL, 0x9adb1f61ULL, 0x4b4b4f1fULL, 0x644679d6ULL, 0xcbe19abaULL, 0x9adb1f61ULL},
+{0x25d8306aULL, 0xde315bb7ULL, 0x25cb8c73ULL, 0x6b14c6daULL, 0xb77eca92ULL, 0xde315bb7ULL, 0x2e3fa478ULL, 0x9c7deceeULL, 0xb77eca92ULL},
+{0x228a0edbULL, 0x3f19e443ULL, 0x54fd1382ULL, 0x200a3da1ULL, 0xf5f03a54ULL, 0x3f19e443ULL, 0x99173decULL, 0xed5feda3ULL, 0xf5f03a54ULL},
+{0xed78c82bULL, 0xc7440e5aULL, 0x4c349407ULL, 0xaea9a370ULL, 0xd327d545ULL, 0xc7440e5aULL, 0xb8f9738fULL, 0x6d939752ULL, 0xd327d545ULL},
+{0x7a7ed8dbULL, 0x1511d8aeULL, 0x10dea6c9ULL, 0x22e4ab57ULL, 0xbeb48583ULL, 0x1511d8aeULL, 0x3146f2caULL, 0xc76e3d8eULL, 0xbeb48583ULL},
+{0xc0034cf2ULL, 0x1530be34ULL, 0x7b0085cfULL, 0xbd676c8ULL, 0x4e2ef58aULL, 0x1530be34ULL, 0xfab684abULL, 0x661a2fddULL, 0x4e2ef58aULL},
+{0xdc639945ULL, 0xaa5c8759ULL, 0x42418ee5ULL, 0x2cc54265ULL, 0x6702d742ULL, 0xaa5c8759ULL, 0x438e16a9ULL, 0xbeb342bfULL, 0x6702d742ULL},
+{0xd2422f40ULL, 0xc4cbf931ULL, 0x8df56e40ULL, 0xa7ede3eULL, 0xc717c932ULL, 0xc4cbf931ULL, 0xb969f03ULL, 0x83ee2182ULL, 0xc717c932ULL},
+{0x95a57faeULL, 0x37bbfc64ULL, 0x9fc61c0cULL, 0x1f4c888bULL, 0x4aa4b2bcULL, 0x37bbfc64ULL, 0xa013a8c6ULL, 0x9bddcc23ULL, 0x4aa4b2bcULL},
+{0xa39e8c34ULL, 0xcf82070cULL, 0x1c0ef354ULL, 0xac0f42d5ULL, 0x67289f61ULL, 0xcf82070cULL, 0xd6d37869ULL, 0x889faa04ULL, 0x67289f61ULL},
+{0x942906c2ULL, 0xff410648ULL, 0x1296525dULL, 0x186f7cc8ULL, 0x3b8e0433ULL, 0xff410648ULL, 0x7751ebb2ULL, 0xe21020aULL, 0x3b8e0433ULL},
+{0x67608d28ULL, 0x871bc69bULL, 0xc4ddf2fULL, 0xcaca3681ULL, 0xfeac0c70ULL, 0x871bc69bULL, 0x74e90e4ULL, 0xd75d9ab1ULL, 0xfeac0c70ULL},
+{0x3eb95f19ULL, 0xee53b1c8ULL, 0x97976226ULL, 0x69021884ULL, 0x5801bed0ULL, 0xee53b1c8ULL, 0xea1873f8ULL, 0xbbc4978fULL, 0x5801bed0ULL},
+{0x194177d8ULL, 0xcbd144d2ULL, 0x62612f32ULL, 0xee5f4728ULL, 0x7bfcfd1dULL, 0xcbd144d2ULL, 0x31320f21ULL, 0xf5b28095ULL, 0x7bfcfd1dULL},
+{0x521d822ULL, 0x4d2c2157ULL, 0x2191b19ULL, 0x9c0b1253ULL, 0x2dfbc79dULL, 0x4d2c2157ULL, 0x48a46f1aULL, 0x4fa9eec3ULL, 0x2dfbc79dULL},
+{0x93516e70ULL, 0x33acf2c4ULL, 0x720d2ecaULL, 0x96e78e59ULL, 0xa8bb9d0aULL, 0x33acf2c4ULL, 0x46e61fdcULL, 0x140a89c5ULL, 0xa8bb9d0aULL},
+{0xe305cde7ULL, 0xc010aa46ULL, 0xe04ee84dULL, 0xd2bbca9cULL, 0x66cb4ba2ULL, 0xc010aa46ULL, 0xcf843703ULL, 0xca561016ULL, 0x66cb4ba2ULL},
+{0x7e64c98cULL, 0x33bc0ac6ULL, 0xccd3f2abULL, 0x24b89ff9ULL, 0xa28a3339ULL, 0x33bc0ac6ULL, 0x8e4f0961ULL, 0xe50d17bfULL, 0xa28a3339ULL},
+{0x8fc672e4ULL, 0x52a8037ULL, 0xfad36dffULL, 0xdc277451ULL, 0x65a37bd4ULL, 0x52a8037ULL, 0xb39f6eefULL, 0xc551b699ULL, 0x65a37bd4ULL},
+{0xbfb80625ULL, 0x97346b82ULL, 0x827e47d8ULL, 0xfbe7a763ULL, 0xcbd5e2c9ULL, 0x97346b82ULL, 0xa8f5bc6cULL, 0x96e83cb3ULL, 0xcbd5e2c9ULL},
+{0x52e284f2ULL, 0x4b7bf076ULL, 0xebe3ff7cULL, 0x7e728c3cULL, 0xfb64029fULL, 0x4b7bf076ULL, 0xcce06584ULL, 0xfdddd3f7ULL, 0xfb64029fULL},
+{0x12a92fdbULL, 0xc78d433aULL, 0xb2ae2dbbULL, 0xf18b4ccfULL, 0x360d6948ULL, 0xc78d433aULL, 0x1ab465b6ULL, 0x8c81d551ULL, 0x360d6948ULL},
+{0xb6455c89ULL, 0x519997e6ULL, 0xa061730ULL, 0x97521fafULL, 0x7ff787d7ULL, 0x519997e6ULL, 0x8507c3dcULL, 0x9873ad66ULL, 0x7ff787d7ULL},
+{0x153e733dULL, 0xd4465edcULL, 0x2872d73ULL, 0xf1510cd1ULL, 0xa3f0a515ULL, 0xd4465edcULL, 0x4eb55f71ULL, 0xced16a58ULL, 0xa3f0a515ULL},
+{0x24b8a033ULL, 0x9d1f4cb1ULL, 0x9dd1fdaeULL, 0xf42a4c05ULL, 0xd80670e1ULL, 0x9d1f4cb1ULL, 0x7efaa460ULL, 0xa2282d55ULL, 0xd80670e1ULL},
+{0x53df3617ULL, 0xa957f845ULL, 0xc71a0454ULL, 0xc70a6587ULL, 0xb94271fcULL, 0xa957f845ULL, 0x91336010ULL, 0xf9ab3fa5ULL, 0xb94271fcULL},
+{0xdaa276ffULL, 0x234dc3cdULL, 0x9df8ee2bULL, 0x3eb4ec0cULL, 0x84604f2cULL, 0x234dc3cdULL, 0x44a0babcULL, 0x711de101ULL, 0x84604f2cULL},
+{0x3260c5ffULL, 0xf8f0fc77ULL, 0xf0223dd8ULL, 0xdea965feULL, 0xdc40581cULL, 0xf8f0fc77ULL, 0x98150b2ULL, 0x3eefcbf2ULL, 0xdc40581cULL},
+{0x6626ce02ULL, 0xd618321dULL, 0xaf4fd0d0ULL, 0x53d204ULL, 0x5e4396a6ULL, 0xd618321dULL, 0xb5ddad96ULL, 0x69d90dbfULL, 0x5e4396a6ULL},
+{0x4a897514ULL, 0x8e83de3cULL, 0x499b4b6ULL, 0xeba2f006ULL, 0x237bf6f3ULL, 0x8e83de3cULL, 0xfc753a8bULL, 0x7326d9e3ULL, 0x237bf6f3ULL},
+{0x2881835aULL, 0xf11eb580ULL, 0xbfc880faULL, 0x7fa664f0ULL, 0xa6c30edaULL, 0xf11eb580ULL, 0xaa03501bULL, 0x3d52a58dULL, 0xa6c30edaULL},
+{0xe1fa8248ULL, 0xf4ed24f3ULL, 0x477c53bfULL, 0xa0cdff83ULL, 0xbf82045dULL, 0xf4ed24f3ULL, 0x3077a4edULL, 0xc8eb4429ULL, 0xbf82045dULL}},
+  {{0x867f5c9fULL, 0xdd712e32ULL, 0x264ecac3ULL, 0xd77dc082ULL, 0xecedd072ULL, 0xdd712e32ULL, 0x8f634f99ULL, 0x2cf64767ULL, 0xecedd072ULL},
+{0x4cb0f020ULL, 0x25657751ULL, 0x396e18c0ULL, 0x5bdf0d4cULL, 0x1b76c63aULL, 0x25657751ULL, 0x40f670c9ULL, 0xa1fd15d2ULL, 0x1b76c63aULL},
+{0x725d54ffULL, 0xb10adfebULL, 0x2fdf1838ULL, 0x8e6a01fbULL, 0xfa175501ULL, 0xb10adfebULL, 0x9ecbcd3ULL, 0x7d7c5354ULL, 0xfa175501ULL},
+{0xb036363aULL, 0xcee4bf29ULL, 0x8c415929ULL, 0xb295a0c8ULL, 0x191004ddULL, 0xcee4bf29ULL, 0x846c2cdbULL, 0x1637819bULL, 0x191004ddULL},
+{0xdae4f09bULL, 0x141bc8ceULL, 0xeb93559eULL, 0x5c573032ULL, 0xf2984151ULL, 0x141bc8ceULL, 0x28a34aeeULL, 0x1c298c44ULL, 0xf2984151ULL},
+{0xe3d4606eULL, 0xde93eae9ULL, 0x910227ceULL, 0xe80dc3e3ULL, 0x93b25dc9ULL, 0xde93eae9ULL, 0xedfd9f24ULL, 0xf043821eULL, 0x93b25dc9ULL},
+{0x61051d3dULL, 0x3762d10eULL, 0x61c6de4aULL, 0xeed3dfedULL, 0xc9da9de9ULL, 0x3762d10eULL, 0xb6d80735ULL, 0xafe39dd8ULL, 0xc9da9de9ULL},
+{0x1910366aULL, 0x926a17bULL, 0xd099a82cULL, 0x9eb4ab76ULL, 0xc36549bdULL, 0x926a17bULL, 0xf3921243ULL, 0x95a73086ULL, 0xc36549bdULL},
+{0xc50b40c5ULL, 0xeb14e90dULL, 0x850c608fULL, 0x55604200ULL, 0x8eeeb6d6ULL, 0xeb14e90dULL, 0x5197ce76ULL, 0xcf5a2b66ULL, 0x8eeeb6d6ULL},
+{0xea22a4e3ULL, 0xc25cdca3ULL, 0xda7a0a9aULL, 0xa9ab5438ULL, 0xd1b43e35ULL, 0xc25cdca3ULL, 0x6385388fULL, 0xffde4443ULL, 0xd1b43e35ULL},
+{0xb8efe118ULL, 0x2b088035ULL, 0x8aa8bbb6ULL, 0x9028a9efULL, 0xd9f98817ULL, 0x2b088035ULL, 0xdd09bbadULL, 0x36c631bfULL, 0xd9f98817ULL},
+{0x23d17068ULL, 0x2aa33e7cULL, 0xba717240ULL, 0xfee1f7bfULL, 0x746bc892ULL, 0x2aa33e7cULL, 0x7b9f384aULL, 0x9b8b7bbULL, 0x746bc892ULL},
+{0xbdeb0c7dULL, 0x51c7f879ULL, 0xd9a3cc07ULL, 0x5ba77bbULL, 0x3020322fULL, 0x51c7f879ULL, 0xcca47006ULL, 0x48f9fa17ULL, 0x3020322fULL},
+{0x1f13bde9ULL, 0x99184330ULL, 0x46018818ULL, 0x9ac0d289ULL, 0x594dabd9ULL, 0x99184330ULL, 0x2d0d4c8bULL, 0xa1c8e33bULL, 0x594dabd9ULL},
+{0x87ab086eULL, 0x154f71f4ULL, 0x66111c99ULL, 0xdccb12a3ULL, 0xf19903cfULL, 0x154f71f4ULL, 0x2be1e940ULL, 0xc2ca65eaULL, 0xf19903cfULL},
+{0xc54d66d3ULL, 0x84d25219ULL, 0x31115a1bULL, 0xedfcdce6ULL, 0x64ebb329ULL, 0x84d25219ULL, 0x88d6fb1eULL, 0x538ee184ULL, 0x64ebb329ULL},
+{0x9b51456ULL, 0x93a94888ULL, 0xcd53f10cULL, 0xc4c16ce1ULL, 0x692b3504ULL, 0x93a94888ULL, 0x99c104b2ULL, 0x4a58d975ULL, 0x692b3504ULL},
+{0xdc61d43aULL, 0xed82b4bdULL, 0x621364c8ULL, 0x422cb56bULL, 0x35758056ULL, 0xed82b4bdULL, 0x40f40f2aULL, 0xb0b98c26ULL, 0x35758056ULL},
+{0x30e6e983ULL, 0x1bd066f0ULL, 0x3ba9b3eULL, 0xd2d4e20eULL, 0xee8fc9a7ULL, 0x1bd066f0ULL, 0x70fdad5bULL, 0xfe162dcfULL, 0xee8fc9a7ULL},
+{0x4c6c5579ULL, 0xa405581aULL, 0x23ed6529ULL, 0x86606af5ULL, 0x4976c949ULL, 0xa405581aULL, 0x3d1e1331ULL, 0x761dc650ULL, 0x4976c949ULL},
+{0xf8c4780cULL, 0x18a071d1ULL, 0xac63efffULL, 0xcc8dcdffULL, 0xaf3988d3ULL, 0x18a071d1ULL, 0x6e096441ULL, 0xa9558649ULL, 0xaf3988d3ULL},
+{0x784544c8ULL, 0x23db74eeULL, 0x727de594ULL, 0x3c274937ULL, 0x8abf0688ULL, 0x23db74eeULL, 0x6f9c7fabULL, 0x9b4aa33ULL, 0x8abf0688ULL},
+{0x7eefecb3ULL, 0x5cab2b48ULL, 0x33a2d191ULL, 0x96a95621ULL, 0x9b3b782ULL, 0x5cab2b48ULL, 0x1ff46d8fULL, 0x17853d0fULL, 0x9b3b782ULL},
+{0x1b7693cfULL, 0xff51340cULL, 0xbf38ffc6ULL, 0xc19a3d2fULL, 0x2b87e84eULL, 0xff51340cULL, 0x52a9d6caULL, 0x3735a1acULL, 0x2b87e84eULL},
+{0x7758174dULL, 0xd21c4402ULL, 0xf827b976ULL, 0xca9457a3ULL, 0x6ef01efeULL, 0xd21c4402ULL, 0xfd079ca7ULL, 0x6e02e0c7ULL, 0x6ef01efeULL},
+{0xb0e3a67eULL, 0x35897e7cULL, 0x878bc200ULL, 0xbac33bd2ULL, 0xd1c2169ULL, 0x35897e7cULL, 0xf072465ULL, 0x5def8e9cULL, 0xd1c2169ULL},
+{0x3db218ccULL, 0x354601beULL, 0x30fdaf95ULL, 0x36b5618aULL, 0xad445634ULL, 0x354601beULL, 0xece89d77ULL, 0x7b10d046ULL, 0xad445634ULL},
+{0x8e963319ULL, 0xba82a642ULL, 0x28cb200dULL, 0xefee2eb2ULL, 0x42e16411ULL, 0xba82a642ULL, 0x2e196cdbULL, 0xb0deb995ULL, 0x42e16411ULL},
+{0xfd2d3499ULL, 0x31fb3bd6ULL, 0x7e0c2c3fULL, 0x34cbbf0bULL, 0x4236b7cbULL, 0x31fb3bd6ULL, 0xa4586791ULL, 0xdc0a3745ULL, 0x4236b7cbULL},
+{0x64b40b81ULL, 0xffe0ecf4ULL, 0xd7f0f094ULL, 0x85dab966ULL, 0x8825b6bdULL, 0xffe0ecf4ULL, 0x5f9f68f8ULL, 0x12a3c929ULL, 0x8825b6bdULL},
+{0xa32f1f22ULL, 0x34be3531ULL, 0x4e018019ULL, 0xbd5ae7faULL, 0x12b47904ULL, 0x34be3531ULL, 0xdbb71ecfULL, 0x9baf770eULL, 0x12b47904ULL},
+{0x96c4055eULL, 0x593bfec4ULL, 0xfd836c7bULL, 0xdf4c2782ULL, 0x259a471dULL, 0x593bfec4ULL, 0x255fec6bULL, 0x2b04a963ULL, 0x259a471dULL},
+{0xe9c17e73ULL, 0x4aec0e45ULL, 0x7371e3d5ULL, 0xdc975f94ULL, 0x92168c79ULL, 0x4aec0e45ULL, 0xbea50d20ULL, 0xd0a16dfaULL, 0x92168c79ULL},
+{0x6c6061cbULL, 0x506176a0ULL, 0x2b749a75ULL, 0x8e6a2e24ULL, 0x4c871296ULL, 0x506176a0ULL, 0xcb71ef71ULL, 0xb1b8fec6ULL, 0x4c871296ULL},
+{0x9268ac6dULL, 0xf52e9afULL, 0x3f6b472ULL, 0x5caa9457ULL, 0x6febb249ULL, 0xf52e9afULL, 0xb63f3336ULL, 0x1eb796dcULL, 0x6febb249ULL},
+{0x4a5be5e8ULL, 0x493778dULL, 0x262ffddULL, 0x7de0de81ULL, 0x64c09b2ULL, 0x493778dULL, 0x19abaadcULL, 0xb88e0edeULL, 0x64c09b2ULL},
+{0xec30bb6dULL, 0xe609c56dULL, 0xc0b32147ULL, 0x8397f2ULL, 0x6380e8bbULL, 0xe609c56dULL, 0xa677c71aULL, 0x3d16e894ULL, 0x6380e8bbULL},
+{0xd1bde64aULL, 0xfc6c9257ULL, 0x19daec9aULL, 0x167be847ULL, 0xdee17eafULL, 0xfc6c9257ULL, 0x79d610bcULL, 0x7d300331ULL, 0xdee17eafULL},
+{0x6b0e9eadULL, 0x6db09d6cULL, 0x16d44b71ULL, 0xd1b5923dULL, 0x4806fac8ULL, 0x6db09d6cULL, 0x58bfdc8eULL, 0x71f1d116ULL, 0x4806fac8ULL},
+{0xf1aaad17ULL, 0x4f0ca823ULL, 0x737c617dULL, 0x15116603ULL, 0x48844a2eULL, 0x4f0ca823ULL, 0xd20868b1ULL, 0x304089e6ULL, 0x48844a2eULL},
+{0x304269d8ULL, 0x9d4ce5c7ULL, 0xa2a89feaULL, 0x271460abULL, 0x9f9cd036ULL, 0x9d4ce5c7ULL, 0x6a6807fcULL, 0x66c2e6f3ULL, 0x9f9cd036ULL},
+{0x459b5e47ULL, 0x9ba3a1a6ULL, 0x52f57b6fULL, 0xe1bb87e4ULL, 0xfcc380d4ULL, 0x9ba3a1a6ULL, 0x446eab01ULL, 0x3c1450edULL, 0xfcc380d4ULL},
+{0xeda19cb5ULL, 0x29b67338ULL, 0x6f386531ULL, 0xbd0d06e7ULL, 0x498fe4b1ULL, 0x29b67338ULL, 0xcc13bd2bULL, 0x61302c23ULL, 0x498fe4b1ULL},
+{0x4afeb039ULL, 0x50d82c5aULL, 0xfb556cULL, 0xd1c3031aULL, 0x16dd4e40ULL, 0x50d82c5aULL, 0x44664465ULL, 0x5bc86873ULL, 0x16dd4e40ULL},
+{0x79a80758ULL, 0x2a9a902ULL, 0x6f9864d8ULL, 0x2a563c7cULL, 0xd4aac1afULL, 0x2a9a902ULL, 0x5dfd356fULL, 0x3c41bcabULL, 0xd4aac1afULL},
+{0xded03e53ULL, 0xa0d19a2aULL, 0xf2d15b54ULL, 0xc1380a2aULL, 0x6ed9be8dULL, 0xa0d19a2aULL, 0xb20abdeULL, 0x55688c71ULL, 0x6ed9be8dULL},
+{0x18bc5e88ULL, 0x1862d8f4ULL, 0x351c3b90ULL, 0xb3b2c13cULL, 0xb0925ccdULL, 0x1862d8f4ULL, 0x6e5b80a3ULL, 0x57cd8063ULL, 0xb0925ccdULL},
+{0x18fc6d88ULL, 0x77b39418ULL, 0x4037619eULL, 0xe206f5e8ULL, 0x366c5ab1ULL, 0x77b39418ULL, 0x9f080bb4ULL, 0x535ea06cULL, 0x366c5ab1ULL},
+{0x84bbf926ULL, 0xe2f51499ULL, 0x3ced1235ULL, 0xdf94b604ULL, 0xeee1933bULL, 0xe2f51499ULL, 0x5434fce7ULL, 0xc624850bULL, 0xeee1933bULL},
+{0x14cce438ULL, 0x9e968591ULL, 0x83efed98ULL, 0x2cfe5cc7ULL, 0xd7db3888ULL, 0x9e968591ULL, 0xb97e0b9eULL, 0xf690626aULL, 0xd7db3888ULL},
+{0x6c017ab9ULL, 0xb43af006ULL, 0x8600bc69ULL, 0x6ff15471ULL, 0xa0535923ULL, 0xb43af006ULL, 0xbf1007ebULL, 0xef6963f3ULL, 0xa0535923ULL},
+{0x95c3110dULL, 0x225d408ULL, 0x6d8920dbULL, 0xd3138c5eULL, 0x878418bcULL, 0x225d408ULL, 0x3967378eULL, 0x7574203eULL, 0x878418bcULL},
+{0xb69e2054ULL, 0xd156263fULL, 0xea175cd6ULL, 0xe379128eULL, 0xf9c1fa40ULL, 0xd156263fULL, 0xd4ac0062ULL, 0x7c0a7a7bULL, 0xf9c1fa40ULL},
+{0x8bf1e2e1ULL, 0xed0ddd42ULL, 0x4cee22f2ULL, 0x30fa82d1ULL, 0x8866def5ULL, 0xed0ddd42ULL, 0xabbf1c57ULL, 0x3b613292ULL, 0x8866def5ULL},
+{0xb01bd55cULL, 0xd5f4ce76ULL, 0x3d84aedeULL, 0x52b6b419ULL, 0x2a5dd13dULL, 0xd5f4ce76ULL, 0x805cb484ULL, 0xce46305aULL, 0x2a5dd13dULL},
+{0x9988480dULL, 0xb18450e2ULL, 0x62fafb62ULL, 0x57be8adaULL, 0xdbbc21d0ULL, 0xb18450e2ULL, 0xb8cadfecULL, 0x2d116310ULL, 0xdbbc21d0ULL},
+{0x3c676b79ULL, 0xde178df3ULL, 0x97ad6520ULL, 0x1c3ebbe4ULL, 0xc198ff4fULL, 0xde178df3ULL, 0x64611a87ULL, 0xaa6bda8fULL, 0xc198ff4fULL},
+{0x35debe7dULL, 0xc07e47b3ULL, 0xbd3704daULL, 0x10ac9296ULL, 0x6516faacULL, 0xc07e47b3ULL, 0xcb3f332fULL, 0xa5ee1237ULL, 0x6516faacULL},
+{0xde0c589aULL, 0x64acf40dULL, 0xc2c8b216ULL, 0x68034d41ULL, 0xac4804ffULL, 0x64acf40dULL, 0xcd114699ULL, 0x53717ULL, 0xac4804ffULL},
+{0xd71b1520ULL, 0xac01efdcULL, 0xc7789ec6ULL, 0x773cd705ULL, 0x594b6798ULL, 0xac01efdcULL, 0x2312a604ULL, 0x4ec59e75ULL, 0x594b6798ULL},
+{0x5f856935ULL, 0xa840eff7ULL, 0xf77ba4baULL, 0x8efaf424ULL, 0xe4b09d90ULL, 0xa840eff7ULL, 0x66d28cfcULL, 0xbcc85a22ULL, 0xe4b09d90ULL},
+{0x657cac3cULL, 0x90d12893ULL, 0xc1d77f2eULL, 0x363423a9ULL, 0x766a6cb3ULL, 0x90d12893ULL, 0x8f2aaeaULL, 0x888dea76ULL, 0x766a6cb3ULL},
+{0x492d3699ULL, 0x51116fdeULL, 0x6ee8c72aULL, 0xa991f368ULL, 0x7c9c1aa7ULL, 0x51116fdeULL, 0xdf8459f0ULL, 0x9d717e9bULL, 0x7c9c1aa7ULL},
+{0x993f7451ULL, 0xb52dab21ULL, 0x5ed53817ULL, 0x1f5af451ULL, 0x276b50bdULL, 0xb52dab21ULL, 0xfd14f9c8ULL, 0x2bd52e26ULL, 0x276b50bdULL},
+{0x3cd4c9b2ULL, 0x190d3236ULL, 0xced4f60eULL, 0xcbd6f686ULL, 0x8c61b7eeULL, 0x190d3236ULL, 0x1815a8a8ULL, 0xc8763865ULL, 0x8c61b7eeULL},
+{0x2a71fbc7ULL, 0xa0dac609ULL, 0x65a2f51eULL, 0x8ce65cdeULL, 0x6a0384edULL, 0xa0dac609ULL, 0x9640aab4ULL, 0x8d490cedULL, 0x6a0384edULL},
+{0x3815872eULL, 0x97dd8870ULL, 0x4155af53ULL, 0x1980c8fbULL, 0x13e00577ULL, 0x97dd8870ULL, 0x9be574d0ULL, 0x963eb548ULL, 0x13e00577ULL},
+{0x9cae43bdULL, 0xe6bba4feULL, 0x1bb76cdfULL, 0x6c3f8708ULL, 0xdaa62c3bULL, 0xe6bba4feULL, 0x3a5ae99aULL, 0x28f636a8ULL, 0xdaa62c3bULL},
+{0x8a2cf4edULL, 0x4a00491ULL, 0x3398f1c0ULL, 0xbd974d23ULL, 0x9ade2b2cULL, 0x4a00491ULL, 0xd653e7e0ULL, 0xc534900dULL, 0x9ade2b2cULL},
+{0xb86755b7ULL, 0xb4a467b7ULL, 0x9022fa13ULL, 0xc9e6ad74ULL, 0x9b0a1152ULL, 0xb4a467b7ULL, 0x93868ebULL, 0x13ee2206ULL, 0x9b0a1152ULL},
+{0xc152c5f8ULL, 0xca383c04ULL, 0x81415daaULL, 0x734d4634ULL, 0x75e1f7e1ULL, 0xca383c04ULL, 0x3ed5d0d5ULL, 0x3796cca1ULL, 0x75e1f7e1ULL},
+{0xf8c935ebULL, 0x4faabda6ULL, 0x6f9c4220ULL, 0x5c351c0cULL, 0x172a85b6ULL, 0x4faabda6ULL, 0x34b493e6ULL, 0x242e167dULL, 0x172a85b6ULL},
+{0xfb0bd1e1ULL, 0x66997edaULL, 0x34508869ULL, 0x9df177ecULL, 0xf2db3058ULL, 0x66997edaULL, 0xb20cc874ULL, 0xf414d5c2ULL, 0xf2db3058ULL},
+{0xf20cc5d9ULL, 0xabb931c1ULL, 0x2c55c29eULL, 0x33a9d94bULL, 0xfd9a4f76ULL, 0xabb931c1ULL, 0x413b740ULL, 0x1ed3def1ULL, 0xfd9a4f76ULL},
+{0xbbe58663ULL, 0xff0c2623ULL, 0xedf10921ULL, 0x65468225ULL, 0x16a5488aULL, 0xff0c2623ULL, 0x9348b928ULL, 0xec477d3eULL, 0x16a5488aULL},
+{0x8b9115f5ULL, 0x4aff5eb7ULL, 0x72ba36f0ULL, 0xf4b64cdULL, 0x7096ce11ULL, 0x4aff5eb7ULL, 0xd04186b1ULL, 0xaa2f0c18ULL, 0x7096ce11ULL},
+{0xb74153e5ULL, 0x533f0a70ULL, 0x5f2271d5ULL, 0xc93fcfa5ULL, 0x34a78a2fULL, 0x533f0a70ULL, 0xe880aa0eULL, 0xe6bd6796ULL, 0x34a78a2fULL},
+{0x4c4de86dULL, 0x3cd9a1b6ULL, 0xb95a3c98ULL, 0x5894caeULL, 0xccca371bULL, 0x3cd9a1b6ULL, 0x5a760fddULL, 0x1a675fdfULL, 0xccca371bULL},
+{0xf3c818e6ULL, 0x66eadfd8ULL, 0x811097e7ULL, 0xcd440537ULL, 0x19a0fd47ULL, 0x66eadfd8ULL, 0xfac46825ULL, 0x62f5965ULL, 0x19a0fd47ULL},
+{0x8838811bULL, 0xc3c1925eULL, 0x689bb9c0ULL, 0x4b8aaadbULL, 0x19637bbfULL, 0xc3c1925eULL, 0xa0b3ca4aULL, 0x4361db92ULL, 0x19637bbfULL},
+{0x8af77eceULL, 0x8bec9715ULL, 0x768c8591ULL, 0xb0226beeULL, 0xc675707eULL, 0x8bec9715ULL, 0x379c3351ULL, 0xd6b7a149ULL, 0xc675707eULL},
+{0xbbf71fc6ULL, 0xfe0eac7fULL, 0xabd7169bULL, 0x34bb179eULL, 0xe3bb8404ULL, 0xfe0eac7fULL, 0x3f632e08ULL, 0x12b386d3ULL, 0xe3bb8404ULL},
+{0xee223e6ULL, 0x663230caULL, 0x990e4483ULL, 0xd1bc03beULL, 0x6eddcd6ULL, 0x663230caULL, 0xa7197a52ULL, 0xae585ff0ULL, 0x6eddcd6ULL},
+{0xe014e89dULL, 0x2e8da826ULL, 0x54782a23ULL, 0x56a7dbe5ULL, 0x246a49a5ULL, 0x2e8da826ULL, 0xe8437df9ULL, 0xfc9b0e84ULL, 0x246a49a5ULL},
+{0x4fe7d94fULL, 0x9d319d07ULL, 0x895ecc0bULL, 0x1d3bab79ULL, 0x384b2800ULL, 0x9d319d07ULL, 0xf0d9891dULL, 0x4ff67f9ULL, 0x384b2800ULL},
+{0x375c6bc5ULL, 0xf31420f0ULL, 0x857b1c2bULL, 0x7cce9626ULL, 0x9013d019ULL, 0xf31420f0ULL, 0xbcd30a70ULL, 0x19845c66ULL, 0x9013d019ULL},
+{0xded92b34ULL, 0x9bfadfe6ULL, 0x75cde7acULL, 0xc19f1e8cULL, 0xad245226ULL, 0x9bfadfe6ULL, 0x17f501aULL, 0x971613a1ULL, 0xad245226ULL},
+{0x397b797eULL, 0xed9fa15eULL, 0x1ad21e02ULL, 0x21693175ULL, 0x64354c51ULL, 0xed9fa15eULL, 0x704d5afcULL, 0x8657298ULL, 0x64354c51ULL},
+{0x3db93bf1ULL, 0x9bb879baULL, 0xcaa75c67ULL, 0x8793ba8eULL, 0xff2e1f4dULL, 0x9bb879baULL, 0x6942ae3fULL, 0x4c58e665ULL, 0xff2e1f4dULL},
+{0xfbd2d7fULL, 0xff452110ULL, 0x6ec543abULL, 0xfdff26e7ULL, 0xab377d00ULL, 0xff452110ULL, 0xb0640ccfULL, 0xdc336ee1ULL, 0xab377d00ULL},
+{0x760b175aULL, 0x8e8a59dfULL, 0x716229eaULL, 0x3834f8ddULL, 0xd76d42f5ULL, 0x8e8a59dfULL, 0xc98b1383ULL, 0x980c9d18ULL, 0xd76d42f5ULL},
+{0xb92a6d0eULL, 0x60736229ULL, 0x8c495f86ULL, 0x6c9d65adULL, 0x2cf669ULL, 0x60736229ULL, 0x9ba9e0bdULL, 0x1bf1e4d7ULL, 0x2cf669ULL},
+{0xb1af6054ULL, 0xc1790356ULL, 0xe7f13e6cULL, 0x423d4314ULL, 0x19656e53ULL, 0xc1790356ULL, 0xb7169caULL, 0xc5c22c83ULL, 0x19656e53ULL},
+{0xc62ce04dULL, 0xcc92411cULL, 0x88b2c18ULL, 0x1638f0bfULL, 0x4b3094d8ULL, 0xcc92411cULL, 0xd22aa27dULL, 0x45db42b9ULL, 0x4b3094d8ULL},
+{0xae1f6340ULL, 0x8ca990f6ULL, 0x3e8731edULL, 0x579239a3ULL, 0xb0ca7bc5ULL, 0x8ca990f6ULL, 0x7205aca7ULL, 0xc7e80239ULL, 0xb0ca7bc5ULL},
+{0xe166f1abULL, 0xade370dfULL, 0xaf0229bbULL, 0x9f0c02ccULL, 0xc4900734ULL, 0xade370dfULL, 0x951fa1f7ULL, 0xccfaa938ULL, 0xc4900734ULL},
+{0xbc3ae048ULL, 0x8ae31beULL, 0x636164b2ULL, 0x707faff7ULL, 0x54d62ffdULL, 0x8ae31beULL, 0xd69f7bfdULL, 0x632aab8ULL, 0x54d62ffdULL},
+{0xe5f4483aULL, 0x31281c64ULL, 0xc0e52ec0ULL, 0xd086fa1eULL, 0x568adf94ULL, 0x31281c64ULL, 0x62991755ULL, 0xdd4cbba7ULL, 0x568adf94ULL},
+{0xa78a76d8ULL, 0x331af2ULL, 0x2504c6faULL, 0x5d6e020dULL, 0x26795f84ULL, 0x331af2ULL, 0xca70b3e7ULL, 0xe1fb7cebULL, 0x26795f84ULL},
+{0xca8475dfULL, 0x5968f426ULL, 0xcd5b6581ULL, 0x8bc0a1bdULL, 0xd3461119ULL, 0x5968f426ULL, 0xf9edc8deULL, 0xb724fcf8ULL, 0xd3461119ULL},
+{0x4bd33883ULL, 0xbfd1039cULL, 0x56abcaa0ULL, 0xdcfe47d0ULL, 0xb8edb55dULL, 0xbfd1039cULL, 0x38603067ULL, 0x9ee16bafULL, 0xb8edb55dULL},
+{0x137125e4ULL, 0xd478dc6cULL, 0xd912d6c5ULL, 0x4244af5cULL, 0xf730f35cULL, 0xd478dc6cULL, 0xb416b6b0ULL, 0x79aa552cULL, 0xf730f35cULL},
+{0x41637b7ULL, 0x527938b2ULL, 0x137f2aa2ULL, 0xa2bcf82fULL, 0x7dbf806eULL, 0x527938b2ULL, 0x13ba50ceULL, 0x11785a4cULL, 0x7dbf806eULL},
+{0x24ee9e0dULL, 0x1602caf4ULL, 0xa783caaaULL, 0x45921728ULL, 0x6704d23cULL, 0x1602caf4ULL, 0x82a42da5ULL, 0x3f2d0640ULL, 0x6704d23cULL},
+{0xe2b03eb7ULL, 0x9fcaf347ULL, 0x2ca53056ULL, 0x9cc1b804ULL, 0xc1df8faULL, 0x9fcaf347ULL, 0x3d1da017ULL, 0xfe44bc7dULL, 0xc1df8faULL},
+{0xa8b2b89dULL, 0x91954bd0ULL, 0xc469ebb1ULL, 0x76bb950ULL, 0x2502603eULL, 0x91954bd0ULL, 0xab5e9837ULL, 0x47508a2ULL, 0x2502603eULL},
+{0xb0c040e2ULL, 0xc37db37eULL, 0x16a1cb64ULL, 0x8b1c6246ULL, 0xfe88be17ULL, 0xc37db37eULL, 0x3c8eb312ULL, 0xee6e836fULL, 0xfe88be17ULL},
+{0xd7cfbefcULL, 0xb5e83407ULL, 0x3089983cULL, 0x58adcc8eULL, 0xf6210f72ULL, 0xb5e83407ULL, 0x6af519e5ULL, 0x65be88d6ULL, 0xf6210f72ULL},
+{0xca187a2eULL, 0xb863e12fULL, 0x54777338ULL, 0x2d7bf236ULL, 0xc0e32b92ULL, 0xb863e12fULL, 0xa352696dULL, 0x7785d26cULL, 0xc0e32b92ULL},
+{0x2f7b1d78ULL, 0x2f34913fULL, 0xed9c9451ULL, 0x2e7813caULL, 0xbec1312dULL, 0x2f34913fULL, 0x1a367c41ULL, 0x8a9b356cULL, 0xbec1312dULL},
+{0xc985a83cULL, 0x3f716d1ULL, 0xf454e6f5ULL, 0x89211868ULL, 0x6249d4deULL, 0x3f716d1ULL, 0x9bbe882aULL, 0xa172b890ULL, 0x6249d4deULL},
+{0x596e876eULL, 0xfec82eaaULL, 0x4c456523ULL, 0xa5533040ULL, 0x6959e300ULL, 0xfec82eaaULL, 0x5f6e1b69ULL, 0x8900b09eULL, 0x6959e300ULL},
+{0x18acb260ULL, 0xd4d99589ULL, 0xbddba2adULL, 0xa39f9259ULL, 0xdc7c7158ULL, 0xd4d99589ULL, 0x2b167dfcULL, 0x5e1ac70dULL, 0xdc7c7158ULL},
+{0xf2eeca4cULL, 0x99be0a87ULL, 0x79f0b817ULL, 0x745d2e4aULL, 0x4e269f77ULL, 0x99be0a87ULL, 0x5f842940ULL, 0xf3dbfb1eULL, 0x4e269f77ULL},
+{0xc70fb86eULL, 0x374120a4ULL, 0xa7830479ULL, 0xd957b8e9ULL, 0x747f0991ULL, 0x374120a4ULL, 0x792027b6ULL, 0x15e9b85bULL, 0x747f0991ULL},
+{0xc0cceff1ULL, 0x2cc872e8ULL, 0xadb22dabULL, 0xfee39248ULL, 0xe17356deULL, 0x2cc872e8ULL, 0x6b8263c0ULL, 0x51c30c26ULL, 0xe17356deULL},
+{0x7b5e2321ULL, 0xfaad4bcfULL, 0xacd9a6b4ULL, 0x98491f47ULL, 0x42cd5cfdULL, 0xfaad4bcfULL, 0x99859129ULL, 0xba0a91f6ULL, 0x42cd5cfdULL},
+{0xff64d9dcULL, 0xcd101b6eULL, 0xe62628beULL, 0x7878e923ULL, 0x3797952bULL, 0xcd101b6eULL, 0xee15b508ULL, 0x9b01c5dULL, 0x3797952bULL},
+{0x41b6738ULL, 0x95d81b9bULL, 0x72352296ULL, 0x599c222bULL, 0xc18dd1a9ULL, 0x95d81b9bULL, 0x88d6b5a9ULL, 0x2db19973ULL, 0xc18dd1a9ULL},
+{0x86bc7560ULL, 0x980a6ea8ULL, 0x8d15de8bULL, 0xa86261a3ULL, 0x7bfb4f72ULL, 0x980a6ea8ULL, 0x2c0a7cf5ULL, 0xc007a072ULL, 0x7bfb4f72ULL},
+{0x9d7875c2ULL, 0x321c3e7cULL, 0xfdb73384ULL, 0x58dc6edaULL, 0x167f2582ULL, 0x321c3e7cULL, 0x47abc009ULL, 0xfb11d62fULL, 0x167f2582ULL},
+{0x2a0d8939ULL, 0xcef4c097ULL, 0xb5526af5ULL, 0x5f65d702ULL, 0x4558ed41ULL, 0xcef4c097ULL, 0x843bdb85ULL, 0x8d6767d3ULL, 0x4558ed41ULL},
+{0x9a927e27ULL, 0xb6fd0579ULL, 0xa1b2510eULL, 0x299a57a2ULL, 0xe047106aULL, 0xb6fd0579ULL, 0xf9cc8264ULL, 0xcf1aff4aULL, 0xe047106aULL},
+{0x74964786ULL, 0xf5db1ab0ULL, 0xc1212e0fULL, 0x9ab23ac0ULL, 0xda722b28ULL, 0xf5db1ab0ULL, 0x73b02825ULL, 0x21e1796bULL, 0xda722b28ULL},
+{0x31b1e773ULL, 0x5b4bec7ULL, 0x65eb9609ULL, 0x14f760c4ULL, 0xec86e0b0ULL, 0x5b4bec7ULL, 0x84986861ULL, 0xc368a55cULL, 0xec86e0b0ULL},
+{0xeff5506ULL, 0xaafd6bb8ULL, 0x85fba194ULL, 0x96680ee8ULL, 0xeefbf336ULL, 0xaafd6bb8ULL, 0xe969e51aULL, 0xf8e3185cULL, 0xeefbf336ULL},
+{0x831bc7d4ULL, 0x50e56b6cULL, 0xf9f0481bULL, 0xd8a4790bULL, 0x88b51183ULL, 0x50e56b6cULL, 0x6663fa31ULL, 0x14fc8b78ULL, 0x88b51183ULL},
+{0x6e1bc1b5ULL, 0xf0f99be2ULL, 0xfcd44fafULL, 0x24281189ULL, 0x9da46f4dULL, 0xf0f99be2ULL, 0x9e740206ULL, 0x50018d13ULL, 0x9da46f4dULL},
+{0x557e6e8aULL, 0x5e892b12ULL, 0x5682884fULL, 0x4489c067ULL, 0x1e2edd05ULL, 0x5e892b12ULL, 0xed4d9645ULL, 0xc09c93aULL, 0x1e2edd05ULL},
+{0xa9556583ULL, 0x233d8a43ULL, 0xe250ef1eULL, 0xf08497adULL, 0xcb28a8bULL, 0x233d8a43ULL, 0xfaee2f14ULL, 0xa6dd0bffULL, 0xcb28a8bULL},
+{0x6c87b134ULL, 0xdf7f28a1ULL, 0xb1d9886dULL, 0x86a42376ULL, 0x57dbb36fULL, 0xdf7f28a1ULL, 0xd37ad8a6ULL, 0xb35175dfULL, 0x57dbb36fULL},
+{0xc0c8703aULL, 0x4d4b4d17ULL, 0x12dec275ULL, 0xfc7e3ab7ULL, 0xcdc6a18aULL, 0x4d4b4d17ULL, 0xad530df8ULL, 0x45e0d983ULL, 0xcdc6a18aULL},
+{0x7ff4cdd4ULL, 0xbaaa805ULL, 0xfe2c3d55ULL, 0x7f602d4aULL, 0x932c3afaULL, 0xbaaa805ULL, 0xe2f410e4ULL, 0x837aa063ULL, 0x932c3afaULL},
+{0x9267bb1cULL, 0x9078ff56ULL, 0x6e1e69d4ULL, 0xf4c19a0ULL, 0xbe78a5b4ULL, 0x9078ff56ULL, 0xa6dbea14ULL, 0x3dcd5041ULL, 0xbe78a5b4ULL},
+{0xaff04d5eULL, 0x862bffcbULL, 0xb848f712ULL, 0x970a4992ULL, 0x8ce36808ULL, 0x862bffcbULL, 0x3d6492daULL, 0x5c152cc3ULL, 0x8ce36808ULL},
+{0xef403f8eULL, 0x3bc00eedULL, 0x96068b53ULL, 0x151a124bULL, 0x49cd1e49ULL, 0x3bc00eedULL, 0x9effff90ULL, 0xb9d8e421ULL, 0x49cd1e49ULL},
+{0x78aca39eULL, 0xcfadc707ULL, 0x27286f2dULL, 0x72e13eaeULL, 0x19c4975fULL, 0xcfadc707ULL, 0x9ee99944ULL, 0x4caa8d2aULL, 0x19c4975fULL},
+{0x1e5c26d3ULL, 0xe2dce2eeULL, 0xd2806606ULL, 0x45975e51ULL, 0x4bc42947ULL, 0xe2dce2eeULL, 0xa063bdfaULL, 0x2c93edeULL, 0x4bc42947ULL},
+{0xa829e5afULL, 0x2dad6c12ULL, 0xa2629be0ULL, 0x4c7e78bdULL, 0x919668eaULL, 0x2dad6c12ULL, 0xda8220cfULL, 0x8731f44aULL, 0x919668eaULL},
+{0xdb519d6cULL, 0x3e6e4767ULL, 0x2bffb619ULL, 0xb07d6c7bULL, 0xff9002baULL, 0x3e6e4767ULL, 0x928cf287ULL, 0x12c11b73ULL, 0xff9002baULL},
+{0xa4924619ULL, 0xf2cd3c50ULL, 0x398ff71ULL, 0x961cad76ULL, 0x97368eb2ULL, 0xf2cd3c50ULL, 0xbc87c76dULL, 0xe2f37617ULL, 0x97368eb2ULL},
+{0xdd7cbf87ULL, 0x5f3c6a87ULL, 0xb0047b88ULL, 0x5426a99ULL, 0x2a1b6ec9ULL, 0x5f3c6a87ULL, 0x800c0c44ULL, 0xbd50bcb6ULL, 0x2a1b6ec9ULL},
+{0x67513162ULL, 0x162d1742ULL, 0xa28fd49eULL, 0xdfc37f5dULL, 0xd30b226dULL, 0x162d1742ULL, 0x40a0b7faULL, 0xbe6fa767ULL, 0xd30b226dULL},
+{0xec17e100ULL, 0xd8d8203eULL, 0xe49d6715ULL, 0x277ff736ULL, 0x80b49697ULL, 0xd8d8203eULL, 0x94d5fc6aULL, 0x9776d151ULL, 0x80b49697ULL},
+{0x7d62f27aULL, 0x8ba38177ULL, 0x60bd6fc6ULL, 0x842ef8a1ULL, 0x2aa281c2ULL, 0x8ba38177ULL, 0x5332b089ULL, 0x6c29e447ULL, 0x2aa281c2ULL},
+{0x5db75a24ULL, 0xa08b343ULL, 0x22c51da9ULL, 0xb72de716ULL, 0xf5fe0f0aULL, 0xa08b343ULL, 0x4ec19a57ULL, 0x64f9bc10ULL, 0xf5fe0f0aULL},
+{0x8e0916d2ULL, 0x553881d6ULL, 0x101ab1c5ULL, 0x44a9e9efULL, 0x581cae6ULL, 0x553881d6ULL, 0xebb910a1ULL, 0xec4bf261ULL, 0x581cae6ULL},
+{0x2b27287ULL, 0xa73dd989ULL, 0x1665cffaULL, 0x90c3841cULL, 0xae9e50cfULL, 0xa73dd989ULL, 0x810d7d41ULL, 0xe1eb3315ULL, 0xae9e50cfULL},
+{0x16c24f82ULL, 0xa75dc966ULL, 0xeda42a22ULL, 0x58c943a4ULL, 0x19c877c6ULL, 0xa75dc966ULL, 0x6babb47eULL, 0xa7d9c955ULL, 0x19c877c6ULL},
+{0x35fcd749ULL, 0xfa46db1cULL, 0xc41e66d2ULL, 0x411cffeeULL, 0x4f826c34ULL, 0xfa46db1cULL, 0xdc2577c4ULL, 0x6e4391f7ULL, 0x4f826c34ULL},
+{0xa3d04da2ULL, 0x4bafd5e0ULL, 0xe8406879ULL, 0xf06f4138ULL, 0x802906fcULL, 0x4bafd5e0ULL, 0xcea18552ULL, 0xe4aa72a3ULL, 0x802906fcULL},
+{0xef3afa80ULL, 0x498d03ecULL, 0xf96b3601ULL, 0x71fad3aULL, 0xfd711e55ULL, 0x498d03ecULL, 0x5eccf56fULL, 0xc5b04db5ULL, 0xfd711e55ULL},
+{0x1603121eULL, 0x59b2c1f4ULL, 0xfa9429a0ULL, 0x850ecba8ULL, 0xef4b3c3eULL, 0x59b2c1f4ULL, 0xf7ceb8cdULL, 0x57c8a0e8ULL, 0xef4b3c3eULL},
+{0x54e5a272ULL, 0x15fd5972ULL, 0x6d5dde99ULL, 0xf7b588f5ULL, 0xce05b8daULL, 0x15fd5972ULL, 0xd958fe28ULL, 0x5ca6e9e1ULL, 0xce05b8daULL},
+{0x8660f7d5ULL, 0xfd30d39dULL, 0xa0681d17ULL, 0x38f287fULL, 0xdcb98d14ULL, 0xfd30d39dULL, 0xa8b37710ULL, 0x9835962cULL, 0xdcb98d14ULL},
+{0x34b95880ULL, 0x88540664ULL, 0xbf2a57a3ULL, 0x12440b7dULL, 0x5d88b4f1ULL, 0x88540664ULL, 0x4770a2f5ULL, 0x8a21d498ULL, 0x5d88b4f1ULL},
+{0x96cca725ULL, 0xc9bc7fdfULL, 0x561e29fdULL, 0xe5fd4be0ULL, 0xc9f90222ULL, 0xc9bc7fdfULL, 0xefcec977ULL, 0xa46fe1a7ULL, 0xc9f90222ULL},
+{0x12aeba5cULL, 0x4200bf9ULL, 0xeb4d9763ULL, 0x222c0039ULL, 0x7b8a2608ULL, 0x4200bf9ULL, 0xeeba0dffULL, 0x6a5f05beULL, 0x7b8a2608ULL},
+{0xf7c0997dULL, 0xf6e75e07ULL, 0x9384379bULL, 0x22acd835ULL, 0xa5a9edcbULL, 0xf6e75e07ULL, 0xd7ba99a6ULL, 0x8f4e305ULL, 0xa5a9edcbULL},
+{0xd0c550dcULL, 0xdcc7e6b8ULL, 0xef191d5aULL, 0xaecf91feULL, 0x4614bfb4ULL, 0xdcc7e6b8ULL, 0xaac98fb7ULL, 0x93518701ULL, 0x4614bfb4ULL},
+{0xf420e0b4ULL, 0x2d0fb6b2ULL, 0xd684cc5aULL, 0x37ef37dfULL, 0x4c4d0f02ULL, 0x2d0fb6b2ULL, 0xd28df89eULL, 0xd0ccfb1aULL, 0x4c4d0f02ULL},
+{0xc3c9ffe7ULL, 0x6ae292c5ULL, 0x541f62c7ULL, 0x98a3cfafULL, 0xa9ced091ULL, 0x6ae292c5ULL, 0xb532a09ULL, 0xf9430a61ULL, 0xa9ced091ULL},
+{0x9ad47ff2ULL, 0xd8f576e9ULL, 0xcb95fd8ULL, 0xe82f5187ULL, 0x923ccd85ULL, 0xd8f576e9ULL, 0xa4677f17ULL, 0xaf9da0bbULL, 0x923ccd85ULL},
+{0x8d508e7bULL, 0x9a60afafULL, 0x83e1a098ULL, 0x163ab548ULL, 0x8fb5dcaULL, 0x9a60afafULL, 0x55936264ULL, 0xf1e07707ULL, 0x8fb5dcaULL},
+{0xeb934cd9ULL, 0xdcf71ef4ULL, 0xce800e02ULL, 0x26910371ULL, 0xcbaf0e0bULL, 0xdcf71ef4ULL, 0x8686b48fULL, 0x57f855e7ULL, 0xcbaf0e0bULL},
+{0x56102a94ULL, 0xd82192dbULL, 0xd44ab042ULL, 0xe41ffaebULL, 0xadced61fULL, 0xd82192dbULL, 0xe2dbab94ULL, 0x9e508afdULL, 0xadced61fULL},
+{0xe5a5529aULL, 0x38cc260ULL, 0x2c16da19ULL, 0x6c4be2fdULL, 0xa3cbbcd8ULL, 0x38cc260ULL, 0xfc6cbe25ULL, 0x42447334ULL, 0xa3cbbcd8ULL},
+{0x596d446bULL, 0x7e41d049ULL, 0x186b08b5ULL, 0x285b0946ULL, 0x52268e2dULL, 0x7e41d049ULL, 0xa1794be3ULL, 0x3f8ad10cULL, 0x52268e2dULL},
+{0xa199f216ULL, 0x87d8bbb3ULL, 0xce3b138eULL, 0x767d4cf6ULL, 0x33d10843ULL, 0x87d8bbb3ULL, 0x7cea2e62ULL, 0x665586c5ULL, 0x33d10843ULL},
+{0x2ad2b220ULL, 0x580f49c6ULL, 0xcc4b02b4ULL, 0x288830cfULL, 0x87bf41e4ULL, 0x580f49c6ULL, 0x1c4d13a3ULL, 0x3b9011afULL, 0x87bf41e4ULL},
+{0x1148485cULL, 0x8b879cdaULL, 0x796ff91aULL, 0x230c3e1bULL, 0x14154e15ULL, 0x8b879cdaULL, 0x61c89e7aULL, 0xa8ff5c3fULL, 0x14154e15ULL},
+{0xd2100341ULL, 0x5d6dec1ULL, 0xfeb59750ULL, 0x5c130cbfULL, 0x8b07d499ULL, 0x5d6dec1ULL, 0x5e34494bULL, 0xe455a5baULL, 0x8b07d499ULL},
+{0xe4125abdULL, 0xe5e2c3dULL, 0x3721e03ULL, 0x9148e5d7ULL, 0x22c8e34eULL, 0xe5e2c3dULL, 0x52fc669aULL, 0xbebedd0aULL, 0x22c8e34eULL},
+{0xc897670bULL, 0xf6ca423dULL, 0x3e53359cULL, 0x7122adfeULL, 0x6bf31d6bULL, 0xf6ca423dULL, 0xefc91a9eULL, 0xecf4af06ULL, 0x6bf31d6bULL},
+{0x667c0c7fULL, 0xb347d3f0ULL, 0x6ab5e948ULL, 0x8be66bf9ULL, 0x40dd00e9ULL, 0xb347d3f0ULL, 0x30c3279bULL, 0x6156251dULL, 0x40dd00e9ULL},
+{0x2c5f33d2ULL, 0x2e2ec6a3ULL, 0xb015eb4aULL, 0x51533671ULL, 0xe8fd7940ULL, 0x2e2ec6a3ULL, 0xa735b527ULL, 0xe87313ecULL, 0xe8fd7940ULL},
+{0x70bed3e6ULL, 0xe384ed93ULL, 0xcd82b0cULL, 0xf738db5aULL, 0xea2dfdacULL, 0xe384ed93ULL, 0xd46ee123ULL, 0xa3cf5952ULL, 0xea2dfdacULL},
+{0x22048df7ULL, 0x191a363eULL, 0xac8fd834ULL, 0xa3022ca8ULL, 0x333a1716ULL, 0x191a363eULL, 0x146e8df7ULL, 0x6184982eULL, 0x333a1716ULL},
+{0x5f8f4c40ULL, 0xf52e64c7ULL, 0x959d52a2ULL, 0xbf9696d8ULL, 0x34d10ed1ULL, 0xf52e64c7ULL, 0x1f361f6ULL, 0x5874f884ULL, 0x34d10ed1ULL},
+{0x202ce827ULL, 0x37f447aaULL, 0x411a7194ULL, 0xf4d335afULL, 0x3835ec27ULL, 0x37f447aaULL, 0x3a21851eULL, 0x16a89616ULL, 0x3835ec27ULL},
+{0xc8ae3046ULL, 0x655822b0ULL, 0x60fac11aULL, 0xf8ce00daULL, 0xb28a712fULL, 0x655822b0ULL, 0x2724688cULL, 0xc3405956ULL, 0xb28a712fULL},
+{0xc1257d03ULL, 0x20a878faULL, 0x4f907051ULL, 0x94ece843ULL, 0x39cdaf65ULL, 0x20a878faULL, 0xdde4bbceULL, 0x417a4a4bULL, 0x39cdaf65ULL},
+{0x783a81c3ULL, 0x87ef8f10ULL, 0x538d14dcULL, 0x7ce07c59ULL, 0xfa39cd3bULL, 0x87ef8f10ULL, 0x1e4195e0ULL, 0x47a2ffadULL, 0xfa39cd3bULL},
+{0xc1a3de3aULL, 0x2e4224abULL, 0x8f2f6ab4ULL, 0xcdc31961ULL, 0x553057b1ULL, 0x2e4224abULL, 0x10c0cac8ULL, 0x2eb4a85cULL, 0x553057b1ULL},
+{0xb846fed7ULL, 0xd201f39fULL, 0x5e9520d6ULL, 0xf9086bd1ULL, 0xa5677c9aULL, 0xd201f39fULL, 0x8309da85ULL, 0xbba229eULL, 0xa5677c9aULL},
+{0xed996db6ULL, 0x30eb30f3ULL, 0x5d27fcc5ULL, 0x809c1bfULL, 0xa82674b1ULL, 0x30eb30f3ULL, 0x1905b4fULL, 0x5e4ca8e3ULL, 0xa82674b1ULL},
+{0x8eb644ecULL, 0x2aa987caULL, 0x3e61eeabULL, 0x4f22e1d0ULL, 0x83be197bULL, 0x2aa987caULL, 0xb759e5ecULL, 0xfc582fa9ULL, 0x83be197bULL},
+{0x1891451ULL, 0x6965b730ULL, 0x515b1275ULL, 0xf3fea759ULL, 0xff369310ULL, 0x6965b730ULL, 0x8825e528ULL, 0x86adec03ULL, 0xff369310ULL},
+{0xc6311754ULL, 0x77eae6f1ULL, 0xf81766d5ULL, 0xb742fc75ULL, 0x285fa9dcULL, 0x77eae6f1ULL, 0x3a4b1aa0ULL, 0x55a1fc6ULL, 0x285fa9dcULL},
+{0xa05bed1eULL, 0x73ba4187ULL, 0x4d9ba84fULL, 0x9c5ea7b6ULL, 0xe6243542ULL, 0x73ba4187ULL, 0xa4403f95ULL, 0x204329e2ULL, 0xe6243542ULL},
+{0x3d4d8dc4ULL, 0xe8faeaa5ULL, 0x8e25903cULL, 0x9a93a34aULL, 0xd3dbe7dULL, 0xe8faeaa5ULL, 0xb185c5e5ULL, 0xe772e9aeULL, 0xd3dbe7dULL},
+{0xc1be4f9bULL, 0xe10b519aULL, 0xde8e77b7ULL, 0x599297f8ULL, 0x1126626aULL, 0xe10b519aULL, 0x9aea89aULL, 0xead2a72ULL, 0x1126626aULL},
+{0x5261fcddULL, 0x3b3a8b9dULL, 0x1c6ea6d8ULL, 0xc7365495ULL, 0xb66315cbULL, 0x3b3a8b9dULL, 0x45fba4c4ULL, 0xfbf07990ULL, 0xb66315cbULL},
+{0xdffdf3a9ULL, 0x9d56f8f1ULL, 0xb20a6062ULL, 0x4b968a52ULL, 0xdfb855c6ULL, 0x9d56f8f1ULL, 0xc844d7dfULL, 0x510d37caULL, 0xdfb855c6ULL},
+{0xc5440daULL, 0xc39a7bdeULL, 0xe99b2633ULL, 0x7fc35717ULL, 0xa39016eULL, 0xc39a7bdeULL, 0x2c64b96eULL, 0x53125679ULL, 0xa39016eULL},
+{0xa057a14dULL, 0xcfefd1f2ULL, 0xe51ef2c6ULL, 0x947d441bULL, 0xad7c0f96ULL, 0xcfefd1f2ULL, 0xa006cf4bULL, 0xdc976791ULL, 0xad7c0f96ULL},
+{0x8d4866fULL, 0xeefe50e2ULL, 0x2a01baa2ULL, 0x8aa72108ULL, 0xeb8924beULL, 0xeefe50e2ULL, 0x33cdfdcaULL, 0xdc4e322ULL, 0xeb8924beULL},
+{0x988f6f8fULL, 0xc3e26104ULL, 0xde825af2ULL, 0x30597af6ULL, 0x7efefb6eULL, 0xc3e26104ULL, 0xc74e4464ULL, 0xc97966b3ULL, 0x7efefb6eULL},
+{0xd855d58eULL, 0x3e475661ULL, 0x33d4546fULL, 0x1953454dULL, 0xc3df08c9ULL, 0x3e475661ULL, 0x4ea11d79ULL, 0x79b0ce2aULL, 0xc3df08c9ULL},
+{0xb3405896ULL, 0xd4b9de31ULL, 0x2cb3a192ULL, 0xf3467f81ULL, 0x2c190f2eULL, 0xd4b9de31ULL, 0x854835c4ULL, 0x6a52753eULL, 0x2c190f2eULL},
+{0xb0ed8c78ULL, 0xac8bad12ULL, 0xd2a56e33ULL, 0x28e9f99fULL, 0xfa9db961ULL, 0xac8bad12ULL, 0x3437e9ecULL, 0xf369784cULL, 0xfa9db961ULL},
+{0x98aefb21ULL, 0xcc3d1ee5ULL, 0x6ec6e1a2ULL, 0xfcf33cbbULL, 0xd604ae99ULL, 0xcc3d1ee5ULL, 0xfc793202ULL, 0xdf5cd802ULL, 0xd604ae99ULL},
+{0x5e111d1fULL, 0x57e4d2ddULL, 0xba54a651ULL, 0x3b11adccULL, 0xf277c40cULL, 0x57e4d2ddULL, 0x6d601168ULL, 0xd88ddaa2ULL, 0xf277c40cULL},
+{0x115b7ea0ULL, 0xd12a1acbULL, 0x865b7638ULL, 0x17c75ad7ULL, 0x573eb955ULL, 0xd12a1acbULL, 0xb23cb673ULL, 0x62bb4ee4ULL, 0x573eb955ULL},
+{0xbe3c596dULL, 0x5cb906ccULL, 0xcd672d80ULL, 0xcdaf4973ULL, 0x18603878ULL, 0x5cb906ccULL, 0xb29a7983ULL, 0x1771ffcaULL, 0x18603878ULL},
+{0xb3f31bc3ULL, 0x63273517ULL, 0xc358e134ULL, 0xbe9de599ULL, 0x7d13a740ULL, 0x63273517ULL, 0x3dfc0a3fULL, 0x2d0d183cULL, 0x7d13a740ULL},
+{0xf06fce2aULL, 0x630423f8ULL, 0x3e0f2242ULL, 0x9629f2f8ULL, 0x9b636420ULL, 0x630423f8ULL, 0xb8252a9ULL, 0xfe3456e7ULL, 0x9b636420ULL},
+{0x6f5042c7ULL, 0xa19df471ULL, 0x2691344dULL, 0x4612d12dULL, 0x2e8de5b1ULL, 0xa19df471ULL, 0xd6cb9a6ULL, 0x7597fa30ULL, 0x2e8de5b1ULL},
+{0x9c87dffbULL, 0xbf5383b5ULL, 0xd5211a89ULL, 0x6b6d2377ULL, 0x119fa36bULL, 0xbf5383b5ULL, 0xbdebdecfULL, 0x5c352132ULL, 0x119fa36bULL},
+{0x20f4ccc8ULL, 0x70b4747ULL, 0xa8142fd4ULL, 0xff934a2dULL, 0xe3748c23ULL, 0x70b4747ULL, 0x22003144ULL, 0xb0ad32beULL, 0xe3748c23ULL},
+{0xa04c652bULL, 0x87f7575aULL, 0x782b32f7ULL, 0xd3d17754ULL, 0xf9983c44ULL, 0x87f7575aULL, 0xd830979fULL, 0x4b4c3d57ULL, 0xf9983c44ULL},
+{0x7a5f2535ULL, 0x1641fe72ULL, 0xbd9c4224ULL, 0xa8efdc91ULL, 0xe669f1b4ULL, 0x1641fe72ULL, 0xaa8ac107ULL, 0x35a1199bULL, 0xe669f1b4ULL},
+{0xe590732cULL, 0x27b82331ULL, 0x2d01ba6cULL, 0xd524d94bULL, 0xf7f502e4ULL, 0x27b82331ULL, 0xbc56f77cULL, 0x24ac78e2ULL, 0xf7f502e4ULL},
+{0x76ab5fb6ULL, 0x89a002d3ULL, 0xd765f644ULL, 0xc77c6d4dULL, 0x1fce9a92ULL, 0x89a002d3ULL, 0x5ea20362ULL, 0x5edf3b63ULL, 0x1fce9a92ULL},
+{0xea7cebaaULL, 0xb6f59216ULL, 0xb48c3721ULL, 0x480478f6ULL, 0x2252ef2eULL, 0xb6f59216ULL, 0x258fba09ULL, 0x5b25e41bULL, 0x2252ef2eULL},
+{0x1f361240ULL, 0x7435c936ULL, 0x9d2905d0ULL, 0x36bd1c50ULL, 0xa8a6624ULL, 0x7435c936ULL, 0x7c422785ULL, 0x5ceb2865ULL, 0xa8a6624ULL},
+{0x75a3e5f9ULL, 0xf490358aULL, 0x5f0e3747ULL, 0x7bdd140ULL, 0xb648eda9ULL, 0xf490358aULL, 0xdd88d422ULL, 0xccd67153ULL, 0xb648eda9ULL},
+{0x2495c37ULL, 0xc2f9aab6ULL, 0xd26f6885ULL, 0x741f24abULL, 0x4ea9a0c3ULL, 0xc2f9aab6ULL, 0x98d54d83ULL, 0x1266fef9ULL, 0x4ea9a0c3ULL},
+{0xd8d65071ULL, 0x492c5472ULL, 0xdfd45e36ULL, 0xb9963720ULL, 0xf1858037ULL, 0x492c5472ULL, 0x7096986bULL, 0xc374dc0dULL, 0xf1858037ULL},
+{0xae8a0effULL, 0x12e947b6ULL, 0x41633f7ULL, 0xb50eef69ULL, 0x23e6f39aULL, 0x12e947b6ULL, 0xd6fb2fadULL, 0x13499ef7ULL, 0x23e6f39aULL},
+{0x753a41efULL, 0x1bf6d798ULL, 0x20515329ULL, 0xf2912f4cULL, 0xb1f46040ULL, 0x1bf6d798ULL, 0xe8e8607fULL, 0x627d6725ULL, 0xb1f46040ULL},
+{0x90db87fcULL, 0x9653c5a2ULL, 0xc50b20ffULL, 0xc41269e5ULL, 0xa311a321ULL, 0x9653c5a2ULL, 0xb7fd2c37ULL, 0x19fb16faULL, 0xa311a321ULL},
+{0xe5dd595bULL, 0xaa2a6591ULL, 0xf3f82e6ULL, 0xb8feeb4eULL, 0x229d5375ULL, 0xaa2a6591ULL, 0x6ec61e15ULL, 0x9eb3e0c7ULL, 0x229d5375ULL},
+{0x2cae8c9dULL, 0xc05931c1ULL, 0xba05126fULL, 0xaa17d1f4ULL, 0x71d9966aULL, 0xc05931c1ULL, 0x9243693aULL, 0xfc2a77a3ULL, 0x71d9966aULL},
+{0xa924e2f8ULL, 0x6878a03cULL, 0x489dc062ULL, 0x3cf0470fULL, 0x1ba66fa8ULL, 0x6878a03cULL, 0x80e9a4cdULL, 0x13ed76d3ULL, 0x1ba66fa8ULL},
+{0xa4b11dc4ULL, 0x9b5a7d71ULL, 0xc8fd6941ULL, 0xd6b8d6a3ULL, 0xdc6e9df6ULL, 0x9b5a7d71ULL, 0x1481d3e2ULL, 0xb9ff1771ULL, 0xdc6e9df6ULL},
+{0xdbab59d1ULL, 0x4fdcfac2ULL, 0x59d311bbULL, 0x3fe614b6ULL, 0xb27d6029ULL, 0x4fdcfac2ULL, 0xb76aeeb8ULL, 0xfd60f55aULL, 0xb27d6029ULL},
+{0xf1598885ULL, 0x139e9a8aULL, 0xcb858e2bULL, 0xd2b7e4a1ULL, 0x6bb94de9ULL, 0x139e9a8aULL, 0xbc47205aULL, 0x95d791faULL, 0x6bb94de9ULL},
+{0x9c924b3aULL, 0x92bb78beULL, 0x6425563ULL, 0xf7a50ca9ULL, 0xae306e8bULL, 0x92bb78beULL, 0x8112e1a0ULL, 0x4aebfef0ULL, 0xae306e8bULL},
+{0x87d64105ULL, 0xff3b2faULL, 0x5ee5a87fULL, 0xc24e3f85ULL, 0x2928d931ULL, 0xff3b2faULL, 0xab14e569ULL, 0x10fa1ed2ULL, 0x2928d931ULL},
+{0xc62f627cULL, 0x85d076adULL, 0x4c057d85ULL, 0x31b3a137ULL, 0x314add2eULL, 0x85d076adULL, 0x9a1d7636ULL, 0x8d432567ULL, 0x314add2eULL},
+{0x1dc915a7ULL, 0x9c71fabbULL, 0x5e6ea15eULL, 0x385b85feULL, 0x8901a5c1ULL, 0x9c71fabbULL, 0x97b415b0ULL, 0xe9e78355ULL, 0x8901a5c1ULL},
+{0x49425ad6ULL, 0x247c3bb0ULL, 0x58303033ULL, 0x1cc2ee94ULL, 0xfacfd482ULL, 0x247c3bb0ULL, 0x83cecc06ULL, 0x40a394ebULL, 0xfacfd482ULL},
+{0x9cc401e2ULL, 0xa4106398ULL, 0xbf6d4af3ULL, 0xd87d8630ULL, 0xa511bfcdULL, 0xa4106398ULL, 0x9afaf528ULL, 0x54703f90ULL, 0xa511bfcdULL},
+{0x4f4629f1ULL, 0xb6728f5cULL, 0x7688b0f3ULL, 0x1315464eULL, 0x80f448a7ULL, 0xb6728f5cULL, 0xd807a92dULL, 0x4d94ba05ULL, 0x80f448a7ULL},
+{0x55e8831ULL, 0xc0800766ULL, 0xfdbcf628ULL, 0x167b9843ULL, 0xdcac73fbULL, 0xc0800766ULL, 0x28e1add2ULL, 0x20151c5eULL, 0xdcac73fbULL},
+{0xb0cd5062ULL, 0x9dd5d963ULL, 0xfaf7fe66ULL, 0x892953f5ULL, 0x9dc48a35ULL, 0x9dd5d963ULL, 0x3982939eULL, 0xde1eb352ULL, 0x9dc48a35ULL},
+{0x8aa9d533ULL, 0xe9a2c405ULL, 0xe2b166b0ULL, 0x9254d164ULL, 0xf561d354ULL, 0xe9a2c405ULL, 0x4710e809ULL, 0xaf64f143ULL, 0xf561d354ULL},
+{0x32a7f8cdULL, 0x6660eb16ULL, 0x80ebe0e1ULL, 0xfe07894dULL, 0x6417643ULL, 0x6660eb16ULL, 0x98c6e590ULL, 0x9e575e88ULL, 0x6417643ULL},
+{0x7927e2dULL, 0xcc739556ULL, 0x1aea554bULL, 0x8fbd5461ULL, 0xd3f7cb82ULL, 0xcc739556ULL, 0x3e523829ULL, 0xde796c92ULL, 0xd3f7cb82ULL},
+{0x7dcba74fULL, 0x31a47239ULL, 0x797f633cULL, 0x7282f75cULL, 0xa2a7bf6aULL, 0x31a47239ULL, 0x446630abULL, 0x60a37168ULL, 0xa2a7bf6aULL},
+{0x4e0deda4ULL, 0xe04b358bULL, 0x1b233539ULL, 0xfacec1f1ULL, 0x2f7a1cf4ULL, 0xe04b358bULL, 0x92d12bfaULL, 0x49ee64b5ULL, 0x2f7a1cf4ULL},
+{0xf150b808ULL, 0x7c0121eULL, 0x18239f4eULL, 0x929d3181ULL, 0x7e7c13ddULL, 0x7c0121eULL, 0x99924a1fULL, 0x48286f16ULL, 0x7e7c13ddULL},
+{0xde730a70ULL, 0x86af3829ULL, 0xf61cc26fULL, 0x3fa16a21ULL, 0x87fe0b3dULL, 0x86af3829ULL, 0xf359cbd2ULL, 0x5a1f9474ULL, 0x87fe0b3dULL},
+{0xa562c1cbULL, 0x9b9eee99ULL, 0x8abb6dc2ULL, 0x49462a78ULL, 0x2cdd68fbULL, 0x9b9eee99ULL, 0x670be423ULL, 0xfdf6c0afULL, 0x2cdd68fbULL},
+{0xb8945abfULL, 0x17159779ULL, 0xe24213faULL, 0xb822fe85ULL, 0xf056a4e8ULL, 0x17159779ULL, 0xc3b2826ULL, 0xb36f6a7ULL, 0xf056a4e8ULL},
+{0xefc75391ULL, 0x2b709d2ULL, 0x94f06e49ULL, 0x8c5107cbULL, 0xf42bbb9fULL, 0x2b709d2ULL, 0xde909169ULL, 0x2336ab09ULL, 0xf42bbb9fULL},
+{0x304273b0ULL, 0x316e857bULL, 0xc59b6bbfULL, 0xc4d67a9cULL, 0x8d2cce87ULL, 0x316e857bULL, 0x5b1ca166ULL, 0xcbbcbe2dULL, 0x8d2cce87ULL},
+{0x4b777482ULL, 0xe2da6b96ULL, 0x671395c3ULL, 0x5c0da686ULL, 0x69e5765bULL, 0xe2da6b96ULL, 0x22924f09ULL, 0x47cd472eULL, 0x69e5765bULL},
+{0xfa90d4dULL, 0xa4c22cbULL, 0x9b07dbceULL, 0x4a656bf8ULL, 0x3cee775dULL, 0xa4c22cbULL, 0x144dee35ULL, 0x3c1213b6ULL, 0x3cee775dULL},
+{0x78f9794ULL, 0xd359c90cULL, 0x3e4bf41eULL, 0x33aa95a8ULL, 0x45228a10ULL, 0xd359c90cULL, 0x9e8d990ULL, 0x2344a5b4ULL, 0x45228a10ULL},
+{0xaf164accULL, 0xa6e6a29ULL, 0x16ea546dULL, 0x3aa007cdULL, 0x78a3194fULL, 0xa6e6a29ULL, 0x69f62ddULL, 0x51be5bd1ULL, 0x78a3194fULL},
+{0x4ff5a9f8ULL, 0xa5f8e825ULL, 0x78ea0031ULL, 0x78cca80cULL, 0xc294450ULL, 0xa5f8e825ULL, 0x48e7c9d5ULL, 0x82157836ULL, 0xc294450ULL},
+{0x9d72ecdULL, 0x6a2082a4ULL, 0x8fef07b4ULL, 0x686f427fULL, 0x622a09fbULL, 0x6a2082a4ULL, 0xbeb18d51ULL, 0x8d1ab9f9ULL, 0x622a09fbULL},
+{0xc273411ULL, 0x5849852eULL, 0x121be24cULL, 0xbd5c1e3aULL, 0x75cd7d97ULL, 0x5849852eULL, 0xbcd4c0c2ULL, 0xf74ca989ULL, 0x75cd7d97ULL}},
+  {{0x8fa35800ULL, 0x4155be49ULL, 0x546a4289ULL, 0x5984d7e1ULL, 0x839eca6ULL, 0x4155be49ULL, 0x606ce53aULL, 0x75ba2fa3ULL, 0x839eca6ULL},
+{0x23baeeeeULL, 0x468653aULL, 0xb0c05893ULL, 0x34ca54dULL, 0xe5ca53daULL, 0x468653aULL, 0xed547268ULL, 0xc7f0112bULL, 0xe5ca53daULL},
+{0xd18e11d2ULL, 0x73b97072ULL, 0xd6098e0fULL, 0xd408120bULL, 0xab3e07bcULL, 0x73b97072ULL, 0xbebf78c7ULL, 0xda074819ULL, 0xab3e07bcULL},
+{0xfe93741dULL, 0x307ba729ULL, 0xce593ef7ULL, 0x3e483749ULL, 0xb48af4ccULL, 0x307ba729ULL, 0xd0b9cc32ULL, 0xc5faabb0ULL, 0xb48af4ccULL},
+{0x6842315cULL, 0x129cfbc6ULL, 0x393a2a06ULL, 0xcd51bdfeULL, 0xfac62635ULL, 0x129cfbc6ULL, 0xaf4523ddULL, 0x215e134aULL, 0xfac62635ULL},
+{0x12d5daddULL, 0xba960f93ULL, 0xe4c15b47ULL, 0x60e6e299ULL, 0xad130cfdULL, 0xba960f93ULL, 0xc097983ULL, 0xdd5aa1c7ULL, 0xad130cfdULL},
+{0xa2760c06ULL, 0xe2dc2924ULL, 0x80be58a4ULL, 0x422f3309ULL, 0x4d321eb1ULL, 0xe2dc2924ULL, 0x9abc5063ULL, 0x7458f22eULL, 0x4d321eb1ULL},
+{0xb6482d5bULL, 0x381cc13cULL, 0x6a55a692ULL, 0x5c2d8140ULL, 0xf56434afULL, 0x381cc13cULL, 0x85f623c9ULL, 0x570f5fe1ULL, 0xf56434afULL},
+{0x6e7e1d8aULL, 0xfb4411eULL, 0xa5a0f043ULL, 0x8440e2e5ULL, 0x74f94da0ULL, 0xfb4411eULL, 0x86b55daaULL, 0x81fb723ULL, 0x74f94da0ULL},
+{0x71c7b07eULL, 0x8ecf3d9cULL, 0x5f8a79a2ULL, 0xda7b5d26ULL, 0xf2a69d77ULL, 0x8ecf3d9cULL, 0x929e92a7ULL, 0xa1bc3731ULL, 0xf2a69d77ULL},
+{0xd1a6af5bULL, 0x7bc12a6bULL, 0xa9e7f6eULL, 0x33fee092ULL, 0xb38f7cf1ULL, 0x7bc12a6bULL, 0xe9786718ULL, 0x94a52b67ULL, 0xb38f7cf1ULL},
+{0xadac6872ULL, 0x91d82501ULL, 0xdbd18333ULL, 0xace44ea7ULL, 0xae0e619cULL, 0x91d82501ULL, 0xb4bb22a4ULL, 0x59fcf90dULL, 0xae0e619cULL},
+{0x11083395ULL, 0xcf3e6607ULL, 0xfda69c70ULL, 0x944f5857ULL, 0x3aac8601ULL, 0xcf3e6607ULL, 0x757be646ULL, 0x91bcfb2ULL, 0x3aac8601ULL},
+{0xf51b6977ULL, 0xe7e66192ULL, 0x5d131023ULL, 0xe17c8331ULL, 0x8d0427baULL, 0xe7e66192ULL, 0xa365e20aULL, 0xa3e35edfULL, 0x8d0427baULL},
+{0x97640a31ULL, 0x18147594ULL, 0xe46366adULL, 0xad18ced3ULL, 0xf4b16c9dULL, 0x18147594ULL, 0x2665e78dULL, 0x7b9778bbULL, 0xf4b16c9dULL},
+{0xfb56feb2ULL, 0xc7d7b295ULL, 0x89fd8e5eULL, 0x2616d2d5ULL, 0x5a138f0ULL, 0xc7d7b295ULL, 0x4a152155ULL, 0xec4ee4b4ULL, 0x5a138f0ULL},
+{0x2fc79525ULL, 0x14c6ade7ULL, 0xc8ef2876ULL, 0x28f2a91cULL, 0x25917942ULL, 0x14c6ade7ULL, 0x1071c064ULL, 0xf43a48c5ULL, 0x25917942ULL},
+{0xb822abf5ULL, 0x5973439bULL, 0x9f251e98ULL, 0xafb92b22ULL, 0x8366b6dbULL, 0x5973439bULL, 0x6dec6927ULL, 0xac3006b6ULL, 0x8366b6dbULL},
+{0x6ba66777ULL, 0x194144eULL, 0x4a19116eULL, 0xd0cd74caULL, 0xaa5c58a2ULL, 0x194144eULL, 0x3ea10419ULL, 0xf4764340ULL, 0xaa5c58a2ULL},
+{0x40be6947ULL, 0x455fe391ULL, 0x6c254f3ULL, 0x890985caULL, 0xa706981dULL, 0x455fe391ULL, 0x3e01dfb1ULL, 0xdf50b030ULL, 0xa706981dULL},
+{0x45a79033ULL, 0xf5202e71ULL, 0xe06ab3cULL, 0xcfb720dcULL, 0x625566b8ULL, 0xf5202e71ULL, 0xd2d0c2c5ULL, 0x6970730ULL, 0x625566b8ULL},
+{0xafa8015aULL, 0xbd916fa2ULL, 0x4038865aULL, 0xbcb0981aULL, 0x4a90d4fcULL, 0xbd916fa2ULL, 0x8a22cbc7ULL, 0x60f43c8aULL, 0x4a90d4fcULL},
+{0x657d8300ULL, 0xb237569eULL, 0x8dba370aULL, 0x94f910caULL, 0x22882a16ULL, 0xb237569eULL, 0x159b9606ULL, 0x869c312aULL, 0x22882a16ULL},
+{0xdccea6b2ULL, 0x6920b1c9ULL, 0xfd736d2aULL, 0xc557e890ULL, 0xce87c6eeULL, 0x6920b1c9ULL, 0x5f8555b6ULL, 0x1fa2d8f0ULL, 0xce87c6eeULL},
+{0x959dd4dbULL, 0xe82d866ULL, 0x8d2767a8ULL, 0xbac8c832ULL, 0x19e59531ULL, 0xe82d866ULL, 0xa89be0ccULL, 0x51d5a933ULL, 0x19e59531ULL},
+{0xd80af41fULL, 0x3dae3fc1ULL, 0xf1740658ULL, 0x3edf5f0cULL, 0xc995d6efULL, 0x3dae3fc1ULL, 0x1f3268bfULL, 0xf047956aULL, 0xc995d6efULL},
+{0x83f8128ULL, 0xac1d5e42ULL, 0xd10d45c6ULL, 0x5ed2bc70ULL, 0xd467faffULL, 0xac1d5e42ULL, 0xcae41000ULL, 0xb496b203ULL, 0xd467faffULL},
+{0x3e3238fULL, 0xb4885862ULL, 0x6719342bULL, 0xd9ebaf20ULL, 0x7890ebc0ULL, 0xb4885862ULL, 0x28449f3eULL, 0x2f03c49dULL, 0x7890ebc0ULL},
+{0x7b631effULL, 0x622660aeULL, 0x99d86b91ULL, 0xb81820aULL, 0xf0432070ULL, 0x622660aeULL, 0x69b13920ULL, 0xf8b2b1b3ULL, 0xf0432070ULL},
+{0x24910ea3ULL, 0xeece6286ULL, 0x4ce02fdfULL, 0xc1c45275ULL, 0x5f91b6a8ULL, 0xeece6286ULL, 0x2515ad4bULL, 0xbb6daa8cULL, 0x5f91b6a8ULL},
+{0x2f7f9fdeULL, 0x1f732d81ULL, 0x49c2b1cdULL, 0x51c0a56fULL, 0x92f3c673ULL, 0x1f732d81ULL, 0x119fc3d9ULL, 0xd8e85feaULL, 0x92f3c673ULL},
+{0x86ffb5b2ULL, 0x72d0c94cULL, 0x420cfbe3ULL, 0x8e7f4adfULL, 0x16f692f1ULL, 0x72d0c94cULL, 0xd4c814d5ULL, 0xde4020deULL, 0x16f692f1ULL},
+{0x644ead5dULL, 0xf75daafULL, 0x9e4a424cULL, 0x268d5ad6ULL, 0xdd568523ULL, 0xf75daafULL, 0x76156a86ULL, 0x3f0fbc07ULL, 0xdd568523ULL},
+{0x5713bac6ULL, 0xfa1752aULL, 0xcc1f5712ULL, 0x64baf07bULL, 0x6a90303bULL, 0xfa1752aULL, 0xe128903ULL, 0x5753ac86ULL, 0x6a90303bULL},
+{0x8a6b176cULL, 0x8a990c65ULL, 0x19f28e70ULL, 0xbd9bbb22ULL, 0xb87bc213ULL, 0x8a990c65ULL, 0x988be7b9ULL, 0xf2e30655ULL, 0xb87bc213ULL},
+{0xce3f1c41ULL, 0xfad5a6a6ULL, 0x2966cfbaULL, 0xfc334f84ULL, 0xd4d8942bULL, 0xfad5a6a6ULL, 0x6182b4eeULL, 0x64da4048ULL, 0xd4d8942bULL},
+{0x13199f41ULL, 0xb56b9cd8ULL, 0xcfb31003ULL, 0x3d82b7d3ULL, 0x1da93b0eULL, 0xb56b9cd8ULL, 0xb19a4892ULL, 0xf197749aULL, 0x1da93b0eULL},
+{0xd63eb7afULL, 0x3492682fULL, 0x6c32433dULL, 0x52a1eec0ULL, 0xa6642877ULL, 0x3492682fULL, 0xb4c95f1dULL, 0x1cbc1e92ULL, 0xa6642877ULL},
+{0xa0bbfd8aULL, 0x4767b0baULL, 0x522966f3ULL, 0x800badb1ULL, 0x934fcd55ULL, 0x4767b0baULL, 0xeb9a623aULL, 0x6380fd40ULL, 0x934fcd55ULL},
+{0x41d187e5ULL, 0x9dec4c3fULL, 0x3c5158a4ULL, 0x4daa44a3ULL, 0x85d52ec7ULL, 0x9dec4c3fULL, 0x84acd148ULL, 0x6ab89e41ULL, 0x85d52ec7ULL},
+{0xcf09e9eULL, 0xee1a7adcULL, 0x8b8d2d5cULL, 0x8b95b455ULL, 0xbf7a1161ULL, 0xee1a7adcULL, 0xb32f23dcULL, 0x82363df7ULL, 0xbf7a1161ULL},
+{0xaa229ed8ULL, 0x3556e1ddULL, 0xd1e53e8ULL, 0xa504827ULL, 0xbe13ad3dULL, 0x3556e1ddULL, 0x29dd758fULL, 0xba694a60ULL, 0xbe13ad3dULL},
+{0x8827588eULL, 0x5c98a45aULL, 0x13ce0cabULL, 0xcbd1b537ULL, 0x7018bd9bULL, 0x5c98a45aULL, 0x5172d434ULL, 0x81acb540ULL, 0x7018bd9bULL},
+{0x2507f60ULL, 0xae309f18ULL, 0xced1d330ULL, 0x97e4338dULL, 0x26e9afe1ULL, 0xae309f18ULL, 0xcd85c4a4ULL, 0xbe56ab5aULL, 0x26e9afe1ULL},
+{0xbd84e56aULL, 0x4e92ca53ULL, 0x50c72911ULL, 0xba72b7ffULL, 0xeab17d2aULL, 0x4e92ca53ULL, 0x65b09c55ULL, 0xd4328450ULL, 0xeab17d2aULL},
+{0xb9ed5096ULL, 0x28b2e87aULL, 0x3a355520ULL, 0xaa9d39dbULL, 0x8df0d8cbULL, 0x28b2e87aULL, 0x852d7ad6ULL, 0xb70c1528ULL, 0x8df0d8cbULL},
+{0x7b28be33ULL, 0xe0dbaed9ULL, 0xbf768169ULL, 0xe09c7a2eULL, 0xd275f79bULL, 0xe0dbaed9ULL, 0x53aae65fULL, 0x5f7f5c30ULL, 0xd275f79bULL},
+{0x29f82ef0ULL, 0x9ebcd6cdULL, 0xbe768535ULL, 0x99ae3addULL, 0x16852e9eULL, 0x9ebcd6cdULL, 0xb61ee244ULL, 0x6f55fa6ULL, 0x16852e9eULL},
+{0xc0db454cULL, 0x6495c994ULL, 0xdeae8d1fULL, 0x73c1bd9bULL, 0x323a515aULL, 0x6495c994ULL, 0x61551c90ULL, 0xe73bc6d4ULL, 0x323a515aULL},
+{0xd5343117ULL, 0xd0d3cfd2ULL, 0x262375feULL, 0xe1209ea2ULL, 0x368add6fULL, 0xd0d3cfd2ULL, 0x33a77e07ULL, 0xb3785ecULL, 0x368add6fULL},
+{0x945b384ULL, 0x2cac946ULL, 0xa21b0c4ULL, 0x28f9832aULL, 0xedf9d130ULL, 0x2cac946ULL, 0x92edb115ULL, 0xb02b201eULL, 0xedf9d130ULL},
+{0x8a88d524ULL, 0xb4fe3ed3ULL, 0xef1fe0a8ULL, 0x54fab8bULL, 0xd71472d4ULL, 0xb4fe3ed3ULL, 0xa57da3b3ULL, 0x69b4d2a0ULL, 0xd71472d4ULL},
+{0x56e3b88dULL, 0xcd8736c6ULL, 0x37ef741bULL, 0xeee3f0e1ULL, 0x1ad93108ULL, 0xcd8736c6ULL, 0x7df5eab7ULL, 0x6725cb62ULL, 0x1ad93108ULL},
+{0x7b126a44ULL, 0xf1826f06ULL, 0xb4c43477ULL, 0xa6371941ULL, 0xd2fde6feULL, 0xf1826f06ULL, 0xff380b39ULL, 0x2ff5e41eULL, 0xd2fde6feULL},
+{0x40724817ULL, 0x89a6a9d3ULL, 0xabef8df7ULL, 0x8a6a2cdfULL, 0x662817b1ULL, 0x89a6a9d3ULL, 0x13486870ULL, 0x9ad612e3ULL, 0x662817b1ULL},
+{0x5b7952e1ULL, 0x5bba19e5ULL, 0x748ddf8cULL, 0xc82edbb3ULL, 0x10ab66adULL, 0x5bba19e5ULL, 0x4f7c0bcdULL, 0x599f88d2ULL, 0x10ab66adULL},
+{0x185bd38eULL, 0xa117d217ULL, 0xb59dacbeULL, 0x639b72c7ULL, 0xf9aae46dULL, 0xa117d217ULL, 0x63d631a1ULL, 0xd4faf429ULL, 0xf9aae46dULL},
+{0xd0c2e8edULL, 0xbaa33885ULL, 0x85c3c155ULL, 0xd0589e23ULL, 0xffadf26dULL, 0xbaa33885ULL, 0x3fbafd20ULL, 0x25458a14ULL, 0xffadf26dULL},
+{0x16e43acdULL, 0xf9e99429ULL, 0x94052474ULL, 0x3cad6f62ULL, 0xf36325bfULL, 0xf9e99429ULL, 0xc422ac1eULL, 0xb3fde9c9ULL, 0xf36325bfULL},
+{0x3cc4830bULL, 0xbc58eb8cULL, 0x832307f7ULL, 0xe693a975ULL, 0xbc028cbbULL, 0xbc58eb8cULL, 0x96eee7f1ULL, 0x68c1d988ULL, 0xbc028cbbULL},
+{0x710c2c43ULL, 0xd86b0bc6ULL, 0x6045a857ULL, 0x452f3123ULL, 0xd19e2121ULL, 0xd86b0bc6ULL, 0xfad8e67fULL, 0x8cb1dffeULL, 0xd19e2121ULL},
+{0xc02e5b02ULL, 0x56d1367dULL, 0x2f927274ULL, 0xbdf1398fULL, 0xb9e23b5bULL, 0x56d1367dULL, 0xef1be789ULL, 0x9e53fd77ULL, 0xb9e23b5bULL},
+{0x9290f7f2ULL, 0xa9f8e45bULL, 0x8db7d15ULL, 0x83d379f5ULL, 0x38df6481ULL, 0xa9f8e45bULL, 0xd79efea9ULL, 0x2c3bce62ULL, 0x38df6481ULL},
+{0x10223c21ULL, 0x3f850898ULL, 0xb2606965ULL, 0xfa27e021ULL, 0xac0b5a44ULL, 0x3f850898ULL, 0x2ca6e127ULL, 0x6e37c307ULL, 0xac0b5a44ULL},
+{0xb05b00f9ULL, 0xdb0717f4ULL, 0xe86d0596ULL, 0x8f27719ULL, 0x9e92a1bULL, 0xdb0717f4ULL, 0xbeb29e07ULL, 0xd80cc40fULL, 0x9e92a1bULL},
+{0x352caef7ULL, 0x45c2ccf9ULL, 0xeedfe31dULL, 0xa0ed014aULL, 0x7532e19ULL, 0x45c2ccf9ULL, 0xa1c64229ULL, 0x5a0b6607ULL, 0x7532e19ULL},
+{0xb80b8e12ULL, 0x6e810c1aULL, 0x1a984914ULL, 0x8d2bd4e0ULL, 0x4e988367ULL, 0x6e810c1aULL, 0xe307715bULL, 0x28a1a3f1ULL, 0x4e988367ULL},
+{0xe0b0c1feULL, 0x4973f404ULL, 0xe8f7d47eULL, 0xe0484a43ULL, 0x12ec68adULL, 0x4973f404ULL, 0x683b8cc5ULL, 0xddd176c6ULL, 0x12ec68adULL},
+{0x377ca060ULL, 0x29b39f2dULL, 0x367ea481ULL, 0x64a12db4ULL, 0x2ee8aef8ULL, 0x29b39f2dULL, 0xc9040db6ULL, 0x75fcdb0fULL, 0x2ee8aef8ULL},
+{0x4ab707d8ULL, 0xf6a14974ULL, 0x2ea78ceULL, 0x99616dcdULL, 0x6e060703ULL, 0xf6a14974ULL, 0xc9b1fcb1ULL, 0x9799b53cULL, 0x6e060703ULL},
+{0x23630f06ULL, 0x24e83b4cULL, 0x20a18d22ULL, 0x7ce40dc4ULL, 0x947b54c9ULL, 0x24e83b4cULL, 0x7ebf9beeULL, 0x9fbe6304ULL, 0x947b54c9ULL},
+{0x6b1a8b9dULL, 0xd4b8ad0bULL, 0x2ecd7039ULL, 0xe218ae9cULL, 0x124fe637ULL, 0xd4b8ad0bULL, 0x4430c073ULL, 0xd1ccbb37ULL, 0x124fe637ULL},
+{0x1ade2a93ULL, 0x17bc109dULL, 0x586dfdeeULL, 0x8e6f628fULL, 0x7159607fULL, 0x17bc109dULL, 0xa72b95baULL, 0x39ec979eULL, 0x7159607fULL},
+{0x9f9dc772ULL, 0x91594cc8ULL, 0x75c6368dULL, 0xe9155233ULL, 0xb1607eebULL, 0x91594cc8ULL, 0xddc5053dULL, 0xf6c9ee90ULL, 0xb1607eebULL},
+{0x7b43f4d5ULL, 0x727fbcd7ULL, 0x1442b75bULL, 0x8b25cba4ULL, 0x8078b55ULL, 0x727fbcd7ULL, 0x764d87b8ULL, 0xa9a8140ULL, 0x8078b55ULL},
+{0x63fc1fb9ULL, 0xfb1b6250ULL, 0x61b79a12ULL, 0xca56dcfaULL, 0xd6c34c4eULL, 0xfb1b6250ULL, 0xbb6d764fULL, 0xaadec57bULL, 0xd6c34c4eULL},
+{0x11e50e4fULL, 0xcddc6bb7ULL, 0x85120533ULL, 0x861e9c3aULL, 0xb78db6c8ULL, 0xcddc6bb7ULL, 0x6bfe15d1ULL, 0xdca9f2d7ULL, 0xb78db6c8ULL},
+{0xaa325a35ULL, 0x84852aabULL, 0xdaebc9a8ULL, 0x89c28ed9ULL, 0xaa95d293ULL, 0x84852aabULL, 0xfc6825a8ULL, 0x884ccd2aULL, 0xaa95d293ULL},
+{0xd1fcb9b4ULL, 0xf55fb5d4ULL, 0xa916c177ULL, 0x50174197ULL, 0x551d94d6ULL, 0xf55fb5d4ULL, 0xece1355bULL, 0x1ed0e8efULL, 0x551d94d6ULL},
+{0x4e7f5182ULL, 0xba516ad4ULL, 0x3361e4caULL, 0xc1c78c0cULL, 0x5b33648eULL, 0xba516ad4ULL, 0x37b39dbcULL, 0x1beb89a9ULL, 0x5b33648eULL},
+{0xa15b9facULL, 0x16b5925ULL, 0x364cfbd4ULL, 0xb5af85c2ULL, 0xe43c961ULL, 0x16b5925ULL, 0x1e314ab9ULL, 0x83902034ULL, 0xe43c961ULL},
+{0x6536108aULL, 0x336989a4ULL, 0xa1718afcULL, 0x75e301e3ULL, 0x69d74d3aULL, 0x336989a4ULL, 0x3219cdbeULL, 0x3858eeebULL, 0x69d74d3aULL},
+{0xf92c3732ULL, 0xc2ffa61cULL, 0xefa575afULL, 0x832ec5aeULL, 0x31224c94ULL, 0xc2ffa61cULL, 0x9851c8a9ULL, 0x3f51e364ULL, 0x31224c94ULL},
+{0xd3851c1eULL, 0x540f90e9ULL, 0x35b6e175ULL, 0x97e039ebULL, 0x81715150ULL, 0x540f90e9ULL, 0x4c7224e3ULL, 0xae29eacaULL, 0x81715150ULL},
+{0x41143606ULL, 0xf7d9f920ULL, 0xf1985c26ULL, 0xc0c688faULL, 0x62bde348ULL, 0xf7d9f920ULL, 0xa1b54af5ULL, 0x868e6632ULL, 0x62bde348ULL},
+{0x3123a911ULL, 0x8e43218ULL, 0xfe111335ULL, 0x8af72c9aULL, 0x7c550b91ULL, 0x8e43218ULL, 0xcd53fd11ULL, 0xabdd5d37ULL, 0x7c550b91ULL},
+{0x74ddbf5ULL, 0xe8add08aULL, 0xdd9cfd03ULL, 0x9ff169b3ULL, 0x97bccb4fULL, 0xe8add08aULL, 0x80426337ULL, 0xa3261260ULL, 0x97bccb4fULL},
+{0x14540c87ULL, 0xec50f54bULL, 0x327accd6ULL, 0x8d79f747ULL, 0xd053b72dULL, 0xec50f54bULL, 0x93b97a20ULL, 0xcdca2076ULL, 0xd053b72dULL},
+{0xc60a8652ULL, 0x25ddf913ULL, 0x4351a979ULL, 0xd70183fULL, 0xf1b52632ULL, 0x25ddf913ULL, 0x7efedbb6ULL, 0x36b9fa62ULL, 0xf1b52632ULL},
+{0x16451569ULL, 0xc2c5b406ULL, 0xb524c755ULL, 0xf658ac76ULL, 0xbe28f17fULL, 0xc2c5b406ULL, 0x6cc389f6ULL, 0xaddef0dbULL, 0xbe28f17fULL},
+{0x9606b1d8ULL, 0xbdfd8ea8ULL, 0x59eed932ULL, 0x99e68606ULL, 0x5e9b5f57ULL, 0xbdfd8ea8ULL, 0x7636ceULL, 0xddeed0d9ULL, 0x5e9b5f57ULL},
+{0x1e863c6aULL, 0x6156e1cdULL, 0xac7958d8ULL, 0xf27a42feULL, 0x5bec9c77ULL, 0x6156e1cdULL, 0x48e702bfULL, 0xf43df020ULL, 0x5bec9c77ULL},
+{0xf4088a05ULL, 0x3be83472ULL, 0x4375f06aULL, 0x4735e146ULL, 0x117e880bULL, 0x3be83472ULL, 0xfa999347ULL, 0xbce510e4ULL, 0x117e880bULL},
+{0x8aff6693ULL, 0xa4fd1890ULL, 0xa077b9feULL, 0xdef786c5ULL, 0x42baecf5ULL, 0xa4fd1890ULL, 0x5e5a8df8ULL, 0xe41600a2ULL, 0x42baecf5ULL},
+{0xce1040bbULL, 0xc2c4cb49ULL, 0x545392bbULL, 0x4ab3faULL, 0x654ae153ULL, 0xc2c4cb49ULL, 0xabe7e439ULL, 0x3f46bb3fULL, 0x654ae153ULL},
+{0xbbfdd3fbULL, 0xde6741e9ULL, 0xc3b08e6eULL, 0x1ed2280dULL, 0x49039746ULL, 0xde6741e9ULL, 0x68868a9dULL, 0xab3ebcfbULL, 0x49039746ULL},
+{0x12c7bf0ULL, 0xb79bd98dULL, 0x2a71d380ULL, 0xd182a77dULL, 0xaabcf178ULL, 0xb79bd98dULL, 0x2706b4d8ULL, 0x15263010ULL, 0xaabcf178ULL},
+{0x6599661eULL, 0x1ae29c3dULL, 0x75c18077ULL, 0x313e9a4eULL, 0x90b2f6faULL, 0x1ae29c3dULL, 0x19587b71ULL, 0x9731aea6ULL, 0x90b2f6faULL},
+{0x3e1f1116ULL, 0xb10e24dcULL, 0x5ee1daf8ULL, 0xcd8c3a3cULL, 0x6d79912cULL, 0xb10e24dcULL, 0x9859a2f2ULL, 0xc1562fb7ULL, 0x6d79912cULL},
+{0xeb6169caULL, 0x7d43898cULL, 0xf9a7c3b7ULL, 0xefac07fcULL, 0xd8af1e28ULL, 0x7d43898cULL, 0x36c8d595ULL, 0x35433da1ULL, 0xd8af1e28ULL},
+{0x44e5ab33ULL, 0xfa786c0fULL, 0x14c82f2fULL, 0x723c17a1ULL, 0x4bb826adULL, 0xfa786c0fULL, 0xb09aed17ULL, 0x2dc01d24ULL, 0x4bb826adULL},
+{0x6abc5460ULL, 0x54579389ULL, 0x7742e58bULL, 0x93de738eULL, 0x8f74ba8aULL, 0x54579389ULL, 0x7ab62c78ULL, 0xe7453cd3ULL, 0x8f74ba8aULL},
+{0xefea2359ULL, 0xe8885cbeULL, 0xd2d6b9f7ULL, 0x553965fdULL, 0xfe447a52ULL, 0xe8885cbeULL, 0xd049b616ULL, 0x3b3bfe18ULL, 0xfe447a52ULL},
+{0x85e19752ULL, 0x8433acc0ULL, 0x812d7516ULL, 0xbbaf2d2aULL, 0xd95f57f0ULL, 0x8433acc0ULL, 0x1985c461ULL, 0x6bf11446ULL, 0xd95f57f0ULL},
+{0x7bdd0486ULL, 0x148cdc6bULL, 0xee9375feULL, 0x13b84bb4ULL, 0x7d24526fULL, 0x148cdc6bULL, 0x5195687fULL, 0x949cc997ULL, 0x7d24526fULL},
+{0xe14dd81fULL, 0x32884185ULL, 0x9adf2d8cULL, 0x8a592e6fULL, 0xcd1f2ea0ULL, 0x32884185ULL, 0x183b6f29ULL, 0x74e6eb8aULL, 0xcd1f2ea0ULL},
+{0x4072598dULL, 0xd9bdc346ULL, 0x4a8322b3ULL, 0xaf164922ULL, 0x22e3ca44ULL, 0xd9bdc346ULL, 0xce743dc1ULL, 0x3ce9dd04ULL, 0x22e3ca44ULL},
+{0x674ea0caULL, 0x3b006660ULL, 0xe01b9e2ULL, 0xf5091839ULL, 0xa8099eadULL, 0x3b006660ULL, 0x9338150bULL, 0xdd9fa9fbULL, 0xa8099eadULL},
+{0xf4f41af3ULL, 0xd3247a89ULL, 0x7fc3d318ULL, 0x64db83f4ULL, 0x37dd06c9ULL, 0xd3247a89ULL, 0x7b32344bULL, 0xaa0b0976ULL, 0x37dd06c9ULL},
+{0xc6ef920eULL, 0xf703bdc2ULL, 0x14cc625bULL, 0x7d93654dULL, 0xc0a42352ULL, 0xf703bdc2ULL, 0xd6180f9fULL, 0x12ae1bd1ULL, 0xc0a42352ULL},
+{0xe728f3b8ULL, 0x1361311fULL, 0xfce76d84ULL, 0xa7e41104ULL, 0x81900a76ULL, 0x1361311fULL, 0x71aa5fcaULL, 0x2a78d436ULL, 0x81900a76ULL},
+{0x3a41432ULL, 0xfdd03b4ULL, 0x25e02ca4ULL, 0x4344cc43ULL, 0x52cb0530ULL, 0xfdd03b4ULL, 0x4b485642ULL, 0xbbf56a91ULL, 0x52cb0530ULL},
+{0x86d5e7d9ULL, 0xc15fad16ULL, 0x12babfe6ULL, 0x74c67a6dULL, 0x5a958cb2ULL, 0xc15fad16ULL, 0x7b141353ULL, 0x54b7d25eULL, 0x5a958cb2ULL},
+{0xce590d12ULL, 0xed3c8c4ULL, 0x422daf0ULL, 0x309bb065ULL, 0x3c9187c8ULL, 0xed3c8c4ULL, 0x62945663ULL, 0x3e5b8943ULL, 0x3c9187c8ULL},
+{0xdcc8fdaULL, 0x409146b5ULL, 0x5a5d7359ULL, 0x5f3823d6ULL, 0x98a9253dULL, 0x409146b5ULL, 0xd1595b38ULL, 0xc270f778ULL, 0x98a9253dULL},
+{0x794e4964ULL, 0xbd772099ULL, 0xa279f17eULL, 0xa27ff19cULL, 0x2348b0dbULL, 0xbd772099ULL, 0xff6cc344ULL, 0xd2f904fcULL, 0x2348b0dbULL},
+{0xb633dc93ULL, 0x4ce7421eULL, 0x4a367fb9ULL, 0xbc1ccda6ULL, 0x465addf9ULL, 0x4ce7421eULL, 0x47b46056ULL, 0x69086e07ULL, 0x465addf9ULL},
+{0xc744bf90ULL, 0x2d710dd3ULL, 0x2f055c7dULL, 0x137764d9ULL, 0x20f79628ULL, 0x2d710dd3ULL, 0xa6c90dc2ULL, 0x67a07485ULL, 0x20f79628ULL},
+{0x7742de0aULL, 0xfd511180ULL, 0x3d8ffe96ULL, 0x6490730dULL, 0x32ee5a9dULL, 0xfd511180ULL, 0xce1cc199ULL, 0x7e258591ULL, 0x32ee5a9dULL},
+{0x7c5f84efULL, 0x8f68889eULL, 0x88b0fdd2ULL, 0x372a5867ULL, 0x302e91aULL, 0x8f68889eULL, 0x3a09d0efULL, 0xf41942dULL, 0x302e91aULL},
+{0x420b9bd5ULL, 0xd0104fb1ULL, 0x6e598633ULL, 0xd0d92becULL, 0x6713bbc3ULL, 0xd0104fb1ULL, 0xaf737001ULL, 0xf58df5deULL, 0x6713bbc3ULL},
+{0xcb927ab7ULL, 0xa91c5a7aULL, 0x2d1cb643ULL, 0x6229c96ULL, 0xc6b3da35ULL, 0xa91c5a7aULL, 0x10b1448aULL, 0x6bfa7513ULL, 0xc6b3da35ULL},
+{0x8b37a887ULL, 0x8f1f2125ULL, 0x7800546aULL, 0x27009e9fULL, 0xc34dc09eULL, 0x8f1f2125ULL, 0x4a3ce9e3ULL, 0xe765bf54ULL, 0xc34dc09eULL},
+{0x1cb98438ULL, 0x573bedc4ULL, 0xeafc718bULL, 0xfdbeced4ULL, 0x95942a5aULL, 0x573bedc4ULL, 0xc7c18789ULL, 0x653ddb2eULL, 0x95942a5aULL},
+{0x626daeb7ULL, 0x5d366669ULL, 0x2e568bafULL, 0xac3f289bULL, 0xb857f096ULL, 0x5d366669ULL, 0xbc7f3afcULL, 0x1394a84bULL, 0xb857f096ULL},
+{0x8280118dULL, 0xd68c458dULL, 0x7f4adceeULL, 0xc6dacb5cULL, 0x252c8f3cULL, 0xd68c458dULL, 0xc4445bbaULL, 0x2de29bbeULL, 0x252c8f3cULL},
+{0xa650a445ULL, 0xea3d8d81ULL, 0xed9ede18ULL, 0xdffa0dc5ULL, 0x372474f0ULL, 0xea3d8d81ULL, 0x72f8ac3eULL, 0xd5a0fe8ULL, 0x372474f0ULL},
+{0x22095caULL, 0x5224ecc7ULL, 0x38b8b791ULL, 0x282989e8ULL, 0x388e33a3ULL, 0x5224ecc7ULL, 0xe306ba78ULL, 0x37411b03ULL, 0x388e33a3ULL},
+{0xa960b99fULL, 0x9f930044ULL, 0x766ddab0ULL, 0x11391c12ULL, 0x1720ec83ULL, 0x9f930044ULL, 0x5f3329c3ULL, 0x2fc39a49ULL, 0x1720ec83ULL},
+{0xa9073c1cULL, 0x1bb75be5ULL, 0xc8375c89ULL, 0xdb87bd95ULL, 0x42e9aecdULL, 0x1bb75be5ULL, 0x3e42b669ULL, 0xade9a9aaULL, 0x42e9aecdULL},
+{0xf48ba9bdULL, 0xdde11af8ULL, 0x5324bedbULL, 0x3312e93cULL, 0xe833429fULL, 0xdde11af8ULL, 0xf7b79d70ULL, 0x9f0cf1a5ULL, 0xe833429fULL},
+{0x20a9ba8fULL, 0x51849dc3ULL, 0xcf9703daULL, 0x3551e646ULL, 0x7a388397ULL, 0x51849dc3ULL, 0x58821d8ULL, 0xf298d4e7ULL, 0x7a388397ULL},
+{0xbc4cc12fULL, 0x164de58bULL, 0xb12b457bULL, 0x44848af2ULL, 0x82097edeULL, 0x164de58bULL, 0x6bb9ac5cULL, 0xbcb1a7b6ULL, 0x82097edeULL},
+{0xbcaf9608ULL, 0x3f988df0ULL, 0xba32a012ULL, 0x2327d099ULL, 0x9e563e59ULL, 0x3f988df0ULL, 0xafdef3d5ULL, 0xaafd6490ULL, 0x9e563e59ULL},
+{0x9754408bULL, 0x36a6cc29ULL, 0xf540e24dULL, 0x44d1b191ULL, 0x31bf8febULL, 0x36a6cc29ULL, 0xa5cbf7b3ULL, 0x3af12da5ULL, 0x31bf8febULL},
+{0xa27aa1bbULL, 0x13698114ULL, 0xd1319354ULL, 0x46c8e12fULL, 0xee115704ULL, 0x13698114ULL, 0x9d499fabULL, 0xcfad5eceULL, 0xee115704ULL},
+{0x75e95472ULL, 0x60deace5ULL, 0xb8e4cc18ULL, 0xd54ae21aULL, 0xc509ffddULL, 0x60deace5ULL, 0x5428e2feULL, 0x61cf6f6eULL, 0xc509ffddULL},
+{0xc022290eULL, 0xa1deb4aULL, 0xda6a4f92ULL, 0x42fa62abULL, 0xc10c055fULL, 0xa1deb4aULL, 0xd09f6b48ULL, 0x6222b56fULL, 0xc10c055fULL},
+{0xbc62e90bULL, 0x98f2975cULL, 0xb2f4816eULL, 0xf2acf251ULL, 0xfc8863fULL, 0x98f2975cULL, 0x323a591dULL, 0x2c7e794dULL, 0xfc8863fULL},
+{0xd3b84866ULL, 0x4a2acdc9ULL, 0xad121d50ULL, 0x1a3e200dULL, 0xe08b0fdbULL, 0x4a2acdc9ULL, 0x694ca587ULL, 0x31704848ULL, 0xe08b0fdbULL},
+{0xb3b2bd85ULL, 0x28054255ULL, 0x7b47afd1ULL, 0xb1d0d9b7ULL, 0x5fb4efc9ULL, 0x28054255ULL, 0xaf507c02ULL, 0xb6d983a1ULL, 0x5fb4efc9ULL},
+{0x1166639ULL, 0x83c054daULL, 0xef88f872ULL, 0xf1d9ca56ULL, 0x12424dfcULL, 0x83c054daULL, 0xfb206d03ULL, 0x551c0804ULL, 0x12424dfcULL},
+{0x9eab269fULL, 0xaea8d12bULL, 0xbaa269a8ULL, 0x3ec7a392ULL, 0xa5379792ULL, 0xaea8d12bULL, 0xe54cab6dULL, 0x9dd1f4c1ULL, 0xa5379792ULL},
+{0x68910f44ULL, 0x2d6b0149ULL, 0x30de5c6fULL, 0xb969ebedULL, 0xf6945cf5ULL, 0x2d6b0149ULL, 0x7b57540dULL, 0x809e38f0ULL, 0xf6945cf5ULL},
+{0xe3c9c746ULL, 0xa1d09fd3ULL, 0xf1bfd0a5ULL, 0xaa48c57aULL, 0x7174a7aULL, 0xa1d09fd3ULL, 0x3bf96cf3ULL, 0x907d513ULL, 0x7174a7aULL},
+{0xac4fb505ULL, 0xb2da417aULL, 0x9b385f8cULL, 0x212459f0ULL, 0xe25bdadcULL, 0xb2da417aULL, 0xad6388c6ULL, 0x43c22c51ULL, 0xe25bdadcULL},
+{0x3f63cab6ULL, 0xb1e70f0dULL, 0xe2691b5ULL, 0x2e80938aULL, 0x90dc29b2ULL, 0xb1e70f0dULL, 0x3372da1fULL, 0xc8a29f36ULL, 0x90dc29b2ULL},
+{0xf5ba76dcULL, 0xa5ced161ULL, 0x2800830eULL, 0x692e1685ULL, 0x4f3ff02dULL, 0xa5ced161ULL, 0xf49a0bfdULL, 0x80a272aULL, 0x4f3ff02dULL},
+{0x8944ebfULL, 0x5d1f11a4ULL, 0xaf0dbdf5ULL, 0x6167ed7dULL, 0xe8610c87ULL, 0x5d1f11a4ULL, 0x5c014f75ULL, 0x1a57024dULL, 0xe8610c87ULL},
+{0x2c1f767dULL, 0x29b7b89eULL, 0xa6bc86c1ULL, 0x540b0cc1ULL, 0xc796b524ULL, 0x29b7b89eULL, 0x12a9587cULL, 0x31377af0ULL, 0xc796b524ULL},
+{0x34e84c84ULL, 0x4132e63dULL, 0x5d4a4656ULL, 0xdf267d5eULL, 0x4400bb39ULL, 0x4132e63dULL, 0x6be677f9ULL, 0xbb51d346ULL, 0x4400bb39ULL},
+{0x5136fc8aULL, 0xfdc1b12aULL, 0x16f322d2ULL, 0x4a1f8d48ULL, 0xb4fac8b5ULL, 0xfdc1b12aULL, 0x916f3248ULL, 0x717ff5d0ULL, 0xb4fac8b5ULL},
+{0x452918a3ULL, 0x71f7c8deULL, 0xc4684e02ULL, 0x4fcf23cULL, 0x25a3612dULL, 0x71f7c8deULL, 0x4cc96c92ULL, 0xd21f18cbULL, 0x25a3612dULL},
+{0xf58e0605ULL, 0xb76003c7ULL, 0x37b729cdULL, 0x48da249aULL, 0x28fec973ULL, 0xb76003c7ULL, 0x5b09806cULL, 0x10c69d23ULL, 0x28fec973ULL},
+{0x54121ecdULL, 0x3c512adfULL, 0xf61d5249ULL, 0x4c14fadaULL, 0x679117eULL, 0x3c512adfULL, 0x83de16cdULL, 0xbbda6fccULL, 0x679117eULL},
+{0xa81e26e9ULL, 0xe401a69dULL, 0xdbc28568ULL, 0x212f7079ULL, 0x96bfaaeeULL, 0xe401a69dULL, 0xeaf8985cULL, 0xfbd67997ULL, 0x96bfaaeeULL},
+{0x5297d212ULL, 0x62e1c257ULL, 0xb150f50ULL, 0x811ad217ULL, 0x70b7f67bULL, 0x62e1c257ULL, 0x5e11458aULL, 0x914180eaULL, 0x70b7f67bULL},
+{0x3de99a6bULL, 0x5b2ff583ULL, 0x3cc83435ULL, 0xf2835a4cULL, 0x130da85bULL, 0x5b2ff583ULL, 0x3aa673daULL, 0xef5d4bb4ULL, 0x130da85bULL},
+{0xcb08adf6ULL, 0x4bb0e21bULL, 0x4d388dddULL, 0x974063f0ULL, 0x93b591f8ULL, 0x4bb0e21bULL, 0xd86cbb3dULL, 0xfc2810a5ULL, 0x93b591f8ULL},
+{0x61a10badULL, 0xcd229f06ULL, 0x97acd180ULL, 0x3e794a9bULL, 0x8d25ec37ULL, 0xcd229f06ULL, 0xe5dbe853ULL, 0x533f54c1ULL, 0x8d25ec37ULL},
+{0x25becd73ULL, 0x621c69d4ULL, 0x333ec2adULL, 0x61827f77ULL, 0xc0226a72ULL, 0x621c69d4ULL, 0xad955f1bULL, 0xe7497523ULL, 0xc0226a72ULL},
+{0xd1195e57ULL, 0x213dc18aULL, 0x31840a0ULL, 0x42ab6d67ULL, 0x6f01309fULL, 0x213dc18aULL, 0x1f303638ULL, 0x20bfeb3cULL, 0x6f01309fULL},
+{0x1f0d5534ULL, 0xdce49a27ULL, 0xb7455088ULL, 0xa80220eeULL, 0x10f9427dULL, 0xdce49a27ULL, 0x9daf0f4cULL, 0x3c00c78cULL, 0x10f9427dULL},
+{0x3395c9a7ULL, 0xeba541c9ULL, 0x3fe74c54ULL, 0x91e69607ULL, 0x2e4df855ULL, 0xeba541c9ULL, 0xa55ca9fcULL, 0x82155dd1ULL, 0x2e4df855ULL},
+{0x81a39726ULL, 0x3ccf4cd4ULL, 0x30990901ULL, 0x560aa817ULL, 0x50275883ULL, 0x3ccf4cd4ULL, 0x2996612dULL, 0x25a21ce3ULL, 0x50275883ULL},
+{0x54a789e6ULL, 0x5fef2f3cULL, 0x9cd40df8ULL, 0x54e2621bULL, 0x7e389d4eULL, 0x5fef2f3cULL, 0x14c4529ULL, 0xb8915129ULL, 0x7e389d4eULL},
+{0xc924d3d2ULL, 0x154bf1e3ULL, 0xcabcdb37ULL, 0x9dc794e4ULL, 0xe7f6704bULL, 0x154bf1e3ULL, 0x78e059c3ULL, 0x8cc89474ULL, 0xe7f6704bULL},
+{0x83823b43ULL, 0xde79819dULL, 0x2364dc35ULL, 0x8fdb82feULL, 0x5785c0b7ULL, 0xde79819dULL, 0xa827fefbULL, 0xf1d4a753ULL, 0x5785c0b7ULL},
+{0x930c5ef4ULL, 0xae60b4b5ULL, 0x4c8ce94aULL, 0xf0264863ULL, 0x4b6ccfe6ULL, 0xae60b4b5ULL, 0xf6a4a299ULL, 0xe8bfea62ULL, 0x4b6ccfe6ULL},
+{0xd5403162ULL, 0x981937e3ULL, 0x715c39e3ULL, 0xac0d4cceULL, 0xc4fcafbULL, 0x981937e3ULL, 0x41fbe016ULL, 0x6fb8c3beULL, 0xc4fcafbULL},
+{0x8a28d3a4ULL, 0xadf727aULL, 0x2440b051ULL, 0x1f6855cfULL, 0x6bcab94cULL, 0xadf727aULL, 0xbb51a54eULL, 0x5a707d4ULL, 0x6bcab94cULL},
+{0x6f3b8ea4ULL, 0xb7f70e0fULL, 0x2cfeb9a2ULL, 0xfb9fda90ULL, 0x3085b1c4ULL, 0xb7f70e0fULL, 0xe0fbc94fULL, 0x94ac010cULL, 0x3085b1c4ULL},
+{0xf8243bf3ULL, 0xca0838b7ULL, 0xe7772fafULL, 0x3324d522ULL, 0x4693df10ULL, 0xca0838b7ULL, 0x332cf98fULL, 0xad79c4eeULL, 0x4693df10ULL},
+{0x5a0099aULL, 0xfa41e3b6ULL, 0xb8ec03edULL, 0x8a43ca69ULL, 0xeba5652bULL, 0xfa41e3b6ULL, 0x4c4552d2ULL, 0x59f61b00ULL, 0xeba5652bULL},
+{0x9033e6f9ULL, 0x7c7af013ULL, 0x22d4699dULL, 0x7bfcdfa9ULL, 0xc42e76d7ULL, 0x7c7af013ULL, 0xc6a242beULL, 0x87bc9259ULL, 0xc42e76d7ULL},
+{0xadd62a22ULL, 0xb43c1a9fULL, 0xa9b7fa85ULL, 0xde5a0c2cULL, 0x172dba99ULL, 0xb43c1a9fULL, 0x513133d5ULL, 0x58ddd344ULL, 0x172dba99ULL},
+{0x315eeea3ULL, 0xa1684c7bULL, 0x74eb8f3cULL, 0xd08151fcULL, 0x5f934d65ULL, 0xa1684c7bULL, 0xd14361ddULL, 0xd9e19c4aULL, 0x5f934d65ULL},
+{0x1001fb86ULL, 0x71ba14faULL, 0xfa7b9000ULL, 0xd743bcd8ULL, 0xd7b66b8ULL, 0x71ba14faULL, 0x9b749a1dULL, 0x28e12a4fULL, 0xd7b66b8ULL},
+{0x810059b1ULL, 0x80dd5dacULL, 0x2484dafaULL, 0xda08ed9bULL, 0x4e3d3569ULL, 0x80dd5dacULL, 0x85d87a49ULL, 0xdd4c203eULL, 0x4e3d3569ULL},
+{0xba48a393ULL, 0x9a63a7dfULL, 0x6b4f33caULL, 0x39811e41ULL, 0x9aca9bb8ULL, 0x9a63a7dfULL, 0x9980b8afULL, 0xae093780ULL, 0x9aca9bb8ULL},
+{0xdfcf34c9ULL, 0xf6bcfec9ULL, 0x4df27199ULL, 0x53a4a5ULL, 0xd7c3e0f8ULL, 0xf6bcfec9ULL, 0x4035a73ULL, 0x6bf52ca1ULL, 0xd7c3e0f8ULL},
+{0xb7261677ULL, 0x605effb7ULL, 0x17326891ULL, 0x9035b6f1ULL, 0x34f183f2ULL, 0x605effb7ULL, 0xc7a1c1c9ULL, 0xac73519eULL, 0x34f183f2ULL},
+{0x34d40180ULL, 0x8ea948ffULL, 0xdbbb1381ULL, 0x3a95c6edULL, 0xb0e0b741ULL, 0x8ea948ffULL, 0x1c3366a5ULL, 0x1dca63efULL, 0xb0e0b741ULL},
+{0x68c793deULL, 0xd356065bULL, 0xe1f72fcaULL, 0x2e0e5ed4ULL, 0xaf194d43ULL, 0xd356065bULL, 0x8f1a6d86ULL, 0x93c2e8c3ULL, 0xaf194d43ULL},
+{0xb4fa44e2ULL, 0x94c00082ULL, 0x71efbf4cULL, 0xba6e05b5ULL, 0x5f44649eULL, 0x94c00082ULL, 0xa5d97f2aULL, 0x8c771b02ULL, 0x5f44649eULL},
+{0x758d3f08ULL, 0xe991cd59ULL, 0xb73a97b3ULL, 0x4b94448bULL, 0xc597821fULL, 0xe991cd59ULL, 0x2114475bULL, 0x19eeddbfULL, 0xc597821fULL},
+{0xa3096ad9ULL, 0x8b29fe7cULL, 0xf5d2261bULL, 0x3c98dfccULL, 0x5e25bd58ULL, 0x8b29fe7cULL, 0x83325910ULL, 0xbc7c6003ULL, 0x5e25bd58ULL},
+{0x469dcaebULL, 0x95894cc7ULL, 0xbfca8f9bULL, 0xcddf09fULL, 0xd3a5e293ULL, 0x95894cc7ULL, 0x722719c8ULL, 0xe065a1fULL, 0xd3a5e293ULL},
+{0x98ca49a3ULL, 0x45572f72ULL, 0x487fa6beULL, 0x9952eb63ULL, 0x641d0b4eULL, 0x45572f72ULL, 0xe97cd524ULL, 0x8815612bULL, 0x641d0b4eULL},
+{0x5c45aebULL, 0x75a10d6cULL, 0x4ecefeecULL, 0x9ca26374ULL, 0x8a133df1ULL, 0x75a10d6cULL, 0x9d6a2da7ULL, 0xd05bb2d5ULL, 0x8a133df1ULL},
+{0x49f126bfULL, 0x7993c517ULL, 0x9b63993eULL, 0x666effd9ULL, 0x413c534cULL, 0x7993c517ULL, 0x4dd71128ULL, 0x11c0078dULL, 0x413c534cULL},
+{0x65dbdb1eULL, 0xecb0dd29ULL, 0x7333739ULL, 0x145a4ea6ULL, 0x6c80e76eULL, 0xecb0dd29ULL, 0x27400caeULL, 0x565737c3ULL, 0x6c80e76eULL},
+{0x448ddf2eULL, 0xefe7a576ULL, 0x40c8fc92ULL, 0xa3b7326fULL, 0xcd229115ULL, 0xefe7a576ULL, 0xbc51cab3ULL, 0x5f6848ceULL, 0xcd229115ULL},
+{0xe3ce956bULL, 0x8d61d788ULL, 0x3c5aca48ULL, 0x79b0b07eULL, 0x6a443e78ULL, 0x8d61d788ULL, 0xd23cd6efULL, 0x889956a7ULL, 0x6a443e78ULL},
+{0x44c34198ULL, 0xfc9a2d5cULL, 0xab33a3eeULL, 0x2d18fd2cULL, 0xdec7a28dULL, 0xfc9a2d5cULL, 0x4d57f1c0ULL, 0x4ee71f63ULL, 0xdec7a28dULL},
+{0x4f3d1694ULL, 0x660786f5ULL, 0x3e97853bULL, 0x62877209ULL, 0xf5cac54eULL, 0x660786f5ULL, 0x6e1d486aULL, 0x8700f99dULL, 0xf5cac54eULL},
+{0x87d4970bULL, 0xefae73adULL, 0xc6260f38ULL, 0xb57a6ed1ULL, 0x1b359178ULL, 0xefae73adULL, 0x45dcf8dfULL, 0x830cd37bULL, 0x1b359178ULL},
+{0x4a71a072ULL, 0xa5f6583cULL, 0x38d7e129ULL, 0xa784cd06ULL, 0xe874da76ULL, 0xa5f6583cULL, 0xfafddc4cULL, 0xd138472dULL, 0xe874da76ULL},
+{0x52b5e0d7ULL, 0x612c33a6ULL, 0x10529dacULL, 0x7a8719a3ULL, 0x74e449ccULL, 0x612c33a6ULL, 0x455cd727ULL, 0x67a0d1efULL, 0x74e449ccULL},
+{0xea3e9382ULL, 0xe7153ecdULL, 0xc78e0faaULL, 0x39a9f80cULL, 0x9fa1ac25ULL, 0xe7153ecdULL, 0xccf5fa9dULL, 0xefde6f8eULL, 0x9fa1ac25ULL},
+{0xed813723ULL, 0xd0a46d9ULL, 0x650d6943ULL, 0x8c116bb0ULL, 0x5a562753ULL, 0xd0a46d9ULL, 0x15fc6a37ULL, 0x31a44ed4ULL, 0x5a562753ULL},
+{0x27b28188ULL, 0xfac011b8ULL, 0x6c69bb6eULL, 0x1fecd44aULL, 0xf461495fULL, 0xfac011b8ULL, 0x5ce9ea99ULL, 0x51886047ULL, 0xf461495fULL},
+{0x2d327835ULL, 0x251c4579ULL, 0xe5fd3976ULL, 0xdccfcf7dULL, 0xb356ddd6ULL, 0x251c4579ULL, 0xb9bbcf62ULL, 0x87ccce14ULL, 0xb356ddd6ULL},
+{0xe0c85432ULL, 0x70197ec5ULL, 0xb51bd036ULL, 0xdeaa5d2dULL, 0x86384395ULL, 0x70197ec5ULL, 0x16b09fe7ULL, 0x2db215beULL, 0x86384395ULL},
+{0xdb17b124ULL, 0x28522866ULL, 0xf46c0b92ULL, 0x3d595aa2ULL, 0x1ae65802ULL, 0x28522866ULL, 0x6456b633ULL, 0x318843a7ULL, 0x1ae65802ULL},
+{0x7690cd3eULL, 0x27c5e394ULL, 0x5536a05fULL, 0x2fcb2a11ULL, 0xd6b2dba4ULL, 0x27c5e394ULL, 0x9e97b8faULL, 0x3350062ULL, 0xd6b2dba4ULL},
+{0x5d19d3feULL, 0xa60d17e6ULL, 0x31ef23c4ULL, 0x40fd4e57ULL, 0x4585eULL, 0xa60d17e6ULL, 0x9006d8d3ULL, 0x9fb57aedULL, 0x4585eULL},
+{0x30e02feeULL, 0x9d86e77fULL, 0xe6e64439ULL, 0xf67d4312ULL, 0xc2ac2572ULL, 0x9d86e77fULL, 0xd4929f0eULL, 0x89973345ULL, 0xc2ac2572ULL},
+{0x9bd8ff70ULL, 0x9cb9e41eULL, 0xec6b803ULL, 0x39ee78dULL, 0xd73abbfaULL, 0x9cb9e41eULL, 0xfe2f635eULL, 0xd5c130dcULL, 0xd73abbfaULL},
+{0x419855a5ULL, 0x8f4e73f7ULL, 0xb854c181ULL, 0xbad19bc8ULL, 0xa421dd8fULL, 0x8f4e73f7ULL, 0xdd16e129ULL, 0x17fbf5cULL, 0xa421dd8fULL},
+{0xcd677d8fULL, 0xfeb8ae37ULL, 0x6bf702c4ULL, 0x4faf20d5ULL, 0x9f666f76ULL, 0xfeb8ae37ULL, 0x24095a61ULL, 0x335a9fb3ULL, 0x9f666f76ULL},
+{0x6cb92d0dULL, 0x1c5695dULL, 0xb149c303ULL, 0x1469a3e9ULL, 0x34fe7fb9ULL, 0x1c5695dULL, 0xf7fa79aeULL, 0xc3c37d83ULL, 0x34fe7fb9ULL},
+{0xfbc348cdULL, 0xf2482929ULL, 0x39c35aaaULL, 0xa96c07edULL, 0xbea83d81ULL, 0xf2482929ULL, 0xf802b493ULL, 0xe85e8328ULL, 0xbea83d81ULL},
+{0x1c5dae3bULL, 0xbd267930ULL, 0x7f5bc82ULL, 0xb7ad0967ULL, 0x2c171f4dULL, 0xbd267930ULL, 0xbeec3732ULL, 0x8bf72fbcULL, 0x2c171f4dULL},
+{0x2ac7c0a9ULL, 0x78e9e926ULL, 0xbe01e48dULL, 0x5e421d30ULL, 0x49593d95ULL, 0x78e9e926ULL, 0x95db94d5ULL, 0x2cf33bd2ULL, 0x49593d95ULL},
+{0x778b9d10ULL, 0xb8ee631dULL, 0xb51d498cULL, 0xa2bec48bULL, 0xae5c5ceaULL, 0xb8ee631dULL, 0x32e9cf3cULL, 0x54dc11d0ULL, 0xae5c5ceaULL},
+{0xe052731fULL, 0x72ff7f54ULL, 0xd83c0a77ULL, 0x77a2f33dULL, 0x734740a8ULL, 0x72ff7f54ULL, 0xfb3a55b3ULL, 0x2fbbf855ULL, 0x734740a8ULL},
+{0x48d5c289ULL, 0xf8425bafULL, 0xcdc5ad9fULL, 0xc38810faULL, 0x8bfe01efULL, 0xf8425bafULL, 0x50335962ULL, 0x2489a6b2ULL, 0x8bfe01efULL},
+{0xbf8f5efdULL, 0xe75bc332ULL, 0x88a18804ULL, 0x78175b06ULL, 0x2a29e5a5ULL, 0xe75bc332ULL, 0x73b2212dULL, 0x7134b04bULL, 0x2a29e5a5ULL},
+{0xac3228b4ULL, 0x854d5a4ULL, 0xaf9d680cULL, 0x25a7abe4ULL, 0x65da2646ULL, 0x854d5a4ULL, 0x48a8067fULL, 0xeb702422ULL, 0x65da2646ULL},
+{0xb28b35e7ULL, 0xad94edeeULL, 0x23c77b74ULL, 0x890a2be2ULL, 0xb51d7fdfULL, 0xad94edeeULL, 0xd3a9e31aULL, 0x3d4e82f1ULL, 0xb51d7fdfULL},
+{0xbf8cbf13ULL, 0x5a65a977ULL, 0x65eed0c1ULL, 0x21da795cULL, 0xa4294096ULL, 0x5a65a977ULL, 0xca7fc160ULL, 0x899dc877ULL, 0xa4294096ULL},
+{0x4c8180c2ULL, 0x50f4f93bULL, 0xb3628801ULL, 0xd9a4abf8ULL, 0x983535eULL, 0x50f4f93bULL, 0xfc84d708ULL, 0x341ca846ULL, 0x983535eULL},
+{0xa213e690ULL, 0x99dfbc67ULL, 0x9245a725ULL, 0x1ffa89aULL, 0xa47685dfULL, 0x99dfbc67ULL, 0x8b2961cfULL, 0x25462360ULL, 0xa47685dfULL},
+{0x2ac542b2ULL, 0x4d88009eULL, 0x2febfa13ULL, 0x318a67b4ULL, 0x9871aedcULL, 0x4d88009eULL, 0xc20e6481ULL, 0x83ede827ULL, 0x9871aedcULL},
+{0x5953ec79ULL, 0xd1c046f6ULL, 0xf3e9d575ULL, 0xc9a2e25ULL, 0xdeb0ee45ULL, 0xd1c046f6ULL, 0xf3e2f899ULL, 0x93b1a156ULL, 0xdeb0ee45ULL},
+{0x1e14cc4eULL, 0x3d4eaf19ULL, 0xa906e008ULL, 0xc476f033ULL, 0x84180d87ULL, 0x3d4eaf19ULL, 0x54cef5fdULL, 0xbffcd4d3ULL, 0x84180d87ULL},
+{0xf69f7d68ULL, 0x5cc8fb67ULL, 0x64f9c38fULL, 0x99287533ULL, 0x9aa4ddb3ULL, 0x5cc8fb67ULL, 0x510f4236ULL, 0x9aa311c3ULL, 0x9aa4ddb3ULL},
+{0x7beec15dULL, 0xb403eaeaULL, 0x83bb371bULL, 0x45a3b85bULL, 0x4c72b6f9ULL, 0xb403eaeaULL, 0x621f1d44ULL, 0x6946ad93ULL, 0x4c72b6f9ULL},
+{0x7bc72e76ULL, 0xf145a8d6ULL, 0x8f43314eULL, 0x29b1ca9dULL, 0x98b89e5cULL, 0xf145a8d6ULL, 0xd153aca9ULL, 0x1acb0344ULL, 0x98b89e5cULL},
+{0x39d1507fULL, 0x648a564eULL, 0xd067a40ULL, 0x15ba293eULL, 0x81555655ULL, 0x648a564eULL, 0x751bbeeULL, 0x4e51c70aULL, 0x81555655ULL},
+{0xd3005531ULL, 0x516a4959ULL, 0x33cf2477ULL, 0x4544024dULL, 0xa58543adULL, 0x516a4959ULL, 0xbd5c973dULL, 0x1b8d4373ULL, 0xa58543adULL},
+{0x2e4d7955ULL, 0x7b1a3210ULL, 0xed5b96f2ULL, 0x26dd2446ULL, 0xdc20b4d6ULL, 0x7b1a3210ULL, 0x74457a42ULL, 0x8a8cf6cfULL, 0xdc20b4d6ULL},
+{0x6aeba8caULL, 0x66b0a880ULL, 0xf8b02e01ULL, 0xbd964d93ULL, 0xd66b2619ULL, 0x66b0a880ULL, 0x27fb2c86ULL, 0x269a9312ULL, 0xd66b2619ULL},
+{0xcf71e0d0ULL, 0x99506a4cULL, 0xa4611d7bULL, 0xf6e9f5d9ULL, 0x33499e75ULL, 0x99506a4cULL, 0x867b5bc4ULL, 0x9cb02d3eULL, 0x33499e75ULL},
+{0x2a76618ULL, 0xced5bd0eULL, 0x54d167c5ULL, 0x5d8affc5ULL, 0x8a5b356eULL, 0xced5bd0eULL, 0x2e10972dULL, 0x53101fe2ULL, 0x8a5b356eULL},
+{0x222b511cULL, 0x62c8e998ULL, 0x225102fULL, 0xb02e698fULL, 0x621729bfULL, 0x62c8e998ULL, 0xbd20cf45ULL, 0x9caa23caULL, 0x621729bfULL},
+{0xa0e297e8ULL, 0xe4310886ULL, 0x21a50b4aULL, 0x5f7cccdaULL, 0x9c21cca1ULL, 0xe4310886ULL, 0xc32670caULL, 0x39a748cULL, 0x9c21cca1ULL},
+{0xe33539c7ULL, 0x899f9d98ULL, 0x6392e494ULL, 0x1814db83ULL, 0x9cab68d8ULL, 0x899f9d98ULL, 0x42ed6eefULL, 0x376bdcecULL, 0x9cab68d8ULL},
+{0x3c7e2110ULL, 0xa6aa39a5ULL, 0x1eb0e5fcULL, 0x72371434ULL, 0xe565feceULL, 0xa6aa39a5ULL, 0xba41eea3ULL, 0x1902db14ULL, 0xe565feceULL},
+{0x5325a04aULL, 0xadd51b29ULL, 0x9b9197f0ULL, 0x68e10200ULL, 0x5c4aafb8ULL, 0xadd51b29ULL, 0xea1eb368ULL, 0x94dc6021ULL, 0x5c4aafb8ULL},
+{0x7b139a50ULL, 0x4e508d78ULL, 0x1ec97329ULL, 0xba03a53cULL, 0xf52a7488ULL, 0x4e508d78ULL, 0xce56c970ULL, 0x37f08d0fULL, 0xf52a7488ULL},
+{0x2a6442d6ULL, 0xbd203318ULL, 0x7a4101a7ULL, 0x3dd47919ULL, 0x7dd3928ULL, 0xbd203318ULL, 0x5b78cca0ULL, 0xb484c797ULL, 0x7dd3928ULL},
+{0xb0c2a898ULL, 0x78297450ULL, 0x20ed7c5cULL, 0x1f80f699ULL, 0x6a73d13eULL, 0x78297450ULL, 0x693ba2a2ULL, 0x1ae086d9ULL, 0x6a73d13eULL},
+{0xa42976c9ULL, 0x4b137008ULL, 0xc2c3b2a6ULL, 0x3b961d5fULL, 0x68c4d593ULL, 0x4b137008ULL, 0x8fe94cd1ULL, 0xa0086534ULL, 0x68c4d593ULL},
+{0x5834df8aULL, 0xc26fac41ULL, 0x5b0f9124ULL, 0xf1519282ULL, 0x97e88e98ULL, 0xc26fac41ULL, 0xaed44f26ULL, 0x2743b069ULL, 0x97e88e98ULL},
+{0xe3f59c55ULL, 0x7b1c16a9ULL, 0x2ff0db4dULL, 0xd3b2cd57ULL, 0xd43bc8d0ULL, 0x7b1c16a9ULL, 0x9720ed3ULL, 0xc1fafbb5ULL, 0xd43bc8d0ULL},
+{0xb267979bULL, 0xd4764547ULL, 0xf646d514ULL, 0xc6ea4540ULL, 0x6e1c7b29ULL, 0xd4764547ULL, 0xbfab6058ULL, 0x83ca6cfdULL, 0x6e1c7b29ULL},
+{0xd99ce60bULL, 0xdf12c9e2ULL, 0x70749aeULL, 0x7fe859edULL, 0x1339f2dbULL, 0xdf12c9e2ULL, 0x71731e8bULL, 0xb8129b31ULL, 0x1339f2dbULL},
+{0x7ce5cc4ULL, 0x5c74968bULL, 0x1a953a2fULL, 0x6225896eULL, 0x1f285a0bULL, 0x5c74968bULL, 0x54e6c5eaULL, 0xedd1385eULL, 0x1f285a0bULL},
+{0x700136fbULL, 0x5b3a3b08ULL, 0x91912f27ULL, 0x898ac902ULL, 0x5c4a3859ULL, 0x5b3a3b08ULL, 0x299435a3ULL, 0x82a28db2ULL, 0x5c4a3859ULL},
+{0x6b3638c5ULL, 0xdcd21799ULL, 0x2bd6ad30ULL, 0x51e0ac5fULL, 0xb881cb58ULL, 0xdcd21799ULL, 0x990e3ef1ULL, 0x78916298ULL, 0xb881cb58ULL},
+{0x6003ce20ULL, 0x45937509ULL, 0x7eac3dcaULL, 0xac07e97ULL, 0xd24faf39ULL, 0x45937509ULL, 0x4e39f213ULL, 0xcffdb26dULL, 0xd24faf39ULL},
+{0x4881ca7cULL, 0xa9de794ULL, 0x4cea1fb8ULL, 0xd484e362ULL, 0x54ec1dc2ULL, 0xa9de794ULL, 0x8a828fd9ULL, 0x23bdf14ULL, 0x54ec1dc2ULL},
+{0xbfab5eb6ULL, 0xb833aeceULL, 0xc0e46365ULL, 0xa42eb6c0ULL, 0x2d01e35bULL, 0xb833aeceULL, 0xde0d95e9ULL, 0xb3ff2332ULL, 0x2d01e35bULL}},
+  {{0x70bddc38ULL, 0x4361e6faULL, 0xde9d8105ULL, 0x56deed6eULL, 0xc8721660ULL, 0x4361e6faULL, 0x2616593eULL, 0x53843e26ULL, 0xc8721660ULL},
+{0x8660508fULL, 0x8e2380feULL, 0x671f336fULL, 0xa9912516ULL, 0x6bbc2001ULL, 0x8e2380feULL, 0x14f24cb4ULL, 0x5d98545bULL, 0x6bbc2001ULL},
+{0x4577576bULL, 0x842ee803ULL, 0x774ff509ULL, 0x26fa1edULL, 0x21882eb5ULL, 0x842ee803ULL, 0x16f1a5d4ULL, 0x92397826ULL, 0x21882eb5ULL},
+{0xb5a41494ULL, 0xfd0b0bc3ULL, 0x92018e4aULL, 0x6b1d487cULL, 0x49be1ebdULL, 0xfd0b0bc3ULL, 0x88c1eb4ULL, 0xda601998ULL, 0x49be1ebdULL},
+{0x9ade6a32ULL, 0xd66f8f8fULL, 0x7207faabULL, 0xf63660b1ULL, 0x3e562169ULL, 0xd66f8f8fULL, 0xf105afbdULL, 0x76f56874ULL, 0x3e562169ULL},
+{0x7ffe1a1fULL, 0x506ee630ULL, 0xa2ed149cULL, 0x4dd68fdcULL, 0xc8e94e0ULL, 0x506ee630ULL, 0x958d6d6bULL, 0x3205d95eULL, 0xc8e94e0ULL},
+{0x15b8c28dULL, 0x1e24f49cULL, 0x3c540dfeULL, 0xcc66c351ULL, 0x5b330ae1ULL, 0x1e24f49cULL, 0xa4309867ULL, 0x4fae109bULL, 0x5b330ae1ULL},
+{0xc57d4492ULL, 0xfe24b98aULL, 0x3e700898ULL, 0xddb9ce29ULL, 0xbc0e3bbbULL, 0xfe24b98aULL, 0x7618732fULL, 0xff32e0caULL, 0xbc0e3bbbULL},
+{0x2dd7495dULL, 0x223ac065ULL, 0x97d510d0ULL, 0x5afef389ULL, 0x52b48865ULL, 0x223ac065ULL, 0x6206da66ULL, 0x9c6d8f7cULL, 0x52b48865ULL},
+{0x553576e3ULL, 0x35996b2fULL, 0xc1a43625ULL, 0xa5eda76bULL, 0x67b5a54ULL, 0x35996b2fULL, 0xf4a4758ULL, 0x577e020eULL, 0x67b5a54ULL},
+{0x9b9955f7ULL, 0x323e3dfULL, 0x173442ULL, 0xf2af7d10ULL, 0x91b2a030ULL, 0x323e3dfULL, 0x4b39e4bfULL, 0xcee712e5ULL, 0x91b2a030ULL},
+{0xa35117e7ULL, 0x54d333d8ULL, 0x4c7bff96ULL, 0x29bad6f5ULL, 0x22bc391fULL, 0x54d333d8ULL, 0x22170297ULL, 0x2ecf8216ULL, 0x22bc391fULL},
+{0xfe081547ULL, 0x2624df14ULL, 0x33cadeb4ULL, 0x1fe5004aULL, 0x4f87c044ULL, 0x2624df14ULL, 0x6e3b40d1ULL, 0xb6960c77ULL, 0x4f87c044ULL},
+{0x1abf57c8ULL, 0x32caffeaULL, 0x18946ce8ULL, 0x1da7df0eULL, 0x8d8d2854ULL, 0x32caffeaULL, 0x6d172b47ULL, 0x7a5ccefaULL, 0x8d8d2854ULL},
+{0xe94fdc4fULL, 0xa23a6d9cULL, 0xbe8a8b29ULL, 0xe5e87345ULL, 0xac0da16aULL, 0xa23a6d9cULL, 0x5d16f41eULL, 0x43141674ULL, 0xac0da16aULL},
+{0x7785b941ULL, 0xc2804729ULL, 0x5b8a8a05ULL, 0xafec8ed9ULL, 0x6712bdf5ULL, 0xc2804729ULL, 0x44061589ULL, 0x873da0f3ULL, 0x6712bdf5ULL},
+{0xfffbe206ULL, 0x138add24ULL, 0x5a2ed2cbULL, 0x2f179f97ULL, 0xee76945bULL, 0x138add24ULL, 0xee7efffeULL, 0x2deca0b1ULL, 0xee76945bULL},
+{0x8b2c4931ULL, 0x1d275e09ULL, 0xb035fb51ULL, 0xae0cd9fcULL, 0xf68e6aa2ULL, 0x1d275e09ULL, 0xb63908b0ULL, 0x1ca0636bULL, 0xf68e6aa2ULL},
+{0x19b58487ULL, 0x7b6a804ULL, 0xdcce9e4aULL, 0x927353a4ULL, 0xda233181ULL, 0x7b6a804ULL, 0x10485d34ULL, 0xa7033d37ULL, 0xda233181ULL},
+{0x1385abc6ULL, 0xf6523c1cULL, 0x94cef4ddULL, 0xa64e0ba9ULL, 0x2d2fe727ULL, 0xf6523c1cULL, 0xb85f82e3ULL, 0x96b4b04bULL, 0x2d2fe727ULL},
+{0x432421b4ULL, 0x8dcffcb1ULL, 0x85e1f6b8ULL, 0x1cb8b1e6ULL, 0x6b7a6e1fULL, 0x8dcffcb1ULL, 0x3ed5c3d5ULL, 0x244c2212ULL, 0x6b7a6e1fULL},
+{0xa2630618ULL, 0xfa7e472aULL, 0xab3e4b72ULL, 0x5fbe49c8ULL, 0x6b6bcef2ULL, 0xfa7e472aULL, 0x3f9437d7ULL, 0x857fcb2cULL, 0x6b6bcef2ULL},
+{0x19137a9fULL, 0x6cd5a22eULL, 0x7589c3eeULL, 0xb169f6f7ULL, 0x8fed0e15ULL, 0x6cd5a22eULL, 0x4e64f463ULL, 0x68a91356ULL, 0x8fed0e15ULL},
+{0xec6dcd32ULL, 0xa973a80eULL, 0x870e1b9eULL, 0x1c56f625ULL, 0x3f68ef32ULL, 0xa973a80eULL, 0x10232cb2ULL, 0x45950600ULL, 0x3f68ef32ULL},
+{0x903f9972ULL, 0xa899762aULL, 0x12033e34ULL, 0x91129cfbULL, 0x3de1c319ULL, 0xa899762aULL, 0x4aeab6cdULL, 0xa9a8ba55ULL, 0x3de1c319ULL},
+{0xc81fe914ULL, 0xcae24d2dULL, 0xa1148a37ULL, 0xf9b3b549ULL, 0xf5f3a8d0ULL, 0xcae24d2dULL, 0x64767ff5ULL, 0xe656dfdULL, 0xf5f3a8d0ULL},
+{0xac3c9e90ULL, 0x49af5ac0ULL, 0x12479778ULL, 0xb280d7eULL, 0x2b9f295fULL, 0x49af5ac0ULL, 0x91db1256ULL, 0x3a4a9289ULL, 0x2b9f295fULL},
+{0xbd79eed4ULL, 0x9602eaaaULL, 0x2c350a0fULL, 0xfbcae6b7ULL, 0xd77df1ULL, 0x9602eaaaULL, 0xf54ddd5fULL, 0xa54a8fa8ULL, 0xd77df1ULL},
+{0x5ca61ea5ULL, 0x382c5cc5ULL, 0x532d3342ULL, 0x9bd7442bULL, 0x63296cf0ULL, 0x382c5cc5ULL, 0x72484410ULL, 0xdad42616ULL, 0x63296cf0ULL},
+{0xb5a8d15dULL, 0xb5441c4cULL, 0x4cf9f76aULL, 0xd89d6e0eULL, 0xea054efULL, 0xb5441c4cULL, 0x5d2bbeabULL, 0x88f71a28ULL, 0xea054efULL},
+{0x824f2b13ULL, 0xdcdd6969ULL, 0xf2e4d26eULL, 0xf49fc9d9ULL, 0xf5183a05ULL, 0xdcdd6969ULL, 0x91014825ULL, 0x89917b35ULL, 0xf5183a05ULL},
+{0x8d168c4cULL, 0x5005772ULL, 0xfff5f29cULL, 0x509dc474ULL, 0x5470c2d1ULL, 0x5005772ULL, 0x3e0a61a1ULL, 0x4dc4a2d9ULL, 0x5470c2d1ULL},
+{0x5dc8b34cULL, 0xeb2a2fe9ULL, 0x1e378d68ULL, 0x95aa7bc1ULL, 0x2ab9f354ULL, 0xeb2a2fe9ULL, 0x1bf9f85fULL, 0xbea8faffULL, 0x2ab9f354ULL},
+{0x4c427f94ULL, 0x1bfe98aULL, 0x470b19b2ULL, 0x535bd914ULL, 0x31814254ULL, 0x1bfe98aULL, 0xffca026aULL, 0x3b6f1635ULL, 0x31814254ULL},
+{0x4c0bbc78ULL, 0xdf3ea97aULL, 0x597395eaULL, 0x73b4cc4bULL, 0x2b4ec5c7ULL, 0xdf3ea97aULL, 0xb274f17cULL, 0x4e27309bULL, 0x2b4ec5c7ULL},
+{0xc5dc7c56ULL, 0xd22f4a62ULL, 0xb1236a2fULL, 0x75b97f03ULL, 0x47ca2d0dULL, 0xd22f4a62ULL, 0xa2f1d5ccULL, 0x8da5c2eeULL, 0x47ca2d0dULL},
+{0xe6c691a4ULL, 0x6bd2d44cULL, 0xb8c2ef7bULL, 0xba59cc75ULL, 0xfecce7deULL, 0x6bd2d44cULL, 0xe72aba84ULL, 0xa6ae7585ULL, 0xfecce7deULL},
+{0x302f21dbULL, 0x102ea3d2ULL, 0x9c2ebd7ULL, 0x864abcc6ULL, 0x6a4906feULL, 0x102ea3d2ULL, 0x8718fe80ULL, 0x29b4f101ULL, 0x6a4906feULL},
+{0xe5c8b2f1ULL, 0xe6cc8b72ULL, 0x6f80b1d0ULL, 0x57ee5af1ULL, 0xaf99057dULL, 0xe6cc8b72ULL, 0x28facdd9ULL, 0x7ff774bULL, 0xaf99057dULL},
+{0xc28c25fULL, 0x54763fe7ULL, 0xbfb71b0bULL, 0xba0d370fULL, 0xecd24bd6ULL, 0x54763fe7ULL, 0x7363dddULL, 0xfb1199bdULL, 0xecd24bd6ULL},
+{0xa2c5981bULL, 0xbf0418acULL, 0x5acf6bbdULL, 0x7a05d214ULL, 0x1269c898ULL, 0xbf0418acULL, 0x33a14f7eULL, 0x86670e7eULL, 0x1269c898ULL},
+{0x758058dcULL, 0x57564664ULL, 0x32360f78ULL, 0xe9b8ce69ULL, 0xffe154baULL, 0x57564664ULL, 0xdbd56c63ULL, 0x9264fcb7ULL, 0xffe154baULL},
+{0x872ed3bfULL, 0xd2e03b9dULL, 0x4a33753dULL, 0x5a87f50cULL, 0xf6969433ULL, 0xd2e03b9dULL, 0xbb389337ULL, 0x22ae479ULL, 0xf6969433ULL},
+{0x5efd0a27ULL, 0x2ca59027ULL, 0xa147e3a4ULL, 0xbf369e16ULL, 0x4b8219fbULL, 0x2ca59027ULL, 0xfb702087ULL, 0xecbc458cULL, 0x4b8219fbULL},
+{0x6e5be045ULL, 0x98911f1dULL, 0xde05473bULL, 0x7b8979c9ULL, 0x90bba099ULL, 0x98911f1dULL, 0xf7ae4bfaULL, 0x34caf3d9ULL, 0x90bba099ULL},
+{0xe2f3650fULL, 0x3c7bc08ULL, 0x29c9596bULL, 0x7a6baULL, 0x4a790064ULL, 0x3c7bc08ULL, 0x6b6c7abcULL, 0xe77b249fULL, 0x4a790064ULL},
+{0xacb65022ULL, 0x2b282d58ULL, 0x93e622eaULL, 0xcdd0b921ULL, 0x7b78d875ULL, 0x2b282d58ULL, 0x11cbabeULL, 0xdd430e2bULL, 0x7b78d875ULL},
+{0xb1f97d60ULL, 0xf42b86a3ULL, 0x5b29f91bULL, 0x47a19e84ULL, 0x7b6299e8ULL, 0xf42b86a3ULL, 0x63d820b8ULL, 0xb96446c7ULL, 0x7b6299e8ULL},
+{0x6b017243ULL, 0xb15b636bULL, 0x79e70056ULL, 0xabb0f52aULL, 0xa62ac111ULL, 0xb15b636bULL, 0x6a963afULL, 0xf5dc57ffULL, 0xa62ac111ULL},
+{0x55a70f71ULL, 0xc97df388ULL, 0xe1d41247ULL, 0x94dc99deULL, 0x8c3578b2ULL, 0xc97df388ULL, 0xb41c6235ULL, 0xbc1cd3c5ULL, 0x8c3578b2ULL},
+{0xc68c9e44ULL, 0xece1b220ULL, 0x1958d0f7ULL, 0x9e33ef98ULL, 0x504a8a73ULL, 0xece1b220ULL, 0x11366dbaULL, 0xb481da0fULL, 0x504a8a73ULL},
+{0x8c4e26a7ULL, 0x7cdd5e64ULL, 0xf65ce9d2ULL, 0x9e60d62fULL, 0x306873e6ULL, 0x7cdd5e64ULL, 0x1d1ca9c5ULL, 0xc0c2cf57ULL, 0x306873e6ULL},
+{0xb0021c5bULL, 0xe573bdf5ULL, 0xe388d5a1ULL, 0x81074943ULL, 0x6b3152fULL, 0xe573bdf5ULL, 0x9ed2871aULL, 0x93732ea8ULL, 0x6b3152fULL},
+{0x42edeebdULL, 0xb12e5afdULL, 0xabf5116fULL, 0x5584c09bULL, 0x7df85acdULL, 0xb12e5afdULL, 0x1dbb321cULL, 0x281753a4ULL, 0x7df85acdULL},
+{0xdb9d1c6cULL, 0xf3806858ULL, 0x6b93338aULL, 0x6f629a8ULL, 0x10b90b12ULL, 0xf3806858ULL, 0x3f95df05ULL, 0xa450d4b6ULL, 0x10b90b12ULL},
+{0x798c264fULL, 0xa79ff1ceULL, 0x845ff81ULL, 0xd25f859eULL, 0x7ee4dc0cULL, 0xa79ff1ceULL, 0xfffe499bULL, 0x74d4d59ULL, 0x7ee4dc0cULL},
+{0x751c0ec8ULL, 0x4014b529ULL, 0x356849a7ULL, 0xd8828a27ULL, 0xea8a1ddeULL, 0x4014b529ULL, 0xd243942dULL, 0x5b78019eULL, 0xea8a1ddeULL},
+{0x606b4991ULL, 0xb0ded68cULL, 0xcb097b5aULL, 0xb3e29538ULL, 0x94b53977ULL, 0xb0ded68cULL, 0xcdbbd90bULL, 0x81eeaceeULL, 0x94b53977ULL},
+{0x2e8003c1ULL, 0xd7bee052ULL, 0x1d4c327aULL, 0x198990d1ULL, 0x655ddd80ULL, 0xd7bee052ULL, 0xd84baa91ULL, 0x80e8c65ULL, 0x655ddd80ULL},
+{0xf6177b52ULL, 0xb6b07b02ULL, 0x26070f3cULL, 0x39b219d2ULL, 0x121a6cd2ULL, 0xb6b07b02ULL, 0xd798b55fULL, 0x99df91ffULL, 0x121a6cd2ULL},
+{0xbf684c4cULL, 0x140bbcedULL, 0x4707649eULL, 0x302570c2ULL, 0x3e4f8bddULL, 0x140bbcedULL, 0xaa174e7cULL, 0x45cdd0c0ULL, 0x3e4f8bddULL},
+{0xe2556d37ULL, 0x8b4e7b95ULL, 0xd7650b45ULL, 0x228f1031ULL, 0xe2936e7bULL, 0x8b4e7b95ULL, 0x1f045c35ULL, 0x1c1a4732ULL, 0xe2936e7bULL},
+{0xfec2c6faULL, 0xa93b26b8ULL, 0x34cb649eULL, 0xbf3d98f4ULL, 0x405b3325ULL, 0xa93b26b8ULL, 0x12e0314dULL, 0xbd5d35cdULL, 0x405b3325ULL},
+{0xbf93feb9ULL, 0x557c9ee7ULL, 0xaf8668baULL, 0xa4181210ULL, 0xf0e4f596ULL, 0x557c9ee7ULL, 0x4e83cbcfULL, 0x143224f2ULL, 0xf0e4f596ULL},
+{0x51fc613eULL, 0x7556ded7ULL, 0xfac114c5ULL, 0xd8445634ULL, 0x2faa9ebdULL, 0x7556ded7ULL, 0x4cbe0825ULL, 0x4bfbadb5ULL, 0x2faa9ebdULL},
+{0x60d054e6ULL, 0x87845979ULL, 0x38f4568ULL, 0xe9a8f596ULL, 0x28a9b13ULL, 0x87845979ULL, 0x602fd346ULL, 0x9c15458eULL, 0x28a9b13ULL},
+{0x5e91bfd1ULL, 0xc30b2066ULL, 0x24447bc6ULL, 0x2dc6d768ULL, 0x85d4c386ULL, 0xc30b2066ULL, 0x9b8b55abULL, 0xbb0d2f7bULL, 0x85d4c386ULL},
+{0x85e7d210ULL, 0x899e81c8ULL, 0x22dea8b2ULL, 0xba8d96f2ULL, 0x2c411af6ULL, 0x899e81c8ULL, 0xf9e50e0cULL, 0x1b7ff8d4ULL, 0x2c411af6ULL},
+{0x7c26e6b9ULL, 0xed19d8a4ULL, 0xc71d8534ULL, 0x700b376cULL, 0xe9d9c459ULL, 0xed19d8a4ULL, 0x71fcd6b3ULL, 0x185fe8f6ULL, 0xe9d9c459ULL},
+{0xcb93cf14ULL, 0x49bad608ULL, 0x3f9da319ULL, 0xcf92853eULL, 0x2e4540f5ULL, 0x49bad608ULL, 0x88ce7528ULL, 0xe5182bffULL, 0x2e4540f5ULL},
+{0x6a7da278ULL, 0x35ee6c71ULL, 0x74014312ULL, 0x3ecf02cfULL, 0xa996ada8ULL, 0x35ee6c71ULL, 0x7caf8cacULL, 0x7bc16bc6ULL, 0xa996ada8ULL},
+{0xe67ad6e3ULL, 0x52505da3ULL, 0x83d616aaULL, 0xd47d8ce6ULL, 0x420905c3ULL, 0x52505da3ULL, 0x7de5f4afULL, 0x42460fa4ULL, 0x420905c3ULL},
+{0xe55c3c35ULL, 0x92148a10ULL, 0x193619f8ULL, 0x10d0c7beULL, 0xf2e8cfb8ULL, 0x92148a10ULL, 0x942da931ULL, 0x365afec5ULL, 0xf2e8cfb8ULL},
+{0xea3c115aULL, 0x15e237d3ULL, 0x3586e187ULL, 0x6283728dULL, 0x96668080ULL, 0x15e237d3ULL, 0x7bbcea90ULL, 0xb58f718fULL, 0x96668080ULL},
+{0x3a1ec23fULL, 0x70940b1dULL, 0x4b54308eULL, 0x883f1170ULL, 0x68d854d7ULL, 0x70940b1dULL, 0x13f44a7bULL, 0x72a2a8e1ULL, 0x68d854d7ULL},
+{0xecd69879ULL, 0x30a0ddd4ULL, 0xcaf4623eULL, 0xb38a73adULL, 0x45ef0f9cULL, 0x30a0ddd4ULL, 0x74e7ffaeULL, 0x3b3d6726ULL, 0x45ef0f9cULL},
+{0x2d3cf864ULL, 0x19fdb440ULL, 0x6058368eULL, 0xb9916185ULL, 0xf4d667c3ULL, 0x19fdb440ULL, 0xd5dea5f8ULL, 0xa78ab40bULL, 0xf4d667c3ULL},
+{0x368a605fULL, 0xe447271eULL, 0x418c3ff3ULL, 0x1770d0e8ULL, 0xaf6d0db8ULL, 0xe447271eULL, 0x20be0829ULL, 0x76f16263ULL, 0xaf6d0db8ULL},
+{0x884670a3ULL, 0x18ea7bddULL, 0x6fbf40c3ULL, 0x73591cd3ULL, 0x212ba19fULL, 0x18ea7bddULL, 0x82acf58dULL, 0x1aa3cbfULL, 0x212ba19fULL},
+{0xcb366330ULL, 0x82b9f995ULL, 0x6b034a43ULL, 0x50635134ULL, 0xdd2ec6b7ULL, 0x82b9f995ULL, 0x85acd399ULL, 0xd4750a02ULL, 0xdd2ec6b7ULL},
+{0xeb4e96eeULL, 0x713c3503ULL, 0xbc8fe0cdULL, 0xb8049be1ULL, 0x75be8da6ULL, 0x713c3503ULL, 0xc55d3b1aULL, 0x2f29b0ecULL, 0x75be8da6ULL},
+{0x40438995ULL, 0xd9453d25ULL, 0xf4e6ff4fULL, 0x3b8c3799ULL, 0xc1d2d607ULL, 0xd9453d25ULL, 0xc67eaaecULL, 0x88966549ULL, 0xc1d2d607ULL},
+{0x1a60fcfeULL, 0x9a597c38ULL, 0x135ca172ULL, 0xdeaa484aULL, 0xeced4a51ULL, 0x9a597c38ULL, 0x6a9400e5ULL, 0x80f37bbcULL, 0xeced4a51ULL},
+{0x25344b6ULL, 0xe0e5ff29ULL, 0x1c694f81ULL, 0xda33a34fULL, 0x21ad6aeULL, 0xe0e5ff29ULL, 0xbd14555fULL, 0x3c7b547eULL, 0x21ad6aeULL},
+{0x1826c25aULL, 0xe178e940ULL, 0xadfec724ULL, 0x676f097dULL, 0xbf8c330bULL, 0xe178e940ULL, 0x4ce1f31eULL, 0x3e7531faULL, 0xbf8c330bULL},
+{0x7f95c7cfULL, 0xf6b2c2aaULL, 0xf5de14b6ULL, 0xa0e74080ULL, 0xc6f95251ULL, 0xf6b2c2aaULL, 0xa0d19f69ULL, 0xd99418edULL, 0xc6f95251ULL},
+{0xc02b92ddULL, 0xfd35a5f6ULL, 0x3dab15eeULL, 0x414fe9ceULL, 0xb1a07d94ULL, 0xfd35a5f6ULL, 0x2ebf83dULL, 0x19e6ffbfULL, 0xb1a07d94ULL},
+{0xfc036090ULL, 0x99694cb0ULL, 0xf623c72fULL, 0x6c86551aULL, 0xf66dd8d3ULL, 0x99694cb0ULL, 0xb01c7db0ULL, 0x485e914ULL, 0xf66dd8d3ULL},
+{0x80c356faULL, 0x9121d840ULL, 0x46de9044ULL, 0x47588a9bULL, 0x8e5c9618ULL, 0x9121d840ULL, 0xe332c08bULL, 0xa6e77934ULL, 0x8e5c9618ULL},
+{0x7da2f1e8ULL, 0x702ddb2cULL, 0xe306ace8ULL, 0xaaa14155ULL, 0x38ab84bcULL, 0x702ddb2cULL, 0x357a42d3ULL, 0xb53df7eULL, 0x38ab84bcULL},
+{0x8877d3a6ULL, 0x4feac7e9ULL, 0xcbfba702ULL, 0xe079c704ULL, 0x4985ed9fULL, 0x4feac7e9ULL, 0xfbc025c5ULL, 0x333d68c5ULL, 0x4985ed9fULL},
+{0x8f6f9715ULL, 0x7e7fb00fULL, 0x313047bULL, 0x53bba00ULL, 0xf8e90c1ULL, 0x7e7fb00fULL, 0x33f15be6ULL, 0x43c60cebULL, 0xf8e90c1ULL},
+{0x45be244bULL, 0x5bd3dc99ULL, 0xa4b13d54ULL, 0xc46c4222ULL, 0xae6f976fULL, 0x5bd3dc99ULL, 0xa2347c3eULL, 0xc2c3619ULL, 0xae6f976fULL},
+{0x528895d3ULL, 0x81cc6a0bULL, 0x9238c803ULL, 0x3d30dd39ULL, 0xa94862d6ULL, 0x81cc6a0bULL, 0x522cf414ULL, 0xeefbcecfULL, 0xa94862d6ULL},
+{0x35695f02ULL, 0x931b3941ULL, 0xd958ca6eULL, 0xe7790d32ULL, 0x404dde61ULL, 0x931b3941ULL, 0xfb748977ULL, 0xf18d274fULL, 0x404dde61ULL},
+{0xbe2284efULL, 0x57f4b1caULL, 0xa607e278ULL, 0xff85dcc3ULL, 0x8ee18e1eULL, 0x57f4b1caULL, 0x1806649cULL, 0x8469f80aULL, 0x8ee18e1eULL},
+{0x725ab474ULL, 0x2545f3e8ULL, 0x6afbff47ULL, 0x8858170eULL, 0x533f2f8fULL, 0x2545f3e8ULL, 0x18b35457ULL, 0xe348fd65ULL, 0x533f2f8fULL},
+{0x9923858eULL, 0x34f2a597ULL, 0x1770a6aaULL, 0x93d1cda7ULL, 0x226c27aaULL, 0x34f2a597ULL, 0x2621bd57ULL, 0x8794b876ULL, 0x226c27aaULL},
+{0x70175079ULL, 0x75f3bc62ULL, 0x7e017273ULL, 0xe44d73afULL, 0xfe952d44ULL, 0x75f3bc62ULL, 0xc2b20788ULL, 0xeb64c193ULL, 0xfe952d44ULL},
+{0xba6a91c3ULL, 0x9972fa6fULL, 0x13107814ULL, 0xb4b4b59ULL, 0x672c5f50ULL, 0x9972fa6fULL, 0xf49684a0ULL, 0xed0335c5ULL, 0x672c5f50ULL},
+{0x9c83e6cbULL, 0x2aebcaefULL, 0x193d365bULL, 0x194e6c2eULL, 0xf529cd1aULL, 0x2aebcaefULL, 0xe6d9c1ULL, 0xe907e1aeULL, 0xf529cd1aULL},
+{0x9a06de1eULL, 0x45629f58ULL, 0xcddb3c6bULL, 0x13fee6f0ULL, 0x90e1ec82ULL, 0x45629f58ULL, 0x6d408597ULL, 0xf55b8cd4ULL, 0x90e1ec82ULL},
+{0x5219e826ULL, 0x94a2e63aULL, 0xdd39b709ULL, 0xb5568acfULL, 0xc11f283aULL, 0x94a2e63aULL, 0xab40e652ULL, 0x3d34869dULL, 0xc11f283aULL},
+{0x53638c52ULL, 0x9f882e98ULL, 0x1ac1a4dULL, 0xeb30088ULL, 0xf918fbaeULL, 0x9f882e98ULL, 0x360ec309ULL, 0x775d8f07ULL, 0xf918fbaeULL},
+{0xa979270aULL, 0x53b80c52ULL, 0x5faeffbcULL, 0x6ead963ULL, 0x64d5d25aULL, 0x53b80c52ULL, 0xf5893315ULL, 0xbf9faa9bULL, 0x64d5d25aULL},
+{0x9f0f8cf1ULL, 0x56d12aceULL, 0x5cd83143ULL, 0x272f115aULL, 0x630fd937ULL, 0x56d12aceULL, 0x7fa4c0f2ULL, 0xd57c9edULL, 0x630fd937ULL},
+{0x4376e056ULL, 0xfb5a9d81ULL, 0xd0efc495ULL, 0x5d4cf8d5ULL, 0x296f2d0aULL, 0xfb5a9d81ULL, 0x84155579ULL, 0x75cff4bcULL, 0x296f2d0aULL},
+{0x380ed709ULL, 0xbc643436ULL, 0x1136457aULL, 0x36e867f3ULL, 0x8dd5412ULL, 0xbc643436ULL, 0xe3066ULL, 0x63691d9fULL, 0x8dd5412ULL},
+{0x65b50697ULL, 0xbdbb3efaULL, 0xd39c84c7ULL, 0x7fb96bbeULL, 0x8e67f09cULL, 0xbdbb3efaULL, 0x51faedf2ULL, 0x94c69f7dULL, 0x8e67f09cULL},
+{0xaa004e6cULL, 0x60f1f797ULL, 0xa5a03808ULL, 0x6b5189b6ULL, 0x46d4b8efULL, 0x60f1f797ULL, 0xace7128fULL, 0x2389f6efULL, 0x46d4b8efULL},
+{0x9c55bc62ULL, 0x21f866d1ULL, 0x19e7da65ULL, 0x25ef5bafULL, 0x8f15e600ULL, 0x21f866d1ULL, 0x2dfefecbULL, 0x64645ed5ULL, 0x8f15e600ULL},
+{0x2c37d0c0ULL, 0x712cd9f6ULL, 0x6ca39896ULL, 0x4e656f7eULL, 0x3d43864fULL, 0x712cd9f6ULL, 0xbb532000ULL, 0xe67e3793ULL, 0x3d43864fULL},
+{0x92f44600ULL, 0xeef3d89ULL, 0x64af61b8ULL, 0xc2950123ULL, 0x2d2eb1deULL, 0xeef3d89ULL, 0xbb951847ULL, 0xd7030cb9ULL, 0x2d2eb1deULL},
+{0x4e7be88fULL, 0x7f34d224ULL, 0x95481b31ULL, 0xf07bafbeULL, 0xfe95833ULL, 0x7f34d224ULL, 0x74439d4dULL, 0x7fed1bbdULL, 0xfe95833ULL},
+{0x379b3063ULL, 0xed548382ULL, 0x609428bcULL, 0x2626a6e0ULL, 0xdb4b9dceULL, 0xed548382ULL, 0xafaa28cdULL, 0x488ac0daULL, 0xdb4b9dceULL},
+{0x46c38ac8ULL, 0xeb2d6e00ULL, 0x8a7b48c4ULL, 0xcce77c11ULL, 0x6f779b2ULL, 0xeb2d6e00ULL, 0xff29200eULL, 0x67e05359ULL, 0x6f779b2ULL},
+{0x25a3482bULL, 0xb382fb85ULL, 0xfa9618cfULL, 0x9746b378ULL, 0x6c3bb119ULL, 0xb382fb85ULL, 0x67a03cf7ULL, 0x55c83a6bULL, 0x6c3bb119ULL},
+{0x443a4c3fULL, 0x921f1136ULL, 0xc5b00106ULL, 0x240a50e6ULL, 0x74e61543ULL, 0x921f1136ULL, 0x573ad09fULL, 0xc3643b86ULL, 0x74e61543ULL},
+{0x8f845b7fULL, 0xdd5089f5ULL, 0xf92bfea8ULL, 0xeeb0250ULL, 0xb811ae8eULL, 0xdd5089f5ULL, 0x5c23d6b5ULL, 0x4f666eedULL, 0xb811ae8eULL},
+{0x7d76c515ULL, 0xd3182c74ULL, 0x393731faULL, 0x87a70f13ULL, 0x7a1b65afULL, 0xd3182c74ULL, 0xb401296bULL, 0x43beb472ULL, 0x7a1b65afULL},
+{0xcb9aea99ULL, 0xe26e5396ULL, 0x385f23d7ULL, 0x4a513f0cULL, 0x8acce9fcULL, 0xe26e5396ULL, 0x555c5292ULL, 0x2cb7ddb9ULL, 0x8acce9fcULL},
+{0x9e7d93fcULL, 0xdb95bf51ULL, 0x40983473ULL, 0x1adddda3ULL, 0x65d424cbULL, 0xdb95bf51ULL, 0x3952b9bULL, 0x1eb253d5ULL, 0x65d424cbULL},
+{0xff3dfaabULL, 0xb967b4ebULL, 0xd43a455cULL, 0xfd09f516ULL, 0xb9cbcabfULL, 0xb967b4ebULL, 0x63413f1fULL, 0xfa0ceaa9ULL, 0xb9cbcabfULL},
+{0xabdfdd64ULL, 0x5fc8b9d6ULL, 0x974b910cULL, 0x51ba21deULL, 0x1bebcfcULL, 0x5fc8b9d6ULL, 0xc40ba164ULL, 0xb2dfe1dULL, 0x1bebcfcULL},
+{0x1431483cULL, 0xaf903abULL, 0x78a621d4ULL, 0xe53001cULL, 0x46d5713aULL, 0xaf903abULL, 0x728910eaULL, 0x867d5ab0ULL, 0x46d5713aULL},
+{0x8761366bULL, 0x9e7b2c19ULL, 0x2b2631adULL, 0x8955ab4eULL, 0x1e22c997ULL, 0x9e7b2c19ULL, 0xec24521ULL, 0x94ec6f38ULL, 0x1e22c997ULL},
+{0x691748e6ULL, 0x9a8a5500ULL, 0xf6e67ea2ULL, 0xa3482c29ULL, 0x9ef26407ULL, 0x9a8a5500ULL, 0x25542e89ULL, 0x6b9eb871ULL, 0x9ef26407ULL},
+{0x11eb39fcULL, 0x7a78e5a7ULL, 0x59620c2dULL, 0x6909b6bcULL, 0x54c2a787ULL, 0x7a78e5a7ULL, 0xd573a425ULL, 0x47f9ee4bULL, 0x54c2a787ULL},
+{0x9e2911f5ULL, 0xa39af761ULL, 0x9dffd08bULL, 0x14d83fa7ULL, 0xb89160a5ULL, 0xa39af761ULL, 0x35b9db3dULL, 0xbb35b48fULL, 0xb89160a5ULL},
+{0x591dec53ULL, 0x8b921df1ULL, 0x82f4c3edULL, 0x3df6d252ULL, 0xf960b19cULL, 0x8b921df1ULL, 0x6fc8c580ULL, 0xbbf7fb0bULL, 0xf960b19cULL},
+{0x9b6b3d43ULL, 0x853a3201ULL, 0x3e7664e1ULL, 0x2ea71e53ULL, 0xcadba310ULL, 0x853a3201ULL, 0x8798c7c9ULL, 0x4146b901ULL, 0xcadba310ULL},
+{0x40055b64ULL, 0xfd767a0aULL, 0x8aafd1baULL, 0xe776f677ULL, 0x23b5516bULL, 0xfd767a0aULL, 0x959df5bULL, 0x2d228115ULL, 0x23b5516bULL},
+{0xabd1190ULL, 0xda5e9a82ULL, 0xef9e9f6aULL, 0x174a8f9bULL, 0xd54bc172ULL, 0xda5e9a82ULL, 0x16d2cf8cULL, 0x5c520741ULL, 0xd54bc172ULL},
+{0xf19fe423ULL, 0x595fee28ULL, 0xf4c57469ULL, 0x2dbbded8ULL, 0x1229aa50ULL, 0x595fee28ULL, 0x9a36d67eULL, 0x182e09faULL, 0x1229aa50ULL},
+{0x10234df2ULL, 0xbf792f3fULL, 0x915a2a7bULL, 0x273058dbULL, 0xa9f5e675ULL, 0xbf792f3fULL, 0xbc52414dULL, 0xdefe05f4ULL, 0xa9f5e675ULL},
+{0xd9b550f9ULL, 0x98eb2e9aULL, 0xcda88017ULL, 0xb7126af3ULL, 0x366bd30fULL, 0x98eb2e9aULL, 0xda80cf38ULL, 0x42282da8ULL, 0x366bd30fULL},
+{0x2bd297f6ULL, 0x20280015ULL, 0x4be3abffULL, 0x8d920be9ULL, 0x4d56685bULL, 0x20280015ULL, 0x2977736cULL, 0xbee60d05ULL, 0x4d56685bULL},
+{0x66810449ULL, 0xda0bc957ULL, 0xbbc3370fULL, 0x8cc24735ULL, 0xafb7ac59ULL, 0xda0bc957ULL, 0x98b56c84ULL, 0x21cfadcaULL, 0xafb7ac59ULL},
+{0x31d7e9afULL, 0xf95ea2c6ULL, 0x9b6981e2ULL, 0x4df7b7a0ULL, 0xb5423d8aULL, 0xf95ea2c6ULL, 0x9759433dULL, 0xa237284ULL, 0xb5423d8aULL},
+{0xe26fe683ULL, 0x3306895fULL, 0xf4bae86fULL, 0xa668ef8aULL, 0x21c2a496ULL, 0x3306895fULL, 0xe92b498eULL, 0x1c5e551eULL, 0x21c2a496ULL},
+{0x2fdaebbeULL, 0x4519fa49ULL, 0x9e8ad0afULL, 0x8b1d6acfULL, 0x4163bb4fULL, 0x4519fa49ULL, 0x18687b22ULL, 0x9888ae2cULL, 0x4163bb4fULL},
+{0x41805c94ULL, 0x47608f98ULL, 0x8dd94a2cULL, 0x2a30047aULL, 0x8515438bULL, 0x47608f98ULL, 0x1dd32db3ULL, 0x5ce66e28ULL, 0x8515438bULL},
+{0xbe3bb700ULL, 0x89582e7aULL, 0x8437a96dULL, 0xc70518c7ULL, 0xd23c148dULL, 0x89582e7aULL, 0xf3e1f702ULL, 0x6933dfULL, 0xd23c148dULL},
+{0x986b4b34ULL, 0x8d6956caULL, 0xfb8c4bf1ULL, 0xebc029e2ULL, 0xb6d82603ULL, 0x8d6956caULL, 0x139efc03ULL, 0x8b461bf4ULL, 0xb6d82603ULL},
+{0xc073fb2eULL, 0xa5f2c471ULL, 0xa0e87a4aULL, 0xe98e7d3ULL, 0x40dfe4ffULL, 0xa5f2c471ULL, 0x3c047b01ULL, 0x9ad28c09ULL, 0x40dfe4ffULL},
+{0xb43ea2f9ULL, 0xbce68bf3ULL, 0xd3bd455ULL, 0x154eb562ULL, 0x9dfa2762ULL, 0xbce68bf3ULL, 0x90d62241ULL, 0xcc660271ULL, 0x9dfa2762ULL},
+{0xba7e2770ULL, 0x8940fdf8ULL, 0x4557806bULL, 0xffcc0238ULL, 0x6f7033cbULL, 0x8940fdf8ULL, 0xd2ce9321ULL, 0x93671417ULL, 0x6f7033cbULL},
+{0xa7227a87ULL, 0x4b165d37ULL, 0x9c268135ULL, 0x450465a6ULL, 0xe8ec9626ULL, 0x4b165d37ULL, 0x5bf6fad5ULL, 0x56ad856eULL, 0xe8ec9626ULL},
+{0x74582afULL, 0x5300e1afULL, 0x678013d0ULL, 0x3ad25d20ULL, 0xb8a9e097ULL, 0x5300e1afULL, 0xdcdaeac7ULL, 0x15f0deb2ULL, 0xb8a9e097ULL},
+{0xb3ed7516ULL, 0x837284afULL, 0x89d68cf2ULL, 0xad074e37ULL, 0x5d1d4180ULL, 0x837284afULL, 0x961bf02eULL, 0x8b668d5eULL, 0x5d1d4180ULL},
+{0xb2f6d0b8ULL, 0x1286aefbULL, 0x6f4b38fbULL, 0xd4c02d9eULL, 0x47fd8e0fULL, 0x1286aefbULL, 0x8d322729ULL, 0x8ff78998ULL, 0x47fd8e0fULL},
+{0xd0471a7dULL, 0xbc277163ULL, 0x5e23fb18ULL, 0xb05adaf9ULL, 0x78117a91ULL, 0xbc277163ULL, 0xa88e9ebdULL, 0x8c3df98cULL, 0x78117a91ULL},
+{0xc0768a87ULL, 0xdbb99683ULL, 0x7a7af40ULL, 0x46625dddULL, 0x2ef196eaULL, 0xdbb99683ULL, 0xa3bc5fcfULL, 0xe2c002f6ULL, 0x2ef196eaULL},
+{0xc694c655ULL, 0xb4194d23ULL, 0x37a59e08ULL, 0x574fd64bULL, 0x3219201fULL, 0xb4194d23ULL, 0xda005343ULL, 0x7400fd49ULL, 0x3219201fULL},
+{0x3d6359cbULL, 0x76184b2bULL, 0x2a5f8757ULL, 0x2bfb73f8ULL, 0x69ca800ULL, 0x76184b2bULL, 0x83b5625cULL, 0x278a56b7ULL, 0x69ca800ULL},
+{0xbb2fc43bULL, 0x2ffeac5eULL, 0xa41b9259ULL, 0x44a14796ULL, 0xb68a8076ULL, 0x2ffeac5eULL, 0xe79c8c54ULL, 0x1e03f835ULL, 0xb68a8076ULL},
+{0xc7580c43ULL, 0x8ddaeea4ULL, 0x8b8b8a66ULL, 0xca6fc799ULL, 0x6d05da9cULL, 0x8ddaeea4ULL, 0xd8aed695ULL, 0x3b2b4414ULL, 0x6d05da9cULL},
+{0x941eea52ULL, 0xfc9f5761ULL, 0x4d2a6bd1ULL, 0x6d2035afULL, 0xad54de25ULL, 0xfc9f5761ULL, 0x6affd2f8ULL, 0x2888a031ULL, 0xad54de25ULL},
+{0x9a3edd93ULL, 0xbd98b4abULL, 0x491f687eULL, 0x4a60882bULL, 0xe5e8512bULL, 0xbd98b4abULL, 0x9bc6a425ULL, 0xa04e17c2ULL, 0xe5e8512bULL},
+{0xcc1ca1fdULL, 0xd19ae805ULL, 0xb191181aULL, 0xa56f442eULL, 0x4ce7d705ULL, 0xd19ae805ULL, 0x41eafb00ULL, 0xcdfda743ULL, 0x4ce7d705ULL},
+{0x4bbeda9aULL, 0x48d8da44ULL, 0xcdd83338ULL, 0xa284155dULL, 0x3d60d479ULL, 0x48d8da44ULL, 0x1d458174ULL, 0xd8b240c6ULL, 0x3d60d479ULL},
+{0xad788f14ULL, 0xfffdbaeaULL, 0x1293c64aULL, 0x9b11814fULL, 0xc76fa3aaULL, 0xfffdbaeaULL, 0xa5b4b64ULL, 0xf79a573ULL, 0xc76fa3aaULL},
+{0xf8fa071dULL, 0xa9a08358ULL, 0x10684dc5ULL, 0x2f097a2fULL, 0x980e980fULL, 0xa9a08358ULL, 0x277d8087ULL, 0x91a48f3ULL, 0x980e980fULL},
+{0xe2543777ULL, 0xad0476d8ULL, 0x606fa5aeULL, 0xd405ffc3ULL, 0x8cc81cfdULL, 0xad0476d8ULL, 0xf75d95f5ULL, 0x880be8b4ULL, 0x8cc81cfdULL},
+{0x4028758dULL, 0xe72436dbULL, 0x956bf302ULL, 0x88f3f2abULL, 0xa76c5edcULL, 0xe72436dbULL, 0x9fa772e4ULL, 0xd6036686ULL, 0xa76c5edcULL},
+{0x6988bde9ULL, 0x5ef4265bULL, 0x304d70cfULL, 0x7ec9ecbeULL, 0x3764dccbULL, 0x5ef4265bULL, 0x7ca4d602ULL, 0x7deb0790ULL, 0x3764dccbULL},
+{0x9027bed6ULL, 0x1018a8f8ULL, 0xd8cd68a4ULL, 0x292f588fULL, 0x789744e4ULL, 0x1018a8f8ULL, 0x6f593e20ULL, 0xeb3902bULL, 0x789744e4ULL},
+{0xab764a18ULL, 0x4906217ULL, 0x53a4bd89ULL, 0xcf632a5cULL, 0xe0dfb487ULL, 0x4906217ULL, 0x3fe090d2ULL, 0xfe3b862fULL, 0xe0dfb487ULL},
+{0x21121dfULL, 0x5858e0c5ULL, 0xb47d6bb2ULL, 0x4d542cf5ULL, 0x5eb1c641ULL, 0x5858e0c5ULL, 0xc033b2ccULL, 0x71dc8dc1ULL, 0x5eb1c641ULL},
+{0x37fe7eccULL, 0xc6396c31ULL, 0xfe25777aULL, 0x486e2a56ULL, 0x3d587abdULL, 0xc6396c31ULL, 0x2c1dfc0aULL, 0x8ef4d79dULL, 0x3d587abdULL},
+{0x4e950aa5ULL, 0xe3216b61ULL, 0xd77f4e54ULL, 0x416dbf44ULL, 0xc21d4bbfULL, 0xe3216b61ULL, 0xd2c72772ULL, 0xc2e71ff0ULL, 0xc21d4bbfULL},
+{0x8f067153ULL, 0x6bd5c158ULL, 0xc3f0945cULL, 0x1b74ddc5ULL, 0x4a0f7ab1ULL, 0x6bd5c158ULL, 0xb4e96240ULL, 0xb212c643ULL, 0x4a0f7ab1ULL},
+{0xd9fdd71cULL, 0x4f21dc34ULL, 0x37a3b545ULL, 0xf5a673caULL, 0x61bb6239ULL, 0x4f21dc34ULL, 0x84e62563ULL, 0x2d5d51a0ULL, 0x61bb6239ULL},
+{0xef0e531cULL, 0x9a62d08ULL, 0x2e6f625ULL, 0x67608e1ULL, 0xe3d226f0ULL, 0x9a62d08ULL, 0x201ccd02ULL, 0x9d752118ULL, 0xe3d226f0ULL},
+{0x8ef2a5d7ULL, 0xefb7363dULL, 0x1d2fa21cULL, 0x74d80a32ULL, 0x5579bbbULL, 0xefb7363dULL, 0xe7bb6d62ULL, 0xdf398947ULL, 0x5579bbbULL},
+{0x816d81fbULL, 0x6ac9aa5dULL, 0x306dfacbULL, 0xf6d10f5bULL, 0x31ff86f6ULL, 0x6ac9aa5dULL, 0x2c1cf3bdULL, 0xe460da88ULL, 0x31ff86f6ULL},
+{0x68aad2feULL, 0x8ca39629ULL, 0x2099ca23ULL, 0x817ab53cULL, 0x9e66c7f7ULL, 0x8ca39629ULL, 0x6b2478d9ULL, 0xe0c204c6ULL, 0x9e66c7f7ULL},
+{0xf19574e2ULL, 0x8b93770cULL, 0xe5a9b866ULL, 0xdea3f156ULL, 0x10a0bfd8ULL, 0x8b93770cULL, 0xc2940d27ULL, 0x3bbed061ULL, 0x10a0bfd8ULL},
+{0x4057de48ULL, 0xaff080efULL, 0x8fde4061ULL, 0xf8b908b6ULL, 0x3fffd56bULL, 0xaff080efULL, 0x2c8e7ce8ULL, 0x6259f830ULL, 0x3fffd56bULL},
+{0xefbf6e2dULL, 0x10c41b2bULL, 0x8b3fee15ULL, 0x262a2b29ULL, 0x3c82bd47ULL, 0x10c41b2bULL, 0x85a0424fULL, 0xe51a1340ULL, 0x3c82bd47ULL},
+{0x7a75616ULL, 0x850f4ffcULL, 0xcf8c20aaULL, 0xe4dbd72cULL, 0x3434a9a5ULL, 0x850f4ffcULL, 0x5b123d4ULL, 0x8bfb76b8ULL, 0x3434a9a5ULL},
+{0xdfd4b9faULL, 0x953766f7ULL, 0x3b6d8788ULL, 0x90410aa5ULL, 0x99a9deULL, 0x953766f7ULL, 0x9484f94dULL, 0x9206f76bULL, 0x99a9deULL},
+{0x7741060fULL, 0xc72c541dULL, 0xd56777b4ULL, 0xf76c2368ULL, 0xe724d095ULL, 0xc72c541dULL, 0x3fb990ddULL, 0x8ac971c2ULL, 0xe724d095ULL},
+{0xf1aed6f9ULL, 0x503b5a36ULL, 0x56b80903ULL, 0x6658e8d1ULL, 0x97bbf93eULL, 0x503b5a36ULL, 0x41641cd9ULL, 0x51325d6bULL, 0x97bbf93eULL},
+{0x6b8ada18ULL, 0xa7008505ULL, 0x876151e0ULL, 0xb7e6456fULL, 0xe388d695ULL, 0xa7008505ULL, 0x33dcf888ULL, 0x882d0b87ULL, 0xe388d695ULL},
+{0xebbbd807ULL, 0xee12ef55ULL, 0x4414567fULL, 0xc52b6816ULL, 0x738d50b9ULL, 0xee12ef55ULL, 0x99574f2ULL, 0x24681123ULL, 0x738d50b9ULL},
+{0x4c6faf4bULL, 0x54bbd10bULL, 0x4d20ef55ULL, 0xc73eed94ULL, 0x3af63a53ULL, 0x54bbd10bULL, 0x6f2cbe50ULL, 0xf16b8f24ULL, 0x3af63a53ULL},
+{0xd3e2cbf7ULL, 0x27f6c2b9ULL, 0x6796f3fcULL, 0x3db62635ULL, 0x7283930aULL, 0x27f6c2b9ULL, 0xa9ffc56ULL, 0xbf7583a8ULL, 0x7283930aULL},
+{0x4e095ec8ULL, 0x288e44f6ULL, 0x3503d127ULL, 0xbdd2b4f2ULL, 0xfd4312f6ULL, 0x288e44f6ULL, 0xc49d944bULL, 0x19ce533fULL, 0xfd4312f6ULL},
+{0xd6f1bb09ULL, 0x4fa27713ULL, 0x91db9612ULL, 0x214c4af2ULL, 0x39c7b455ULL, 0x4fa27713ULL, 0x9502d664ULL, 0xabe9021dULL, 0x39c7b455ULL},
+{0x57087f22ULL, 0xfea65807ULL, 0xbf3d92b0ULL, 0x2c8aff67ULL, 0x5c7ceb7bULL, 0xfea65807ULL, 0xfa8dce63ULL, 0x591e122cULL, 0x5c7ceb7bULL},
+{0xb3e483fdULL, 0x92534927ULL, 0x565cc550ULL, 0x685196c2ULL, 0xbf2e94bbULL, 0x92534927ULL, 0x5c0f90d1ULL, 0x63f6f1edULL, 0xbf2e94bbULL},
+{0x16681782ULL, 0x715c87eaULL, 0xbe2e78bdULL, 0xe5306f08ULL, 0xf3055288ULL, 0x715c87eaULL, 0xe6cc0132ULL, 0xa35b40abULL, 0xf3055288ULL},
+{0xa3bf1959ULL, 0x151a8d44ULL, 0x316fe4e2ULL, 0x60024c2dULL, 0x109b2b0cULL, 0x151a8d44ULL, 0x800bdeaeULL, 0x76053137ULL, 0x109b2b0cULL},
+{0x82352b9cULL, 0x4c4eefccULL, 0x9130a1bULL, 0x4f6947a6ULL, 0xe3356f48ULL, 0x4c4eefccULL, 0x9bd718c2ULL, 0xb99e17e0ULL, 0xe3356f48ULL},
+{0xb8596fd3ULL, 0xef955408ULL, 0x52e217f2ULL, 0xbbb25b1cULL, 0x30d06e96ULL, 0xef955408ULL, 0x11fd3a4eULL, 0x772c7960ULL, 0x30d06e96ULL},
+{0x2f3538faULL, 0x7e62fdaULL, 0xde313fc4ULL, 0x88003381ULL, 0xa0838f8ULL, 0x7e62fdaULL, 0x134acf38ULL, 0x9247b956ULL, 0xa0838f8ULL},
+{0x63c28162ULL, 0x2b27519ULL, 0x82b2bc78ULL, 0x1209255bULL, 0xdfd3d859ULL, 0x2b27519ULL, 0x89ff759aULL, 0x8ccfa5eaULL, 0xdfd3d859ULL},
+{0xfa78dfa5ULL, 0x9d3daefeULL, 0x2bfd6617ULL, 0x4c0ec1f8ULL, 0x97b9877aULL, 0x9d3daefeULL, 0x9fbc15a0ULL, 0xb563c87eULL, 0x97b9877aULL},
+{0x9cf217f5ULL, 0xcde44860ULL, 0x3bb21bbfULL, 0x3117d27dULL, 0x7dfa54b9ULL, 0xcde44860ULL, 0x29ebbf78ULL, 0xe8a4b85eULL, 0x7dfa54b9ULL},
+{0xe9299593ULL, 0x7f3bd681ULL, 0x3f164edULL, 0xee9b0c1ULL, 0x9efc782ULL, 0x7f3bd681ULL, 0xa5f13bfeULL, 0xe6f24cb1ULL, 0x9efc782ULL},
+{0x3078acf8ULL, 0xc71c74b5ULL, 0x7ba5c701ULL, 0xb9c47febULL, 0xfe2432baULL, 0xc71c74b5ULL, 0x9b04d721ULL, 0x5b6f9851ULL, 0xfe2432baULL},
+{0xdb5d02e2ULL, 0xc19a232fULL, 0xc0aa9d78ULL, 0x56556343ULL, 0xf5dd18c5ULL, 0xc19a232fULL, 0x458d9068ULL, 0x462ccdb4ULL, 0xf5dd18c5ULL},
+{0x560080eeULL, 0x7e568366ULL, 0x5e17bfeaULL, 0xff53dbf0ULL, 0x9878954ULL, 0x7e568366ULL, 0x8f95829bULL, 0x6943997eULL, 0x9878954ULL},
+{0xc5437e6aULL, 0x6f9219b4ULL, 0xeef6f87fULL, 0x118ebbcdULL, 0xf843d8d2ULL, 0x6f9219b4ULL, 0x551cccaULL, 0xa2e0f17dULL, 0xf843d8d2ULL},
+{0x9d85af09ULL, 0x5553cae4ULL, 0xde2c94a6ULL, 0x48787a0bULL, 0x7c9a475bULL, 0x5553cae4ULL, 0x6182a4d0ULL, 0x4e8bd25eULL, 0x7c9a475bULL},
+{0x436ede75ULL, 0x19572d7eULL, 0xf7ba916bULL, 0x22bcfa92ULL, 0x6f5a7b50ULL, 0x19572d7eULL, 0xe3629394ULL, 0x94a9a281ULL, 0x6f5a7b50ULL},
+{0x6b93a6bfULL, 0x5cb5f457ULL, 0x51156811ULL, 0xc46489b7ULL, 0x6351dacbULL, 0x5cb5f457ULL, 0xb3a64891ULL, 0x42a80a40ULL, 0x6351dacbULL},
+{0x3f721bebULL, 0x6daadf85ULL, 0xc25662f9ULL, 0x7e0827efULL, 0xe790dda3ULL, 0x6daadf85ULL, 0x608301ddULL, 0x2577e6b9ULL, 0xe790dda3ULL},
+{0x8e4a8499ULL, 0xd7a3f251ULL, 0x8287e82cULL, 0xe65f221cULL, 0xc4c18f1bULL, 0xd7a3f251ULL, 0xfc24c956ULL, 0x147a14b4ULL, 0xc4c18f1bULL},
+{0xe0fafc52ULL, 0xca851173ULL, 0x6a2aaafeULL, 0x167389b4ULL, 0x91340bdeULL, 0xca851173ULL, 0xc19e99d6ULL, 0x65aa02a2ULL, 0x91340bdeULL},
+{0xe01f1041ULL, 0xf4defd93ULL, 0xecda5bb9ULL, 0xd66ad68cULL, 0xd0cf60e7ULL, 0xf4defd93ULL, 0x484122ccULL, 0xdcf47953ULL, 0xd0cf60e7ULL},
+{0xe7dae865ULL, 0xcb18bdebULL, 0x7e728a9bULL, 0xd50c6948ULL, 0x98b6ccb7ULL, 0xcb18bdebULL, 0xecd06983ULL, 0xdc0150a1ULL, 0x98b6ccb7ULL},
+{0xc4229021ULL, 0x99a79d35ULL, 0x2192a665ULL, 0xebf10bb5ULL, 0xcd4e9904ULL, 0x99a79d35ULL, 0xcfd439b5ULL, 0x19f81542ULL, 0xcd4e9904ULL},
+{0x5a9fb942ULL, 0xa17c98bfULL, 0x4213e997ULL, 0xd87f8189ULL, 0x4dde2785ULL, 0xa17c98bfULL, 0xb7ac7f52ULL, 0x99f158eaULL, 0x4dde2785ULL},
+{0xdb5da9e4ULL, 0x4efe7fb9ULL, 0x5f54fd3bULL, 0x837808f4ULL, 0xdafbee70ULL, 0x4efe7fb9ULL, 0xf6ac83a0ULL, 0x66d2a3a0ULL, 0xdafbee70ULL},
+{0x9b5bbbd5ULL, 0xc85b960bULL, 0x9049a240ULL, 0x9300386eULL, 0x67b83e78ULL, 0xc85b960bULL, 0xbb7c7605ULL, 0xfef9334eULL, 0x67b83e78ULL},
+{0x3f40fa8bULL, 0x47cd22fULL, 0x1cfdbf95ULL, 0x9190de43ULL, 0x5421468eULL, 0x47cd22fULL, 0x3f52f0a4ULL, 0xca6c25a3ULL, 0x5421468eULL},
+{0x54cc0aa8ULL, 0x38b06384ULL, 0x7072b8abULL, 0x4bc62e27ULL, 0x97379b77ULL, 0x38b06384ULL, 0x2f2ecfc7ULL, 0x24371f22ULL, 0x97379b77ULL},
+{0xc8e666bdULL, 0x89aecde5ULL, 0xe7a0a1a3ULL, 0x7e4c5531ULL, 0xb7fb9531ULL, 0x89aecde5ULL, 0x5dd0c9abULL, 0xe91cba7bULL, 0xb7fb9531ULL},
+{0x7e30ee4fULL, 0x2f41bbeaULL, 0xa6a6f2aeULL, 0x44dd11f4ULL, 0xf4ef17d4ULL, 0x2f41bbeaULL, 0x38988236ULL, 0x9e5e3d64ULL, 0xf4ef17d4ULL},
+{0xac42f493ULL, 0x75503ed2ULL, 0x8d22345bULL, 0xff1c10bULL, 0xd029caedULL, 0x75503ed2ULL, 0x41bd259fULL, 0xa0200e21ULL, 0xd029caedULL},
+{0x7a797cf3ULL, 0xc79c2693ULL, 0xfdeb3852ULL, 0xd64a6266ULL, 0x89a8d75ULL, 0xc79c2693ULL, 0xed8f1805ULL, 0x4ca0beb3ULL, 0x89a8d75ULL},
+{0x61677afeULL, 0xd1e64182ULL, 0x34058c4ULL, 0x43c6bfd7ULL, 0xb1b6ac30ULL, 0xd1e64182ULL, 0x20e702d4ULL, 0x2dfec266ULL, 0xb1b6ac30ULL},
+{0x726631d2ULL, 0xc2d2f136ULL, 0x2c66bd73ULL, 0x262fa6d1ULL, 0x25c24b07ULL, 0xc2d2f136ULL, 0xa60bf092ULL, 0x67b5a181ULL, 0x25c24b07ULL},
+{0x242f9b1eULL, 0x8d214a67ULL, 0xda1ceddfULL, 0x8761b430ULL, 0xde1d5061ULL, 0x8d214a67ULL, 0x5e1d6726ULL, 0x18b9a3d7ULL, 0xde1d5061ULL},
+{0x1545585cULL, 0x8a6eb521ULL, 0x96f5cdd6ULL, 0x43ac4103ULL, 0xa5e0a3beULL, 0x8a6eb521ULL, 0x6227a125ULL, 0xa92269cbULL, 0xa5e0a3beULL},
+{0xab2a8eb4ULL, 0x39576931ULL, 0x2df032aaULL, 0xc9efb4b5ULL, 0x79f6228ULL, 0x39576931ULL, 0xff998d7cULL, 0xbc9edb05ULL, 0x79f6228ULL},
+{0x9784fba4ULL, 0x9d2bde4eULL, 0xf3a7141ULL, 0x6dcdb245ULL, 0x44b45595ULL, 0x9d2bde4eULL, 0x2c2898dULL, 0x4b33607eULL, 0x44b45595ULL},
+{0x588abc35ULL, 0x53f1349bULL, 0x16c7c17dULL, 0xef2aade8ULL, 0xaa29e583ULL, 0x53f1349bULL, 0xe183a1baULL, 0xca8836d5ULL, 0xaa29e583ULL},
+{0xcbb6a186ULL, 0xd4687c90ULL, 0x3178e853ULL, 0xdf475455ULL, 0x42e3a1c6ULL, 0xd4687c90ULL, 0x447103cbULL, 0x65e85ed7ULL, 0x42e3a1c6ULL},
+{0x2e104615ULL, 0xf493750aULL, 0x987b970bULL, 0x54011245ULL, 0xc3aee5bfULL, 0xf493750aULL, 0xaf46277aULL, 0xa9478d7eULL, 0xc3aee5bfULL},
+{0xcc16c93aULL, 0xd7b53bc5ULL, 0xf803c605ULL, 0x87d9df58ULL, 0xce33cb4dULL, 0xd7b53bc5ULL, 0x2210f251ULL, 0xf195f861ULL, 0xce33cb4dULL},
+{0xb489336ULL, 0x7237e886ULL, 0xf4170b6ULL, 0xdc2cf336ULL, 0x97fb72b8ULL, 0x7237e886ULL, 0xb2a84e9ULL, 0xfe4e4ae3ULL, 0x97fb72b8ULL},
+{0x56efe6a2ULL, 0xbe4061fbULL, 0xe0cea80eULL, 0x797c1bc8ULL, 0xd8c9d8f8ULL, 0xbe4061fbULL, 0x5267966bULL, 0xefeb85d6ULL, 0xd8c9d8f8ULL},
+{0xd4178d0ULL, 0x9c3271faULL, 0x1c63a9e9ULL, 0xb53fbe35ULL, 0x1cda1c5fULL, 0x9c3271faULL, 0x8e8d644aULL, 0xb1aa0d80ULL, 0x1cda1c5fULL},
+{0x3292a58bULL, 0xb832774eULL, 0x386617b5ULL, 0x481073a6ULL, 0xd91020caULL, 0xb832774eULL, 0xeb88ee28ULL, 0x488108deULL, 0xd91020caULL},
+{0xc4725111ULL, 0x5c40078dULL, 0x36261801ULL, 0xce7affabULL, 0x4a2425c1ULL, 0x5c40078dULL, 0x84f3b2c4ULL, 0xb57ee99eULL, 0x4a2425c1ULL},
+{0xaa7a1102ULL, 0xe67bbaf5ULL, 0x3b1dab2eULL, 0x7fc4eed1ULL, 0x6bf475efULL, 0xe67bbaf5ULL, 0xe4a4d4b8ULL, 0x63e2a82cULL, 0x6bf475efULL},
+{0x22d96853ULL, 0xb1c1c897ULL, 0x709a1644ULL, 0x508d9fe8ULL, 0x7c7ebfb9ULL, 0xb1c1c897ULL, 0x52a3816cULL, 0x9872856eULL, 0x7c7ebfb9ULL},
+{0x8c1d8446ULL, 0xe2b748a8ULL, 0xd571a161ULL, 0x3ecc7293ULL, 0xa3eb3dd2ULL, 0xe2b748a8ULL, 0xcc66bd0bULL, 0xa6bf79b2ULL, 0xa3eb3dd2ULL},
+{0x6a339e69ULL, 0xe92e205fULL, 0x16f3e221ULL, 0xb7f2457ULL, 0xcf35aba8ULL, 0xe92e205fULL, 0x30a8c48cULL, 0x1a7e62ecULL, 0xcf35aba8ULL},
+{0x9d07e6f1ULL, 0x64f8d712ULL, 0xcc2adaf8ULL, 0xf1147f4cULL, 0x4f753ef5ULL, 0x64f8d712ULL, 0x6b0b647ULL, 0xcc3f6177ULL, 0x4f753ef5ULL},
+{0x98d1ed81ULL, 0xc782faa1ULL, 0x3ed09a1fULL, 0x3e6e8b07ULL, 0xc2a94222ULL, 0xc782faa1ULL, 0x51dac60dULL, 0x9b3ab4c0ULL, 0xc2a94222ULL},
+{0x75eaac4dULL, 0x87c751c3ULL, 0xc238153dULL, 0x5edad476ULL, 0x1b2a6eedULL, 0x87c751c3ULL, 0xe8d8ff69ULL, 0x5b5ab180ULL, 0x1b2a6eedULL},
+{0xa82a1addULL, 0x3b7942e0ULL, 0x7eb9b7c8ULL, 0x53d62410ULL, 0xbab5aa6fULL, 0x3b7942e0ULL, 0x6eb47c84ULL, 0xb703e4aeULL, 0xbab5aa6fULL},
+{0x9e9e0a76ULL, 0xe049d361ULL, 0x5c78672cULL, 0x234a6fa3ULL, 0xdeaedc94ULL, 0xe049d361ULL, 0xb0159bebULL, 0xd14e7e40ULL, 0xdeaedc94ULL},
+{0x85ec42ceULL, 0x89723d73ULL, 0x93aac619ULL, 0x297fec98ULL, 0xf77f092dULL, 0x89723d73ULL, 0x9717f078ULL, 0x7aa8e749ULL, 0xf77f092dULL},
+{0x8d885f2aULL, 0x577e89faULL, 0x540390daULL, 0xc00c2d4fULL, 0xa1bffd34ULL, 0x577e89faULL, 0xc37d81e1ULL, 0xbd96d983ULL, 0xa1bffd34ULL},
+{0xe4391b71ULL, 0xa68849d0ULL, 0xb8f1d898ULL, 0x68e00aa9ULL, 0xaa9cd974ULL, 0xa68849d0ULL, 0x8d10d48fULL, 0x3cf62d96ULL, 0xaa9cd974ULL},
+{0x3a13894ULL, 0x6d4d4d3fULL, 0xe939fc71ULL, 0x7a424039ULL, 0x11f057bfULL, 0x6d4d4d3fULL, 0xec50f5e2ULL, 0x1ea53387ULL, 0x11f057bfULL},
+{0x92238d10ULL, 0xba4671fULL, 0x97de39caULL, 0x9eda8b8ULL, 0xe53507b4ULL, 0xba4671fULL, 0x3f3b9502ULL, 0x1fb2c983ULL, 0xe53507b4ULL},
+{0xe91d9d34ULL, 0xdf5c5844ULL, 0x57a3c674ULL, 0x1fd06fc5ULL, 0x630fc27eULL, 0xdf5c5844ULL, 0x7fe732cdULL, 0xb102dad8ULL, 0x630fc27eULL},
+{0xe1e95b41ULL, 0x6309bbf4ULL, 0xc4c22112ULL, 0xd3523fe4ULL, 0x8615664fULL, 0x6309bbf4ULL, 0xd8d1d523ULL, 0x812fbacULL, 0x8615664fULL},
+{0x82f97fa9ULL, 0x87891dd6ULL, 0x91d20662ULL, 0x68f982c8ULL, 0x1fda6c58ULL, 0x87891dd6ULL, 0x676788d3ULL, 0x33d5dc52ULL, 0x1fda6c58ULL}},
+  {{0xf8a7c87cULL, 0xf24aba28ULL, 0x734e40e9ULL, 0xb5c7157dULL, 0x67fd0a47ULL, 0xf24aba28ULL, 0x387d922cULL, 0xeb90cee3ULL, 0x67fd0a47ULL},
+{0x60e12a3cULL, 0xd5351093ULL, 0xa59f400bULL, 0x671d36caULL, 0x3e8fa3ceULL, 0xd5351093ULL, 0x7c85b4c0ULL, 0x5d912a2dULL, 0x3e8fa3ceULL},
+{0x3314a90ULL, 0x8100e82cULL, 0x130c955dULL, 0x1ca41a61ULL, 0x78358f25ULL, 0x8100e82cULL, 0xdac68f11ULL, 0x4ddc704dULL, 0x78358f25ULL},
+{0x51d75dddULL, 0xebf39f76ULL, 0x21ec0a60ULL, 0x1870c01cULL, 0xd3abdbaeULL, 0xebf39f76ULL, 0x33d3281bULL, 0x642c4ee0ULL, 0xd3abdbaeULL},
+{0x1bc38c30ULL, 0x490b0244ULL, 0xe3fa2d3aULL, 0x60f54001ULL, 0xe38aeffaULL, 0x490b0244ULL, 0xa51f4677ULL, 0xc88c383cULL, 0xe38aeffaULL},
+{0xa44a9dc5ULL, 0xb07fb563ULL, 0x10cf8ec5ULL, 0xdb947ed1ULL, 0xa523f7caULL, 0xb07fb563ULL, 0xa00eb51cULL, 0x47a5c366ULL, 0xa523f7caULL},
+{0xfbb4b02aULL, 0xedc8f5bbULL, 0xa18a1a4eULL, 0xa3280b63ULL, 0xff72ce80ULL, 0xedc8f5bbULL, 0x29811f85ULL, 0xb1109557ULL, 0xff72ce80ULL},
+{0x7daef76aULL, 0x979cf242ULL, 0x36763a49ULL, 0x7de2555cULL, 0x3c5941eeULL, 0x979cf242ULL, 0x97bcfecfULL, 0xbb3882caULL, 0x3c5941eeULL},
+{0x203872a9ULL, 0x2b72e4bfULL, 0x659bc7cbULL, 0x55f032bfULL, 0xa9f0d721ULL, 0x2b72e4bfULL, 0xb537c039ULL, 0x97a9f7adULL, 0xa9f0d721ULL},
+{0x8540fb4ULL, 0x38dd85a1ULL, 0xbe6e59abULL, 0xab8aae62ULL, 0xfa87625aULL, 0x38dd85a1ULL, 0xda637720ULL, 0x21a4c420ULL, 0xfa87625aULL},
+{0xb392a8dbULL, 0xc1d40944ULL, 0x981103eaULL, 0xbc2cba33ULL, 0xc8454b3fULL, 0xc1d40944ULL, 0x59b0ed4ULL, 0xaf8ac268ULL, 0xc8454b3fULL},
+{0x47881a4fULL, 0xd09e5cf5ULL, 0x52426493ULL, 0x58c4186cULL, 0x739c2061ULL, 0xd09e5cf5ULL, 0x66a2d7f4ULL, 0xcde67bd0ULL, 0x739c2061ULL},
+{0xc1d2b12dULL, 0xf7ea65a6ULL, 0x7e164d23ULL, 0xe8d9d18dULL, 0xf29f7427ULL, 0xf7ea65a6ULL, 0x74b117caULL, 0x6e9ffc8dULL, 0xf29f7427ULL},
+{0x2a33b5e2ULL, 0x40118037ULL, 0x6e0a23cbULL, 0xdbcfabe2ULL, 0x23a3158cULL, 0x40118037ULL, 0x7df48c25ULL, 0xb0a3d54cULL, 0x23a3158cULL},
+{0xb5cd620bULL, 0x6964955eULL, 0x8a0aa106ULL, 0x6d83b653ULL, 0xbb33c370ULL, 0x6964955eULL, 0x896fb2e6ULL, 0xc1231c5cULL, 0xbb33c370ULL},
+{0x44fae61eULL, 0x22dc2319ULL, 0x87799915ULL, 0x6143527bULL, 0xb3a3c80fULL, 0x22dc2319ULL, 0xed10f0e9ULL, 0x4e3f8efULL, 0xb3a3c80fULL},
+{0xeeb8f47eULL, 0xf58d4cb8ULL, 0x8e1f7fa6ULL, 0xa131fc75ULL, 0xdb0870edULL, 0xf58d4cb8ULL, 0xf376f247ULL, 0xd297f80dULL, 0xdb0870edULL},
+{0x308f1268ULL, 0x26acde7bULL, 0xfe2bd1e1ULL, 0xb0a62a7fULL, 0x46758705ULL, 0x26acde7bULL, 0xa5a9c47ULL, 0xee73b681ULL, 0x46758705ULL},
+{0x1e47ce93ULL, 0x8a9213f3ULL, 0xb335ca13ULL, 0x5717f3f2ULL, 0x9f408b78ULL, 0x8a9213f3ULL, 0xd36f313fULL, 0x43071dc8ULL, 0x9f408b78ULL},
+{0xd2448189ULL, 0x7b62fb09ULL, 0x8b439125ULL, 0x283e5fecULL, 0x3887011ULL, 0x7b62fb09ULL, 0xcd50bd6ULL, 0x610adc18ULL, 0x3887011ULL},
+{0x402057c9ULL, 0xdbd60462ULL, 0x37baea6fULL, 0xdd1fef6bULL, 0xd15fe6aeULL, 0xdbd60462ULL, 0xf32bcc57ULL, 0x57298c4aULL, 0xd15fe6aeULL},
+{0x2b32114cULL, 0xe7213e28ULL, 0x46a93a41ULL, 0x1569b227ULL, 0xedc0430fULL, 0xe7213e28ULL, 0x620ead51ULL, 0xbea1304eULL, 0xedc0430fULL},
+{0x6b357820ULL, 0x450547e3ULL, 0x21106f8cULL, 0xc4479198ULL, 0xaa357ab2ULL, 0x450547e3ULL, 0x21746c92ULL, 0x8e422c62ULL, 0xaa357ab2ULL},
+{0xb5072227ULL, 0xabde1baaULL, 0x18f3913ULL, 0x524b8c8dULL, 0xd6812e61ULL, 0xabde1baaULL, 0x5dceb8ffULL, 0xd18b5845ULL, 0xd6812e61ULL},
+{0x99141a12ULL, 0x834d7c39ULL, 0x5d2ad9bdULL, 0x9cae539bULL, 0xa59248faULL, 0x834d7c39ULL, 0xb6506508ULL, 0x58a9f8b1ULL, 0xa59248faULL},
+{0x83dd1b5ULL, 0x1a9c7eadULL, 0x5ef8ce88ULL, 0xe08fb7e0ULL, 0xc41e6066ULL, 0x1a9c7eadULL, 0x7a80e9c4ULL, 0x9df2ad0bULL, 0xc41e6066ULL},
+{0xf0695382ULL, 0x322c41a9ULL, 0x2765dfe8ULL, 0x6307febeULL, 0x6ea8b0fbULL, 0x322c41a9ULL, 0x31e1b79bULL, 0xf5027526ULL, 0x6ea8b0fbULL},
+{0x953d2643ULL, 0x7a74e68eULL, 0x7cee4640ULL, 0xfa5716f3ULL, 0xc917a485ULL, 0x7a74e68eULL, 0x45ea299fULL, 0x41aa58c1ULL, 0xc917a485ULL},
+{0x6ebd9737ULL, 0x378e4f22ULL, 0xe288d94eULL, 0x3b98880aULL, 0x581668bcULL, 0x378e4f22ULL, 0xae30b5dbULL, 0x76741cb8ULL, 0x581668bcULL},
+{0x4e528fcULL, 0x9c1c07a6ULL, 0x26697952ULL, 0xc481ff80ULL, 0xdcefd5feULL, 0x9c1c07a6ULL, 0xd9d97a8fULL, 0xaf89e93bULL, 0xdcefd5feULL},
+{0x54ba4a88ULL, 0xeda06348ULL, 0x27398b1cULL, 0xcbe97f02ULL, 0x628fe29bULL, 0xeda06348ULL, 0x1171ab93ULL, 0xebf1190dULL, 0x628fe29bULL},
+{0xd5660a5eULL, 0xbb02db86ULL, 0x8f483b25ULL, 0xd56fba56ULL, 0xdac11254ULL, 0xbb02db86ULL, 0x27252069ULL, 0x69324d03ULL, 0xdac11254ULL},
+{0x15b40662ULL, 0x23453c80ULL, 0xeedd337eULL, 0xdb4ca653ULL, 0x611e8766ULL, 0x23453c80ULL, 0xc5a5f43dULL, 0x661ac826ULL, 0x611e8766ULL},
+{0x4aa545a6ULL, 0xcbbc685eULL, 0xf39fcbc3ULL, 0xf39d3e78ULL, 0x260066b9ULL, 0xcbbc685eULL, 0x427d42e3ULL, 0x32d11e97ULL, 0x260066b9ULL},
+{0x64b070cbULL, 0x1f35b484ULL, 0x1b5b633cULL, 0xfed9bdd2ULL, 0x78ae7e72ULL, 0x1f35b484ULL, 0x87a0bb99ULL, 0xf7feaa1dULL, 0x78ae7e72ULL},
+{0x69e6224aULL, 0x17441c3eULL, 0xc07497a6ULL, 0xa347e6efULL, 0x84134d60ULL, 0x17441c3eULL, 0x9414a95eULL, 0x3fab1ee1ULL, 0x84134d60ULL},
+{0xf274e12cULL, 0xdec4a2deULL, 0xd5fd7fc1ULL, 0xf7de2660ULL, 0x98f7372cULL, 0xdec4a2deULL, 0x3ecd07a2ULL, 0x6722c2dbULL, 0x98f7372cULL},
+{0xa44ab1d9ULL, 0xf9598209ULL, 0x4ad8836cULL, 0x7f83555aULL, 0xeae99a1ULL, 0xf9598209ULL, 0x6e088c5ULL, 0x68db69a4ULL, 0xeae99a1ULL},
+{0x2a3ac696ULL, 0xca5ba2d7ULL, 0x6b0a469bULL, 0xe5460a6dULL, 0xd9096462ULL, 0xca5ba2d7ULL, 0x4d19c207ULL, 0xdb73dca4ULL, 0xd9096462ULL},
+{0xde9b971aULL, 0xf9caa37fULL, 0x254528fcULL, 0xe6fde990ULL, 0x3f95b311ULL, 0xf9caa37fULL, 0x84846addULL, 0xb9fb26a9ULL, 0x3f95b311ULL},
+{0xa5096032ULL, 0xe1b538dfULL, 0xf5d0299aULL, 0xcf29264cULL, 0xd58db6daULL, 0xe1b538dfULL, 0x358707fcULL, 0x5380bc59ULL, 0xd58db6daULL},
+{0x5f56aca2ULL, 0x8e06f49bULL, 0x7e1fc6a1ULL, 0xb3bf13d8ULL, 0x7abd79dfULL, 0x8e06f49bULL, 0x3f03009dULL, 0xfc8d38c5ULL, 0x7abd79dfULL},
+{0xc323b119ULL, 0x1f56088bULL, 0x37420584ULL, 0x69c673bbULL, 0x2582948eULL, 0x1f56088bULL, 0x9b24bcb1ULL, 0xc209301eULL, 0x2582948eULL},
+{0x292c628ULL, 0xc0ea65b0ULL, 0xc0a61aeaULL, 0x210405abULL, 0x860de092ULL, 0xc0ea65b0ULL, 0x4e60dc5eULL, 0x3fdeafe4ULL, 0x860de092ULL},
+{0x978067a0ULL, 0x399c4e62ULL, 0x28f70daaULL, 0x8381771bULL, 0x1a551a21ULL, 0x399c4e62ULL, 0xb6b32380ULL, 0xfcb8eb9aULL, 0x1a551a21ULL},
+{0x2f105b64ULL, 0xf51ddfd1ULL, 0x7c088e7ULL, 0xdc1cd111ULL, 0xd49f15eeULL, 0xf51ddfd1ULL, 0x5d46db72ULL, 0xa99c9113ULL, 0xd49f15eeULL},
+{0x49018c03ULL, 0xf5664806ULL, 0x26b014c7ULL, 0x4df15ebfULL, 0x51e2a82aULL, 0xf5664806ULL, 0xa2e619eaULL, 0xd821891bULL, 0x51e2a82aULL},
+{0x20061aebULL, 0xb3f0234dULL, 0x7dd25739ULL, 0xa1b74836ULL, 0xcee0bd5dULL, 0xb3f0234dULL, 0x12b47191ULL, 0x264a4acbULL, 0xcee0bd5dULL},
+{0xf4623c00ULL, 0xacb7c211ULL, 0xcf26c283ULL, 0xe3237c4aULL, 0x24485951ULL, 0xacb7c211ULL, 0xe0998312ULL, 0xc7a1ffbcULL, 0x24485951ULL},
+{0x1f751fa3ULL, 0xe3109057ULL, 0xdbcab056ULL, 0x16dcd254ULL, 0xfb63447eULL, 0xe3109057ULL, 0x56f3ff23ULL, 0x99700cefULL, 0xfb63447eULL},
+{0xafc26da2ULL, 0x5f016d28ULL, 0xe8261ebfULL, 0x240d67eeULL, 0x8a0232c1ULL, 0x5f016d28ULL, 0x3f00e056ULL, 0x7b114b28ULL, 0x8a0232c1ULL},
+{0xd5389a36ULL, 0xccb1e90bULL, 0x22538b6cULL, 0xacad4f6bULL, 0x1481e7a1ULL, 0xccb1e90bULL, 0x369b70aeULL, 0xd5b5146fULL, 0x1481e7a1ULL},
+{0xfb6378dULL, 0x2d4f884aULL, 0x72a46d1cULL, 0x9917008aULL, 0x50c472b6ULL, 0x2d4f884aULL, 0x569fb2b9ULL, 0xff17fb6cULL, 0x50c472b6ULL},
+{0xf8681edfULL, 0xaace4f1cULL, 0x74ba5453ULL, 0xd3ae3455ULL, 0xcaf06407ULL, 0xaace4f1cULL, 0xb7eef671ULL, 0x38e86c49ULL, 0xcaf06407ULL},
+{0x23ecd4b7ULL, 0x698eb580ULL, 0xa05ec18ULL, 0xac6bff11ULL, 0x52af6721ULL, 0x698eb580ULL, 0x69dc6ebdULL, 0x3315f349ULL, 0x52af6721ULL},
+{0x6c1f7be3ULL, 0xabc4ded5ULL, 0xa9355990ULL, 0xd7570784ULL, 0x2ac17a20ULL, 0xabc4ded5ULL, 0x93010ebfULL, 0xd3633bf4ULL, 0x2ac17a20ULL},
+{0x11156a1aULL, 0x93bc4de2ULL, 0xb393a963ULL, 0x12427f99ULL, 0x70baf8aULL, 0x93bc4de2ULL, 0x4c545f47ULL, 0xf66c69bbULL, 0x70baf8aULL},
+{0x4e294984ULL, 0x4ca5f90ULL, 0xc1be9b9eULL, 0x1b12399dULL, 0x53c49916ULL, 0x4ca5f90ULL, 0xde9222fcULL, 0x4265ca46ULL, 0x53c49916ULL},
+{0x331ce43dULL, 0x23692497ULL, 0xeda8ba27ULL, 0xe788ba93ULL, 0xed88315eULL, 0x23692497ULL, 0x94cdc2e9ULL, 0x74b4471bULL, 0xed88315eULL},
+{0xcee37bffULL, 0x41ea2723ULL, 0x11d51311ULL, 0xb46660deULL, 0xb2df5285ULL, 0x41ea2723ULL, 0x712ff8beULL, 0x4aef2013ULL, 0xb2df5285ULL},
+{0x8293678cULL, 0x69027b8fULL, 0x33a3f0a7ULL, 0xb7330ac3ULL, 0x11d7361bULL, 0x69027b8fULL, 0x1d88f79cULL, 0x6161454ULL, 0x11d7361bULL},
+{0x58014f07ULL, 0x88e0d85cULL, 0x45f635acULL, 0xaa579eb5ULL, 0x16ed3815ULL, 0x88e0d85cULL, 0x3b13bc07ULL, 0x11f1e909ULL, 0x16ed3815ULL},
+{0x8234d48dULL, 0xf031d168ULL, 0x8115b613ULL, 0x7d7c51e8ULL, 0x43ea723bULL, 0xf031d168ULL, 0x2d9c2ebeULL, 0xc0b6f273ULL, 0x43ea723bULL},
+{0xa6721eddULL, 0xd89d43ecULL, 0xe7af657fULL, 0xd6af786aULL, 0xce853cddULL, 0xd89d43ecULL, 0xbaee1512ULL, 0xa9748da1ULL, 0xce853cddULL},
+{0xd3350cffULL, 0xce9da385ULL, 0x774816bfULL, 0x58a8902eULL, 0x2b6178c9ULL, 0xce9da385ULL, 0x2cb63febULL, 0xd227605dULL, 0x2b6178c9ULL},
+{0x795791bfULL, 0x2a33e462ULL, 0xea07f51dULL, 0x76319c25ULL, 0xce0a9865ULL, 0x2a33e462ULL, 0xfcdad00bULL, 0xafc9d117ULL, 0xce0a9865ULL},
+{0x9ec05281ULL, 0x202a8fc7ULL, 0x7663c8eeULL, 0xa1f6d51eULL, 0x64d67695ULL, 0x202a8fc7ULL, 0x7a09c3fcULL, 0xae463dd9ULL, 0x64d67695ULL},
+{0xe3c25741ULL, 0x1eff7e0cULL, 0xd746fcc8ULL, 0xf4fb465cULL, 0x2baae5c6ULL, 0x1eff7e0cULL, 0x2e644c28ULL, 0xdbe6ceaeULL, 0x2baae5c6ULL},
+{0x9fc94715ULL, 0x37f36ba0ULL, 0xc81e43e9ULL, 0x50d1cc7cULL, 0xbde9ad0cULL, 0x37f36ba0ULL, 0xdc2ca258ULL, 0xa176208ULL, 0xbde9ad0cULL},
+{0x695bb7d0ULL, 0x9de47e4dULL, 0xb3ce36f8ULL, 0xba372aacULL, 0x662ea872ULL, 0x9de47e4dULL, 0x10b69fc9ULL, 0xb1698a3bULL, 0x662ea872ULL},
+{0xa0f725ceULL, 0x2d0ee32fULL, 0xa66d4e8bULL, 0x5504f1c5ULL, 0x9887582dULL, 0x2d0ee32fULL, 0xb1bca51ULL, 0x3bf414ebULL, 0x9887582dULL},
+{0xc66e4dfeULL, 0x8bd394cfULL, 0x7a968e04ULL, 0xf263be3eULL, 0xd27fb244ULL, 0x8bd394cfULL, 0x9864f306ULL, 0x7bea976aULL, 0xd27fb244ULL},
+{0x8a12cb77ULL, 0x6464ff36ULL, 0xd1531b30ULL, 0x7a31a700ULL, 0xf598a87eULL, 0x6464ff36ULL, 0xf444f20bULL, 0xfc52d20cULL, 0xf598a87eULL},
+{0xfe745e4bULL, 0x591d8bcdULL, 0xf335f8f4ULL, 0x10a4798eULL, 0x6fccbf60ULL, 0x591d8bcdULL, 0xd2c4013bULL, 0x3c2132eeULL, 0x6fccbf60ULL},
+{0xa7ac3227ULL, 0xf6a22f2dULL, 0x8ca677c3ULL, 0xc6795be5ULL, 0xbc1d2567ULL, 0xf6a22f2dULL, 0xafdbd60eULL, 0xfca600b3ULL, 0xbc1d2567ULL},
+{0xfb940153ULL, 0x318e7fdeULL, 0x3469d7c5ULL, 0x838cc503ULL, 0x3637aa9ULL, 0x318e7fdeULL, 0xc38c1a62ULL, 0x69bd1685ULL, 0x3637aa9ULL},
+{0x7df7adf3ULL, 0xbed43ec7ULL, 0x1f3d86ecULL, 0xc4678e28ULL, 0xfc82b6f5ULL, 0xbed43ec7ULL, 0x27bec056ULL, 0xfd9faf95ULL, 0xfc82b6f5ULL},
+{0x972ae85cULL, 0xc97c92e9ULL, 0x83c728bdULL, 0x847ec8b7ULL, 0x34cc35f0ULL, 0xc97c92e9ULL, 0xbe4a622eULL, 0x2baf202dULL, 0x34cc35f0ULL},
+{0xdeaf77f3ULL, 0xc161dae6ULL, 0xc305096eULL, 0xf11f73a6ULL, 0xffa1d7c4ULL, 0xc161dae6ULL, 0x868818c8ULL, 0x7bb2b6b6ULL, 0xffa1d7c4ULL},
+{0xb6a26a6eULL, 0xf6063838ULL, 0x1c075db4ULL, 0x7f5fe893ULL, 0xa85d7d9ULL, 0xf6063838ULL, 0x1563c1c0ULL, 0x6c9e18a9ULL, 0xa85d7d9ULL},
+{0xeb9adf7eULL, 0x58b71929ULL, 0x765b2ee2ULL, 0xae32f59ULL, 0x789a548aULL, 0x58b71929ULL, 0x2d68290fULL, 0x1830d117ULL, 0x789a548aULL},
+{0x1cdade72ULL, 0xb5449a7bULL, 0xdd1cbd4cULL, 0x2829692eULL, 0xfaad7abdULL, 0xb5449a7bULL, 0x44301d2dULL, 0x66fa3df6ULL, 0xfaad7abdULL},
+{0xf31eaa42ULL, 0xa97e769cULL, 0x2aef95baULL, 0x177c616aULL, 0xfa405dc8ULL, 0xa97e769cULL, 0x5fd76a9cULL, 0xb3d7aa24ULL, 0xfa405dc8ULL},
+{0xf3229c22ULL, 0xf402271aULL, 0x449e6147ULL, 0x16b6c13bULL, 0xeb3c3d00ULL, 0xf402271aULL, 0x34d8a4e0ULL, 0x7248b38cULL, 0xeb3c3d00ULL},
+{0x76b4bf8eULL, 0xcb7bdab0ULL, 0xfc5e2e74ULL, 0x7e3281c6ULL, 0xabdb8650ULL, 0xcb7bdab0ULL, 0xd52e1811ULL, 0x3409e106ULL, 0xabdb8650ULL},
+{0xe212ab43ULL, 0xa95ac76fULL, 0x93fc93c4ULL, 0x31d1856cULL, 0x4dede05fULL, 0xa95ac76fULL, 0xd09e196dULL, 0x8ebc175eULL, 0x4dede05fULL},
+{0xfb93e839ULL, 0x87bba9d4ULL, 0x92fab275ULL, 0x5bfee35aULL, 0x6736544eULL, 0x87bba9d4ULL, 0x1a476862ULL, 0xb5caaac6ULL, 0x6736544eULL},
+{0x52cfb26dULL, 0x8f6f77b4ULL, 0x7f011299ULL, 0x9e0447c5ULL, 0x98865cf3ULL, 0x8f6f77b4ULL, 0x72eecac9ULL, 0xf700ac87ULL, 0x98865cf3ULL},
+{0x8c920c37ULL, 0xac29aabfULL, 0x6311e8bcULL, 0xb7977d6eULL, 0xd64708edULL, 0xac29aabfULL, 0xa5cc5ca0ULL, 0x74513855ULL, 0xd64708edULL},
+{0xd1b0a446ULL, 0x747baf52ULL, 0x5d290b7bULL, 0xf3258d61ULL, 0x3209e7b0ULL, 0x747baf52ULL, 0xc91893f4ULL, 0x1e40f500ULL, 0x3209e7b0ULL},
+{0x59b66217ULL, 0xcd15aeffULL, 0xccafd3eULL, 0xffa4871dULL, 0x9299b65bULL, 0xcd15aeffULL, 0xf20c834bULL, 0xfef383faULL, 0x9299b65bULL},
+{0xf82e281eULL, 0xe328979bULL, 0x4d08a2b5ULL, 0x60e81451ULL, 0x7c00851eULL, 0xe328979bULL, 0x17517f0aULL, 0x80b8714fULL, 0x7c00851eULL},
+{0xc34bee79ULL, 0xf2f4bcf1ULL, 0x1cb8ad53ULL, 0x7f8601aULL, 0x8c74c68dULL, 0xf2f4bcf1ULL, 0xff2891dULL, 0x5a4bfba5ULL, 0x8c74c68dULL},
+{0x9bcb6860ULL, 0x729f34e1ULL, 0xe670e7dfULL, 0xccfea20eULL, 0xabc0442bULL, 0x729f34e1ULL, 0x2b3bd513ULL, 0x4417c944ULL, 0xabc0442bULL},
+{0x2e40b4bbULL, 0xae6d1eefULL, 0x9d66cfc8ULL, 0xd6f29303ULL, 0x6df242daULL, 0xae6d1eefULL, 0x61aa9520ULL, 0xb36914c4ULL, 0x6df242daULL},
+{0x334fd35eULL, 0x3a7d895cULL, 0x38ed2b06ULL, 0x4cbde007ULL, 0xc0ad41f6ULL, 0x3a7d895cULL, 0x732d026eULL, 0x84598a76ULL, 0xc0ad41f6ULL},
+{0xf8e715bULL, 0xb51f5f43ULL, 0x3c9c7a7aULL, 0xdd1c0f71ULL, 0x6d54aefeULL, 0xb51f5f43ULL, 0xd84dcf79ULL, 0xba75ac6cULL, 0x6d54aefeULL},
+{0xc231250dULL, 0x7100668eULL, 0xf9acafb9ULL, 0xc753930ULL, 0x18ff556dULL, 0x7100668eULL, 0x9edda746ULL, 0xa49527adULL, 0x18ff556dULL},
+{0xb1e4831eULL, 0xff73bb96ULL, 0x98ef2aafULL, 0x8f587e2fULL, 0x94015ca4ULL, 0xff73bb96ULL, 0x2b20f91fULL, 0x88c2eb57ULL, 0x94015ca4ULL},
+{0xe6672d87ULL, 0xf8d4c96dULL, 0x5afe22f9ULL, 0x9195e3d2ULL, 0xd827f67cULL, 0xf8d4c96dULL, 0xe24659deULL, 0x30bd52ULL, 0xd827f67cULL},
+{0xc1d68681ULL, 0x538a80a9ULL, 0xd6b1de36ULL, 0xac3678f1ULL, 0x5b8ffe34ULL, 0x538a80a9ULL, 0x64059eb1ULL, 0xf2c4a40eULL, 0x5b8ffe34ULL},
+{0x53a24286ULL, 0x8a9c9632ULL, 0x78c2aad0ULL, 0xe59338bULL, 0xa8a14f67ULL, 0x8a9c9632ULL, 0xd3219c05ULL, 0xb19d156ULL, 0xa8a14f67ULL},
+{0x3a0335d0ULL, 0x7b1abc6ULL, 0xc225f62eULL, 0x8b6332eeULL, 0xc4dbb5d7ULL, 0x7b1abc6ULL, 0xbc53eb31ULL, 0xdac1db9eULL, 0xc4dbb5d7ULL},
+{0xc9fceac6ULL, 0xb5acdef0ULL, 0x58c19b3bULL, 0x2f47429dULL, 0xe4583d6dULL, 0xb5acdef0ULL, 0x670efffbULL, 0x84a2ee5aULL, 0xe4583d6dULL},
+{0x2013eefeULL, 0x5aecb92fULL, 0x451b14f3ULL, 0x6fa5d9a4ULL, 0xd34b3dfaULL, 0x5aecb92fULL, 0xfbae9e69ULL, 0x713c1dbcULL, 0xd34b3dfaULL},
+{0x614b5617ULL, 0xd9cf098aULL, 0xed20a166ULL, 0x8507664fULL, 0x55a6407aULL, 0xd9cf098aULL, 0x1bceea3cULL, 0xa37ea33ULL, 0x55a6407aULL},
+{0x5e6345ebULL, 0x80f4dce5ULL, 0xeb2a5a43ULL, 0x100e892dULL, 0x126c2685ULL, 0x80f4dce5ULL, 0xd929530eULL, 0x4eef5e53ULL, 0x126c2685ULL},
+{0x7d9e0f6eULL, 0x4110b47cULL, 0x5bb0df86ULL, 0x77bc30f7ULL, 0x6c50e723ULL, 0x4110b47cULL, 0x6e35c638ULL, 0xfd59bcb6ULL, 0x6c50e723ULL},
+{0x18956d0ULL, 0xc3cda1a4ULL, 0xafed7a33ULL, 0x9c95bd7dULL, 0x9abb4658ULL, 0xc3cda1a4ULL, 0x70e1c535ULL, 0xdc59f43eULL, 0x9abb4658ULL},
+{0x2b382d84ULL, 0xbe9af529ULL, 0xef00d1feULL, 0x38d09b1bULL, 0x50ee8373ULL, 0xbe9af529ULL, 0xd81bbd8aULL, 0x858156c5ULL, 0x50ee8373ULL},
+{0x337953a7ULL, 0x3c1109deULL, 0x3df7df1ULL, 0x85c4418eULL, 0xeac85235ULL, 0x3c1109deULL, 0xd628e51eULL, 0x83adaed7ULL, 0xeac85235ULL},
+{0x1ad88248ULL, 0x96e50e0cULL, 0x65c1793ULL, 0x50be6d8bULL, 0xd7bae2b0ULL, 0x96e50e0cULL, 0x76bee512ULL, 0x2a10184fULL, 0xd7bae2b0ULL},
+{0xf38a1baeULL, 0x3d70caa5ULL, 0x62219702ULL, 0xa425552bULL, 0x5699a692ULL, 0x3d70caa5ULL, 0x65373e97ULL, 0x1a9dc166ULL, 0x5699a692ULL},
+{0x88193c1dULL, 0x155399bcULL, 0x7c9ab7eULL, 0xda0da9f8ULL, 0xd313838fULL, 0x155399bcULL, 0xc422418cULL, 0xbefb4cc8ULL, 0xd313838fULL},
+{0xfc5247a8ULL, 0x8b70d2bfULL, 0x13a3aa7eULL, 0x1c64e09cULL, 0x2ac90d2eULL, 0x8b70d2bfULL, 0x4dea972cULL, 0x8db3d684ULL, 0x2ac90d2eULL},
+{0x2fc0112fULL, 0x945da458ULL, 0xd4040b9aULL, 0xcc7dacb5ULL, 0x91a36e21ULL, 0x945da458ULL, 0x6ed052cbULL, 0xca8f7d0ULL, 0x91a36e21ULL},
+{0x2fdd351fULL, 0x8e7d1db3ULL, 0xa23485ddULL, 0x6a7d56cfULL, 0x14122a5bULL, 0x8e7d1db3ULL, 0x83b24947ULL, 0x5615abafULL, 0x14122a5bULL},
+{0x7d27377fULL, 0xfe1d3e5dULL, 0xaf162447ULL, 0x7860c245ULL, 0x4237a144ULL, 0xfe1d3e5dULL, 0x236e5e4ULL, 0x60a93b3aULL, 0x4237a144ULL},
+{0x44285442ULL, 0xf9689890ULL, 0xd87b683bULL, 0x9495818dULL, 0xf39178c7ULL, 0xf9689890ULL, 0x6099f3c2ULL, 0xa16a0eaeULL, 0xf39178c7ULL},
+{0x35f6f6dfULL, 0xb9c062e9ULL, 0xce345723ULL, 0xcacb9bb1ULL, 0x846fea17ULL, 0xb9c062e9ULL, 0x5b14cd56ULL, 0x6d592f8ULL, 0x846fea17ULL},
+{0x614b647dULL, 0xe03329a7ULL, 0x179d9cd0ULL, 0x5ee7014bULL, 0xdaa597e3ULL, 0xe03329a7ULL, 0xbaa9de4ULL, 0xadbbdb5bULL, 0xdaa597e3ULL},
+{0x3069ad0dULL, 0xe8f996ecULL, 0x7f436bfeULL, 0xd4518ff8ULL, 0x752b57dcULL, 0xe8f996ecULL, 0x1c23a16eULL, 0xb55fa9a4ULL, 0x752b57dcULL},
+{0xe48dbb1fULL, 0x6928b9e4ULL, 0x6354b688ULL, 0x4de97234ULL, 0xea48e1ecULL, 0x6928b9e4ULL, 0x3ffc26bULL, 0xabad1003ULL, 0xea48e1ecULL},
+{0x47e649b1ULL, 0x250c5d87ULL, 0xe306f1e3ULL, 0x554a916aULL, 0xc84876eeULL, 0x250c5d87ULL, 0x7ea97f87ULL, 0x57b3efe4ULL, 0xc84876eeULL},
+{0xac8c69c6ULL, 0x698e27d6ULL, 0x60491b22ULL, 0x9c647c10ULL, 0xe7d5f622ULL, 0x698e27d6ULL, 0x42594284ULL, 0x490bf9a4ULL, 0xe7d5f622ULL},
+{0xdafa3e2aULL, 0x5e8cf5e6ULL, 0xe8ae483aULL, 0xb7a346d1ULL, 0xe185b441ULL, 0x5e8cf5e6ULL, 0x373c897ULL, 0xb74c4d75ULL, 0xe185b441ULL},
+{0x57deb31ULL, 0xc7ec2fafULL, 0x2a433070ULL, 0xc068250eULL, 0xdcf6d162ULL, 0xc7ec2fafULL, 0xd45b6667ULL, 0x549c413dULL, 0xdcf6d162ULL},
+{0x5136fa28ULL, 0xc08639faULL, 0xff0816d4ULL, 0xcc49c392ULL, 0xe56aba36ULL, 0xc08639faULL, 0x7dc140d5ULL, 0x918620f2ULL, 0xe56aba36ULL},
+{0xfdf0c1ebULL, 0x91ed3d4eULL, 0xa6603048ULL, 0x9d297cbfULL, 0x1d7187eULL, 0x91ed3d4eULL, 0xbf1401c7ULL, 0x142252b5ULL, 0x1d7187eULL},
+{0x7c515538ULL, 0x4b9f0012ULL, 0x7c6dfceaULL, 0xf9943086ULL, 0x2f8199a7ULL, 0x4b9f0012ULL, 0x120d96a3ULL, 0x5f03ecc1ULL, 0x2f8199a7ULL},
+{0xfa9d4c01ULL, 0x1b72cd76ULL, 0x4b1fea7dULL, 0x3226df0fULL, 0x9e87ce8eULL, 0x1b72cd76ULL, 0x55e74151ULL, 0xc0168c53ULL, 0x9e87ce8eULL},
+{0xecf6e881ULL, 0x1da1f04fULL, 0xfa41e01ULL, 0x2796793aULL, 0xd50fd6f9ULL, 0x1da1f04fULL, 0x6a21ef94ULL, 0xb084c851ULL, 0xd50fd6f9ULL},
+{0xca0d9c24ULL, 0xccc928a4ULL, 0xa5fbb1a8ULL, 0xce3ef48aULL, 0x8491d77eULL, 0xccc928a4ULL, 0x9d02b4e6ULL, 0xe03d5e7cULL, 0x8491d77eULL},
+{0xaf68ed4cULL, 0x6075714ULL, 0x97e77b9eULL, 0x856dcab5ULL, 0x44ed2a17ULL, 0x6075714ULL, 0xc232da3bULL, 0x21ed6ee3ULL, 0x44ed2a17ULL},
+{0xbec2ad4eULL, 0x56cbf7d0ULL, 0x1f7ed20eULL, 0xa0a6881ULL, 0xa02b6d6fULL, 0x56cbf7d0ULL, 0xd0fc6f62ULL, 0x966e271cULL, 0xa02b6d6fULL},
+{0x8c486d1eULL, 0x8bfe1b64ULL, 0xb906091fULL, 0xa66db237ULL, 0xb8ac14f5ULL, 0x8bfe1b64ULL, 0x85729890ULL, 0xf524f9bdULL, 0xb8ac14f5ULL},
+{0x2df775feULL, 0xd319cc97ULL, 0x9be34290ULL, 0x22b4686eULL, 0x42e1a6d1ULL, 0xd319cc97ULL, 0x98171f5fULL, 0xaf2b4143ULL, 0x42e1a6d1ULL},
+{0xeef309afULL, 0xf8f5b73ULL, 0xe9715f8cULL, 0x4c665684ULL, 0x3632e7c1ULL, 0xf8f5b73ULL, 0xf87fbeeaULL, 0x970a2d67ULL, 0x3632e7c1ULL},
+{0xd5b0298dULL, 0x5d159fa4ULL, 0xc5d30d60ULL, 0x9184b104ULL, 0xa69aadc8ULL, 0x5d159fa4ULL, 0x346cfefaULL, 0x4f68eaULL, 0xa69aadc8ULL},
+{0xdd9cae5ULL, 0x96adb937ULL, 0x5c51f13ULL, 0xeed495c6ULL, 0x766e5ddcULL, 0x96adb937ULL, 0xf4082a86ULL, 0xc0e6faadULL, 0x766e5ddcULL},
+{0xdc481534ULL, 0xf1800ef9ULL, 0x213d5654ULL, 0x4d77373dULL, 0xc23b7408ULL, 0xf1800ef9ULL, 0x613ff57fULL, 0xf8a0ec1aULL, 0xc23b7408ULL},
+{0x3933c8b0ULL, 0xcebc3b91ULL, 0x2d44df4eULL, 0x3625caddULL, 0x50bb985eULL, 0xcebc3b91ULL, 0xb496d7a0ULL, 0xea0f529bULL, 0x50bb985eULL},
+{0x4ef54a8eULL, 0x62894e95ULL, 0xad792494ULL, 0x91008182ULL, 0xe90e98f1ULL, 0x62894e95ULL, 0x95d6e680ULL, 0x4153cf97ULL, 0xe90e98f1ULL},
+{0x371ed98ULL, 0x63fa6f8aULL, 0xa890289cULL, 0x607b8160ULL, 0xde6fa762ULL, 0x63fa6f8aULL, 0x31ac82c2ULL, 0xabbaab12ULL, 0xde6fa762ULL},
+{0xc058875fULL, 0xe9b66db1ULL, 0x438ae78fULL, 0xebb97d7aULL, 0xe193c451ULL, 0xe9b66db1ULL, 0x8e135c6ULL, 0x2698c82fULL, 0xe193c451ULL},
+{0x84f9240eULL, 0xef1f3ad4ULL, 0x76ddc59fULL, 0x905006c1ULL, 0xe1d37892ULL, 0xef1f3ad4ULL, 0x8b9d233ULL, 0xfd540953ULL, 0xe1d37892ULL},
+{0xbd29ddd4ULL, 0xbebe426dULL, 0xaaba035ULL, 0xccbb9527ULL, 0xc89d08f7ULL, 0xbebe426dULL, 0x228d5bf6ULL, 0x27eda0c6ULL, 0xc89d08f7ULL},
+{0xe5e04864ULL, 0x1cc4ebb2ULL, 0x89942c38ULL, 0xd16de10cULL, 0xf2fd7f48ULL, 0x1cc4ebb2ULL, 0x91847beaULL, 0xd333b2caULL, 0xf2fd7f48ULL},
+{0xad8be3c6ULL, 0x936d3a9dULL, 0xccd1571eULL, 0x66cf77e1ULL, 0xf8cd822fULL, 0x936d3a9dULL, 0x84504a41ULL, 0xbe3e432aULL, 0xf8cd822fULL},
+{0xefc48201ULL, 0x7bf61bbcULL, 0xd4662f50ULL, 0xbde49ca7ULL, 0x2a782982ULL, 0x7bf61bbcULL, 0xf913e0f1ULL, 0xfd0046c6ULL, 0x2a782982ULL},
+{0x466fbeb4ULL, 0x5c530ad6ULL, 0x90542c55ULL, 0x31c2f544ULL, 0xcb701274ULL, 0x5c530ad6ULL, 0x51172ac1ULL, 0x4b17cf1aULL, 0xcb701274ULL},
+{0x3f22ebcaULL, 0x48099997ULL, 0xa14268deULL, 0x888acd0aULL, 0xd08d75e0ULL, 0x48099997ULL, 0xfafbd0afULL, 0x77eb031ULL, 0xd08d75e0ULL},
+{0xb7f548b4ULL, 0x45db0cf1ULL, 0xc8689eafULL, 0x7ecfe5f4ULL, 0x4889689cULL, 0x45db0cf1ULL, 0xa4ae447dULL, 0x93939c88ULL, 0x4889689cULL},
+{0x6b1bbf15ULL, 0x799800deULL, 0x60f859edULL, 0xb2fa2020ULL, 0xddca6e7eULL, 0x799800deULL, 0xeeb9a78bULL, 0x97abe43ULL, 0xddca6e7eULL},
+{0xfaa1121aULL, 0xb9a332bfULL, 0xf21fe8a1ULL, 0xea90b665ULL, 0x26211a88ULL, 0xb9a332bfULL, 0x6f31061fULL, 0x7c5ec93ULL, 0x26211a88ULL},
+{0x59ebeec2ULL, 0xfe4af02fULL, 0x5a496043ULL, 0xb5744e3eULL, 0xf55404efULL, 0xfe4af02fULL, 0xbba8d57eULL, 0x412970aeULL, 0xf55404efULL},
+{0xd3f76ee4ULL, 0xd59b8cULL, 0x40e4a962ULL, 0x476d1eb9ULL, 0x137f0e7dULL, 0xd59b8cULL, 0x84b5335dULL, 0x193de898ULL, 0x137f0e7dULL},
+{0xfc886e77ULL, 0xb3bbc8a1ULL, 0x7e29058aULL, 0x5358259eULL, 0x1be38b47ULL, 0xb3bbc8a1ULL, 0xbb83d5a8ULL, 0x93cdc5e1ULL, 0x1be38b47ULL},
+{0x59b9a568ULL, 0x6e41df4cULL, 0xf1a1c41fULL, 0x6466829eULL, 0xeec66b9fULL, 0x6e41df4cULL, 0x68662e79ULL, 0xfbffccfdULL, 0xeec66b9fULL},
+{0xa1711f50ULL, 0xff1aee1ULL, 0x9eb0da0dULL, 0xcae9e9ULL, 0x53825548ULL, 0xff1aee1ULL, 0x9b95de7aULL, 0x223c48eeULL, 0x53825548ULL},
+{0x6ffda1e2ULL, 0x2b8e6027ULL, 0xfd32d24dULL, 0xfb1ff327ULL, 0xbe001beaULL, 0x2b8e6027ULL, 0xbc1ea465ULL, 0xd1ab4952ULL, 0xbe001beaULL},
+{0xe78a743eULL, 0x26eefe5aULL, 0xece32372ULL, 0x387390b8ULL, 0xe38da43cULL, 0x26eefe5aULL, 0x8433c5dULL, 0xa5525e86ULL, 0xe38da43cULL},
+{0x8868891aULL, 0xe4dbe0aaULL, 0x33ef0a50ULL, 0xabc8c52aULL, 0x82554a8dULL, 0xe4dbe0aaULL, 0x4b3e9b19ULL, 0x45dbba87ULL, 0x82554a8dULL},
+{0xf8e8f9e4ULL, 0xeb626facULL, 0x3d14cf69ULL, 0x45a69609ULL, 0x79dbc5bdULL, 0xeb626facULL, 0x44705d6fULL, 0x1d5d7e40ULL, 0x79dbc5bdULL},
+{0x57b25163ULL, 0xdce02fbdULL, 0x2b077d5aULL, 0x5f44c6c2ULL, 0x566c0069ULL, 0xdce02fbdULL, 0x3dba9843ULL, 0x614315f9ULL, 0x566c0069ULL},
+{0xa9b5c480ULL, 0x419fefafULL, 0x8ac908fULL, 0xff7ce0e9ULL, 0x589dce2aULL, 0x419fefafULL, 0x8e41bf54ULL, 0x1805cda9ULL, 0x589dce2aULL},
+{0x8f9c1f5eULL, 0xaa3c3b52ULL, 0xfb8765e8ULL, 0x851421d7ULL, 0xc472fbd8ULL, 0xaa3c3b52ULL, 0xcd12d4c0ULL, 0x633a32eaULL, 0xc472fbd8ULL},
+{0xc78ffbaULL, 0xa4096425ULL, 0x6983ab64ULL, 0xfae44f25ULL, 0x248b2de5ULL, 0xa4096425ULL, 0x2c82f667ULL, 0x977e579bULL, 0x248b2de5ULL},
+{0x3c80ee9cULL, 0x5a1895ebULL, 0xcd874c78ULL, 0x7192e496ULL, 0x85686ca6ULL, 0x5a1895ebULL, 0x4819eb1aULL, 0x1c229dcfULL, 0x85686ca6ULL},
+{0xd300dc4dULL, 0x8d396f11ULL, 0xab69211eULL, 0x7a65cd36ULL, 0xff16b41cULL, 0x8d396f11ULL, 0xb2ccccfbULL, 0x1e9ab3caULL, 0xff16b41cULL},
+{0x6dde037cULL, 0x7b48b5c9ULL, 0xf2b0a1f0ULL, 0x93a40f6fULL, 0x23e5b9f9ULL, 0x7b48b5c9ULL, 0x912572bULL, 0x2a3765c9ULL, 0x23e5b9f9ULL},
+{0xfabfdde1ULL, 0x167e9346ULL, 0xdd812b85ULL, 0xc1fca0bbULL, 0xc2aae2f0ULL, 0x167e9346ULL, 0x3b0ba56aULL, 0xc6331456ULL, 0xc2aae2f0ULL},
+{0x45500bf6ULL, 0xd8e8c0d9ULL, 0x21e22522ULL, 0x827da7e6ULL, 0xd8ddd72bULL, 0xd8e8c0d9ULL, 0xe386ddc4ULL, 0xde2c54aULL, 0xd8ddd72bULL},
+{0xbe182ff6ULL, 0x3449cb35ULL, 0x10b879daULL, 0x6532a747ULL, 0x680c4c19ULL, 0x3449cb35ULL, 0xfbf64acfULL, 0x87315feULL, 0x680c4c19ULL},
+{0xed113b89ULL, 0xefdf4c5dULL, 0xa333ac8aULL, 0x2e8b373ULL, 0x5eeca77aULL, 0xefdf4c5dULL, 0x1c60c43ULL, 0xf4866e82ULL, 0x5eeca77aULL},
+{0xcee7fa91ULL, 0xc68c5099ULL, 0x6ec6d424ULL, 0xa3dbbbbcULL, 0xeb4798b0ULL, 0xc68c5099ULL, 0xbc3d8828ULL, 0x3662df53ULL, 0xeb4798b0ULL},
+{0xaf9a6d9dULL, 0xabf15a94ULL, 0x8f2b8df8ULL, 0x952052f1ULL, 0x8b7eb141ULL, 0xabf15a94ULL, 0x484b06a1ULL, 0x43c287aeULL, 0x8b7eb141ULL},
+{0xd8d279d4ULL, 0xb1941f11ULL, 0x13e849a9ULL, 0x35bc2283ULL, 0xb221a03bULL, 0xb1941f11ULL, 0x328e2421ULL, 0x8be5ef2fULL, 0xb221a03bULL},
+{0xa2431129ULL, 0x86c686e1ULL, 0xaa0d6590ULL, 0x2f1ba214ULL, 0x7094a0e9ULL, 0x86c686e1ULL, 0x9eb1f9f2ULL, 0x766962eaULL, 0x7094a0e9ULL},
+{0x52d7f4a4ULL, 0x77edf135ULL, 0x4745e7e1ULL, 0xdc256a24ULL, 0xa6849bc3ULL, 0x77edf135ULL, 0x9e94b5faULL, 0x464c7476ULL, 0xa6849bc3ULL},
+{0xf9b05ae0ULL, 0x9cace20cULL, 0xffc48a88ULL, 0x828d6167ULL, 0x9e027af3ULL, 0x9cace20cULL, 0xe994631fULL, 0xbccbce88ULL, 0x9e027af3ULL},
+{0x3af15276ULL, 0x58a16d58ULL, 0x5ee81814ULL, 0xa02451ffULL, 0x77ab882ULL, 0x58a16d58ULL, 0x43ef7743ULL, 0x8c3cc171ULL, 0x77ab882ULL},
+{0xf3a6c6afULL, 0x572bed39ULL, 0xe73244e8ULL, 0xc125630eULL, 0x43ebe4a4ULL, 0x572bed39ULL, 0xbcf9b127ULL, 0x7142634dULL, 0x43ebe4a4ULL},
+{0x8606c2ecULL, 0x6b50da64ULL, 0xbef75cfeULL, 0xb83dc95bULL, 0xde1140adULL, 0x6b50da64ULL, 0xcd9d858cULL, 0xf393fb2bULL, 0xde1140adULL},
+{0x3e725dc9ULL, 0xbf31b828ULL, 0x837053b3ULL, 0xb1e4f299ULL, 0x2e412581ULL, 0xbf31b828ULL, 0xcfe771d9ULL, 0xd8ffc3b4ULL, 0x2e412581ULL},
+{0x138ed4a9ULL, 0xc3806400ULL, 0x34575f3fULL, 0x2d3ed68ULL, 0x84e70b7aULL, 0xc3806400ULL, 0xf736e580ULL, 0xffdfb092ULL, 0x84e70b7aULL},
+{0x9e218b88ULL, 0x8512093fULL, 0xfa327e9fULL, 0xbe6bfcc8ULL, 0xb7c60bd1ULL, 0x8512093fULL, 0x540e895aULL, 0xbac096e2ULL, 0xb7c60bd1ULL},
+{0xc764d183ULL, 0x3db1737ULL, 0x74fcab78ULL, 0x25d10759ULL, 0x68c7eff4ULL, 0x3db1737ULL, 0xf831d234ULL, 0x9a194491ULL, 0x68c7eff4ULL},
+{0x52b310e1ULL, 0x662e934cULL, 0x2265c3cULL, 0xa478aab7ULL, 0x5a213becULL, 0x662e934cULL, 0x601c9d3fULL, 0x13e0f384ULL, 0x5a213becULL},
+{0x7dce8602ULL, 0xb17273fULL, 0xf2900fa4ULL, 0x8271d552ULL, 0x9f191ad5ULL, 0xb17273fULL, 0x9b374a45ULL, 0x769fa7fcULL, 0x9f191ad5ULL},
+{0x4235f503ULL, 0xea36dab5ULL, 0xeea24a25ULL, 0xa28d2024ULL, 0xd96d385dULL, 0xea36dab5ULL, 0x5041e0e1ULL, 0x5a3ce6e7ULL, 0xd96d385dULL},
+{0xf2437e36ULL, 0x3edee309ULL, 0xab3f68c4ULL, 0x961f900aULL, 0x99fbd6e0ULL, 0x3edee309ULL, 0x87bdfa76ULL, 0xafd84e55ULL, 0x99fbd6e0ULL},
+{0x95dd14fdULL, 0xfa76cbf8ULL, 0xcebd4981ULL, 0xa9440b83ULL, 0xdf024bc2ULL, 0xfa76cbf8ULL, 0xcbf08443ULL, 0x9569dd8fULL, 0xdf024bc2ULL},
+{0xe901e159ULL, 0x4ff6dedbULL, 0x9ecd6ddULL, 0xf7b7e39fULL, 0xe4b5b806ULL, 0x4ff6dedbULL, 0x6d0604d0ULL, 0x36b7668bULL, 0xe4b5b806ULL},
+{0xe06d56c0ULL, 0x5aefec88ULL, 0x84257a43ULL, 0xbac9fa88ULL, 0x81186fe0ULL, 0x5aefec88ULL, 0x63c147eaULL, 0x484a0651ULL, 0x81186fe0ULL},
+{0xc1acb4a8ULL, 0x9c0962d8ULL, 0x4272baf6ULL, 0xe13923ccULL, 0x6a0fb4ceULL, 0x9c0962d8ULL, 0x7ceb35d6ULL, 0x816b7480ULL, 0x6a0fb4ceULL},
+{0xd0356b5cULL, 0x8df40529ULL, 0x66f2903eULL, 0xdc3eca26ULL, 0xb62f0c56ULL, 0x8df40529ULL, 0x7d709af7ULL, 0x9ba498b6ULL, 0xb62f0c56ULL},
+{0xaf03586ULL, 0xa9ce6687ULL, 0x88e05635ULL, 0x85280645ULL, 0x8f13bb6aULL, 0xa9ce6687ULL, 0x7e468c37ULL, 0x23db4414ULL, 0x8f13bb6aULL},
+{0x9b76c9adULL, 0xce4ffbd1ULL, 0x20c412baULL, 0x6d6bcf69ULL, 0x66b47734ULL, 0xce4ffbd1ULL, 0xd31d62cbULL, 0xc4a9a1b9ULL, 0x66b47734ULL},
+{0x25f0459bULL, 0x118db6ULL, 0x9af492ecULL, 0xdb3b3716ULL, 0x4e534486ULL, 0x118db6ULL, 0xd9860d16ULL, 0xccbbd7b6ULL, 0x4e534486ULL},
+{0x7be07f0fULL, 0x5d06f408ULL, 0x489b6b91ULL, 0x13fdfa24ULL, 0x680f71ULL, 0x5d06f408ULL, 0xb00c601fULL, 0x5127124fULL, 0x680f71ULL},
+{0xc100688aULL, 0x2453620ULL, 0x60f96b21ULL, 0x7f416663ULL, 0xedb55bbULL, 0x2453620ULL, 0xfdd04439ULL, 0x43461883ULL, 0xedb55bbULL},
+{0x72741f69ULL, 0xcdbc3381ULL, 0xd145bedfULL, 0xc1ff951dULL, 0xb94abd76ULL, 0xcdbc3381ULL, 0x5e2080ULL, 0xd2b1591ULL, 0xb94abd76ULL},
+{0xf56b9c6cULL, 0x71c436ceULL, 0x3cd41b65ULL, 0xb295bec9ULL, 0xb7f821cbULL, 0x71c436ceULL, 0x43e9b3f0ULL, 0x40a7d19ULL, 0xb7f821cbULL},
+{0xecb2dc4dULL, 0xe7d1f117ULL, 0x8dca0cf4ULL, 0xaf1aa8b6ULL, 0xd02493feULL, 0xe7d1f117ULL, 0x7cfdca0fULL, 0xb1d3967aULL, 0xd02493feULL},
+{0xb5793979ULL, 0x4bd475c2ULL, 0x6d08983cULL, 0xe132d08cULL, 0xdb304ed3ULL, 0x4bd475c2ULL, 0xbc2232adULL, 0x381380d0ULL, 0xdb304ed3ULL},
+{0x1536d55eULL, 0xc796e9bdULL, 0xa2b05eb9ULL, 0x564b24b3ULL, 0x663e9946ULL, 0xc796e9bdULL, 0xb8ad0306ULL, 0xa009db97ULL, 0x663e9946ULL},
+{0xa0a2c872ULL, 0x11f83953ULL, 0x58b363d5ULL, 0xd497abdULL, 0x423e3801ULL, 0x11f83953ULL, 0xe16615ebULL, 0xbc5923abULL, 0x423e3801ULL},
+{0x3b49bab3ULL, 0x35c2a497ULL, 0xb6352388ULL, 0xab3ba5c5ULL, 0x1a00527ULL, 0x35c2a497ULL, 0x15f870baULL, 0x426209abULL, 0x1a00527ULL},
+{0x2a4c18a4ULL, 0x9e308e43ULL, 0x9bf8fe7ULL, 0x14585090ULL, 0x732cdebfULL, 0x9e308e43ULL, 0x1e60d49cULL, 0x113576b4ULL, 0x732cdebfULL},
+{0xca7a5afcULL, 0xa05bcea0ULL, 0x845599acULL, 0x6ab70f9dULL, 0xf1e48efULL, 0xa05bcea0ULL, 0x411a726fULL, 0x2fc4e8c1ULL, 0xf1e48efULL},
+{0x4e1dbe40ULL, 0x4c0c4addULL, 0xe7f258c5ULL, 0x9d64a8feULL, 0x54d91262ULL, 0x4c0c4addULL, 0xc02f4e3ULL, 0xb6bdd6b1ULL, 0x54d91262ULL},
+{0x1b244f5aULL, 0x11e67f81ULL, 0xcfc1bd5cULL, 0xac625c95ULL, 0x7c9012ddULL, 0x11e67f81ULL, 0x298a4bd7ULL, 0xb94165e0ULL, 0x7c9012ddULL},
+{0x8cc37324ULL, 0x97745105ULL, 0x83131db6ULL, 0xc8107332ULL, 0x31fc7584ULL, 0x97745105ULL, 0x36a11ebeULL, 0xdac92f8eULL, 0x31fc7584ULL},
+{0xa89e5ff6ULL, 0xcc59a4cfULL, 0x80361275ULL, 0x11ad7017ULL, 0xc0532306ULL, 0xcc59a4cfULL, 0x227aca92ULL, 0xd4b03938ULL, 0xc0532306ULL},
+{0xac036010ULL, 0x663326ceULL, 0x991b6e36ULL, 0xfc19fa73ULL, 0x8cadbcaeULL, 0x663326ceULL, 0xc3b504e6ULL, 0x6d9cbabaULL, 0x8cadbcaeULL},
+{0xd9c5a019ULL, 0x5e700b6ULL, 0x1ef8c2d9ULL, 0x739ef023ULL, 0x970d1b67ULL, 0x5e700b6ULL, 0xcba0e9fbULL, 0x7ee40584ULL, 0x970d1b67ULL},
+{0x18260da2ULL, 0xc7d3956ULL, 0xb9f92b21ULL, 0xeb788ca7ULL, 0x6d661df8ULL, 0xc7d3956ULL, 0x2f05390ULL, 0xa614a33aULL, 0x6d661df8ULL},
+{0x3da75fc6ULL, 0x98d57f50ULL, 0xa4285e2cULL, 0xf84c948fULL, 0x471d08a7ULL, 0x98d57f50ULL, 0x1bfdb1e5ULL, 0x17cd7e1cULL, 0x471d08a7ULL},
+{0x7d167677ULL, 0xe2ad383dULL, 0x9727cc77ULL, 0xcb5067c0ULL, 0xc90fd474ULL, 0xe2ad383dULL, 0x4c914e10ULL, 0xa84b62c4ULL, 0xc90fd474ULL},
+{0xcf81b84bULL, 0xba16fcdULL, 0xe9044939ULL, 0xc95d5911ULL, 0xc6905f78ULL, 0xba16fcdULL, 0xf093f0b6ULL, 0x58d2b235ULL, 0xc6905f78ULL},
+{0x7da94654ULL, 0x2c8a718bULL, 0x3025846ULL, 0x460fe836ULL, 0xe9e1b2ceULL, 0x2c8a718bULL, 0x78923837ULL, 0xa230a2c7ULL, 0xe9e1b2ceULL},
+{0x4a2aa31bULL, 0xda7a933eULL, 0x92216d91ULL, 0x22e99c7aULL, 0x78f53832ULL, 0xda7a933eULL, 0xf5342b2ULL, 0x78e77f37ULL, 0x78f53832ULL},
+{0x2985c76ULL, 0xd5bd35ceULL, 0x5c7ea3faULL, 0xf9a77145ULL, 0xd9518e71ULL, 0xd5bd35ceULL, 0x44aeee74ULL, 0xc16176a0ULL, 0xd9518e71ULL},
+{0xc7bd9278ULL, 0x2191cc0fULL, 0xcfc93431ULL, 0x56002a71ULL, 0x5524fd8ULL, 0x2191cc0fULL, 0x78ea86a0ULL, 0x1b16317aULL, 0x5524fd8ULL},
+{0x2e46cdcdULL, 0x7d1a7d0aULL, 0x23e6a0a7ULL, 0x3ec28159ULL, 0x3a50a7c4ULL, 0x7d1a7d0aULL, 0x4ad8621ULL, 0x6059e516ULL, 0x3a50a7c4ULL},
+{0x778791e2ULL, 0x94d47c9eULL, 0x853c6bcaULL, 0xfef084c5ULL, 0x3533fd5cULL, 0x94d47c9eULL, 0x3c65ef3dULL, 0x89b5bd09ULL, 0x3533fd5cULL},
+{0xd7176190ULL, 0xec27d2acULL, 0xecfb9009ULL, 0x135cbf52ULL, 0xea65816dULL, 0xec27d2acULL, 0x732cdbc5ULL, 0x5613d67cULL, 0xea65816dULL},
+{0x340a5cefULL, 0xc617d3b1ULL, 0x76c7208ULL, 0x1b2ebf0aULL, 0xea0f375cULL, 0xc617d3b1ULL, 0xc69082d9ULL, 0xdd622281ULL, 0xea0f375cULL},
+{0xd561983eULL, 0x90aadb50ULL, 0x48469bc6ULL, 0x42ae2c85ULL, 0xf1e9b623ULL, 0x90aadb50ULL, 0xdb2ccbcbULL, 0x4667daaaULL, 0xf1e9b623ULL},
+{0xd5b65be2ULL, 0x779448eULL, 0x3da7a26cULL, 0xf2f275e8ULL, 0xdd2462b7ULL, 0x779448eULL, 0x7bfa3fcbULL, 0x468c4811ULL, 0xdd2462b7ULL},
+{0x30f787d1ULL, 0xc73f6fd8ULL, 0x5fed295fULL, 0x7a4cfdaULL, 0x419b8378ULL, 0xc73f6fd8ULL, 0xdd7503e8ULL, 0xd8de36a0ULL, 0x419b8378ULL},
+{0xa9ec2665ULL, 0xdc1d5ee1ULL, 0x3628e11bULL, 0x58e51859ULL, 0xd8109e58ULL, 0xdc1d5ee1ULL, 0x4150572dULL, 0xff3d9f23ULL, 0xd8109e58ULL},
+{0xf5996262ULL, 0x7fcb0fe4ULL, 0x17216918ULL, 0xd718560bULL, 0x6832efd5ULL, 0x7fcb0fe4ULL, 0xdc69399aULL, 0x1b3ade3cULL, 0x6832efd5ULL},
+{0x1f959c84ULL, 0xc800c886ULL, 0x796d70a3ULL, 0x7907b542ULL, 0xe241f7f2ULL, 0xc800c886ULL, 0x77d2231ULL, 0x2d497d5eULL, 0xe241f7f2ULL},
+{0x4dba791fULL, 0xecffcc36ULL, 0xdd49f540ULL, 0xc53152deULL, 0x9cf44bb3ULL, 0xecffcc36ULL, 0xaf518545ULL, 0x8c379012ULL, 0x9cf44bb3ULL},
+{0xdc331ca6ULL, 0x8bd3603aULL, 0xa3034c7cULL, 0x72aecc59ULL, 0x4198e483ULL, 0x8bd3603aULL, 0x22df5281ULL, 0x96105204ULL, 0x4198e483ULL},
+{0xec8111b2ULL, 0x3f0db130ULL, 0x74325c05ULL, 0xdfc13c37ULL, 0xafef6832ULL, 0x3f0db130ULL, 0x83cafc6bULL, 0x666bb801ULL, 0xafef6832ULL},
+{0xb4243b6eULL, 0x69646cd4ULL, 0xa343bdc4ULL, 0x3f4d286cULL, 0x42b16acfULL, 0x69646cd4ULL, 0x7eef1d98ULL, 0x2eb3a2aaULL, 0x42b16acfULL},
+{0xaacee218ULL, 0x60e71ee9ULL, 0xfb4cd1b2ULL, 0x2f2096acULL, 0x4ad08b24ULL, 0x60e71ee9ULL, 0xda73c1a5ULL, 0x9b6319e4ULL, 0x4ad08b24ULL},
+{0x5efe74cfULL, 0x258133bbULL, 0xaf7f4082ULL, 0x2df95d79ULL, 0x47ce35a3ULL, 0x258133bbULL, 0x23abacb2ULL, 0x792d8cc9ULL, 0x47ce35a3ULL},
+{0x3c2a4c13ULL, 0x4ac64483ULL, 0xec424405ULL, 0x556a6a26ULL, 0xd18a48afULL, 0x4ac64483ULL, 0x36129f04ULL, 0xfb3d64caULL, 0xd18a48afULL},
+{0x32e87a9eULL, 0x6cc91dd1ULL, 0x64c6c00ULL, 0x2ad68325ULL, 0x542deb93ULL, 0x6cc91dd1ULL, 0x26b38d36ULL, 0xce740d9bULL, 0x542deb93ULL},
+{0xdd9b4df2ULL, 0x3a2ee4c0ULL, 0x6f0fd19aULL, 0xb319d395ULL, 0x333ae795ULL, 0x3a2ee4c0ULL, 0x5236922bULL, 0x9ffaa4a0ULL, 0x333ae795ULL},
+{0x6413ba33ULL, 0x7d3cb9ffULL, 0x92863aa8ULL, 0x27295393ULL, 0x6cba54cdULL, 0x7d3cb9ffULL, 0x77c6f7f1ULL, 0x8f3e43a9ULL, 0x6cba54cdULL},
+{0x4059a6ebULL, 0x9c76198fULL, 0xc643b79eULL, 0xd1fb32c2ULL, 0x19c8eabULL, 0x9c76198fULL, 0x9eb623edULL, 0xc2b5e472ULL, 0x19c8eabULL},
+{0x2d416d07ULL, 0x90c13becULL, 0x34817b62ULL, 0x14afea57ULL, 0x7c0eabf2ULL, 0x90c13becULL, 0x81b1517ULL, 0x59a6aa1bULL, 0x7c0eabf2ULL},
+{0xb97741c2ULL, 0x23c9eebaULL, 0x3afc9b0cULL, 0x8341578aULL, 0x5f2f77b3ULL, 0x23c9eebaULL, 0x3935e7f4ULL, 0x19702fULL, 0x5f2f77b3ULL},
+{0xf0145a3eULL, 0xe56a1de5ULL, 0xa50496c6ULL, 0xacb00d1bULL, 0x6f646334ULL, 0xe56a1de5ULL, 0xb111d6c1ULL, 0x9a731e92ULL, 0x6f646334ULL},
+{0x13a6a0dULL, 0x96833670ULL, 0xe62c6e61ULL, 0xe193b3bdULL, 0x8d3d33a5ULL, 0x96833670ULL, 0xd7e96e4cULL, 0x3ff1c192ULL, 0x8d3d33a5ULL},
+{0x79a6dcfaULL, 0x12420ee6ULL, 0x1adde4d3ULL, 0x71efcedbULL, 0xdc7f0905ULL, 0x12420ee6ULL, 0x7f29a552ULL, 0x6ebb394bULL, 0xdc7f0905ULL},
+{0x1ae9cc94ULL, 0x6072b479ULL, 0x8e466bdbULL, 0x20b2edbcULL, 0xa1f85a00ULL, 0x6072b479ULL, 0x4def96ULL, 0x482cf367ULL, 0xa1f85a00ULL},
+{0xef79367aULL, 0x94963d3cULL, 0x3db6040bULL, 0xa9d0b4fULL, 0xf7eebf87ULL, 0x94963d3cULL, 0x48afd0afULL, 0x6e5ee285ULL, 0xf7eebf87ULL},
+{0x42e42787ULL, 0x878c2116ULL, 0x70e8db4fULL, 0xe049e7f1ULL, 0x9de52248ULL, 0x878c2116ULL, 0x227af89eULL, 0x30f5598cULL, 0x9de52248ULL},
+{0xb3ad8448ULL, 0xb759e3f3ULL, 0xac2f6929ULL, 0x97b4a699ULL, 0x74295d72ULL, 0xb759e3f3ULL, 0x1e366e98ULL, 0x358f8c7fULL, 0x74295d72ULL}},
+  {{0x476ff35fULL, 0x77aed0b9ULL, 0x3b0741ULL, 0xc6c93a4dULL, 0x7c23390bULL, 0x77aed0b9ULL, 0x8b8a2bf7ULL, 0x34f0c1c7ULL, 0x7c23390bULL},
+{0xcf0fe50bULL, 0xbe571edaULL, 0x21af55abULL, 0x124d5f43ULL, 0x2e9f976dULL, 0xbe571edaULL, 0x9fda4eaULL, 0x81f060acULL, 0x2e9f976dULL},
+{0xeb35d7bbULL, 0x37ef03f1ULL, 0x99f96353ULL, 0x358e7122ULL, 0x71ce60d7ULL, 0x37ef03f1ULL, 0x5a7107d7ULL, 0x974e1e9bULL, 0x71ce60d7ULL},
+{0xe3303b1fULL, 0xc4e7e636ULL, 0xa4e6b792ULL, 0x36289a4dULL, 0x9edec765ULL, 0xc4e7e636ULL, 0x9502e201ULL, 0xc5a8e773ULL, 0x9edec765ULL},
+{0xa8945d57ULL, 0x11abb055ULL, 0xcab1d7c5ULL, 0xdc5eff3cULL, 0xe7877d6cULL, 0x11abb055ULL, 0xacfa853eULL, 0x65a5a85cULL, 0xe7877d6cULL},
+{0xeb979bceULL, 0x5729b9eULL, 0x57c7788aULL, 0x8b098efbULL, 0xe34e14fcULL, 0x5729b9eULL, 0xaf5fef5bULL, 0xc3f8836fULL, 0xe34e14fcULL},
+{0x4f8a416cULL, 0x33556538ULL, 0xa7eee9c1ULL, 0x19fb3e93ULL, 0xc8152155ULL, 0x33556538ULL, 0x5ecb42e7ULL, 0x79b4539bULL, 0xc8152155ULL},
+{0xffa3d4f8ULL, 0xb4c90d5dULL, 0x59bfa8f4ULL, 0x5b4adefeULL, 0x267e305dULL, 0xb4c90d5dULL, 0xaf65e3d5ULL, 0x83733588ULL, 0x267e305dULL},
+{0xfc310357ULL, 0xcdff7820ULL, 0x5284683fULL, 0xb385018bULL, 0xfb65761fULL, 0xcdff7820ULL, 0xd8bee657ULL, 0xab905463ULL, 0xfb65761fULL},
+{0x9ea7ebceULL, 0xac3763abULL, 0x5f6ad827ULL, 0x26361ea6ULL, 0xb0562bbeULL, 0xac3763abULL, 0xe46593f6ULL, 0xc6f24e12ULL, 0xb0562bbeULL},
+{0xfe92d9bbULL, 0x7051a4b8ULL, 0xdd2eb47cULL, 0xe8dd0f9fULL, 0xa0e21868ULL, 0x7051a4b8ULL, 0x7e78ca48ULL, 0xbdca19f6ULL, 0xa0e21868ULL},
+{0x8ea2d5d5ULL, 0x5c4ec18fULL, 0x161471d3ULL, 0x24ea5f93ULL, 0x9498db4bULL, 0x5c4ec18fULL, 0x5735d05eULL, 0x71eeb829ULL, 0x9498db4bULL},
+{0xf8f331f7ULL, 0xd212962bULL, 0x5aa20c8ULL, 0xdc2fa46cULL, 0x444120c9ULL, 0xd212962bULL, 0xb9b67b77ULL, 0x33e3d4adULL, 0x444120c9ULL},
+{0xace005a9ULL, 0xf6a933d9ULL, 0x6dc6550cULL, 0xb023d7f1ULL, 0x6b38d9a3ULL, 0xf6a933d9ULL, 0xddb82b27ULL, 0x35839e56ULL, 0x6b38d9a3ULL},
+{0x639f6613ULL, 0x3d1857aULL, 0x360854dbULL, 0xfce4fa8bULL, 0x7e8825fdULL, 0x3d1857aULL, 0x593daca3ULL, 0x7f4c486bULL, 0x7e8825fdULL},
+{0xecfff183ULL, 0xd9a41e42ULL, 0x627e1615ULL, 0x64c18bfbULL, 0x4d2ffda8ULL, 0xd9a41e42ULL, 0xc7a44ffULL, 0xb81687e7ULL, 0x4d2ffda8ULL},
+{0xb468763cULL, 0x1abeaea0ULL, 0x70377d2bULL, 0xb4f7094ULL, 0x632d49d7ULL, 0x1abeaea0ULL, 0x8e84e235ULL, 0xf8998efeULL, 0x632d49d7ULL},
+{0x85507e98ULL, 0x45b1f19ULL, 0x1e249a29ULL, 0x31cceb4ULL, 0x7772bae6ULL, 0x45b1f19ULL, 0x22a8a505ULL, 0x7e41287aULL, 0x7772bae6ULL},
+{0xc6549d6dULL, 0xdb1c4083ULL, 0x3e25fdd3ULL, 0xd206d285ULL, 0xfbe20b18ULL, 0xdb1c4083ULL, 0xffec8489ULL, 0xc7329125ULL, 0xfbe20b18ULL},
+{0x2a938fdbULL, 0x6d67d823ULL, 0x67e37327ULL, 0xebaa181aULL, 0x1c95c1c8ULL, 0x6d67d823ULL, 0x9292537aULL, 0x5c34361ULL, 0x1c95c1c8ULL},
+{0x2a7504ddULL, 0xc71e23daULL, 0x44d72363ULL, 0xf2ae51ecULL, 0xb8ecaa3aULL, 0xc71e23daULL, 0xc5727674ULL, 0xa62478e2ULL, 0xb8ecaa3aULL},
+{0xa281d943ULL, 0x34491c74ULL, 0x1f058c8fULL, 0x416ece35ULL, 0x40a1b1ebULL, 0x34491c74ULL, 0x6dcb8f10ULL, 0x45fdf0f1ULL, 0x40a1b1ebULL},
+{0xf237624eULL, 0x6fe4fa50ULL, 0xbd962501ULL, 0x4ad15c55ULL, 0x6dd4e0f7ULL, 0x6fe4fa50ULL, 0xc469b1c8ULL, 0xd6d2c5b4ULL, 0x6dd4e0f7ULL},
+{0xc57ca96bULL, 0x18215d55ULL, 0xf588bea9ULL, 0x4c756068ULL, 0x697cccceULL, 0x18215d55ULL, 0x808e8005ULL, 0x7f3a0760ULL, 0x697cccceULL},
+{0x8de71f2fULL, 0xb3f0c634ULL, 0x931ef1d7ULL, 0xf34607f9ULL, 0x497324c4ULL, 0xb3f0c634ULL, 0x337bf7b1ULL, 0x18b75da0ULL, 0x497324c4ULL},
+{0x3c11b472ULL, 0x5436f456ULL, 0x88360c8eULL, 0x1a60cfc8ULL, 0xb5e95c43ULL, 0x5436f456ULL, 0x9207684ULL, 0xc4b656eeULL, 0xb5e95c43ULL},
+{0x26610748ULL, 0xdb6a747cULL, 0x60623b3aULL, 0xcab59869ULL, 0x7d61cc7eULL, 0xdb6a747cULL, 0x9248e76aULL, 0x9e46f360ULL, 0x7d61cc7eULL},
+{0x98692f6bULL, 0x2db1f4faULL, 0x151b963dULL, 0xb2244469ULL, 0xd952d747ULL, 0x2db1f4faULL, 0xc140b0d7ULL, 0xbe4aa58ULL, 0xd952d747ULL},
+{0x98def01eULL, 0x3edea60ULL, 0xe0f75dd2ULL, 0xdca7ceb0ULL, 0xfcf84e4cULL, 0x3edea60ULL, 0x17aca9a4ULL, 0x7c9061d8ULL, 0xfcf84e4cULL},
+{0xc52637e4ULL, 0x4f7caee4ULL, 0x493b4125ULL, 0xcfc1c52aULL, 0x72acd385ULL, 0x4f7caee4ULL, 0xf8f7003fULL, 0x2dde7029ULL, 0x72acd385ULL},
+{0x6efc6ae9ULL, 0x49a3967cULL, 0x3a9b4022ULL, 0xddd97e8eULL, 0x85852cdULL, 0x49a3967cULL, 0x21c65f28ULL, 0xb7eecbeULL, 0x85852cdULL},
+{0xbd0a9dacULL, 0x888fe2beULL, 0x7cccc007ULL, 0xb2aefb6aULL, 0xf403a5e4ULL, 0x888fe2beULL, 0xc20d8870ULL, 0x3325f210ULL, 0xf403a5e4ULL},
+{0x3fdb2c54ULL, 0x671db848ULL, 0xeb99bd64ULL, 0x1f263043ULL, 0x86791e4bULL, 0x671db848ULL, 0xfbf52120ULL, 0x4c3a4ef1ULL, 0x86791e4bULL},
+{0xacec50a5ULL, 0x676a2321ULL, 0x2ba12d5fULL, 0x25195c3dULL, 0x2fd8d4f3ULL, 0x676a2321ULL, 0xa5499af7ULL, 0xf25c03ebULL, 0x2fd8d4f3ULL},
+{0xca0af48ULL, 0xe9a14d35ULL, 0xfdd0f60dULL, 0xada8d043ULL, 0x385db77bULL, 0xe9a14d35ULL, 0x63c5033bULL, 0x6f637613ULL, 0x385db77bULL},
+{0x3b2b8b6cULL, 0xc89f8236ULL, 0x8d35b36ULL, 0x1e166082ULL, 0xb62f3358ULL, 0xc89f8236ULL, 0x7b2ff745ULL, 0x3b463cd5ULL, 0xb62f3358ULL},
+{0x470d0186ULL, 0x6182a8e5ULL, 0xb5bcef69ULL, 0xacc701dcULL, 0xa8f4f8f7ULL, 0x6182a8e5ULL, 0xb8fe0a81ULL, 0x441bd268ULL, 0xa8f4f8f7ULL},
+{0x3970e4deULL, 0x6ca5844fULL, 0x4df4a152ULL, 0xf4266021ULL, 0x4f05d48ULL, 0x6ca5844fULL, 0x8b6dce3eULL, 0x2862edd6ULL, 0x4f05d48ULL},
+{0xe3a2d301ULL, 0xe24a959dULL, 0x7baa5f3ULL, 0xae3851caULL, 0x76e1744eULL, 0xe24a959dULL, 0x7d2f5314ULL, 0x1446e30eULL, 0x76e1744eULL},
+{0x9f39fb86ULL, 0xf20141c9ULL, 0x8fc4bcd7ULL, 0x989debc2ULL, 0x315a778fULL, 0xf20141c9ULL, 0x19bc7061ULL, 0x4ccbe52fULL, 0x315a778fULL},
+{0x8094fe35ULL, 0x1897a9dbULL, 0x610e1e0fULL, 0x6fa309b3ULL, 0x1d4147d9ULL, 0x1897a9dbULL, 0xef3482eULL, 0x3bfd73d9ULL, 0x1d4147d9ULL},
+{0x142220aULL, 0x91dd0fbULL, 0x26275fbdULL, 0x78cc805aULL, 0x30ecd069ULL, 0x91dd0fbULL, 0xfe1e5f40ULL, 0xa8704d1dULL, 0x30ecd069ULL},
+{0x2ff4f958ULL, 0xa04392a7ULL, 0x2196c1efULL, 0x1ba341d3ULL, 0x31dea76bULL, 0xa04392a7ULL, 0xcc32f03ULL, 0xdaa14d93ULL, 0x31dea76bULL},
+{0x2ff979f3ULL, 0x801e181bULL, 0x28a5c8b4ULL, 0xe0057e88ULL, 0x285e1e6fULL, 0x801e181bULL, 0xb18e4f4fULL, 0x6f1180afULL, 0x285e1e6fULL},
+{0x45e9dd26ULL, 0xfd8501b5ULL, 0x64aa6c3cULL, 0x1b073421ULL, 0xabae5299ULL, 0xfd8501b5ULL, 0x4a598f6fULL, 0x90932b69ULL, 0xabae5299ULL},
+{0x32d04209ULL, 0x5d28dc87ULL, 0x7bfed82eULL, 0xe69ee575ULL, 0x8bb81c8bULL, 0x5d28dc87ULL, 0x37fdb4f4ULL, 0x5960a26bULL, 0x8bb81c8bULL},
+{0x463e6517ULL, 0x6063d553ULL, 0x924ed402ULL, 0x80d97d40ULL, 0xca1318b6ULL, 0x6063d553ULL, 0xf980b36dULL, 0x26e2e365ULL, 0xca1318b6ULL},
+{0xcbcf3faaULL, 0x97da7ceeULL, 0xbdf51672ULL, 0xc6cf50a6ULL, 0xab6a5310ULL, 0x97da7ceeULL, 0x46f9bda6ULL, 0xce2c13bULL, 0xab6a5310ULL},
+{0x20abbb02ULL, 0x1d490123ULL, 0x3951fbe5ULL, 0x2236b9e0ULL, 0xd8e0c5fdULL, 0x1d490123ULL, 0x98a05980ULL, 0xf82b1966ULL, 0xd8e0c5fdULL},
+{0xcdc442ebULL, 0x928dc01aULL, 0x956233fbULL, 0x1a4205ccULL, 0x79335346ULL, 0x928dc01aULL, 0x1c003c56ULL, 0x380a578fULL, 0x79335346ULL},
+{0x2c79a369ULL, 0x3fd859edULL, 0xf722c446ULL, 0x7647750ULL, 0x39e5e8f5ULL, 0x3fd859edULL, 0x7948ac68ULL, 0xe44ff649ULL, 0x39e5e8f5ULL},
+{0xc0da35a9ULL, 0x5ff993f8ULL, 0xd4e2e851ULL, 0xd4ddaa08ULL, 0x28dda885ULL, 0x5ff993f8ULL, 0x6e138978ULL, 0xd1512135ULL, 0x28dda885ULL},
+{0x7aaa209aULL, 0x16a9f93fULL, 0x2d9221eULL, 0x172d4cd4ULL, 0x46e767a2ULL, 0x16a9f93fULL, 0x5c981759ULL, 0x90ebb3bcULL, 0x46e767a2ULL},
+{0x15f22dd7ULL, 0x4ab47230ULL, 0x502825bULL, 0x6d65da6eULL, 0x7f922ee6ULL, 0x4ab47230ULL, 0xad5867d8ULL, 0x643bcb11ULL, 0x7f922ee6ULL},
+{0x2f54b292ULL, 0x40a1aa71ULL, 0x77ee561aULL, 0xbe712c5dULL, 0xa55ad98ULL, 0x40a1aa71ULL, 0x110f4beeULL, 0x256c356fULL, 0xa55ad98ULL},
+{0x92cb0c46ULL, 0xe1d76df2ULL, 0xb0c6faafULL, 0xf473302aULL, 0x65258a81ULL, 0xe1d76df2ULL, 0xa249b6dULL, 0x1674f498ULL, 0x65258a81ULL},
+{0x99447ba4ULL, 0x21beafd8ULL, 0x582e166dULL, 0x1969133eULL, 0x4d5ce7fcULL, 0x21beafd8ULL, 0x272a855dULL, 0x4547ac74ULL, 0x4d5ce7fcULL},
+{0x198a8e12ULL, 0x731d129fULL, 0x57be1727ULL, 0x95f08967ULL, 0x2aeae073ULL, 0x731d129fULL, 0x1cd225beULL, 0xb7e7cc5cULL, 0x2aeae073ULL},
+{0x7b5786c8ULL, 0x3908e6c1ULL, 0x3c0859b3ULL, 0x50bcae42ULL, 0x66662ea3ULL, 0x3908e6c1ULL, 0x37e7fc88ULL, 0xd48c4d20ULL, 0x66662ea3ULL},
+{0x39f0c633ULL, 0x7f71fb6cULL, 0xcf178e92ULL, 0xf549a62eULL, 0xd064e991ULL, 0x7f71fb6cULL, 0xd84b5a08ULL, 0x67a9608bULL, 0xd064e991ULL},
+{0x457c135bULL, 0xd3cb39fULL, 0xccbd0466ULL, 0xd03acb8cULL, 0x4e775f81ULL, 0xd3cb39fULL, 0x4b0f2557ULL, 0x6820fdd0ULL, 0x4e775f81ULL},
+{0x4e832b69ULL, 0xf64f3c72ULL, 0x6cf7248eULL, 0xc5a63a94ULL, 0xb03c0fa5ULL, 0xf64f3c72ULL, 0xd0efbf28ULL, 0x7d0a861eULL, 0xb03c0fa5ULL},
+{0x3ba64cc7ULL, 0x595a661cULL, 0xaca689cfULL, 0xe5f568c7ULL, 0x54c8fe80ULL, 0x595a661cULL, 0x7bec1b3ULL, 0x590652c3ULL, 0x54c8fe80ULL},
+{0xf527a629ULL, 0xb2cb4b17ULL, 0xee1f85f2ULL, 0x4f82d14eULL, 0xeee1c81fULL, 0xb2cb4b17ULL, 0xc60fc387ULL, 0xfefeaeeaULL, 0xeee1c81fULL},
+{0x6c786d10ULL, 0xe1a0e69cULL, 0x35f869b1ULL, 0xe9a42570ULL, 0x99ddffbdULL, 0xe1a0e69cULL, 0x994afb9fULL, 0x357f3126ULL, 0x99ddffbdULL},
+{0xf8fa92ecULL, 0x84cf1342ULL, 0x6398b2caULL, 0x4691ebcbULL, 0x884f3b2ULL, 0x84cf1342ULL, 0xaeef009eULL, 0x2a198b5fULL, 0x884f3b2ULL},
+{0x781fa7adULL, 0x1b02606fULL, 0xca8c837aULL, 0xa6ac6662ULL, 0x3c98465fULL, 0x1b02606fULL, 0x202b1148ULL, 0x634c6f6bULL, 0x3c98465fULL},
+{0x4ed48215ULL, 0xb7161e5fULL, 0x3e592cddULL, 0xa3e480acULL, 0xb7481de0ULL, 0xb7161e5fULL, 0x812080deULL, 0xcb026476ULL, 0xb7481de0ULL},
+{0xafb5fb04ULL, 0x8200644cULL, 0x399a9bedULL, 0xb53fe4adULL, 0xd030d233ULL, 0x8200644cULL, 0x52203e39ULL, 0x9a2e1579ULL, 0xd030d233ULL},
+{0xfa3b8b3aULL, 0x6c728768ULL, 0xc5a99dc4ULL, 0x295ec135ULL, 0x5cb2acbeULL, 0x6c728768ULL, 0x4d55d4bdULL, 0x5c7b72f1ULL, 0x5cb2acbeULL},
+{0x8ae8b565ULL, 0xe888f436ULL, 0xa5e87ae1ULL, 0x7f1a6d30ULL, 0xc44e003fULL, 0xe888f436ULL, 0x7e825b9fULL, 0x111bfc08ULL, 0xc44e003fULL},
+{0x1810078ULL, 0xf4459783ULL, 0xee0ee3aULL, 0xc1608a60ULL, 0x9d1a1d67ULL, 0xf4459783ULL, 0xef858e05ULL, 0x73a61f82ULL, 0x9d1a1d67ULL},
+{0xe1635461ULL, 0x35ca18feULL, 0x787164c3ULL, 0x7858a9d0ULL, 0x949b012aULL, 0x35ca18feULL, 0xdda4d575ULL, 0xb79eb129ULL, 0x949b012aULL},
+{0xf3e240c9ULL, 0x9fd55991ULL, 0x8d8714c7ULL, 0x250abc4bULL, 0x8fad82b4ULL, 0x9fd55991ULL, 0x96a957b6ULL, 0x409e392bULL, 0x8fad82b4ULL},
+{0x59277fc4ULL, 0x67516416ULL, 0xc641a509ULL, 0x75aad504ULL, 0xb6f9eb5bULL, 0x67516416ULL, 0xc661c0c1ULL, 0x45bdf2bdULL, 0xb6f9eb5bULL},
+{0xa5fb948bULL, 0xed428c71ULL, 0x412e64c0ULL, 0x2963e4f9ULL, 0x1f8c247ULL, 0xed428c71ULL, 0xed770373ULL, 0x89e34a26ULL, 0x1f8c247ULL},
+{0xf0461a4eULL, 0x436dc380ULL, 0x28705038ULL, 0x588a535eULL, 0xbb5344f1ULL, 0x436dc380ULL, 0x6a14d3cbULL, 0x5e33e1dcULL, 0xbb5344f1ULL},
+{0x67b53af4ULL, 0xb6ae3796ULL, 0x90549b5ULL, 0x6d4da2e0ULL, 0x449307b2ULL, 0xb6ae3796ULL, 0xd7778e1bULL, 0x540ab88dULL, 0x449307b2ULL},
+{0xe02bbfcfULL, 0xdfaf6c92ULL, 0xa2afbaf0ULL, 0x406f6763ULL, 0x7d6cf77eULL, 0xdfaf6c92ULL, 0xbf7ce0d9ULL, 0x1f78b4f2ULL, 0x7d6cf77eULL},
+{0x52c8f60dULL, 0xe74a6e18ULL, 0x873e70dULL, 0xf32e7706ULL, 0x7a36d121ULL, 0xe74a6e18ULL, 0xdddf7b73ULL, 0xb7315a50ULL, 0x7a36d121ULL},
+{0xaeeccd98ULL, 0x5d3ef6a2ULL, 0x9120d605ULL, 0x5db27aa0ULL, 0x73fa99b8ULL, 0x5d3ef6a2ULL, 0xcd1b42caULL, 0x2bb71393ULL, 0x73fa99b8ULL},
+{0x6b4d4848ULL, 0xd575d09aULL, 0x27c63eacULL, 0x37b257f6ULL, 0xdda9f9f0ULL, 0xd575d09aULL, 0x7afe8e77ULL, 0xedcda207ULL, 0xdda9f9f0ULL},
+{0x9853b56eULL, 0xb1b54e62ULL, 0x65d98909ULL, 0x6219ded3ULL, 0xbb83e789ULL, 0xb1b54e62ULL, 0xad4e352eULL, 0x6fe13972ULL, 0xbb83e789ULL},
+{0x4719c9e5ULL, 0xe430e59aULL, 0x82a12269ULL, 0xd142f61cULL, 0xc937940fULL, 0xe430e59aULL, 0x7328c04cULL, 0x89753e0bULL, 0xc937940fULL},
+{0xaa555417ULL, 0xd3cff11bULL, 0x7b19f913ULL, 0x354207fdULL, 0x49818790ULL, 0xd3cff11bULL, 0x5b666062ULL, 0xb17aca8fULL, 0x49818790ULL},
+{0xa3077e4eULL, 0xfffcda35ULL, 0x711846d6ULL, 0x417f052fULL, 0x957793abULL, 0xfffcda35ULL, 0xe6256d96ULL, 0xe95e2213ULL, 0x957793abULL},
+{0xf0a0b08bULL, 0x90c9feaeULL, 0x4b72509aULL, 0xdc9c6e0bULL, 0x4fbcd359ULL, 0x90c9feaeULL, 0xa78f004aULL, 0xc29121c3ULL, 0x4fbcd359ULL},
+{0x60d8cdfULL, 0xeead2801ULL, 0x889cf01cULL, 0x4ae863cfULL, 0x105a2454ULL, 0xeead2801ULL, 0x34ecdb5eULL, 0x9d046af2ULL, 0x105a2454ULL},
+{0x872ce5f9ULL, 0xb89bb509ULL, 0x967dc81eULL, 0x72fbc20ULL, 0x95259c11ULL, 0xb89bb509ULL, 0x2b62c8bULL, 0xf8d74409ULL, 0x95259c11ULL},
+{0xbfe7ecf5ULL, 0x885173a5ULL, 0x3428ed2dULL, 0x93a7be56ULL, 0x786bbf0cULL, 0x885173a5ULL, 0x1c9bdc2dULL, 0xef338046ULL, 0x786bbf0cULL},
+{0xc39456e5ULL, 0xb42b3184ULL, 0x1181c83aULL, 0x17746f6dULL, 0xc9bf810fULL, 0xb42b3184ULL, 0x836108eeULL, 0x65cfb056ULL, 0xc9bf810fULL},
+{0x34604722ULL, 0x50cd4492ULL, 0x26b3b84ULL, 0xa4af29e3ULL, 0x43c2ef40ULL, 0x50cd4492ULL, 0x2cc42fdcULL, 0x9f50c952ULL, 0x43c2ef40ULL},
+{0x173a0cULL, 0x37b5b0a9ULL, 0xdc8ec368ULL, 0x814b316aULL, 0x2c703907ULL, 0x37b5b0a9ULL, 0x825b33ecULL, 0x2789fc48ULL, 0x2c703907ULL},
+{0xfd863751ULL, 0x8db6bbf8ULL, 0x7c03c7c5ULL, 0xd71820d0ULL, 0xca5e212ULL, 0x8db6bbf8ULL, 0xa4295835ULL, 0x824b644ULL, 0xca5e212ULL},
+{0x14c53382ULL, 0x77ea5100ULL, 0xfd395f5dULL, 0xf0a3fa86ULL, 0xb0505796ULL, 0x77ea5100ULL, 0x792d80bfULL, 0xb3722c3eULL, 0xb0505796ULL},
+{0x55c9a054ULL, 0x9d9130bbULL, 0x673defc1ULL, 0x70b7288aULL, 0x7e6dc930ULL, 0x9d9130bbULL, 0x958bd0ffULL, 0x4f9e6c69ULL, 0x7e6dc930ULL},
+{0xa55db7a7ULL, 0xa5f99e92ULL, 0xb13a83e5ULL, 0xb0d07495ULL, 0xe4d73954ULL, 0xa5f99e92ULL, 0x782a69b4ULL, 0xfd196b0aULL, 0xe4d73954ULL},
+{0x32df3b42ULL, 0x1f5a2f4ULL, 0x8304f471ULL, 0xf749be99ULL, 0x8df164c6ULL, 0x1f5a2f4ULL, 0x640af042ULL, 0x7b4cb541ULL, 0x8df164c6ULL},
+{0x2eab9ff4ULL, 0x59a92d3bULL, 0x64c64e8cULL, 0x28e7a1f8ULL, 0xc5314f8cULL, 0x59a92d3bULL, 0x7dc5cf9cULL, 0xc9d5fd2eULL, 0xc5314f8cULL},
+{0xea1c0efaULL, 0xd56ba98fULL, 0x3277b90ULL, 0xd9f9499aULL, 0xb74b93a8ULL, 0xd56ba98fULL, 0x130c614dULL, 0x208da93fULL, 0xb74b93a8ULL},
+{0x29ade95aULL, 0xa4c1cf9dULL, 0x88d7cc61ULL, 0x25711cefULL, 0xd015da27ULL, 0xa4c1cf9dULL, 0xc4443a9dULL, 0x76de5982ULL, 0xd015da27ULL},
+{0x8d11b5b6ULL, 0x23c9079fULL, 0xb0984a71ULL, 0x8663843cULL, 0x730fea01ULL, 0x23c9079fULL, 0x64274b67ULL, 0xada9a6b9ULL, 0x730fea01ULL},
+{0x8e426132ULL, 0x73d15b30ULL, 0x8cf4c285ULL, 0x3ef749cdULL, 0x6915e807ULL, 0x73d15b30ULL, 0xdff806efULL, 0x7f513163ULL, 0x6915e807ULL},
+{0x8b352830ULL, 0xc58699eeULL, 0x1bcf5396ULL, 0xbf4a4d88ULL, 0xad46e712ULL, 0xc58699eeULL, 0x528c30a6ULL, 0x37e39d96ULL, 0xad46e712ULL},
+{0x2b536ba7ULL, 0xfa9b6b9aULL, 0x5ea60326ULL, 0x1ae14981ULL, 0xb32062e3ULL, 0xfa9b6b9aULL, 0xbc88eb9eULL, 0x6451ea95ULL, 0xb32062e3ULL},
+{0xd6292096ULL, 0xb25cad9cULL, 0x374ec6d7ULL, 0x9f564585ULL, 0x65c239e0ULL, 0xb25cad9cULL, 0x29ea02a8ULL, 0x4543018dULL, 0x65c239e0ULL},
+{0xd99a044fULL, 0xcf480c6fULL, 0x18510f3bULL, 0x7b38f1e7ULL, 0x86efce8dULL, 0xcf480c6fULL, 0x14c286dfULL, 0x9c8b55d0ULL, 0x86efce8dULL},
+{0x21909ac1ULL, 0xf371e109ULL, 0x7dcc2ee2ULL, 0xce30071aULL, 0xf00e2b8bULL, 0xf371e109ULL, 0xfa2412c0ULL, 0x435ca10eULL, 0xf00e2b8bULL},
+{0xa1869e1bULL, 0x98a009deULL, 0x393dc4f4ULL, 0x3401ce62ULL, 0x6a5d256aULL, 0x98a009deULL, 0x6eea18daULL, 0x67419c9dULL, 0x6a5d256aULL},
+{0xaaaba659ULL, 0x3283a866ULL, 0xb8c197e6ULL, 0x54b5ef5eULL, 0x438e24bULL, 0x3283a866ULL, 0xfa13c2f9ULL, 0xc4f112e2ULL, 0x438e24bULL},
+{0xe0be6a37ULL, 0x2d67074cULL, 0x7ad4870cULL, 0x4c66ada0ULL, 0x311c3c8dULL, 0x2d67074cULL, 0xac98ef56ULL, 0xe96b5ca1ULL, 0x311c3c8dULL},
+{0x21a7e0baULL, 0xd3e7e3bfULL, 0x8dd15b80ULL, 0x4b13c85cULL, 0x8279be97ULL, 0xd3e7e3bfULL, 0x1ae9521aULL, 0xaad0462fULL, 0x8279be97ULL},
+{0x9f1517c1ULL, 0xdacbabfaULL, 0x5255e10aULL, 0x49d2d5d3ULL, 0x20c62079ULL, 0xdacbabfaULL, 0xd5ec9ca6ULL, 0x770e44b9ULL, 0x20c62079ULL},
+{0x6aba5463ULL, 0x4e7b24a5ULL, 0xa258aa56ULL, 0x4eaa6e38ULL, 0x5e83a461ULL, 0x4e7b24a5ULL, 0xee1d9469ULL, 0xf52ae4d6ULL, 0x5e83a461ULL},
+{0xc6875693ULL, 0x9653452ULL, 0xfb91b1ddULL, 0x245eee20ULL, 0x817b2166ULL, 0x9653452ULL, 0xdedb9585ULL, 0x3db99510ULL, 0x817b2166ULL},
+{0xe8c3a984ULL, 0x6a3e4948ULL, 0xb2288cc1ULL, 0x77e41b5ULL, 0x20d3079cULL, 0x6a3e4948ULL, 0x65142441ULL, 0xe1bd89acULL, 0x20d3079cULL},
+{0x8aec1a0dULL, 0x4a33ba8aULL, 0xd84c2a67ULL, 0xfe0b3e75ULL, 0x75a2d57fULL, 0x4a33ba8aULL, 0x13aded1ULL, 0x39a8cb2cULL, 0x75a2d57fULL},
+{0x39d7f74ULL, 0x2dc56879ULL, 0x50a8ffc4ULL, 0xd88f9c4cULL, 0x3a36d142ULL, 0x2dc56879ULL, 0x21429fcfULL, 0xc7d7bd1fULL, 0x3a36d142ULL},
+{0x9f64f7beULL, 0xc3a624eeULL, 0xba9c787eULL, 0xc0afd93bULL, 0x6346822aULL, 0xc3a624eeULL, 0xecff2c8dULL, 0x4ee06c77ULL, 0x6346822aULL},
+{0xc16614f5ULL, 0xa300031ULL, 0x791613f6ULL, 0x345aaa93ULL, 0x7d53c8a9ULL, 0xa300031ULL, 0x21baf1e1ULL, 0x946638eeULL, 0x7d53c8a9ULL},
+{0xf63605b9ULL, 0x76da8fc8ULL, 0xf7a63c25ULL, 0xabc2c2edULL, 0xa924a409ULL, 0x76da8fc8ULL, 0x4711e441ULL, 0x47535009ULL, 0xa924a409ULL},
+{0x4d40e5d4ULL, 0x94bedb28ULL, 0xdcc9200aULL, 0x86c97528ULL, 0x681efc49ULL, 0x94bedb28ULL, 0xd2d27028ULL, 0xce21c3f4ULL, 0x681efc49ULL},
+{0x5d1baf65ULL, 0x82ecade1ULL, 0x3348dde5ULL, 0x5bbadeaaULL, 0x69c92aadULL, 0x82ecade1ULL, 0x45f386d6ULL, 0xcdefede6ULL, 0x69c92aadULL},
+{0x263a7237ULL, 0x645992c3ULL, 0x89dd64cfULL, 0x534435bULL, 0x5ef3be1fULL, 0x645992c3ULL, 0x45d5e831ULL, 0xde9a63eeULL, 0x5ef3be1fULL},
+{0x9670fd2eULL, 0x4fd34498ULL, 0x7eed531eULL, 0xe9fdc071ULL, 0xeb45c209ULL, 0x4fd34498ULL, 0xdb13d2c0ULL, 0xa976cd3eULL, 0xeb45c209ULL},
+{0xb14a6c7cULL, 0x839050c4ULL, 0x466943bcULL, 0x5a247676ULL, 0x8fdf24eaULL, 0x839050c4ULL, 0xf92e19e5ULL, 0x62a14fe7ULL, 0x8fdf24eaULL},
+{0x79fd37f8ULL, 0x272af6e8ULL, 0x6544f589ULL, 0x60ee6761ULL, 0x9173f245ULL, 0x272af6e8ULL, 0x25fb79e7ULL, 0x326ca28cULL, 0x9173f245ULL},
+{0x372e60ebULL, 0x7dbf1a04ULL, 0x700e3bf0ULL, 0x656bd86aULL, 0x58cb0d7eULL, 0x7dbf1a04ULL, 0xa21cf88cULL, 0x9734665ULL, 0x58cb0d7eULL},
+{0x9efb197dULL, 0xa8ac858fULL, 0x1fd673c0ULL, 0xf8e50d64ULL, 0x4d5248bbULL, 0xa8ac858fULL, 0x8140ec99ULL, 0x472498d3ULL, 0x4d5248bbULL},
+{0xe063fbfULL, 0x4b64ff48ULL, 0x778f913aULL, 0x1b219502ULL, 0x3f836cf7ULL, 0x4b64ff48ULL, 0x9c62c310ULL, 0x410f221aULL, 0x3f836cf7ULL},
+{0xe0ca6f20ULL, 0x52746037ULL, 0x1ea5220dULL, 0xfe06dd2dULL, 0x8f51a66fULL, 0x52746037ULL, 0x55fdb42ULL, 0xa579020eULL, 0x8f51a66fULL},
+{0xb86ce7ecULL, 0x12c6ae0aULL, 0x21a438a3ULL, 0x8d690e5cULL, 0x14253620ULL, 0x12c6ae0aULL, 0xded4f8f9ULL, 0xe37b4dd4ULL, 0x14253620ULL},
+{0xd671518dULL, 0x73753c47ULL, 0x84e5dd80ULL, 0xc11c0e34ULL, 0xd18ab111ULL, 0x73753c47ULL, 0x79bd3acbULL, 0xfdf7ebaULL, 0xd18ab111ULL},
+{0x10848198ULL, 0xf63d3b16ULL, 0x4a926e9ULL, 0xd7501bdfULL, 0xb8480c55ULL, 0xf63d3b16ULL, 0x8e117897ULL, 0xf05e14b7ULL, 0xb8480c55ULL},
+{0xef01ce56ULL, 0xd05330b5ULL, 0xa6ab904eULL, 0x2b4d4a6bULL, 0x40884affULL, 0xd05330b5ULL, 0x58056936ULL, 0xa7a38c65ULL, 0x40884affULL},
+{0xec7d785fULL, 0x14e24e3eULL, 0x36ab5096ULL, 0xc3f7c133ULL, 0xa1b4a5b0ULL, 0x14e24e3eULL, 0x4e736856ULL, 0x3b120ae1ULL, 0xa1b4a5b0ULL},
+{0x30f6b7fcULL, 0x4401e9ddULL, 0x23be77d5ULL, 0xbfe316aULL, 0x255ee59fULL, 0x4401e9ddULL, 0xb15a110aULL, 0xfc018bd8ULL, 0x255ee59fULL},
+{0x5ddcfcb2ULL, 0x9fb468cULL, 0x9c1a3811ULL, 0x40b2625eULL, 0x8063a32aULL, 0x9fb468cULL, 0x616bd9b5ULL, 0x6a9aafd4ULL, 0x8063a32aULL},
+{0xc8f5b977ULL, 0xf9144571ULL, 0xa37847e0ULL, 0x4ba7a462ULL, 0x939783ddULL, 0xf9144571ULL, 0x8901fd5dULL, 0x5e938e51ULL, 0x939783ddULL},
+{0x6662babbULL, 0x3d0be7daULL, 0xbf02a855ULL, 0x431f08ULL, 0xa20e57f2ULL, 0x3d0be7daULL, 0x6d734b6fULL, 0xcc0f0b1dULL, 0xa20e57f2ULL},
+{0xe8968590ULL, 0xac5c9b82ULL, 0x6c08bf10ULL, 0xe8e7e059ULL, 0x91d06d83ULL, 0xac5c9b82ULL, 0x7a148f92ULL, 0xa2bda327ULL, 0x91d06d83ULL},
+{0x3a585ad8ULL, 0x8c286369ULL, 0x11ed45faULL, 0x58d9bb9bULL, 0x624cb560ULL, 0x8c286369ULL, 0x7871d30dULL, 0x30dbdc77ULL, 0x624cb560ULL},
+{0x1f82cbb9ULL, 0x8d828afdULL, 0x8a959c3bULL, 0x20d11ce4ULL, 0xb26017aaULL, 0x8d828afdULL, 0x4937f513ULL, 0x8aa73a75ULL, 0xb26017aaULL},
+{0x1710a117ULL, 0x9e91140bULL, 0x8d847b6ULL, 0x34c8dab5ULL, 0x61f4d8dULL, 0x9e91140bULL, 0x10645892ULL, 0x695ba73cULL, 0x61f4d8dULL},
+{0x6e531e71ULL, 0xbeb7f37eULL, 0x2cf10054ULL, 0xc1c2f80aULL, 0x4367f043ULL, 0xbeb7f37eULL, 0x2c74e63cULL, 0x208a7eeULL, 0x4367f043ULL},
+{0xb7e48154ULL, 0x263453b1ULL, 0xa4d17b53ULL, 0xe87b2b4bULL, 0xa7dc45dfULL, 0x263453b1ULL, 0x3c0b509aULL, 0x81b0ebd0ULL, 0xa7dc45dfULL},
+{0xafab20c2ULL, 0xa29e8648ULL, 0xc931f665ULL, 0xbd93a359ULL, 0x6468c6aaULL, 0xa29e8648ULL, 0x193d7d88ULL, 0xdc9b7267ULL, 0x6468c6aaULL},
+{0x6795d05cULL, 0xec48c048ULL, 0x1d82f61dULL, 0xa06c4193ULL, 0x800f9174ULL, 0xec48c048ULL, 0x1ac4f21eULL, 0x1b82afafULL, 0x800f9174ULL},
+{0x20725dbcULL, 0xd5d7a112ULL, 0x81c30a5aULL, 0x481b0930ULL, 0x10361c0eULL, 0xd5d7a112ULL, 0x7229b5ddULL, 0xe03bc9c0ULL, 0x10361c0eULL},
+{0xd54238bULL, 0x41fa49e4ULL, 0x92654888ULL, 0xb76dccdaULL, 0x7ce56e43ULL, 0x41fa49e4ULL, 0xd4c0f88eULL, 0xe20a1574ULL, 0x7ce56e43ULL},
+{0xe5ed08a1ULL, 0x92c4f1c8ULL, 0xe73d114aULL, 0x2bb7c1a9ULL, 0x7acb8f25ULL, 0x92c4f1c8ULL, 0x5193250bULL, 0x5fe46032ULL, 0x7acb8f25ULL},
+{0x329a65aaULL, 0x79360acfULL, 0xb52e2119ULL, 0x49b8fcf3ULL, 0x1d9bf9c9ULL, 0x79360acfULL, 0xc892049fULL, 0x9925006fULL, 0x1d9bf9c9ULL},
+{0xd32c0289ULL, 0xbc8bf3d3ULL, 0x4a85f8a9ULL, 0x9a6bf19fULL, 0x7178a1b5ULL, 0xbc8bf3d3ULL, 0x484f5272ULL, 0x1158182bULL, 0x7178a1b5ULL},
+{0x4d458590ULL, 0xc64e5e50ULL, 0xb004eddbULL, 0x7efc507bULL, 0x2a5d8f1fULL, 0xc64e5e50ULL, 0xec65a7fULL, 0x5db21117ULL, 0x2a5d8f1fULL},
+{0x47999b2cULL, 0x64fc24ffULL, 0x4338df06ULL, 0xbba2c449ULL, 0x81cb3f15ULL, 0x64fc24ffULL, 0x25f8f006ULL, 0x5bf03c77ULL, 0x81cb3f15ULL},
+{0xc61c3d15ULL, 0x9cd13c98ULL, 0xd3588915ULL, 0x801b8fa7ULL, 0xf10bf7b2ULL, 0x9cd13c98ULL, 0x30d17daeULL, 0x5008ef93ULL, 0xf10bf7b2ULL},
+{0x62b739bULL, 0xd13d9a2aULL, 0xb2b9b9d8ULL, 0x18453899ULL, 0x78705dfbULL, 0xd13d9a2aULL, 0x7f57a19aULL, 0xf71460dbULL, 0x78705dfbULL},
+{0xc17cb692ULL, 0xefc06e88ULL, 0xa7670061ULL, 0x6d5d59f4ULL, 0x6aad2c3dULL, 0xefc06e88ULL, 0xd9308258ULL, 0x4dfadfc3ULL, 0x6aad2c3dULL},
+{0xc5dbff9aULL, 0x1d63fe09ULL, 0xa795f7f3ULL, 0x690b874fULL, 0x5309edcbULL, 0x1d63fe09ULL, 0xbc85a462ULL, 0x3e68b470ULL, 0x5309edcbULL},
+{0x78f6d54aULL, 0x42675864ULL, 0x6543493eULL, 0x133a267eULL, 0xbbb4dd1fULL, 0x42675864ULL, 0xb8948739ULL, 0xe6758767ULL, 0xbbb4dd1fULL},
+{0x30e9b23bULL, 0xfa45a0f4ULL, 0x96cd980ULL, 0x4b1eb317ULL, 0x70d38d7ULL, 0xfa45a0f4ULL, 0xa7ce914ULL, 0x3001ea86ULL, 0x70d38d7ULL},
+{0xe321de34ULL, 0xe0732e83ULL, 0xcece9a48ULL, 0x74951675ULL, 0x4c4fcd1ULL, 0xe0732e83ULL, 0x158ae7ecULL, 0xda80f960ULL, 0x4c4fcd1ULL},
+{0x36a039d5ULL, 0x34b443eaULL, 0xa9bcd693ULL, 0xc07d4a80ULL, 0xb3cd84abULL, 0x34b443eaULL, 0xdaa63d92ULL, 0xaec9958bULL, 0xb3cd84abULL},
+{0xe07aece1ULL, 0xb6e182fcULL, 0x4c307c34ULL, 0x5102de4bULL, 0x1cfbd600ULL, 0xb6e182fcULL, 0x4a81c011ULL, 0xca050f4aULL, 0x1cfbd600ULL},
+{0xc585efe4ULL, 0x74e3a955ULL, 0xe021f7f7ULL, 0xbfbef278ULL, 0xd5b64044ULL, 0x74e3a955ULL, 0x84e8cd56ULL, 0xc7014b9dULL, 0xd5b64044ULL},
+{0xb2c6c9c2ULL, 0x9e373092ULL, 0x60f5d08dULL, 0x1437f940ULL, 0xd1d6aa95ULL, 0x9e373092ULL, 0xd107812ULL, 0x25a47b56ULL, 0xd1d6aa95ULL},
+{0x7813d6caULL, 0x8ea71b17ULL, 0xff07d8a7ULL, 0xcd72a4cdULL, 0xd8aa47b7ULL, 0x8ea71b17ULL, 0x11e846f0ULL, 0x40355e1ULL, 0xd8aa47b7ULL},
+{0x7fef31dbULL, 0x854e13cdULL, 0x36fa28adULL, 0x68145e5cULL, 0xce6ef828ULL, 0x854e13cdULL, 0x931a7613ULL, 0x4a899ea4ULL, 0xce6ef828ULL},
+{0xcef2f747ULL, 0x17f38ffaULL, 0x31eca735ULL, 0x3aecb3eULL, 0x30bba15eULL, 0x17f38ffaULL, 0x1bbdd364ULL, 0x454ed47dULL, 0x30bba15eULL},
+{0x810229c8ULL, 0xb84d3f9fULL, 0xe14c2839ULL, 0xf0a736efULL, 0xd9a79c32ULL, 0xb84d3f9fULL, 0x99e89885ULL, 0x8a5b4641ULL, 0xd9a79c32ULL},
+{0xaa26cc56ULL, 0x42f870ecULL, 0xecef1c09ULL, 0x213e5d0cULL, 0x846e309ULL, 0x42f870ecULL, 0xc7aea286ULL, 0x7661fb39ULL, 0x846e309ULL},
+{0x77830dd6ULL, 0x4e44921cULL, 0x29e30f05ULL, 0xf4d382bbULL, 0x7cbf8b49ULL, 0x4e44921cULL, 0x7ced675ULL, 0xd552e92dULL, 0x7cbf8b49ULL},
+{0x66a2018aULL, 0x684bf0f9ULL, 0x1732e3fcULL, 0x99708f13ULL, 0x37a967c3ULL, 0x684bf0f9ULL, 0x48e8d6feULL, 0x6e893e56ULL, 0x37a967c3ULL},
+{0xa67d1b86ULL, 0xa3cde9b3ULL, 0x138bc6c8ULL, 0xa4310263ULL, 0x312fa964ULL, 0xa3cde9b3ULL, 0xf6ba21c6ULL, 0x690bdb07ULL, 0x312fa964ULL},
+{0xc9d3365ULL, 0xbfa2db34ULL, 0x28ebed31ULL, 0x292fc36dULL, 0x41e62febULL, 0xbfa2db34ULL, 0x39ecd0d2ULL, 0x5be7037fULL, 0x41e62febULL},
+{0x35738508ULL, 0xf5f50cd7ULL, 0x1ec39adcULL, 0x8582c9dULL, 0x815e3ea7ULL, 0xf5f50cd7ULL, 0x7b6d5cbcULL, 0x3e0e2b07ULL, 0x815e3ea7ULL},
+{0x84de38b1ULL, 0xde297019ULL, 0x9bc5b393ULL, 0xcbdc0db3ULL, 0x8c1ba0efULL, 0xde297019ULL, 0x29597faaULL, 0x5bee35c6ULL, 0x8c1ba0efULL},
+{0x638e696ULL, 0xe680ccd1ULL, 0xeec7ea90ULL, 0x2a86f98bULL, 0x7647d88aULL, 0xe680ccd1ULL, 0x2d2daabaULL, 0xa2cf40a2ULL, 0x7647d88aULL},
+{0x46a9779aULL, 0x6d6b6463ULL, 0xf8a192d6ULL, 0x6dd14a50ULL, 0xe0a733ccULL, 0x6d6b6463ULL, 0xaedb958eULL, 0x83d831d2ULL, 0xe0a733ccULL},
+{0xc5119396ULL, 0x667c27faULL, 0x5ac27f9eULL, 0x55e3b2ccULL, 0x72e7a52aULL, 0x667c27faULL, 0xa50aebcfULL, 0x5020836eULL, 0x72e7a52aULL},
+{0x2fc86e82ULL, 0x5f4c49d6ULL, 0x3aa90880ULL, 0x5d60da94ULL, 0xf7f15774ULL, 0x5f4c49d6ULL, 0x25f60aa8ULL, 0x509f71aULL, 0xf7f15774ULL},
+{0xde3939fcULL, 0xa020062bULL, 0x8badfc8bULL, 0xab916447ULL, 0x3d818803ULL, 0xa020062bULL, 0xd0616dcaULL, 0x121a807fULL, 0x3d818803ULL},
+{0x3c3bd9b6ULL, 0xdafe3b55ULL, 0x70fcc1f5ULL, 0xafc724abULL, 0xcefa4e29ULL, 0xdafe3b55ULL, 0x5f3149edULL, 0xb3f9fc90ULL, 0xcefa4e29ULL},
+{0xb7f7a858ULL, 0xc812c83bULL, 0x725b0986ULL, 0x793539c6ULL, 0x3491a2c6ULL, 0xc812c83bULL, 0x5ecc3a1aULL, 0xa869f71fULL, 0x3491a2c6ULL},
+{0x2ea62833ULL, 0xa15a0861ULL, 0xced0cb12ULL, 0x5b369d5aULL, 0x3aaae4b6ULL, 0xa15a0861ULL, 0x4c6b35eeULL, 0xdbc726beULL, 0x3aaae4b6ULL},
+{0xf17402eeULL, 0xa9f7797cULL, 0x8b000dd1ULL, 0x5798e5bfULL, 0x36da1b40ULL, 0xa9f7797cULL, 0x6099c973ULL, 0xa46b4f19ULL, 0x36da1b40ULL},
+{0x255e137eULL, 0xdba65382ULL, 0x73f4344eULL, 0xc740dfe0ULL, 0xbcae3a26ULL, 0xdba65382ULL, 0xebd83905ULL, 0xdca495e1ULL, 0xbcae3a26ULL},
+{0x3a72bb46ULL, 0x8f27affULL, 0xab30e3acULL, 0x354790beULL, 0xe96c6798ULL, 0x8f27affULL, 0x16c88a09ULL, 0x45ceead1ULL, 0xe96c6798ULL},
+{0x4ef37cedULL, 0xdf9f2d8ULL, 0xaa0d15a4ULL, 0xbccbb38ULL, 0x6d969da6ULL, 0xdf9f2d8ULL, 0x2ba3747aULL, 0xba94e16cULL, 0x6d969da6ULL},
+{0x635feee8ULL, 0x13a6a645ULL, 0x790607f8ULL, 0xb7356e69ULL, 0x72b68f3cULL, 0x13a6a645ULL, 0x33e9840fULL, 0xcb70b382ULL, 0x72b68f3cULL},
+{0x23cdd426ULL, 0xb32395e5ULL, 0xd8dca4fcULL, 0xaf17be82ULL, 0x59a324faULL, 0xb32395e5ULL, 0x88e8d953ULL, 0x514fe00aULL, 0x59a324faULL},
+{0x3af2ead8ULL, 0xfbd43256ULL, 0xa1445257ULL, 0xe168b5caULL, 0xbf5e2543ULL, 0xfbd43256ULL, 0x773f7291ULL, 0xe0567e09ULL, 0xbf5e2543ULL},
+{0x963071cbULL, 0xc2055cc0ULL, 0xdcde6cbdULL, 0x8ed6239ULL, 0xdd256dfcULL, 0xc2055cc0ULL, 0xd26deba1ULL, 0x66456f9eULL, 0xdd256dfcULL},
+{0x75c6d419ULL, 0xf325c44fULL, 0x92e694a5ULL, 0x36ed1323ULL, 0xc39db8fULL, 0xf325c44fULL, 0x8a65685eULL, 0x95085cf0ULL, 0xc39db8fULL},
+{0xcab458abULL, 0x5075272eULL, 0xb7143173ULL, 0x52edf256ULL, 0xb4f265acULL, 0x5075272eULL, 0x381d045eULL, 0x27748fc6ULL, 0xb4f265acULL},
+{0x27627b5aULL, 0x569ca0b9ULL, 0x571700c2ULL, 0x94588272ULL, 0xb8741fa4ULL, 0x569ca0b9ULL, 0x72f3aca4ULL, 0x3f028b24ULL, 0xb8741fa4ULL},
+{0xa0f24741ULL, 0x83e66d52ULL, 0xb5d4c258ULL, 0xf487266dULL, 0x3f4cbd65ULL, 0x83e66d52ULL, 0xb5fcafbcULL, 0x3bbfa66bULL, 0x3f4cbd65ULL},
+{0xadbbbc9fULL, 0x9b9c9fe7ULL, 0xb32fa9d2ULL, 0x1f894ae6ULL, 0xfb8474d5ULL, 0x9b9c9fe7ULL, 0xf260a84fULL, 0x69583a64ULL, 0xfb8474d5ULL},
+{0x7ce37827ULL, 0xc3a90dd8ULL, 0x3298a493ULL, 0x6059e0beULL, 0x5ca4de19ULL, 0xc3a90dd8ULL, 0xedde0f19ULL, 0x40509670ULL, 0x5ca4de19ULL},
+{0x41960298ULL, 0xa8205b59ULL, 0xdac710beULL, 0xd1e9818fULL, 0xc73c489bULL, 0xa8205b59ULL, 0x7254892fULL, 0x39481e7cULL, 0xc73c489bULL},
+{0x10644218ULL, 0xaf6f3d23ULL, 0x78e25bb3ULL, 0x4084bcbULL, 0x1e885e04ULL, 0xaf6f3d23ULL, 0x462def37ULL, 0xf8e42403ULL, 0x1e885e04ULL},
+{0xa0fd6325ULL, 0x119c089aULL, 0xc83eb945ULL, 0xc7fe60eaULL, 0xe81a4813ULL, 0x119c089aULL, 0x5785cf18ULL, 0x7fa5d37ULL, 0xe81a4813ULL},
+{0xd05b27bULL, 0xf356d444ULL, 0x679bb8aULL, 0xa417f814ULL, 0x98d5c8b2ULL, 0xf356d444ULL, 0x9a950cc7ULL, 0xc5f2c5d8ULL, 0x98d5c8b2ULL},
+{0xb18b791cULL, 0x5451ad97ULL, 0x3251ce2eULL, 0xb0040d72ULL, 0x7233c465ULL, 0x5451ad97ULL, 0x71d5a761ULL, 0xb1055e21ULL, 0x7233c465ULL},
+{0x36078ea7ULL, 0xb560d695ULL, 0x5c88c51eULL, 0xaa9dca98ULL, 0xfddeb03bULL, 0xb560d695ULL, 0xfb4efbdfULL, 0x9d317465ULL, 0xfddeb03bULL},
+{0xe237eb8cULL, 0x9ef53209ULL, 0x7a6f52acULL, 0x45dd62c4ULL, 0xb4ac9d6aULL, 0x9ef53209ULL, 0x8ab9f2dbULL, 0xae3e3833ULL, 0xb4ac9d6aULL},
+{0x2ce49ce5ULL, 0x3355ce41ULL, 0x82454c8aULL, 0xe37c49a4ULL, 0xd9b1bb6cULL, 0x3355ce41ULL, 0x4b6ec0aaULL, 0xcbd4372ULL, 0xd9b1bb6cULL},
+{0x8fc35d53ULL, 0x556fd37ULL, 0x8fadf679ULL, 0x56811b2cULL, 0x5d4fb1ecULL, 0x556fd37ULL, 0x596665e9ULL, 0xd1c337dULL, 0x5d4fb1ecULL},
+{0x6e874252ULL, 0x39c03b3fULL, 0xcd6d7057ULL, 0x596385beULL, 0xe094a9d6ULL, 0x39c03b3fULL, 0x4acdeabcULL, 0x3b33e32bULL, 0xe094a9d6ULL},
+{0xa9ebfd76ULL, 0xc818c64fULL, 0xaa94537aULL, 0x27ac76fULL, 0x3e126078ULL, 0xc818c64fULL, 0x3d226390ULL, 0x88eecbf8ULL, 0x3e126078ULL},
+{0x80218597ULL, 0x7d182199ULL, 0x247bb3a2ULL, 0x16e7426dULL, 0x42226cabULL, 0x7d182199ULL, 0x2daffa36ULL, 0xbca18b8bULL, 0x42226cabULL},
+{0x7b2f6675ULL, 0xcaae1697ULL, 0x9fab46d7ULL, 0x1064459fULL, 0x82d73f28ULL, 0xcaae1697ULL, 0x4edd1b4bULL, 0xe5d239cbULL, 0x82d73f28ULL},
+{0xddb59b25ULL, 0xccb079b6ULL, 0x211436baULL, 0x790065aULL, 0x6bb3271ULL, 0xccb079b6ULL, 0xf6c59997ULL, 0x7577bda3ULL, 0x6bb3271ULL},
+{0xdd2ffc57ULL, 0x96d7936dULL, 0x87d59835ULL, 0x50b2bc69ULL, 0x94b1c2ebULL, 0x96d7936dULL, 0x3570ef81ULL, 0x7c4c9878ULL, 0x94b1c2ebULL},
+{0xaac1f804ULL, 0x5eba62f2ULL, 0xcdda152ULL, 0x658fc137ULL, 0x1eeb5988ULL, 0x5eba62f2ULL, 0xfacc2e5ULL, 0x47baef08ULL, 0x1eeb5988ULL},
+{0x84c8b00dULL, 0x9476bec7ULL, 0x82169918ULL, 0x9d0c9cd6ULL, 0x9fa345ULL, 0x9476bec7ULL, 0xe3269e4cULL, 0x7fb5fddeULL, 0x9fa345ULL},
+{0x1a187a2fULL, 0xfd5551a7ULL, 0x2893992fULL, 0xd8301cc1ULL, 0x978ae899ULL, 0xfd5551a7ULL, 0x38e021cdULL, 0xfaa7bc34ULL, 0x978ae899ULL},
+{0x5f2c6f37ULL, 0xa6eb1c35ULL, 0x1123951fULL, 0x68de6102ULL, 0xedc3740bULL, 0xa6eb1c35ULL, 0xd812d61ULL, 0xb2f4979fULL, 0xedc3740bULL},
+{0x71202356ULL, 0xa26b5156ULL, 0x19486b5bULL, 0x75aff2b3ULL, 0xcef3b995ULL, 0xa26b5156ULL, 0x907059a1ULL, 0xe3532c70ULL, 0xcef3b995ULL},
+{0x7effebdULL, 0xa24ac5eeULL, 0xa015c79fULL, 0x8b31ec59ULL, 0x7908089ULL, 0xa24ac5eeULL, 0x2a0028e4ULL, 0xf7ab7cadULL, 0x7908089ULL},
+{0xd9adbf43ULL, 0x4d8b240eULL, 0xd85334c3ULL, 0xe58bcc0eULL, 0x8d66a98cULL, 0x4d8b240eULL, 0xeef3072aULL, 0x6f19ea45ULL, 0x8d66a98cULL},
+{0x3b51016fULL, 0xe896d9a6ULL, 0x16b3effcULL, 0x1a1ab1a6ULL, 0x1a0c8bd9ULL, 0xe896d9a6ULL, 0x966ac1b3ULL, 0x49821137ULL, 0x1a0c8bd9ULL},
+{0x1d11e27aULL, 0x707de09ULL, 0x11c72e42ULL, 0x94b64ae2ULL, 0x712007b2ULL, 0x707de09ULL, 0x54a477beULL, 0x37a50252ULL, 0x712007b2ULL},
+{0x5c7f5e6cULL, 0x96c85624ULL, 0xc9212560ULL, 0xc5cd8fb1ULL, 0xe8ed4befULL, 0x96c85624ULL, 0xbb2de125ULL, 0x8fd825feULL, 0xe8ed4befULL},
+{0x66d24335ULL, 0xd70f1c38ULL, 0xa014849bULL, 0x27222d09ULL, 0x6071d006ULL, 0xd70f1c38ULL, 0x32d5ddd0ULL, 0xb7325fc0ULL, 0x6071d006ULL},
+{0xb28ae24dULL, 0x2a648b35ULL, 0x6f48d9f6ULL, 0x2a0638a4ULL, 0x7f129c55ULL, 0x2a648b35ULL, 0x219c3c2aULL, 0x5bbea13cULL, 0x7f129c55ULL},
+{0x222961f9ULL, 0xd7428d84ULL, 0x316744dbULL, 0x12ea3be0ULL, 0xd5d970aeULL, 0xd7428d84ULL, 0xd10b40e3ULL, 0x60ea9e15ULL, 0xd5d970aeULL},
+{0xcc56b68aULL, 0xe4be9cf8ULL, 0xea66489dULL, 0x94093766ULL, 0x4e688125ULL, 0xe4be9cf8ULL, 0x50f877f3ULL, 0x6cfac228ULL, 0x4e688125ULL},
+{0x34e39247ULL, 0x9aa452d2ULL, 0x8b601354ULL, 0x7c660323ULL, 0xf6db8284ULL, 0x9aa452d2ULL, 0x9cba0557ULL, 0xed27af8fULL, 0xf6db8284ULL},
+{0xb29d1954ULL, 0xb7ed97eeULL, 0x7d0e394cULL, 0xbd932998ULL, 0x288f3ba3ULL, 0xb7ed97eeULL, 0xec7b54bcULL, 0xb40d401dULL, 0x288f3ba3ULL},
+{0x581b655fULL, 0x71ea553ULL, 0x5ec95825ULL, 0x5b13ba4ULL, 0x93f9c7e4ULL, 0x71ea553ULL, 0x8b59ca74ULL, 0x80f27f03ULL, 0x93f9c7e4ULL},
+{0xbba600b8ULL, 0x11a7f98ULL, 0xa965786cULL, 0x8e146261ULL, 0x12750a3cULL, 0x11a7f98ULL, 0x49f768e9ULL, 0xcdea5143ULL, 0x12750a3cULL},
+{0x808e9397ULL, 0x30424ecdULL, 0x538eb1d6ULL, 0x880e5d75ULL, 0x8f3ec73aULL, 0x30424ecdULL, 0x3775eb38ULL, 0xe77debc0ULL, 0x8f3ec73aULL},
+{0x97bcaae9ULL, 0x29396a61ULL, 0x1526c2f2ULL, 0x751cd9b7ULL, 0x2c37dda1ULL, 0x29396a61ULL, 0x90bba0feULL, 0x3e18f0b9ULL, 0x2c37dda1ULL},
+{0x98df341cULL, 0xe44a85efULL, 0x8a7efceeULL, 0xfb6ca473ULL, 0xabd7165dULL, 0xe44a85efULL, 0x6f133a77ULL, 0x89ce9d03ULL, 0xabd7165dULL},
+{0x3af3cc04ULL, 0xb575e922ULL, 0xbf2b6447ULL, 0x16fc5440ULL, 0xdd386adbULL, 0xb575e922ULL, 0x4cc991d3ULL, 0x584a6fccULL, 0xdd386adbULL},
+{0x618c56a5ULL, 0xf85b881fULL, 0xd006015fULL, 0x2d64eed1ULL, 0xcd86f3f2ULL, 0xf85b881fULL, 0xe5d0f52aULL, 0xb27b3e03ULL, 0xcd86f3f2ULL},
+{0x5042abcfULL, 0x46d00880ULL, 0xc3ae35fULL, 0xa2358adcULL, 0x5547d2e1ULL, 0x46d00880ULL, 0x78e1f2fULL, 0x7dd6f023ULL, 0x5547d2e1ULL},
+{0x8a305e21ULL, 0xc9831877ULL, 0xf164cbb5ULL, 0xa3d8f640ULL, 0x52e4a917ULL, 0xc9831877ULL, 0x10aef42eULL, 0xf7c69f79ULL, 0x52e4a917ULL},
+{0x4bc431efULL, 0xf7189547ULL, 0x1a94e7e7ULL, 0x5c068df2ULL, 0x80e7ec9fULL, 0xf7189547ULL, 0x1d51746ULL, 0x4f970840ULL, 0x80e7ec9fULL},
+{0x203fd9a1ULL, 0x9252049bULL, 0xe6217bacULL, 0x511a8ccdULL, 0x32dfb543ULL, 0x9252049bULL, 0xaf124c1ULL, 0x25f3831dULL, 0x32dfb543ULL},
+{0xeb410b30ULL, 0x4d4a5c0fULL, 0x3122954eULL, 0xc43dcec9ULL, 0x953a1c3bULL, 0x4d4a5c0fULL, 0x530e7704ULL, 0xe37a0a90ULL, 0x953a1c3bULL},
+{0xb187023bULL, 0x457899dbULL, 0x9030933ULL, 0x491feb8cULL, 0x535d7451ULL, 0x457899dbULL, 0x893486cfULL, 0xe11b482bULL, 0x535d7451ULL},
+{0x1db1bccfULL, 0xf04ee843ULL, 0x15da7b95ULL, 0x2cc69520ULL, 0xc6074ac3ULL, 0xf04ee843ULL, 0x5295e85eULL, 0x70cda91eULL, 0xc6074ac3ULL},
+{0x7bd58510ULL, 0x82e706e0ULL, 0xbe64f753ULL, 0xc2487cd6ULL, 0x73338bceULL, 0x82e706e0ULL, 0x327176e4ULL, 0x261b1b5eULL, 0x73338bceULL},
+{0x19758b9eULL, 0x6f7da7d2ULL, 0x28b2e2e0ULL, 0xca791a66ULL, 0xadec8502ULL, 0x6f7da7d2ULL, 0xf042cb56ULL, 0x7e14b559ULL, 0xadec8502ULL},
+{0x66f44a53ULL, 0x193a91a6ULL, 0xfc07e626ULL, 0xde9c1391ULL, 0xb461c715ULL, 0x193a91a6ULL, 0xccaa4056ULL, 0x9a44e53cULL, 0xb461c715ULL},
+{0xbd697bb8ULL, 0x9dc34f05ULL, 0xde704cecULL, 0x8a251a75ULL, 0xf649033cULL, 0x9dc34f05ULL, 0x958737c3ULL, 0xca7aacadULL, 0xf649033cULL},
+{0xf1204b82ULL, 0xa13338dbULL, 0x69bb9f4ULL, 0x1ce52520ULL, 0x87f36ebaULL, 0xa13338dbULL, 0x6a14033eULL, 0x690725adULL, 0x87f36ebaULL},
+{0x5e392049ULL, 0xd2f56d43ULL, 0xf3b32c49ULL, 0x3e53cde9ULL, 0x38c5f293ULL, 0xd2f56d43ULL, 0x8bffcae1ULL, 0xceb56113ULL, 0x38c5f293ULL},
+{0x7cb31eecULL, 0xf8b3b4d5ULL, 0xa163e48ULL, 0xc5333ea7ULL, 0x376b0a54ULL, 0xf8b3b4d5ULL, 0x1cf22258ULL, 0xb881c5b2ULL, 0x376b0a54ULL},
+{0x19dcc689ULL, 0x584dbdd0ULL, 0x21540d33ULL, 0x4f46b5bcULL, 0x788353e7ULL, 0x584dbdd0ULL, 0x849dc77eULL, 0xf10e357dULL, 0x788353e7ULL},
+{0x1b40de81ULL, 0xf6e4916aULL, 0x9c158707ULL, 0x4a6caec8ULL, 0xc3350b2cULL, 0xf6e4916aULL, 0x78c1ca81ULL, 0x3d0c4350ULL, 0xc3350b2cULL},
+{0x2161fc5bULL, 0x63eda470ULL, 0x9c34b29cULL, 0xb12f3e9eULL, 0x5b80fdceULL, 0x63eda470ULL, 0x75109f50ULL, 0xfdcd9d86ULL, 0x5b80fdceULL},
+{0xb47098a8ULL, 0x764b5f39ULL, 0xdfc9df9fULL, 0x8ca8cc1aULL, 0xa9c94aaULL, 0x764b5f39ULL, 0xa3640db4ULL, 0x7931b247ULL, 0xa9c94aaULL}},
+  {{0x866ec0d1ULL, 0xce3f2b55ULL, 0xcfeed2dULL, 0x7f434863ULL, 0x156dcb42ULL, 0xce3f2b55ULL, 0xd4b884fbULL, 0xb9a781bbULL, 0x156dcb42ULL},
+{0x2e154f37ULL, 0xf56caa53ULL, 0xb733c12bULL, 0xe2ece45fULL, 0xb1d3f3cULL, 0xf56caa53ULL, 0xa9687da3ULL, 0x26d291f1ULL, 0xb1d3f3cULL},
+{0xf4d31bbULL, 0xf18840c2ULL, 0x5972c12bULL, 0xbb87c38dULL, 0x2231da14ULL, 0xf18840c2ULL, 0x21eb6e2ULL, 0xe6d0d1b6ULL, 0x2231da14ULL},
+{0x24abdcc7ULL, 0x57ee8c3fULL, 0xd5c4b7bdULL, 0x64f71fefULL, 0xb651c646ULL, 0x57ee8c3fULL, 0x21e5b2a0ULL, 0x4564af5eULL, 0xb651c646ULL},
+{0xf32bc705ULL, 0xa31358f8ULL, 0x36265562ULL, 0xd72dbf50ULL, 0x9b69dd06ULL, 0xa31358f8ULL, 0xe9bd5182ULL, 0xf3b52244ULL, 0x9b69dd06ULL},
+{0xde48a2c8ULL, 0x3e174159ULL, 0x9dd060daULL, 0xe7265479ULL, 0x81364d5ULL, 0x3e174159ULL, 0x1e4f027cULL, 0x81d3d361ULL, 0x81364d5ULL},
+{0x4411768fULL, 0x7607445eULL, 0x4e142be2ULL, 0xc3eeaf3bULL, 0x93ec77ccULL, 0x7607445eULL, 0x253f7e67ULL, 0x17598842ULL, 0x93ec77ccULL},
+{0x61500d2cULL, 0xea8823ULL, 0x7ae0d73bULL, 0xf998441fULL, 0x67c80ebdULL, 0xea8823ULL, 0xabca8512ULL, 0xed21c0a2ULL, 0x67c80ebdULL},
+{0xe762bcfaULL, 0x5f5b9365ULL, 0x327ba960ULL, 0xe53f653cULL, 0x16a7914cULL, 0x5f5b9365ULL, 0x86444c3ULL, 0xf553c7bdULL, 0x16a7914cULL},
+{0xfa51d8dfULL, 0xfcc5ccc2ULL, 0xb808ef52ULL, 0xb0ec562aULL, 0x8245633eULL, 0xfcc5ccc2ULL, 0xa87e5074ULL, 0x1624bea0ULL, 0x8245633eULL},
+{0x97932f3aULL, 0xfb685b5dULL, 0x6bdc05c0ULL, 0x2d3cf523ULL, 0x67a6d24fULL, 0xfb685b5dULL, 0x8599f34fULL, 0x938166a0ULL, 0x67a6d24fULL},
+{0xee904ec9ULL, 0x56bd6b74ULL, 0x4b85183fULL, 0x8a8c2d1bULL, 0x82aba8f5ULL, 0x56bd6b74ULL, 0xca05fdb6ULL, 0x8295c23fULL, 0x82aba8f5ULL},
+{0x878aa5b5ULL, 0x8b33af47ULL, 0x214717d6ULL, 0x9d79baa4ULL, 0x5e729ea2ULL, 0x8b33af47ULL, 0xa1fb3520ULL, 0xa856c7bfULL, 0x5e729ea2ULL},
+{0xdde147d2ULL, 0xbe526586ULL, 0x5b05a414ULL, 0xbc1cad6dULL, 0x87d1920cULL, 0xbe526586ULL, 0x7a42a064ULL, 0xffa67ab1ULL, 0x87d1920cULL},
+{0x784a5be2ULL, 0x735f8577ULL, 0x8d0ba3b1ULL, 0x357c2ae2ULL, 0x55c50711ULL, 0x735f8577ULL, 0x184c22e8ULL, 0x7789be36ULL, 0x55c50711ULL},
+{0xcd66ce0fULL, 0x148d8b2cULL, 0x46c698fULL, 0x3c1d275fULL, 0x99c1e160ULL, 0x148d8b2cULL, 0xdfc0243eULL, 0x5bb2f13dULL, 0x99c1e160ULL},
+{0x209a2471ULL, 0xd679ee63ULL, 0xcdda5c5aULL, 0xe7dc3c82ULL, 0x58a48cd6ULL, 0xd679ee63ULL, 0xa6dd7f1dULL, 0x82e16533ULL, 0x58a48cd6ULL},
+{0xc5da42e2ULL, 0xe242f320ULL, 0x53afc337ULL, 0x7527b1a4ULL, 0xafca696ULL, 0xe242f320ULL, 0xefa0c71aULL, 0x5811a738ULL, 0xafca696ULL},
+{0xdfd67acULL, 0x2cf8c08cULL, 0x116ca28fULL, 0xb278317aULL, 0x2bffa86dULL, 0x2cf8c08cULL, 0xdf87e6eaULL, 0x876de3f2ULL, 0x2bffa86dULL},
+{0xae8fc7a0ULL, 0xe34047ecULL, 0xab032f55ULL, 0x9b00bedbULL, 0x8426df9cULL, 0xe34047ecULL, 0xb4f086dULL, 0x11dec011ULL, 0x8426df9cULL},
+{0x8adf355aULL, 0xf42decbcULL, 0x598fe969ULL, 0x96b6175ULL, 0x12ef157cULL, 0xf42decbcULL, 0xb7025392ULL, 0xdb4487b7ULL, 0x12ef157cULL},
+{0x838bdeedULL, 0xe1324655ULL, 0x3893d726ULL, 0x5901a928ULL, 0xf12edb3cULL, 0xe1324655ULL, 0x1fbeaba0ULL, 0x5f670bd8ULL, 0xf12edb3cULL},
+{0xed6fa831ULL, 0xa269a278ULL, 0xcfc28dcfULL, 0x99b73233ULL, 0xbf332cdaULL, 0xa269a278ULL, 0x629467f6ULL, 0xfb7ff784ULL, 0xbf332cdaULL},
+{0x174fe1b9ULL, 0x3e53f0beULL, 0x8ead0501ULL, 0xe9b02276ULL, 0xf545a4b2ULL, 0x3e53f0beULL, 0x662a93d5ULL, 0x34db66deULL, 0xf545a4b2ULL},
+{0x5a271faeULL, 0xc0f7680cULL, 0x84e1265aULL, 0x166a2ccfULL, 0x57d5f0d5ULL, 0xc0f7680cULL, 0x5f686d8dULL, 0xd3598d8eULL, 0x57d5f0d5ULL},
+{0x9bc4cca5ULL, 0x4569e058ULL, 0xca4d6e6eULL, 0x6245edfULL, 0x5932af90ULL, 0x4569e058ULL, 0xb0cf541dULL, 0x42bf401fULL, 0x5932af90ULL},
+{0xff0ac742ULL, 0xcdb1a9ecULL, 0xbe754e7dULL, 0x9d7f6ddcULL, 0xecf35296ULL, 0xcdb1a9ecULL, 0x5b6befaaULL, 0x3abc7a62ULL, 0xecf35296ULL},
+{0xb5f19bf1ULL, 0x99910a5aULL, 0x241e87a2ULL, 0xb182ceedULL, 0x347d64aULL, 0x99910a5aULL, 0x107a9ec5ULL, 0x6a2ec682ULL, 0x347d64aULL},
+{0x113f4000ULL, 0x900bbaf8ULL, 0x93683e2cULL, 0x32d2c147ULL, 0x9f3886f2ULL, 0x900bbaf8ULL, 0x5d68b30cULL, 0x3709607cULL, 0x9f3886f2ULL},
+{0x3e401706ULL, 0x83568961ULL, 0xbd0a2d83ULL, 0xc8776fb8ULL, 0x113a1991ULL, 0x83568961ULL, 0xbd676d58ULL, 0x5ed3ec90ULL, 0x113a1991ULL},
+{0x270266a8ULL, 0x47221ee1ULL, 0x39357c52ULL, 0xadc77078ULL, 0x8665f1adULL, 0x47221ee1ULL, 0x8c62fbcfULL, 0x98f00a39ULL, 0x8665f1adULL},
+{0xd6a0c2f4ULL, 0x4bb17500ULL, 0xf28f0348ULL, 0x7a3edb4fULL, 0x847c1a41ULL, 0x4bb17500ULL, 0xbf3b7ffeULL, 0x292e44cdULL, 0x847c1a41ULL},
+{0xe9fca007ULL, 0x1c710e9ULL, 0xa88093edULL, 0x1f671f89ULL, 0x139ca441ULL, 0x1c710e9ULL, 0x80652a7aULL, 0x3dd41957ULL, 0x139ca441ULL},
+{0xe03e045ULL, 0x32558a37ULL, 0xffe98157ULL, 0x3cb83eb6ULL, 0x5aaa7c23ULL, 0x32558a37ULL, 0x7d2a31bcULL, 0xf8b79b1aULL, 0x5aaa7c23ULL},
+{0x2eb9456cULL, 0x356883b7ULL, 0xadd813efULL, 0x26cc6e94ULL, 0x238535ULL, 0x356883b7ULL, 0xa3c0a05ULL, 0x77bfc57fULL, 0x238535ULL},
+{0x84ee5b83ULL, 0x430a7f51ULL, 0xd626c1d5ULL, 0x93454be2ULL, 0xcac05116ULL, 0x430a7f51ULL, 0x694bcaefULL, 0x9deb8a2eULL, 0xcac05116ULL},
+{0xb46872beULL, 0xb5936364ULL, 0xb11daea7ULL, 0x60279c3aULL, 0x7051b72aULL, 0xb5936364ULL, 0xa4156006ULL, 0xf326d765ULL, 0x7051b72aULL},
+{0xa6dd250aULL, 0xaaff74a1ULL, 0x683703fdULL, 0x26b4f6d1ULL, 0x51ca057dULL, 0xaaff74a1ULL, 0xbd602f89ULL, 0x1d7c294dULL, 0x51ca057dULL},
+{0x2bc88123ULL, 0xa74e91b2ULL, 0xad9c30e6ULL, 0xfeddd8e0ULL, 0x657534ddULL, 0xa74e91b2ULL, 0xac5ae11aULL, 0x63ebe50cULL, 0x657534ddULL},
+{0xfba2e147ULL, 0xe27342f1ULL, 0xf2fa1026ULL, 0x30157533ULL, 0x59ace7a1ULL, 0xe27342f1ULL, 0x48bbcc4dULL, 0xc3aede6dULL, 0x59ace7a1ULL},
+{0x7df1e7e2ULL, 0xdeb5126aULL, 0xba7cecffULL, 0xfc7424b9ULL, 0xa9794326ULL, 0xdeb5126aULL, 0xc9632582ULL, 0x14f59427ULL, 0xa9794326ULL},
+{0x4eb4fa7eULL, 0x70240dd7ULL, 0x5bf5b966ULL, 0xbad3c663ULL, 0xd1934615ULL, 0x70240dd7ULL, 0x77bdf0a4ULL, 0x2d54bcaeULL, 0xd1934615ULL},
+{0x987fc1e9ULL, 0x205f6aecULL, 0xb302c6a8ULL, 0x699a5a11ULL, 0x8ccd32b6ULL, 0x205f6aecULL, 0x9bed7e86ULL, 0x7984a024ULL, 0x8ccd32b6ULL},
+{0xd42ed658ULL, 0xdcccd457ULL, 0xf5561796ULL, 0xe89bc2b2ULL, 0xa53bf3faULL, 0xdcccd457ULL, 0xb39da3d2ULL, 0x592b6503ULL, 0xa53bf3faULL},
+{0x5dc46998ULL, 0xef73099ULL, 0x16b84493ULL, 0x880a6ab8ULL, 0xfb17e402ULL, 0xef73099ULL, 0x6460a1c5ULL, 0xdd4420d8ULL, 0xfb17e402ULL},
+{0xb985c64dULL, 0x19e58a89ULL, 0x4ab6a0e5ULL, 0xadbb87c5ULL, 0x6e261c3bULL, 0x19e58a89ULL, 0xbfaa99ebULL, 0x1cabcbd2ULL, 0x6e261c3bULL},
+{0x8977d35fULL, 0xd4b8cac4ULL, 0x81d45396ULL, 0x70bbf41aULL, 0xb02d5fd3ULL, 0xd4b8cac4ULL, 0xd47fe129ULL, 0xdd017033ULL, 0xb02d5fd3ULL},
+{0x99d69cd0ULL, 0x994efc9dULL, 0xc6bb0062ULL, 0x2ff494efULL, 0xef0426bULL, 0x994efc9dULL, 0x3241130eULL, 0x3de8b081ULL, 0xef0426bULL},
+{0x130f67bULL, 0x7b0a56dcULL, 0x410166c8ULL, 0xbf0ce3a5ULL, 0xc59fde42ULL, 0x7b0a56dcULL, 0x9b91d966ULL, 0x8b0f1f3bULL, 0xc59fde42ULL},
+{0xda811e23ULL, 0xa766eac7ULL, 0x509620d5ULL, 0x4aba25eeULL, 0xe9537899ULL, 0xa766eac7ULL, 0x78977a55ULL, 0x2546f8dfULL, 0xe9537899ULL},
+{0xb5594eeULL, 0x9b3bbbbfULL, 0x35cfd995ULL, 0xb4a2a0a6ULL, 0x7cf6f596ULL, 0x9b3bbbbfULL, 0x8fd9ef6eULL, 0xe182d4b9ULL, 0x7cf6f596ULL},
+{0xcf8c4280ULL, 0xe1bf64edULL, 0x6d0a7dcaULL, 0x6a889115ULL, 0x945ad99bULL, 0xe1bf64edULL, 0x5f79906eULL, 0xc9bcfe93ULL, 0x945ad99bULL},
+{0xea68b6b1ULL, 0xb127406cULL, 0xfd71baeULL, 0x5c1d0b4bULL, 0xe4320db9ULL, 0xb127406cULL, 0xfeb8ca8bULL, 0xa9295c0ULL, 0xe4320db9ULL},
+{0x9df9d628ULL, 0x52fd26bdULL, 0xea872ba1ULL, 0xbeaeb77fULL, 0x75883e73ULL, 0x52fd26bdULL, 0x2395876ULL, 0xb5cd7a09ULL, 0x75883e73ULL},
+{0x56f6ad1aULL, 0x1d4406bcULL, 0xb5ca118cULL, 0x34b2b3e2ULL, 0xff8619a8ULL, 0x1d4406bcULL, 0x2de94b76ULL, 0x6cdd333aULL, 0xff8619a8ULL},
+{0xef5e1fd6ULL, 0xabcab07cULL, 0x9d40bc5ULL, 0xade3bc02ULL, 0xebcb2f60ULL, 0xabcab07cULL, 0x96eb829fULL, 0x49b87323ULL, 0xebcb2f60ULL},
+{0x706811d9ULL, 0xbab67765ULL, 0x91c7353cULL, 0x395b6e9eULL, 0x629eed38ULL, 0xbab67765ULL, 0x2ab2ffd2ULL, 0xbcd4969aULL, 0x629eed38ULL},
+{0x69c471f9ULL, 0xb846ff0eULL, 0xd999ffeeULL, 0x38b8ff2cULL, 0x837afddULL, 0xb846ff0eULL, 0xf21498caULL, 0xeb342bcbULL, 0x837afddULL},
+{0x790fbb35ULL, 0x93b51ca0ULL, 0x86d0ea7eULL, 0x1957a52aULL, 0x411f5b66ULL, 0x93b51ca0ULL, 0x460787c0ULL, 0xf369911aULL, 0x411f5b66ULL},
+{0xd69241a7ULL, 0xe2bcf70aULL, 0x509901bdULL, 0xaea9064aULL, 0x8baa091bULL, 0xe2bcf70aULL, 0x84a07f15ULL, 0xc30714fbULL, 0x8baa091bULL},
+{0x4fb0b22cULL, 0xb11af7ffULL, 0xd735fa6aULL, 0x5fac9bcfULL, 0x4e696dacULL, 0xb11af7ffULL, 0xf18eef6bULL, 0xfe2dfcb0ULL, 0x4e696dacULL},
+{0x4ceced69ULL, 0x3f78006eULL, 0x186528d3ULL, 0xd47b24deULL, 0x7517d255ULL, 0x3f78006eULL, 0x636e36a8ULL, 0x2e24c125ULL, 0x7517d255ULL},
+{0xe46bca63ULL, 0x4455f99eULL, 0xfdcac571ULL, 0x406e6480ULL, 0x7eb01c42ULL, 0x4455f99eULL, 0xca539b12ULL, 0x878df903ULL, 0x7eb01c42ULL},
+{0x23ba3b5bULL, 0xa743d22cULL, 0x67d81ba6ULL, 0x3a1f361fULL, 0x2d96fa29ULL, 0xa743d22cULL, 0xa2b4131fULL, 0x6dfc634cULL, 0x2d96fa29ULL},
+{0xcee63b94ULL, 0x23d4ee66ULL, 0x6fcc552ULL, 0x9a5a7f6fULL, 0xca6f4452ULL, 0x23d4ee66ULL, 0x294c9d0cULL, 0xa640523fULL, 0xca6f4452ULL},
+{0x4bb7e0c2ULL, 0x35b1cc36ULL, 0x93ac8b29ULL, 0x44c96422ULL, 0xa4801de7ULL, 0x35b1cc36ULL, 0x793cd072ULL, 0x16029013ULL, 0xa4801de7ULL},
+{0x4c64e3fULL, 0xc9f83edeULL, 0x17cff498ULL, 0x97aa076cULL, 0xaedd389bULL, 0xc9f83edeULL, 0xd591b50cULL, 0xea018aa6ULL, 0xaedd389bULL},
+{0x28695621ULL, 0x5fc04cd3ULL, 0x34d94d8aULL, 0xac0b4ea8ULL, 0x52077a15ULL, 0x5fc04cd3ULL, 0xffd9db04ULL, 0xf0ec4aeeULL, 0x52077a15ULL},
+{0x15dee1faULL, 0xe1a885c1ULL, 0xf3f79753ULL, 0xdc8a6d5aULL, 0x3ed31fa5ULL, 0xe1a885c1ULL, 0x5036df59ULL, 0x63ed2f4fULL, 0x3ed31fa5ULL},
+{0x385e83d4ULL, 0xfeca838cULL, 0xa498dd8ULL, 0x4ba3e8dULL, 0xde89fd66ULL, 0xfeca838cULL, 0x878e1aecULL, 0xd7cdd0e4ULL, 0xde89fd66ULL},
+{0x4816c8d4ULL, 0x2e2e2d06ULL, 0x8141a689ULL, 0xedd556d8ULL, 0x1552d967ULL, 0x2e2e2d06ULL, 0x138497f7ULL, 0xab08593bULL, 0x1552d967ULL},
+{0xe094dc0fULL, 0x3488518eULL, 0xaf03f463ULL, 0x75229896ULL, 0x22c074cfULL, 0x3488518eULL, 0x81c96512ULL, 0x2f3fcfd4ULL, 0x22c074cfULL},
+{0x736f44b4ULL, 0x8a47e112ULL, 0x42be05ecULL, 0x73ebe8c9ULL, 0xa65a518eULL, 0x8a47e112ULL, 0xb7ead89dULL, 0x43d27a1eULL, 0xa65a518eULL},
+{0xf5acdc34ULL, 0x8878fef9ULL, 0xd5489cc2ULL, 0xab20a296ULL, 0x92638e2eULL, 0x8878fef9ULL, 0xebab3003ULL, 0xf14e31b5ULL, 0x92638e2eULL},
+{0x67829b45ULL, 0xcc0d622cULL, 0xa2125843ULL, 0x396e8fb6ULL, 0x4e17f9cdULL, 0xcc0d622cULL, 0x87b60a29ULL, 0xb974b5f2ULL, 0x4e17f9cdULL},
+{0xeb2f7490ULL, 0x482147c4ULL, 0xf3592d6bULL, 0x8de3d7c2ULL, 0x57e10a9bULL, 0x482147c4ULL, 0x9748383ULL, 0x360ce3e0ULL, 0x57e10a9bULL},
+{0x58c8a9daULL, 0x965e8f5dULL, 0xfbf29e42ULL, 0x20fbc9b9ULL, 0xe11b7ee4ULL, 0x965e8f5dULL, 0x435f442aULL, 0x82afc5e8ULL, 0xe11b7ee4ULL},
+{0x4350a09ULL, 0xe63bee8bULL, 0xfd6b7967ULL, 0x2532bc1bULL, 0xa628dd76ULL, 0xe63bee8bULL, 0x207f85beULL, 0xab1c1797ULL, 0xa628dd76ULL},
+{0x1e8c2245ULL, 0x50231a96ULL, 0xe9c48b8aULL, 0x66f3ec3fULL, 0xaef32813ULL, 0x50231a96ULL, 0x3a3b7ac5ULL, 0xfd84bed1ULL, 0xaef32813ULL},
+{0x71490c14ULL, 0x49c7a698ULL, 0xe54f6ba0ULL, 0xf1f5c8b3ULL, 0x9df5cde3ULL, 0x49c7a698ULL, 0x1dc11aaULL, 0x7b1119b7ULL, 0x9df5cde3ULL},
+{0x54de6355ULL, 0x5e65b645ULL, 0xbe47a893ULL, 0x50c38331ULL, 0x9e59145fULL, 0x5e65b645ULL, 0x8bf01c74ULL, 0xbb097700ULL, 0x9e59145fULL},
+{0x7c861998ULL, 0xde1b5dccULL, 0x788d1ff6ULL, 0x6a153191ULL, 0x1acf42c7ULL, 0xde1b5dccULL, 0x3c6ee980ULL, 0x9bec108aULL, 0x1acf42c7ULL},
+{0x19ecc3f3ULL, 0x5e3952e8ULL, 0x6664c7a9ULL, 0xd364df28ULL, 0x6e76b614ULL, 0x5e3952e8ULL, 0xa9040ef1ULL, 0x95495115ULL, 0x6e76b614ULL},
+{0x1e74a427ULL, 0x498552dbULL, 0xcc60c940ULL, 0xc753fd81ULL, 0xd912772dULL, 0x498552dbULL, 0x8595f866ULL, 0xca88059cULL, 0xd912772dULL},
+{0x8d09586ULL, 0xfe896e3ULL, 0x6c355c40ULL, 0x800b02ULL, 0x30d6d864ULL, 0xfe896e3ULL, 0x1a8b3cebULL, 0x5f7e004cULL, 0x30d6d864ULL},
+{0x402f2e19ULL, 0x4d77eb99ULL, 0x65eeb32dULL, 0x8fc1a04dULL, 0xab52ac79ULL, 0x4d77eb99ULL, 0xb495e980ULL, 0x7437863cULL, 0xab52ac79ULL},
+{0x1ab2fe32ULL, 0xa1fdf91aULL, 0xf4155430ULL, 0xfbe0f2a2ULL, 0x27d47836ULL, 0xa1fdf91aULL, 0x3cc2a89aULL, 0x95bb111aULL, 0x27d47836ULL},
+{0xf43d7386ULL, 0xde04188aULL, 0x9582494eULL, 0x3574f477ULL, 0xbfe1bbb4ULL, 0xde04188aULL, 0x1c0cd470ULL, 0x51c0c66ULL, 0xbfe1bbb4ULL},
+{0x731a1a24ULL, 0x5189b7c4ULL, 0xd58dcd4ULL, 0xebeb3a62ULL, 0x2a196d9fULL, 0x5189b7c4ULL, 0xe94ffeb0ULL, 0xebcb058dULL, 0x2a196d9fULL},
+{0xe636705fULL, 0x859354c6ULL, 0xcdcb891bULL, 0x4dd165d2ULL, 0x9bb99db3ULL, 0x859354c6ULL, 0xdacd6ac2ULL, 0x647b31b1ULL, 0x9bb99db3ULL},
+{0x70094107ULL, 0x84c62ff6ULL, 0x9bdf543aULL, 0xc3d0218eULL, 0x54528a1eULL, 0x84c62ff6ULL, 0xa2033f4cULL, 0x4d76c234ULL, 0x54528a1eULL},
+{0xe6e65a3dULL, 0xaf17a025ULL, 0xc3866bc3ULL, 0x5dc2065eULL, 0xa95f98eULL, 0xaf17a025ULL, 0x1d24ee63ULL, 0xea696c7aULL, 0xa95f98eULL},
+{0x3fe7308bULL, 0x2027fa43ULL, 0x803ded28ULL, 0xe7dd33ddULL, 0x8e9e3637ULL, 0x2027fa43ULL, 0x7177d5bcULL, 0x9c89fac1ULL, 0x8e9e3637ULL},
+{0x49c71f27ULL, 0x8b6b3e6cULL, 0xd363d239ULL, 0xe3559cbbULL, 0x293e3dc6ULL, 0x8b6b3e6cULL, 0x5353b4b9ULL, 0xd651e688ULL, 0x293e3dc6ULL},
+{0x430f6bfULL, 0xab3a12a7ULL, 0xaa66d1c5ULL, 0xf5d69449ULL, 0xfb5b0a05ULL, 0xab3a12a7ULL, 0x99f07634ULL, 0x539a5095ULL, 0xfb5b0a05ULL},
+{0x504e8bd0ULL, 0xb4da2b1cULL, 0xccc04524ULL, 0x929a3ab4ULL, 0x41248a4ULL, 0xb4da2b1cULL, 0xf2021fa9ULL, 0x4e51ab21ULL, 0x41248a4ULL},
+{0x5a8b291ULL, 0xe4f7ad57ULL, 0xe1d1ee8ULL, 0x10d442d7ULL, 0xfbd63b46ULL, 0xe4f7ad57ULL, 0x64c87f79ULL, 0xc440f03ULL, 0xfbd63b46ULL},
+{0x9ef7c5a8ULL, 0xbd04bd94ULL, 0x2728940bULL, 0xaace4fdcULL, 0x55a4bae4ULL, 0xbd04bd94ULL, 0xbb2d9d4ULL, 0xad5ca2fULL, 0x55a4bae4ULL},
+{0x35cfd848ULL, 0xd108bef6ULL, 0x6a73c1a2ULL, 0xee33ea3bULL, 0x3a8e6df1ULL, 0xd108bef6ULL, 0x5e2d76a8ULL, 0xc826f4f2ULL, 0x3a8e6df1ULL},
+{0x437a576bULL, 0x70122115ULL, 0xa1c7be57ULL, 0x18a1a721ULL, 0x6f29dc05ULL, 0x70122115ULL, 0x360471b2ULL, 0xa60530a3ULL, 0x6f29dc05ULL},
+{0x8f55b488ULL, 0x56a29aa1ULL, 0x3a72987ULL, 0x5cc9e6a7ULL, 0xdd9cf8a8ULL, 0x56a29aa1ULL, 0x84e5c5faULL, 0x559ee39ULL, 0xdd9cf8a8ULL},
+{0x24850ee6ULL, 0x15a5485aULL, 0x259ff41cULL, 0xb89c7fbdULL, 0x9edc975ULL, 0x15a5485aULL, 0x4c92c5caULL, 0xfecf5e7aULL, 0x9edc975ULL},
+{0xd07ed093ULL, 0x64651e90ULL, 0x6fb76de7ULL, 0x3c2d4b64ULL, 0xda4986d7ULL, 0x64651e90ULL, 0x706d7baaULL, 0x5dc2c2fbULL, 0xda4986d7ULL},
+{0xeb0dca47ULL, 0xd7dd1bfbULL, 0xe95a81c4ULL, 0x2befaacfULL, 0x7844696fULL, 0xd7dd1bfbULL, 0xd7105a13ULL, 0x9a3b80b6ULL, 0x7844696fULL},
+{0x8f2bea9bULL, 0xa2cdf912ULL, 0xb76ac14dULL, 0x7d6e1e67ULL, 0x5d73c952ULL, 0xa2cdf912ULL, 0x209d6b3dULL, 0xcf6b1b45ULL, 0x5d73c952ULL},
+{0x3b536854ULL, 0x9d05cdbfULL, 0x68051363ULL, 0xf189861aULL, 0x574e6a21ULL, 0x9d05cdbfULL, 0xe60b8cdbULL, 0x94623bf0ULL, 0x574e6a21ULL},
+{0xfee73e1cULL, 0x668bcd15ULL, 0x99cd96baULL, 0x98dc448ULL, 0x7a0e2f12ULL, 0x668bcd15ULL, 0x1af8c3c6ULL, 0x14dd143dULL, 0x7a0e2f12ULL},
+{0x5b7b7423ULL, 0xbed9a35ULL, 0x5bbc3601ULL, 0x35f03533ULL, 0x1c68828fULL, 0xbed9a35ULL, 0xb7185168ULL, 0x170f646ULL, 0x1c68828fULL},
+{0x8421f67aULL, 0x735f34adULL, 0x96846b4fULL, 0xeaf395f5ULL, 0xb992427cULL, 0x735f34adULL, 0xffb7886bULL, 0x6ac02c0bULL, 0xb992427cULL},
+{0x1a6315dbULL, 0xf0dc8e12ULL, 0x9b6c951ULL, 0xa43fb4acULL, 0x70495052ULL, 0xf0dc8e12ULL, 0x99c0c6eULL, 0x90f8efa8ULL, 0x70495052ULL},
+{0x5fae7316ULL, 0x99accddfULL, 0xc729f56fULL, 0x90cb5a3aULL, 0x31d40405ULL, 0x99accddfULL, 0x9b497f65ULL, 0xe6bade6dULL, 0x31d40405ULL},
+{0x319d8017ULL, 0xfebe1fb0ULL, 0x9405de62ULL, 0x40978459ULL, 0x9c278ee1ULL, 0xfebe1fb0ULL, 0xcdc3df35ULL, 0xb82bd0c7ULL, 0x9c278ee1ULL},
+{0x872d6dadULL, 0xfb7a5ae8ULL, 0xe851faecULL, 0x8f579dd7ULL, 0xba818473ULL, 0xfb7a5ae8ULL, 0xdef09d48ULL, 0x6d0b828aULL, 0xba818473ULL},
+{0x1efa2cb5ULL, 0x34422d5cULL, 0xd77a607dULL, 0x3b4e6de9ULL, 0x1c56832ULL, 0x34422d5cULL, 0x34ff5306ULL, 0xbecd9160ULL, 0x1c56832ULL},
+{0x1c42007cULL, 0xa1f923b5ULL, 0xde32a129ULL, 0x7440cc18ULL, 0x87b57053ULL, 0xa1f923b5ULL, 0x83b531eULL, 0x88e90d7cULL, 0x87b57053ULL},
+{0xdee2cbe5ULL, 0x88305db8ULL, 0xbbf8d0baULL, 0x79bc1cf6ULL, 0x1c21c596ULL, 0x88305db8ULL, 0x67c20edeULL, 0x3d7460d6ULL, 0x1c21c596ULL},
+{0x9d48d56cULL, 0x7974de20ULL, 0x33b8e74eULL, 0x61cd5df8ULL, 0x25c75b30ULL, 0x7974de20ULL, 0x963c4adeULL, 0x388565d2ULL, 0x25c75b30ULL},
+{0xd35f5757ULL, 0xa91baae3ULL, 0xb7256d3ULL, 0x92283b3dULL, 0xb3619d22ULL, 0xa91baae3ULL, 0x8cddddeaULL, 0x47678f68ULL, 0xb3619d22ULL},
+{0xfdd111f7ULL, 0x13876cc0ULL, 0x565b2024ULL, 0xc2857ef6ULL, 0xcce581d2ULL, 0x13876cc0ULL, 0x7991b5b9ULL, 0x1a165307ULL, 0xcce581d2ULL},
+{0x46435d1eULL, 0x6fe1253eULL, 0x7e495f23ULL, 0x21f37e66ULL, 0x3c08d53eULL, 0x6fe1253eULL, 0x2cf78d48ULL, 0x9a70b79bULL, 0x3c08d53eULL},
+{0xe8f97c6dULL, 0x3a326836ULL, 0xc78f5ef3ULL, 0x5f142d4ULL, 0xab241f88ULL, 0x3a326836ULL, 0xdb39f74fULL, 0x3283b7c2ULL, 0xab241f88ULL},
+{0x86c2afa0ULL, 0x4c1fc133ULL, 0x71c52615ULL, 0xb3e0bfccULL, 0xdccd9b97ULL, 0x4c1fc133ULL, 0x48e35e32ULL, 0x9f93c518ULL, 0xdccd9b97ULL},
+{0x4bce32dfULL, 0x55793321ULL, 0xe716d9e7ULL, 0xef55ceb9ULL, 0x668b720cULL, 0x55793321ULL, 0xa0784d89ULL, 0x1b0e849aULL, 0x668b720cULL},
+{0x3ec8e30dULL, 0x4f81ce32ULL, 0x99d1a8faULL, 0xac2990a5ULL, 0xebbc0139ULL, 0x4f81ce32ULL, 0x9b2bca20ULL, 0xbe65dde9ULL, 0xebbc0139ULL},
+{0x401e06cfULL, 0xf4a3c3e5ULL, 0xda9423feULL, 0xcc0091e5ULL, 0x1e9375f0ULL, 0xf4a3c3e5ULL, 0xf145a218ULL, 0x65dfc1b0ULL, 0x1e9375f0ULL},
+{0xa5b379a7ULL, 0x5b06afb7ULL, 0x3b6f00d9ULL, 0x54934c8bULL, 0x576e2456ULL, 0x5b06afb7ULL, 0xcd403d18ULL, 0x6278b26fULL, 0x576e2456ULL},
+{0x8cb4f1b1ULL, 0x32e4f1b3ULL, 0xf73d97e9ULL, 0x29b9c28cULL, 0x25d6f660ULL, 0x32e4f1b3ULL, 0x795f390eULL, 0x2d184200ULL, 0x25d6f660ULL},
+{0x39a849aaULL, 0xce85ef3cULL, 0xcd4e177eULL, 0x2298f52aULL, 0x50177403ULL, 0xce85ef3cULL, 0x69d15f48ULL, 0xf00a8701ULL, 0x50177403ULL},
+{0x70b57328ULL, 0xdc5e9a8aULL, 0xaa5f5a16ULL, 0x56c198ceULL, 0x7979aa1bULL, 0xdc5e9a8aULL, 0x465ba52eULL, 0x14975f0aULL, 0x7979aa1bULL},
+{0xc594f547ULL, 0x9c191be2ULL, 0x56b9094ULL, 0xd047e372ULL, 0x26f32fedULL, 0x9c191be2ULL, 0xfc413993ULL, 0x2c774e9fULL, 0x26f32fedULL},
+{0x6ab4ed1cULL, 0xf264a3cbULL, 0xb6d8e024ULL, 0x2040fb2cULL, 0xee398072ULL, 0xf264a3cbULL, 0xa992f663ULL, 0x4e308b61ULL, 0xee398072ULL},
+{0x25a9042bULL, 0x7aecd0eeULL, 0xb962e6d8ULL, 0xd42b2a82ULL, 0x3a4171b3ULL, 0x7aecd0eeULL, 0xd4a9c713ULL, 0x54827b58ULL, 0x3a4171b3ULL},
+{0xdd72089ULL, 0x5aa1fbe7ULL, 0x1426edffULL, 0x489527dcULL, 0x8044d8e5ULL, 0x5aa1fbe7ULL, 0x904d8ad6ULL, 0x99fb8003ULL, 0x8044d8e5ULL},
+{0xeb54e546ULL, 0x18aae683ULL, 0x5a6320b0ULL, 0x2458e1d8ULL, 0xc4630f8ULL, 0x18aae683ULL, 0x155ddda0ULL, 0xefbab6e9ULL, 0xc4630f8ULL},
+{0x1348a2acULL, 0x65234638ULL, 0x2e6f214fULL, 0x8b85d76bULL, 0xef56b379ULL, 0x65234638ULL, 0x15a25b3aULL, 0x3600fb9bULL, 0xef56b379ULL},
+{0x58ad37caULL, 0x6742fb87ULL, 0x32a7bea0ULL, 0x8e7ce64bULL, 0xa76128fbULL, 0x6742fb87ULL, 0x489967cULL, 0xc8f408bbULL, 0xa76128fbULL},
+{0x8d04dc7dULL, 0x9a8c7db5ULL, 0x431ee7c7ULL, 0xf2e8fd72ULL, 0xab981236ULL, 0x9a8c7db5ULL, 0x6ff0be76ULL, 0xf8898634ULL, 0xab981236ULL},
+{0xc3f9a9b2ULL, 0xc5bb0276ULL, 0x5158f449ULL, 0x270e3d44ULL, 0x65fea435ULL, 0xc5bb0276ULL, 0xfe49738dULL, 0xc983534ULL, 0x65fea435ULL},
+{0xafe76378ULL, 0xeedc21ccULL, 0x2a5fe04eULL, 0xdf6c1e0bULL, 0xea7b52c8ULL, 0xeedc21ccULL, 0x151c1711ULL, 0x451fda61ULL, 0xea7b52c8ULL},
+{0xeeb34aa1ULL, 0xa4c601acULL, 0x5bbc1ef8ULL, 0x52e6642cULL, 0xc248b2cfULL, 0xa4c601acULL, 0xdd613091ULL, 0x7f5de33dULL, 0xc248b2cfULL},
+{0xe0f1f198ULL, 0x6896baa3ULL, 0x378bb0afULL, 0x1422a304ULL, 0x4d65eebULL, 0x6896baa3ULL, 0x1b1ab5c1ULL, 0xa29eea30ULL, 0x4d65eebULL},
+{0xfe6c101dULL, 0x191725f1ULL, 0x1550049dULL, 0x1596ec61ULL, 0x296e1c1dULL, 0x191725f1ULL, 0xfacdb7f4ULL, 0x36c84779ULL, 0x296e1c1dULL},
+{0xc4852f44ULL, 0xb5c12660ULL, 0xe42eb87cULL, 0x5f1abd87ULL, 0xe0f9c2ccULL, 0xb5c12660ULL, 0x89325590ULL, 0x520a2a7ULL, 0xe0f9c2ccULL},
+{0x6d205bbbULL, 0x2a7ea3b0ULL, 0x4c0889b9ULL, 0x7e055b11ULL, 0x1dca89aeULL, 0x2a7ea3b0ULL, 0x4f33daffULL, 0x9323745cULL, 0x1dca89aeULL},
+{0x9d5e207aULL, 0x4d764e68ULL, 0x107bb689ULL, 0x13c9cc9fULL, 0xec2a1c2bULL, 0x4d764e68ULL, 0xac106c3cULL, 0x66f4dbffULL, 0xec2a1c2bULL},
+{0xeaa88553ULL, 0xf1b09000ULL, 0x39db2faaULL, 0xd79c0f16ULL, 0x16418736ULL, 0xf1b09000ULL, 0x59948b4fULL, 0x5167bc27ULL, 0x16418736ULL},
+{0x3ca02c1dULL, 0x390c25f6ULL, 0x63c2175bULL, 0x3753e863ULL, 0xce1c43e4ULL, 0x390c25f6ULL, 0xd451dd8ULL, 0x450b1d53ULL, 0xce1c43e4ULL},
+{0x105f2c8fULL, 0x6b249dfaULL, 0x3c346278ULL, 0x945ea8c9ULL, 0xf91d8f5ULL, 0x6b249dfaULL, 0x8dcf100ULL, 0x697f939eULL, 0xf91d8f5ULL},
+{0x614bf6b5ULL, 0xf3e7d7feULL, 0xc597a7e3ULL, 0x587ae85bULL, 0x1b4d22acULL, 0xf3e7d7feULL, 0xab0da795ULL, 0x3eab5e79ULL, 0x1b4d22acULL},
+{0x8d24d34aULL, 0xeccce7b4ULL, 0x6e36b9e2ULL, 0x4b357333ULL, 0x6d5dfd83ULL, 0xeccce7b4ULL, 0x4372596bULL, 0x1b90930dULL, 0x6d5dfd83ULL},
+{0xf0221daaULL, 0x7bf13d6dULL, 0x8be224bbULL, 0x73494a32ULL, 0x5a4f5edeULL, 0x7bf13d6dULL, 0x32d28c56ULL, 0x6e49a765ULL, 0x5a4f5edeULL},
+{0x74c90856ULL, 0x5f6d1825ULL, 0x18f85c89ULL, 0xd589a541ULL, 0x3a6f510bULL, 0x5f6d1825ULL, 0x50c4c59aULL, 0x173437baULL, 0x3a6f510bULL},
+{0x3825a5f6ULL, 0x1a5c3eddULL, 0xff644ef2ULL, 0xfab040ddULL, 0xd9cb5473ULL, 0x1a5c3eddULL, 0x49eba74fULL, 0xb263d5e8ULL, 0xd9cb5473ULL},
+{0xad253974ULL, 0x6699102ULL, 0x70b515d4ULL, 0x537e14baULL, 0x3f41b74dULL, 0x6699102ULL, 0xa0bd169cULL, 0xa4a98497ULL, 0x3f41b74dULL},
+{0x375cf952ULL, 0x91c5bc00ULL, 0xed893b54ULL, 0x868a6231ULL, 0x68d29f3dULL, 0x91c5bc00ULL, 0x740563b0ULL, 0xe98d4360ULL, 0x68d29f3dULL},
+{0x11c024fdULL, 0xd9771870ULL, 0x8546fc71ULL, 0x4c6bb14bULL, 0x14c7a99dULL, 0xd9771870ULL, 0x3446e0cULL, 0x600a5ffbULL, 0x14c7a99dULL},
+{0xdbf9b84ULL, 0xdce9fd19ULL, 0x31dc96ffULL, 0xbab9f1d4ULL, 0x6896e84aULL, 0xdce9fd19ULL, 0xfb205149ULL, 0xab7fd40dULL, 0x6896e84aULL},
+{0x7034b0eeULL, 0x92c487f3ULL, 0x9d195321ULL, 0x68c7eb4aULL, 0x27a943feULL, 0x92c487f3ULL, 0x6ecb4828ULL, 0xc25b980eULL, 0x27a943feULL},
+{0x4cbafd13ULL, 0x1a048c0eULL, 0x8d62cf9eULL, 0xd53be533ULL, 0x1ce10089ULL, 0x1a048c0eULL, 0x2ec52ab4ULL, 0x517d7704ULL, 0x1ce10089ULL},
+{0x86720cdaULL, 0x313e033dULL, 0xd7601276ULL, 0xa420bf96ULL, 0xb084990ULL, 0x313e033dULL, 0x71cf576eULL, 0xc2606160ULL, 0xb084990ULL},
+{0xf316c69bULL, 0xff84f00fULL, 0xc3dee205ULL, 0x70f2168ULL, 0xac249caaULL, 0xff84f00fULL, 0x54984f92ULL, 0x7ac45ddcULL, 0xac249caaULL},
+{0xd7402bc9ULL, 0xa3dc710bULL, 0xdc178a5aULL, 0x60f6be4dULL, 0xa03d5433ULL, 0xa3dc710bULL, 0x3bbc97e3ULL, 0x4ec06978ULL, 0xa03d5433ULL},
+{0x4a391e87ULL, 0xdbf3b2ecULL, 0xa7914a0aULL, 0x4c10dfd1ULL, 0x9fd78927ULL, 0xdbf3b2ecULL, 0xc3b5c7a8ULL, 0x777fd473ULL, 0x9fd78927ULL},
+{0x314701b6ULL, 0x1455e662ULL, 0x6684b131ULL, 0xc580a3eULL, 0xfc1cf152ULL, 0x1455e662ULL, 0x3a29d9cfULL, 0x743f5e9cULL, 0xfc1cf152ULL},
+{0x37e8bb42ULL, 0xe72c51caULL, 0xe70878c5ULL, 0xd1a0e2dbULL, 0x5c139603ULL, 0xe72c51caULL, 0x5b36f6a8ULL, 0xb566a248ULL, 0x5c139603ULL},
+{0x94bbcf2ULL, 0x85b12c2fULL, 0x11faedaaULL, 0x6ca69a22ULL, 0xa4270b1eULL, 0x85b12c2fULL, 0xb1bc7859ULL, 0xa00b1accULL, 0xa4270b1eULL},
+{0xb8af855fULL, 0x8827f24ULL, 0xb51b2915ULL, 0xf22bf79dULL, 0x62bc0318ULL, 0x8827f24ULL, 0x69079d3aULL, 0xa92f091eULL, 0x62bc0318ULL},
+{0x907921e5ULL, 0x11adb2b5ULL, 0xd06914e3ULL, 0x883cde47ULL, 0xe525808cULL, 0x11adb2b5ULL, 0xd1c909d5ULL, 0x19d92902ULL, 0xe525808cULL},
+{0x7f572025ULL, 0xa5abe932ULL, 0x1102398ULL, 0x71233169ULL, 0xe178c9c9ULL, 0xa5abe932ULL, 0xc7b31945ULL, 0x765be6deULL, 0xe178c9c9ULL},
+{0x1d1c81c1ULL, 0xb40bf488ULL, 0x3110c4edULL, 0x2372f91eULL, 0x41c229b2ULL, 0xb40bf488ULL, 0xf3e61070ULL, 0x6aeef6caULL, 0x41c229b2ULL},
+{0xc76a49eeULL, 0x6339cc72ULL, 0xeb402940ULL, 0x466d3177ULL, 0x8dee6b97ULL, 0x6339cc72ULL, 0x414aba01ULL, 0xdfa77d0bULL, 0x8dee6b97ULL},
+{0x4c0c2928ULL, 0x26b5d661ULL, 0x9c812f2bULL, 0x7f6ad6b4ULL, 0xa1aa12e5ULL, 0x26b5d661ULL, 0x186b2538ULL, 0xd052485eULL, 0xa1aa12e5ULL},
+{0x38c36f43ULL, 0x9aa68e89ULL, 0x4022959fULL, 0x27bc49a2ULL, 0xee898b0aULL, 0x9aa68e89ULL, 0xfc329ea3ULL, 0x6cdebda2ULL, 0xee898b0aULL},
+{0x40661509ULL, 0x801cd68dULL, 0x3f933b1dULL, 0x8affb2efULL, 0xc4b81afaULL, 0x801cd68dULL, 0x3b6be90fULL, 0x3354aec3ULL, 0xc4b81afaULL},
+{0x2079408dULL, 0xaa5d2695ULL, 0xba154b8bULL, 0xf91b247bULL, 0xd880ee35ULL, 0xaa5d2695ULL, 0x91b5b9c1ULL, 0xdd58f853ULL, 0xd880ee35ULL},
+{0x398ed807ULL, 0x7f11755aULL, 0xc4b23421ULL, 0xd60e1921ULL, 0xca2700e3ULL, 0x7f11755aULL, 0xe9db4522ULL, 0xa8752c3ULL, 0xca2700e3ULL},
+{0x3e0e64b5ULL, 0x2f14b9acULL, 0xc7bdb3bfULL, 0xdf3fad56ULL, 0x461aef80ULL, 0x2f14b9acULL, 0x31f1523ULL, 0x45ac750bULL, 0x461aef80ULL},
+{0xaa010794ULL, 0x442cac0bULL, 0x29de2fdeULL, 0x390241e0ULL, 0x5910297bULL, 0x442cac0bULL, 0xbd238379ULL, 0xea9c2deaULL, 0x5910297bULL},
+{0x853c59dbULL, 0x32f5bda5ULL, 0xf1b9cb9dULL, 0x21f681f5ULL, 0xbc60710dULL, 0x32f5bda5ULL, 0xafeadfeeULL, 0xe0f82038ULL, 0xbc60710dULL},
+{0x8b7d0773ULL, 0xb6e36e9dULL, 0x228faaf2ULL, 0xe8532a93ULL, 0x71fd11fdULL, 0xb6e36e9dULL, 0x88b30491ULL, 0x82843218ULL, 0x71fd11fdULL},
+{0x4925d110ULL, 0xe86bf95eULL, 0x70e35db0ULL, 0xccd8598dULL, 0xc0f5588ULL, 0xe86bf95eULL, 0xff0223a5ULL, 0xb5fa46c8ULL, 0xc0f5588ULL},
+{0xb5f2d2efULL, 0x8f8a91bcULL, 0xb5421163ULL, 0xa1f3443cULL, 0xa72ade01ULL, 0x8f8a91bcULL, 0x2e6f320aULL, 0x6a47f133ULL, 0xa72ade01ULL},
+{0xc71d1e42ULL, 0x2be4264cULL, 0x56f79b6dULL, 0xf7feca3eULL, 0xf1300180ULL, 0x2be4264cULL, 0xa5e21aa8ULL, 0xd2a1d152ULL, 0xf1300180ULL},
+{0xe78c72a2ULL, 0x3e434aaeULL, 0x7f7b4a51ULL, 0xb227669dULL, 0xb43691a2ULL, 0x3e434aaeULL, 0x5afb9a83ULL, 0x6d04f3d0ULL, 0xb43691a2ULL},
+{0x5f5db3afULL, 0xd1c09fcbULL, 0x9b4c43bcULL, 0xf13259aULL, 0x9872a890ULL, 0xd1c09fcbULL, 0xa8f83e4dULL, 0x4ad0dbfULL, 0x9872a890ULL},
+{0x165fa683ULL, 0xe07105e7ULL, 0xf8b0571bULL, 0xc1218061ULL, 0xf224195dULL, 0xe07105e7ULL, 0xc9b91286ULL, 0xebdad32eULL, 0xf224195dULL},
+{0xf5d8b3c2ULL, 0xfbe4a138ULL, 0x792b26d1ULL, 0x82105506ULL, 0x7075f4eULL, 0xfbe4a138ULL, 0x2d0b5406ULL, 0x73843e9dULL, 0x7075f4eULL},
+{0x9244c17bULL, 0x1e1490a3ULL, 0x55e84eb5ULL, 0x24b295abULL, 0x542c9647ULL, 0x1e1490a3ULL, 0x676d45caULL, 0x9f1d3eb9ULL, 0x542c9647ULL},
+{0x4d987997ULL, 0xce79e3cdULL, 0xbc9fe292ULL, 0xb3a009b3ULL, 0xa9af6631ULL, 0xce79e3cdULL, 0x6a22f785ULL, 0x8b616e35ULL, 0xa9af6631ULL},
+{0x99756cb6ULL, 0xfd557937ULL, 0x574fb175ULL, 0x47b069edULL, 0x4c05d263ULL, 0xfd557937ULL, 0x4f7565abULL, 0xb976b993ULL, 0x4c05d263ULL},
+{0x52333451ULL, 0x49d533baULL, 0x73865089ULL, 0x31b9f6b8ULL, 0x6950034cULL, 0x49d533baULL, 0x5e2925b2ULL, 0xf503eca5ULL, 0x6950034cULL},
+{0x27aa15d2ULL, 0x7294ce99ULL, 0xf8208611ULL, 0xdeb649d4ULL, 0xe7670eccULL, 0x7294ce99ULL, 0xd1975ed3ULL, 0x9be9ce1bULL, 0xe7670eccULL},
+{0xb3c83201ULL, 0x5b4ffe9cULL, 0x21379bbbULL, 0x2c58b9dcULL, 0xe7b5ca0eULL, 0x5b4ffe9cULL, 0xed19c315ULL, 0x438ce3aeULL, 0xe7b5ca0eULL},
+{0x7843c622ULL, 0xc73ccf6dULL, 0xa186bc57ULL, 0x4a4a0785ULL, 0x5f5d624cULL, 0xc73ccf6dULL, 0x5bc1c9d1ULL, 0xda6223ffULL, 0x5f5d624cULL},
+{0xb80fd090ULL, 0x40268999ULL, 0x11bf1d6bULL, 0x5c48d15eULL, 0x4d950578ULL, 0x40268999ULL, 0x40d93b11ULL, 0xbb7de222ULL, 0x4d950578ULL},
+{0x5d7f7ee0ULL, 0xf1cc1670ULL, 0xe4895f75ULL, 0xeff469ddULL, 0xf81cfbe9ULL, 0xf1cc1670ULL, 0xd8047f6aULL, 0xead3120bULL, 0xf81cfbe9ULL},
+{0xb9119ba4ULL, 0x2940ea99ULL, 0xb068d1a9ULL, 0xc92448b7ULL, 0xebc50ec6ULL, 0x2940ea99ULL, 0xc63a9251ULL, 0x37523c4aULL, 0xebc50ec6ULL},
+{0xf23fdc59ULL, 0xcccc7591ULL, 0xfcda9a8cULL, 0x4c9ad393ULL, 0xe5887474ULL, 0xcccc7591ULL, 0xc8a9d6a5ULL, 0xe511788ULL, 0xe5887474ULL},
+{0x8020eee5ULL, 0xc5b77e48ULL, 0x4d6cde7eULL, 0x6aae23d1ULL, 0xb5d44583ULL, 0xc5b77e48ULL, 0x7e2a4529ULL, 0x121c0beULL, 0xb5d44583ULL},
+{0xaaba0602ULL, 0x8817360cULL, 0x43e61088ULL, 0x346155bbULL, 0x2a51ae41ULL, 0x8817360cULL, 0x973028a5ULL, 0x3a158740ULL, 0x2a51ae41ULL},
+{0xfa3bf526ULL, 0xe5b1ceacULL, 0xafaa9c17ULL, 0xd00ff208ULL, 0x7a0a9fd7ULL, 0xe5b1ceacULL, 0xd3d9bc42ULL, 0x220321a3ULL, 0x7a0a9fd7ULL},
+{0xdb2fbe4bULL, 0x697c28d6ULL, 0x493d5503ULL, 0x1c2c2b91ULL, 0x7ad01b1ULL, 0x697c28d6ULL, 0xe24b0fc2ULL, 0x5d052a03ULL, 0x7ad01b1ULL},
+{0xd399bce9ULL, 0x568d90f7ULL, 0x9cc02a04ULL, 0x640d5811ULL, 0xff270557ULL, 0x568d90f7ULL, 0xc57bc84eULL, 0x7c367298ULL, 0xff270557ULL},
+{0x6afa41aaULL, 0x273ceb0aULL, 0x400a6518ULL, 0x65ceca15ULL, 0xfd02e38ULL, 0x273ceb0aULL, 0xc7909d9ULL, 0xba5d9bb8ULL, 0xfd02e38ULL},
+{0xede21f1bULL, 0x198b99ffULL, 0x24007c69ULL, 0x5b891849ULL, 0xc8d373d4ULL, 0x198b99ffULL, 0x5dfacfa4ULL, 0x8f7b6dc7ULL, 0xc8d373d4ULL},
+{0xf23041ccULL, 0x39ec398fULL, 0xade43bb5ULL, 0xc7e533ddULL, 0x183e8812ULL, 0x39ec398fULL, 0xfcc561cULL, 0xdde47518ULL, 0x183e8812ULL},
+{0x19d3b59fULL, 0x598871aeULL, 0x5735f24aULL, 0xc93c7683ULL, 0x61cb2710ULL, 0x598871aeULL, 0x6aead809ULL, 0x61e578b1ULL, 0x61cb2710ULL},
+{0x871f1c73ULL, 0xe4b5dbaaULL, 0x3e49646aULL, 0xe3310217ULL, 0xe98bd1d8ULL, 0xe4b5dbaaULL, 0x9f8aa2cfULL, 0x3a43b2e6ULL, 0xe98bd1d8ULL},
+{0x5c308328ULL, 0x3f1b8886ULL, 0x8186718bULL, 0xe8d7ea45ULL, 0x7f2f2fc4ULL, 0x3f1b8886ULL, 0x4a25b6e0ULL, 0xdee516dfULL, 0x7f2f2fc4ULL},
+{0x56727b03ULL, 0xf68ed4cbULL, 0xeceee5aULL, 0x6c25636fULL, 0x737fb521ULL, 0xf68ed4cbULL, 0x192e7eceULL, 0x26a3c247ULL, 0x737fb521ULL},
+{0x50cd97fULL, 0xcb65c095ULL, 0x7cbf97c2ULL, 0x76a15505ULL, 0x7205d6d1ULL, 0xcb65c095ULL, 0x40108a3bULL, 0xd135d777ULL, 0x7205d6d1ULL},
+{0x76c093d6ULL, 0xd82f1b5aULL, 0x96122780ULL, 0x751f8df3ULL, 0x78309015ULL, 0xd82f1b5aULL, 0x7884ce25ULL, 0x630de0bULL, 0x78309015ULL},
+{0xed5d3644ULL, 0x401e8a0eULL, 0x7da0c5b4ULL, 0xd44ff333ULL, 0x1a387a6ULL, 0x401e8a0eULL, 0x32722bdcULL, 0xe76e4048ULL, 0x1a387a6ULL},
+{0x4fa23251ULL, 0xef560155ULL, 0x1f6de19fULL, 0x96e1b9baULL, 0x67f04293ULL, 0xef560155ULL, 0x6c2465c5ULL, 0x22e9ab7eULL, 0x67f04293ULL},
+{0xd8e220fdULL, 0x71f20836ULL, 0xba8157c6ULL, 0x57ea224bULL, 0x9e3199f4ULL, 0x71f20836ULL, 0x769deec9ULL, 0xf144d90fULL, 0x9e3199f4ULL},
+{0xb33e92efULL, 0x8ba437ffULL, 0xf6cf172aULL, 0x2a1cedabULL, 0xaa3868ebULL, 0x8ba437ffULL, 0x81274df0ULL, 0x575a4170ULL, 0xaa3868ebULL},
+{0x7bbf6fULL, 0x27f886fdULL, 0xa6148cc4ULL, 0x51f32087ULL, 0x11482dadULL, 0x27f886fdULL, 0x2fc514c0ULL, 0xa9d6e6f0ULL, 0x11482dadULL},
+{0xc6bc3ebdULL, 0x818ce236ULL, 0x65eb494bULL, 0xca52b367ULL, 0x15fc2c5dULL, 0x818ce236ULL, 0x3d9ec4ceULL, 0xdaba5c41ULL, 0x15fc2c5dULL},
+{0xfe15ef39ULL, 0xed81f021ULL, 0xbce608f5ULL, 0xe54e2157ULL, 0xbfb9d596ULL, 0xed81f021ULL, 0xc1278be3ULL, 0xe115f072ULL, 0xbfb9d596ULL},
+{0xbec94690ULL, 0xfe6b9870ULL, 0x288072aULL, 0x6c0684cfULL, 0x8444304fULL, 0xfe6b9870ULL, 0xbd3b32c2ULL, 0x62b95ba6ULL, 0x8444304fULL},
+{0xd6af6484ULL, 0x3147710eULL, 0x42302711ULL, 0x7e9be20cULL, 0x9b236a4cULL, 0x3147710eULL, 0xcd24b481ULL, 0x8d66583cULL, 0x9b236a4cULL},
+{0x9aabdc82ULL, 0x7bb7e2e6ULL, 0x9706a6e3ULL, 0xd8181c9aULL, 0xff981629ULL, 0x7bb7e2e6ULL, 0xb4606b83ULL, 0x7c672e1dULL, 0xff981629ULL},
+{0x6e1b247fULL, 0x797374f5ULL, 0xcd4adadULL, 0x22df7f5eULL, 0x2a45aa17ULL, 0x797374f5ULL, 0xa257288ULL, 0xc27b6455ULL, 0x2a45aa17ULL},
+{0x89513d37ULL, 0x3b39dc8aULL, 0xb6ca18b4ULL, 0xf4216d42ULL, 0x8735f851ULL, 0x3b39dc8aULL, 0xbbc74e84ULL, 0x834e16dbULL, 0x8735f851ULL},
+{0xa3589af6ULL, 0x13e9519eULL, 0x2b6033dfULL, 0xed9b07d0ULL, 0x97ba74d4ULL, 0x13e9519eULL, 0x7464ebdeULL, 0xdc108a19ULL, 0x97ba74d4ULL},
+{0xd9560e78ULL, 0xb335286dULL, 0xbaafe16aULL, 0xa381576bULL, 0x5047b1d4ULL, 0xb335286dULL, 0x26cd6ceaULL, 0x9e7697cbULL, 0x5047b1d4ULL},
+{0xfea23903ULL, 0x9f7146deULL, 0xda3256bfULL, 0xacf790d7ULL, 0x40172a52ULL, 0x9f7146deULL, 0x909ff6a4ULL, 0x86995eb4ULL, 0x40172a52ULL},
+{0x20676f19ULL, 0x7d02db76ULL, 0xce866855ULL, 0x8fc06dbaULL, 0xf635247ULL, 0x7d02db76ULL, 0x5a5d3aa5ULL, 0x95f043adULL, 0xf635247ULL},
+{0xe23766d0ULL, 0x6a7d3d34ULL, 0xb4ad7602ULL, 0x23f8f83ULL, 0x1ef806d8ULL, 0x6a7d3d34ULL, 0x9f63f266ULL, 0x1e19fe1fULL, 0x1ef806d8ULL},
+{0x57a4d3bbULL, 0xa0c6ff1ULL, 0x6ae67028ULL, 0x3be40721ULL, 0x7de4e4e4ULL, 0xa0c6ff1ULL, 0x13ee9319ULL, 0xf2d4b862ULL, 0x7de4e4e4ULL},
+{0xd0abb9bcULL, 0x27fdd882ULL, 0x9e360b67ULL, 0x37c3fc78ULL, 0x5b560ea6ULL, 0x27fdd882ULL, 0x64c82856ULL, 0x773a0f9fULL, 0x5b560ea6ULL},
+{0xe2430030ULL, 0xe633ba14ULL, 0x46ca0dc2ULL, 0xfff35af8ULL, 0xae172d6fULL, 0xe633ba14ULL, 0xa0c7160bULL, 0xcc595a31ULL, 0xae172d6fULL},
+{0xf5938183ULL, 0x72948b9cULL, 0x1e421335ULL, 0x696389d7ULL, 0x1f779e99ULL, 0x72948b9cULL, 0xe48fd5fULL, 0x8be8156cULL, 0x1f779e99ULL},
+{0x1a0f4c94ULL, 0xac0f339cULL, 0x94d69efcULL, 0xd5703002ULL, 0x5a56d29dULL, 0xac0f339cULL, 0xb2c3a20ULL, 0xc385204eULL, 0x5a56d29dULL},
+{0x5c46ca92ULL, 0xf56a865ULL, 0xec287e9bULL, 0x243b42a5ULL, 0x148277fULL, 0xf56a865ULL, 0x624b64b8ULL, 0x1aedf022ULL, 0x148277fULL},
+{0x2614fa2aULL, 0x9924356bULL, 0x9ed982efULL, 0x3554672ULL, 0xa67c9060ULL, 0x9924356bULL, 0x6483a43fULL, 0xe44778a7ULL, 0xa67c9060ULL},
+{0xf0ee447dULL, 0x938717beULL, 0x6b25a875ULL, 0x284e3cebULL, 0x1140e26dULL, 0x938717beULL, 0x9020c119ULL, 0x6c01dabaULL, 0x1140e26dULL},
+{0x1165d190ULL, 0xfd02a836ULL, 0x4ea5cf9fULL, 0x18f1279aULL, 0x888c45f8ULL, 0xfd02a836ULL, 0xcf507093ULL, 0xde40e836ULL, 0x888c45f8ULL},
+{0x65c5a20dULL, 0x5b56313eULL, 0x2f92159ULL, 0x43b11210ULL, 0x7909f5a6ULL, 0x5b56313eULL, 0x414c2639ULL, 0x17b3eb6fULL, 0x7909f5a6ULL},
+{0xb8020d6bULL, 0xff958f6fULL, 0x608dec52ULL, 0x4af491cdULL, 0xcd67cc69ULL, 0xff958f6fULL, 0xb281f864ULL, 0xbfbdbb65ULL, 0xcd67cc69ULL},
+{0xc6125974ULL, 0xa39a23ebULL, 0x49f6aa6fULL, 0x65c1c9acULL, 0x39f1b87bULL, 0xa39a23ebULL, 0x6da6da57ULL, 0x5b470a0bULL, 0x39f1b87bULL},
+{0xd848f8cdULL, 0x27ba15a6ULL, 0x5c2c541cULL, 0x3bfe9660ULL, 0xd041f93eULL, 0x27ba15a6ULL, 0xa61033dcULL, 0x3ef1d75cULL, 0xd041f93eULL},
+{0x7b4d715dULL, 0x36478644ULL, 0xcf6f04dfULL, 0xfcf6b70cULL, 0x3d4f5139ULL, 0x36478644ULL, 0x3e8d27c6ULL, 0x7e5e8b7cULL, 0x3d4f5139ULL},
+{0x878cba83ULL, 0x8f885dc4ULL, 0xdf2362f7ULL, 0x1d360626ULL, 0x3a043bd7ULL, 0x8f885dc4ULL, 0x6f2370d5ULL, 0xb70fb1cdULL, 0x3a043bd7ULL},
+{0xfff701afULL, 0xf188379ULL, 0xec80f008ULL, 0x94ef4b7ULL, 0xd2d9d6eeULL, 0xf188379ULL, 0x273df669ULL, 0xfb48e41ULL, 0xd2d9d6eeULL},
+{0x89f1f31aULL, 0x754670d3ULL, 0x2abdf901ULL, 0xd4ac4b87ULL, 0x68f91beULL, 0x754670d3ULL, 0x8c37d980ULL, 0x687010b8ULL, 0x68f91beULL},
+{0xe8d84376ULL, 0xca5dda16ULL, 0x86c4f9b3ULL, 0xd018df25ULL, 0xf5c72f93ULL, 0xca5dda16ULL, 0xe3da7813ULL, 0x3af280d0ULL, 0xf5c72f93ULL},
+{0x7b58ce6eULL, 0x2b148350ULL, 0xd7ace5a1ULL, 0x42f08f08ULL, 0x5a562bb5ULL, 0x2b148350ULL, 0x43be8861ULL, 0x2ce15e7dULL, 0x5a562bb5ULL},
+{0xbb1c4d17ULL, 0x9d7ca1a9ULL, 0x2e5fcd9cULL, 0x268a06c1ULL, 0x5590bd79ULL, 0x9d7ca1a9ULL, 0xe98ee4adULL, 0xb69f5d5fULL, 0x5590bd79ULL},
+{0xaeb6c397ULL, 0xc99f9098ULL, 0x6ec90b62ULL, 0x3aa8d181ULL, 0x3facc66eULL, 0xc99f9098ULL, 0xe138d815ULL, 0x47f34ef8ULL, 0x3facc66eULL},
+{0x668189f8ULL, 0xa9427952ULL, 0xfdaf4877ULL, 0x4cf488a4ULL, 0x4a52af62ULL, 0xa9427952ULL, 0x7cb07f72ULL, 0x1f4b12c2ULL, 0x4a52af62ULL},
+{0xff5dfc94ULL, 0x21b454a8ULL, 0x975a7f5cULL, 0x9cf03255ULL, 0x1b72042cULL, 0x21b454a8ULL, 0x4449315dULL, 0xfc813f0dULL, 0x1b72042cULL},
+{0xd8a2956cULL, 0xf2b7a1b7ULL, 0x989bd8f8ULL, 0x477307beULL, 0x49b0f616ULL, 0xf2b7a1b7ULL, 0xfe0cea10ULL, 0xe3da7404ULL, 0x49b0f616ULL},
+{0x5f834a3fULL, 0x2b73332cULL, 0x1b634292ULL, 0x9bad74b1ULL, 0xdd18107ULL, 0x2b73332cULL, 0xeb08a42dULL, 0x6d0af962ULL, 0xdd18107ULL},
+{0xb26289f2ULL, 0xa5b8bccfULL, 0x3b374a8bULL, 0x87ab59bcULL, 0x354d3960ULL, 0xa5b8bccfULL, 0x1b032bffULL, 0x41d05900ULL, 0x354d3960ULL}}
+};
+
+const uint64_t A2gj256i[MRG32K3A_JUMP_NDIGIT][255][9] = {
+  {{0x0ULL, 0x1ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL},
+{0x0ULL, 0x0ULL, 0x1ULL, 0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL},
+{0xffeabcdeULL, 0x0ULL, 0x80cfcULL, 0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL, 0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL},
+{0xa1507fe7ULL, 0xffeabcdeULL, 0xd07ee950ULL, 0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL, 0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL},
+{0x555359e8ULL, 0xa1507fe7ULL, 0xc39b989fULL, 0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL, 0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL},
+{0x5d262a2ULL, 0x555359e8ULL, 0x63bf3822ULL, 0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL, 0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL},
+{0x9fbeba87ULL, 0x5d262a2ULL, 0x55471f12ULL, 0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL, 0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL},
+{0xcb0106d9ULL, 0x9fbeba87ULL, 0x3541e15bULL, 0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL, 0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL},
+{0xf08375a6ULL, 0xcb0106d9ULL, 0xc3842faaULL, 0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL, 0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL},
+{0x9c5d7ff0ULL, 0xf08375a6ULL, 0x158f633cULL, 0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL, 0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL},
+{0x83f9e1f1ULL, 0x9c5d7ff0ULL, 0x38b7319aULL, 0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL, 0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL},
+{0xd00f7ee4ULL, 0x83f9e1f1ULL, 0x330e804fULL, 0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL, 0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL},
+{0x3f2effe5ULL, 0xd00f7ee4ULL, 0x611d9f1ULL, 0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL, 0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL},
+{0x502281feULL, 0x3f2effe5ULL, 0x806badf6ULL, 0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL, 0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL},
+{0xe1f2a127ULL, 0x502281feULL, 0x8d8c01f7ULL, 0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL, 0x6c4f4699ULL, 0x30c751b6ULL, 0xc600cb66ULL},
+{0x30c751b6ULL, 0xe1f2a127ULL, 0xd323e1adULL, 0x6c4f4699ULL, 0x30c751b6ULL, 0xc600cb66ULL, 0xd03a3c1aULL, 0x6c4f4699ULL, 0xaa26943dULL},
+{0x6c4f4699ULL, 0x30c751b6ULL, 0xc600cb66ULL, 0xd03a3c1aULL, 0x6c4f4699ULL, 0xaa26943dULL, 0x922352baULL, 0xd03a3c1aULL, 0x38d15dddULL},
+{0xd03a3c1aULL, 0x6c4f4699ULL, 0xaa26943dULL, 0x922352baULL, 0xd03a3c1aULL, 0x38d15dddULL, 0x71338f9eULL, 0x922352baULL, 0x1d23864cULL},
+{0x922352baULL, 0xd03a3c1aULL, 0x38d15dddULL, 0x71338f9eULL, 0x922352baULL, 0x1d23864cULL, 0x30a92de6ULL, 0x71338f9eULL, 0x6f94cf3dULL},
+{0x71338f9eULL, 0x922352baULL, 0x1d23864cULL, 0x30a92de6ULL, 0x71338f9eULL, 0x6f94cf3dULL, 0xdd697fb8ULL, 0x30a92de6ULL, 0xf48e5b3aULL},
+{0x30a92de6ULL, 0x71338f9eULL, 0x6f94cf3dULL, 0xdd697fb8ULL, 0x30a92de6ULL, 0xf48e5b3aULL, 0x380d3563ULL, 0xdd697fb8ULL, 0x2171338fULL},
+{0xdd697fb8ULL, 0x30a92de6ULL, 0xf48e5b3aULL, 0x380d3563ULL, 0xdd697fb8ULL, 0x2171338fULL, 0x1e4a5e0fULL, 0x380d3563ULL, 0x119dbaedULL},
+{0x380d3563ULL, 0xdd697fb8ULL, 0x2171338fULL, 0x1e4a5e0fULL, 0x380d3563ULL, 0x119dbaedULL, 0x20b76c90ULL, 0x1e4a5e0fULL, 0xfcf08e49ULL},
+{0x1e4a5e0fULL, 0x380d3563ULL, 0x119dbaedULL, 0x20b76c90ULL, 0x1e4a5e0fULL, 0xfcf08e49ULL, 0x607eab87ULL, 0x20b76c90ULL, 0x9a225972ULL},
+{0x20b76c90ULL, 0x1e4a5e0fULL, 0xfcf08e49ULL, 0x607eab87ULL, 0x20b76c90ULL, 0x9a225972ULL, 0x4bf6fe8cULL, 0x607eab87ULL, 0xf2fee381ULL},
+{0x607eab87ULL, 0x20b76c90ULL, 0x9a225972ULL, 0x4bf6fe8cULL, 0x607eab87ULL, 0xf2fee381ULL, 0x8ab40ec2ULL, 0x4bf6fe8cULL, 0x4c46b844ULL},
+{0x4bf6fe8cULL, 0x607eab87ULL, 0xf2fee381ULL, 0x8ab40ec2ULL, 0x4bf6fe8cULL, 0x4c46b844ULL, 0x37a8f479ULL, 0x8ab40ec2ULL, 0x4a7a6225ULL},
+{0x8ab40ec2ULL, 0x4bf6fe8cULL, 0x4c46b844ULL, 0x37a8f479ULL, 0x8ab40ec2ULL, 0x4a7a6225ULL, 0x86fa8a03ULL, 0x37a8f479ULL, 0x7a04e6f5ULL},
+{0x37a8f479ULL, 0x8ab40ec2ULL, 0x4a7a6225ULL, 0x86fa8a03ULL, 0x37a8f479ULL, 0x7a04e6f5ULL, 0xae8fa4a9ULL, 0x86fa8a03ULL, 0x1d8580a2ULL},
+{0x86fa8a03ULL, 0x37a8f479ULL, 0x7a04e6f5ULL, 0xae8fa4a9ULL, 0x86fa8a03ULL, 0x1d8580a2ULL, 0x1db94a63ULL, 0xae8fa4a9ULL, 0x305d9cd7ULL},
+{0xae8fa4a9ULL, 0x86fa8a03ULL, 0x1d8580a2ULL, 0x1db94a63ULL, 0xae8fa4a9ULL, 0x305d9cd7ULL, 0x69eb70a0ULL, 0x1db94a63ULL, 0x1c9021b7ULL},
+{0x1db94a63ULL, 0xae8fa4a9ULL, 0x305d9cd7ULL, 0x69eb70a0ULL, 0x1db94a63ULL, 0x1c9021b7ULL, 0xb6495839ULL, 0x69eb70a0ULL, 0x5b16dd4bULL},
+{0x69eb70a0ULL, 0x1db94a63ULL, 0x1c9021b7ULL, 0xb6495839ULL, 0x69eb70a0ULL, 0x5b16dd4bULL, 0xabb23272ULL, 0xb6495839ULL, 0x10ddb1e7ULL},
+{0xb6495839ULL, 0x69eb70a0ULL, 0x5b16dd4bULL, 0xabb23272ULL, 0xb6495839ULL, 0x10ddb1e7ULL, 0x48a6172eULL, 0xabb23272ULL, 0x736cc5caULL},
+{0xabb23272ULL, 0xb6495839ULL, 0x10ddb1e7ULL, 0x48a6172eULL, 0xabb23272ULL, 0x736cc5caULL, 0x9d879695ULL, 0x48a6172eULL, 0xd664c614ULL},
+{0x48a6172eULL, 0xabb23272ULL, 0x736cc5caULL, 0x9d879695ULL, 0x48a6172eULL, 0xd664c614ULL, 0x9da230b7ULL, 0x9d879695ULL, 0x97a40306ULL},
+{0x9d879695ULL, 0x48a6172eULL, 0xd664c614ULL, 0x9da230b7ULL, 0x9d879695ULL, 0x97a40306ULL, 0x424f2a06ULL, 0x9da230b7ULL, 0x5505405cULL},
+{0x9da230b7ULL, 0x9d879695ULL, 0x97a40306ULL, 0x424f2a06ULL, 0x9da230b7ULL, 0x5505405cULL, 0x5faa7561ULL, 0x424f2a06ULL, 0x7f611b6eULL},
+{0x424f2a06ULL, 0x9da230b7ULL, 0x5505405cULL, 0x5faa7561ULL, 0x424f2a06ULL, 0x7f611b6eULL, 0xe1a8f632ULL, 0x5faa7561ULL, 0x743939ceULL},
+{0x5faa7561ULL, 0x424f2a06ULL, 0x7f611b6eULL, 0xe1a8f632ULL, 0x5faa7561ULL, 0x743939ceULL, 0xc14cb69dULL, 0xe1a8f632ULL, 0x8b6d6699ULL},
+{0xe1a8f632ULL, 0x5faa7561ULL, 0x743939ceULL, 0xc14cb69dULL, 0xe1a8f632ULL, 0x8b6d6699ULL, 0x13692680ULL, 0xc14cb69dULL, 0xfe5dd409ULL},
+{0xc14cb69dULL, 0xe1a8f632ULL, 0x8b6d6699ULL, 0x13692680ULL, 0xc14cb69dULL, 0xfe5dd409ULL, 0x3345ead4ULL, 0x13692680ULL, 0xf5fbe8b1ULL},
+{0x13692680ULL, 0xc14cb69dULL, 0xfe5dd409ULL, 0x3345ead4ULL, 0x13692680ULL, 0xf5fbe8b1ULL, 0x2f02e517ULL, 0x3345ead4ULL, 0xfe63e843ULL},
+{0x3345ead4ULL, 0x13692680ULL, 0xf5fbe8b1ULL, 0x2f02e517ULL, 0x3345ead4ULL, 0xfe63e843ULL, 0x10e96187ULL, 0x2f02e517ULL, 0x58c4d435ULL},
+{0x2f02e517ULL, 0x3345ead4ULL, 0xfe63e843ULL, 0x10e96187ULL, 0x2f02e517ULL, 0x58c4d435ULL, 0x1d6d6d18ULL, 0x10e96187ULL, 0x65934c8bULL},
+{0x10e96187ULL, 0x2f02e517ULL, 0x58c4d435ULL, 0x1d6d6d18ULL, 0x10e96187ULL, 0x65934c8bULL, 0x5f8c0771ULL, 0x1d6d6d18ULL, 0x770019a5ULL},
+{0x1d6d6d18ULL, 0x10e96187ULL, 0x65934c8bULL, 0x5f8c0771ULL, 0x1d6d6d18ULL, 0x770019a5ULL, 0xc8d688e3ULL, 0x5f8c0771ULL, 0x5df6737bULL},
+{0x5f8c0771ULL, 0x1d6d6d18ULL, 0x770019a5ULL, 0xc8d688e3ULL, 0x5f8c0771ULL, 0x5df6737bULL, 0xe047508aULL, 0xc8d688e3ULL, 0xf316e22ULL},
+{0xc8d688e3ULL, 0x5f8c0771ULL, 0x5df6737bULL, 0xe047508aULL, 0xc8d688e3ULL, 0xf316e22ULL, 0xdba1ef2bULL, 0xe047508aULL, 0xaa5fab30ULL},
+{0xe047508aULL, 0xc8d688e3ULL, 0xf316e22ULL, 0xdba1ef2bULL, 0xe047508aULL, 0xaa5fab30ULL, 0x9e5afc21ULL, 0xdba1ef2bULL, 0x4a47cafeULL},
+{0xdba1ef2bULL, 0xe047508aULL, 0xaa5fab30ULL, 0x9e5afc21ULL, 0xdba1ef2bULL, 0x4a47cafeULL, 0x8eb674d8ULL, 0x9e5afc21ULL, 0x804a3c47ULL},
+{0x9e5afc21ULL, 0xdba1ef2bULL, 0x4a47cafeULL, 0x8eb674d8ULL, 0x9e5afc21ULL, 0x804a3c47ULL, 0x51ea24e6ULL, 0x8eb674d8ULL, 0xaca2146eULL},
+{0x8eb674d8ULL, 0x9e5afc21ULL, 0x804a3c47ULL, 0x51ea24e6ULL, 0x8eb674d8ULL, 0xaca2146eULL, 0xefea5e16ULL, 0x51ea24e6ULL, 0x9f4d0744ULL},
+{0x51ea24e6ULL, 0x8eb674d8ULL, 0xaca2146eULL, 0xefea5e16ULL, 0x51ea24e6ULL, 0x9f4d0744ULL, 0x43d4d07cULL, 0xefea5e16ULL, 0xb76bf5ccULL},
+{0xefea5e16ULL, 0x51ea24e6ULL, 0x9f4d0744ULL, 0x43d4d07cULL, 0xefea5e16ULL, 0xb76bf5ccULL, 0xf77e788bULL, 0x43d4d07cULL, 0x3f051656ULL},
+{0x43d4d07cULL, 0xefea5e16ULL, 0xb76bf5ccULL, 0xf77e788bULL, 0x43d4d07cULL, 0x3f051656ULL, 0x6cf84b60ULL, 0xf77e788bULL, 0xed7e37abULL},
+{0xf77e788bULL, 0x43d4d07cULL, 0x3f051656ULL, 0x6cf84b60ULL, 0xf77e788bULL, 0xed7e37abULL, 0xfc0724e4ULL, 0x6cf84b60ULL, 0x26cfa24ULL},
+{0x6cf84b60ULL, 0xf77e788bULL, 0xed7e37abULL, 0xfc0724e4ULL, 0x6cf84b60ULL, 0x26cfa24ULL, 0x1bc09b85ULL, 0xfc0724e4ULL, 0xc3e76933ULL},
+{0xfc0724e4ULL, 0x6cf84b60ULL, 0x26cfa24ULL, 0x1bc09b85ULL, 0xfc0724e4ULL, 0xc3e76933ULL, 0x75cf9164ULL, 0x1bc09b85ULL, 0x1c532e7eULL},
+{0x1bc09b85ULL, 0xfc0724e4ULL, 0xc3e76933ULL, 0x75cf9164ULL, 0x1bc09b85ULL, 0x1c532e7eULL, 0x6676cc15ULL, 0x75cf9164ULL, 0xa744defaULL},
+{0x75cf9164ULL, 0x1bc09b85ULL, 0x1c532e7eULL, 0x6676cc15ULL, 0x75cf9164ULL, 0xa744defaULL, 0xbb36aae5ULL, 0x6676cc15ULL, 0x25751af5ULL},
+{0x6676cc15ULL, 0x75cf9164ULL, 0xa744defaULL, 0xbb36aae5ULL, 0x6676cc15ULL, 0x25751af5ULL, 0xe80f389fULL, 0xbb36aae5ULL, 0x3d12911ULL},
+{0xbb36aae5ULL, 0x6676cc15ULL, 0x25751af5ULL, 0xe80f389fULL, 0xbb36aae5ULL, 0x3d12911ULL, 0x4e4db2fULL, 0xe80f389fULL, 0x9e472f08ULL},
+{0xe80f389fULL, 0xbb36aae5ULL, 0x3d12911ULL, 0x4e4db2fULL, 0xe80f389fULL, 0x9e472f08ULL, 0x63d4a03cULL, 0x4e4db2fULL, 0x40eea38eULL},
+{0x4e4db2fULL, 0xe80f389fULL, 0x9e472f08ULL, 0x63d4a03cULL, 0x4e4db2fULL, 0x40eea38eULL, 0x1e7f5492ULL, 0x63d4a03cULL, 0xf23228b7ULL},
+{0x63d4a03cULL, 0x4e4db2fULL, 0x40eea38eULL, 0x1e7f5492ULL, 0x63d4a03cULL, 0xf23228b7ULL, 0x2f105546ULL, 0x1e7f5492ULL, 0x14c4a9f1ULL},
+{0x1e7f5492ULL, 0x63d4a03cULL, 0xf23228b7ULL, 0x2f105546ULL, 0x1e7f5492ULL, 0x14c4a9f1ULL, 0x3543a180ULL, 0x2f105546ULL, 0x51e3b58dULL},
+{0x2f105546ULL, 0x1e7f5492ULL, 0x14c4a9f1ULL, 0x3543a180ULL, 0x2f105546ULL, 0x51e3b58dULL, 0x89f71a3bULL, 0x3543a180ULL, 0xa06aff0ULL},
+{0x3543a180ULL, 0x2f105546ULL, 0x51e3b58dULL, 0x89f71a3bULL, 0x3543a180ULL, 0xa06aff0ULL, 0x3a3a52a5ULL, 0x89f71a3bULL, 0xffbd7213ULL},
+{0x89f71a3bULL, 0x3543a180ULL, 0xa06aff0ULL, 0x3a3a52a5ULL, 0x89f71a3bULL, 0xffbd7213ULL, 0x9a16fa10ULL, 0x3a3a52a5ULL, 0x88598832ULL},
+{0x3a3a52a5ULL, 0x89f71a3bULL, 0xffbd7213ULL, 0x9a16fa10ULL, 0x3a3a52a5ULL, 0x88598832ULL, 0x4779927cULL, 0x9a16fa10ULL, 0x65179275ULL},
+{0x9a16fa10ULL, 0x3a3a52a5ULL, 0x88598832ULL, 0x4779927cULL, 0x9a16fa10ULL, 0x65179275ULL, 0xf3f7ceb6ULL, 0x4779927cULL, 0xe79e2c12ULL},
+{0x4779927cULL, 0x9a16fa10ULL, 0x65179275ULL, 0xf3f7ceb6ULL, 0x4779927cULL, 0xe79e2c12ULL, 0xbcc6759ULL, 0xf3f7ceb6ULL, 0x9c0a9f73ULL},
+{0xf3f7ceb6ULL, 0x4779927cULL, 0xe79e2c12ULL, 0xbcc6759ULL, 0xf3f7ceb6ULL, 0x9c0a9f73ULL, 0xb8bea23bULL, 0xbcc6759ULL, 0xbf8f5a6fULL},
+{0xbcc6759ULL, 0xf3f7ceb6ULL, 0x9c0a9f73ULL, 0xb8bea23bULL, 0xbcc6759ULL, 0xbf8f5a6fULL, 0xa242a215ULL, 0xb8bea23bULL, 0x426660a1ULL},
+{0xb8bea23bULL, 0xbcc6759ULL, 0xbf8f5a6fULL, 0xa242a215ULL, 0xb8bea23bULL, 0x426660a1ULL, 0xedaa831ULL, 0xa242a215ULL, 0xa17e2411ULL},
+{0xa242a215ULL, 0xb8bea23bULL, 0x426660a1ULL, 0xedaa831ULL, 0xa242a215ULL, 0xa17e2411ULL, 0x5c384490ULL, 0xedaa831ULL, 0x6a05e085ULL},
+{0xedaa831ULL, 0xa242a215ULL, 0xa17e2411ULL, 0x5c384490ULL, 0xedaa831ULL, 0x6a05e085ULL, 0x8ffc488bULL, 0x5c384490ULL, 0xe0f706edULL},
+{0x5c384490ULL, 0xedaa831ULL, 0x6a05e085ULL, 0x8ffc488bULL, 0x5c384490ULL, 0xe0f706edULL, 0x24ed0b9ULL, 0x8ffc488bULL, 0x12adde90ULL},
+{0x8ffc488bULL, 0x5c384490ULL, 0xe0f706edULL, 0x24ed0b9ULL, 0x8ffc488bULL, 0x12adde90ULL, 0xb4dc73adULL, 0x24ed0b9ULL, 0x4282b8b5ULL},
+{0x24ed0b9ULL, 0x8ffc488bULL, 0x12adde90ULL, 0xb4dc73adULL, 0x24ed0b9ULL, 0x4282b8b5ULL, 0x47d9a218ULL, 0xb4dc73adULL, 0x1c0577b3ULL},
+{0xb4dc73adULL, 0x24ed0b9ULL, 0x4282b8b5ULL, 0x47d9a218ULL, 0xb4dc73adULL, 0x1c0577b3ULL, 0xaeff0351ULL, 0x47d9a218ULL, 0x981d51d9ULL},
+{0x47d9a218ULL, 0xb4dc73adULL, 0x1c0577b3ULL, 0xaeff0351ULL, 0x47d9a218ULL, 0x981d51d9ULL, 0x44e76612ULL, 0xaeff0351ULL, 0x9e5f1ea3ULL},
+{0xaeff0351ULL, 0x47d9a218ULL, 0x981d51d9ULL, 0x44e76612ULL, 0xaeff0351ULL, 0x9e5f1ea3ULL, 0xcd4c0064ULL, 0x44e76612ULL, 0xbbc48294ULL},
+{0x44e76612ULL, 0xaeff0351ULL, 0x9e5f1ea3ULL, 0xcd4c0064ULL, 0x44e76612ULL, 0xbbc48294ULL, 0x7f997db4ULL, 0xcd4c0064ULL, 0x74391d1eULL},
+{0xcd4c0064ULL, 0x44e76612ULL, 0xbbc48294ULL, 0x7f997db4ULL, 0xcd4c0064ULL, 0x74391d1eULL, 0x1942b65cULL, 0x7f997db4ULL, 0x121a745cULL},
+{0x7f997db4ULL, 0xcd4c0064ULL, 0x74391d1eULL, 0x1942b65cULL, 0x7f997db4ULL, 0x121a745cULL, 0xb00b8888ULL, 0x1942b65cULL, 0x64cb07bfULL},
+{0x1942b65cULL, 0x7f997db4ULL, 0x121a745cULL, 0xb00b8888ULL, 0x1942b65cULL, 0x64cb07bfULL, 0xb8b17c59ULL, 0xb00b8888ULL, 0x2e6a072eULL},
+{0xb00b8888ULL, 0x1942b65cULL, 0x64cb07bfULL, 0xb8b17c59ULL, 0xb00b8888ULL, 0x2e6a072eULL, 0x8bd9c495ULL, 0xb8b17c59ULL, 0x147e452cULL},
+{0xb8b17c59ULL, 0xb00b8888ULL, 0x2e6a072eULL, 0x8bd9c495ULL, 0xb8b17c59ULL, 0x147e452cULL, 0x65253951ULL, 0x8bd9c495ULL, 0x332410daULL},
+{0x8bd9c495ULL, 0xb8b17c59ULL, 0x147e452cULL, 0x65253951ULL, 0x8bd9c495ULL, 0x332410daULL, 0x40897057ULL, 0x65253951ULL, 0xaa86dd0aULL},
+{0x65253951ULL, 0x8bd9c495ULL, 0x332410daULL, 0x40897057ULL, 0x65253951ULL, 0xaa86dd0aULL, 0xe9ff97ebULL, 0x40897057ULL, 0x5b4ed644ULL},
+{0x40897057ULL, 0x65253951ULL, 0xaa86dd0aULL, 0xe9ff97ebULL, 0x40897057ULL, 0x5b4ed644ULL, 0x14b9a523ULL, 0xe9ff97ebULL, 0x86a55e04ULL},
+{0xe9ff97ebULL, 0x40897057ULL, 0x5b4ed644ULL, 0x14b9a523ULL, 0xe9ff97ebULL, 0x86a55e04ULL, 0x126ac6dcULL, 0x14b9a523ULL, 0x9f50d920ULL},
+{0x14b9a523ULL, 0xe9ff97ebULL, 0x86a55e04ULL, 0x126ac6dcULL, 0x14b9a523ULL, 0x9f50d920ULL, 0x613b8400ULL, 0x126ac6dcULL, 0x3abf29f4ULL},
+{0x126ac6dcULL, 0x14b9a523ULL, 0x9f50d920ULL, 0x613b8400ULL, 0x126ac6dcULL, 0x3abf29f4ULL, 0x584c5250ULL, 0x613b8400ULL, 0xd11bd0d0ULL},
+{0x613b8400ULL, 0x126ac6dcULL, 0x3abf29f4ULL, 0x584c5250ULL, 0x613b8400ULL, 0xd11bd0d0ULL, 0xe4b389ceULL, 0x584c5250ULL, 0x57f2ad2cULL},
+{0x584c5250ULL, 0x613b8400ULL, 0xd11bd0d0ULL, 0xe4b389ceULL, 0x584c5250ULL, 0x57f2ad2cULL, 0x2b10e474ULL, 0xe4b389ceULL, 0xab93dcdcULL},
+{0xe4b389ceULL, 0x584c5250ULL, 0x57f2ad2cULL, 0x2b10e474ULL, 0xe4b389ceULL, 0xab93dcdcULL, 0x28df2084ULL, 0x2b10e474ULL, 0x812a1f47ULL},
+{0x2b10e474ULL, 0xe4b389ceULL, 0xab93dcdcULL, 0x28df2084ULL, 0x2b10e474ULL, 0x812a1f47ULL, 0x8a785f4ULL, 0x28df2084ULL, 0xaed3d073ULL},
+{0x28df2084ULL, 0x2b10e474ULL, 0x812a1f47ULL, 0x8a785f4ULL, 0x28df2084ULL, 0xaed3d073ULL, 0x6763796ULL, 0x8a785f4ULL, 0x9d8be0aeULL},
+{0x8a785f4ULL, 0x28df2084ULL, 0xaed3d073ULL, 0x6763796ULL, 0x8a785f4ULL, 0x9d8be0aeULL, 0xa43512afULL, 0x6763796ULL, 0x6c9b6492ULL},
+{0x6763796ULL, 0x8a785f4ULL, 0x9d8be0aeULL, 0xa43512afULL, 0x6763796ULL, 0x6c9b6492ULL, 0xdbdd105bULL, 0xa43512afULL, 0x8d9a68a4ULL},
+{0xa43512afULL, 0x6763796ULL, 0x6c9b6492ULL, 0xdbdd105bULL, 0xa43512afULL, 0x8d9a68a4ULL, 0x2f8433cULL, 0xdbdd105bULL, 0x17c46d33ULL},
+{0xdbdd105bULL, 0xa43512afULL, 0x8d9a68a4ULL, 0x2f8433cULL, 0xdbdd105bULL, 0x17c46d33ULL, 0x7eb9c6a9ULL, 0x2f8433cULL, 0x22a8768cULL},
+{0x2f8433cULL, 0xdbdd105bULL, 0x17c46d33ULL, 0x7eb9c6a9ULL, 0x2f8433cULL, 0x22a8768cULL, 0x80fb2c00ULL, 0x7eb9c6a9ULL, 0x1c07cfaaULL},
+{0x7eb9c6a9ULL, 0x2f8433cULL, 0x22a8768cULL, 0x80fb2c00ULL, 0x7eb9c6a9ULL, 0x1c07cfaaULL, 0xab8c2de1ULL, 0x80fb2c00ULL, 0x40277018ULL},
+{0x80fb2c00ULL, 0x7eb9c6a9ULL, 0x1c07cfaaULL, 0xab8c2de1ULL, 0x80fb2c00ULL, 0x40277018ULL, 0x2331e04eULL, 0xab8c2de1ULL, 0xb5e94e51ULL},
+{0xab8c2de1ULL, 0x80fb2c00ULL, 0x40277018ULL, 0x2331e04eULL, 0xab8c2de1ULL, 0xb5e94e51ULL, 0x5058036dULL, 0x2331e04eULL, 0x1e1abd00ULL},
+{0x2331e04eULL, 0xab8c2de1ULL, 0xb5e94e51ULL, 0x5058036dULL, 0x2331e04eULL, 0x1e1abd00ULL, 0xd5a4d08ULL, 0x5058036dULL, 0x42e3945fULL},
+{0x5058036dULL, 0x2331e04eULL, 0x1e1abd00ULL, 0xd5a4d08ULL, 0x5058036dULL, 0x42e3945fULL, 0xa043ca44ULL, 0xd5a4d08ULL, 0x3212dbfbULL},
+{0xd5a4d08ULL, 0x5058036dULL, 0x42e3945fULL, 0xa043ca44ULL, 0xd5a4d08ULL, 0x3212dbfbULL, 0xfeb738afULL, 0xa043ca44ULL, 0xa6a5bd01ULL},
+{0xa043ca44ULL, 0xd5a4d08ULL, 0x3212dbfbULL, 0xfeb738afULL, 0xa043ca44ULL, 0xa6a5bd01ULL, 0xc67f20daULL, 0xfeb738afULL, 0x2c258474ULL},
+{0xfeb738afULL, 0xa043ca44ULL, 0xa6a5bd01ULL, 0xc67f20daULL, 0xfeb738afULL, 0x2c258474ULL, 0x230b9688ULL, 0xc67f20daULL, 0xd56ab071ULL},
+{0xc67f20daULL, 0xfeb738afULL, 0x2c258474ULL, 0x230b9688ULL, 0xc67f20daULL, 0xd56ab071ULL, 0xcb13f914ULL, 0x230b9688ULL, 0xb67628adULL},
+{0x230b9688ULL, 0xc67f20daULL, 0xd56ab071ULL, 0xcb13f914ULL, 0x230b9688ULL, 0xb67628adULL, 0x90ce79f7ULL, 0xcb13f914ULL, 0x8ee87e98ULL},
+{0xcb13f914ULL, 0x230b9688ULL, 0xb67628adULL, 0x90ce79f7ULL, 0xcb13f914ULL, 0x8ee87e98ULL, 0xfffcd61ULL, 0x90ce79f7ULL, 0xe3d20d8dULL},
+{0x90ce79f7ULL, 0xcb13f914ULL, 0x8ee87e98ULL, 0xfffcd61ULL, 0x90ce79f7ULL, 0xe3d20d8dULL, 0x98df0ebcULL, 0xfffcd61ULL, 0x983240a8ULL},
+{0xfffcd61ULL, 0x90ce79f7ULL, 0xe3d20d8dULL, 0x98df0ebcULL, 0xfffcd61ULL, 0x983240a8ULL, 0x7cb61a51ULL, 0x98df0ebcULL, 0xed04a6f8ULL},
+{0x98df0ebcULL, 0xfffcd61ULL, 0x983240a8ULL, 0x7cb61a51ULL, 0x98df0ebcULL, 0xed04a6f8ULL, 0x5b1ebed6ULL, 0x7cb61a51ULL, 0xf26cfffdULL},
+{0x7cb61a51ULL, 0x98df0ebcULL, 0xed04a6f8ULL, 0x5b1ebed6ULL, 0x7cb61a51ULL, 0xf26cfffdULL, 0x9b30850dULL, 0x5b1ebed6ULL, 0xe47e456bULL},
+{0x5b1ebed6ULL, 0x7cb61a51ULL, 0xf26cfffdULL, 0x9b30850dULL, 0x5b1ebed6ULL, 0xe47e456bULL, 0xe319b93cULL, 0x9b30850dULL, 0xdf7b3ba1ULL},
+{0x9b30850dULL, 0x5b1ebed6ULL, 0xe47e456bULL, 0xe319b93cULL, 0x9b30850dULL, 0xdf7b3ba1ULL, 0xe2f6eff3ULL, 0xe319b93cULL, 0xafb81603ULL},
+{0xe319b93cULL, 0x9b30850dULL, 0xdf7b3ba1ULL, 0xe2f6eff3ULL, 0xe319b93cULL, 0xafb81603ULL, 0x8555d88ULL, 0xe2f6eff3ULL, 0x1abef9d1ULL},
+{0xe2f6eff3ULL, 0xe319b93cULL, 0xafb81603ULL, 0x8555d88ULL, 0xe2f6eff3ULL, 0x1abef9d1ULL, 0xd0615dc7ULL, 0x8555d88ULL, 0x4448e353ULL},
+{0x8555d88ULL, 0xe2f6eff3ULL, 0x1abef9d1ULL, 0xd0615dc7ULL, 0x8555d88ULL, 0x4448e353ULL, 0x1b4ffb0ULL, 0xd0615dc7ULL, 0x85084172ULL},
+{0xd0615dc7ULL, 0x8555d88ULL, 0x4448e353ULL, 0x1b4ffb0ULL, 0xd0615dc7ULL, 0x85084172ULL, 0xbd39d261ULL, 0x1b4ffb0ULL, 0xa89bd8ceULL},
+{0x1b4ffb0ULL, 0xd0615dc7ULL, 0x85084172ULL, 0xbd39d261ULL, 0x1b4ffb0ULL, 0xa89bd8ceULL, 0xdb69c088ULL, 0xbd39d261ULL, 0xe910d5d9ULL},
+{0xbd39d261ULL, 0x1b4ffb0ULL, 0xa89bd8ceULL, 0xdb69c088ULL, 0xbd39d261ULL, 0xe910d5d9ULL, 0x212e8626ULL, 0xdb69c088ULL, 0x30e838c9ULL},
+{0xdb69c088ULL, 0xbd39d261ULL, 0xe910d5d9ULL, 0x212e8626ULL, 0xdb69c088ULL, 0x30e838c9ULL, 0x9778a657ULL, 0x212e8626ULL, 0x3240409aULL},
+{0x212e8626ULL, 0xdb69c088ULL, 0x30e838c9ULL, 0x9778a657ULL, 0x212e8626ULL, 0x3240409aULL, 0xa93bb7a3ULL, 0x9778a657ULL, 0x2d581749ULL},
+{0x9778a657ULL, 0x212e8626ULL, 0x3240409aULL, 0xa93bb7a3ULL, 0x9778a657ULL, 0x2d581749ULL, 0x915f0b6bULL, 0xa93bb7a3ULL, 0x94db40f9ULL},
+{0xa93bb7a3ULL, 0x9778a657ULL, 0x2d581749ULL, 0x915f0b6bULL, 0xa93bb7a3ULL, 0x94db40f9ULL, 0x9f8e5fe1ULL, 0x915f0b6bULL, 0x21c8dc0cULL},
+{0x915f0b6bULL, 0xa93bb7a3ULL, 0x94db40f9ULL, 0x9f8e5fe1ULL, 0x915f0b6bULL, 0x21c8dc0cULL, 0xde009cd4ULL, 0x9f8e5fe1ULL, 0x7ca0d4b1ULL},
+{0x9f8e5fe1ULL, 0x915f0b6bULL, 0x21c8dc0cULL, 0xde009cd4ULL, 0x9f8e5fe1ULL, 0x7ca0d4b1ULL, 0xdcdc2f48ULL, 0xde009cd4ULL, 0xdb40c35fULL},
+{0xde009cd4ULL, 0x9f8e5fe1ULL, 0x7ca0d4b1ULL, 0xdcdc2f48ULL, 0xde009cd4ULL, 0xdb40c35fULL, 0x44e33fd8ULL, 0xdcdc2f48ULL, 0x3d680e20ULL},
+{0xdcdc2f48ULL, 0xde009cd4ULL, 0xdb40c35fULL, 0x44e33fd8ULL, 0xdcdc2f48ULL, 0x3d680e20ULL, 0x6dfdae34ULL, 0x44e33fd8ULL, 0x4d57dd63ULL},
+{0x44e33fd8ULL, 0xdcdc2f48ULL, 0x3d680e20ULL, 0x6dfdae34ULL, 0x44e33fd8ULL, 0x4d57dd63ULL, 0xc2de84e1ULL, 0x6dfdae34ULL, 0x49fb71a8ULL},
+{0x6dfdae34ULL, 0x44e33fd8ULL, 0x4d57dd63ULL, 0xc2de84e1ULL, 0x6dfdae34ULL, 0x49fb71a8ULL, 0x4ad3bd87ULL, 0xc2de84e1ULL, 0x67c78de5ULL},
+{0xc2de84e1ULL, 0x6dfdae34ULL, 0x49fb71a8ULL, 0x4ad3bd87ULL, 0xc2de84e1ULL, 0x67c78de5ULL, 0xbdd99502ULL, 0x4ad3bd87ULL, 0xd875f912ULL},
+{0x4ad3bd87ULL, 0xc2de84e1ULL, 0x67c78de5ULL, 0xbdd99502ULL, 0x4ad3bd87ULL, 0xd875f912ULL, 0x2274d38aULL, 0xbdd99502ULL, 0xee19ce0ULL},
+{0xbdd99502ULL, 0x4ad3bd87ULL, 0xd875f912ULL, 0x2274d38aULL, 0xbdd99502ULL, 0xee19ce0ULL, 0x216cff43ULL, 0x2274d38aULL, 0x811c34dULL},
+{0x2274d38aULL, 0xbdd99502ULL, 0xee19ce0ULL, 0x216cff43ULL, 0x2274d38aULL, 0x811c34dULL, 0x610c09f8ULL, 0x216cff43ULL, 0x1a2810e9ULL},
+{0x216cff43ULL, 0x2274d38aULL, 0x811c34dULL, 0x610c09f8ULL, 0x216cff43ULL, 0x1a2810e9ULL, 0xe3101cb3ULL, 0x610c09f8ULL, 0x925ec683ULL},
+{0x610c09f8ULL, 0x216cff43ULL, 0x1a2810e9ULL, 0xe3101cb3ULL, 0x610c09f8ULL, 0x925ec683ULL, 0xb3d3287aULL, 0xe3101cb3ULL, 0xb6a7f7e0ULL},
+{0xe3101cb3ULL, 0x610c09f8ULL, 0x925ec683ULL, 0xb3d3287aULL, 0xe3101cb3ULL, 0xb6a7f7e0ULL, 0xded1d516ULL, 0xb3d3287aULL, 0x4fcf8d51ULL},
+{0xb3d3287aULL, 0xe3101cb3ULL, 0xb6a7f7e0ULL, 0xded1d516ULL, 0xb3d3287aULL, 0x4fcf8d51ULL, 0xe1d53aa4ULL, 0xded1d516ULL, 0x49593968ULL},
+{0xded1d516ULL, 0xb3d3287aULL, 0x4fcf8d51ULL, 0xe1d53aa4ULL, 0xded1d516ULL, 0x49593968ULL, 0xe5af5f07ULL, 0xe1d53aa4ULL, 0xda81ebc5ULL},
+{0xe1d53aa4ULL, 0xded1d516ULL, 0x49593968ULL, 0xe5af5f07ULL, 0xe1d53aa4ULL, 0xda81ebc5ULL, 0x79563c7dULL, 0xe5af5f07ULL, 0xd45d4113ULL},
+{0xe5af5f07ULL, 0xe1d53aa4ULL, 0xda81ebc5ULL, 0x79563c7dULL, 0xe5af5f07ULL, 0xd45d4113ULL, 0xa90ea509ULL, 0x79563c7dULL, 0xad5004b5ULL},
+{0x79563c7dULL, 0xe5af5f07ULL, 0xd45d4113ULL, 0xa90ea509ULL, 0x79563c7dULL, 0xad5004b5ULL, 0x3f911082ULL, 0xa90ea509ULL, 0xe088da25ULL},
+{0xa90ea509ULL, 0x79563c7dULL, 0xad5004b5ULL, 0x3f911082ULL, 0xa90ea509ULL, 0xe088da25ULL, 0x2af0ee61ULL, 0x3f911082ULL, 0x61817c16ULL},
+{0x3f911082ULL, 0xa90ea509ULL, 0xe088da25ULL, 0x2af0ee61ULL, 0x3f911082ULL, 0x61817c16ULL, 0x807925feULL, 0x2af0ee61ULL, 0x3f4479e5ULL},
+{0x2af0ee61ULL, 0x3f911082ULL, 0x61817c16ULL, 0x807925feULL, 0x2af0ee61ULL, 0x3f4479e5ULL, 0xbba7ce87ULL, 0x807925feULL, 0x28d53b0fULL},
+{0x807925feULL, 0x2af0ee61ULL, 0x3f4479e5ULL, 0xbba7ce87ULL, 0x807925feULL, 0x28d53b0fULL, 0xe635f935ULL, 0xbba7ce87ULL, 0xfc3df36eULL},
+{0xbba7ce87ULL, 0x807925feULL, 0x28d53b0fULL, 0xe635f935ULL, 0xbba7ce87ULL, 0xfc3df36eULL, 0xa7d21b49ULL, 0xe635f935ULL, 0x4f9ffe05ULL},
+{0xe635f935ULL, 0xbba7ce87ULL, 0xfc3df36eULL, 0xa7d21b49ULL, 0xe635f935ULL, 0x4f9ffe05ULL, 0x879b126fULL, 0xa7d21b49ULL, 0x974ddd18ULL},
+{0xa7d21b49ULL, 0xe635f935ULL, 0x4f9ffe05ULL, 0x879b126fULL, 0xa7d21b49ULL, 0x974ddd18ULL, 0xee3f8ce9ULL, 0x879b126fULL, 0xd05945baULL},
+{0x879b126fULL, 0xa7d21b49ULL, 0x974ddd18ULL, 0xee3f8ce9ULL, 0x879b126fULL, 0xd05945baULL, 0x807f8785ULL, 0xee3f8ce9ULL, 0x457a35ddULL},
+{0xee3f8ce9ULL, 0x879b126fULL, 0xd05945baULL, 0x807f8785ULL, 0xee3f8ce9ULL, 0x457a35ddULL, 0x9a864954ULL, 0x807f8785ULL, 0x7f07a272ULL},
+{0x807f8785ULL, 0xee3f8ce9ULL, 0x457a35ddULL, 0x9a864954ULL, 0x807f8785ULL, 0x7f07a272ULL, 0x14408c4eULL, 0x9a864954ULL, 0x5fcf9d2dULL},
+{0x9a864954ULL, 0x807f8785ULL, 0x7f07a272ULL, 0x14408c4eULL, 0x9a864954ULL, 0x5fcf9d2dULL, 0x5178d5ddULL, 0x14408c4eULL, 0x9ca54ee2ULL},
+{0x14408c4eULL, 0x9a864954ULL, 0x5fcf9d2dULL, 0x5178d5ddULL, 0x14408c4eULL, 0x9ca54ee2ULL, 0xb0751579ULL, 0x5178d5ddULL, 0x358021dcULL},
+{0x5178d5ddULL, 0x14408c4eULL, 0x9ca54ee2ULL, 0xb0751579ULL, 0x5178d5ddULL, 0x358021dcULL, 0x636b1a0ULL, 0xb0751579ULL, 0xa2428a05ULL},
+{0xb0751579ULL, 0x5178d5ddULL, 0x358021dcULL, 0x636b1a0ULL, 0xb0751579ULL, 0xa2428a05ULL, 0xf538adb0ULL, 0x636b1a0ULL, 0xa01b6f3aULL},
+{0x636b1a0ULL, 0xb0751579ULL, 0xa2428a05ULL, 0xf538adb0ULL, 0x636b1a0ULL, 0xa01b6f3aULL, 0x8fecca8dULL, 0xf538adb0ULL, 0x25b9eea4ULL},
+{0xf538adb0ULL, 0x636b1a0ULL, 0xa01b6f3aULL, 0x8fecca8dULL, 0xf538adb0ULL, 0x25b9eea4ULL, 0x7c5868b1ULL, 0x8fecca8dULL, 0xae78ce42ULL},
+{0x8fecca8dULL, 0xf538adb0ULL, 0x25b9eea4ULL, 0x7c5868b1ULL, 0x8fecca8dULL, 0xae78ce42ULL, 0x58714cceULL, 0x7c5868b1ULL, 0x5461d52fULL},
+{0x7c5868b1ULL, 0x8fecca8dULL, 0xae78ce42ULL, 0x58714cceULL, 0x7c5868b1ULL, 0x5461d52fULL, 0xd75d37cULL, 0x58714cceULL, 0xb900d068ULL},
+{0x58714cceULL, 0x7c5868b1ULL, 0x5461d52fULL, 0xd75d37cULL, 0x58714cceULL, 0xb900d068ULL, 0xff4d3ec0ULL, 0xd75d37cULL, 0x9a2f805ULL},
+{0xd75d37cULL, 0x58714cceULL, 0xb900d068ULL, 0xff4d3ec0ULL, 0xd75d37cULL, 0x9a2f805ULL, 0xb3e80a7dULL, 0xff4d3ec0ULL, 0x8b7ea91ULL},
+{0xff4d3ec0ULL, 0xd75d37cULL, 0x9a2f805ULL, 0xb3e80a7dULL, 0xff4d3ec0ULL, 0x8b7ea91ULL, 0x81d37ca5ULL, 0xb3e80a7dULL, 0xa058e5b1ULL},
+{0xb3e80a7dULL, 0xff4d3ec0ULL, 0x8b7ea91ULL, 0x81d37ca5ULL, 0xb3e80a7dULL, 0xa058e5b1ULL, 0x26ff1f79ULL, 0x81d37ca5ULL, 0xa5de1510ULL},
+{0x81d37ca5ULL, 0xb3e80a7dULL, 0xa058e5b1ULL, 0x26ff1f79ULL, 0x81d37ca5ULL, 0xa5de1510ULL, 0x4f39aa77ULL, 0x26ff1f79ULL, 0xab93e031ULL},
+{0x26ff1f79ULL, 0x81d37ca5ULL, 0xa5de1510ULL, 0x4f39aa77ULL, 0x26ff1f79ULL, 0xab93e031ULL, 0xe32f89deULL, 0x4f39aa77ULL, 0xde489f59ULL},
+{0x4f39aa77ULL, 0x26ff1f79ULL, 0xab93e031ULL, 0xe32f89deULL, 0x4f39aa77ULL, 0xde489f59ULL, 0x3a41a79cULL, 0xe32f89deULL, 0xf0ff0e14ULL},
+{0xe32f89deULL, 0x4f39aa77ULL, 0xde489f59ULL, 0x3a41a79cULL, 0xe32f89deULL, 0xf0ff0e14ULL, 0xd8e817ebULL, 0x3a41a79cULL, 0x281bb4d7ULL},
+{0x3a41a79cULL, 0xe32f89deULL, 0xf0ff0e14ULL, 0xd8e817ebULL, 0x3a41a79cULL, 0x281bb4d7ULL, 0xe330cd55ULL, 0xd8e817ebULL, 0x19531683ULL},
+{0xd8e817ebULL, 0x3a41a79cULL, 0x281bb4d7ULL, 0xe330cd55ULL, 0xd8e817ebULL, 0x19531683ULL, 0x8dc9c84ULL, 0xe330cd55ULL, 0xa6f0eac9ULL},
+{0xe330cd55ULL, 0xd8e817ebULL, 0x19531683ULL, 0x8dc9c84ULL, 0xe330cd55ULL, 0xa6f0eac9ULL, 0x8329677eULL, 0x8dc9c84ULL, 0xae4bf076ULL},
+{0x8dc9c84ULL, 0xe330cd55ULL, 0xa6f0eac9ULL, 0x8329677eULL, 0x8dc9c84ULL, 0xae4bf076ULL, 0xaa4288bcULL, 0x8329677eULL, 0x97e386c4ULL},
+{0x8329677eULL, 0x8dc9c84ULL, 0xae4bf076ULL, 0xaa4288bcULL, 0x8329677eULL, 0x97e386c4ULL, 0xefeb11cbULL, 0xaa4288bcULL, 0x91fbd908ULL},
+{0xaa4288bcULL, 0x8329677eULL, 0x97e386c4ULL, 0xefeb11cbULL, 0xaa4288bcULL, 0x91fbd908ULL, 0xa3cc9952ULL, 0xefeb11cbULL, 0x8e6d5b04ULL},
+{0xefeb11cbULL, 0xaa4288bcULL, 0x91fbd908ULL, 0xa3cc9952ULL, 0xefeb11cbULL, 0x8e6d5b04ULL, 0x58c12530ULL, 0xa3cc9952ULL, 0xabcd9e79ULL},
+{0xa3cc9952ULL, 0xefeb11cbULL, 0x8e6d5b04ULL, 0x58c12530ULL, 0xa3cc9952ULL, 0xabcd9e79ULL, 0x43e1d963ULL, 0x58c12530ULL, 0x3bbb47acULL},
+{0x58c12530ULL, 0xa3cc9952ULL, 0xabcd9e79ULL, 0x43e1d963ULL, 0x58c12530ULL, 0x3bbb47acULL, 0xae0b743bULL, 0x43e1d963ULL, 0xd187f16aULL},
+{0x43e1d963ULL, 0x58c12530ULL, 0x3bbb47acULL, 0xae0b743bULL, 0x43e1d963ULL, 0xd187f16aULL, 0x8e92cc73ULL, 0xae0b743bULL, 0xbc8fb2a5ULL},
+{0xae0b743bULL, 0x43e1d963ULL, 0xd187f16aULL, 0x8e92cc73ULL, 0xae0b743bULL, 0xbc8fb2a5ULL, 0x1a53dbcaULL, 0x8e92cc73ULL, 0xae63c4f7ULL},
+{0x8e92cc73ULL, 0xae0b743bULL, 0xbc8fb2a5ULL, 0x1a53dbcaULL, 0x8e92cc73ULL, 0xae63c4f7ULL, 0x4a850425ULL, 0x1a53dbcaULL, 0xf74fe56fULL},
+{0x1a53dbcaULL, 0x8e92cc73ULL, 0xae63c4f7ULL, 0x4a850425ULL, 0x1a53dbcaULL, 0xf74fe56fULL, 0xcff11b6eULL, 0x4a850425ULL, 0x2d7f148fULL},
+{0x4a850425ULL, 0x1a53dbcaULL, 0xf74fe56fULL, 0xcff11b6eULL, 0x4a850425ULL, 0x2d7f148fULL, 0x289d7d52ULL, 0xcff11b6eULL, 0x2cc5b651ULL},
+{0xcff11b6eULL, 0x4a850425ULL, 0x2d7f148fULL, 0x289d7d52ULL, 0xcff11b6eULL, 0x2cc5b651ULL, 0xe189df8cULL, 0x289d7d52ULL, 0x5755da6eULL},
+{0x289d7d52ULL, 0xcff11b6eULL, 0x2cc5b651ULL, 0xe189df8cULL, 0x289d7d52ULL, 0x5755da6eULL, 0xe9912b45ULL, 0xe189df8cULL, 0xeffc416bULL},
+{0xe189df8cULL, 0x289d7d52ULL, 0x5755da6eULL, 0xe9912b45ULL, 0xe189df8cULL, 0xeffc416bULL, 0x492c26c9ULL, 0xe9912b45ULL, 0x9dfdf275ULL},
+{0xe9912b45ULL, 0xe189df8cULL, 0xeffc416bULL, 0x492c26c9ULL, 0xe9912b45ULL, 0x9dfdf275ULL, 0x8c1ef0fULL, 0x492c26c9ULL, 0xa61c547aULL},
+{0x492c26c9ULL, 0xe9912b45ULL, 0x9dfdf275ULL, 0x8c1ef0fULL, 0x492c26c9ULL, 0xa61c547aULL, 0x7bb76d07ULL, 0x8c1ef0fULL, 0x972aa2b6ULL},
+{0x8c1ef0fULL, 0x492c26c9ULL, 0xa61c547aULL, 0x7bb76d07ULL, 0x8c1ef0fULL, 0x972aa2b6ULL, 0xad752528ULL, 0x7bb76d07ULL, 0x946c007cULL},
+{0x7bb76d07ULL, 0x8c1ef0fULL, 0x972aa2b6ULL, 0xad752528ULL, 0x7bb76d07ULL, 0x946c007cULL, 0x4e3a42fdULL, 0xad752528ULL, 0x4a9ac8e4ULL},
+{0xad752528ULL, 0x7bb76d07ULL, 0x946c007cULL, 0x4e3a42fdULL, 0xad752528ULL, 0x4a9ac8e4ULL, 0xe5a59362ULL, 0x4e3a42fdULL, 0x77cf18b8ULL},
+{0x4e3a42fdULL, 0xad752528ULL, 0x4a9ac8e4ULL, 0xe5a59362ULL, 0x4e3a42fdULL, 0x77cf18b8ULL, 0xbc9a7aafULL, 0xe5a59362ULL, 0x9589063ULL},
+{0xe5a59362ULL, 0x4e3a42fdULL, 0x77cf18b8ULL, 0xbc9a7aafULL, 0xe5a59362ULL, 0x9589063ULL, 0xc73c8abbULL, 0xbc9a7aafULL, 0xdced2e8cULL},
+{0xbc9a7aafULL, 0xe5a59362ULL, 0x9589063ULL, 0xc73c8abbULL, 0xbc9a7aafULL, 0xdced2e8cULL, 0x79c655ffULL, 0xc73c8abbULL, 0x34dc3ae4ULL},
+{0xc73c8abbULL, 0xbc9a7aafULL, 0xdced2e8cULL, 0x79c655ffULL, 0xc73c8abbULL, 0x34dc3ae4ULL, 0xd0f7d467ULL, 0x79c655ffULL, 0x8e4f5040ULL},
+{0x79c655ffULL, 0xc73c8abbULL, 0x34dc3ae4ULL, 0xd0f7d467ULL, 0x79c655ffULL, 0x8e4f5040ULL, 0xa2a7d1a8ULL, 0xd0f7d467ULL, 0x5920b683ULL},
+{0xd0f7d467ULL, 0x79c655ffULL, 0x8e4f5040ULL, 0xa2a7d1a8ULL, 0xd0f7d467ULL, 0x5920b683ULL, 0x7c6bd9b8ULL, 0xa2a7d1a8ULL, 0xc408b417ULL},
+{0xa2a7d1a8ULL, 0xd0f7d467ULL, 0x5920b683ULL, 0x7c6bd9b8ULL, 0xa2a7d1a8ULL, 0xc408b417ULL, 0x3125b2f8ULL, 0x7c6bd9b8ULL, 0xcab95ea9ULL},
+{0x7c6bd9b8ULL, 0xa2a7d1a8ULL, 0xc408b417ULL, 0x3125b2f8ULL, 0x7c6bd9b8ULL, 0xcab95ea9ULL, 0x1b3180dcULL, 0x3125b2f8ULL, 0xe9bc26bdULL},
+{0x3125b2f8ULL, 0x7c6bd9b8ULL, 0xcab95ea9ULL, 0x1b3180dcULL, 0x3125b2f8ULL, 0xe9bc26bdULL, 0x49f8c097ULL, 0x1b3180dcULL, 0xde42ef3aULL},
+{0x1b3180dcULL, 0x3125b2f8ULL, 0xe9bc26bdULL, 0x49f8c097ULL, 0x1b3180dcULL, 0xde42ef3aULL, 0x2f0c6872ULL, 0x49f8c097ULL, 0xf214078fULL},
+{0x49f8c097ULL, 0x1b3180dcULL, 0xde42ef3aULL, 0x2f0c6872ULL, 0x49f8c097ULL, 0xf214078fULL, 0x4d3c0c9cULL, 0x2f0c6872ULL, 0x6a1d8a6dULL},
+{0x2f0c6872ULL, 0x49f8c097ULL, 0xf214078fULL, 0x4d3c0c9cULL, 0x2f0c6872ULL, 0x6a1d8a6dULL, 0xab1dd6d8ULL, 0x4d3c0c9cULL, 0x83ed8209ULL},
+{0x4d3c0c9cULL, 0x2f0c6872ULL, 0x6a1d8a6dULL, 0xab1dd6d8ULL, 0x4d3c0c9cULL, 0x83ed8209ULL, 0x5c9e508ULL, 0xab1dd6d8ULL, 0xcfc72d8eULL},
+{0xab1dd6d8ULL, 0x4d3c0c9cULL, 0x83ed8209ULL, 0x5c9e508ULL, 0xab1dd6d8ULL, 0xcfc72d8eULL, 0xde37bfecULL, 0x5c9e508ULL, 0x3d1109feULL},
+{0x5c9e508ULL, 0xab1dd6d8ULL, 0xcfc72d8eULL, 0xde37bfecULL, 0x5c9e508ULL, 0x3d1109feULL, 0x4101d81aULL, 0xde37bfecULL, 0xea671e75ULL},
+{0xde37bfecULL, 0x5c9e508ULL, 0x3d1109feULL, 0x4101d81aULL, 0xde37bfecULL, 0xea671e75ULL, 0xbbab72e7ULL, 0x4101d81aULL, 0xf6dda173ULL},
+{0x4101d81aULL, 0xde37bfecULL, 0xea671e75ULL, 0xbbab72e7ULL, 0x4101d81aULL, 0xf6dda173ULL, 0x85679228ULL, 0xbbab72e7ULL, 0x676184d7ULL},
+{0xbbab72e7ULL, 0x4101d81aULL, 0xf6dda173ULL, 0x85679228ULL, 0xbbab72e7ULL, 0x676184d7ULL, 0xac2d4946ULL, 0x85679228ULL, 0x5ad70b07ULL},
+{0x85679228ULL, 0xbbab72e7ULL, 0x676184d7ULL, 0xac2d4946ULL, 0x85679228ULL, 0x5ad70b07ULL, 0x684c21f9ULL, 0xac2d4946ULL, 0x5cd86bf5ULL},
+{0xac2d4946ULL, 0x85679228ULL, 0x5ad70b07ULL, 0x684c21f9ULL, 0xac2d4946ULL, 0x5cd86bf5ULL, 0xcaaabf8eULL, 0x684c21f9ULL, 0x9a95ec54ULL},
+{0x684c21f9ULL, 0xac2d4946ULL, 0x5cd86bf5ULL, 0xcaaabf8eULL, 0x684c21f9ULL, 0x9a95ec54ULL, 0x3a8eaafdULL, 0xcaaabf8eULL, 0xaf8f6d51ULL},
+{0xcaaabf8eULL, 0x684c21f9ULL, 0x9a95ec54ULL, 0x3a8eaafdULL, 0xcaaabf8eULL, 0xaf8f6d51ULL, 0x5c09684cULL, 0x3a8eaafdULL, 0xac5f3883ULL},
+{0x3a8eaafdULL, 0xcaaabf8eULL, 0xaf8f6d51ULL, 0x5c09684cULL, 0x3a8eaafdULL, 0xac5f3883ULL, 0x340ef308ULL, 0x5c09684cULL, 0x6f22313ULL},
+{0x5c09684cULL, 0x3a8eaafdULL, 0xac5f3883ULL, 0x340ef308ULL, 0x5c09684cULL, 0x6f22313ULL, 0xaee7a245ULL, 0x340ef308ULL, 0xb8209857ULL},
+{0x340ef308ULL, 0x5c09684cULL, 0x6f22313ULL, 0xaee7a245ULL, 0x340ef308ULL, 0xb8209857ULL, 0x3b9c9087ULL, 0xaee7a245ULL, 0xc2eadcbdULL},
+{0xaee7a245ULL, 0x340ef308ULL, 0xb8209857ULL, 0x3b9c9087ULL, 0xaee7a245ULL, 0xc2eadcbdULL, 0x2c161aecULL, 0x3b9c9087ULL, 0x998e997dULL},
+{0x3b9c9087ULL, 0xaee7a245ULL, 0xc2eadcbdULL, 0x2c161aecULL, 0x3b9c9087ULL, 0x998e997dULL, 0x489334e7ULL, 0x2c161aecULL, 0x8e2cf8d3ULL},
+{0x2c161aecULL, 0x3b9c9087ULL, 0x998e997dULL, 0x489334e7ULL, 0x2c161aecULL, 0x8e2cf8d3ULL, 0xd75ddf47ULL, 0x489334e7ULL, 0x91c0b87bULL},
+{0x489334e7ULL, 0x2c161aecULL, 0x8e2cf8d3ULL, 0xd75ddf47ULL, 0x489334e7ULL, 0x91c0b87bULL, 0x342b6274ULL, 0xd75ddf47ULL, 0x27f56417ULL},
+{0xd75ddf47ULL, 0x489334e7ULL, 0x91c0b87bULL, 0x342b6274ULL, 0xd75ddf47ULL, 0x27f56417ULL, 0x33daed3fULL, 0x342b6274ULL, 0x3e836a2aULL},
+{0x342b6274ULL, 0xd75ddf47ULL, 0x27f56417ULL, 0x33daed3fULL, 0x342b6274ULL, 0x3e836a2aULL, 0x59bfac54ULL, 0x33daed3fULL, 0xe75130efULL},
+{0x33daed3fULL, 0x342b6274ULL, 0x3e836a2aULL, 0x59bfac54ULL, 0x33daed3fULL, 0xe75130efULL, 0xffc1223dULL, 0x59bfac54ULL, 0xc6eeeca6ULL},
+{0x59bfac54ULL, 0x33daed3fULL, 0xe75130efULL, 0xffc1223dULL, 0x59bfac54ULL, 0xc6eeeca6ULL, 0xa69bb596ULL, 0xffc1223dULL, 0xf3b3238cULL},
+{0xffc1223dULL, 0x59bfac54ULL, 0xc6eeeca6ULL, 0xa69bb596ULL, 0xffc1223dULL, 0xf3b3238cULL, 0xdad02021ULL, 0xa69bb596ULL, 0x124b112aULL},
+{0xa69bb596ULL, 0xffc1223dULL, 0xf3b3238cULL, 0xdad02021ULL, 0xa69bb596ULL, 0x124b112aULL, 0x5e262daULL, 0xdad02021ULL, 0xe9f99accULL},
+{0xdad02021ULL, 0xa69bb596ULL, 0x124b112aULL, 0x5e262daULL, 0xdad02021ULL, 0xe9f99accULL, 0x135dd14bULL, 0x5e262daULL, 0x470144d7ULL},
+{0x5e262daULL, 0xdad02021ULL, 0xe9f99accULL, 0x135dd14bULL, 0x5e262daULL, 0x470144d7ULL, 0x25a11348ULL, 0x135dd14bULL, 0xe86a51b2ULL},
+{0x135dd14bULL, 0x5e262daULL, 0x470144d7ULL, 0x25a11348ULL, 0x135dd14bULL, 0xe86a51b2ULL, 0x97004f53ULL, 0x25a11348ULL, 0xf1e45599ULL},
+{0x25a11348ULL, 0x135dd14bULL, 0xe86a51b2ULL, 0x97004f53ULL, 0x25a11348ULL, 0xf1e45599ULL, 0xc7f53db3ULL, 0x97004f53ULL, 0x4a453f76ULL},
+{0x97004f53ULL, 0x25a11348ULL, 0xf1e45599ULL, 0xc7f53db3ULL, 0x97004f53ULL, 0x4a453f76ULL, 0xc89a2c89ULL, 0xc7f53db3ULL, 0xbe558fe6ULL},
+{0xc7f53db3ULL, 0x97004f53ULL, 0x4a453f76ULL, 0xc89a2c89ULL, 0xc7f53db3ULL, 0xbe558fe6ULL, 0x2621bf49ULL, 0xc89a2c89ULL, 0xbc749549ULL},
+{0xc89a2c89ULL, 0xc7f53db3ULL, 0xbe558fe6ULL, 0x2621bf49ULL, 0xc89a2c89ULL, 0xbc749549ULL, 0x2b6aa809ULL, 0x2621bf49ULL, 0x7db541f3ULL},
+{0x2621bf49ULL, 0xc89a2c89ULL, 0xbc749549ULL, 0x2b6aa809ULL, 0x2621bf49ULL, 0x7db541f3ULL, 0xc5c0e825ULL, 0x2b6aa809ULL, 0xd426a874ULL},
+{0x2b6aa809ULL, 0x2621bf49ULL, 0x7db541f3ULL, 0xc5c0e825ULL, 0x2b6aa809ULL, 0xd426a874ULL, 0x7713571aULL, 0xc5c0e825ULL, 0x68942e9bULL},
+{0xc5c0e825ULL, 0x2b6aa809ULL, 0xd426a874ULL, 0x7713571aULL, 0xc5c0e825ULL, 0x68942e9bULL, 0x3ae11191ULL, 0x7713571aULL, 0x443dc3aeULL},
+{0x7713571aULL, 0xc5c0e825ULL, 0x68942e9bULL, 0x3ae11191ULL, 0x7713571aULL, 0x443dc3aeULL, 0xa45164a9ULL, 0x3ae11191ULL, 0x66104f9bULL},
+{0x3ae11191ULL, 0x7713571aULL, 0x443dc3aeULL, 0xa45164a9ULL, 0x3ae11191ULL, 0x66104f9bULL, 0xeb06f2ceULL, 0xa45164a9ULL, 0x120ab3daULL},
+{0xa45164a9ULL, 0x3ae11191ULL, 0x66104f9bULL, 0xeb06f2ceULL, 0xa45164a9ULL, 0x120ab3daULL, 0x1e761db4ULL, 0xeb06f2ceULL, 0xb8bf0d81ULL},
+{0xeb06f2ceULL, 0xa45164a9ULL, 0x120ab3daULL, 0x1e761db4ULL, 0xeb06f2ceULL, 0xb8bf0d81ULL, 0x4e62920bULL, 0x1e761db4ULL, 0x2e69770cULL},
+{0x1e761db4ULL, 0xeb06f2ceULL, 0xb8bf0d81ULL, 0x4e62920bULL, 0x1e761db4ULL, 0x2e69770cULL, 0x5231532bULL, 0x4e62920bULL, 0xfa874942ULL},
+{0x4e62920bULL, 0x1e761db4ULL, 0x2e69770cULL, 0x5231532bULL, 0x4e62920bULL, 0xfa874942ULL, 0xbb541df3ULL, 0x5231532bULL, 0x4c618a3dULL},
+{0x5231532bULL, 0x4e62920bULL, 0xfa874942ULL, 0xbb541df3ULL, 0x5231532bULL, 0x4c618a3dULL, 0x4f2e6f4fULL, 0xbb541df3ULL, 0x3d066618ULL},
+{0xbb541df3ULL, 0x5231532bULL, 0x4c618a3dULL, 0x4f2e6f4fULL, 0xbb541df3ULL, 0x3d066618ULL, 0xc7a3157eULL, 0x4f2e6f4fULL, 0xf67b950fULL},
+{0x4f2e6f4fULL, 0xbb541df3ULL, 0x3d066618ULL, 0xc7a3157eULL, 0x4f2e6f4fULL, 0xf67b950fULL, 0x11ee7c4bULL, 0xc7a3157eULL, 0x184217f3ULL},
+{0xc7a3157eULL, 0x4f2e6f4fULL, 0xf67b950fULL, 0x11ee7c4bULL, 0xc7a3157eULL, 0x184217f3ULL, 0x57403695ULL, 0x11ee7c4bULL, 0xc5841c2eULL},
+{0x11ee7c4bULL, 0xc7a3157eULL, 0x184217f3ULL, 0x57403695ULL, 0x11ee7c4bULL, 0xc5841c2eULL, 0x6b44e662ULL, 0x57403695ULL, 0xbd3c8916ULL}},
+  {{0x57403695ULL, 0x11ee7c4bULL, 0xc5841c2eULL, 0x6b44e662ULL, 0x57403695ULL, 0xbd3c8916ULL, 0x70314de2ULL, 0x6b44e662ULL, 0xd135f878ULL},
+{0x7cb458e4ULL, 0xaf8cabbULL, 0x8345f9e4ULL, 0xb8fda124ULL, 0x7cb458e4ULL, 0xcb39c2a8ULL, 0xfdc374c3ULL, 0xb8fda124ULL, 0x8e77999fULL},
+{0xf2d0872aULL, 0x8f17192bULL, 0x602097d0ULL, 0xc0676590ULL, 0xf2d0872aULL, 0x82a7d6e9ULL, 0xef75752aULL, 0xc0676590ULL, 0x942fbd2bULL},
+{0x30742163ULL, 0x996c4b8cULL, 0xf87ae05bULL, 0xc819096ULL, 0x30742163ULL, 0xb150ec64ULL, 0xc10c3308ULL, 0xc819096ULL, 0xdc1c3636ULL},
+{0xc0e5cebfULL, 0x5bdc41aaULL, 0x666b4329ULL, 0xcb273492ULL, 0xc0e5cebfULL, 0x6d678d07ULL, 0x2bd702b9ULL, 0xcb273492ULL, 0xe8cc9615ULL},
+{0x60ace519ULL, 0x85ca41f8ULL, 0x2510485ULL, 0xd7a90230ULL, 0x60ace519ULL, 0xc469ada2ULL, 0x18af945dULL, 0xd7a90230ULL, 0x414ef26fULL},
+{0xa2495104ULL, 0x40be518bULL, 0x4a7431efULL, 0xf2984a66ULL, 0xa2495104ULL, 0x5df3bd1cULL, 0x9a1b17eaULL, 0xf2984a66ULL, 0x7bb71243ULL},
+{0x1c732b2aULL, 0xc58f9d15ULL, 0xcd2c7266ULL, 0xa4411fccULL, 0x1c732b2aULL, 0xa5dcd603ULL, 0x5fbcfeb2ULL, 0xa4411fccULL, 0x3d996538ULL},
+{0x9ba1f8c7ULL, 0xae9e6332ULL, 0x388172daULL, 0xd199dd98ULL, 0x9ba1f8c7ULL, 0x94dfa0dcULL, 0x22a64263ULL, 0xd199dd98ULL, 0x4c205913ULL},
+{0xc0bb47b5ULL, 0x94b0d760ULL, 0x3bc1353bULL, 0xb45efb5cULL, 0xc0bb47b5ULL, 0xc6f8ed4eULL, 0x75f75b39ULL, 0xb45efb5cULL, 0xe1eb8322ULL},
+{0xba7171abULL, 0xb8818c07ULL, 0x608dacf2ULL, 0x703ccd69ULL, 0xba7171abULL, 0xdeb2d9e3ULL, 0x9976af94ULL, 0x703ccd69ULL, 0x95016bd8ULL},
+{0x99030999ULL, 0x2e973c10ULL, 0xee0d9c89ULL, 0x18019530ULL, 0x99030999ULL, 0xa7e97ff6ULL, 0xbe31ba5aULL, 0x18019530ULL, 0xabf0e55bULL},
+{0x1adc32cbULL, 0xf72979c1ULL, 0xa4c951a4ULL, 0x7055febfULL, 0x1adc32cbULL, 0xf8e78279ULL, 0x21bc0a50ULL, 0x7055febfULL, 0xc76a96bdULL},
+{0x848ab8ccULL, 0xfa161935ULL, 0xa3381afeULL, 0x45d546b0ULL, 0x848ab8ccULL, 0xe8bc39efULL, 0x9cd1f6f5ULL, 0x45d546b0ULL, 0xcd62db0aULL},
+{0x8ececb00ULL, 0x3a4543c3ULL, 0xcc875a37ULL, 0x5e29df10ULL, 0x8ececb00ULL, 0xf7a4b1f3ULL, 0x5bde2699ULL, 0x5e29df10ULL, 0x5417b0ccULL},
+{0x8079db23ULL, 0xc6469b94ULL, 0xe5152b3aULL, 0x1133c12aULL, 0x8079db23ULL, 0x22130be3ULL, 0x5981c82eULL, 0x1133c12aULL, 0xae88fdf6ULL},
+{0xe76d2d3aULL, 0xa6b50c4bULL, 0x82fc6484ULL, 0x9f109ed3ULL, 0xe76d2d3aULL, 0xffb80a28ULL, 0xa8d9fa64ULL, 0x9f109ed3ULL, 0x60374d46ULL},
+{0xf8e059deULL, 0x2430dcULL, 0xef08c18aULL, 0xbf48f57aULL, 0xf8e059deULL, 0x613404bcULL, 0x9a370154ULL, 0xbf48f57aULL, 0x4f10cfbeULL},
+{0xc850b2c3ULL, 0xd62de97cULL, 0x6a6be678ULL, 0xe29ad596ULL, 0xc850b2c3ULL, 0x5b6843fULL, 0x747c8776ULL, 0xe29ad596ULL, 0x282fe182ULL},
+{0x69e9cfdbULL, 0xa7df96feULL, 0xa37fcc46ULL, 0xebeba33cULL, 0x69e9cfdbULL, 0xc470cf1dULL, 0xf73e6bc0ULL, 0xebeba33cULL, 0xb30e76a2ULL},
+{0xb9b39e1bULL, 0xa457a4c1ULL, 0xc80ee316ULL, 0x4dc419c8ULL, 0xb9b39e1bULL, 0x8ff79a44ULL, 0x349c2fa7ULL, 0x4dc419c8ULL, 0x72f63b47ULL},
+{0x2f335f36ULL, 0x4ac8d9a6ULL, 0xd43360efULL, 0x6e376039ULL, 0x2f335f36ULL, 0xf1194ecaULL, 0xce6123d4ULL, 0x6e376039ULL, 0xcef8fff1ULL},
+{0x195c2fbULL, 0x9efc0d6aULL, 0x82f234b0ULL, 0xaa3e2340ULL, 0x195c2fbULL, 0xf4fd6e7dULL, 0x3b3b8c6dULL, 0xaa3e2340ULL, 0x2feba18eULL},
+{0x71c6cf4dULL, 0x8b0658c6ULL, 0x5a0bdd19ULL, 0xa0e210acULL, 0x71c6cf4dULL, 0xa2a45757ULL, 0x8fb9afb5ULL, 0xa0e210acULL, 0xc2f58ce5ULL},
+{0xa2ce21b5ULL, 0x18382e96ULL, 0x5c83f812ULL, 0x13090c8ULL, 0xa2ce21b5ULL, 0x1e0afae8ULL, 0x9cef6d6dULL, 0x13090c8ULL, 0xe4f75cebULL},
+{0x891b426bULL, 0x6459a122ULL, 0x830164fcULL, 0x3cdbb33ULL, 0x891b426bULL, 0x21d012cULL, 0xa00b4c45ULL, 0x3cdbb33ULL, 0x90573cfULL},
+{0x9e8e27d4ULL, 0xd08f0df9ULL, 0xc83a1eb1ULL, 0x25da5651ULL, 0x9e8e27d4ULL, 0xcada4ddcULL, 0x54215420ULL, 0x25da5651ULL, 0x317510bfULL},
+{0xd9e3c16aULL, 0xac8c693aULL, 0xe9ae9c9aULL, 0x73818b15ULL, 0xd9e3c16aULL, 0x589e5decULL, 0x7f1657d1ULL, 0x73818b15ULL, 0x6a588cb9ULL},
+{0xcb87a882ULL, 0xc23d79eeULL, 0x5e4f563dULL, 0xf378bd01ULL, 0xcb87a882ULL, 0xb0cdc93ULL, 0x35117617ULL, 0xf378bd01ULL, 0x4a2586c9ULL},
+{0x39be7afULL, 0x7cb6f17ULL, 0x3d636f55ULL, 0xe7f5998ULL, 0x39be7afULL, 0x45e40920ULL, 0x69a33c04ULL, 0xe7f5998ULL, 0x8db7d78bULL},
+{0xea798257ULL, 0x93121795ULL, 0x67bd8d26ULL, 0xf05ef23aULL, 0xea798257ULL, 0x20b3f632ULL, 0xcf29d3e1ULL, 0xf05ef23aULL, 0x98898b3cULL},
+{0x7c1ff4a5ULL, 0x2cb05823ULL, 0xec4547b4ULL, 0xa4cc6934ULL, 0x7c1ff4a5ULL, 0xd52bf61bULL, 0xa9549cf2ULL, 0xa4cc6934ULL, 0x6a3b6eb3ULL},
+{0x6dba854bULL, 0x172674a1ULL, 0x6400296eULL, 0x7046b3e5ULL, 0x6dba854bULL, 0xed6d574dULL, 0xeea17c2fULL, 0x7046b3e5ULL, 0x9a67fc6fULL},
+{0xe0bc5d28ULL, 0x5b107c9bULL, 0x861ba196ULL, 0xa256d812ULL, 0xe0bc5d28ULL, 0x2f04619fULL, 0x750f35fcULL, 0xa256d812ULL, 0xee9685caULL},
+{0xea5bd960ULL, 0xc87905b9ULL, 0x7ebd4ab7ULL, 0xdb016097ULL, 0xea5bd960ULL, 0x23d5741fULL, 0xb24a5966ULL, 0xdb016097ULL, 0x377d2bdaULL},
+{0xf6217876ULL, 0xbac3cfcbULL, 0x830d08c5ULL, 0x95a64feaULL, 0xf6217876ULL, 0xe129d07ULL, 0x3dd5ee65ULL, 0x95a64feaULL, 0xbf8a54d6ULL},
+{0x4605ab44ULL, 0x2475b5c9ULL, 0x868c399eULL, 0xe2ef1b6bULL, 0x4605ab44ULL, 0x6fdb90dfULL, 0x176c273bULL, 0xe2ef1b6bULL, 0x6df16dfaULL},
+{0x23f9cc43ULL, 0xaab98311ULL, 0x657ff87aULL, 0x999ff402ULL, 0x23f9cc43ULL, 0x751aa1acULL, 0xb3692d65ULL, 0x999ff402ULL, 0xffe5f2f1ULL},
+{0x171cdeb6ULL, 0xc0f50298ULL, 0x19f42ce3ULL, 0x1c581e97ULL, 0x171cdeb6ULL, 0x6f60a28bULL, 0x686e1b6ULL, 0x1c581e97ULL, 0x8ee0dde6ULL},
+{0xe17c3c1eULL, 0x6e1308a4ULL, 0x6b9cd444ULL, 0xb64f28adULL, 0xe17c3c1eULL, 0x86a303a5ULL, 0x48305814ULL, 0xb64f28adULL, 0xa54173b0ULL},
+{0x4da794fcULL, 0x56e5e75dULL, 0xc22e1c4fULL, 0xa824b2b9ULL, 0x4da794fcULL, 0xa938409dULL, 0xd9481b32ULL, 0xa824b2b9ULL, 0x6406ae85ULL},
+{0xe445aef9ULL, 0xf1c31a32ULL, 0x8a5e7fbcULL, 0x9e61082eULL, 0xe445aef9ULL, 0x171a2ae9ULL, 0x3aac1b58ULL, 0x9e61082eULL, 0x742e47cbULL},
+{0xdf37f1d9ULL, 0x827d84c0ULL, 0xb96ddaa1ULL, 0x934e7c03ULL, 0xdf37f1d9ULL, 0xe7a16b9ULL, 0x31e44277ULL, 0x934e7c03ULL, 0xb6e36af6ULL},
+{0x4cf39070ULL, 0xc9b06e35ULL, 0x55decc50ULL, 0xae38ef5fULL, 0x4cf39070ULL, 0x16277d54ULL, 0x82b644d8ULL, 0xae38ef5fULL, 0x1e84edecULL},
+{0x8a10f528ULL, 0xd922d34dULL, 0x785b76faULL, 0x207b93a2ULL, 0x8a10f528ULL, 0xa6730c3dULL, 0xe5e5bfc2ULL, 0x207b93a2ULL, 0xfd14df2bULL},
+{0xc529ed2ULL, 0x2199a3b3ULL, 0xd7c461e7ULL, 0x32c591b3ULL, 0xc529ed2ULL, 0x2876094aULL, 0xc2ca84e9ULL, 0x32c591b3ULL, 0x24da15e0ULL},
+{0x666f1c1dULL, 0xdbda1643ULL, 0xb0bf3ee6ULL, 0x67b52b11ULL, 0x666f1c1dULL, 0xb670cb2aULL, 0xc5ef7d3eULL, 0x67b52b11ULL, 0xa07ad4a2ULL},
+{0x5e60e161ULL, 0x7a8c7e9dULL, 0x3509b22ULL, 0x8f633e02ULL, 0x5e60e161ULL, 0x67892d85ULL, 0x42b1389fULL, 0x8f633e02ULL, 0x465de9c4ULL},
+{0xa530311ULL, 0x5a654ef2ULL, 0x53732cceULL, 0x411de074ULL, 0xa530311ULL, 0x36958c68ULL, 0x3de914f2ULL, 0x411de074ULL, 0xc49ad3e6ULL},
+{0x1148c447ULL, 0xff76fa12ULL, 0x1d17ca39ULL, 0x9ac94456ULL, 0x1148c447ULL, 0x63d1a88bULL, 0xfec984d8ULL, 0x9ac94456ULL, 0x8423b8b1ULL},
+{0xb2b9bcd4ULL, 0xe504aebdULL, 0x416c03a0ULL, 0x10d8b252ULL, 0xb2b9bcd4ULL, 0x302df17cULL, 0x5a7fdae8ULL, 0x10d8b252ULL, 0x5a6760ceULL},
+{0x984c1707ULL, 0xc3c8f99aULL, 0xa47a5075ULL, 0xb689dc96ULL, 0x984c1707ULL, 0xb95ddca2ULL, 0x7aaa971ULL, 0xb689dc96ULL, 0x647db237ULL},
+{0xa1932fa4ULL, 0x21e25a24ULL, 0xdf887b54ULL, 0xce306fc3ULL, 0xa1932fa4ULL, 0xe02df9e0ULL, 0xb77de30eULL, 0xce306fc3ULL, 0xbae6c579ULL},
+{0x7b3c2649ULL, 0xd3efbb1eULL, 0x8e14c64ULL, 0xe675c59ULL, 0x7b3c2649ULL, 0x9d59b084ULL, 0x421505f3ULL, 0xe675c59ULL, 0xd1a9c2abULL},
+{0x15628109ULL, 0x76909e75ULL, 0x3c2cd65dULL, 0xc813fd4bULL, 0x15628109ULL, 0x28973e8aULL, 0x42b64b9bULL, 0xc813fd4bULL, 0x87767e0eULL},
+{0x11fc0837ULL, 0x8f2c04fbULL, 0x2088261ULL, 0x41951d25ULL, 0x11fc0837ULL, 0xe665912ULL, 0xc27fef3ULL, 0x41951d25ULL, 0xfbe531d0ULL},
+{0xec177543ULL, 0xf5e2c74fULL, 0xdbc1a57eULL, 0xd9b9b56dULL, 0xec177543ULL, 0xf123dfa0ULL, 0xd66a4485ULL, 0xd9b9b56dULL, 0x9bdbadd4ULL},
+{0x91403d92ULL, 0xf6a24794ULL, 0x2e057eeaULL, 0xad6a11cULL, 0x91403d92ULL, 0xfe813cf6ULL, 0xa6ae3c82ULL, 0xad6a11cULL, 0xd98136c3ULL},
+{0x7fa28329ULL, 0x4942b298ULL, 0x5c71c209ULL, 0xdd4fe9f9ULL, 0x7fa28329ULL, 0xb2249f6fULL, 0x5971e352ULL, 0xdd4fe9f9ULL, 0x82bde75dULL},
+{0x862b4a3aULL, 0xb70fb8e5ULL, 0x8fbc1221ULL, 0x3b56b56fULL, 0x862b4a3aULL, 0x2997a782ULL, 0xcb23d504ULL, 0x3b56b56fULL, 0x442250f4ULL},
+{0xe836fe25ULL, 0xd4736011ULL, 0xa2718da4ULL, 0xb8940e7aULL, 0xe836fe25ULL, 0x4408e77dULL, 0x23b1c010ULL, 0xb8940e7aULL, 0x46bcb6ddULL},
+{0x44d7051cULL, 0xd186cdbaULL, 0x48799ccULL, 0x86fcaa38ULL, 0x44d7051cULL, 0x7d4f4ee2ULL, 0xe839a976ULL, 0x86fcaa38ULL, 0x2d75ec87ULL},
+{0xa00665fdULL, 0x709e162dULL, 0xeb9b162cULL, 0x2475b24ULL, 0xa00665fdULL, 0xe920d703ULL, 0x6a917999ULL, 0x2475b24ULL, 0xed008c3dULL},
+{0xe01f8bb6ULL, 0x3e1b7222ULL, 0x6b3d8e20ULL, 0x3cec73eeULL, 0xe01f8bb6ULL, 0x4f6d3bf8ULL, 0x1080c0e6ULL, 0x3cec73eeULL, 0xed312f90ULL},
+{0xfa285a0fULL, 0xe9a58619ULL, 0xdeaa7685ULL, 0x6ba652aULL, 0xfa285a0fULL, 0x3c43eaafULL, 0x1b98bc97ULL, 0x6ba652aULL, 0x7aabaefeULL},
+{0xde10f95dULL, 0xf5608dc5ULL, 0xd55781f9ULL, 0xf2da23c1ULL, 0xde10f95dULL, 0x785283f6ULL, 0x49f5377dULL, 0xf2da23c1ULL, 0x9ef4aef5ULL},
+{0x74f1b5beULL, 0x3ea9110bULL, 0xa8512732ULL, 0xf9dcbf36ULL, 0x74f1b5beULL, 0xce792ea7ULL, 0xef1cc804ULL, 0xf9dcbf36ULL, 0x1b497bbbULL},
+{0x68a7d27eULL, 0x77be5d27ULL, 0xc0e5c05cULL, 0xd7a2d45fULL, 0x68a7d27eULL, 0x3f552bd4ULL, 0x9425f923ULL, 0xd7a2d45fULL, 0xcef9348eULL},
+{0x1f3929f8ULL, 0x5c4f6f43ULL, 0x8b39bb9ULL, 0x9a4d875fULL, 0x1f3929f8ULL, 0x4e9f2525ULL, 0x238b6fbbULL, 0x9a4d875fULL, 0xff7f96b2ULL},
+{0x139af3aaULL, 0x136bfd98ULL, 0x7b540cb8ULL, 0x8715762dULL, 0x139af3aaULL, 0x2abbaae7ULL, 0xbbc068ccULL, 0x8715762dULL, 0xbf898536ULL},
+{0x299bb66cULL, 0x7ba2a405ULL, 0x65839ae4ULL, 0x9747c404ULL, 0x299bb66cULL, 0x888eb7c9ULL, 0xf7eef124ULL, 0x9747c404ULL, 0x845c223cULL},
+{0x3b4d6e2fULL, 0xefda87c0ULL, 0xfd450da0ULL, 0x3a726329ULL, 0x3b4d6e2fULL, 0xb07d6954ULL, 0x3d349840ULL, 0x3a726329ULL, 0x11ca3e84ULL},
+{0xa8fa75ecULL, 0xa072ca6ULL, 0x8a3539c7ULL, 0xcaff594aULL, 0xa8fa75ecULL, 0xe7596c2bULL, 0xd9d06915ULL, 0xcaff594aULL, 0x80e6f172ULL},
+{0xf15bb247ULL, 0xd047da35ULL, 0xcb037248ULL, 0xe4da59d3ULL, 0xf15bb247ULL, 0x9d3719a7ULL, 0xa580859bULL, 0xe4da59d3ULL, 0xcf61802fULL},
+{0x565d8c3cULL, 0xe6e5a0e7ULL, 0x2d90aa07ULL, 0x6a84e98aULL, 0x565d8c3cULL, 0x59689979ULL, 0x1386e93fULL, 0x6a84e98aULL, 0x74f4523ULL},
+{0x6ab7c4bULL, 0x97272226ULL, 0xebf64794ULL, 0xd4dcb618ULL, 0x6ab7c4bULL, 0x3bffb277ULL, 0xd3f97f49ULL, 0xd4dcb618ULL, 0x4ee50fdcULL},
+{0xdde9a5e3ULL, 0xa903629eULL, 0xc7a23e78ULL, 0x6cd2488eULL, 0xdde9a5e3ULL, 0xebd8c5c2ULL, 0xeebd11afULL, 0x6cd2488eULL, 0xf4bd9556ULL},
+{0x9fb65e9fULL, 0x3aff1179ULL, 0xf3504e7aULL, 0xcc483acaULL, 0x9fb65e9fULL, 0xa09c7eddULL, 0x6cddc55fULL, 0xcc483acaULL, 0xc982f322ULL},
+{0xa791805fULL, 0x7195a7ceULL, 0xac67b1bdULL, 0xfda26ffcULL, 0xa791805fULL, 0x75e6e350ULL, 0xf4b48f61ULL, 0xfda26ffcULL, 0xeeff94deULL},
+{0x55bfb306ULL, 0xd7b6d0f9ULL, 0x5d91ccd3ULL, 0xdad81fefULL, 0x55bfb306ULL, 0x361dd5f8ULL, 0xde765545ULL, 0xdad81fefULL, 0x48d2df0cULL},
+{0x25e69835ULL, 0x9bbd9138ULL, 0x4c2b1ca2ULL, 0x9995f5d8ULL, 0x25e69835ULL, 0x566abf83ULL, 0xd115e56dULL, 0x9995f5d8ULL, 0x26a81706ULL},
+{0xec61df9cULL, 0x98415d79ULL, 0x8c775adaULL, 0x1da9c41ULL, 0xec61df9cULL, 0xd7284d5dULL, 0x676f1695ULL, 0x1da9c41ULL, 0x629d9ad3ULL},
+{0xeb607d07ULL, 0xd3ad9addULL, 0xe54e43a8ULL, 0xfe74d71dULL, 0xeb607d07ULL, 0xd8e34e2bULL, 0x988d1c8aULL, 0xfe74d71dULL, 0xe5062a2cULL},
+{0x6fc02b19ULL, 0xe48a54abULL, 0xbbdbe327ULL, 0x985ecf00ULL, 0x6fc02b19ULL, 0x483fe85cULL, 0x4042104fULL, 0x985ecf00ULL, 0x9b42167bULL},
+{0x7b63b58bULL, 0x5acaeed4ULL, 0x643c6c5eULL, 0x26dd1b19ULL, 0x7b63b58bULL, 0x57b06ebeULL, 0x918dddb7ULL, 0x26dd1b19ULL, 0x7e5ec726ULL},
+{0xfe7e24b4ULL, 0xf4f5842bULL, 0xc0dbd7ecULL, 0xdc6f51fULL, 0xfe7e24b4ULL, 0xf84a5f08ULL, 0x77f3578bULL, 0xdc6f51fULL, 0x957394baULL},
+{0x9734f0d5ULL, 0x70121a25ULL, 0xba07eda3ULL, 0x5273b6dbULL, 0x9734f0d5ULL, 0x665de04eULL, 0xbf2c8219ULL, 0x5273b6dbULL, 0xe3f2ff82ULL},
+{0x6e6873ddULL, 0xaaafda2eULL, 0xa08c8972ULL, 0x2dd37dc4ULL, 0x6e6873ddULL, 0x59c132ddULL, 0x2518517aULL, 0x2dd37dc4ULL, 0x69da7c61ULL},
+{0x17b0fbb0ULL, 0xe4855935ULL, 0x79a6a45eULL, 0x1063788ULL, 0x17b0fbb0ULL, 0xecb89927ULL, 0xebd857d1ULL, 0x1063788ULL, 0x265e1e41ULL},
+{0x4502f83cULL, 0x752b4a53ULL, 0x9f92b62fULL, 0xef2081a3ULL, 0x4502f83cULL, 0xdb93eec2ULL, 0xe47eef65ULL, 0xef2081a3ULL, 0x38530c4dULL},
+{0x52559606ULL, 0xe25d35afULL, 0x73530febULL, 0x50692a1aULL, 0x52559606ULL, 0xffa7847ULL, 0x633a871eULL, 0x50692a1aULL, 0xb99aa6d9ULL},
+{0x3214e315ULL, 0xd4da3877ULL, 0xacf45d25ULL, 0x140f4183ULL, 0x3214e315ULL, 0x587824baULL, 0xe322d856ULL, 0x140f4183ULL, 0x83fa228ULL},
+{0x188338c6ULL, 0x85733eacULL, 0x8d29b75ULL, 0x4d36af6bULL, 0x188338c6ULL, 0x87aaf00ULL, 0x1af99417ULL, 0x4d36af6bULL, 0xc1492dd5ULL},
+{0x7878f91bULL, 0x2048d496ULL, 0x47aec559ULL, 0x96c959edULL, 0x7878f91bULL, 0xd59880efULL, 0xa59e3e18ULL, 0x96c959edULL, 0x3fbfd16bULL},
+{0x1494655bULL, 0x90391e53ULL, 0x7a7e34d2ULL, 0xc5409b13ULL, 0x1494655bULL, 0xd615c5dULL, 0x3d0a254eULL, 0xc5409b13ULL, 0xd937ad7fULL},
+{0x1cd60494ULL, 0xb9b46295ULL, 0x8d8b1b63ULL, 0x701b399ULL, 0x1cd60494ULL, 0xfc6167b1ULL, 0x2e275db9ULL, 0x701b399ULL, 0x1fa32bd7ULL},
+{0xb578cfdfULL, 0x6d3ac03aULL, 0xc1ee394fULL, 0xc2b889d1ULL, 0xb578cfdfULL, 0x695268f0ULL, 0xdf81d5b9ULL, 0xc2b889d1ULL, 0xaeb0f2bbULL},
+{0x6cdf9698ULL, 0x38981e07ULL, 0x60a7b447ULL, 0x15b66968ULL, 0x6cdf9698ULL, 0xebb180e4ULL, 0x30c836e3ULL, 0x15b66968ULL, 0x5e732257ULL},
+{0x4afe547cULL, 0x978d875bULL, 0xe8691c09ULL, 0xe31f2af5ULL, 0x4afe547cULL, 0xb91429e0ULL, 0x543de944ULL, 0xe31f2af5ULL, 0xc363be9aULL},
+{0x95b8cb9ULL, 0xe2ee2ec2ULL, 0x3894b61eULL, 0xf6e36045ULL, 0x95b8cb9ULL, 0xdda2e023ULL, 0x99507f6cULL, 0xf6e36045ULL, 0x478101a0ULL},
+{0xb20b71f7ULL, 0xb9f2e378ULL, 0xbfcd25c7ULL, 0x4a3476e1ULL, 0xb20b71f7ULL, 0x6e56cf9aULL, 0x5f65ce16ULL, 0x4a3476e1ULL, 0x13ce9c64ULL},
+{0x3c5f7c3fULL, 0x7a750ad3ULL, 0x215edf7cULL, 0x6ea3cbb1ULL, 0x3c5f7c3fULL, 0x1fe20370ULL, 0x977e25deULL, 0x6ea3cbb1ULL, 0xac05cb65ULL},
+{0xeade2a56ULL, 0xc6e9c59dULL, 0xf1b31386ULL, 0xf281beb8ULL, 0xeade2a56ULL, 0x5ad5ec5bULL, 0xd3a62da8ULL, 0xf281beb8ULL, 0xbe619f66ULL},
+{0xae78d84cULL, 0x8c4ca9c8ULL, 0xeed34ea7ULL, 0x8e3f99c7ULL, 0xae78d84cULL, 0x9faed04eULL, 0x37df0ca9ULL, 0x8e3f99c7ULL, 0x530bcf6eULL},
+{0xa5905dfaULL, 0x1927b3e8ULL, 0xd25487c4ULL, 0xe440f66eULL, 0xa5905dfaULL, 0xa75418adULL, 0x50230ca8ULL, 0xe440f66eULL, 0xe8a9a2a1ULL},
+{0x28f4cb73ULL, 0xe5176ce2ULL, 0xa13ef69fULL, 0xa1d3e707ULL, 0x28f4cb73ULL, 0xc47722eULL, 0x1a421409ULL, 0xa1d3e707ULL, 0x4c8c20c2ULL},
+{0x7abbaadaULL, 0xc0958983ULL, 0x82e9d119ULL, 0x1c29eb0bULL, 0x7abbaadaULL, 0x8cda70e3ULL, 0xc1bb85bfULL, 0x1c29eb0bULL, 0x7192fcb0ULL},
+{0xb57bb819ULL, 0xb0f576c1ULL, 0xf616721eULL, 0x33c08467ULL, 0xb57bb819ULL, 0x403394c3ULL, 0x2da20339ULL, 0x33c08467ULL, 0xad902328ULL},
+{0x55c8cc69ULL, 0x278333abULL, 0xaba4b7ceULL, 0xa7a8c375ULL, 0x55c8cc69ULL, 0x7693babfULL, 0x35d25178ULL, 0xa7a8c375ULL, 0x1ed18d5cULL},
+{0xd6a7ee89ULL, 0xcb6919a8ULL, 0xc3f14074ULL, 0xa70abfc1ULL, 0xd6a7ee89ULL, 0x259f9f89ULL, 0xb3ea103eULL, 0xa70abfc1ULL, 0xc12aff63ULL},
+{0xf7ba016ULL, 0xfdc085d2ULL, 0x2e50baaULL, 0xa42e90cULL, 0xf7ba016ULL, 0xf9345f30ULL, 0xaa0237edULL, 0xa42e90cULL, 0x889bb603ULL},
+{0x38fa42e8ULL, 0x74edef9aULL, 0xd93f9163ULL, 0xcb87445ULL, 0x38fa42e8ULL, 0x374f7f22ULL, 0x63a31f2bULL, 0xcb87445ULL, 0xf987bf52ULL},
+{0xe423fce1ULL, 0x8b9ce606ULL, 0xcbdef1a6ULL, 0x66d84487ULL, 0xe423fce1ULL, 0x77ee1943ULL, 0x5e9a8908ULL, 0x66d84487ULL, 0x367c847dULL},
+{0x96d81a6dULL, 0x6b9b04d4ULL, 0x62c26785ULL, 0xe7555713ULL, 0x96d81a6dULL, 0x113c73f3ULL, 0x8c98829cULL, 0xe7555713ULL, 0x33c52c75ULL},
+{0x5c0ae2b4ULL, 0x2642551eULL, 0xf280feb9ULL, 0x6fd2be17ULL, 0x5c0ae2b4ULL, 0x87c235adULL, 0xfaea2d19ULL, 0x6fd2be17ULL, 0x4443f14eULL},
+{0xa6eb6ee1ULL, 0x10dad226ULL, 0x481c0e97ULL, 0x4d2e486ULL, 0xa6eb6ee1ULL, 0x9c505cb7ULL, 0x37faef8dULL, 0x4d2e486ULL, 0xe6ec19bfULL},
+{0xe2c12f23ULL, 0xf6a8127ULL, 0xe0e487caULL, 0xd74006faULL, 0xe2c12f23ULL, 0xdc690245ULL, 0xb17d0346ULL, 0xd74006faULL, 0x4328feacULL},
+{0x6831fddbULL, 0x4894a711ULL, 0x6afa0e7aULL, 0xe143c38bULL, 0x6831fddbULL, 0xef8b4edfULL, 0x6d969c47ULL, 0xe143c38bULL, 0xd47b6baeULL},
+{0xd86f2a7ULL, 0x445714acULL, 0x8f604ff2ULL, 0x3c934b3dULL, 0xd86f2a7ULL, 0xfcf79d91ULL, 0xbbaa567bULL, 0x3c934b3dULL, 0x5f5d3947ULL},
+{0x6d766223ULL, 0x8d2c2e18ULL, 0x5be4bf6ULL, 0xbe7ab88cULL, 0x6d766223ULL, 0x8fde27b1ULL, 0x681166f2ULL, 0xbe7ab88cULL, 0x476dd65aULL},
+{0x68fd8cfbULL, 0xd2544112ULL, 0x344f2d70ULL, 0xbd0fb6a9ULL, 0x68fd8cfbULL, 0x4c08f7cULL, 0x4ad41145ULL, 0xbd0fb6a9ULL, 0xa67bdcd5ULL},
+{0x420664d5ULL, 0x6eec764dULL, 0x164d244aULL, 0x10f4cd5bULL, 0x420664d5ULL, 0x617b5e9cULL, 0x644944d0ULL, 0x10f4cd5bULL, 0x671fbebULL},
+{0x9fedfa94ULL, 0xdd3d9646ULL, 0x767cb72dULL, 0x84000327ULL, 0x9fedfa94ULL, 0x5ea378a4ULL, 0x6515e9fbULL, 0x84000327ULL, 0x41502216ULL},
+{0x73f74083ULL, 0x5ed51199ULL, 0x996a2f1aULL, 0xdd9c857bULL, 0x73f74083ULL, 0x8511f078ULL, 0x37d2d3c1ULL, 0xdd9c857bULL, 0x42398078ULL},
+{0x523417fULL, 0x81bd489bULL, 0x575f8870ULL, 0x7967b119ULL, 0x523417fULL, 0x36f6faf7ULL, 0x9639d131ULL, 0x7967b119ULL, 0x260c57adULL},
+{0x5caf5004ULL, 0x4494f627ULL, 0xd049d1c7ULL, 0xadcb6d5bULL, 0x5caf5004ULL, 0x9a0afbb0ULL, 0xf84aac8eULL, 0xadcb6d5bULL, 0x11402e96ULL},
+{0x83886c68ULL, 0x3573738bULL, 0x31cc8572ULL, 0x4e7eab4ULL, 0x83886c68ULL, 0x8865ea1aULL, 0x51329465ULL, 0x4e7eab4ULL, 0x5e8fcb8cULL},
+{0x3ce0008fULL, 0x4e3bd724ULL, 0x664de85bULL, 0xb51231e6ULL, 0x3ce0008fULL, 0xbddcc1dULL, 0x99f2361bULL, 0xb51231e6ULL, 0xd2fe50c3ULL},
+{0x567646c3ULL, 0x29d8fd3dULL, 0x3f3fb176ULL, 0xc304bc4eULL, 0x567646c3ULL, 0xa61d2f24ULL, 0x9ea7a76bULL, 0xc304bc4eULL, 0x84de6aebULL},
+{0x16d5b64ULL, 0x2b0cdd17ULL, 0x7213bda6ULL, 0x7c70aa99ULL, 0x16d5b64ULL, 0x90d10687ULL, 0x19f32a41ULL, 0x7c70aa99ULL, 0x2643ec32ULL},
+{0x734ab424ULL, 0xeb0134baULL, 0x966f6d79ULL, 0xe09fd208ULL, 0x734ab424ULL, 0x4beeda31ULL, 0xd89f8a01ULL, 0xe09fd208ULL, 0xb580f7aULL},
+{0xf180276dULL, 0xc862a341ULL, 0x4d7fc1b2ULL, 0x7a53b2e4ULL, 0xf180276dULL, 0xf65b365aULL, 0xb230f05ULL, 0x7a53b2e4ULL, 0x20436fd1ULL},
+{0x7556aaaeULL, 0x28051a2eULL, 0xe198ff4ULL, 0xea059972ULL, 0x7556aaaeULL, 0xe32361adULL, 0x9c9224b5ULL, 0xea059972ULL, 0x3fd077e9ULL},
+{0x92f9ffd6ULL, 0x78480ef5ULL, 0x6f77d99eULL, 0x83369251ULL, 0x92f9ffd6ULL, 0xd6545e40ULL, 0xb753622eULL, 0x83369251ULL, 0xce25bf6aULL},
+{0x5a26271aULL, 0xd218b939ULL, 0x7ccc30b5ULL, 0xf222da2ULL, 0x5a26271aULL, 0x2163ecfdULL, 0xc2c3c3c2ULL, 0xf222da2ULL, 0xad44697bULL},
+{0xfe5a3af8ULL, 0x15718cefULL, 0x1d5ed385ULL, 0xfa09e334ULL, 0xfe5a3af8ULL, 0x5f500f1fULL, 0xf49b37caULL, 0xfa09e334ULL, 0x166afc34ULL},
+{0xb3e49957ULL, 0x1f286194ULL, 0x6d82e631ULL, 0x3804594bULL, 0xb3e49957ULL, 0x73c59d8eULL, 0x969c0797ULL, 0x3804594bULL, 0x1f426ee5ULL},
+{0x883ab69fULL, 0x7a97568cULL, 0x3e1e9eecULL, 0x5175a306ULL, 0x883ab69fULL, 0xb5f35e68ULL, 0xdced9cb3ULL, 0x5175a306ULL, 0xfe4615f2ULL},
+{0x3c5b10d1ULL, 0xace650c5ULL, 0x68504033ULL, 0xeb91b415ULL, 0x3c5b10d1ULL, 0x4558df7fULL, 0xcf347357ULL, 0xeb91b415ULL, 0x68f7ec51ULL},
+{0x27046bcfULL, 0xef661d79ULL, 0xf7896896ULL, 0x53d3dc9ULL, 0x27046bcfULL, 0x72e11b2ULL, 0x48dafd49ULL, 0x53d3dc9ULL, 0x2ea618dULL},
+{0x9ceb7683ULL, 0xb4653ac0ULL, 0xed5074b2ULL, 0x6bf270fULL, 0x9ceb7683ULL, 0x54db76c8ULL, 0x4cf5f3b7ULL, 0x6bf270fULL, 0x12ffd8faULL},
+{0x83412173ULL, 0x79bd8f11ULL, 0xde4a056aULL, 0xf9c89bd9ULL, 0x83412173ULL, 0x5e3866a6ULL, 0x9fc962bcULL, 0xf9c89bd9ULL, 0x25491497ULL},
+{0x5a8c8896ULL, 0x1cafe5ddULL, 0xb40dfa8cULL, 0x22dc25e7ULL, 0x5a8c8896ULL, 0xd00be74cULL, 0x91086095ULL, 0x22dc25e7ULL, 0x378c50d1ULL},
+{0x90960a0aULL, 0x9664da62ULL, 0xa4c03c0aULL, 0x6d210fe7ULL, 0x90960a0aULL, 0x7544f2d5ULL, 0xb29a3077ULL, 0x6d210fe7ULL, 0x1bb74342ULL},
+{0x366a2110ULL, 0x2e0c548cULL, 0xd5525dd9ULL, 0x77d11c7dULL, 0x366a2110ULL, 0x4d2e95ebULL, 0xf1ab859ULL, 0x77d11c7dULL, 0xe75239ffULL},
+{0x3bec776fULL, 0x55c444d1ULL, 0x12ee6554ULL, 0x39594fe0ULL, 0x3bec776fULL, 0x84f588ceULL, 0x44c92d9dULL, 0x39594fe0ULL, 0x5bbcd953ULL},
+{0xb9c1e2e9ULL, 0xd369b743ULL, 0xe6ec6bfeULL, 0x73b19376ULL, 0xb9c1e2e9ULL, 0x216e191cULL, 0x51d88dbULL, 0x73b19376ULL, 0xf2099fe8ULL},
+{0x7c0e60eeULL, 0x19ee98c2ULL, 0xfd4e97a3ULL, 0xbb17c5aaULL, 0x7c0e60eeULL, 0xa69ff9c6ULL, 0x4aef8f66ULL, 0xbb17c5aaULL, 0xa334c55fULL},
+{0x70d19121ULL, 0xa517861dULL, 0xc81af36aULL, 0x195ad58ULL, 0x70d19121ULL, 0xb01d5175ULL, 0xe60bb940ULL, 0x195ad58ULL, 0xa7928754ULL},
+{0xcea0d94bULL, 0x6f46975bULL, 0x19af09d8ULL, 0x3c09dd4ULL, 0xcea0d94bULL, 0x82e4f959ULL, 0x63d92404ULL, 0x3c09dd4ULL, 0x9df6c628ULL},
+{0xe4fe4392ULL, 0x3602ae1dULL, 0xe401b0a1ULL, 0x5566c204ULL, 0xe4fe4392ULL, 0xc1157ab9ULL, 0xad304a18ULL, 0x5566c204ULL, 0xebbac94bULL},
+{0xad53eb02ULL, 0x1f88b54dULL, 0x36b583c1ULL, 0xb65342ccULL, 0xad53eb02ULL, 0x34022548ULL, 0xc14dee68ULL, 0xb65342ccULL, 0xb571c5abULL},
+{0x492ecfdcULL, 0x1960d276ULL, 0xd9868e87ULL, 0x6a3452f0ULL, 0x492ecfdcULL, 0x5f685e55ULL, 0x8e9d8b40ULL, 0x6a3452f0ULL, 0x16d811cfULL},
+{0x17bd6f6eULL, 0xd25314d3ULL, 0xd52b018fULL, 0xa3b21f32ULL, 0x17bd6f6eULL, 0xfa4d42eULL, 0x73e87b6eULL, 0xa3b21f32ULL, 0x54b88f0ULL},
+{0x49b3a036ULL, 0x45f7ed1dULL, 0x9a753859ULL, 0x2b240208ULL, 0x49b3a036ULL, 0x4466937eULL, 0x1e883b30ULL, 0x2b240208ULL, 0xc98d49dfULL},
+{0x9e7793a7ULL, 0x334e16a3ULL, 0xc3eb6a3dULL, 0xb883471eULL, 0x9e7793a7ULL, 0x8ff26d70ULL, 0x6f967fc7ULL, 0xb883471eULL, 0xadd97ad1ULL},
+{0x4c6eef31ULL, 0xb9bd68f3ULL, 0x34a9944ULL, 0x31c9d89eULL, 0x4c6eef31ULL, 0x49b91c63ULL, 0x8efacfefULL, 0x31c9d89eULL, 0x3e0b6d08ULL},
+{0x8957615cULL, 0x4b83525cULL, 0x97b19a9dULL, 0xff6b7bdaULL, 0x8957615cULL, 0x705b4b28ULL, 0xd7442506ULL, 0xff6b7bdaULL, 0xff686902ULL},
+{0xc8b7cd9fULL, 0x8ec1be26ULL, 0xca6a41f4ULL, 0xa102c9ebULL, 0xc8b7cd9fULL, 0x12538593ULL, 0x34309a80ULL, 0xa102c9ebULL, 0x1d3d45caULL},
+{0x124cf208ULL, 0x7111ab7bULL, 0xd118b791ULL, 0xb25d56b6ULL, 0x124cf208ULL, 0x758c4ee6ULL, 0x4ed7f6a6ULL, 0xb25d56b6ULL, 0x1d4dc0b2ULL},
+{0x8548f015ULL, 0xb8189ebULL, 0x62ff490aULL, 0xa964b225ULL, 0x8548f015ULL, 0xd475b8c3ULL, 0xf48d9819ULL, 0xa964b225ULL, 0x4860591cULL},
+{0xf999f42fULL, 0xc097d932ULL, 0xaa49370aULL, 0x350fbb9dULL, 0xf999f42fULL, 0x659d1875ULL, 0x7def882eULL, 0x350fbb9dULL, 0x3e504435ULL},
+{0x2a7a7b5aULL, 0x2bf66a1eULL, 0x50045516ULL, 0xd8dd848ULL, 0x2a7a7b5aULL, 0xad8a3740ULL, 0x20ce8a7eULL, 0xd8dd848ULL, 0x1a50e93fULL},
+{0x25a7c8dfULL, 0x559f8803ULL, 0x2fb406b7ULL, 0x154a0947ULL, 0x25a7c8dfULL, 0x76ca6763ULL, 0xc51f178cULL, 0x154a0947ULL, 0x1a5399daULL},
+{0x2f395b03ULL, 0x988ce1d5ULL, 0x8cb9050dULL, 0xb76722e4ULL, 0x2f395b03ULL, 0x7e623782ULL, 0x90d87ccdULL, 0xb76722e4ULL, 0x51607167ULL},
+{0x6ffe65e6ULL, 0x33178c7cULL, 0x10c8a69fULL, 0x644ecaeeULL, 0x6ffe65e6ULL, 0x8481375bULL, 0xe7a13864ULL, 0x644ecaeeULL, 0x1c9ed24eULL},
+{0x2f96177fULL, 0x3c20d93ULL, 0x2147ea0dULL, 0x952b14e4ULL, 0x2f96177fULL, 0xd35b5ccaULL, 0x1d8418e8ULL, 0x952b14e4ULL, 0xbd8a5480ULL},
+{0x294eec14ULL, 0x242e1be5ULL, 0x8cf7174cULL, 0x94856ba7ULL, 0x294eec14ULL, 0xc29e5d15ULL, 0x99e2634ULL, 0x94856ba7ULL, 0x34958be4ULL},
+{0x80b93d1eULL, 0xa7c4478bULL, 0x80ba8bd8ULL, 0x7e035d98ULL, 0x80b93d1eULL, 0xe617ba3cULL, 0xaa4fa8d0ULL, 0x7e035d98ULL, 0x74a4354aULL},
+{0x4f5e6bc0ULL, 0x33692e33ULL, 0x2cc06aadULL, 0xa0eb250bULL, 0x4f5e6bc0ULL, 0x18dcc92cULL, 0x298c4471ULL, 0xa0eb250bULL, 0xb14eb71dULL},
+{0x41a73b8bULL, 0x2674f5aULL, 0xc135b0f7ULL, 0x2405a2dULL, 0x41a73b8bULL, 0x5dae72eaULL, 0xb454eea1ULL, 0x2405a2dULL, 0x4513072cULL},
+{0x73cac86ULL, 0xba85cd12ULL, 0x25b36818ULL, 0xf58f6835ULL, 0x73cac86ULL, 0xea98708bULL, 0x42420b06ULL, 0xf58f6835ULL, 0x3182d3b6ULL},
+{0x295999f8ULL, 0xc4a52fd3ULL, 0xe94d02b8ULL, 0xa541cc4cULL, 0x295999f8ULL, 0xad4afc33ULL, 0x82f45809ULL, 0xa541cc4cULL, 0xb13cce0ULL},
+{0xa1ccacb7ULL, 0x9a63005fULL, 0x29c63ec0ULL, 0x691831f8ULL, 0xa1ccacb7ULL, 0x6fc09434ULL, 0x7cd095deULL, 0x691831f8ULL, 0x85ac079cULL},
+{0x32e24089ULL, 0xa28099ULL, 0xb427e950ULL, 0xca1b4958ULL, 0x32e24089ULL, 0x7b1f9c4dULL, 0x38866e39ULL, 0xca1b4958ULL, 0x1d6318c6ULL},
+{0x309db38dULL, 0x185e140ULL, 0x1be6fdedULL, 0xa79d335ULL, 0x309db38dULL, 0x8a8bd036ULL, 0xee30f158ULL, 0xa79d335ULL, 0x26a4a278ULL},
+{0xf53cf105ULL, 0xdedf4eacULL, 0x5dabe73cULL, 0xf1535d20ULL, 0xf53cf105ULL, 0x63c679a1ULL, 0xe0bd97ecULL, 0xf1535d20ULL, 0x5f73b61aULL},
+{0x11c5e270ULL, 0xce50aeb4ULL, 0xde81563ULL, 0xb2074b96ULL, 0x11c5e270ULL, 0x31e91376ULL, 0xd5df2612ULL, 0xb2074b96ULL, 0x47ec88edULL},
+{0x93d38ea0ULL, 0x61e1a1ffULL, 0x4c69ad77ULL, 0x1f54f46bULL, 0x93d38ea0ULL, 0xd046c489ULL, 0x80699b21ULL, 0x1f54f46bULL, 0x57b144a9ULL},
+{0x7ed0aaa5ULL, 0x73a6701eULL, 0x6a22c92cULL, 0xf968794fULL, 0x7ed0aaa5ULL, 0x2a94050ULL, 0x8eb242a8ULL, 0xf968794fULL, 0x166864c6ULL},
+{0x53c32c98ULL, 0xf45879e9ULL, 0x3651d668ULL, 0x52f0f89aULL, 0x53c32c98ULL, 0x8eb3701eULL, 0xab050e9cULL, 0x52f0f89aULL, 0x473462e2ULL},
+{0x3dc7e406ULL, 0xd7f48de1ULL, 0x7b6eaf29ULL, 0x80a8267fULL, 0x3dc7e406ULL, 0x5cec675fULL, 0xe4bd7862ULL, 0x80a8267fULL, 0xb2d1fd1ULL},
+{0xbc1c796dULL, 0xcdebe047ULL, 0x870de844ULL, 0xc25c8d25ULL, 0xbc1c796dULL, 0x23c5d56eULL, 0x5d7b7856ULL, 0xc25c8d25ULL, 0x48b959b5ULL},
+{0x3c384baaULL, 0x73ed0069ULL, 0x53a8496dULL, 0x7e4809beULL, 0x3c384baaULL, 0xe749c47aULL, 0x413aa64aULL, 0x7e4809beULL, 0xb2b78feULL},
+{0x90052094ULL, 0xfd53cb67ULL, 0x5183e6fdULL, 0x35a84cafULL, 0x90052094ULL, 0x86bf3582ULL, 0xa0656a45ULL, 0x35a84cafULL, 0x5118f1e1ULL},
+{0x2053e431ULL, 0xd8e067bbULL, 0xfdb95255ULL, 0xa2164668ULL, 0x2053e431ULL, 0xa61dcbc3ULL, 0xd32332a7ULL, 0xa2164668ULL, 0x3ba76736ULL},
+{0xad675157ULL, 0xa5431f8ULL, 0x97bdad9aULL, 0x7b9af285ULL, 0xad675157ULL, 0x63fc8af5ULL, 0x203123d6ULL, 0x7b9af285ULL, 0x60dec55bULL},
+{0x831854daULL, 0x52d7a398ULL, 0xb581bb17ULL, 0x723d344dULL, 0x831854daULL, 0xe9976190ULL, 0x49bd15b5ULL, 0x723d344dULL, 0x28f67e4dULL},
+{0xc0d39923ULL, 0xd2675c58ULL, 0xb69f7f99ULL, 0x1645b5bULL, 0xc0d39923ULL, 0xedd5cbeULL, 0x63e579aULL, 0x1645b5bULL, 0xd2bed987ULL},
+{0x32bb27d1ULL, 0x816e0bbdULL, 0xa9a665caULL, 0x4fb4fa9eULL, 0x32bb27d1ULL, 0x589527a5ULL, 0x27401f21ULL, 0x4fb4fa9eULL, 0x99410a05ULL},
+{0x53e110a4ULL, 0x1c1e180aULL, 0xb3867e87ULL, 0x9bf2a7cdULL, 0x53e110a4ULL, 0xea7b0c3ULL, 0x7f3e82b3ULL, 0x9bf2a7cdULL, 0x4c789d84ULL},
+{0x1f97d89bULL, 0xf4ad4e48ULL, 0xaf0332a2ULL, 0x102c1be8ULL, 0x1f97d89bULL, 0xe2961dacULL, 0xfd84d8c4ULL, 0x102c1be8ULL, 0x9e3dd420ULL},
+{0x1c5c465fULL, 0xf0b2b2f1ULL, 0x3d158bb9ULL, 0x4ddf55ULL, 0x1c5c465fULL, 0x1db9a4b0ULL, 0xa950fb3eULL, 0x4ddf55ULL, 0x8bc59aeaULL},
+{0x14f8dd30ULL, 0xe70aae2eULL, 0x4e7a6c6fULL, 0x1ea059d9ULL, 0x14f8dd30ULL, 0x246c3a82ULL, 0x7189801aULL, 0x1ea059d9ULL, 0x3c91190fULL},
+{0xf752f792ULL, 0xd9bfee63ULL, 0xbe1b1f66ULL, 0x54a37d27ULL, 0xf752f792ULL, 0x52cea34bULL, 0x533cba00ULL, 0x54a37d27ULL, 0x2d340338ULL},
+{0x98f01fbfULL, 0xc7dde41cULL, 0xd39d7557ULL, 0xcf364e6cULL, 0x98f01fbfULL, 0x752ac492ULL, 0x3b4a3302ULL, 0xcf364e6cULL, 0x5dbf1724ULL},
+{0xbba5c9efULL, 0xfa46fb70ULL, 0x201df5a5ULL, 0xe672891fULL, 0xbba5c9efULL, 0x69af936ULL, 0x97009d69ULL, 0xe672891fULL, 0x5c1cf67dULL},
+{0x3f1a5bb9ULL, 0x5b963fa9ULL, 0xa37923a3ULL, 0x2e1464afULL, 0x3f1a5bb9ULL, 0xdc86fec6ULL, 0x91d9faeaULL, 0x2e1464afULL, 0x938d033ULL},
+{0xeb8ee6a8ULL, 0x2d9e847fULL, 0x50b6ecdbULL, 0x6c41884ULL, 0xeb8ee6a8ULL, 0x7e3a6523ULL, 0x62400955ULL, 0x6c41884ULL, 0x753edd48ULL},
+{0xba17040cULL, 0xe7a3f9caULL, 0xbcc38264ULL, 0x891eacbbULL, 0xba17040cULL, 0x7438134ULL, 0xfd17d60aULL, 0x891eacbbULL, 0x289d2963ULL},
+{0xb94969beULL, 0x4e5d699eULL, 0x98e93b4ULL, 0x2bb94381ULL, 0xb94969beULL, 0x1e17c4c3ULL, 0x28b3bd67ULL, 0x2bb94381ULL, 0xf07b874bULL},
+{0x4f5db498ULL, 0xc14cc2edULL, 0x8ee118dfULL, 0xc4a1b298ULL, 0x4f5db498ULL, 0x4c217663ULL, 0x676c41adULL, 0xc4a1b298ULL, 0x5aad15d9ULL},
+{0xdbfe317cULL, 0x5c603f54ULL, 0xdebf5048ULL, 0xf6b38a0aULL, 0xdbfe317cULL, 0x8c0c5fe1ULL, 0x5b21f627ULL, 0xf6b38a0aULL, 0xd4de2b33ULL},
+{0x40f9ce49ULL, 0x13341729ULL, 0x12fda6d3ULL, 0x2b35f142ULL, 0x40f9ce49ULL, 0x149eac51ULL, 0xbb7b14a2ULL, 0x2b35f142ULL, 0x99aa514aULL},
+{0xd775b3f4ULL, 0x25daf796ULL, 0x238361afULL, 0x1f02efdfULL, 0xd775b3f4ULL, 0xb4ee0b62ULL, 0x1b00ca23ULL, 0x1f02efdfULL, 0x7151bb8cULL},
+{0xc614b05aULL, 0xe156a567ULL, 0x3d77b26cULL, 0x4d91a575ULL, 0xc614b05aULL, 0x3f778e48ULL, 0x78d0ae34ULL, 0x4d91a575ULL, 0xfedd0443ULL},
+{0x89c102aeULL, 0x347eb0c3ULL, 0x9e31bafaULL, 0xeaf2057ULL, 0x89c102aeULL, 0xd6228904ULL, 0xe7876dd4ULL, 0xeaf2057ULL, 0x9374361dULL},
+{0xac8c25bdULL, 0xf85b678dULL, 0xeda58e7fULL, 0x425b9852ULL, 0xac8c25bdULL, 0xb9238302ULL, 0x57c61565ULL, 0x425b9852ULL, 0xb57622bfULL},
+{0xf5a1f1e1ULL, 0x631af6fULL, 0x4c9bae94ULL, 0x5975d974ULL, 0xf5a1f1e1ULL, 0x751ce24ULL, 0xe990b743ULL, 0x5975d974ULL, 0x857f2d77ULL},
+{0xf506b690ULL, 0x4b548319ULL, 0x696d2040ULL, 0x24973143ULL, 0xf506b690ULL, 0x5a3bd1a8ULL, 0xb55c08e2ULL, 0x24973143ULL, 0x204f1934ULL},
+{0x13c6532dULL, 0xa1315642ULL, 0x4f46fc72ULL, 0xf8e52befULL, 0x13c6532dULL, 0xc106c330ULL, 0x760fd361ULL, 0xf8e52befULL, 0x9efa42f7ULL},
+{0x41f5805dULL, 0xa7337dc6ULL, 0xbfe89b7bULL, 0x186ddc7ULL, 0x41f5805dULL, 0x6e10c7a9ULL, 0xf9e784bbULL, 0x186ddc7ULL, 0xd61c8845ULL},
+{0x6640e589ULL, 0xecffb414ULL, 0xdd66f97fULL, 0x5876cdb9ULL, 0x6640e589ULL, 0xeb965ba1ULL, 0xe723148dULL, 0x5876cdb9ULL, 0xccf8414dULL},
+{0xacdeccf6ULL, 0x1cd477c3ULL, 0x99b7c88aULL, 0xfb022b58ULL, 0xacdeccf6ULL, 0xfeff3912ULL, 0xd9af431fULL, 0xfb022b58ULL, 0x3b37324aULL},
+{0x5b5c548cULL, 0x3cb13242ULL, 0x563eeea6ULL, 0x2a861d5fULL, 0x5b5c548cULL, 0x7d23a362ULL, 0x3442ef50ULL, 0x2a861d5fULL, 0xb079ab17ULL},
+{0x35417fbaULL, 0x5ee5987fULL, 0x44d369d0ULL, 0xf00091adULL, 0x35417fbaULL, 0x17afe441ULL, 0xf495da34ULL, 0xf00091adULL, 0x29a0dcf5ULL},
+{0x710e32dcULL, 0x7925ce82ULL, 0x5a025711ULL, 0xccfd7237ULL, 0x710e32dcULL, 0xe4c0a372ULL, 0xe7ca2c15ULL, 0xccfd7237ULL, 0x441a21beULL},
+{0xe07450fcULL, 0xbcf3f325ULL, 0x83302ac6ULL, 0xd44abef2ULL, 0xe07450fcULL, 0xe8da9b5fULL, 0x3e4b7b1eULL, 0xd44abef2ULL, 0xbf9b0c83ULL},
+{0x3c1e7ae9ULL, 0x3375209aULL, 0x814c36a0ULL, 0x100cbbf2ULL, 0x3c1e7ae9ULL, 0x2d071954ULL, 0x67e0fb82ULL, 0x100cbbf2ULL, 0x2d5440a3ULL},
+{0x423b5d51ULL, 0xa5df364bULL, 0xcf219713ULL, 0xe9742f7eULL, 0x423b5d51ULL, 0x1c1bb014ULL, 0xfa49e83fULL, 0xe9742f7eULL, 0x946b238ULL},
+{0x326b62cdULL, 0x4eacf08fULL, 0x9fafa279ULL, 0xc7e8cf5ULL, 0x326b62cdULL, 0x8f42e5a3ULL, 0x6abc6d33ULL, 0xc7e8cf5ULL, 0x1a514652ULL},
+{0xb01acf46ULL, 0x1fa22e36ULL, 0x58485f63ULL, 0xf324bfb4ULL, 0xb01acf46ULL, 0x5e4856e0ULL, 0x4b6617e9ULL, 0xf324bfb4ULL, 0xa3129602ULL},
+{0xe3ce7f3dULL, 0xea5dc901ULL, 0x767b9b4ULL, 0x7b5e9681ULL, 0xe3ce7f3dULL, 0xf39705c7ULL, 0xde5f2aaeULL, 0x7b5e9681ULL, 0x9acebc0fULL},
+{0xffacf2eaULL, 0x9ac7f98fULL, 0xd05588cdULL, 0xad4c8824ULL, 0xffacf2eaULL, 0x40ab919bULL, 0xcca0e23bULL, 0xad4c8824ULL, 0xf5c93cf7ULL},
+{0x650e4bfdULL, 0xd9801ba2ULL, 0x56f21db1ULL, 0xc80e87acULL, 0x650e4bfdULL, 0xaad88f85ULL, 0x5416f860ULL, 0xc80e87acULL, 0x14bed15eULL},
+{0xf1a64c9dULL, 0xef827391ULL, 0xda168f18ULL, 0xcdf18cefULL, 0xf1a64c9dULL, 0x896ddad4ULL, 0x5d319a03ULL, 0xcdf18cefULL, 0xb87c5c9aULL},
+{0x3147384dULL, 0xd8c8822dULL, 0x17f8a0aULL, 0xcc8d6330ULL, 0x3147384dULL, 0xa151ac55ULL, 0x578a0a86ULL, 0xcc8d6330ULL, 0xf94a99eaULL},
+{0xd7c2843cULL, 0x939da1eeULL, 0x402f0907ULL, 0x3f8de120ULL, 0xd7c2843cULL, 0xf2bec8f4ULL, 0x2f0cedecULL, 0x3f8de120ULL, 0xae15e319ULL},
+{0x97be0249ULL, 0x471eaed2ULL, 0x7a0be138ULL, 0xc153b478ULL, 0x97be0249ULL, 0x59c04007ULL, 0xfbad5a57ULL, 0xc153b478ULL, 0xf02c2dfdULL},
+{0x9cacd427ULL, 0xf6d0bd76ULL, 0x5015b3eaULL, 0xc6311928ULL, 0x9cacd427ULL, 0x50c0fe49ULL, 0x77545aafULL, 0xc6311928ULL, 0xfb8f43e8ULL},
+{0x911be09ULL, 0x1b065990ULL, 0x7b02ac83ULL, 0x645b41acULL, 0x911be09ULL, 0xf2c6f28ULL, 0x57b0344aULL, 0x645b41acULL, 0xb1ddde31ULL},
+{0xaf1c5323ULL, 0x41899a3bULL, 0x88805f74ULL, 0xf9c32c61ULL, 0xaf1c5323ULL, 0x1f36fc60ULL, 0x66b023cbULL, 0xf9c32c61ULL, 0x37b31ba9ULL},
+{0xa927ee76ULL, 0xc390040aULL, 0x2944bf4fULL, 0xae655d69ULL, 0xa927ee76ULL, 0xa877dc9ULL, 0x770eb132ULL, 0xae655d69ULL, 0x6c44826bULL},
+{0xc10dc217ULL, 0xe714bb3eULL, 0x389d4877ULL, 0xb3179d31ULL, 0xc10dc217ULL, 0xe3f5b7d4ULL, 0xb58a4d5fULL, 0xb3179d31ULL, 0xea248f07ULL},
+{0xfe8d2bceULL, 0x7df37dafULL, 0x6e5cee00ULL, 0x684e1788ULL, 0xfe8d2bceULL, 0x226a72b9ULL, 0x763fcabcULL, 0x684e1788ULL, 0xd31d0f09ULL},
+{0x2c6cf63dULL, 0xe8efd052ULL, 0x666c0d3dULL, 0x48f6f8feULL, 0x2c6cf63dULL, 0x555d6842ULL, 0xb6c4a8cfULL, 0x48f6f8feULL, 0xc6f92b75ULL},
+{0x6d1a6bf8ULL, 0x56403996ULL, 0xf3c1d374ULL, 0xb17d0f1aULL, 0x6d1a6bf8ULL, 0xa6e6fd6cULL, 0x20517dd7ULL, 0xb17d0f1aULL, 0x4c4ba5fdULL},
+{0x6eeaf2aULL, 0x38d8decaULL, 0xd07763aaULL, 0xa5a48f87ULL, 0x6eeaf2aULL, 0x6d991db2ULL, 0x959bdf99ULL, 0xa5a48f87ULL, 0x384b055fULL},
+{0x2f13283bULL, 0xdf437c3fULL, 0x4fec1475ULL, 0x4294f7ecULL, 0x2f13283bULL, 0x20a4789bULL, 0xc614a990ULL, 0x4294f7ecULL, 0x271ce5cbULL},
+{0x140b43ccULL, 0xdd6f04a2ULL, 0x702c87a6ULL, 0xd71147daULL, 0x140b43ccULL, 0xd7ba62f8ULL, 0x3f630e5bULL, 0xd71147daULL, 0xa189434aULL},
+{0x1ddf5015ULL, 0x46871bf1ULL, 0x7b265046ULL, 0x94a9d88ULL, 0x1ddf5015ULL, 0x27eb9dd8ULL, 0x9eed8b9eULL, 0x94a9d88ULL, 0xd406db64ULL},
+{0x689bbe3eULL, 0x7e84a7fbULL, 0x7ffe19adULL, 0x955552f0ULL, 0x689bbe3eULL, 0x9a94b677ULL, 0x8aed0783ULL, 0x955552f0ULL, 0xf13c2b58ULL},
+{0x3cf17552ULL, 0x8ccfac74ULL, 0x44c3ebd0ULL, 0xef7f5301ULL, 0x3cf17552ULL, 0x8c465985ULL, 0xe26833a2ULL, 0xef7f5301ULL, 0xf4595c13ULL},
+{0xd52c7c09ULL, 0x142ca0c1ULL, 0x1f970834ULL, 0xb9b56b4aULL, 0xd52c7c09ULL, 0xdb8a320bULL, 0x883c8b5cULL, 0xb9b56b4aULL, 0x643b04f0ULL},
+{0xc129c4bbULL, 0xf87608c0ULL, 0x8ff283f6ULL, 0x988a658fULL, 0xc129c4bbULL, 0xbd2cbd17ULL, 0xcede92f7ULL, 0x988a658fULL, 0xdded3a4ULL},
+{0x330a3fffULL, 0xc6c7a55dULL, 0x4e4b730ULL, 0x2863571dULL, 0x330a3fffULL, 0x17bf4d1bULL, 0xaf61a338ULL, 0x2863571dULL, 0x367a493eULL},
+{0xdd2c36a0ULL, 0x51c1f502ULL, 0x8493e146ULL, 0x93f9a667ULL, 0xdd2c36a0ULL, 0x4044f72cULL, 0x9b5b8f78ULL, 0x93f9a667ULL, 0xca733ec7ULL},
+{0x1a345943ULL, 0x6ee96508ULL, 0x7453c0d7ULL, 0xf8096a41ULL, 0x1a345943ULL, 0x2bb04ecaULL, 0x6ab153e9ULL, 0xf8096a41ULL, 0x5069d73dULL},
+{0xa5349e03ULL, 0xccbbe297ULL, 0x7dd47a1aULL, 0xdcc23a79ULL, 0xa5349e03ULL, 0xd1adc612ULL, 0x61297b38ULL, 0xdcc23a79ULL, 0xaec207daULL},
+{0x8207dc6fULL, 0x3c1ee0bULL, 0xf1b7712fULL, 0xa42a574cULL, 0x8207dc6fULL, 0xbdb20e4fULL, 0xa8af4a2bULL, 0xa42a574cULL, 0x1cfda8adULL},
+{0xdede1a0cULL, 0xa24d2e79ULL, 0x4f011bcfULL, 0x5d6643b4ULL, 0xdede1a0cULL, 0x30f5dd79ULL, 0x42a9e896ULL, 0x5d6643b4ULL, 0xc815304ULL},
+{0x3cc73e66ULL, 0x66330837ULL, 0x58d6db7fULL, 0x12ef5199ULL, 0x3cc73e66ULL, 0xc15ca498ULL, 0x63324c85ULL, 0x12ef5199ULL, 0x2f473f14ULL},
+{0x238f144cULL, 0x211b5f05ULL, 0x49f63a67ULL, 0x5fd89c05ULL, 0x238f144cULL, 0x1d152968ULL, 0x91d37f96ULL, 0x5fd89c05ULL, 0x5f39fd1bULL},
+{0xd96377b3ULL, 0x7af10366ULL, 0x7d299fbbULL, 0x54b7ecaULL, 0xd96377b3ULL, 0xa003c2ULL, 0x82ba0e67ULL, 0x54b7ecaULL, 0x16e5bf18ULL},
+{0x5d85e075ULL, 0x8491d2eaULL, 0x874c4ba0ULL, 0xff1af9fcULL, 0x5d85e075ULL, 0x200cf3efULL, 0x9263cd31ULL, 0xff1af9fcULL, 0x7f2787e1ULL}},
+  {{0x992621a6ULL, 0x613c364fULL, 0x9aabadc3ULL, 0x3d6dfd87ULL, 0x992621a6ULL, 0xceb02516ULL, 0x77225880ULL, 0x3d6dfd87ULL, 0xbd37d209ULL},
+{0x8b27c4cdULL, 0xb99d4e7bULL, 0x23dcec33ULL, 0x7dc71616ULL, 0x8b27c4cdULL, 0x286eb0d1ULL, 0x6251b9e0ULL, 0x7dc71616ULL, 0x8071e5d8ULL},
+{0x9e387cedULL, 0x26fd224eULL, 0xebb31c6aULL, 0x9254230bULL, 0x9e387cedULL, 0x9a49676ULL, 0xd86d8ec6ULL, 0x9254230bULL, 0xa20c5fbfULL},
+{0x2198b9d8ULL, 0xb6778a9ULL, 0x61d8c37eULL, 0x2e867451ULL, 0x2198b9d8ULL, 0xb492d7a2ULL, 0x796f33e2ULL, 0x2e867451ULL, 0x7c408355ULL},
+{0x6e8eb29dULL, 0xe76da9b2ULL, 0x30ba4b27ULL, 0x1e5e5936ULL, 0x6e8eb29dULL, 0x7c59a092ULL, 0xfd379f60ULL, 0x1e5e5936ULL, 0x6bf88426ULL},
+{0x1a181a60ULL, 0x483c7191ULL, 0xb101235bULL, 0x5adfefa6ULL, 0x1a181a60ULL, 0x9ec6567eULL, 0x224df1afULL, 0x5adfefa6ULL, 0x2310a032ULL},
+{0x3d7250afULL, 0x37744eaeULL, 0x1e751c55ULL, 0x95a943dULL, 0x3d7250afULL, 0xe839595eULL, 0xbb4037d7ULL, 0x95a943dULL, 0xdcf70e1bULL},
+{0xcb894103ULL, 0x75597d32ULL, 0x856719a8ULL, 0x31a48848ULL, 0xcb894103ULL, 0xdfcd6608ULL, 0x810d80faULL, 0x31a48848ULL, 0x5f0e3bcbULL},
+{0xdd0c1707ULL, 0x6406ff62ULL, 0x13fb6543ULL, 0x75da012bULL, 0xdd0c1707ULL, 0x3a6eb471ULL, 0x93ce006ULL, 0x75da012bULL, 0xda0db2a4ULL},
+{0xa53eaf5ULL, 0x2313fc01ULL, 0x747ff471ULL, 0x8d9f7f43ULL, 0xa53eaf5ULL, 0xbb14b40aULL, 0x422498e7ULL, 0x8d9f7f43ULL, 0xd8aa1481ULL},
+{0x97e5ad01ULL, 0x181d3de4ULL, 0x115e0d13ULL, 0xe3c40d81ULL, 0x97e5ad01ULL, 0x32a8b232ULL, 0x5cd4bac3ULL, 0xe3c40d81ULL, 0x7e177371ULL},
+{0x56dcc9c7ULL, 0x86d4b4c1ULL, 0x93d6ab17ULL, 0x6a02ecedULL, 0x56dcc9c7ULL, 0x15ec1f38ULL, 0x1a7f17c6ULL, 0x6a02ecedULL, 0x340d84ddULL},
+{0xe124c502ULL, 0x445ea59dULL, 0x591e76dfULL, 0x832971f7ULL, 0xe124c502ULL, 0x1d16e903ULL, 0xc47613ULL, 0x832971f7ULL, 0x3060c970ULL},
+{0xc3d2a6b5ULL, 0x35b6ce74ULL, 0x61bf1724ULL, 0x1a5169c0ULL, 0xc3d2a6b5ULL, 0x2e70774fULL, 0xe779dbb5ULL, 0x1a5169c0ULL, 0xfcf71894ULL},
+{0x28fbcd8aULL, 0xe85bd79cULL, 0x8a4d7b23ULL, 0x86b16537ULL, 0x28fbcd8aULL, 0xbc36fcaULL, 0xe5f79845ULL, 0x86b16537ULL, 0x85f16ae6ULL},
+{0x62291ba2ULL, 0x8a29a36cULL, 0x892f58ecULL, 0x9f4baa92ULL, 0x62291ba2ULL, 0x15718c76ULL, 0x8e88190fULL, 0x9f4baa92ULL, 0x70681ab9ULL},
+{0x8dbc7811ULL, 0x58f65c79ULL, 0xb84fe14cULL, 0x54e6b875ULL, 0x8dbc7811ULL, 0x95f66f0bULL, 0x4cb02a2dULL, 0x54e6b875ULL, 0xd6de8375ULL},
+{0xa6954770ULL, 0xc75cd37fULL, 0x513b2e60ULL, 0x12ccf42dULL, 0xa6954770ULL, 0xdad6cf1cULL, 0x27ecd5f7ULL, 0x12ccf42dULL, 0x2fbafdfULL},
+{0x420397b1ULL, 0xdc2c0426ULL, 0xbc82905dULL, 0xc7dd87ccULL, 0x420397b1ULL, 0x1f9698b5ULL, 0xd57f665aULL, 0xc7dd87ccULL, 0x87c06828ULL},
+{0xb0941f47ULL, 0x40f70711ULL, 0x39d3f3c3ULL, 0x7a340070ULL, 0xb0941f47ULL, 0x5d785190ULL, 0xc3fd606fULL, 0x7a340070ULL, 0xe9bed4ccULL},
+{0x9f39640ULL, 0xca3e172dULL, 0x7044650ULL, 0x5be48875ULL, 0x9f39640ULL, 0x2bf215e3ULL, 0xc3dedf74ULL, 0x5be48875ULL, 0xcfbeb46bULL},
+{0xbecd429aULL, 0xc2a0869cULL, 0xb32d853bULL, 0x6020fd02ULL, 0xbecd429aULL, 0x668b7b89ULL, 0xf39c2208ULL, 0x6020fd02ULL, 0x360f368bULL},
+{0xbe715f67ULL, 0x3ac5f126ULL, 0x2bf5f06eULL, 0x2baacce5ULL, 0xbe715f67ULL, 0x6fddcc5ULL, 0x7687e292ULL, 0x2baacce5ULL, 0x8078d345ULL},
+{0x931db076ULL, 0xd3415a35ULL, 0xd40ca00cULL, 0xe810f382ULL, 0x931db076ULL, 0x7adcd912ULL, 0x785c776cULL, 0xe810f382ULL, 0x2c54e2ULL},
+{0x70d59975ULL, 0x25d09979ULL, 0xac1dcf47ULL, 0x2fdb708cULL, 0x70d59975ULL, 0x5649e574ULL, 0xde055b8bULL, 0x2fdb708cULL, 0xf6335515ULL},
+{0xbe9776d5ULL, 0x622dffa1ULL, 0xd078f2f8ULL, 0x6bab291ULL, 0xbe9776d5ULL, 0x25a37fd2ULL, 0xa39ec164ULL, 0x6bab291ULL, 0xddc18ae6ULL},
+{0x201ce457ULL, 0x78cbc49aULL, 0xa61c8592ULL, 0x78fcce3bULL, 0x201ce457ULL, 0x520866b1ULL, 0x2d34f46cULL, 0x78fcce3bULL, 0x61062cf4ULL},
+{0xcb18f9c3ULL, 0xfab570f9ULL, 0x3af4e934ULL, 0x4c4d051cULL, 0xcb18f9c3ULL, 0x6ddd14e7ULL, 0x2cdcb5d7ULL, 0x4c4d051cULL, 0x295a3bd8ULL},
+{0x6911e58dULL, 0x1ad01f0cULL, 0xea3761a5ULL, 0x19571ebaULL, 0x6911e58dULL, 0xe098230eULL, 0x81bf55fcULL, 0x19571ebaULL, 0x2f6e521dULL},
+{0x3af765ceULL, 0x4b114306ULL, 0xcb048a8bULL, 0xff8f67c9ULL, 0x3af765ceULL, 0xe8525294ULL, 0x71f0e787ULL, 0xff8f67c9ULL, 0xe8b6138fULL},
+{0x36f63d38ULL, 0x99ef3392ULL, 0x8a236594ULL, 0xa90405daULL, 0x36f63d38ULL, 0xedf84f58ULL, 0x9615fe6eULL, 0xa90405daULL, 0x31ee97cbULL},
+{0x322484b8ULL, 0xe075c0c8ULL, 0x6179b13dULL, 0x77ff9b42ULL, 0x322484b8ULL, 0x241db1d9ULL, 0xdf27df91ULL, 0x77ff9b42ULL, 0x17e1ebe3ULL},
+{0x5897598dULL, 0xfdbd638dULL, 0x4c693615ULL, 0xe00f5972ULL, 0x5897598dULL, 0xab035dd0ULL, 0x1a4c8666ULL, 0xe00f5972ULL, 0xa6e6697aULL},
+{0xc3e313a0ULL, 0x8de05ba3ULL, 0xb6e4da32ULL, 0x9021ea2fULL, 0xc3e313a0ULL, 0x24654b0bULL, 0x7cf818eaULL, 0x9021ea2fULL, 0x15a2d488ULL},
+{0xe97d049ULL, 0x8fc3919eULL, 0x6e80e262ULL, 0x7728b23eULL, 0xe97d049ULL, 0xaa887605ULL, 0x80ba9257ULL, 0x7728b23eULL, 0xe15bf78cULL},
+{0x1d3a5856ULL, 0x765c1d0bULL, 0x48eecacaULL, 0xc79ee567ULL, 0x1d3a5856ULL, 0x95fd1035ULL, 0xa6cf5674ULL, 0xc79ee567ULL, 0xc5d37c5bULL},
+{0xfeef6677ULL, 0x5d9f9bccULL, 0x4b607bb4ULL, 0x4d595594ULL, 0xfeef6677ULL, 0xc7a21fefULL, 0xeb6c085dULL, 0x4d595594ULL, 0x4bf04ebfULL},
+{0x3050aa87ULL, 0xf2f7d358ULL, 0x10226a3fULL, 0xfd0066b2ULL, 0x3050aa87ULL, 0xf116fd15ULL, 0x4ef4804aULL, 0xfd0066b2ULL, 0x244b1a3cULL},
+{0x386f1478ULL, 0xc12c229dULL, 0xa2cd99efULL, 0xa971eae2ULL, 0x386f1478ULL, 0x3f4bac96ULL, 0x3245a44cULL, 0xa971eae2ULL, 0x2965cd04ULL},
+{0x22fa4d07ULL, 0xd389510bULL, 0xa2890e28ULL, 0x3556c12fULL, 0x22fa4d07ULL, 0x78a97258ULL, 0x3dd046e1ULL, 0x3556c12fULL, 0xc0a1027eULL},
+{0x69d6d41aULL, 0x3908d2e2ULL, 0x21e69831ULL, 0x5af782ULL, 0x69d6d41aULL, 0x87dce3ffULL, 0xfc0e79e9ULL, 0x5af782ULL, 0x1f5a4c5fULL},
+{0x66de10c5ULL, 0x1204c196ULL, 0x68541182ULL, 0x147d8f97ULL, 0x66de10c5ULL, 0x668b842aULL, 0x3f26260bULL, 0x147d8f97ULL, 0x23980f32ULL},
+{0x7c26b4f1ULL, 0x69cf1fd6ULL, 0x3ce5899bULL, 0x7631bd7ULL, 0x7c26b4f1ULL, 0x1603a0beULL, 0x822dc07cULL, 0x7631bd7ULL, 0x96ff1fe0ULL},
+{0xc6dd76e3ULL, 0x652c6613ULL, 0x7bf05849ULL, 0xd39952e7ULL, 0xc6dd76e3ULL, 0xc81fef30ULL, 0xc884801dULL, 0xd39952e7ULL, 0xf0d653ebULL},
+{0xb630f03eULL, 0xa3321e2cULL, 0xb74b70bbULL, 0x12ef49c5ULL, 0xb630f03eULL, 0x2329b112ULL, 0xdd0120c7ULL, 0x12ef49c5ULL, 0x32cf6229ULL},
+{0xf62ac812ULL, 0x8b1d167aULL, 0xa647f7c9ULL, 0xdafe2bbfULL, 0xf62ac812ULL, 0x2aaac70bULL, 0xf76371ddULL, 0xdafe2bbfULL, 0xa7bba9abULL},
+{0xe93debb3ULL, 0x2a18761fULL, 0x739ce0d6ULL, 0x8d138413ULL, 0xe93debb3ULL, 0x9e512ce0ULL, 0x6e02036fULL, 0x8d138413ULL, 0xb2b53cd2ULL},
+{0x37d491c8ULL, 0x89fd160fULL, 0x639041a2ULL, 0xc9fa75b5ULL, 0x37d491c8ULL, 0x73a46557ULL, 0x54b1f865ULL, 0xc9fa75b5ULL, 0x31c708f6ULL},
+{0xb5d04739ULL, 0x64f0c73ULL, 0x314f6e76ULL, 0x1a105758ULL, 0xb5d04739ULL, 0x47cbec87ULL, 0xe488f2cdULL, 0x1a105758ULL, 0x1f6af876ULL},
+{0x6072a59eULL, 0xcc07ba7eULL, 0x66d34507ULL, 0x9f5c18b1ULL, 0x6072a59eULL, 0x341f7c41ULL, 0x2787763aULL, 0x9f5c18b1ULL, 0x9da014ffULL},
+{0x803831d3ULL, 0xf913652ULL, 0xbff1c320ULL, 0x8b638396ULL, 0x803831d3ULL, 0x8a8eb74eULL, 0x3965ad74ULL, 0x8b638396ULL, 0xd4b7c191ULL},
+{0x28900273ULL, 0x5d89130eULL, 0xa34bbc10ULL, 0xc152865fULL, 0x28900273ULL, 0x53d5b216ULL, 0xd45398cbULL, 0xc152865fULL, 0x2f4f5986ULL},
+{0x86b4755ULL, 0xfc23d4f0ULL, 0x3f965d82ULL, 0x22336d8eULL, 0x86b4755ULL, 0x3f1db20eULL, 0xc6ebcfb9ULL, 0x22336d8eULL, 0xcf9fa302ULL},
+{0xa081ee72ULL, 0x492db2dfULL, 0x45c64635ULL, 0xd4f14989ULL, 0xa081ee72ULL, 0x392f67fcULL, 0xbbb4b2b0ULL, 0xd4f14989ULL, 0x4769c31ULL},
+{0x82ce14d3ULL, 0x840f9ed4ULL, 0xc2993826ULL, 0x9f7ddf5eULL, 0x82ce14d3ULL, 0x25046353ULL, 0x3c5e7307ULL, 0x9f7ddf5eULL, 0xaa4b759bULL},
+{0xae6dafdcULL, 0x396610cULL, 0x17b26ca1ULL, 0xfcb4440bULL, 0xae6dafdcULL, 0x5bdf762bULL, 0x742b8363ULL, 0xfcb4440bULL, 0x4b3417eeULL},
+{0x92dd18e7ULL, 0xd1db6acaULL, 0x9f3ce537ULL, 0xaa398e8aULL, 0x92dd18e7ULL, 0x554e1f1fULL, 0x64b33d46ULL, 0xaa398e8aULL, 0x1dad20c9ULL},
+{0xb93da76ULL, 0x3f645a36ULL, 0x5aa45786ULL, 0xc0f7230aULL, 0xb93da76ULL, 0xe7ebd5caULL, 0xd4b1c484ULL, 0xc0f7230aULL, 0x9f268a02ULL},
+{0xee11d349ULL, 0x70debcabULL, 0xf4ae6872ULL, 0xe70fd830ULL, 0xee11d349ULL, 0x6bec5cfeULL, 0x5d68eee0ULL, 0xe70fd830ULL, 0x5604a327ULL},
+{0x49a770c6ULL, 0xecabe3d4ULL, 0xfae460f1ULL, 0xd4157519ULL, 0x49a770c6ULL, 0x61e7e870ULL, 0x757cc2f6ULL, 0xd4157519ULL, 0xdf3110d9ULL},
+{0xa4e7b636ULL, 0x86b5f539ULL, 0xfdef9e12ULL, 0x1bf81654ULL, 0xa4e7b636ULL, 0x73732616ULL, 0x4442e820ULL, 0x1bf81654ULL, 0x24d6c6acULL},
+{0x6a16c598ULL, 0xc1c7b5f6ULL, 0x2f601da8ULL, 0xf46884fcULL, 0x6a16c598ULL, 0x580915a3ULL, 0x88b4db50ULL, 0xf46884fcULL, 0x2449d711ULL},
+{0x1a246430ULL, 0x46cebae5ULL, 0x9465bd21ULL, 0x4a39e9dbULL, 0x1a246430ULL, 0xa975bc6fULL, 0x59fd8fULL, 0x4a39e9dbULL, 0x2e13d4dcULL},
+{0x730cb68cULL, 0x7b8ebdd7ULL, 0xb771e54aULL, 0xd561cd59ULL, 0x730cb68cULL, 0x93bb81caULL, 0x74d6ba7eULL, 0xd561cd59ULL, 0x56c37f30ULL},
+{0xe3e42fc1ULL, 0xec949a6bULL, 0xa4ab82bdULL, 0xd6471a15ULL, 0xe3e42fc1ULL, 0xf3bc730fULL, 0x22e89ac0ULL, 0xd6471a15ULL, 0xeb845594ULL},
+{0x4213e267ULL, 0x4d78424cULL, 0x158f422aULL, 0x3798dc4aULL, 0x4213e267ULL, 0x8b6de5feULL, 0xab206958ULL, 0x3798dc4aULL, 0x606848beULL},
+{0xf6fb03f5ULL, 0x6187b4b6ULL, 0x4b72f1ddULL, 0x34236925ULL, 0xf6fb03f5ULL, 0x6cbc6a5eULL, 0x3c33c745ULL, 0x34236925ULL, 0x59a394caULL},
+{0x37900b5ULL, 0x6c7155b1ULL, 0x3fd2a1b2ULL, 0xbea5273dULL, 0x37900b5ULL, 0xe0195883ULL, 0x2c0579c7ULL, 0xbea5273dULL, 0x5cb8040ULL},
+{0x5cba9309ULL, 0x1e021dbaULL, 0x6af48d10ULL, 0x53e6951ULL, 0x5cba9309ULL, 0x721d1154ULL, 0x6d5e0fd4ULL, 0x53e6951ULL, 0xd9236af8ULL},
+{0x3ead2c2bULL, 0xf5638880ULL, 0x2e3d7d89ULL, 0xfdbc6af5ULL, 0x3ead2c2bULL, 0xc9e5daf5ULL, 0xa4bf5e63ULL, 0xfdbc6af5ULL, 0xd1a989fdULL},
+{0xf005dd87ULL, 0x15c5e666ULL, 0x671a1bc6ULL, 0x1fd06ea1ULL, 0xf005dd87ULL, 0xcc686a8aULL, 0x5b68d9ccULL, 0x1fd06ea1ULL, 0x9df6c693ULL},
+{0xa62ef5ffULL, 0x2682600fULL, 0x7ff30baULL, 0xcc7faa73ULL, 0xa62ef5ffULL, 0x9842224cULL, 0x595e4641ULL, 0xcc7faa73ULL, 0x5eb698cbULL},
+{0x1f56b719ULL, 0x9b9c84b6ULL, 0xcb5ad7cULL, 0xc1e2c429ULL, 0x1f56b719ULL, 0x32238a25ULL, 0x260b4aa1ULL, 0xc1e2c429ULL, 0x2b6a3cdULL},
+{0xbf07f614ULL, 0xcea70325ULL, 0x46e18415ULL, 0x378a97baULL, 0xbf07f614ULL, 0xe7b888fULL, 0xfb46675eULL, 0x378a97baULL, 0x3829b515ULL},
+{0x2acfdddbULL, 0x57634678ULL, 0xff6173dULL, 0xf83c2247ULL, 0x2acfdddbULL, 0x7d702504ULL, 0x2d64a536ULL, 0xf83c2247ULL, 0x6f3735e6ULL},
+{0x95264d5eULL, 0x2fd4f160ULL, 0x2f1f47eULL, 0xe46cf42ULL, 0x95264d5eULL, 0x19ac2f76ULL, 0xaeb6e955ULL, 0xe46cf42ULL, 0xb0a119b1ULL},
+{0x94704f76ULL, 0x116ec2c3ULL, 0x25a8dbe5ULL, 0x8c8debcdULL, 0x94704f76ULL, 0x56d75c1fULL, 0x5980cba6ULL, 0x8c8debcdULL, 0xfd840d69ULL},
+{0xe3660918ULL, 0x9bcf0ad2ULL, 0xe8deec91ULL, 0xf4a3256dULL, 0xe3660918ULL, 0x3ca04000ULL, 0x15470133ULL, 0xf4a3256dULL, 0xbe583d06ULL},
+{0x9f552d4bULL, 0xd7279742ULL, 0x5d288b28ULL, 0x26d64f10ULL, 0x9f552d4bULL, 0xd05e3f5dULL, 0x741e66c6ULL, 0x26d64f10ULL, 0x6af3a3f5ULL},
+{0x416527c4ULL, 0xfd6ffcfeULL, 0x31066996ULL, 0x321de74bULL, 0x416527c4ULL, 0x6304df5bULL, 0xd04568afULL, 0x321de74bULL, 0x57d24beULL},
+{0x8782781eULL, 0x68633796ULL, 0x96ed628dULL, 0xa6ad8bd2ULL, 0x8782781eULL, 0xd6cc4ac6ULL, 0xaba3ac84ULL, 0xa6ad8bd2ULL, 0x3d522df8ULL},
+{0xa5bfcc46ULL, 0x8ad51410ULL, 0x2e698c13ULL, 0x9a6f1a96ULL, 0xa5bfcc46ULL, 0x102ff90cULL, 0x71ecdb72ULL, 0x9a6f1a96ULL, 0xca772630ULL},
+{0x4cc027c5ULL, 0x8e59dbcdULL, 0x8c11f70cULL, 0x7033867fULL, 0x4cc027c5ULL, 0x893858f9ULL, 0x65353badULL, 0x7033867fULL, 0x4d65d503ULL},
+{0x3ffe14cbULL, 0xf3ce505eULL, 0xe1d53026ULL, 0xd037e601ULL, 0x3ffe14cbULL, 0x3b1b01abULL, 0x94c3ab90ULL, 0xd037e601ULL, 0x65ee1657ULL},
+{0xf9303541ULL, 0xdd42851ULL, 0xf2aa274fULL, 0xa975f188ULL, 0xf9303541ULL, 0xcae270bfULL, 0x2b635357ULL, 0xa975f188ULL, 0xceb1d6aULL},
+{0xeb19d61bULL, 0x7c44725dULL, 0xb855f32ULL, 0xe64ae357ULL, 0xeb19d61bULL, 0x2dec989aULL, 0xc8e99854ULL, 0xe64ae357ULL, 0x7ce496d5ULL},
+{0x4b2e9664ULL, 0x85efe587ULL, 0xef58e604ULL, 0xad15fe6cULL, 0x4b2e9664ULL, 0x1c4a9d9dULL, 0x8b8b1291ULL, 0xad15fe6cULL, 0xe059a0c4ULL},
+{0x8f57c9d5ULL, 0xd44b5113ULL, 0xcc3026c6ULL, 0xe932c3dULL, 0x8f57c9d5ULL, 0x88ee5e16ULL, 0x9642e09bULL, 0xe932c3dULL, 0xf78006fbULL},
+{0x3e0a95d3ULL, 0x440e2707ULL, 0xdb0656aaULL, 0x2411f477ULL, 0x3e0a95d3ULL, 0x468ddc34ULL, 0xc3843260ULL, 0x2411f477ULL, 0xffb3ecd2ULL},
+{0x7b2be097ULL, 0x6d1b3f35ULL, 0xd96e2230ULL, 0x316339c6ULL, 0x7b2be097ULL, 0x1307b89cULL, 0x945711deULL, 0x316339c6ULL, 0x8db9a270ULL},
+{0x73ad590dULL, 0xb7b21192ULL, 0x280a9c1aULL, 0x70b803fcULL, 0x73ad590dULL, 0xf2ae2b3bULL, 0xafdf7828ULL, 0x70b803fcULL, 0x844a0fb0ULL},
+{0x17ad416aULL, 0x771de162ULL, 0x5b76db0bULL, 0x252487bfULL, 0x17ad416aULL, 0xeb801fbdULL, 0xe54972b6ULL, 0x252487bfULL, 0x7e548d7fULL},
+{0x348c821ULL, 0x86018db1ULL, 0x271e2e11ULL, 0xc699096ULL, 0x348c821ULL, 0x50395293ULL, 0xd5d18676ULL, 0xc699096ULL, 0x2164de66ULL},
+{0xa8d2f2d4ULL, 0xad16a45fULL, 0x511d4d1ULL, 0x9f9c0bb0ULL, 0xa8d2f2d4ULL, 0x35619770ULL, 0xbddef6d2ULL, 0x9f9c0bb0ULL, 0x1959e5a3ULL},
+{0x2412db72ULL, 0x8736f761ULL, 0xa4f2e079ULL, 0x4fa2cca5ULL, 0x2412db72ULL, 0x1bac6710ULL, 0x5b4c602bULL, 0x4fa2cca5ULL, 0xfccd55a4ULL},
+{0x1d387e3eULL, 0x44e434daULL, 0x8b8d77ecULL, 0x6c8faafeULL, 0x1d387e3eULL, 0x8cebfbefULL, 0xdd989678ULL, 0x6c8faafeULL, 0x506a6ae5ULL},
+{0x1e046d64ULL, 0x3b0c72cfULL, 0x633c48eULL, 0xff167e17ULL, 0x1e046d64ULL, 0xf911c9bdULL, 0xefdb0513ULL, 0xff167e17ULL, 0x2a1f112fULL},
+{0x5090b80fULL, 0x76c4a4c5ULL, 0x547257b9ULL, 0xc524e118ULL, 0x5090b80fULL, 0x9e4a652dULL, 0x39cbd83cULL, 0xc524e118ULL, 0x8453e327ULL},
+{0x5955340fULL, 0x30cfa638ULL, 0x3655579eULL, 0x6fed24fULL, 0x5955340fULL, 0x2661921ULL, 0xf8ea73a7ULL, 0x6fed24fULL, 0x4ec7811bULL},
+{0xd6d8fcf8ULL, 0x9204c30eULL, 0xa1cefb1cULL, 0xb38bf24aULL, 0xd6d8fcf8ULL, 0x2cab36c9ULL, 0xdde488bULL, 0xb38bf24aULL, 0x9a38bafULL},
+{0x69a22ff1ULL, 0x782a1bc1ULL, 0xc038ffb6ULL, 0xba001c7eULL, 0x69a22ff1ULL, 0x7596711bULL, 0x608844c1ULL, 0xba001c7eULL, 0x9fbbee1ULL},
+{0x967c88b1ULL, 0xd2885860ULL, 0x293f833fULL, 0x27fb22dfULL, 0x967c88b1ULL, 0xf4f8f3c8ULL, 0xe90ca5bfULL, 0x27fb22dfULL, 0xb4f49364ULL},
+{0x49c86e48ULL, 0x5ef3791aULL, 0xd4c12348ULL, 0xbaf5ac3bULL, 0x49c86e48ULL, 0x4a41a3a8ULL, 0x40b8abdbULL, 0xbaf5ac3bULL, 0x63c88b42ULL},
+{0x5107ff8bULL, 0xf0501136ULL, 0xe712039eULL, 0x42aaf87cULL, 0x5107ff8bULL, 0xe3da83f5ULL, 0x9d6e763fULL, 0x42aaf87cULL, 0x79a4eaf0ULL},
+{0xf7f93c2aULL, 0x3d29bd53ULL, 0xb32464beULL, 0x409a6866ULL, 0xf7f93c2aULL, 0x66910d42ULL, 0x7a8f810fULL, 0x409a6866ULL, 0x4562ff58ULL},
+{0xf22b6b50ULL, 0x556a9cc3ULL, 0x22a16f0dULL, 0x82fe7e42ULL, 0xf22b6b50ULL, 0xd728f3d0ULL, 0xce5fd888ULL, 0x82fe7e42ULL, 0xa4722214ULL},
+{0xfb993ecaULL, 0x3170386eULL, 0xa9406ULL, 0xc55f56fcULL, 0xfb993ecaULL, 0x5b17da3fULL, 0x186c66aULL, 0xc55f56fcULL, 0x9702ba69ULL},
+{0x9090c1adULL, 0xdf3b78abULL, 0x6096b850ULL, 0x497b8752ULL, 0x9090c1adULL, 0xd5e5d3bcULL, 0x8849514aULL, 0x497b8752ULL, 0xdb179d6fULL},
+{0xf0308a47ULL, 0x87e70e85ULL, 0x184b478fULL, 0x3a8a2d29ULL, 0xf0308a47ULL, 0x7a0810b7ULL, 0x87940265ULL, 0x3a8a2d29ULL, 0x4d385a6aULL},
+{0x90e66f8eULL, 0x53463e2cULL, 0x410bee26ULL, 0x879bd521ULL, 0x90e66f8eULL, 0x11fabe35ULL, 0xe42878e6ULL, 0x879bd521ULL, 0x28c5eb7aULL},
+{0xbda50637ULL, 0x25230b60ULL, 0xe7e6c2cdULL, 0xf344647fULL, 0xbda50637ULL, 0xdedce1d3ULL, 0x9401e179ULL, 0xf344647fULL, 0xf9e9edbeULL},
+{0xd1bb6a9dULL, 0x98c01dcfULL, 0xc4b5cc22ULL, 0x2b0b9ac5ULL, 0xd1bb6a9dULL, 0x4a93f35eULL, 0xd28cbb9bULL, 0x2b0b9ac5ULL, 0x9715b872ULL},
+{0xcc5c7455ULL, 0xd894e746ULL, 0xcf05d22fULL, 0xaa3b45ebULL, 0xcc5c7455ULL, 0xbed2c43fULL, 0xaae1488dULL, 0xaa3b45ebULL, 0xbeb6ff37ULL},
+{0x35c274dULL, 0xe18ab7a4ULL, 0x7e57a9fdULL, 0x4373c62fULL, 0x35c274dULL, 0xe66f878ULL, 0x68e0564ULL, 0x4373c62fULL, 0xf08cbfa7ULL},
+{0x3468ba33ULL, 0x86a8e014ULL, 0x1cdc186aULL, 0x906b4aeULL, 0x3468ba33ULL, 0x54cb1824ULL, 0xa6822d79ULL, 0x906b4aeULL, 0xe0a1e261ULL},
+{0xaf2b0eaeULL, 0x9ff3cc69ULL, 0x648b343eULL, 0x8f310289ULL, 0xaf2b0eaeULL, 0xdba1a1b5ULL, 0x656c8d88ULL, 0x8f310289ULL, 0xec190999ULL},
+{0xa3f8dfd8ULL, 0xc367b98dULL, 0x13b3f2a2ULL, 0xb17977d6ULL, 0xa3f8dfd8ULL, 0x644a8a25ULL, 0xeda00f86ULL, 0xb17977d6ULL, 0x4688c460ULL},
+{0x58f30887ULL, 0xdaccfc2bULL, 0xa76edf0ULL, 0xd5b407c9ULL, 0x58f30887ULL, 0x47e769abULL, 0x4ffe03ULL, 0xd5b407c9ULL, 0x10e7a9c5ULL},
+{0xd5d1c02dULL, 0x1d5da24ULL, 0x733c0454ULL, 0x464eae5fULL, 0xd5d1c02dULL, 0xa73f6ab1ULL, 0xcc9e3fa4ULL, 0x464eae5fULL, 0x9c4e0e06ULL},
+{0x41657c87ULL, 0x5b629502ULL, 0x6fbed668ULL, 0xe80ca8aeULL, 0x41657c87ULL, 0x3a40a951ULL, 0xf8ec0ff0ULL, 0xe80ca8aeULL, 0x8f0d45a5ULL},
+{0xd4196f7dULL, 0x515c3c32ULL, 0x3312c49bULL, 0x347d54cULL, 0xd4196f7dULL, 0x2d46da2cULL, 0x17a214c1ULL, 0x347d54cULL, 0x88e6661ULL},
+{0x856ace73ULL, 0xa0203b91ULL, 0xce3d6031ULL, 0xb493a611ULL, 0x856ace73ULL, 0xc993297cULL, 0xf78f922ULL, 0xb493a611ULL, 0x59fee8ecULL},
+{0xbb00d4b3ULL, 0x5a9b4d7aULL, 0x73c87e7cULL, 0x62ba4ff5ULL, 0xbb00d4b3ULL, 0xf2d1613eULL, 0x4c147631ULL, 0x62ba4ff5ULL, 0x4549e2d6ULL},
+{0x46c3b785ULL, 0x19e8b942ULL, 0xd8cc9391ULL, 0xf0b00083ULL, 0x46c3b785ULL, 0x175fae7cULL, 0x7071b48bULL, 0xf0b00083ULL, 0x7a9fa6b6ULL},
+{0x911acc4cULL, 0x55da10f5ULL, 0x4e0d3a07ULL, 0xd3019ff8ULL, 0x911acc4cULL, 0x74ee41b9ULL, 0xbd4bc74cULL, 0xd3019ff8ULL, 0x2cc4f7d2ULL},
+{0x10128fb4ULL, 0x5a5a04a4ULL, 0xc6e68b07ULL, 0xef5ab904ULL, 0x10128fb4ULL, 0x7a6a9249ULL, 0x6865ee1fULL, 0xef5ab904ULL, 0x79c8f107ULL},
+{0x9886ea00ULL, 0x1bd88221ULL, 0xfdae0040ULL, 0x6387e46aULL, 0x9886ea00ULL, 0xc55008b1ULL, 0x85363cd0ULL, 0x6387e46aULL, 0x32e2915ULL},
+{0x416c40d2ULL, 0x6a5def05ULL, 0x4731b5abULL, 0x132d7a3bULL, 0x416c40d2ULL, 0x490736f0ULL, 0x4711b23ULL, 0x132d7a3bULL, 0xff9dca38ULL},
+{0xbcbd55d8ULL, 0xf46409c0ULL, 0xbd0653c6ULL, 0x214e9398ULL, 0xbcbd55d8ULL, 0x365e0a4ULL, 0xb1ffbdd7ULL, 0x214e9398ULL, 0xea3829cfULL},
+{0x946b58c2ULL, 0xd6859d86ULL, 0x7655d22ULL, 0xdf2278c0ULL, 0x946b58c2ULL, 0xdc7e4275ULL, 0x435e162aULL, 0xdf2278c0ULL, 0xa7c38a2ULL},
+{0xf39206a3ULL, 0xbf826d33ULL, 0x9181dc45ULL, 0xd6ded73cULL, 0xf39206a3ULL, 0x8c50dcd9ULL, 0x4f10217ULL, 0xd6ded73cULL, 0x4e392142ULL},
+{0x7611aee1ULL, 0x7423455fULL, 0xeed6489bULL, 0x4f091f6dULL, 0x7611aee1ULL, 0x7dd3468dULL, 0xfcc3c7efULL, 0x4f091f6dULL, 0xcefebadeULL},
+{0xacb317c6ULL, 0xc02d0eafULL, 0x2ca8745eULL, 0xc3a36247ULL, 0xacb317c6ULL, 0xbbc332dfULL, 0xec74743cULL, 0xc3a36247ULL, 0x4d525ff4ULL},
+{0x8e20b2ULL, 0x4a1e8b03ULL, 0xe2f79748ULL, 0x6eb935caULL, 0x8e20b2ULL, 0x885d48adULL, 0xd054e902ULL, 0x6eb935caULL, 0x600513acULL},
+{0x9a9a560cULL, 0xafcebecdULL, 0xc8889928ULL, 0xe11bba04ULL, 0x9a9a560cULL, 0x79ac822cULL, 0x50d25a8bULL, 0xe11bba04ULL, 0xdd79f871ULL},
+{0xbe5b2effULL, 0xb3b14428ULL, 0xe558dcd4ULL, 0x58287f90ULL, 0xbe5b2effULL, 0xc01cbf4ULL, 0xb931168bULL, 0x58287f90ULL, 0x2704e446ULL},
+{0x29c040cbULL, 0x75bb0f1ULL, 0x75617708ULL, 0x50ddd0ccULL, 0x29c040cbULL, 0x26a94b16ULL, 0x92d83501ULL, 0x50ddd0ccULL, 0xed2456b3ULL},
+{0x7e58a4ccULL, 0x49d02395ULL, 0x64471ab2ULL, 0xc61c0c35ULL, 0x7e58a4ccULL, 0x44232b5dULL, 0xd6fe7d72ULL, 0xc61c0c35ULL, 0x513141e3ULL},
+{0x69cdb4c3ULL, 0x9f222fb2ULL, 0xdbaec257ULL, 0xda5c0a8fULL, 0x69cdb4c3ULL, 0x8bb8d8a7ULL, 0x3c3aaf18ULL, 0xda5c0a8fULL, 0xeb632afdULL},
+{0xb0f6e2a9ULL, 0x3678430eULL, 0x8d2f87ffULL, 0x35a1bc14ULL, 0xb0f6e2a9ULL, 0x37f68215ULL, 0x92085debULL, 0x35a1bc14ULL, 0x37c0711ULL},
+{0x16b846d5ULL, 0xb85a6df8ULL, 0xd8ca1ff7ULL, 0x361f1879ULL, 0x16b846d5ULL, 0xf9256636ULL, 0xcb7fd71cULL, 0x361f1879ULL, 0x575b652ULL},
+{0x53c922a0ULL, 0xf4b1015ULL, 0xdbc2e733ULL, 0x91a92e2aULL, 0x53c922a0ULL, 0x2888cf44ULL, 0x2454606fULL, 0x91a92e2aULL, 0x9017db79ULL},
+{0x318f3793ULL, 0xdac1ddd3ULL, 0xd03e459cULL, 0x2e06f4b4ULL, 0x318f3793ULL, 0x38cfd03cULL, 0xed11853bULL, 0x2e06f4b4ULL, 0xfd40a983ULL},
+{0x8d458985ULL, 0x2bc1a032ULL, 0xec81fa3fULL, 0x3d4f412cULL, 0x8d458985ULL, 0x7d5e07cbULL, 0x298e992ULL, 0x3d4f412cULL, 0xfc7e881aULL},
+{0xb236b84bULL, 0xc9d4d456ULL, 0x63a1adc2ULL, 0x6c880ff9ULL, 0xb236b84bULL, 0xf6e4e4daULL, 0x9e88a245ULL, 0x6c880ff9ULL, 0x52322553ULL},
+{0x12256ec5ULL, 0x9317e1acULL, 0xbef1be63ULL, 0xd2c69cd1ULL, 0x12256ec5ULL, 0xe9212c1bULL, 0x76f2bafeULL, 0xd2c69cd1ULL, 0xc318474ULL},
+{0x5f495236ULL, 0x208cbd53ULL, 0x9fd02b3cULL, 0xa3c58911ULL, 0x5f495236ULL, 0x4e05d2f9ULL, 0xa37f61d5ULL, 0xa3c58911ULL, 0xe5ba7d06ULL},
+{0xa283dd3cULL, 0xd7966c27ULL, 0xc052a776ULL, 0x2e71a346ULL, 0xa283dd3cULL, 0x6069114cULL, 0xb845e2dULL, 0x2e71a346ULL, 0xfc9a672ULL},
+{0x64f5e829ULL, 0x3368c7daULL, 0x3e93527ULL, 0x1abaff9eULL, 0x64f5e829ULL, 0xafa986aaULL, 0x88bd204dULL, 0x1abaff9eULL, 0x649cbb54ULL},
+{0xa2a5434bULL, 0xc72bbb77ULL, 0x8cb595d7ULL, 0x8ae765eaULL, 0xa2a5434bULL, 0x6afa5b5ULL, 0x39a57856ULL, 0x8ae765eaULL, 0xb3be139bULL},
+{0xaed563a8ULL, 0x4f025d96ULL, 0x576bc80cULL, 0x5066866dULL, 0xaed563a8ULL, 0xa04829ecULL, 0x1c3591e0ULL, 0x5066866dULL, 0xe92e48ecULL},
+{0xbf94aadaULL, 0xeaacd206ULL, 0x2619ce0ULL, 0xc715a81aULL, 0xbf94aadaULL, 0xc3cd3562ULL, 0x72aa9d85ULL, 0xc715a81aULL, 0xecd5f994ULL},
+{0x69a6bffeULL, 0xebd55524ULL, 0x6be6264fULL, 0x5064bffdULL, 0x69a6bffeULL, 0x4d90ad44ULL, 0x9d6d0270ULL, 0x5064bffdULL, 0xd0117b77ULL},
+{0xcfcc6644ULL, 0x56d49b94ULL, 0x464b425cULL, 0xa1ce5a4dULL, 0xcfcc6644ULL, 0xe83d797bULL, 0x74141ca0ULL, 0xa1ce5a4dULL, 0xa5d5f766ULL},
+{0x9a669742ULL, 0x9cacbc5eULL, 0x5c7a944eULL, 0x60ad6dd0ULL, 0x9a669742ULL, 0xa59fc89ULL, 0x23467e0aULL, 0x60ad6dd0ULL, 0x4294f91ULL},
+{0x4758e086ULL, 0xd4841741ULL, 0x5f985536ULL, 0x7290e0acULL, 0x4758e086ULL, 0xc88584baULL, 0x4a0b257fULL, 0x7290e0acULL, 0x45c0a7e0ULL},
+{0xae231105ULL, 0xae8cc572ULL, 0xd1e5497fULL, 0x6485f732ULL, 0xae231105ULL, 0xa4ec8a10ULL, 0xda22fddeULL, 0x6485f732ULL, 0x3cf4bc99ULL},
+{0x7eba5d89ULL, 0x181ee5f0ULL, 0xb1d14425ULL, 0xa3a5d8ffULL, 0x7eba5d89ULL, 0x5aaf971ULL, 0xd834e341ULL, 0xa3a5d8ffULL, 0xf22a7a2aULL},
+{0x1ba38b31ULL, 0xb471484ULL, 0x6898da5cULL, 0x8b4ff68aULL, 0x1ba38b31ULL, 0x247ef502ULL, 0xc3174df2ULL, 0x8b4ff68aULL, 0xa9e04c3ULL},
+{0xe240d4b2ULL, 0xc45da2f0ULL, 0x9918c6fcULL, 0x60508f64ULL, 0xe240d4b2ULL, 0x87c234bcULL, 0xe9aaf6bULL, 0x60508f64ULL, 0xc2e5aa10ULL},
+{0xd9b06820ULL, 0xbf4330ecULL, 0xc02dce1ULL, 0x6d521904ULL, 0xd9b06820ULL, 0xbd2f75a7ULL, 0xe7364e4aULL, 0x6d521904ULL, 0xe4190b7ULL},
+{0x6710781cULL, 0x8619a79fULL, 0xa5a270c9ULL, 0xa279f1ddULL, 0x6710781cULL, 0x86919fe7ULL, 0xf651f5f1ULL, 0xa279f1ddULL, 0x2ae9c6eaULL},
+{0xa438e487ULL, 0x4899ebc5ULL, 0xcb1a43efULL, 0xaaa40817ULL, 0xa438e487ULL, 0xcb4b2feeULL, 0x884c7b39ULL, 0xaaa40817ULL, 0x2a4292bULL},
+{0xe03dfde9ULL, 0x36626383ULL, 0x805ec4c4ULL, 0xe59c9a17ULL, 0xe03dfde9ULL, 0x93673c55ULL, 0xe0589a69ULL, 0xe59c9a17ULL, 0x512a7ea3ULL},
+{0x584f9a52ULL, 0x84159ba5ULL, 0xe4417d18ULL, 0x121dc2bbULL, 0x584f9a52ULL, 0xaff67defULL, 0xe5a870caULL, 0x121dc2bbULL, 0xfa50eb40ULL},
+{0x97a81688ULL, 0x4e0bbab0ULL, 0xeae821fcULL, 0x95dcb72aULL, 0x97a81688ULL, 0xf7db826ULL, 0x5fec34d0ULL, 0x95dcb72aULL, 0xa8b86043ULL},
+{0x8bbf3bb6ULL, 0x1bb0601fULL, 0xd86775b2ULL, 0xa8784615ULL, 0x8bbf3bb6ULL, 0x823a06fULL, 0xc831c6d0ULL, 0xa8784615ULL, 0x54a7f55dULL},
+{0xb5b9936bULL, 0x8da0f82fULL, 0xf5e15f59ULL, 0x288e16a6ULL, 0xb5b9936bULL, 0xd50220e9ULL, 0x899549f3ULL, 0x288e16a6ULL, 0xdaa3546cULL},
+{0x34e4869fULL, 0x791fdd3fULL, 0x3f1d49faULL, 0x4793006aULL, 0x34e4869fULL, 0xfa6bc96dULL, 0xd7d6d7cfULL, 0x4793006aULL, 0xcede434fULL},
+{0x579e1bb7ULL, 0xccb6daa0ULL, 0x471abaeULL, 0x2a9c96d5ULL, 0x579e1bb7ULL, 0xea91d58bULL, 0x6738f938ULL, 0x2a9c96d5ULL, 0x540d339eULL},
+{0x936d964bULL, 0x9c8281f6ULL, 0x93f59245ULL, 0x1e733819ULL, 0x936d964bULL, 0xf6a2208dULL, 0xf4c0fa02ULL, 0x1e733819ULL, 0xad589085ULL},
+{0xeda40972ULL, 0xfbffbd65ULL, 0x21b14878ULL, 0xefe8a179ULL, 0xeda40972ULL, 0x183f690aULL, 0x750acdd2ULL, 0xefe8a179ULL, 0x515ea41dULL},
+{0x444d0fc9ULL, 0xf74317eeULL, 0xa79fd88fULL, 0x1d49599eULL, 0x444d0fc9ULL, 0x11d0e6bcULL, 0xf409bc32ULL, 0x1d49599eULL, 0xa540c4ULL},
+{0x37e402baULL, 0x2d237015ULL, 0xf4f54447ULL, 0xfd266addULL, 0x37e402baULL, 0x9fae35b6ULL, 0xd8fd091dULL, 0xfd266addULL, 0xffdd949eULL},
+{0xbfb3e6afULL, 0x6bb3b8bULL, 0xf358f212ULL, 0x1fcee40eULL, 0xbfb3e6afULL, 0xf95ce228ULL, 0x6b4e148aULL, 0x1fcee40eULL, 0x5f0a8fdfULL},
+{0xa8c71189ULL, 0xd2f9c0eaULL, 0x9080e264ULL, 0x250aa734ULL, 0xa8c71189ULL, 0xc542306bULL, 0x10dec768ULL, 0x250aa734ULL, 0x9d531586ULL},
+{0xb49b66a0ULL, 0xa5afc672ULL, 0x57c130d7ULL, 0x17ff80ccULL, 0xb49b66a0ULL, 0x933a280cULL, 0xa5b66399ULL, 0x17ff80ccULL, 0x396deea7ULL},
+{0x9034fbc7ULL, 0x33d5788aULL, 0x1c96ef6dULL, 0x6cc597d5ULL, 0x9034fbc7ULL, 0x374d406dULL, 0x56da6217ULL, 0x6cc597d5ULL, 0x3dee5470ULL},
+{0x2f67c4b3ULL, 0xf74f814aULL, 0xa7541377ULL, 0xbd1db246ULL, 0x2f67c4b3ULL, 0x1075760eULL, 0x31067217ULL, 0xbd1db246ULL, 0xc3353240ULL},
+{0x2de9e8f2ULL, 0xbf1392bfULL, 0xaf075725ULL, 0x6d03055eULL, 0x2de9e8f2ULL, 0x6ea5241ULL, 0x235739c3ULL, 0x6d03055eULL, 0x9ddfba4aULL},
+{0x6cbc077dULL, 0x23666061ULL, 0x2ccaba59ULL, 0xfbc57f57ULL, 0x6cbc077dULL, 0xc396a09ULL, 0x8f12f4f3ULL, 0xfbc57f57ULL, 0x98d234ebULL},
+{0xd02859e1ULL, 0x2a718a1aULL, 0x65a4978cULL, 0xb6c82302ULL, 0xd02859e1ULL, 0xc94a9babULL, 0x6d939d70ULL, 0xb6c82302ULL, 0x87576936ULL},
+{0x914b97abULL, 0x67e8ff3bULL, 0x6f65af38ULL, 0x6bf884cbULL, 0x914b97abULL, 0x86b3e0c4ULL, 0x9979252cULL, 0x6bf884cbULL, 0x192f5a69ULL},
+{0x92220c2fULL, 0xf293b40dULL, 0xdf4aac89ULL, 0x6e619983ULL, 0x92220c2fULL, 0x17514a45ULL, 0x6ac93d27ULL, 0x6e619983ULL, 0xe9404df8ULL},
+{0x62bb83d3ULL, 0x49caeb6dULL, 0x22d57defULL, 0xc95e34a3ULL, 0x62bb83d3ULL, 0xe71c9ce1ULL, 0x9a7d44cfULL, 0xc95e34a3ULL, 0xaa199c6fULL},
+{0xca5e3475ULL, 0xacfef49cULL, 0x2a1ba16eULL, 0xb08ad860ULL, 0xca5e3475ULL, 0xed6963e4ULL, 0x8ee62033ULL, 0xb08ad860ULL, 0x286c54e2ULL},
+{0x36475a96ULL, 0x7a72bbcfULL, 0x6eaf9dc5ULL, 0x21332272ULL, 0x36475a96ULL, 0xcf9bd702ULL, 0x39932a3fULL, 0x21332272ULL, 0xe0a8bf96ULL},
+{0xfa0adcddULL, 0x75af5434ULL, 0xa3ab02b8ULL, 0x2fecfe6fULL, 0xfa0adcddULL, 0x7760d657ULL, 0xa8ec30f6ULL, 0x2fecfe6fULL, 0x945f8b4ULL},
+{0x3644a090ULL, 0xd69c6738ULL, 0x54307190ULL, 0xf59868e7ULL, 0x3644a090ULL, 0x7478da6aULL, 0x13314b77ULL, 0xf59868e7ULL, 0xa1c38558ULL},
+{0xa29a6ac6ULL, 0x34c08801ULL, 0x9bbee5ULL, 0xca79af2dULL, 0xa29a6ac6ULL, 0x13e0756bULL, 0xcf0af962ULL, 0xca79af2dULL, 0x9c343bb8ULL},
+{0x79fc6667ULL, 0x527d7ceeULL, 0x71914237ULL, 0x57d0e0f9ULL, 0x79fc6667ULL, 0x3d20cc18ULL, 0xb1428ab6ULL, 0x57d0e0f9ULL, 0x3c328becULL},
+{0x882c6250ULL, 0x66064c89ULL, 0xb21f7466ULL, 0x6eece433ULL, 0x882c6250ULL, 0xcdb0428fULL, 0xf30bb74eULL, 0x6eece433ULL, 0x9ab66a93ULL},
+{0xcda0431ULL, 0x41fdd3baULL, 0x530e6326ULL, 0x17a8f2a8ULL, 0xcda0431ULL, 0xb32888f4ULL, 0xa3bba955ULL, 0x17a8f2a8ULL, 0x8dc3032dULL},
+{0x29bb6000ULL, 0x132c64e7ULL, 0xc4ef77d5ULL, 0x105beb30ULL, 0x29bb6000ULL, 0x100b6fbaULL, 0x8de57328ULL, 0x105beb30ULL, 0x29152ff4ULL},
+{0xee3d601fULL, 0xee64aca9ULL, 0x3a458333ULL, 0x84a20d9dULL, 0xee3d601fULL, 0x4a277b07ULL, 0x539b0647ULL, 0x84a20d9dULL, 0x6f44b803ULL},
+{0xf07c94a4ULL, 0xefcf4483ULL, 0xef1da5e7ULL, 0xd18ac968ULL, 0xf07c94a4ULL, 0x83472e7cULL, 0x832c2a2fULL, 0xd18ac968ULL, 0x65284828ULL},
+{0xbd2f657cULL, 0x849c31f5ULL, 0x9c601cb1ULL, 0xd4ac97c9ULL, 0xbd2f657cULL, 0x9119d826ULL, 0x31cd677fULL, 0xd4ac97c9ULL, 0x214c7405ULL},
+{0xa12c560fULL, 0x68671eb6ULL, 0xc02544edULL, 0x584d5154ULL, 0xa12c560fULL, 0x8f26b859ULL, 0xb2dd43d6ULL, 0x584d5154ULL, 0xb097048dULL},
+{0xcd69874dULL, 0xbb6c056cULL, 0xb7d53947ULL, 0x8598c21fULL, 0xcd69874dULL, 0x7e4e4a0bULL, 0x530b34edULL, 0x8598c21fULL, 0x80e17d6dULL},
+{0x2f9e870fULL, 0x5cc4000eULL, 0xf7842f14ULL, 0x49653764ULL, 0x2f9e870fULL, 0x649641b8ULL, 0x6889c8f4ULL, 0x49653764ULL, 0x66be6170ULL},
+{0xf6d01f2aULL, 0x1476dbbcULL, 0x5e7d3b2bULL, 0x22971410ULL, 0xf6d01f2aULL, 0xd91f13d9ULL, 0x8abc346aULL, 0x22971410ULL, 0x26a89f81ULL},
+{0x192d9343ULL, 0x86882a9eULL, 0xa6e86bdULL, 0x931be940ULL, 0x192d9343ULL, 0x4cd6e796ULL, 0xc99ac3c7ULL, 0x931be940ULL, 0xe3fbe43cULL},
+{0x33a0a89eULL, 0xc6398190ULL, 0x72ae5494ULL, 0x749e60beULL, 0x33a0a89eULL, 0xbc5f89d9ULL, 0x4a57e651ULL, 0x749e60beULL, 0x7bbff3f6ULL},
+{0x62a3da2cULL, 0xc2f550f8ULL, 0xbdc3f651ULL, 0x2c65c3a3ULL, 0x62a3da2cULL, 0x86adcdfeULL, 0x9d71d955ULL, 0x2c65c3a3ULL, 0x56ac3cdULL},
+{0xc7a47f1bULL, 0x483b471dULL, 0x83226049ULL, 0x3fa718c0ULL, 0xc7a47f1bULL, 0x6d020b60ULL, 0xa693e1bULL, 0x3fa718c0ULL, 0xbb36ecd8ULL},
+{0x892a0325ULL, 0xbf9c359ULL, 0x297ae25cULL, 0x7b338914ULL, 0x892a0325ULL, 0x2ae00a23ULL, 0xff39128ULL, 0x7b338914ULL, 0x7a3a8ffULL},
+{0x3eeea18dULL, 0xa4dcd32fULL, 0x2c47875aULL, 0xd61b7812ULL, 0x3eeea18dULL, 0x4cbd7933ULL, 0xa57cada2ULL, 0xd61b7812ULL, 0x4c288216ULL},
+{0x988ee8ecULL, 0xc424166cULL, 0x14dd8814ULL, 0x222cae21ULL, 0x988ee8ecULL, 0x2bcadd08ULL, 0xab491ccULL, 0x222cae21ULL, 0x99cdf39cULL},
+{0x5a59ef1ULL, 0x3224c7d3ULL, 0xf4fc1f0bULL, 0xa29d4e1eULL, 0x5a59ef1ULL, 0xd3e34437ULL, 0xde2bb988ULL, 0xa29d4e1eULL, 0xb520441cULL},
+{0x65e12a3cULL, 0xb6be2e2bULL, 0xb843acdcULL, 0x9442d8e0ULL, 0x65e12a3cULL, 0xb1a33613ULL, 0xd0ee2f18ULL, 0x9442d8e0ULL, 0x8c5d2d06ULL},
+{0x71a161d0ULL, 0x218d5f6fULL, 0x5ab17886ULL, 0x2e391a30ULL, 0x71a161d0ULL, 0x7cb24d95ULL, 0x74700713ULL, 0x2e391a30ULL, 0x5782a0bfULL},
+{0x4a7bb6d9ULL, 0x437634e1ULL, 0x6509169ULL, 0xadd865c6ULL, 0x4a7bb6d9ULL, 0xde985debULL, 0x7b499bfeULL, 0xadd865c6ULL, 0xed1f6938ULL},
+{0xc7a408e4ULL, 0xe553c210ULL, 0x954d1abdULL, 0x9783b6ecULL, 0xc7a408e4ULL, 0xf387de4dULL, 0xcc58d371ULL, 0x9783b6ecULL, 0x7de526bcULL},
+{0x98846e1cULL, 0x7c4427f2ULL, 0x769d4e2dULL, 0xf180d655ULL, 0x98846e1cULL, 0x5d2e0aeeULL, 0x252bb123ULL, 0xf180d655ULL, 0xd7617cfbULL},
+{0x2f3c59bULL, 0x853ee1bULL, 0xf8cc21a6ULL, 0xb5c221a3ULL, 0x2f3c59bULL, 0x4a80670dULL, 0xa50535c5ULL, 0xb5c221a3ULL, 0x67bd0f1eULL},
+{0x9a88a7b2ULL, 0x4867a0b5ULL, 0x2df66363ULL, 0xfee91b8eULL, 0x9a88a7b2ULL, 0xafba9e51ULL, 0x11ec38e9ULL, 0xfee91b8eULL, 0x3586b673ULL},
+{0x6934b469ULL, 0x59c7ee60ULL, 0xbd86506cULL, 0x7540e3c1ULL, 0x6934b469ULL, 0xcd351305ULL, 0x35f2fb05ULL, 0x7540e3c1ULL, 0xbe978d74ULL},
+{0xdeefa64fULL, 0xd90ec7cdULL, 0x8b7080f2ULL, 0x2eb5bc26ULL, 0xdeefa64fULL, 0xf0de78fdULL, 0x43748d98ULL, 0x2eb5bc26ULL, 0xd3b844c1ULL},
+{0x9e9537e9ULL, 0x5564d9b8ULL, 0xaafb2e3ULL, 0x94d6ec13ULL, 0x9e9537e9ULL, 0xcbd38d54ULL, 0xa5b77f77ULL, 0x94d6ec13ULL, 0xd44bbda2ULL},
+{0x2469e793ULL, 0x69eec024ULL, 0x60c27135ULL, 0xe5516b02ULL, 0x2469e793ULL, 0x5ff09781ULL, 0xa1a9ab5fULL, 0xe5516b02ULL, 0xa5b7b03eULL},
+{0x2c6665a3ULL, 0xc22b2a20ULL, 0xe484335bULL, 0xe180a3a0ULL, 0x2c6665a3ULL, 0x3163560ULL, 0xdd3c6e95ULL, 0xe180a3a0ULL, 0xf46d93a0ULL},
+{0xc5126c1cULL, 0x85fcabeaULL, 0xac0b92d9ULL, 0x91b69533ULL, 0xc5126c1cULL, 0xe60a10feULL, 0x5e5fec6cULL, 0x91b69533ULL, 0xbd85879aULL},
+{0xb80c1053ULL, 0xef7def0eULL, 0x9297a715ULL, 0x314dcaf7ULL, 0xb80c1053ULL, 0x2ccdd365ULL, 0x3246a2bbULL, 0x314dcaf7ULL, 0x91810988ULL},
+{0x4fc13bfdULL, 0xfc7f1bd3ULL, 0xeebc8c8fULL, 0x8312fccbULL, 0x4fc13bfdULL, 0xd7614266ULL, 0x38eb0ccdULL, 0x8312fccbULL, 0x52724d82ULL},
+{0xf07f9589ULL, 0x92a43300ULL, 0xf88a1b3dULL, 0x88accc81ULL, 0xf07f9589ULL, 0x47844677ULL, 0x53d295a4ULL, 0x88accc81ULL, 0x8680da81ULL},
+{0xa933fadeULL, 0x868832dcULL, 0xb4f9e3b7ULL, 0x61e730eaULL, 0xa933fadeULL, 0x7cfa4abbULL, 0xe7ddbf5bULL, 0x61e730eaULL, 0x1fca7389ULL},
+{0x18b1bbc2ULL, 0x69f44916ULL, 0x54dfbaa2ULL, 0x1a5eed88ULL, 0x18b1bbc2ULL, 0x3645894fULL, 0x9608e674ULL, 0x1a5eed88ULL, 0xaa68c267ULL},
+{0x3d9e27a7ULL, 0x9cfdefe2ULL, 0x477866c7ULL, 0xa6c05b6cULL, 0x3d9e27a7ULL, 0x9b3149baULL, 0xfc07e5f5ULL, 0xa6c05b6cULL, 0x53166796ULL},
+{0xceccf92bULL, 0x6133b5b3ULL, 0x4563d32dULL, 0xc40edd68ULL, 0xceccf92bULL, 0xb9934833ULL, 0xd1cbf8eeULL, 0xc40edd68ULL, 0xadbd34fdULL},
+{0x90e8b6beULL, 0xb953187cULL, 0x3417c513ULL, 0x83b99b55ULL, 0x90e8b6beULL, 0xd8cc6fdfULL, 0xdb34defcULL, 0x83b99b55ULL, 0x6effd77bULL},
+{0x80e857f1ULL, 0x2e8ba7bbULL, 0x57a9b43cULL, 0x49765cf2ULL, 0x80e857f1ULL, 0x60634d0ULL, 0xda63d4faULL, 0x49765cf2ULL, 0x70e7a731ULL},
+{0x4f96be66ULL, 0x1211bccULL, 0xd5f83ce1ULL, 0x7f479e94ULL, 0x4f96be66ULL, 0x8410cfdeULL, 0xafd324f8ULL, 0x7f479e94ULL, 0xb93dad5ULL},
+{0xa72cacd8ULL, 0xcaeedcbeULL, 0xcfdf7deaULL, 0x60357f94ULL, 0xa72cacd8ULL, 0x1bb9d348ULL, 0xa374ff16ULL, 0x60357f94ULL, 0x9016508bULL},
+{0x3c11267aULL, 0xc8d81967ULL, 0xd70f4147ULL, 0x3b7d44cfULL, 0x3c11267aULL, 0x98e47684ULL, 0x7594bbdaULL, 0x3b7d44cfULL, 0xd3ddba68ULL},
+{0x8ef9c574ULL, 0x90b5de86ULL, 0x654817e5ULL, 0x328015b8ULL, 0x8ef9c574ULL, 0x804a032bULL, 0xfc475326ULL, 0x328015b8ULL, 0xd17aa3a7ULL},
+{0x58008bb5ULL, 0x800206a4ULL, 0xf80add44ULL, 0xa100d7afULL, 0x58008bb5ULL, 0xcf8bffbaULL, 0x8443f79eULL, 0xa100d7afULL, 0x7a465c9aULL},
+{0x8bdcadfcULL, 0x4c48aabfULL, 0xc2a094fbULL, 0xa4cb2afbULL, 0x8bdcadfcULL, 0x33935fd1ULL, 0x631baaa4ULL, 0xa4cb2afbULL, 0xc8bf8715ULL},
+{0xaa462362ULL, 0x3ea3ded4ULL, 0x195655a1ULL, 0x232d1b4aULL, 0xaa462362ULL, 0x2fcd4c3cULL, 0x901680e1ULL, 0x232d1b4aULL, 0x4002d0aaULL},
+{0x10499653ULL, 0x4d64fa97ULL, 0xdc45f43fULL, 0xd0fb2f05ULL, 0x10499653ULL, 0x761004f1ULL, 0xbfd71a98ULL, 0xd0fb2f05ULL, 0x7b43bd85ULL},
+{0xc3f1ecb5ULL, 0x2de05504ULL, 0x69a4269bULL, 0x5fa08479ULL, 0xc3f1ecb5ULL, 0x3ab0a38eULL, 0x1d8b304eULL, 0x5fa08479ULL, 0x92b16efdULL},
+{0xd5e7f80dULL, 0x6ae1ef0cULL, 0x3280b9a3ULL, 0x4cdffa8aULL, 0xd5e7f80dULL, 0x852c0beeULL, 0x385453b9ULL, 0x4cdffa8aULL, 0xd32002c4ULL},
+{0x9ea3ccd4ULL, 0x981cc17dULL, 0x88d8f7e2ULL, 0x1f6da83fULL, 0x9ea3ccd4ULL, 0xb88df917ULL, 0xbe037217ULL, 0x1f6da83fULL, 0xc0e729feULL},
+{0x87c3fc27ULL, 0x8cc9a985ULL, 0xd8f4faceULL, 0xf5edb319ULL, 0x87c3fc27ULL, 0xd1366f64ULL, 0x2f120e2eULL, 0xf5edb319ULL, 0xcd08ceb1ULL},
+{0xb265be72ULL, 0xd477441ULL, 0x370b7229ULL, 0x939529abULL, 0xb265be72ULL, 0xf1b567dbULL, 0x3b08d767ULL, 0x939529abULL, 0x73f84fbULL},
+{0xf1ac488cULL, 0x3230c416ULL, 0x3f29e6fdULL, 0x7d2faaabULL, 0xf1ac488cULL, 0x3f7ef4b6ULL, 0xb5651677ULL, 0x7d2faaabULL, 0xbe0f84e9ULL},
+{0xac520845ULL, 0x4396aef4ULL, 0xeccb4f50ULL, 0x98296d09ULL, 0xac520845ULL, 0xf6b55c4fULL, 0xb70ea32eULL, 0x98296d09ULL, 0x9e3efa3eULL},
+{0xc366feb5ULL, 0x12dca6e3ULL, 0xf659cafaULL, 0xbaa13db6ULL, 0xc366feb5ULL, 0xd42d3446ULL, 0x8f92bae3ULL, 0xbaa13db6ULL, 0xb4327b48ULL},
+{0x875439aULL, 0x2a44502ULL, 0x3d4bf037ULL, 0x747d9bd5ULL, 0x875439aULL, 0x16746d92ULL, 0x72995ea5ULL, 0x747d9bd5ULL, 0x43cddff5ULL},
+{0x403ecb21ULL, 0x89b225c8ULL, 0x40b962b5ULL, 0xd6f5ede4ULL, 0x403ecb21ULL, 0xbc2c3258ULL, 0x8d95d28ULL, 0xd6f5ede4ULL, 0x3121e32cULL},
+{0xd9e15c13ULL, 0x84b7da41ULL, 0xae30397cULL, 0x480b48e2ULL, 0xd9e15c13ULL, 0xf3c52b4eULL, 0xc684650aULL, 0x480b48e2ULL, 0x14ca960dULL},
+{0x9907c023ULL, 0xdbcb1270ULL, 0x8054711bULL, 0xde2af634ULL, 0x9907c023ULL, 0x15550cccULL, 0x916bdd75ULL, 0xde2af634ULL, 0x379d4129ULL},
+{0x991ac099ULL, 0x3a451dbULL, 0xf896d678ULL, 0x464db5e0ULL, 0x991ac099ULL, 0x37cf08e4ULL, 0x1a5d9edaULL, 0x464db5e0ULL, 0x211f690fULL},
+{0x45d1d416ULL, 0x89bbfe9cULL, 0xd7b46b2aULL, 0xf580fe2ULL, 0x45d1d416ULL, 0xb3c03a7ULL, 0x12e3b211ULL, 0xf580fe2ULL, 0x61d34334ULL},
+{0xd2abe932ULL, 0xce4be8c0ULL, 0xaa4855e2ULL, 0x99e5c9ffULL, 0xd2abe932ULL, 0x5ea333c0ULL, 0x5d6fe6dULL, 0x99e5c9ffULL, 0x496eddbaULL},
+{0x7a58e0efULL, 0x88261473ULL, 0x53419cafULL, 0xcbe8c573ULL, 0x7a58e0efULL, 0x5f47dcdaULL, 0x5f0f64b7ULL, 0xcbe8c573ULL, 0x95bd8d30ULL}},
+  {{0x8926889ULL, 0xc1fc3300ULL, 0xd178b538ULL, 0x2dda8298ULL, 0x8926889ULL, 0x931de828ULL, 0x72de25b8ULL, 0x2dda8298ULL, 0x1f27daacULL},
+{0xa07531f7ULL, 0x9ac9a034ULL, 0x61f1dd00ULL, 0x41c50a96ULL, 0xa07531f7ULL, 0x5632fcdcULL, 0xf80586deULL, 0x41c50a96ULL, 0xb75eae5fULL},
+{0x6bd54144ULL, 0x8fcbde50ULL, 0xee0db25eULL, 0x4f6b2cc5ULL, 0x6bd54144ULL, 0xb8e1f527ULL, 0x5173f2fbULL, 0x4f6b2cc5ULL, 0xb2013862ULL},
+{0x8d947df6ULL, 0x52f11952ULL, 0xdf0f7c42ULL, 0x47a6997cULL, 0x8d947df6ULL, 0xf44926d0ULL, 0x8ac083e8ULL, 0x47a6997cULL, 0x57b5b826ULL},
+{0x38d5a9e1ULL, 0xd1aaa177ULL, 0x5ce50ac0ULL, 0xdb06d827ULL, 0x38d5a9e1ULL, 0x5a6ca9d7ULL, 0x315e991eULL, 0xdb06d827ULL, 0xa055c071ULL},
+{0xb696c4d4ULL, 0xc0739a17ULL, 0x10138977ULL, 0x247b4772ULL, 0xb696c4d4ULL, 0xf6fa469cULL, 0x7255cc50ULL, 0x247b4772ULL, 0x7a7f7f30ULL},
+{0x9c607957ULL, 0x1cbbad81ULL, 0xb63d208ULL, 0x94f9c5cfULL, 0x9c607957ULL, 0xb110665bULL, 0x2d48dbabULL, 0x94f9c5cfULL, 0xd13f366bULL},
+{0xfe7648f7ULL, 0xa69d17f8ULL, 0x957ad858ULL, 0xfd0b3e2cULL, 0xfe7648f7ULL, 0xf4136ff9ULL, 0xe6dca432ULL, 0xfd0b3e2cULL, 0x57d6cf13ULL},
+{0x7b15e5a1ULL, 0x550621eULL, 0xff611e4fULL, 0x7ffa09bbULL, 0x7b15e5a1ULL, 0xb5bfba9dULL, 0xd6ea610aULL, 0x7ffa09bbULL, 0x33b5ce45ULL},
+{0xe24e7684ULL, 0x3863e30cULL, 0xe635d246ULL, 0x4ad077a5ULL, 0xe24e7684ULL, 0x73b3604aULL, 0x9f30441ULL, 0x4ad077a5ULL, 0x76858a83ULL},
+{0x74fb97e3ULL, 0xcba83edbULL, 0xc96e50d2ULL, 0xa6cf3f6eULL, 0x74fb97e3ULL, 0xfc1788efULL, 0x12edfea0ULL, 0xa6cf3f6eULL, 0xc1c0e4cfULL},
+{0xc2f152b1ULL, 0xfe142e42ULL, 0x7908515aULL, 0x24151967ULL, 0xc2f152b1ULL, 0x64ad44e2ULL, 0x22db190dULL, 0x24151967ULL, 0x3e6f1e8cULL},
+{0x57d70e9bULL, 0x4ca49affULL, 0x70d47615ULL, 0xc8a0c06fULL, 0x57d70e9bULL, 0x40bb5701ULL, 0xf7ee903bULL, 0xc8a0c06fULL, 0x4616ba4bULL},
+{0x8ba6167bULL, 0x94acc840ULL, 0x8cb53f6ULL, 0x89b30006ULL, 0x8ba6167bULL, 0x7d2350a9ULL, 0xf64ad1a3ULL, 0x89b30006ULL, 0x46c8a060ULL},
+{0xac49f284ULL, 0xa78ab708ULL, 0x37ac7946ULL, 0xe63e2cdaULL, 0xac49f284ULL, 0xf17d4dc3ULL, 0x86b03f48ULL, 0xe63e2cdaULL, 0x57534b99ULL},
+{0x1ea15a1dULL, 0x480e650eULL, 0xab18d18aULL, 0x764ec2cfULL, 0x1ea15a1dULL, 0x4af46bb4ULL, 0x48473ab8ULL, 0x764ec2cfULL, 0x8c54bdc2ULL},
+{0xaf23e5bcULL, 0x37d87f16ULL, 0x755cceaULL, 0x5ba69ef6ULL, 0xaf23e5bcULL, 0xf1d09cefULL, 0x39e666c6ULL, 0x5ba69ef6ULL, 0xe2f39fcULL},
+{0x3fe1df3aULL, 0x1f7076e5ULL, 0x219644f2ULL, 0xe4aca770ULL, 0x3fe1df3aULL, 0xc072049bULL, 0x3fcecc85ULL, 0xe4aca770ULL, 0x4971d0b7ULL},
+{0xc3901041ULL, 0xc38de48eULL, 0xdbb7b48bULL, 0xc1e06a44ULL, 0xc3901041ULL, 0xb606841bULL, 0x6c8eaa5cULL, 0xc1e06a44ULL, 0x6006fc8fULL},
+{0x81dff5b7ULL, 0x3d767970ULL, 0x70830f33ULL, 0x31841d8cULL, 0x81dff5b7ULL, 0xd8a4962aULL, 0x46086007ULL, 0x31841d8cULL, 0x8c705cc3ULL},
+{0x83e17603ULL, 0x99408e96ULL, 0x433fa169ULL, 0x81872ac9ULL, 0x83e17603ULL, 0x8f8719b5ULL, 0x91dd54fULL, 0x81872ac9ULL, 0x82aae439ULL},
+{0xbb7d93d3ULL, 0x25a5944aULL, 0x4c75004aULL, 0x4e5dc463ULL, 0xbb7d93d3ULL, 0xbdc9de0fULL, 0xac5d8931ULL, 0x4e5dc463ULL, 0x9e3d4d1ULL},
+{0xf79aa06cULL, 0xc4fcfbc1ULL, 0xd2b38589ULL, 0x472f0d13ULL, 0xf79aa06cULL, 0x13c386e8ULL, 0xe029138aULL, 0x472f0d13ULL, 0x5229de2ULL},
+{0xc9d2ff00ULL, 0xfa1e2789ULL, 0xba133212ULL, 0xae72506cULL, 0xc9d2ff00ULL, 0xa64e3a7dULL, 0xeca3140cULL, 0xae72506cULL, 0xd05c383bULL},
+{0x992228f7ULL, 0x437b9a8eULL, 0xc678b026ULL, 0x671ccba3ULL, 0x992228f7ULL, 0xf8e98b2eULL, 0x97daca78ULL, 0x671ccba3ULL, 0xa5c788aaULL},
+{0xc0334b01ULL, 0xf04b35acULL, 0x84227575ULL, 0xa0941628ULL, 0xc0334b01ULL, 0xbe53eb05ULL, 0x883db9b0ULL, 0xa0941628ULL, 0x784d409aULL},
+{0xad27999eULL, 0xe045574eULL, 0x389be117ULL, 0xeeeb127ULL, 0xad27999eULL, 0x8fe83b6dULL, 0xa86eadc7ULL, 0xeeeb127ULL, 0xa7f389baULL},
+{0x7ab3f40eULL, 0xaa2f9492ULL, 0xc4d0f217ULL, 0x6625c82cULL, 0x7ab3f40eULL, 0xec78480fULL, 0x4e28e53ULL, 0x6625c82cULL, 0xbccf8161ULL},
+{0x3613fbcdULL, 0x716f083fULL, 0xf9875ef6ULL, 0xd9bad817ULL, 0x3613fbcdULL, 0x1f597665ULL, 0x5e7ed525ULL, 0xd9bad817ULL, 0x4edbb4e8ULL},
+{0x288439c4ULL, 0xed9d6bb6ULL, 0x61bc40cfULL, 0x70906108ULL, 0x288439c4ULL, 0xed070f7ULL, 0x3fe8282bULL, 0x70906108ULL, 0x344dca3cULL},
+{0x61fba920ULL, 0x24e8360bULL, 0x2885d0c3ULL, 0xc2b71d82ULL, 0x61fba920ULL, 0x4645fd70ULL, 0xd4ac01afULL, 0xc2b71d82ULL, 0x878af965ULL},
+{0x6e2bce18ULL, 0x5c836bc1ULL, 0xd068ca47ULL, 0xf8007033ULL, 0x6e2bce18ULL, 0x8733cacULL, 0xd73bc762ULL, 0xf8007033ULL, 0x238cb590ULL},
+{0xe77c50a5ULL, 0x2fe3e178ULL, 0x42a46fc8ULL, 0x2cac74acULL, 0xe77c50a5ULL, 0xb8562331ULL, 0x7774ba75ULL, 0x2cac74acULL, 0x84f5c562ULL},
+{0x8823182dULL, 0x6c48c8aULL, 0x4219ebd9ULL, 0x8f316d4ULL, 0x8823182dULL, 0x67b0eb78ULL, 0x1c624bddULL, 0x8f316d4ULL, 0x642e1604ULL},
+{0x5b241caeULL, 0x2ac45251ULL, 0x2cc46a23ULL, 0x4a044ceULL, 0x5b241caeULL, 0x3fdc1612ULL, 0x3cb9e44ULL, 0x4a044ceULL, 0xeca9ae7cULL},
+{0x4ae24f60ULL, 0x719635aaULL, 0xe892e92bULL, 0xab7c5d09ULL, 0x4ae24f60ULL, 0x1b65e17cULL, 0x3953bd7eULL, 0xab7c5d09ULL, 0x6288a40fULL},
+{0x45e6f916ULL, 0xf0512ce7ULL, 0x710be9feULL, 0x107a77e7ULL, 0x45e6f916ULL, 0x5450cdc0ULL, 0x31156943ULL, 0x107a77e7ULL, 0x69cb159cULL},
+{0x6b303ad4ULL, 0xb6a7005fULL, 0x6ad6993aULL, 0x6f99f9c9ULL, 0x6b303ad4ULL, 0xe6d3db5cULL, 0x31e51ddaULL, 0x6f99f9c9ULL, 0xf4e94092ULL},
+{0x550f83a0ULL, 0x3686b9ebULL, 0x2b342a7fULL, 0xac4a2b5cULL, 0x550f83a0ULL, 0xfd204489ULL, 0x8c121349ULL, 0xac4a2b5cULL, 0xeeefcd83ULL},
+{0xf9fcd9f2ULL, 0xed990e2dULL, 0xb848663cULL, 0xc7d3eb51ULL, 0xf9fcd9f2ULL, 0xf0e250d3ULL, 0xe3dd3505ULL, 0xc7d3eb51ULL, 0xdf66c667ULL},
+{0x5916d405ULL, 0x25ba6aa6ULL, 0x4e9403c7ULL, 0xea2eb269ULL, 0x5916d405ULL, 0x6a6c8ddbULL, 0x35f0b19eULL, 0xea2eb269ULL, 0xcc363d50ULL},
+{0xe8cb80daULL, 0x9949d4faULL, 0x90aebad7ULL, 0x592bb772ULL, 0xe8cb80daULL, 0xa2f16624ULL, 0x858e85ULL, 0x592bb772ULL, 0x99c6f89fULL},
+{0x9c7ce0c2ULL, 0x8accf919ULL, 0x80278f41ULL, 0x84c8c97dULL, 0x9c7ce0c2ULL, 0x6e442d4bULL, 0x13e9d267ULL, 0x84c8c97dULL, 0xf99fe9b8ULL},
+{0x2fe1cc72ULL, 0xfcc24499ULL, 0x619428eaULL, 0xeff4a697ULL, 0x2fe1cc72ULL, 0x55c6665fULL, 0xef9720e2ULL, 0xeff4a697ULL, 0xfc0843cULL},
+{0x2f69ffdULL, 0x2923ccb2ULL, 0x355f308ULL, 0xcfa6f844ULL, 0x2f69ffdULL, 0x1ac0c899ULL, 0x1f0ec26ULL, 0xcfa6f844ULL, 0xf20608beULL},
+{0x8da8138aULL, 0xfa23225eULL, 0x7cac6e67ULL, 0x416573f0ULL, 0x8da8138aULL, 0x9a46245aULL, 0xbe3e7d63ULL, 0x416573f0ULL, 0x8852edc0ULL},
+{0xbeae5f4aULL, 0xa25c5420ULL, 0x7bfbea01ULL, 0xdf47abd5ULL, 0xbeae5f4aULL, 0x2968b5b3ULL, 0x93426a65ULL, 0xdf47abd5ULL, 0x8c1dda5eULL},
+{0x4d11676aULL, 0xa4c09a4ULL, 0x3b708f4fULL, 0x59be49cbULL, 0x4d11676aULL, 0xf5271210ULL, 0x68bcd1c3ULL, 0x59be49cbULL, 0xb51bfffcULL},
+{0xb8921024ULL, 0x5408696ULL, 0x99cb4ac6ULL, 0xfb63db94ULL, 0xb8921024ULL, 0xf6d10a46ULL, 0xd5bdbee4ULL, 0xfb63db94ULL, 0x81eb985cULL},
+{0x3e64cc29ULL, 0xa9fdd62fULL, 0x5ba7464aULL, 0x876e5d53ULL, 0x3e64cc29ULL, 0xed9099acULL, 0x885bb987ULL, 0x876e5d53ULL, 0x483f155dULL},
+{0x5800d6e0ULL, 0x23cf1491ULL, 0xb780f075ULL, 0x37718798ULL, 0x5800d6e0ULL, 0x58d30c75ULL, 0xba8cb386ULL, 0x37718798ULL, 0x95bb753ULL},
+{0x89a898daULL, 0x6e033b9ULL, 0x12a34a74ULL, 0xf148dc6aULL, 0x89a898daULL, 0x8f0d8b25ULL, 0x3b8562c5ULL, 0xf148dc6aULL, 0xe8458e71ULL},
+{0xd5bd6cf8ULL, 0xab1be902ULL, 0xc01aa08fULL, 0xe8bc2e50ULL, 0xd5bd6cf8ULL, 0x249faa34ULL, 0xb919db6cULL, 0xe8bc2e50ULL, 0x1754aaeaULL},
+{0x544d8341ULL, 0xccb4dbe9ULL, 0x26fd8832ULL, 0xd5ea8aebULL, 0x544d8341ULL, 0xbfaf2f64ULL, 0xe9e89012ULL, 0xd5ea8aebULL, 0xd039deb5ULL},
+{0x19bb50d5ULL, 0x2d37512ULL, 0x875aec15ULL, 0x18e19cc6ULL, 0x19bb50d5ULL, 0x600ad1ccULL, 0x1d5bfdecULL, 0x18e19cc6ULL, 0xc2379333ULL},
+{0xe2cd48e3ULL, 0xd3046175ULL, 0x7e42c252ULL, 0x764eca97ULL, 0xe2cd48e3ULL, 0xb2dda368ULL, 0x62ac8cULL, 0x764eca97ULL, 0x6a07d5cdULL},
+{0x6a3b26d1ULL, 0xf5401e3ULL, 0x8d4b0bd7ULL, 0xc538775cULL, 0x6a3b26d1ULL, 0x95233a1bULL, 0x66f78ce2ULL, 0xc538775cULL, 0x532907c1ULL},
+{0x7288dddaULL, 0xf4c1b57cULL, 0xb4f19725ULL, 0xf2668095ULL, 0x7288dddaULL, 0x1aca91d9ULL, 0x580b73a5ULL, 0xf2668095ULL, 0x2ac5472bULL},
+{0x87f20887ULL, 0xe3013866ULL, 0x7e2e5f63ULL, 0xd13446bcULL, 0x87f20887ULL, 0xa274b2e1ULL, 0xf01d6007ULL, 0xd13446bcULL, 0x4a4fcbbcULL},
+{0x1159fdc3ULL, 0xf2ed35d4ULL, 0x8e94591ULL, 0x4dfd0f7dULL, 0x1159fdc3ULL, 0xed5ce0c6ULL, 0x3bbcfbb7ULL, 0x4dfd0f7dULL, 0xb3de132aULL},
+{0x99010692ULL, 0x4585ec9eULL, 0xd163e9f5ULL, 0xea1a6aeULL, 0x99010692ULL, 0xae55d28aULL, 0xf91dfaadULL, 0xea1a6aeULL, 0xb9175212ULL},
+{0x5981b7ffULL, 0x66dc7585ULL, 0xff781bdcULL, 0xafb0175dULL, 0x5981b7ffULL, 0x2e78dcf2ULL, 0x4abfbcd3ULL, 0xafb0175dULL, 0x2cdd90a6ULL},
+{0x5498e101ULL, 0xdaa2591ULL, 0x82130460ULL, 0x5a7f6e7cULL, 0x5498e101ULL, 0x8cc1968bULL, 0x857f6fdfULL, 0x5a7f6e7cULL, 0x35b7664fULL},
+{0x15b34484ULL, 0xd1cf8b31ULL, 0x31e922adULL, 0x97ac9b52ULL, 0x15b34484ULL, 0x82741917ULL, 0x9c61c5bULL, 0x97ac9b52ULL, 0x281c5e68ULL},
+{0x4c309720ULL, 0x42195309ULL, 0x570a56b5ULL, 0x324038d6ULL, 0x4c309720ULL, 0x165a166bULL, 0x52753dd3ULL, 0x324038d6ULL, 0x7803a7f3ULL},
+{0xb5250a3ULL, 0x9ccdbe93ULL, 0x20d3052fULL, 0x430f4e8bULL, 0xb5250a3ULL, 0x566391e6ULL, 0xf0447964ULL, 0x430f4e8bULL, 0x41e35346ULL},
+{0xadd407f2ULL, 0x29482eb3ULL, 0x8e8922d6ULL, 0x5ab4e94dULL, 0xadd407f2ULL, 0x8cbf0934ULL, 0xe5361e43ULL, 0x5ab4e94dULL, 0x3105e38ULL},
+{0x7724f3c6ULL, 0xc2e1749bULL, 0x98f69d1fULL, 0xdc25d29fULL, 0x7724f3c6ULL, 0x7b668fbcULL, 0x6104c46aULL, 0xdc25d29fULL, 0x9725be2eULL},
+{0xa08c828dULL, 0xf848d7e8ULL, 0xecc5ee9bULL, 0x101e0dbfULL, 0xa08c828dULL, 0x5fdd31c5ULL, 0x4d3e2e19ULL, 0x101e0dbfULL, 0xf7e6f01cULL},
+{0x9eb5ddbdULL, 0x89d9515dULL, 0xfecf1a30ULL, 0x3a5cc4a4ULL, 0x9eb5ddbdULL, 0xafc96ba5ULL, 0x814769d7ULL, 0x3a5cc4a4ULL, 0x64af7a41ULL},
+{0x47f3a3bbULL, 0xd57990bbULL, 0x29645c3fULL, 0x899df310ULL, 0x47f3a3bbULL, 0x9ec35930ULL, 0xa79c3abbULL, 0x899df310ULL, 0x3fa2ca4dULL},
+{0xddb4ffaULL, 0xf9255985ULL, 0x9bbfaf81ULL, 0xeedd7580ULL, 0xddb4ffaULL, 0x7757157fULL, 0xa303666aULL, 0xeedd7580ULL, 0x979691a1ULL},
+{0x85875ab1ULL, 0xfadc398cULL, 0xf80fd3f2ULL, 0xd2774171ULL, 0x85875ab1ULL, 0x405779f7ULL, 0x79f2efeaULL, 0xd2774171ULL, 0x79b49bd5ULL},
+{0xd0778ae4ULL, 0xb9ee327fULL, 0x6ccd0041ULL, 0x5f41c6c7ULL, 0xd0778ae4ULL, 0xa33753a1ULL, 0x8f3e9b49ULL, 0x5f41c6c7ULL, 0x7a16f874ULL},
+{0x5134f79eULL, 0xf4c7ef35ULL, 0x7f67ba5dULL, 0x6a6e1badULL, 0x5134f79eULL, 0x74347acfULL, 0x34a8eb4ULL, 0x6a6e1badULL, 0x4752b194ULL},
+{0x99e44330ULL, 0x25ba3860ULL, 0x54c0d001ULL, 0xae1147a3ULL, 0x99e44330ULL, 0xb3e2200ULL, 0xc46ccd1bULL, 0xae1147a3ULL, 0xc435ab7fULL},
+{0x73b1e7d6ULL, 0x3ceddbccULL, 0x1d61cb22ULL, 0xebc29cf5ULL, 0x73b1e7d6ULL, 0x6a43d700ULL, 0xb1c8a00cULL, 0xebc29cf5ULL, 0x1ee1066aULL},
+{0x9cf75be6ULL, 0x1b55bf5bULL, 0x92a546f5ULL, 0x412484c6ULL, 0x9cf75be6ULL, 0x8b38693ULL, 0x549811b7ULL, 0x412484c6ULL, 0xe5041f1bULL},
+{0xfc686339ULL, 0x87c90b05ULL, 0xdcb8f69aULL, 0x8e2aae3dULL, 0xfc686339ULL, 0x99e19289ULL, 0x4f946e8ULL, 0x8e2aae3dULL, 0x4d9bcca6ULL},
+{0x747317afULL, 0x7b0fd32dULL, 0xb4a6a89bULL, 0xb1cce57ULL, 0x747317afULL, 0x5f04c8e6ULL, 0x3719ef82ULL, 0xb1cce57ULL, 0x88846234ULL},
+{0xf309a675ULL, 0x9d4e9a7eULL, 0xd7202c26ULL, 0x6d3619e2ULL, 0xf309a675ULL, 0xa02c0bc7ULL, 0x279c4f4dULL, 0x6d3619e2ULL, 0xced45463ULL},
+{0xd334b24eULL, 0xb4e975b3ULL, 0x65ada4c1ULL, 0x698c9750ULL, 0xd334b24eULL, 0x330bd162ULL, 0x5d4d3e96ULL, 0x698c9750ULL, 0xbb05b114ULL},
+{0xc504c88ULL, 0x81a4eb15ULL, 0x8a83d302ULL, 0x2d57084ULL, 0xc504c88ULL, 0x2639d990ULL, 0x430502f6ULL, 0x2d57084ULL, 0x9b458fc3ULL},
+{0x45640a03ULL, 0x78c85abbULL, 0xb7fecedeULL, 0xd790cf46ULL, 0x45640a03ULL, 0x4c9c549ULL, 0xaca1bd47ULL, 0xd790cf46ULL, 0xa8fab99bULL},
+{0x3cb8784bULL, 0x7772e336ULL, 0x17ddac19ULL, 0x83ff05cbULL, 0x3cb8784bULL, 0xfd816c41ULL, 0xade7bdc1ULL, 0x83ff05cbULL, 0x2e98559ULL},
+{0x99485430ULL, 0x56cc3877ULL, 0x65743f95ULL, 0xc1406dbcULL, 0x99485430ULL, 0xc1af790bULL, 0x1cfc436aULL, 0xc1406dbcULL, 0x63c770d9ULL},
+{0x3bfde761ULL, 0xd5377d6fULL, 0x28c8988bULL, 0x23b4d196ULL, 0x3bfde761ULL, 0x98aae8b6ULL, 0x1f107d34ULL, 0x23b4d196ULL, 0x796bc8bcULL},
+{0x6c2d572ULL, 0x1dde259cULL, 0x9bee2a2fULL, 0xe22a3d4eULL, 0x6c2d572ULL, 0xcd82de67ULL, 0x3ecedbe4ULL, 0xe22a3d4eULL, 0xaa2cc5afULL},
+{0xbc9dd429ULL, 0x8c21838ULL, 0x12348312ULL, 0xbb332385ULL, 0xbc9dd429ULL, 0xb64386c0ULL, 0x79da40ffULL, 0xbb332385ULL, 0x87164e3aULL},
+{0xf9b713e3ULL, 0xbde77815ULL, 0x9f99d960ULL, 0xa9e7922dULL, 0xf9b713e3ULL, 0x9a994662ULL, 0x2182c609ULL, 0xa9e7922dULL, 0x3cf9708fULL},
+{0xbefe1492ULL, 0x633f745cULL, 0x86930ddaULL, 0x10fdc359ULL, 0xbefe1492ULL, 0xa9443855ULL, 0x8fc59bf8ULL, 0x10fdc359ULL, 0x2ea37a60ULL},
+{0x81ea17ffULL, 0xdc0e8078ULL, 0x159980afULL, 0xf92add86ULL, 0x81ea17ffULL, 0x934cdc75ULL, 0x76a0bb91ULL, 0xf92add86ULL, 0x9d1771d0ULL},
+{0x2b9da970ULL, 0x7855e4a3ULL, 0xd1e92066ULL, 0x18754d37ULL, 0x2b9da970ULL, 0x57d2d800ULL, 0xe7e8dbadULL, 0x18754d37ULL, 0x37d807acULL},
+{0xa0a907edULL, 0x6e9045f7ULL, 0xae14f34eULL, 0xaed5803aULL, 0xa0a907edULL, 0x49bdfbb5ULL, 0xa8f8d2a7ULL, 0xaed5803aULL, 0xcc26cbffULL},
+{0x6bcd9803ULL, 0x44fde293ULL, 0xb727829cULL, 0x811ff2f3ULL, 0x6bcd9803ULL, 0x81107acbULL, 0x4fea4978ULL, 0x811ff2f3ULL, 0x7e74f46cULL},
+{0x833e25a8ULL, 0x4baca229ULL, 0xc4ad9377ULL, 0x1b5023c0ULL, 0x833e25a8ULL, 0xcd514e55ULL, 0xc889e0aaULL, 0x1b5023c0ULL, 0x2202a2e7ULL},
+{0xcb83012bULL, 0xce97f390ULL, 0x108bfd4aULL, 0xb29d958ULL, 0xcb83012bULL, 0xc108c73bULL, 0x4db9ad90ULL, 0xb29d958ULL, 0x91415d5eULL},
+{0xe39373edULL, 0x96153108ULL, 0xbb14c0deULL, 0x35dc389eULL, 0xe39373edULL, 0xcbb24489ULL, 0xbe82cd4eULL, 0x35dc389eULL, 0x2267b2dbULL},
+{0x7e5a8f00ULL, 0x7ad89d6eULL, 0x8926ef6dULL, 0x8cbcb3a5ULL, 0x7e5a8f00ULL, 0x4cd70320ULL, 0x89a9b11bULL, 0x8cbcb3a5ULL, 0x26df265bULL},
+{0x56cd65b6ULL, 0x6737d009ULL, 0xea466c28ULL, 0x891ff8bcULL, 0x56cd65b6ULL, 0x448edbe1ULL, 0xa8fdac82ULL, 0x891ff8bcULL, 0x253c496cULL},
+{0xb5867e8ULL, 0x4fbf5719ULL, 0x8a8de63fULL, 0x4d92bbfcULL, 0xb5867e8ULL, 0x112a5075ULL, 0xe4eafd89ULL, 0x4d92bbfcULL, 0xa09d5f49ULL},
+{0x512bc1a1ULL, 0x646f7a4bULL, 0xfaa2d981ULL, 0x478a6550ULL, 0x512bc1a1ULL, 0x4a98ce57ULL, 0x4777d96dULL, 0x478a6550ULL, 0x2d66e215ULL},
+{0xef4963eeULL, 0xcfeac717ULL, 0xf4ac8350ULL, 0x88f48b52ULL, 0xef4963eeULL, 0x894806e7ULL, 0x7b5416cfULL, 0x88f48b52ULL, 0x2b21b8afULL},
+{0x309c505cULL, 0x5022a79eULL, 0xb4909b20ULL, 0x3ea825c7ULL, 0x309c505cULL, 0xa9aa8249ULL, 0x542ecccdULL, 0x3ea825c7ULL, 0x2128ef2dULL},
+{0xa51445a5ULL, 0x6b1ca703ULL, 0xf38aef3ULL, 0x2ad81a0bULL, 0xa51445a5ULL, 0xb16f9caeULL, 0xf172ca1cULL, 0x2ad81a0bULL, 0x61dbd628ULL},
+{0x3bc9413aULL, 0x1b402768ULL, 0x45fafbc1ULL, 0x7dc3dca7ULL, 0x3bc9413aULL, 0x649afc9dULL, 0x7c537e94ULL, 0x7dc3dca7ULL, 0x87891145ULL},
+{0xbebfbfc9ULL, 0x58b7e68bULL, 0xb5756d61ULL, 0xc2288eb0ULL, 0xbebfbfc9ULL, 0xe1e417acULL, 0x1bbc9e80ULL, 0xc2288eb0ULL, 0x3ec7956ULL},
+{0x172d2221ULL, 0xebb8f0ceULL, 0x20df7c56ULL, 0x9072ef87ULL, 0x172d2221ULL, 0x851abeULL, 0x4d1e2d9aULL, 0x9072ef87ULL, 0xaed9d4d4ULL},
+{0x91d1247aULL, 0x81abe407ULL, 0x964b7768ULL, 0xf4faf265ULL, 0x91d1247aULL, 0x5ebd6498ULL, 0x47272441ULL, 0xf4faf265ULL, 0xe3af883cULL},
+{0x840a12abULL, 0x13aa48aeULL, 0xbeb1d060ULL, 0xd3a609c5ULL, 0x840a12abULL, 0xbad18e5aULL, 0x8d12e843ULL, 0xd3a609c5ULL, 0xbc46956bULL},
+{0x18cbd3d8ULL, 0x6b0a0bb3ULL, 0x3eea6061ULL, 0xb8a4a8cULL, 0x18cbd3d8ULL, 0x9ee3a08ULL, 0xc97a74a8ULL, 0xb8a4a8cULL, 0xf62601f2ULL},
+{0x5ab27566ULL, 0x6504f262ULL, 0x6da70211ULL, 0xcf2226cULL, 0x5ab27566ULL, 0x6de1984bULL, 0xc97023e8ULL, 0xcf2226cULL, 0xeba4b9fULL},
+{0x2d384d0dULL, 0x7cf6584dULL, 0x450fb4b7ULL, 0x449a6ULL, 0x2d384d0dULL, 0x9c7e532cULL, 0xf8893a42ULL, 0x449a6ULL, 0x762e14d1ULL},
+{0x1fa69965ULL, 0x4dae4751ULL, 0x145903eULL, 0x488bb03dULL, 0x1fa69965ULL, 0x566d23caULL, 0xcc2345a8ULL, 0x488bb03dULL, 0x61b4c239ULL},
+{0x2605110dULL, 0x4221c7ceULL, 0x2fb874c4ULL, 0x7028c4fdULL, 0x2605110dULL, 0xd4625aeULL, 0x5fc00bbeULL, 0x7028c4fdULL, 0xd389f2e6ULL},
+{0x5bd22b62ULL, 0x8950d6faULL, 0x4b9d1a8eULL, 0x81ad9f9eULL, 0x5bd22b62ULL, 0xfdec1d3dULL, 0x5ffd9fe2ULL, 0x81ad9f9eULL, 0x1460cb07ULL},
+{0x1527a411ULL, 0x24f9520eULL, 0x811fbbc5ULL, 0x4ca46aabULL, 0x1527a411ULL, 0x5ab40b6ULL, 0x5b3d157ULL, 0x4ca46aabULL, 0xc65dd728ULL},
+{0xf3d45130ULL, 0x2efe64aULL, 0xa568abefULL, 0xcb3089a7ULL, 0xf3d45130ULL, 0xeddd6060ULL, 0xdcfa5545ULL, 0xcb3089a7ULL, 0x190a7d6bULL},
+{0x204a5a87ULL, 0x41b708e5ULL, 0xccbad73cULL, 0x8f11d576ULL, 0x204a5a87ULL, 0x845a7adcULL, 0x5a8569eULL, 0x8f11d576ULL, 0xf18e208eULL},
+{0x83b84cf3ULL, 0xfe36cadbULL, 0xd03f5303ULL, 0x2bd7f7dbULL, 0x83b84cf3ULL, 0xd5298cd0ULL, 0x172c8e70ULL, 0x2bd7f7dbULL, 0x825fd0eULL},
+{0xff862987ULL, 0x5bb14938ULL, 0xfc5aac84ULL, 0xf407ba4eULL, 0xff862987ULL, 0x2d9d3fa1ULL, 0x3b1ae3b5ULL, 0xf407ba4eULL, 0xc262d5eaULL},
+{0xd1546d9cULL, 0xf7ee0b49ULL, 0x442dba41ULL, 0x7b6e752ULL, 0xd1546d9cULL, 0xcb1ba4b9ULL, 0xd88982e4ULL, 0x7b6e752ULL, 0x6c3e9fd9ULL},
+{0x4690c05aULL, 0x781dc586ULL, 0x340671e7ULL, 0xd74fafe3ULL, 0x4690c05aULL, 0x1d12b522ULL, 0xe54f5ec3ULL, 0xd74fafe3ULL, 0xc026f2ddULL},
+{0xb0c1ab59ULL, 0x4c46086aULL, 0xbd94509ULL, 0x4a7d26faULL, 0xb0c1ab59ULL, 0x6eede33aULL, 0xcf4f513eULL, 0x4a7d26faULL, 0x5acfaf06ULL},
+{0xc1731bbcULL, 0x90dc4269ULL, 0x34f6b7bcULL, 0xdcd8469dULL, 0xc1731bbcULL, 0x96e652f7ULL, 0x51e12234ULL, 0xdcd8469dULL, 0x576a482cULL},
+{0xa26c9cdfULL, 0x18aba1b6ULL, 0x2691c44fULL, 0x990a3e68ULL, 0xa26c9cdfULL, 0x741bcfc9ULL, 0xe96a3eb1ULL, 0x990a3e68ULL, 0xffc8504aULL},
+{0x16d8e404ULL, 0x99de5230ULL, 0x97618573ULL, 0xd1611193ULL, 0x16d8e404ULL, 0x4b2ec10ULL, 0x852ad352ULL, 0xd1611193ULL, 0x87bae9e8ULL},
+{0x47172b2aULL, 0xec852a05ULL, 0x11c89273ULL, 0x25e1f662ULL, 0x47172b2aULL, 0x9a579a15ULL, 0x97e96093ULL, 0x25e1f662ULL, 0xd27f7f30ULL},
+{0xc877e1c5ULL, 0x234bf2d0ULL, 0x7f9e6c33ULL, 0x8d13e397ULL, 0xc877e1c5ULL, 0xf82eaa65ULL, 0xe4cc8a51ULL, 0x8d13e397ULL, 0x524a1a3cULL},
+{0x6129a6f8ULL, 0x6786935aULL, 0x5619125aULL, 0xf7ba4b2eULL, 0x6129a6f8ULL, 0xd9963e75ULL, 0x567f7412ULL, 0xf7ba4b2eULL, 0xf27d7915ULL},
+{0xf9eb203dULL, 0x857c2475ULL, 0x7b44c35dULL, 0x399732fcULL, 0xf9eb203dULL, 0x8b4c7409ULL, 0x20cfdf85ULL, 0x399732fcULL, 0xd5f60fe7ULL},
+{0xd9ceee79ULL, 0x65614a6aULL, 0x5ef4c7efULL, 0xe98c0bc3ULL, 0xd9ceee79ULL, 0xa1c11206ULL, 0x9ed0a9b7ULL, 0xe98c0bc3ULL, 0x76ffda5cULL},
+{0x1141ad22ULL, 0x9dbff58aULL, 0xd80f166eULL, 0xd74bd1e1ULL, 0x1141ad22ULL, 0x13a65047ULL, 0xd582d536ULL, 0xd74bd1e1ULL, 0xee1db33bULL},
+{0x71cf2ed5ULL, 0xd46c61d3ULL, 0x2562e5bfULL, 0xb2f229eeULL, 0x71cf2ed5ULL, 0xdb789308ULL, 0xde93868ULL, 0xb2f229eeULL, 0x23c78882ULL},
+{0xbe9914aaULL, 0xad47b10ULL, 0x4fad9228ULL, 0x8cef4cacULL, 0xbe9914aaULL, 0xd79d7c8ULL, 0x3a84acefULL, 0x8cef4cacULL, 0x9cbbe980ULL},
+{0x9447d3a8ULL, 0x17614cccULL, 0xb4589d01ULL, 0x414d1429ULL, 0x9447d3a8ULL, 0xa84c4864ULL, 0xd516268aULL, 0x414d1429ULL, 0xee5d5cf9ULL},
+{0x4e33d43ULL, 0x7077dea7ULL, 0xdac2349aULL, 0xd14d55cULL, 0x4e33d43ULL, 0xed0ddb1bULL, 0xdfb9949aULL, 0xd14d55cULL, 0x7723f2eaULL},
+{0x852f7450ULL, 0x383017f8ULL, 0xef8d5ef2ULL, 0x49a27249ULL, 0x852f7450ULL, 0x3fe02a14ULL, 0xb9ca895cULL, 0x49a27249ULL, 0xebc451fbULL},
+{0xd6a35165ULL, 0x4cb96261ULL, 0xb7f1a53fULL, 0x1e9bb2edULL, 0xd6a35165ULL, 0xe0b51094ULL, 0x854c5b3dULL, 0x1e9bb2edULL, 0x811d15aaULL},
+{0x29ce5b6cULL, 0xb27eacf4ULL, 0xbdd9bcfeULL, 0xc1a2c862ULL, 0x29ce5b6cULL, 0xc69bde71ULL, 0xa4beeb84ULL, 0xc1a2c862ULL, 0x1ac46a6cULL},
+{0xbe18b4adULL, 0xcc80b59dULL, 0x51730c05ULL, 0xb75bcba7ULL, 0xbe18b4adULL, 0xa32186f0ULL, 0x77d06bfeULL, 0xb75bcba7ULL, 0xe6e4f891ULL},
+{0xb9fb41faULL, 0xf8188b5cULL, 0x2d188d05ULL, 0x6c30bb54ULL, 0xb9fb41faULL, 0x69a1aa53ULL, 0x5a9578a5ULL, 0x6c30bb54ULL, 0xc43ee040ULL},
+{0x5d957e55ULL, 0x1b2d77a7ULL, 0xdc4b8f82ULL, 0x906f5ea5ULL, 0x5d957e55ULL, 0x66cc2d16ULL, 0xf94db8a2ULL, 0x906f5ea5ULL, 0xa9f6293aULL},
+{0xf271697bULL, 0x105c3ca4ULL, 0x1621ef26ULL, 0xb1aa53d2ULL, 0xf271697bULL, 0x284bcbb7ULL, 0x29fcba14ULL, 0xb1aa53d2ULL, 0xf972d031ULL},
+{0xc7b80a21ULL, 0x962d7bd4ULL, 0x156fbcfbULL, 0x6b98697cULL, 0xc7b80a21ULL, 0x110d9811ULL, 0x8a2ac2daULL, 0x6b98697cULL, 0x24a29b14ULL},
+{0x9122a4c4ULL, 0xb890b6f0ULL, 0x59bbdc56ULL, 0xc82797f0ULL, 0x9122a4c4ULL, 0xba6c3ff9ULL, 0x3b54c523ULL, 0xc82797f0ULL, 0x31d5415dULL},
+{0x341a05d6ULL, 0xd154d7b0ULL, 0xffd1b1f6ULL, 0x1c26b716ULL, 0x341a05d6ULL, 0xd5f5a40aULL, 0xcf8013bdULL, 0x1c26b716ULL, 0xce91df9bULL},
+{0x6028db0cULL, 0x1a5e5b7ULL, 0xb6cc7c77ULL, 0x25c7df14ULL, 0x6028db0cULL, 0x6dad1af2ULL, 0x89493cafULL, 0x25c7df14ULL, 0x7f49a0a6ULL},
+{0x241a9873ULL, 0x9ad94e85ULL, 0xef87579bULL, 0x5e7ce75aULL, 0x241a9873ULL, 0x1979560dULL, 0x202430c2ULL, 0x5e7ce75aULL, 0xdf7f7ce8ULL},
+{0x49959c7aULL, 0x61ae054ULL, 0x364dc509ULL, 0x65cd1286ULL, 0x49959c7aULL, 0xe0a06ddbULL, 0x1641da62ULL, 0x65cd1286ULL, 0xd21c4aa0ULL},
+{0x2adc9738ULL, 0xcff3f50bULL, 0xbe6b623eULL, 0xc759b524ULL, 0x2adc9738ULL, 0x72c7dab1ULL, 0xa886fec7ULL, 0xc759b524ULL, 0x9d9b7c4eULL},
+{0x474a4f09ULL, 0x5cc5c827ULL, 0x4fc6d3f9ULL, 0x552e23efULL, 0x474a4f09ULL, 0xb62c8452ULL, 0xb02d329aULL, 0x552e23efULL, 0xd34e60b0ULL},
+{0x4b1b094bULL, 0xafd08daeULL, 0x28e72e6aULL, 0x7c9a4c93ULL, 0x4b1b094bULL, 0xafb3bcc7ULL, 0xfa1d6496ULL, 0x7c9a4c93ULL, 0x805d151cULL},
+{0xba09f35eULL, 0x6816ffcULL, 0xcecfaf29ULL, 0xdcdab535ULL, 0xba09f35eULL, 0x15088189ULL, 0x61aa59d1ULL, 0xdcdab535ULL, 0x1bd06c68ULL},
+{0x7a2e0d52ULL, 0xaeaa3bfbULL, 0x8a40a060ULL, 0x5c7f880fULL, 0x7a2e0d52ULL, 0x54ed142dULL, 0xe91b7a11ULL, 0x5c7f880fULL, 0xc0534636ULL},
+{0xf8c0da4cULL, 0xaaeea21cULL, 0x20d16afaULL, 0xc5fb2d31ULL, 0xf8c0da4cULL, 0x7e09a4c2ULL, 0xf465bbb9ULL, 0xc5fb2d31ULL, 0x5de33c8ULL},
+{0x2d5ebda5ULL, 0xc40f4195ULL, 0x4674ed3aULL, 0x36ca10e4ULL, 0x2d5ebda5ULL, 0xc9e3e494ULL, 0xaf51a52dULL, 0x36ca10e4ULL, 0xf3d273abULL},
+{0x1851b9e6ULL, 0x3802534aULL, 0xa85debc4ULL, 0xf4291035ULL, 0x1851b9e6ULL, 0x924eb361ULL, 0xe23ac964ULL, 0xf4291035ULL, 0x3f83e91ULL},
+{0x6b1a94b3ULL, 0xe6d6cc38ULL, 0x7bb65e58ULL, 0x529d6ce5ULL, 0x6b1a94b3ULL, 0x88d6807fULL, 0xb4059c75ULL, 0x529d6ce5ULL, 0xb066a975ULL},
+{0x3c92dd69ULL, 0xa3dfd44bULL, 0x4fe824d8ULL, 0x93714f8fULL, 0x3c92dd69ULL, 0x35326d7bULL, 0x1c42595aULL, 0x93714f8fULL, 0xf8882b5bULL},
+{0xc1fa2ecfULL, 0x1a0977a0ULL, 0xa4b14fULL, 0xad94ba44ULL, 0xc1fa2ecfULL, 0xbe18caULL, 0x622247f6ULL, 0xad94ba44ULL, 0x2ea9ed4eULL},
+{0xfc87dbfdULL, 0x87ae225dULL, 0x61417e01ULL, 0xd16f2dc1ULL, 0xfc87dbfdULL, 0x571edd45ULL, 0xee390ca0ULL, 0xd16f2dc1ULL, 0x1005b7ddULL},
+{0x5a0a1ac9ULL, 0xb753a3dfULL, 0xfeed692eULL, 0x5d98507cULL, 0x5a0a1ac9ULL, 0xdf127df3ULL, 0x669a12b4ULL, 0x5d98507cULL, 0x2ffcd640ULL},
+{0xe6ede632ULL, 0xe24ffc7cULL, 0x8953dd7ULL, 0xae7cb3a0ULL, 0xe6ede632ULL, 0x5aef9a22ULL, 0xca09c820ULL, 0xae7cb3a0ULL, 0x765dedf1ULL},
+{0xb4064af4ULL, 0x5e5a0ef4ULL, 0xa5990ULL, 0x8c00f333ULL, 0xb4064af4ULL, 0xb159ea13ULL, 0xb8775d49ULL, 0x8c00f333ULL, 0xc1fdc0b8ULL},
+{0x59a8103eULL, 0x795873f0ULL, 0xf3dc0ccdULL, 0x40f47491ULL, 0x59a8103eULL, 0xe9916b41ULL, 0xfa67dc54ULL, 0x40f47491ULL, 0xff92f9b8ULL},
+{0x63885d1ULL, 0xe9148015ULL, 0x3f26bca0ULL, 0xb0d4e5beULL, 0x63885d1ULL, 0x7a57e96cULL, 0xa5fed906ULL, 0xb0d4e5beULL, 0x368a032aULL},
+{0x8acc337dULL, 0x82aa2ffeULL, 0x90ca3eacULL, 0xe9013051ULL, 0x8acc337dULL, 0x108aecaaULL, 0x50be7f66ULL, 0xe9013051ULL, 0xea66063bULL},
+{0x178db934ULL, 0xe553bcffULL, 0x884e7995ULL, 0x85e6a248ULL, 0x178db934ULL, 0xb988e8bULL, 0xac232d6dULL, 0x85e6a248ULL, 0x3d4e5a8fULL},
+{0x16941618ULL, 0x2d1f157ULL, 0x450f815bULL, 0x3220c126ULL, 0x16941618ULL, 0x84de5b1cULL, 0x3f3c200ULL, 0x3220c126ULL, 0x9b9def5dULL},
+{0x1cf7d9caULL, 0x86c40445ULL, 0x220d1f8cULL, 0x39b13bb5ULL, 0x1cf7d9caULL, 0x52209c9ULL, 0xad926339ULL, 0x39b13bb5ULL, 0x1f9fe605ULL},
+{0x7ea8261dULL, 0x97e04280ULL, 0xc3c1c7afULL, 0x75af9377ULL, 0x7ea8261dULL, 0xc3051c3aULL, 0x3b21160aULL, 0x75af9377ULL, 0xba510c40ULL},
+{0xeda20405ULL, 0x5aeeeb49ULL, 0x21d25cfaULL, 0x1c96a600ULL, 0xeda20405ULL, 0xc9214753ULL, 0xc712ce48ULL, 0x1c96a600ULL, 0xe8f9cdf9ULL},
+{0xac01b58aULL, 0x721418fdULL, 0x6f78ce24ULL, 0x89568b3fULL, 0xac01b58aULL, 0x80ba2e58ULL, 0x21705f40ULL, 0x89568b3fULL, 0xf996126cULL},
+{0xf564c0a6ULL, 0x9827124cULL, 0xf0cf6eeaULL, 0xca8509a1ULL, 0xf564c0a6ULL, 0x78e6b06dULL, 0x700ddf7bULL, 0xca8509a1ULL, 0x9f91d1efULL},
+{0x1229181eULL, 0xb9bd02c2ULL, 0xf20de3d6ULL, 0xb3ace6d1ULL, 0x1229181eULL, 0x6c50e047ULL, 0x46952b4dULL, 0xb3ace6d1ULL, 0xae9651a0ULL},
+{0x7d3bd8ccULL, 0xc9f4f5b9ULL, 0xd490efcdULL, 0xca68901aULL, 0x7d3bd8ccULL, 0xa707629fULL, 0x9f564912ULL, 0xca68901aULL, 0x2b02185eULL},
+{0x6cc0c38dULL, 0xa17e092dULL, 0xd2e8e10bULL, 0x6128930dULL, 0x6cc0c38dULL, 0x81ba58edULL, 0xc2999d79ULL, 0x6128930dULL, 0xff56a26ULL},
+{0xc28883b0ULL, 0x2dcac52bULL, 0xd5c4b717ULL, 0x5c6e084ULL, 0xc28883b0ULL, 0xe4dc978aULL, 0x4bd2f5f5ULL, 0x5c6e084ULL, 0xa1984fd7ULL},
+{0x31437377ULL, 0x126448b4ULL, 0x9382923eULL, 0x3093425dULL, 0x31437377ULL, 0x95d4a4d1ULL, 0xf868b889ULL, 0x3093425dULL, 0x7178dc73ULL},
+{0xff80ba53ULL, 0xd4784903ULL, 0xbf38d3c9ULL, 0x34f11f3dULL, 0xff80ba53ULL, 0x71733b4bULL, 0x5154a3f9ULL, 0x34f11f3dULL, 0x2c8e1f38ULL},
+{0x354874b8ULL, 0x1af08aa1ULL, 0x5b5f8363ULL, 0x51dd474fULL, 0x354874b8ULL, 0xa2bb10f0ULL, 0x4c959299ULL, 0x51dd474fULL, 0x7a90e13fULL},
+{0x4c4be957ULL, 0x2f9787e9ULL, 0xb3c14fa2ULL, 0x8911a6f8ULL, 0x4c4be957ULL, 0xa7512bb3ULL, 0x7ff66febULL, 0x8911a6f8ULL, 0x1902ab3ULL},
+{0xf20672ebULL, 0xf2de9e5bULL, 0x6132c670ULL, 0x9af605f2ULL, 0xf20672ebULL, 0x4686b4b9ULL, 0x627088fdULL, 0x9af605f2ULL, 0x1adfa1beULL},
+{0x75f564aaULL, 0x2c74ffb0ULL, 0xb1866729ULL, 0x4d3a0ea1ULL, 0x75f564aaULL, 0x6541759aULL, 0xeffc92a9ULL, 0x4d3a0ea1ULL, 0xfcfb6eedULL},
+{0x152b00afULL, 0x391b92beULL, 0x5dea8807ULL, 0x29455510ULL, 0x152b00afULL, 0xf239f01aULL, 0x7feb42e0ULL, 0x29455510ULL, 0x6649928eULL},
+{0xadf84a7dULL, 0xc77c895dULL, 0x7fa2ac80ULL, 0xa4bf4321ULL, 0xadf84a7dULL, 0xd6065d2dULL, 0x1159b275ULL, 0xa4bf4321ULL, 0xeadb1a19ULL},
+{0x7505fcc6ULL, 0xb0dfc0acULL, 0xd6c92373ULL, 0x9fba2df5ULL, 0x7505fcc6ULL, 0x31c2515ULL, 0xb6a184e8ULL, 0x9fba2df5ULL, 0x7dab324ULL},
+{0x158b090fULL, 0x3c3b5225ULL, 0x39bee8efULL, 0x8c62bc0cULL, 0x158b090fULL, 0xf0a8bc22ULL, 0x1d5fdc9bULL, 0x8c62bc0cULL, 0x69247e38ULL},
+{0x8b3f380ULL, 0x83ad5e79ULL, 0xf96a24b0ULL, 0x1b4d4579ULL, 0x8b3f380ULL, 0xe394dc1bULL, 0x5e59d926ULL, 0x1b4d4579ULL, 0x694dcc18ULL},
+{0x52764948ULL, 0x215339e9ULL, 0x259f6505ULL, 0x7bb0768bULL, 0x52764948ULL, 0x34bdce49ULL, 0x190ec9e7ULL, 0x7bb0768bULL, 0x29517330ULL},
+{0xccfa6b40ULL, 0x6dfdbef2ULL, 0x998675c9ULL, 0x8264231dULL, 0xccfa6b40ULL, 0x3927e789ULL, 0x9f4a0048ULL, 0x8264231dULL, 0xcbd9fe5aULL},
+{0x4da76c91ULL, 0x7a63991cULL, 0x5af1c868ULL, 0x2e826e91ULL, 0x4da76c91ULL, 0x985a6358ULL, 0x1b99673eULL, 0x2e826e91ULL, 0x49bfa6bcULL},
+{0xe5cd1fecULL, 0x4d7e9725ULL, 0x8e9e967aULL, 0xb8833eb4ULL, 0xe5cd1fecULL, 0x64db4ab7ULL, 0xa1dd649dULL, 0xb8833eb4ULL, 0xe607ab2dULL},
+{0x609e183bULL, 0x2fbb2b53ULL, 0x90f1291eULL, 0xa0389c6ULL, 0x609e183bULL, 0xae52d94ULL, 0x22a70cf0ULL, 0xa0389c6ULL, 0x6390293eULL},
+{0x43accab6ULL, 0x6fdb6eb9ULL, 0x866d4a91ULL, 0xd31bec07ULL, 0x43accab6ULL, 0xb0da88e6ULL, 0xb1052c2aULL, 0xd31bec07ULL, 0xd0e4b5a4ULL},
+{0x69761ab1ULL, 0xfa21c2dULL, 0x2f68426dULL, 0xa44a3219ULL, 0x69761ab1ULL, 0x35df944bULL, 0xe145818cULL, 0xa44a3219ULL, 0x2615d062ULL},
+{0x197c4532ULL, 0x6c092b5cULL, 0x684a05a7ULL, 0x2f595940ULL, 0x197c4532ULL, 0xdf29bf87ULL, 0x79d48f2ULL, 0x2f595940ULL, 0x2a47b3c0ULL},
+{0xf946ff41ULL, 0xd2e429eeULL, 0xcc7a682dULL, 0x1ac86bbdULL, 0xf946ff41ULL, 0x57b8f383ULL, 0x69b9e0acULL, 0x1ac86bbdULL, 0x911e0e61ULL},
+{0x363d9db1ULL, 0xb8275a51ULL, 0x7df42cdbULL, 0xefb80f29ULL, 0x363d9db1ULL, 0xef0f2b83ULL, 0x9ba91e67ULL, 0xefb80f29ULL, 0x3a6f90b1ULL},
+{0x15489750ULL, 0x819386beULL, 0xabe4d8ecULL, 0x79fc401eULL, 0x15489750ULL, 0x1af657b3ULL, 0xe4e6d18fULL, 0x79fc401eULL, 0x352cba19ULL},
+{0x51170dbdULL, 0xd2ae9b0bULL, 0x1dafaa0fULL, 0x5be7c290ULL, 0x51170dbdULL, 0xeb61c78aULL, 0x829b6fe4ULL, 0x5be7c290ULL, 0x6bd00ddaULL},
+{0x51d9f4acULL, 0x13aec7aeULL, 0x11bef6ffULL, 0x11ffd4b3ULL, 0x51d9f4acULL, 0x69078e88ULL, 0x532b1d97ULL, 0x11ffd4b3ULL, 0xab13f3a1ULL},
+{0xa414a738ULL, 0xdddbc8e5ULL, 0x8db42649ULL, 0xad846a84ULL, 0xa414a738ULL, 0x8d15bca0ULL, 0xaa27b85eULL, 0xad846a84ULL, 0xfb65b8abULL},
+{0x81516e28ULL, 0xe2dd3603ULL, 0x653996a2ULL, 0x8c51503aULL, 0x81516e28ULL, 0xbda8570ULL, 0x1db5be0dULL, 0x8c51503aULL, 0xb774ff0eULL},
+{0x6a470b91ULL, 0x720e2e8bULL, 0xb9b8817eULL, 0x5598f47dULL, 0x6a470b91ULL, 0xff1297c8ULL, 0xc0fd9fd8ULL, 0x5598f47dULL, 0xea0740d4ULL},
+{0xf4d66d48ULL, 0x9362fa17ULL, 0xe28348ffULL, 0xcf654b4fULL, 0xf4d66d48ULL, 0x77ead79dULL, 0x793a01aaULL, 0xcf654b4fULL, 0xfad7c7aULL},
+{0xc1c16c75ULL, 0x8afb195dULL, 0x9d7afeb3ULL, 0xb88cb383ULL, 0xc1c16c75ULL, 0x3b1ad84ULL, 0x6f6f4c42ULL, 0xb88cb383ULL, 0x2f497c9bULL},
+{0xb28fe053ULL, 0x9c720421ULL, 0xc293ce08ULL, 0xdc3f30b9ULL, 0xb28fe053ULL, 0xa619933cULL, 0x18e5e72fULL, 0xdc3f30b9ULL, 0xd2d18f4aULL},
+{0x41de1efeULL, 0x907095b5ULL, 0xb379e64bULL, 0x26cbec1ULL, 0x41de1efeULL, 0x1d6e4b25ULL, 0x7fde5c05ULL, 0x26cbec1ULL, 0x11bd795fULL},
+{0x8419cec4ULL, 0x304be0a3ULL, 0x87e7d357ULL, 0x4b97417dULL, 0x8419cec4ULL, 0xeea969fbULL, 0xb22c065fULL, 0x4b97417dULL, 0x51b14825ULL},
+{0x7898f03bULL, 0x5ee54c3bULL, 0x62f25137ULL, 0xdf002e57ULL, 0x7898f03bULL, 0xc0bb5f57ULL, 0x241f70c3ULL, 0xdf002e57ULL, 0x114d1913ULL},
+{0xd8f0c814ULL, 0xdd851f2eULL, 0x967b94feULL, 0xaf6d14c1ULL, 0xd8f0c814ULL, 0x188e13fbULL, 0x3a7a4264ULL, 0xaf6d14c1ULL, 0x9283af98ULL},
+{0xea8d235bULL, 0xae0f7494ULL, 0x61ecda29ULL, 0xe9eca7eULL, 0xea8d235bULL, 0x11a1fed0ULL, 0xed63d457ULL, 0xe9eca7eULL, 0x5f68169ULL},
+{0x2230582dULL, 0xb5a2ef64ULL, 0x41605b5dULL, 0xdc9eaba8ULL, 0x2230582dULL, 0x2736a4d9ULL, 0x6adc73eeULL, 0xdc9eaba8ULL, 0xe092c2c3ULL},
+{0x66745d6dULL, 0x4660c43fULL, 0x3e491839ULL, 0x92a2f35ULL, 0x66745d6dULL, 0x741b1215ULL, 0x68cc6b65ULL, 0x92a2f35ULL, 0xcc8ecc0aULL},
+{0x14f6aec1ULL, 0xbd48d799ULL, 0x36c238d6ULL, 0xf48a10f9ULL, 0x14f6aec1ULL, 0x1f8d6f03ULL, 0x76865ac4ULL, 0xf48a10f9ULL, 0x96104e0eULL},
+{0xa8706a9bULL, 0xe673f9bcULL, 0xd711328cULL, 0x9bc5e331ULL, 0xa8706a9bULL, 0x59e6a715ULL, 0xd88aa1d2ULL, 0x9bc5e331ULL, 0x2c5cc9a5ULL},
+{0x21b67748ULL, 0xbcf94bc6ULL, 0xb85633a3ULL, 0x1f866cc6ULL, 0x21b67748ULL, 0xded848bbULL, 0xbd525d11ULL, 0x1f866cc6ULL, 0x597aa436ULL},
+{0x3105ed4ULL, 0x8a553d8fULL, 0x81c81cfaULL, 0xdddf1ba0ULL, 0x3105ed4ULL, 0xd631dfULL, 0x682cc3fdULL, 0xdddf1ba0ULL, 0x71911704ULL},
+{0x2d7cdde6ULL, 0xe299ddd9ULL, 0x77fa41c7ULL, 0x1892d89eULL, 0x2d7cdde6ULL, 0x1712a3cfULL, 0xa961261bULL, 0x1892d89eULL, 0x22c1fbafULL},
+{0xa0f98c23ULL, 0xd78f84ddULL, 0x7df7dfb6ULL, 0x95867b59ULL, 0xa0f98c23ULL, 0xd5601fb9ULL, 0xc097707dULL, 0x95867b59ULL, 0x81e3daedULL},
+{0x75c9d346ULL, 0x2d5330b7ULL, 0xf1923fafULL, 0x7d62de7eULL, 0x75c9d346ULL, 0x77ec5364ULL, 0x72b33884ULL, 0x7d62de7eULL, 0x821fe453ULL},
+{0x8b502d72ULL, 0x1542fe59ULL, 0xc87a201ULL, 0xb9016ee7ULL, 0x8b502d72ULL, 0xf9933a70ULL, 0xdedddaedULL, 0xb9016ee7ULL, 0xaf21804bULL},
+{0x4f9ff39fULL, 0x3dd9076aULL, 0x38de1044ULL, 0xe7750c01ULL, 0x4f9ff39fULL, 0xc2f9fb39ULL, 0xfa2b636fULL, 0xe7750c01ULL, 0xf2a0ee84ULL},
+{0x872b7ae5ULL, 0xdecff7dULL, 0x7a91879dULL, 0xa5ce7df0ULL, 0x872b7ae5ULL, 0x1c8a4e22ULL, 0x90b227bcULL, 0xa5ce7df0ULL, 0xdc296776ULL},
+{0x5040b592ULL, 0x5e0b07cfULL, 0x3ec92c2ULL, 0xb76c5bacULL, 0x5040b592ULL, 0xf2e0997aULL, 0xffa3116aULL, 0xb76c5bacULL, 0x623279a7ULL},
+{0x4754e8b7ULL, 0x7ecba387ULL, 0x3868b5f8ULL, 0x2d3b4050ULL, 0x4754e8b7ULL, 0x3c82f616ULL, 0x9df33329ULL, 0x2d3b4050ULL, 0x565916b1ULL},
+{0xd5c7c606ULL, 0x6bb5b176ULL, 0x62432fd5ULL, 0x7c37843cULL, 0xd5c7c606ULL, 0xde9aa210ULL, 0x165ab762ULL, 0x7c37843cULL, 0xb706e8f0ULL},
+{0xa79f5cb5ULL, 0x7e68f12eULL, 0x2f7848b5ULL, 0x82a86ca6ULL, 0xa79f5cb5ULL, 0xa724f3f1ULL, 0x414cb2b6ULL, 0x82a86ca6ULL, 0x60337f25ULL},
+{0xab85a330ULL, 0x641e0230ULL, 0x2de76d31ULL, 0xe63c4c15ULL, 0xab85a330ULL, 0x5772763cULL, 0x9a27a541ULL, 0xe63c4c15ULL, 0xc51bfb54ULL},
+{0xd63e060dULL, 0x27426dcfULL, 0x81044cccULL, 0x8900156ULL, 0xd63e060dULL, 0x2baa62caULL, 0x43c54d55ULL, 0x8900156ULL, 0x5f7ed05cULL},
+{0x6e8f1dd6ULL, 0xe5776562ULL, 0xa0013aacULL, 0x9c387ed7ULL, 0x6e8f1dd6ULL, 0xbff0404ULL, 0xe2655a5dULL, 0x9c387ed7ULL, 0x7394bdaaULL},
+{0xc1a53af7ULL, 0x49f0db79ULL, 0x3eaa29d4ULL, 0xf977aefbULL, 0xc1a53af7ULL, 0xf1f41964ULL, 0x14d6bac7ULL, 0xf977aefbULL, 0xd17ff034ULL},
+{0xfbfed5afULL, 0x25771df5ULL, 0x99b75283ULL, 0x9f63eb15ULL, 0xfbfed5afULL, 0x516c5091ULL, 0x83095dccULL, 0x9f63eb15ULL, 0x9f82dc44ULL},
+{0x658f54a8ULL, 0xe7610502ULL, 0x167c2faaULL, 0x32267a43ULL, 0x658f54a8ULL, 0x984bc8f8ULL, 0x82a06753ULL, 0x32267a43ULL, 0xd0e1f285ULL},
+{0x6aab7eebULL, 0xba12384aULL, 0xa74028f1ULL, 0x41cc8759ULL, 0x6aab7eebULL, 0x7c36e4c1ULL, 0x65767ec0ULL, 0x41cc8759ULL, 0xc62cff40ULL},
+{0xdb121c34ULL, 0xe66e9760ULL, 0x457c83efULL, 0x6601c4daULL, 0xdb121c34ULL, 0x5bafec0ULL, 0xcaea95c3ULL, 0x6601c4daULL, 0x492c7ba3ULL},
+{0x84a3110eULL, 0xd5ba921bULL, 0xecd8d2eULL, 0xaf81a9dcULL, 0x84a3110eULL, 0x9dae7784ULL, 0x415bf812ULL, 0xaf81a9dcULL, 0x60c6bc87ULL},
+{0x50f76392ULL, 0x66873d1aULL, 0x2c4bdb43ULL, 0x53ac94abULL, 0x50f76392ULL, 0xe5ed43a4ULL, 0xb9fe0960ULL, 0x53ac94abULL, 0x684f3bf0ULL},
+{0xd6a165b4ULL, 0xda563f05ULL, 0x10bd3165ULL, 0x4c078b0ULL, 0xd6a165b4ULL, 0xed09b800ULL, 0x6579cc5cULL, 0x4c078b0ULL, 0xfa46c6e2ULL},
+{0x65b628efULL, 0xb04b526fULL, 0x95fa236eULL, 0xd27822b0ULL, 0x65b628efULL, 0xccaa095dULL, 0xfed9eb94ULL, 0xd27822b0ULL, 0x5f016bffULL},
+{0xe0871677ULL, 0x11b548fcULL, 0xc347265cULL, 0x1a5bd377ULL, 0xe0871677ULL, 0xf8a2eab6ULL, 0xa8439529ULL, 0x1a5bd377ULL, 0x539acef2ULL},
+{0xbb5215efULL, 0xc06efed9ULL, 0xc0dbc36fULL, 0xba42c34dULL, 0xbb5215efULL, 0x1ed1d2aaULL, 0x1615aa3dULL, 0xba42c34dULL, 0xd39314a2ULL},
+{0x948d73e7ULL, 0x923002a0ULL, 0xae667c30ULL, 0x7ee21693ULL, 0x948d73e7ULL, 0xd7ffcfa6ULL, 0x53f78ac9ULL, 0x7ee21693ULL, 0xdaddd9dULL},
+{0x4ca0ac1dULL, 0xcff88c57ULL, 0x7f7cea13ULL, 0x54e4cb28ULL, 0x4ca0ac1dULL, 0xe067deebULL, 0xed89dc28ULL, 0x54e4cb28ULL, 0x7ea8bc60ULL},
+{0x4d4278eULL, 0xb648ecc2ULL, 0xce4b06a3ULL, 0x3b01d1d6ULL, 0x4d4278eULL, 0xc4af668bULL, 0xf3021df9ULL, 0x3b01d1d6ULL, 0x36cec675ULL},
+{0x82a9fc08ULL, 0x78b81fbaULL, 0xf2e304ccULL, 0x67655a26ULL, 0x82a9fc08ULL, 0x4aa59ebULL, 0xc4b71582ULL, 0x67655a26ULL, 0xf30259e7ULL},
+{0x10194389ULL, 0xfd630d13ULL, 0xb559c923ULL, 0xd8235400ULL, 0x10194389ULL, 0xfd693f56ULL, 0x46b4da02ULL, 0xd8235400ULL, 0x34c715b4ULL},
+{0x92d82f3ULL, 0x8555e550ULL, 0x115b0272ULL, 0x7fbb14beULL, 0x92d82f3ULL, 0x2352f8aaULL, 0x8e280af4ULL, 0x7fbb14beULL, 0xdafcfab5ULL},
+{0xeb8bf867ULL, 0x3bdfcfc1ULL, 0x1c3dad9bULL, 0x1dae9656ULL, 0xeb8bf867ULL, 0xa8da3c21ULL, 0x18e4bf69ULL, 0x1dae9656ULL, 0x1841381cULL},
+{0x4976dc11ULL, 0xbed7e65fULL, 0x3c24e2cbULL, 0x13436058ULL, 0x4976dc11ULL, 0x6cf9997cULL, 0xa769735fULL, 0x13436058ULL, 0x402ac70aULL},
+{0x506667a2ULL, 0x2dce056cULL, 0x597bd5fcULL, 0xc60fe989ULL, 0x506667a2ULL, 0xbcd326c9ULL, 0x66a7cd67ULL, 0xc60fe989ULL, 0x5e741529ULL},
+{0x4415f0abULL, 0x2003d274ULL, 0xda8f62d4ULL, 0xdecb7788ULL, 0x4415f0abULL, 0x79ff68c3ULL, 0x8f3931d2ULL, 0xdecb7788ULL, 0xf1003a7bULL},
+{0x6a8c7311ULL, 0x9267fe86ULL, 0xa6a8f4b1ULL, 0x7c3180dbULL, 0x6a8c7311ULL, 0x599daf8ULL, 0xdda92934ULL, 0x7c3180dbULL, 0xbbd1ea9ULL}},
+  {{0xa181d551ULL, 0x2852f557ULL, 0x342cf64eULL, 0x4e68edffULL, 0xa181d551ULL, 0xe50acea0ULL, 0xc4c12e54ULL, 0x4e68edffULL, 0x91d69b64ULL},
+{0xa371e090ULL, 0x54141d68ULL, 0xb4be0023ULL, 0xe100f122ULL, 0xa371e090ULL, 0x239f2badULL, 0xf38a6ebbULL, 0xe100f122ULL, 0xeb95cec4ULL},
+{0x5bbcea91ULL, 0x9e4782dbULL, 0x5b585c1bULL, 0xec9eada0ULL, 0x5bbcea91ULL, 0x8edc1dedULL, 0xec60db8aULL, 0xec9eada0ULL, 0xce48f3c2ULL},
+{0xe72e6d6bULL, 0x32623773ULL, 0x66a25c5fULL, 0x7bda9474ULL, 0xe72e6d6bULL, 0xd9a3565fULL, 0x81c64936ULL, 0x7bda9474ULL, 0xe1f9b872ULL},
+{0x7abc6075ULL, 0x4963f38bULL, 0x5cda10e7ULL, 0x672b3d7aULL, 0x7abc6075ULL, 0x74bad552ULL, 0x30dd513bULL, 0x672b3d7aULL, 0x16eaa501ULL},
+{0x9d85951aULL, 0x3f788845ULL, 0xf12b1035ULL, 0x79256876ULL, 0x9d85951aULL, 0xd1536fdfULL, 0xa6290664ULL, 0x79256876ULL, 0x5f863dcaULL},
+{0xf6fe6330ULL, 0x2f69aa25ULL, 0xe6dacd07ULL, 0xf862f0e1ULL, 0xf6fe6330ULL, 0xa0b81f4fULL, 0xa64af32bULL, 0xf862f0e1ULL, 0x8b600306ULL},
+{0x5d991c5bULL, 0xfd7c6d1dULL, 0xd1f2cfd4ULL, 0x8a8ef38aULL, 0x5d991c5bULL, 0xd6466bc8ULL, 0x66d2be7aULL, 0x8a8ef38aULL, 0x4fc57f9fULL},
+{0xdab639e6ULL, 0x506679c0ULL, 0x5eee8239ULL, 0x16cee775ULL, 0xdab639e6ULL, 0xd93aabaULL, 0x27970279ULL, 0x16cee775ULL, 0xa0009504ULL},
+{0xba7dcc71ULL, 0xcc88bae0ULL, 0xe1fbb7e3ULL, 0x18cfcdfULL, 0xba7dcc71ULL, 0x4673ffc7ULL, 0x9cb7584aULL, 0x18cfcdfULL, 0x48acdd59ULL},
+{0x665977d1ULL, 0xeb6b2a03ULL, 0xe2fb2b35ULL, 0x9b61a5faULL, 0x665977d1ULL, 0xf790bdcaULL, 0xaa16a863ULL, 0x9b61a5faULL, 0x870bf4dcULL},
+{0x8a782563ULL, 0x79a2f4ebULL, 0xf061db73ULL, 0x6cbfe420ULL, 0x8a782563ULL, 0x2eb0462eULL, 0x71de20a4ULL, 0x6cbfe420ULL, 0x77c9eb50ULL},
+{0x71593b8ULL, 0x2f04085fULL, 0xfa57e4b4ULL, 0xe334bca4ULL, 0x71593b8ULL, 0xa0b027d3ULL, 0x4355b13aULL, 0xe334bca4ULL, 0x780f1af9ULL},
+{0x1d81f740ULL, 0x4dad9da5ULL, 0x11d2d37bULL, 0xb2ec9187ULL, 0x1d81f740ULL, 0x890109afULL, 0x1f7a7d68ULL, 0xb2ec9187ULL, 0xd5129970ULL},
+{0xb703e6f7ULL, 0x35cabbccULL, 0xdcef1974ULL, 0x5f2370efULL, 0xb703e6f7ULL, 0x1e37d36cULL, 0xb99148a7ULL, 0x5f2370efULL, 0x416afafULL},
+{0x896f2135ULL, 0x16c3d6bcULL, 0xda5dc7a7ULL, 0x50c85827ULL, 0x896f2135ULL, 0x12b16e34ULL, 0x3b236127ULL, 0x50c85827ULL, 0xe75c6a5bULL},
+{0x41b1ae6fULL, 0x2d5d62ecULL, 0xed0ac46bULL, 0x77e1050fULL, 0x41b1ae6fULL, 0xc1facb96ULL, 0xd8d3eda3ULL, 0x77e1050fULL, 0x735fe142ULL},
+{0x94b3b293ULL, 0x5b1b17f4ULL, 0xf447980ULL, 0x91f5c7bfULL, 0x94b3b293ULL, 0x8f112d06ULL, 0x445e5a0cULL, 0x91f5c7bfULL, 0x318d03bcULL},
+{0x2bb6c0e2ULL, 0xf6972a46ULL, 0x80350587ULL, 0xfaa9a30dULL, 0x2bb6c0e2ULL, 0x3b3015c1ULL, 0xc0f786b5ULL, 0xfaa9a30dULL, 0x442d7e8ULL},
+{0x12c22231ULL, 0x1f214c3dULL, 0xb8cfe2beULL, 0x44873882ULL, 0x12c22231ULL, 0xe72b4ea5ULL, 0x4a475cdcULL, 0x44873882ULL, 0xa7358d8bULL},
+{0xfa7755a4ULL, 0xdb67cca5ULL, 0x7117102bULL, 0xe545f4fcULL, 0xfa7755a4ULL, 0x1b2800cULL, 0x50bd169ULL, 0xe545f4fcULL, 0x952138bULL},
+{0x91d603f4ULL, 0x902a2150ULL, 0x5dbfe258ULL, 0x11c5b08fULL, 0x91d603f4ULL, 0xf19996f5ULL, 0xf6f01d8eULL, 0x11c5b08fULL, 0xf604ea70ULL},
+{0xd0f554dbULL, 0x94a1a565ULL, 0x744eb71eULL, 0x54d52688ULL, 0xd0f554dbULL, 0xc22804feULL, 0xb202f26ULL, 0x54d52688ULL, 0x1998316fULL},
+{0xf6ea4982ULL, 0xba2389bULL, 0x3dd60cedULL, 0x6fa1a4fULL, 0xf6ea4982ULL, 0x7f2f00bULL, 0xbf866cbULL, 0x6fa1a4fULL, 0xc3f7ff11ULL},
+{0x986bd543ULL, 0xcd019497ULL, 0x2f6d45f0ULL, 0xc96351b5ULL, 0x986bd543ULL, 0x507ef1b6ULL, 0xcb2891cfULL, 0xc96351b5ULL, 0x3861d631ULL},
+{0xdbd2e9f2ULL, 0x92bcadcaULL, 0x8963dd12ULL, 0x51381dd2ULL, 0xdbd2e9f2ULL, 0xe9ab9bfaULL, 0x3e40ad30ULL, 0x51381dd2ULL, 0x5be062acULL},
+{0x74c14641ULL, 0xacaf82a2ULL, 0x8a33e11eULL, 0xf31877bbULL, 0x74c14641ULL, 0xb33b1319ULL, 0xe8936dd0ULL, 0xf31877bbULL, 0x37c04c17ULL},
+{0xa936414aULL, 0xa37cd64ULL, 0x42e2a4ccULL, 0x32a2608fULL, 0xa936414aULL, 0x63312316ULL, 0x148b2eefULL, 0x32a2608fULL, 0xca61d24cULL},
+{0x49ba9de3ULL, 0x24f1df82ULL, 0xa2a2af76ULL, 0x30939a61ULL, 0x49ba9de3ULL, 0x2194471dULL, 0x8b1e4aa3ULL, 0x30939a61ULL, 0xe232bd9dULL},
+{0x4cdb19c7ULL, 0x2586467bULL, 0x6c223dc6ULL, 0x9426db75ULL, 0x4cdb19c7ULL, 0x4fe2b8eeULL, 0xf5c6da06ULL, 0x9426db75ULL, 0x386928c3ULL},
+{0xf1805428ULL, 0x265806ceULL, 0x701c16afULL, 0xafd790cdULL, 0xf1805428ULL, 0xc3423d27ULL, 0xcf21f4b6ULL, 0xafd790cdULL, 0x4ef4a978ULL},
+{0x63697d93ULL, 0x5d43a921ULL, 0x86efa251ULL, 0xe201d689ULL, 0x63697d93ULL, 0xfa1bf00bULL, 0xc78e0b87ULL, 0xe201d689ULL, 0x24a8c6c1ULL},
+{0xe54baea8ULL, 0x87808595ULL, 0x42967a2eULL, 0x1db07752ULL, 0xe54baea8ULL, 0xadbabd86ULL, 0x4ddaf97dULL, 0x1db07752ULL, 0x7de9e9d8ULL},
+{0x5f48ad12ULL, 0xf1916100ULL, 0x57f42d38ULL, 0xcb3f4578ULL, 0x5f48ad12ULL, 0x58b80fddULL, 0x1e642007ULL, 0xcb3f4578ULL, 0xcd2fc323ULL},
+{0x63bc1226ULL, 0x3007926aULL, 0x3320bcf9ULL, 0xd86cb22dULL, 0x63bc1226ULL, 0x846e231cULL, 0xeafe2c52ULL, 0xd86cb22dULL, 0x7673e908ULL},
+{0x9e250764ULL, 0xd008592cULL, 0x391d4b2fULL, 0x88164dd0ULL, 0x9e250764ULL, 0x623427c5ULL, 0xd93588aeULL, 0x88164dd0ULL, 0xd336fe6ULL},
+{0x117910e1ULL, 0x10a0ddd0ULL, 0xcf686c94ULL, 0x83e305f4ULL, 0x117910e1ULL, 0xcb67f8f2ULL, 0x875c6283ULL, 0x83e305f4ULL, 0x2e16f2b8ULL},
+{0x50c546cdULL, 0xc0bd470fULL, 0x7dd20c0fULL, 0xadf105b7ULL, 0x50c546cdULL, 0x35c3b397ULL, 0xe7b59d13ULL, 0xadf105b7ULL, 0x9d7ce5a9ULL},
+{0xfe4af7dULL, 0xdb67c584ULL, 0x123c3018ULL, 0x33688437ULL, 0xfe4af7dULL, 0x54d9c5efULL, 0xa961547bULL, 0x33688437ULL, 0xe937954dULL},
+{0x23c8fc86ULL, 0xe126304cULL, 0x4233e2afULL, 0x76ae0bbULL, 0x23c8fc86ULL, 0x4a2ccc7cULL, 0x1a95825bULL, 0x76ae0bbULL, 0x7594a4e8ULL},
+{0x1b56199fULL, 0x72d35b7dULL, 0x4648e494ULL, 0x1ee5c76fULL, 0x1b56199fULL, 0xf73be865ULL, 0xd7da69baULL, 0x1ee5c76fULL, 0x426fa027ULL},
+{0xbbdec9edULL, 0x217b829dULL, 0x48cb117dULL, 0xe5256e37ULL, 0xbbdec9edULL, 0xa676045bULL, 0xcd14a126ULL, 0xe5256e37ULL, 0x16691135ULL},
+{0x100eabc6ULL, 0x28d11a7aULL, 0x2618f2ecULL, 0x57174bfaULL, 0x100eabc6ULL, 0xd7173bd8ULL, 0x5dfdc09fULL, 0x57174bfaULL, 0x1c52ccdfULL},
+{0x99a871e2ULL, 0x4c4d1f81ULL, 0x8244b65ULL, 0xd0c768acULL, 0x99a871e2ULL, 0x759369a9ULL, 0xb9ea6c26ULL, 0xd0c768acULL, 0xd7149cddULL},
+{0xf04cb1e2ULL, 0x260b39b3ULL, 0xcf3e18d3ULL, 0xbaf0981aULL, 0xf04cb1e2ULL, 0x1cbc4735ULL, 0x72f370acULL, 0xbaf0981aULL, 0x974d38c6ULL},
+{0x8ea7e16ULL, 0xbe6d8227ULL, 0x68d391abULL, 0x93f0995bULL, 0x8ea7e16ULL, 0x8d2678e6ULL, 0xaa676d9aULL, 0x93f0995bULL, 0x1be73fd4ULL},
+{0x5bed98b9ULL, 0xa6b4f711ULL, 0x8e77772aULL, 0xe926553eULL, 0x5bed98b9ULL, 0xc7293ffcULL, 0xda071184ULL, 0xe926553eULL, 0x86870547ULL},
+{0xa0e3a9faULL, 0x839bebb9ULL, 0xc58cc3fcULL, 0x66ba6dc3ULL, 0xa0e3a9faULL, 0xddd5382aULL, 0xb9c0f190ULL, 0x66ba6dc3ULL, 0x2d7dad33ULL},
+{0x435eca2fULL, 0x4bd8705ULL, 0x758e6b45ULL, 0x29b7a9c7ULL, 0x435eca2fULL, 0xe24a4c8ULL, 0x299f1d2bULL, 0x29b7a9c7ULL, 0x351ee4a0ULL},
+{0x80c0b082ULL, 0x34bbe15dULL, 0xc4b33283ULL, 0x8b9ac496ULL, 0x80c0b082ULL, 0xf7cd5e7aULL, 0xb80596afULL, 0x8b9ac496ULL, 0xbad3c655ULL},
+{0xdc919c0ULL, 0xf85d4476ULL, 0xadb473c7ULL, 0xcf8128afULL, 0xdc919c0ULL, 0xf14c2ae3ULL, 0x24bfb3bcULL, 0xcf8128afULL, 0x23478799ULL},
+{0x396d1b94ULL, 0x1992afb5ULL, 0x61dd566dULL, 0x860a9b1eULL, 0x396d1b94ULL, 0x95a6ccebULL, 0xb8c2d992ULL, 0x860a9b1eULL, 0x66b289b3ULL},
+{0x30d7a9baULL, 0xb81f3690ULL, 0x700ac0f4ULL, 0x38f05b13ULL, 0x30d7a9baULL, 0xc5ebcc5eULL, 0xebb1c355ULL, 0x38f05b13ULL, 0xa11c91d4ULL},
+{0x1328ac53ULL, 0xe90e62cfULL, 0x4febdca6ULL, 0xd1bdf1b3ULL, 0x1328ac53ULL, 0x692208ddULL, 0x9392f5e4ULL, 0xd1bdf1b3ULL, 0x9721595dULL},
+{0x6e1a2c21ULL, 0xad1acf9aULL, 0x439e1870ULL, 0xe667fe26ULL, 0x6e1a2c21ULL, 0x273437baULL, 0x28c3a770ULL, 0xe667fe26ULL, 0xa3fd1814ULL},
+{0x228dfefeULL, 0x3a811e3cULL, 0x5aa3dfeaULL, 0x866edd68ULL, 0x228dfefeULL, 0x20168071ULL, 0xded5710fULL, 0x866edd68ULL, 0x2456e823ULL},
+{0x734b6721ULL, 0x4e48904cULL, 0x398f952ULL, 0x1560a5c5ULL, 0x734b6721ULL, 0xd9372952ULL, 0xdc42ca1dULL, 0x1560a5c5ULL, 0x87e60399ULL},
+{0xe17a2f4cULL, 0x1b487b30ULL, 0xf3f7fcc8ULL, 0xfb02d735ULL, 0xe17a2f4cULL, 0x7667e73aULL, 0xc6cf632dULL, 0xfb02d735ULL, 0xd4d1652eULL},
+{0x6afab2afULL, 0xcdfa654dULL, 0x7285d255ULL, 0xa435836cULL, 0x6afab2afULL, 0xa3bb95b4ULL, 0x8fadbe5cULL, 0xa435836cULL, 0xdbef15bbULL},
+{0xcd7e2b37ULL, 0x4e9d8448ULL, 0x6e5e9bd9ULL, 0x4aa04dc4ULL, 0xcd7e2b37ULL, 0x77ae4f6fULL, 0x6abee69aULL, 0x4aa04dc4ULL, 0x9442d999ULL},
+{0x4792782fULL, 0xb2fb4c7aULL, 0x224c385fULL, 0xa35876c6ULL, 0x4792782fULL, 0x2be8ca9eULL, 0x230ea694ULL, 0xa35876c6ULL, 0x3a6e747cULL},
+{0xd991a48bULL, 0x3548ad72ULL, 0xa80ed21ULL, 0xc3b24027ULL, 0xd991a48bULL, 0x1dd480beULL, 0xedfc4baeULL, 0xc3b24027ULL, 0x8677ea5bULL},
+{0x7589c3d5ULL, 0xd1fe01f6ULL, 0xcc3cc310ULL, 0x534cd733ULL, 0x7589c3d5ULL, 0xcd1f14fULL, 0xa27715b7ULL, 0x534cd733ULL, 0x99f89927ULL},
+{0xf404adc6ULL, 0xcde01896ULL, 0xa7d22764ULL, 0xfe083decULL, 0xf404adc6ULL, 0xecda5df4ULL, 0xb198ad8eULL, 0xfe083decULL, 0xdfefff73ULL},
+{0xd8ae9c74ULL, 0x26c657e5ULL, 0xedf55b6aULL, 0x5753cf9aULL, 0xd8ae9c74ULL, 0x5bef0db8ULL, 0x5e50abccULL, 0x5753cf9aULL, 0xfc7c6603ULL},
+{0xa04db15bULL, 0x2f04970eULL, 0x1b233c7eULL, 0xc5747eULL, 0xa04db15bULL, 0xbca957f8ULL, 0xc1805666ULL, 0xc5747eULL, 0x1884d296ULL},
+{0xaec089e8ULL, 0x38622cceULL, 0xd5721677ULL, 0x1027bc64ULL, 0xaec089e8ULL, 0xb8ae7d70ULL, 0xb19b10faULL, 0x1027bc64ULL, 0x9a5db74cULL},
+{0xae40b0caULL, 0x35b9ee94ULL, 0xa852170eULL, 0x6187d22bULL, 0xae40b0caULL, 0x509742e8ULL, 0x3baad2b9ULL, 0x6187d22bULL, 0x13c94fc4ULL},
+{0x30b65061ULL, 0xf8eff401ULL, 0xbcb8024cULL, 0xcd62368ULL, 0x30b65061ULL, 0x825bd5baULL, 0x77fcb44bULL, 0xcd62368ULL, 0xece865e5ULL},
+{0x1f4a51cdULL, 0x52a7c3acULL, 0xe84ac248ULL, 0xa0f4bdb9ULL, 0x1f4a51cdULL, 0x1bbbea71ULL, 0xeb4f57d5ULL, 0xa0f4bdb9ULL, 0xdca6422cULL},
+{0x966143cbULL, 0x757daaf2ULL, 0x414844c7ULL, 0xa26070feULL, 0x966143cbULL, 0xf9581d30ULL, 0x2a34b596ULL, 0xa26070feULL, 0xcffccf58ULL},
+{0x5620c658ULL, 0xbd66f0f3ULL, 0x4a95b300ULL, 0x40eb4d0dULL, 0x5620c658ULL, 0x968a5c06ULL, 0xa2793a90ULL, 0x40eb4d0dULL, 0x89732cd3ULL},
+{0xb1fd276dULL, 0xbeb8f4a0ULL, 0xa1bbd8a7ULL, 0xe01caa1bULL, 0xb1fd276dULL, 0x4d0e4dadULL, 0x327ce4ceULL, 0xe01caa1bULL, 0x7d70ea85ULL},
+{0x5f51ba9bULL, 0xc8ad0370ULL, 0xefff4f1ULL, 0x86e2116fULL, 0x5f51ba9bULL, 0x5dc1c43bULL, 0xb3c421d0ULL, 0x86e2116fULL, 0xe84f6abfULL},
+{0xc4b28f2fULL, 0x70c4309eULL, 0x294b7708ULL, 0x30bc8ff8ULL, 0xc4b28f2fULL, 0xcccfabc2ULL, 0xec985e44ULL, 0x30bc8ff8ULL, 0xba381256ULL},
+{0xc21826eeULL, 0x62fbeeffULL, 0x87f75dd2ULL, 0x47156db5ULL, 0xc21826eeULL, 0x3f277d61ULL, 0xf1a541d1ULL, 0x47156db5ULL, 0x632c71dfULL},
+{0x6fa1ee0aULL, 0x9e819849ULL, 0x8112f4ffULL, 0x806b5490ULL, 0x6fa1ee0aULL, 0xa2faa946ULL, 0x4b8101e1ULL, 0x806b5490ULL, 0xb20ae139ULL},
+{0xccc443b5ULL, 0x8f653369ULL, 0x4aef6f44ULL, 0x8f3b5b70ULL, 0xccc443b5ULL, 0xd8cce606ULL, 0x34363ce4ULL, 0x8f3b5b70ULL, 0x6212ebeaULL},
+{0x6f01f32aULL, 0x47bb4aa2ULL, 0x803c4c25ULL, 0xd08eddafULL, 0x6f01f32aULL, 0x1fd15b47ULL, 0xf299fc0fULL, 0xd08eddafULL, 0xc4ea13d6ULL},
+{0x593f7dfaULL, 0xe4b72d02ULL, 0xf10a5616ULL, 0xea26d095ULL, 0x593f7dfaULL, 0xfc4db435ULL, 0x33c4d6d1ULL, 0xea26d095ULL, 0xc026b552ULL},
+{0xad3a0b39ULL, 0x3de3b8dfULL, 0xc74ef0eaULL, 0x97c9edaaULL, 0xad3a0b39ULL, 0xd9bc2060ULL, 0x13bc5bbbULL, 0x97c9edaaULL, 0x3a31f924ULL},
+{0x5ab2046cULL, 0x1e79a5e9ULL, 0xfe71dec9ULL, 0xc9dc725ULL, 0x5ab2046cULL, 0xad9c9162ULL, 0x51bfe1a4ULL, 0xc9dc725ULL, 0xa165fadULL},
+{0xe18f1894ULL, 0xdf996b77ULL, 0xb934e9baULL, 0x6b640271ULL, 0xe18f1894ULL, 0x66509aULL, 0x395e0442ULL, 0x6b640271ULL, 0x97fcfe44ULL},
+{0xa576fc29ULL, 0xb80eec3fULL, 0xe3790275ULL, 0xd13fc652ULL, 0xa576fc29ULL, 0xe18ca10fULL, 0x48f4b302ULL, 0xd13fc652ULL, 0xc51dc025ULL},
+{0xcfd9727eULL, 0x37919379ULL, 0xddcfe77bULL, 0xe299948eULL, 0xcfd9727eULL, 0xf9a09e92ULL, 0xd021d41bULL, 0xe299948eULL, 0xc2c097ebULL},
+{0x4e3d7d9eULL, 0x4683ea41ULL, 0x5ed8d8f8ULL, 0x1a4024abULL, 0x4e3d7d9eULL, 0xa02a6d14ULL, 0x87b15feULL, 0x1a4024abULL, 0x1f6306d7ULL},
+{0x72e40f82ULL, 0x2d0d9bb1ULL, 0x57f4f875ULL, 0x30cbb87fULL, 0x72e40f82ULL, 0xf86cf4f3ULL, 0x284ceacdULL, 0x30cbb87fULL, 0x7aa507caULL},
+{0x4e53e550ULL, 0xc424f73aULL, 0x3486e869ULL, 0x36bc6db3ULL, 0x4e53e550ULL, 0xa2953780ULL, 0xddfd0c7cULL, 0x36bc6db3ULL, 0xdc3eac62ULL},
+{0x9061221bULL, 0xb172bb8aULL, 0x54cfbe33ULL, 0x6e0d5861ULL, 0x9061221bULL, 0xca8d4ebaULL, 0x9ba8f26cULL, 0x6e0d5861ULL, 0x419f1a72ULL},
+{0xa2d34b01ULL, 0x92191962ULL, 0x2a5997d9ULL, 0xd3a5cdb1ULL, 0xa2d34b01ULL, 0xab151f7dULL, 0xbfac26c9ULL, 0xd3a5cdb1ULL, 0xe54afac5ULL},
+{0xd440bbb3ULL, 0xd8dcd56bULL, 0x87b36583ULL, 0xc6de34e9ULL, 0xd440bbb3ULL, 0x7f45839aULL, 0xf40430bbULL, 0xc6de34e9ULL, 0xe0f5fcf5ULL},
+{0x8026ee99ULL, 0x4b1a4937ULL, 0x15082cf0ULL, 0x4ae913c9ULL, 0x8026ee99ULL, 0x3cd43d6ULL, 0x7c9cb0f3ULL, 0x4ae913c9ULL, 0x6c0394dULL},
+{0xf966e9a3ULL, 0xf5010741ULL, 0xfe47748aULL, 0x1a10249bULL, 0xf966e9a3ULL, 0xaf9d912ULL, 0xda4a5575ULL, 0x1a10249bULL, 0x64e5eeb1ULL},
+{0xaed59de5ULL, 0x4d1ad1b9ULL, 0x34d97f2bULL, 0xfab72479ULL, 0xaed59de5ULL, 0x12e07534ULL, 0xb7d434efULL, 0xfab72479ULL, 0xa7e5f432ULL},
+{0xe0419069ULL, 0xa834ed36ULL, 0x9ff9415fULL, 0x5f400753ULL, 0xe0419069ULL, 0x9cb4dd87ULL, 0x54dd6f6fULL, 0x5f400753ULL, 0x40d53c59ULL},
+{0xf91254c2ULL, 0xb1aedaecULL, 0xea156df9ULL, 0x27d59b94ULL, 0xf91254c2ULL, 0x20e0184eULL, 0xd29309eeULL, 0x27d59b94ULL, 0xf5890be6ULL},
+{0x1d837556ULL, 0x583b683aULL, 0xd239c26aULL, 0xc4c78610ULL, 0x1d837556ULL, 0x5fb25774ULL, 0x827cd086ULL, 0xc4c78610ULL, 0x7572e12cULL},
+{0x404c287aULL, 0x99bb2db1ULL, 0xa49495c8ULL, 0x4b8807f6ULL, 0x404c287aULL, 0xf4e1f91ULL, 0xc7e181a0ULL, 0x4b8807f6ULL, 0x222db54eULL},
+{0x3e43ULL, 0xefbeab10ULL, 0x2825cbf8ULL, 0xdc9038f9ULL, 0x3e43ULL, 0xaf9028dULL, 0x60acda20ULL, 0xdc9038f9ULL, 0xac73123dULL},
+{0xd1a562abULL, 0xd2678655ULL, 0x657ac870ULL, 0x17c18905ULL, 0xd1a562abULL, 0xd90e3dc6ULL, 0xa6130cb1ULL, 0x17c18905ULL, 0x761ad7a6ULL},
+{0xf6c9608dULL, 0x76d5c465ULL, 0x9751a056ULL, 0x3d595f5dULL, 0xf6c9608dULL, 0xea327df4ULL, 0x5ac35905ULL, 0x3d595f5dULL, 0x5f7fb615ULL},
+{0xfc4aa3feULL, 0x6ecf53cdULL, 0x4a074859ULL, 0xb409d2e2ULL, 0xfc4aa3feULL, 0xb7f9f655ULL, 0x2fac0009ULL, 0xb409d2e2ULL, 0x850ae22dULL},
+{0x3ca0c10eULL, 0x87aaa08dULL, 0xa8cf4271ULL, 0xa1af5712ULL, 0x3ca0c10eULL, 0x583ece05ULL, 0xc53e307ULL, 0xa1af5712ULL, 0x74008f6fULL},
+{0xa02cc4a7ULL, 0x370371a6ULL, 0x5c855f4ULL, 0xca96afacULL, 0xa02cc4a7ULL, 0xc1b681cULL, 0x201a50d0ULL, 0xca96afacULL, 0x36e5e6d4ULL},
+{0x2d391aa2ULL, 0x826c1086ULL, 0x7867d2f8ULL, 0xa5e3aa8dULL, 0x2d391aa2ULL, 0xd049452dULL, 0x2a492789ULL, 0xa5e3aa8dULL, 0x16bc1b7fULL},
+{0xc7c9edbcULL, 0x535e19f7ULL, 0xab51ce76ULL, 0xa2d9f5cbULL, 0xc7c9edbcULL, 0x223837a4ULL, 0xf8750ddfULL, 0xa2d9f5cbULL, 0x36edcb67ULL},
+{0xe2cf8ec5ULL, 0xcad1b13dULL, 0xaff24453ULL, 0x420c3173ULL, 0xe2cf8ec5ULL, 0x690b7ab6ULL, 0x4a1dc3c7ULL, 0x420c3173ULL, 0xd0735ba2ULL},
+{0x83b099b9ULL, 0xdaa9fcc5ULL, 0x2d1882d1ULL, 0x4193377dULL, 0x83b099b9ULL, 0xfa0e4747ULL, 0x71a6dbd1ULL, 0x4193377dULL, 0x4d4e3651ULL},
+{0xaa632aebULL, 0x46c243cULL, 0x82fdfc36ULL, 0x50ac2644ULL, 0xaa632aebULL, 0x2fb155d2ULL, 0x5c94b310ULL, 0x50ac2644ULL, 0x216dda36ULL},
+{0xece27f72ULL, 0xc5f99faaULL, 0x7feebdaaULL, 0xce026c0cULL, 0xece27f72ULL, 0x3a58130bULL, 0x5248fb91ULL, 0xce026c0cULL, 0xb89cfb99ULL},
+{0x1e37b616ULL, 0xa81b5691ULL, 0x552d0838ULL, 0x6a199035ULL, 0x1e37b616ULL, 0xcdb0e418ULL, 0xc0c20a88ULL, 0x6a199035ULL, 0x453ceb8eULL},
+{0xf5aee55bULL, 0x81e73d01ULL, 0xd6fe9362ULL, 0xe868391ULL, 0xf5aee55bULL, 0xa0af694ULL, 0xcd4eb0cfULL, 0xe868391ULL, 0x2cda7d12ULL},
+{0x7ff624b9ULL, 0x2e7195c2ULL, 0x27dc2b35ULL, 0xb0c67f64ULL, 0x7ff624b9ULL, 0x86c16731ULL, 0xbd8c34ccULL, 0xb0c67f64ULL, 0xeb04ffdfULL},
+{0xb32331ceULL, 0x7f7fe88cULL, 0xee2d4cf9ULL, 0x5b6922cdULL, 0xb32331ceULL, 0x18225fb2ULL, 0xb750a165ULL, 0x5b6922cdULL, 0x52c6e0c7ULL},
+{0x9aead833ULL, 0xf7d26d02ULL, 0xc5d6c78eULL, 0x8011a97dULL, 0x9aead833ULL, 0x30724314ULL, 0x8f6fc487ULL, 0x8011a97dULL, 0x472bb80bULL},
+{0x604b1313ULL, 0x751213edULL, 0x6e4273ddULL, 0x23d09211ULL, 0x604b1313ULL, 0xf05c8ad5ULL, 0x9434ff71ULL, 0x23d09211ULL, 0x4b56a237ULL},
+{0xf207d52aULL, 0xb34d0135ULL, 0x1af2c4d8ULL, 0xa1dc12d5ULL, 0xf207d52aULL, 0xde88cdeULL, 0xef41b6b5ULL, 0xa1dc12d5ULL, 0x17890014ULL},
+{0x2496b37aULL, 0xef8cc278ULL, 0x738d9ceULL, 0xccebf233ULL, 0x2496b37aULL, 0x986f5a39ULL, 0xaaa068aeULL, 0xccebf233ULL, 0xe8271469ULL},
+{0x278dc525ULL, 0xe6bb9fbbULL, 0x3a7191f1ULL, 0x1d153c5aULL, 0x278dc525ULL, 0xf4f94a8bULL, 0xd28bd385ULL, 0x1d153c5aULL, 0x85679bULL},
+{0xe24bc2a6ULL, 0x3989ad08ULL, 0xd60c1c3eULL, 0xe3ff162bULL, 0xe24bc2a6ULL, 0xb9a167c6ULL, 0x72fb0d84ULL, 0xe3ff162bULL, 0x755db7e6ULL},
+{0xbc9edd7fULL, 0x8fcdfbc1ULL, 0x842cc738ULL, 0xcfb9b399ULL, 0xbc9edd7fULL, 0x7209426dULL, 0xb06449d5ULL, 0xcfb9b399ULL, 0xc065c42fULL},
+{0x6045d9bcULL, 0x65d9dcbfULL, 0x528aba48ULL, 0x931bc753ULL, 0x6045d9bcULL, 0xe11e4dbdULL, 0x9794bb9bULL, 0x931bc753ULL, 0x4ba519a8ULL},
+{0x3ce4e887ULL, 0x9bdb248bULL, 0x5b472fb7ULL, 0x15268cfcULL, 0x3ce4e887ULL, 0x4a233dfbULL, 0xf7e2555bULL, 0x15268cfcULL, 0x9e77642cULL},
+{0x92eec4ffULL, 0x83635956ULL, 0xc6a69e65ULL, 0xd363ac3bULL, 0x92eec4ffULL, 0xffabc9b4ULL, 0xe3807788ULL, 0xd363ac3bULL, 0x68e17d2cULL},
+{0x25fae103ULL, 0x5568269aULL, 0x253daed7ULL, 0xfd3b03e8ULL, 0x25fae103ULL, 0xc196ce93ULL, 0xf7823ad1ULL, 0xfd3b03e8ULL, 0x5c2f2ae9ULL},
+{0x34804936ULL, 0xa2404e61ULL, 0x8a142e19ULL, 0xe5b0c1bfULL, 0x34804936ULL, 0x74b27e31ULL, 0x9e2e3e9eULL, 0xe5b0c1bfULL, 0xab4386f2ULL},
+{0x64e08a76ULL, 0xef156593ULL, 0xdba73346ULL, 0xefa41dd2ULL, 0x64e08a76ULL, 0xe981a0ULL, 0x8849607cULL, 0xefa41dd2ULL, 0x4c5f36aeULL},
+{0xee8877dULL, 0x21fbcaafULL, 0x5a351f8eULL, 0xbd764510ULL, 0xee8877dULL, 0x657075e8ULL, 0xf8b38960ULL, 0xbd764510ULL, 0xfb2a566aULL},
+{0x57e1c9c6ULL, 0x2656f544ULL, 0x39d7ee47ULL, 0x4555a71dULL, 0x57e1c9c6ULL, 0x4aac3253ULL, 0xc07c9973ULL, 0x4555a71dULL, 0x4ff98c56ULL},
+{0x1e6ded0bULL, 0xe7d2d762ULL, 0x7e3f375cULL, 0x8e2974e7ULL, 0x1e6ded0bULL, 0x41f203a1ULL, 0xa34459f6ULL, 0x8e2974e7ULL, 0x36ff2554ULL},
+{0x1e9d6ecfULL, 0xda4615a5ULL, 0x1b685a36ULL, 0x88b618e8ULL, 0x1e9d6ecfULL, 0xd7daf2d0ULL, 0x428dd056ULL, 0x88b618e8ULL, 0xd202838bULL},
+{0xf4b7b29eULL, 0xe1923eb8ULL, 0x1d195ef1ULL, 0x8aa4e799ULL, 0xf4b7b29eULL, 0x387ad2ULL, 0xcd70aa20ULL, 0x8aa4e799ULL, 0xa9411af9ULL},
+{0xf48fe01cULL, 0x75c55fa7ULL, 0xbec22b6dULL, 0xc52d585eULL, 0xf48fe01cULL, 0xc9e0e9b3ULL, 0x1e4fa65ULL, 0xc52d585eULL, 0xbd420f73ULL},
+{0xd1b8277dULL, 0xc528c46cULL, 0xadabb3b9ULL, 0xcf338318ULL, 0xd1b8277dULL, 0x4bf18c33ULL, 0x7a0c852fULL, 0xcf338318ULL, 0x1cdc80b9ULL},
+{0x958e8996ULL, 0xa09f3000ULL, 0xf69c2e0cULL, 0x55da5310ULL, 0x958e8996ULL, 0xd938aa4eULL, 0x68d64536ULL, 0x55da5310ULL, 0xc5941d5aULL},
+{0x17e0a846ULL, 0xce5ccebaULL, 0x83845ddeULL, 0xe8d3b795ULL, 0x17e0a846ULL, 0xd9374f52ULL, 0xc18af04eULL, 0xe8d3b795ULL, 0x5e690603ULL},
+{0xc2dd559cULL, 0xe072881aULL, 0x1d667b3ULL, 0x1e23f5d3ULL, 0xc2dd559cULL, 0xff1d9005ULL, 0x5681f376ULL, 0x1e23f5d3ULL, 0x9313cbe8ULL},
+{0xdf77fe45ULL, 0x1eee1d3dULL, 0x72f37305ULL, 0xed720473ULL, 0xdf77fe45ULL, 0x8ad54a9eULL, 0x3c21ff90ULL, 0xed720473ULL, 0x639ebb20ULL},
+{0xf0a41a84ULL, 0x6edf4434ULL, 0x2338fc55ULL, 0x2a1eff5ULL, 0xf0a41a84ULL, 0xc55d43aULL, 0x4d418d8cULL, 0x2a1eff5ULL, 0xdf84f6e7ULL},
+{0xbd5d8ba9ULL, 0x3070380aULL, 0xb2c9717fULL, 0x5a05fb6fULL, 0xbd5d8ba9ULL, 0x21f1e0a9ULL, 0x7f5e44eULL, 0x5a05fb6fULL, 0xe2924e6dULL},
+{0x7b7e1bfULL, 0xdacf59d9ULL, 0xa1a31847ULL, 0x84c6be99ULL, 0x7b7e1bfULL, 0x247d6fc3ULL, 0x8fa4d4f5ULL, 0x84c6be99ULL, 0xb8f7b4ccULL},
+{0x5425394aULL, 0xd70093aULL, 0x1378d4c1ULL, 0x9f7667cULL, 0x5425394aULL, 0xbf0c8ec5ULL, 0xb8c3f47ULL, 0x9f7667cULL, 0x89b38e69ULL},
+{0x345572bdULL, 0xa38c75f3ULL, 0x7c90e523ULL, 0x2332b2e4ULL, 0x345572bdULL, 0x93b7bf29ULL, 0x18e9d4c6ULL, 0x2332b2e4ULL, 0xd226498aULL},
+{0x701e8855ULL, 0x7619a8e4ULL, 0xbb002d64ULL, 0x87f784d6ULL, 0x701e8855ULL, 0x4824ed4ULL, 0x3850cf3bULL, 0x87f784d6ULL, 0x7f5e9ec6ULL},
+{0x840c0f13ULL, 0xc1fa0b22ULL, 0x7abb11edULL, 0xe3a03fa7ULL, 0x840c0f13ULL, 0x3eec11d2ULL, 0xa2b3b54bULL, 0xe3a03fa7ULL, 0xc478bd25ULL},
+{0x1145ec3ULL, 0xb787b6c0ULL, 0xd6ea7686ULL, 0xafea1eb1ULL, 0x1145ec3ULL, 0x536c3a19ULL, 0x905ab3caULL, 0xafea1eb1ULL, 0xed5155b0ULL},
+{0xe8af0058ULL, 0x69667316ULL, 0x3bef5d0dULL, 0x6c8ff7f9ULL, 0xe8af0058ULL, 0x320d4c00ULL, 0x5354c3e7ULL, 0x6c8ff7f9ULL, 0xb9d99961ULL},
+{0x76ae001aULL, 0x993cbd22ULL, 0xc092121bULL, 0xe8efa92aULL, 0x76ae001aULL, 0xaf55f029ULL, 0xa95701ceULL, 0xe8efa92aULL, 0x840bf1e4ULL},
+{0xbdcfd6c9ULL, 0xa7d3ddcaULL, 0xbc3a1b75ULL, 0x1d0240b0ULL, 0xbdcfd6c9ULL, 0x9664d891ULL, 0x2db6f026ULL, 0x1d0240b0ULL, 0xedfa0ab2ULL},
+{0x4ca2a84aULL, 0x6dbf8b3bULL, 0x1dfd8254ULL, 0x57418f33ULL, 0x4ca2a84aULL, 0x3c397ba5ULL, 0x50beb6fbULL, 0x57418f33ULL, 0xcd3e9378ULL},
+{0x8c9bb31fULL, 0x335df587ULL, 0x4f1ffdd1ULL, 0x7e0011dcULL, 0x8c9bb31fULL, 0x636bb157ULL, 0x77c60ca5ULL, 0x7e0011dcULL, 0x18c2ef55ULL},
+{0x2953df5aULL, 0xde4a16a1ULL, 0x49d0cd44ULL, 0x1849b847ULL, 0x2953df5aULL, 0x8acdd86fULL, 0xf55e65eaULL, 0x1849b847ULL, 0xbb3ebc80ULL},
+{0xd0c4773aULL, 0x1a11d1d1ULL, 0xabf50e6eULL, 0x7cac8685ULL, 0xd0c4773aULL, 0x3228bbc8ULL, 0x86801389ULL, 0x7cac8685ULL, 0x84bb89b4ULL},
+{0x87ab38acULL, 0x83efcec5ULL, 0xdb148b85ULL, 0x82f6f5bULL, 0x87ab38acULL, 0xe5e59040ULL, 0xc6f20f19ULL, 0x82f6f5bULL, 0x9fd02be4ULL},
+{0x9b5f4d93ULL, 0x45090439ULL, 0xc9fd6033ULL, 0xbea85941ULL, 0x9b5f4d93ULL, 0x339db449ULL, 0x59a434d4ULL, 0xbea85941ULL, 0x2403770ULL},
+{0x3bab9565ULL, 0x31eb6608ULL, 0x3eca32ffULL, 0xfd31ff46ULL, 0x3bab9565ULL, 0xc397a5d1ULL, 0x996d1492ULL, 0xfd31ff46ULL, 0x345a7a38ULL},
+{0x25cca217ULL, 0xadeae550ULL, 0xf0b0bef2ULL, 0x936b89c3ULL, 0x25cca217ULL, 0x801f89beULL, 0x47305bdcULL, 0x936b89c3ULL, 0x74ed9ad0ULL},
+{0x9c6aa685ULL, 0xb2e950deULL, 0x80538888ULL, 0xde24283aULL, 0x9c6aa685ULL, 0x9c0cac5eULL, 0xd6cc99c5ULL, 0xde24283aULL, 0xe9ff81e2ULL},
+{0x55067a96ULL, 0xdd833792ULL, 0x7d92bf52ULL, 0x81fffabcULL, 0x55067a96ULL, 0xb6076698ULL, 0xebdcbf54ULL, 0x81fffabcULL, 0x10e4a6d3ULL},
+{0x115a093dULL, 0x50ecafeULL, 0xe8c63ef8ULL, 0x10998bdbULL, 0x115a093dULL, 0xf86433a8ULL, 0x41e4dbdfULL, 0x10998bdbULL, 0x9cfc758eULL},
+{0xa7430d5bULL, 0x7bcdc89dULL, 0x8ed9ae8fULL, 0xd941566fULL, 0xa7430d5bULL, 0x53c52927ULL, 0xa25ffd60ULL, 0xd941566fULL, 0x8faa0451ULL},
+{0x1c839296ULL, 0x6487863cULL, 0x174a554ULL, 0x9ea5fbc2ULL, 0x1c839296ULL, 0x79d05584ULL, 0x12a4a0b2ULL, 0x9ea5fbc2ULL, 0xcbb3cd3bULL},
+{0xfa1c3c02ULL, 0xa2ebc228ULL, 0x9cff0040ULL, 0xe2b23bafULL, 0xfa1c3c02ULL, 0xdcb21cd8ULL, 0xd3a01a42ULL, 0xe2b23bafULL, 0xe51e22bbULL},
+{0x8604ced5ULL, 0x77b805d6ULL, 0x38b8926aULL, 0xfd777e83ULL, 0x8604ced5ULL, 0x26d1e8ecULL, 0x22401f6eULL, 0xfd777e83ULL, 0x47ecabcdULL},
+{0xfda099cdULL, 0x373d629cULL, 0xff0ad21aULL, 0x4c6f7bfdULL, 0xfda099cdULL, 0x248d39e1ULL, 0x5842f81dULL, 0x4c6f7bfdULL, 0xcd016ce2ULL},
+{0xc2b649caULL, 0xc6f1c474ULL, 0x57976e11ULL, 0x76fb4807ULL, 0xc2b649caULL, 0x7f99f896ULL, 0xa68a0531ULL, 0x76fb4807ULL, 0xc0d7a264ULL},
+{0xf3bddf2fULL, 0x84baafabULL, 0xce83747bULL, 0x17d5ec52ULL, 0xf3bddf2fULL, 0xdf31ba72ULL, 0x22c38d10ULL, 0x17d5ec52ULL, 0x4395fb96ULL},
+{0x7e33f814ULL, 0x1f02bce7ULL, 0xf951ce0dULL, 0x1c97e961ULL, 0x7e33f814ULL, 0x8d88f541ULL, 0xf848e8cfULL, 0x1c97e961ULL, 0x73e3ee23ULL},
+{0x9e9f54fcULL, 0x9b138161ULL, 0x7250305aULL, 0x4c130c85ULL, 0x9e9f54fcULL, 0xa802d644ULL, 0xd9f46a2aULL, 0x4c130c85ULL, 0xad40f082ULL},
+{0xbb501cc9ULL, 0x7e734851ULL, 0x98652908ULL, 0xd250bf64ULL, 0xbb501cc9ULL, 0x3408b22fULL, 0xc32c4610ULL, 0xd250bf64ULL, 0x7fc5fa1fULL},
+{0x843fd69fULL, 0x27c8bf81ULL, 0x2dd069e9ULL, 0x2e5ebd27ULL, 0x843fd69fULL, 0xd5cdbc8bULL, 0x5ab4af6fULL, 0x2e5ebd27ULL, 0xdc2debdbULL},
+{0xb8dc45c9ULL, 0x5fe811beULL, 0x4ec463d1ULL, 0x36da2448ULL, 0xb8dc45c9ULL, 0x199135e9ULL, 0xd2ea5912ULL, 0x36da2448ULL, 0xa96323d3ULL},
+{0xff50568dULL, 0x3ca37dbeULL, 0xc90c0f70ULL, 0x87987bebULL, 0xff50568dULL, 0x6525ff27ULL, 0x484500ebULL, 0x87987bebULL, 0x6ddbac50ULL},
+{0x37debd0dULL, 0x9da736bcULL, 0xc409e2faULL, 0x72aee644ULL, 0x37debd0dULL, 0x4c310be3ULL, 0x7c75044fULL, 0x72aee644ULL, 0xb9b2deffULL},
+{0xe95e64daULL, 0x11d68de5ULL, 0x51b607dbULL, 0xd7b2134cULL, 0xe95e64daULL, 0x2da14227ULL, 0x5ec37563ULL, 0xd7b2134cULL, 0xf486fdc5ULL},
+{0x5eabd3fdULL, 0xd482c79fULL, 0x7cfe018fULL, 0x3a971c96ULL, 0x5eabd3fdULL, 0x31fd9f10ULL, 0x2875df7fULL, 0x3a971c96ULL, 0xfca0a78bULL},
+{0x9d495e8eULL, 0xd157d29fULL, 0xee28aeecULL, 0xec64e2e6ULL, 0x9d495e8eULL, 0x3d913200ULL, 0xa26f208ULL, 0xec64e2e6ULL, 0x43664960ULL},
+{0x8d9ba48ULL, 0x2992a4dULL, 0x8ea6a452ULL, 0x47db1df4ULL, 0x8d9ba48ULL, 0xf15fefbfULL, 0xb3c2283aULL, 0x47db1df4ULL, 0x461fb28cULL},
+{0x6691018aULL, 0x9c0a0547ULL, 0x84f41403ULL, 0xb93e39f2ULL, 0x6691018aULL, 0x2961560ULL, 0x6c9e98edULL, 0xb93e39f2ULL, 0xad912aa4ULL},
+{0xf8835bdfULL, 0xa9aaf34eULL, 0xa1221df9ULL, 0xe9b449dcULL, 0xf8835bdfULL, 0x94ccad65ULL, 0x786fd5daULL, 0xe9b449dcULL, 0x17037e0fULL},
+{0x39acd2d1ULL, 0xf1e4080aULL, 0xe4451645ULL, 0xd0fa1166ULL, 0x39acd2d1ULL, 0x15f044b6ULL, 0x62d4b58dULL, 0xd0fa1166ULL, 0x78afdfd4ULL},
+{0xd0708caeULL, 0xc0feab88ULL, 0xc6d862d2ULL, 0x2b73cd2ULL, 0xd0708caeULL, 0xe76d6847ULL, 0xe558863fULL, 0x2b73cd2ULL, 0x8cf2a829ULL},
+{0x71f87df9ULL, 0x733e3a06ULL, 0x7e7878d5ULL, 0x210f66d1ULL, 0x71f87df9ULL, 0xc133ed5dULL, 0xe6e1edd3ULL, 0x210f66d1ULL, 0x9982fc2bULL},
+{0xfddc49ecULL, 0x8ee55519ULL, 0x3405de0bULL, 0xeb96c00bULL, 0xfddc49ecULL, 0x8d78a9ccULL, 0xc0a272b9ULL, 0xeb96c00bULL, 0xc422ce80ULL},
+{0xbefb457bULL, 0xf4ecee41ULL, 0x64e9bd4fULL, 0x7acecfffULL, 0xbefb457bULL, 0x45a833abULL, 0xc16a3b34ULL, 0x7acecfffULL, 0x93dfdf86ULL},
+{0x941eee85ULL, 0x5cca246ULL, 0x839e824fULL, 0x2d8503deULL, 0x941eee85ULL, 0x87e988b4ULL, 0x90bb7d80ULL, 0x2d8503deULL, 0x13989674ULL},
+{0x6552acbcULL, 0xfa6f85aULL, 0xdb120bd9ULL, 0x4a0d54dbULL, 0x6552acbcULL, 0x53c40321ULL, 0xa779a506ULL, 0x4a0d54dbULL, 0xe9cca5dULL},
+{0xbf56b56fULL, 0xea68af49ULL, 0x6853c3a4ULL, 0x70f9eddbULL, 0xbf56b56fULL, 0xcc0bb0cbULL, 0x9614304eULL, 0x70f9eddbULL, 0xea4f5620ULL},
+{0x6cea3ea6ULL, 0xb12d5376ULL, 0x23638483ULL, 0x832a285dULL, 0x6cea3ea6ULL, 0xb8cb5af2ULL, 0x41a4039ULL, 0x832a285dULL, 0xbbb4768aULL},
+{0xd3e3e251ULL, 0xf8fdef04ULL, 0x384a5e6cULL, 0xbce8550eULL, 0xd3e3e251ULL, 0x70076dffULL, 0xbd8c052dULL, 0xbce8550eULL, 0x1ed641f1ULL},
+{0x6d5ccf35ULL, 0x1bc76db6ULL, 0x9b1ba38eULL, 0xbf045d0aULL, 0x6d5ccf35ULL, 0xe689042aULL, 0x626720d5ULL, 0xbf045d0aULL, 0x70f1bb79ULL},
+{0x935648abULL, 0x37607d46ULL, 0xd5083663ULL, 0x4d146c66ULL, 0x935648abULL, 0x572a3094ULL, 0x1320eed1ULL, 0x4d146c66ULL, 0xd4793c91ULL},
+{0xbfe10b18ULL, 0x628ea47ULL, 0xf73407ddULL, 0x94dc909bULL, 0xbfe10b18ULL, 0xc2a4b9afULL, 0xfda15124ULL, 0x94dc909bULL, 0x2a42c84ULL},
+{0xb6c1c892ULL, 0xa912e437ULL, 0x721e8c01ULL, 0x7de0e420ULL, 0xb6c1c892ULL, 0xe1d22f3ULL, 0x2a1fce5dULL, 0x7de0e420ULL, 0x384b2d2bULL},
+{0xfb69c2faULL, 0xcd66e599ULL, 0x3cd5a476ULL, 0x74025f44ULL, 0xfb69c2faULL, 0x81e37795ULL, 0xcbe75aa5ULL, 0x74025f44ULL, 0xaa3be32aULL},
+{0xf00b410bULL, 0x88c6afd8ULL, 0x5a69a3f9ULL, 0x69bfafbfULL, 0xf00b410bULL, 0x9a0e3968ULL, 0x2fda8fa7ULL, 0x69bfafbfULL, 0xbc7a91bfULL},
+{0x8104f00dULL, 0xe23baca3ULL, 0xd5cd60e9ULL, 0xd714ad2cULL, 0x8104f00dULL, 0x587343ddULL, 0xe969ad9dULL, 0xd714ad2cULL, 0x10e26011ULL},
+{0x14a49a72ULL, 0xcffbca5ULL, 0x4fd1587bULL, 0x5f0ab669ULL, 0x14a49a72ULL, 0x1324a4b1ULL, 0xb6092eacULL, 0x5f0ab669ULL, 0xffb4a37fULL},
+{0xaa24785eULL, 0xf1b1941ULL, 0x93b657e2ULL, 0x72b5b8e2ULL, 0xaa24785eULL, 0x60771c33ULL, 0x5d063084ULL, 0x72b5b8e2ULL, 0x251f386dULL},
+{0x9dda63f8ULL, 0x693f9bd8ULL, 0xb26eda25ULL, 0xf198029fULL, 0x9dda63f8ULL, 0x6adda62ULL, 0xbfc970f6ULL, 0xf198029fULL, 0x3d0a48ceULL},
+{0x66b059fbULL, 0x3a188765ULL, 0x5bf388b7ULL, 0xaa739f53ULL, 0x66b059fbULL, 0x7017e5acULL, 0x586c4b1cULL, 0xaa739f53ULL, 0x450aab7bULL},
+{0x8dcc7e94ULL, 0xa3049105ULL, 0xd81994ecULL, 0x5ef79314ULL, 0x8dcc7e94ULL, 0x953aa26eULL, 0xdda81429ULL, 0x5ef79314ULL, 0xe98283e4ULL},
+{0x6a580e6dULL, 0x25cadd4cULL, 0x38326f9aULL, 0x43055661ULL, 0x6a580e6dULL, 0xef3fc745ULL, 0x764cc15ULL, 0x43055661ULL, 0xc448c4c8ULL},
+{0xce23d0bULL, 0x680e808aULL, 0x5eb18c6dULL, 0xfcd205f3ULL, 0xce23d0bULL, 0x5ea8f55dULL, 0xa338c347ULL, 0xfcd205f3ULL, 0xdb5ad540ULL},
+{0x5c58dfbaULL, 0x620b7fd0ULL, 0xe274c721ULL, 0x35e077e5ULL, 0x5c58dfbaULL, 0x7b1c5245ULL, 0x276aebaULL, 0x35e077e5ULL, 0xcbdb0dd0ULL},
+{0x2508d6ebULL, 0xd032d77eULL, 0x2f238341ULL, 0x6307b8abULL, 0x2508d6ebULL, 0x7fad3a3fULL, 0xed66fdadULL, 0x6307b8abULL, 0x2ab0caa8ULL},
+{0xbc7142f9ULL, 0xd15ca0f3ULL, 0xddb796f3ULL, 0x64346027ULL, 0xbc7142f9ULL, 0xd332069dULL, 0x9d53bba1ULL, 0x64346027ULL, 0x7fceca32ULL},
+{0xa773268ULL, 0x6017c1b6ULL, 0xafe7bc2fULL, 0x842933d3ULL, 0xa773268ULL, 0x345433d6ULL, 0xa5c9bd4eULL, 0x842933d3ULL, 0xb1602ebdULL},
+{0x22464b38ULL, 0x81867617ULL, 0xccb3e17ULL, 0xc1ee96cbULL, 0x22464b38ULL, 0xb5236bbbULL, 0xcfc21a3dULL, 0xc1ee96cbULL, 0x748eef0dULL},
+{0xb87e191dULL, 0x4489d16dULL, 0xfa786958ULL, 0xd0abd7c8ULL, 0xb87e191dULL, 0x81eb8eefULL, 0x94675966ULL, 0xd0abd7c8ULL, 0x8b46186aULL},
+{0x57eb4dc5ULL, 0xafdf675dULL, 0x42ed407cULL, 0x57b95fc9ULL, 0x57eb4dc5ULL, 0x70343b7dULL, 0xc0b833daULL, 0x57b95fc9ULL, 0x55076675ULL},
+{0x5d676230ULL, 0x62e6d708ULL, 0x35a58ee2ULL, 0x50241367ULL, 0x5d676230ULL, 0x23d747eULL, 0xf7bd5678ULL, 0x50241367ULL, 0x1d95f3a5ULL},
+{0xbbabaaafULL, 0x4afb4253ULL, 0x1163ac3dULL, 0x519b9fb6ULL, 0xbbabaaafULL, 0xa7e50d1aULL, 0xc7e38c57ULL, 0x519b9fb6ULL, 0xfde9982dULL},
+{0xb9b2c0f9ULL, 0xee2b8c0bULL, 0x2e18985fULL, 0x9a7eae4bULL, 0xb9b2c0f9ULL, 0xb9e6c01bULL, 0x311ace51ULL, 0x9a7eae4bULL, 0x94963a4bULL},
+{0x7c79d59eULL, 0xa5dfacefULL, 0xc9b2e756ULL, 0x3a571ef8ULL, 0x7c79d59eULL, 0x5c22700ULL, 0x1be6a15aULL, 0x3a571ef8ULL, 0x8996b46aULL},
+{0x2849a7ecULL, 0xe808ee21ULL, 0xb2f11dc5ULL, 0xa5611f4bULL, 0x2849a7ecULL, 0x3f4b09e8ULL, 0x7c7efb03ULL, 0xa5611f4bULL, 0xfb8dfd92ULL},
+{0x39cc48efULL, 0x44e4be21ULL, 0xebc6b14bULL, 0xcc93491ULL, 0x39cc48efULL, 0xcd0c0b16ULL, 0x516e8c9aULL, 0xcc93491ULL, 0x3a810bc4ULL},
+{0xba660e8dULL, 0xa782212cULL, 0xbbf134d6ULL, 0xbc577db7ULL, 0xba660e8dULL, 0xadbbf238ULL, 0x15e9c216ULL, 0xbc577db7ULL, 0x83ffda7ULL},
+{0x866aaccaULL, 0x538a8ab4ULL, 0xf88287ecULL, 0xf6d6cb04ULL, 0x866aaccaULL, 0xb7088feULL, 0xabe52bbfULL, 0xf6d6cb04ULL, 0x77aaf28fULL},
+{0x136b4a0cULL, 0xea776c85ULL, 0xcc4458beULL, 0xb3b5d022ULL, 0x136b4a0cULL, 0x354c2097ULL, 0xa322a32cULL, 0xb3b5d022ULL, 0xb63a6659ULL},
+{0x126a5b75ULL, 0xa2ef09ffULL, 0x21d8d279ULL, 0x7f78cfaULL, 0x126a5b75ULL, 0x11097e56ULL, 0x4bda2977ULL, 0x7f78cfaULL, 0x6c32f92aULL},
+{0x1f38d872ULL, 0x263cecbULL, 0xc1642c76ULL, 0xe479db49ULL, 0x1f38d872ULL, 0x95b0e22dULL, 0xd943d9b9ULL, 0xe479db49ULL, 0x79968a5eULL},
+{0x52a25a1eULL, 0x9edcff56ULL, 0x1a7894d7ULL, 0x497b99eULL, 0x52a25a1eULL, 0x45921ccbULL, 0xb96ef51aULL, 0x497b99eULL, 0x5177ddafULL},
+{0x3df57e79ULL, 0xafb89d98ULL, 0x569468d3ULL, 0x8695319aULL, 0x3df57e79ULL, 0x1861b1b9ULL, 0x74a4c17eULL, 0x8695319aULL, 0xa4afbe87ULL},
+{0x63ca804ULL, 0x2a12babaULL, 0x87f797e6ULL, 0x88755818ULL, 0x63ca804ULL, 0xd9d0be11ULL, 0xebff7c7eULL, 0x88755818ULL, 0x8ca5a5a4ULL},
+{0x87192614ULL, 0xea6f8db2ULL, 0xb37c9889ULL, 0x9ef290deULL, 0x87192614ULL, 0x2c674c18ULL, 0x70de2714ULL, 0x9ef290deULL, 0xf1c14adbULL},
+{0x8af41990ULL, 0x47d6f73ULL, 0xcbb1dbebULL, 0x4a700f21ULL, 0x8af41990ULL, 0xf9118c80ULL, 0xf0922615ULL, 0x4a700f21ULL, 0xaa0ae6c5ULL},
+{0x119b1ed5ULL, 0x8dae72a1ULL, 0x7509e272ULL, 0xf0ec18cdULL, 0x119b1ed5ULL, 0x9628ea19ULL, 0x9093f477ULL, 0xf0ec18cdULL, 0xc330876fULL},
+{0x19552c42ULL, 0x20cea111ULL, 0x62a1c501ULL, 0x6aa9f21eULL, 0x19552c42ULL, 0xa36305dULL, 0xcb76a1a2ULL, 0x6aa9f21eULL, 0x5084125cULL},
+{0xed3d6e88ULL, 0xd62f6099ULL, 0xbe4e9d15ULL, 0x77a826cbULL, 0xed3d6e88ULL, 0xd9da5f5bULL, 0x85d4ce6fULL, 0x77a826cbULL, 0xfb1bdc06ULL},
+{0x229aa753ULL, 0xdb52c90eULL, 0x1bef93bcULL, 0x7e4c53feULL, 0x229aa753ULL, 0x82624ca6ULL, 0x458c2b2cULL, 0x7e4c53feULL, 0xea2eff2bULL},
+{0x1eb88e5dULL, 0x34d5e330ULL, 0x558cd7c5ULL, 0xa9bd3e58ULL, 0x1eb88e5dULL, 0xb3eb3652ULL, 0x3afdd8ecULL, 0xa9bd3e58ULL, 0xec770b3cULL},
+{0x691de027ULL, 0x9dbe1c67ULL, 0x3cef8e98ULL, 0x7c254dd4ULL, 0x691de027ULL, 0xf40f47ebULL, 0xd41e4cbbULL, 0x7c254dd4ULL, 0x4c0a7551ULL},
+{0x8e40599aULL, 0x47df05eeULL, 0x6630c462ULL, 0x24409745ULL, 0x8e40599aULL, 0x6b07f374ULL, 0x4bf06d8fULL, 0x24409745ULL, 0x119786f5ULL},
+{0xe33bc6feULL, 0x5e1bcb27ULL, 0xe67e2e7eULL, 0xf9f9f13bULL, 0xe33bc6feULL, 0x2783fba8ULL, 0xf9b5e621ULL, 0xf9f9f13bULL, 0x4522f188ULL},
+{0x60c8334bULL, 0xee9b27f4ULL, 0xb348f688ULL, 0x7384efd3ULL, 0x60c8334bULL, 0x818e513eULL, 0x9687afc9ULL, 0x7384efd3ULL, 0x8a554af1ULL},
+{0x9d44669fULL, 0xa4c48dbbULL, 0xe5099912ULL, 0xeabb8ecULL, 0x9d44669fULL, 0xd8f27754ULL, 0x875db8b4ULL, 0xeabb8ecULL, 0xa5370f02ULL},
+{0xc87de759ULL, 0x75f4b0e6ULL, 0xbf7ac8fULL, 0x6caf0ae0ULL, 0xc87de759ULL, 0x5fea2aa7ULL, 0x17f20f4ULL, 0x6caf0ae0ULL, 0x8f7c88adULL},
+{0x91cd8619ULL, 0xd71441cfULL, 0x8b841dffULL, 0xfe430126ULL, 0x91cd8619ULL, 0xd62e4061ULL, 0xdfed0e82ULL, 0xfe430126ULL, 0xeeaa5c6aULL},
+{0x277bfdb0ULL, 0x873080d9ULL, 0xb1f9eed3ULL, 0x2671bbafULL, 0x277bfdb0ULL, 0xdaa6c6c5ULL, 0xb12552aeULL, 0x2671bbafULL, 0xd0f6cfe7ULL},
+{0x497d4eb8ULL, 0xa117c761ULL, 0x2ae22fc3ULL, 0x294ac4e7ULL, 0x497d4eb8ULL, 0x6877e450ULL, 0xe1958d9bULL, 0x294ac4e7ULL, 0x5fe02f9ULL},
+{0xbfab3331ULL, 0x92186b24ULL, 0x843d77d6ULL, 0xc3bfba22ULL, 0xbfab3331ULL, 0xd227af76ULL, 0xc335c696ULL, 0xc3bfba22ULL, 0x44a17a26ULL},
+{0x428ae14cULL, 0x9d1b0042ULL, 0x3a71a640ULL, 0x745b1a9dULL, 0x428ae14cULL, 0x4ed8b61bULL, 0x380d8cd9ULL, 0x745b1a9dULL, 0x9699553eULL},
+{0xb4652347ULL, 0x9a1c137bULL, 0x8b09a59eULL, 0x4a9e9a6dULL, 0xb4652347ULL, 0x9ea332cfULL, 0x6ca53ddULL, 0x4a9e9a6dULL, 0xd73fa58eULL},
+{0xa0bd2db1ULL, 0x38977cf6ULL, 0xf353905ULL, 0x8adba1e9ULL, 0xa0bd2db1ULL, 0xa28170cdULL, 0x7574dd99ULL, 0x8adba1e9ULL, 0xf81086b4ULL},
+{0xca1d6b65ULL, 0xf49233b1ULL, 0x51ab0597ULL, 0x13e37943ULL, 0xca1d6b65ULL, 0x6f2ccd4bULL, 0xad73a22ULL, 0x13e37943ULL, 0xf64b1630ULL},
+{0xbaa0325fULL, 0x7a08c4c9ULL, 0xb2232c40ULL, 0xac3e8ffbULL, 0xbaa0325fULL, 0xd0d4637dULL, 0xb1626e23ULL, 0xac3e8ffbULL, 0xa68757dcULL},
+{0xe5c31543ULL, 0x7d4db2aaULL, 0x45949de1ULL, 0x59fe5d18ULL, 0xe5c31543ULL, 0xa55e4947ULL, 0xfd5e482cULL, 0x59fe5d18ULL, 0x347af9dfULL},
+{0xe88e7826ULL, 0x2e1fe101ULL, 0x4e3b740ULL, 0x10f90bf6ULL, 0xe88e7826ULL, 0x72993512ULL, 0x374a071aULL, 0x10f90bf6ULL, 0xd0241ca5ULL},
+{0x75a5e4edULL, 0x8d24c91ULL, 0x4d0e1a6dULL, 0x624fc822ULL, 0x75a5e4edULL, 0x37abea1fULL, 0x98146fc1ULL, 0x624fc822ULL, 0x3f1c5830ULL},
+{0x765b63adULL, 0x65099f65ULL, 0x668bcc11ULL, 0x5f68bd02ULL, 0x765b63adULL, 0x64a1ebc0ULL, 0x77c1a248ULL, 0x5f68bd02ULL, 0x954fc544ULL},
+{0x5afc2385ULL, 0x99862c26ULL, 0xcbcfee63ULL, 0x5f6f8f00ULL, 0x5afc2385ULL, 0xa8a6d3d2ULL, 0x36d88f5bULL, 0x5f6f8f00ULL, 0xa92a4a9bULL},
+{0x1bbb759eULL, 0xba9ba441ULL, 0xe201a8a6ULL, 0xc4e312d7ULL, 0x1bbb759eULL, 0x7d1ca0cULL, 0x4d08f2b7ULL, 0xc4e312d7ULL, 0xa0ab532ULL},
+{0x29f8f056ULL, 0x4709af29ULL, 0x21e1481eULL, 0x1c7517d4ULL, 0x29f8f056ULL, 0xd03b0afbULL, 0xb5d877c0ULL, 0x1c7517d4ULL, 0x890835fcULL},
+{0xa2be0ca0ULL, 0x9cd29007ULL, 0xcc157447ULL, 0x64c36f46ULL, 0xa2be0ca0ULL, 0x628cfb13ULL, 0x2f9592d3ULL, 0x64c36f46ULL, 0x2e8d71a1ULL}},
+  {{0xf7d7acb2ULL, 0xb687e1b8ULL, 0x6c39f85fULL, 0x52348eb0ULL, 0xf7d7acb2ULL, 0xea09c942ULL, 0xa96e190eULL, 0x52348eb0ULL, 0xaa016a9aULL},
+{0x378ae22aULL, 0xf464563ULL, 0x9cf913deULL, 0xc3c7bbb5ULL, 0x378ae22aULL, 0x99029aabULL, 0x18c05761ULL, 0xc3c7bbb5ULL, 0x78419cfbULL},
+{0x1e462bcbULL, 0x254a16b5ULL, 0xde8daef8ULL, 0xe90791e0ULL, 0x1e462bcbULL, 0xc58030b2ULL, 0x65c7a488ULL, 0xe90791e0ULL, 0x3ac3cb2bULL},
+{0x623a905aULL, 0x3d8783e0ULL, 0xedaadb2eULL, 0x6d2a6954ULL, 0x623a905aULL, 0xa8a5f4ebULL, 0x6c8b82a0ULL, 0x6d2a6954ULL, 0xade00729ULL},
+{0x197b1723ULL, 0x453d5da1ULL, 0x4bf6a9feULL, 0x7982ba19ULL, 0x197b1723ULL, 0xc1368179ULL, 0xf997c119ULL, 0x7982ba19ULL, 0x368038eULL},
+{0xe8c7d0fdULL, 0x5cf67193ULL, 0x32279deULL, 0x4e1d5acfULL, 0xe8c7d0fdULL, 0xe8597947ULL, 0xe35b4592ULL, 0x4e1d5acfULL, 0x290d8dd9ULL},
+{0x29c5bc46ULL, 0x5ec96dfaULL, 0xdb60749cULL, 0x778b877cULL, 0x29c5bc46ULL, 0xe3f2c5c8ULL, 0x4f67cc71ULL, 0x778b877cULL, 0x9c3556eeULL},
+{0xf808cfe5ULL, 0x1d344261ULL, 0xe6b87300ULL, 0x6381c0b7ULL, 0xf808cfe5ULL, 0xffe12cfeULL, 0x5abe3ddaULL, 0x6381c0b7ULL, 0x9e16aed0ULL},
+{0xaf40ed42ULL, 0xcd6cefbcULL, 0x90a1c0f8ULL, 0xb995e400ULL, 0xaf40ed42ULL, 0x5f7bd15aULL, 0xcd31c63cULL, 0xb995e400ULL, 0x11d26372ULL},
+{0x8dd8929aULL, 0x933baa36ULL, 0x201ee672ULL, 0x3a6d7307ULL, 0x8dd8929aULL, 0x3230beabULL, 0xfafe654aULL, 0x3a6d7307ULL, 0xc10371c8ULL},
+{0x81bde7c0ULL, 0x29a00b79ULL, 0x4c8ee5ccULL, 0xb73a5113ULL, 0x81bde7c0ULL, 0x3e5d3a8bULL, 0xf590c4adULL, 0xb73a5113ULL, 0xc7ae53f8ULL},
+{0x270ec9faULL, 0xdb15809eULL, 0xcfda7f0bULL, 0xda0ec11fULL, 0x270ec9faULL, 0xf3fcd397ULL, 0xc703c749ULL, 0xda0ec11fULL, 0x7788f74bULL},
+{0x4627255ULL, 0xc15b03daULL, 0xdc86bb64ULL, 0x13127022ULL, 0x4627255ULL, 0x6cfdd952ULL, 0xc8cd88a4ULL, 0x13127022ULL, 0x30ff1720ULL},
+{0xcfe29530ULL, 0x7df667c5ULL, 0x91f93a94ULL, 0x696a2549ULL, 0xcfe29530ULL, 0x4c787d34ULL, 0x5c487fb4ULL, 0x696a2549ULL, 0x7caaea1eULL},
+{0xd8031e5eULL, 0x6fb7262aULL, 0x8ef3ff8cULL, 0x7a4f5cc8ULL, 0xd8031e5eULL, 0x259408e4ULL, 0xf40062eULL, 0x7a4f5cc8ULL, 0x76c5babbULL},
+{0x4bc0ec1bULL, 0xbaf5321cULL, 0x1e23070bULL, 0xb1b5b1a3ULL, 0x4bc0ec1bULL, 0x96b7aa10ULL, 0x254387afULL, 0xb1b5b1a3ULL, 0x3c23e3cfULL},
+{0x92aa4ae7ULL, 0x33d9604eULL, 0x769bd835ULL, 0x7e8d34c8ULL, 0x92aa4ae7ULL, 0x520753eeULL, 0x9f794db1ULL, 0x7e8d34c8ULL, 0x2f892d68ULL},
+{0x195571c4ULL, 0x5a5d8e71ULL, 0x3bef86a2ULL, 0x6ee6989ULL, 0x195571c4ULL, 0x71c8ab4cULL, 0x821ee575ULL, 0x6ee6989ULL, 0x1cb4b3d0ULL},
+{0x4db6f6bcULL, 0xc7cfa1c7ULL, 0xb3d2a5cfULL, 0xf6a8b848ULL, 0x4db6f6bcULL, 0xd23d0799ULL, 0x60394f29ULL, 0xf6a8b848ULL, 0xa925453cULL},
+{0x9f30400fULL, 0x4e81fe66ULL, 0x37513310ULL, 0xc6c29f01ULL, 0x9f30400fULL, 0xc4a0a2deULL, 0xb9c93f9bULL, 0xc6c29f01ULL, 0xf3e4a597ULL},
+{0xf060530fULL, 0xa24046dULL, 0xdba6b9ffULL, 0xd7fdebcfULL, 0xf060530fULL, 0x4b97ac3dULL, 0x16415545ULL, 0xd7fdebcfULL, 0xabe036ffULL},
+{0x2b346277ULL, 0xf5eb0323ULL, 0x21b85a4fULL, 0x1592493fULL, 0x2b346277ULL, 0xfcc1d984ULL, 0x2c10b6edULL, 0x1592493fULL, 0xa1ee1296ULL},
+{0x8503df51ULL, 0x2d1d030bULL, 0xb498e2e4ULL, 0x12a479f2ULL, 0x8503df51ULL, 0x30600fb5ULL, 0x33d8703bULL, 0x12a479f2ULL, 0xa9c67706ULL},
+{0x5322c9aULL, 0xdd6d4f4aULL, 0xdb04f769ULL, 0xd6111c20ULL, 0x5322c9aULL, 0xd4105e84ULL, 0x9aff1ae4ULL, 0xd6111c20ULL, 0xd134e668ULL},
+{0xba215a22ULL, 0x79e4d6f8ULL, 0x7c960a78ULL, 0x84fd7267ULL, 0xba215a22ULL, 0xd79727e7ULL, 0xce484adULL, 0x84fd7267ULL, 0xa541b99dULL},
+{0xbdf8d419ULL, 0xf3376c2aULL, 0x3b107896ULL, 0xea90d6fdULL, 0xbdf8d419ULL, 0x47963666ULL, 0x31c7293eULL, 0xea90d6fdULL, 0xbc8bb325ULL},
+{0xa459d2b5ULL, 0xe116d335ULL, 0x7868ae33ULL, 0xbcfb6ec4ULL, 0xa459d2b5ULL, 0x13ed6418ULL, 0x58c35243ULL, 0xbcfb6ec4ULL, 0xbb6af5fbULL},
+{0x51f2890cULL, 0xdabbe827ULL, 0x12b53c4dULL, 0xa735cf02ULL, 0x51f2890cULL, 0xdae40d44ULL, 0x336b2dc6ULL, 0xa735cf02ULL, 0x4bb0f76dULL},
+{0x2d59c04dULL, 0x8de677beULL, 0x559cae77ULL, 0x6b4d7877ULL, 0x2d59c04dULL, 0x90601c98ULL, 0x8a3af1f1ULL, 0x6b4d7877ULL, 0x475ddbd6ULL},
+{0xfe544e2eULL, 0xddaac4b1ULL, 0x239b4013ULL, 0xf08094c7ULL, 0xfe544e2eULL, 0x960cbff2ULL, 0x971b3ae3ULL, 0xf08094c7ULL, 0xf0af957aULL},
+{0xf8bc65a1ULL, 0xe3dd264fULL, 0x2a73bfa1ULL, 0xd27daf9aULL, 0xf8bc65a1ULL, 0x8eff4929ULL, 0x69fa9fa3ULL, 0xd27daf9aULL, 0x8e30d66eULL},
+{0x10bfabd4ULL, 0x890c819ULL, 0xb3983e34ULL, 0x6b265b75ULL, 0x10bfabd4ULL, 0xdf28af64ULL, 0x42fbbe17ULL, 0x6b265b75ULL, 0x92a27081ULL},
+{0xc3d48db4ULL, 0x7b567c8ULL, 0x3afe5efcULL, 0x740a4416ULL, 0xc3d48db4ULL, 0xa40c83cdULL, 0x4d96dbbULL, 0x740a4416ULL, 0xc147d918ULL},
+{0x1c8dfde8ULL, 0x517cc676ULL, 0x7c7c0e92ULL, 0xf0659750ULL, 0x1c8dfde8ULL, 0x7e5377a8ULL, 0x7a54648ULL, 0xf0659750ULL, 0x803882a1ULL},
+{0xd1f6fbcdULL, 0xdb283338ULL, 0x66978919ULL, 0xe1447cccULL, 0xd1f6fbcdULL, 0x5b8c140eULL, 0x4d17c17cULL, 0xe1447cccULL, 0x223d7778ULL},
+{0x4cd9d4e8ULL, 0x60d89e0bULL, 0x1d00f0f7ULL, 0x740e9326ULL, 0x4cd9d4e8ULL, 0xd235d4afULL, 0xee438b99ULL, 0x740e9326ULL, 0xb36ad36eULL},
+{0xbb2e5c6eULL, 0xa1aac4daULL, 0xd09cc910ULL, 0x8f097fb3ULL, 0xbb2e5c6eULL, 0xe794924bULL, 0xd4de050cULL, 0x8f097fb3ULL, 0xc4c3dbc0ULL},
+{0x365463b6ULL, 0xc18905b0ULL, 0x59347edfULL, 0xc23bc8b6ULL, 0x365463b6ULL, 0xf88ee1cbULL, 0xa89b46f7ULL, 0xc23bc8b6ULL, 0x5db3d333ULL},
+{0xe3799177ULL, 0xaafea019ULL, 0xe202370aULL, 0x22fb4c8cULL, 0xe3799177ULL, 0x728f0568ULL, 0x3f092d45ULL, 0x22fb4c8cULL, 0xc95fba84ULL},
+{0x5e7b2112ULL, 0x19e3d58dULL, 0x6c140927ULL, 0xab2290c5ULL, 0x5e7b2112ULL, 0xe6aced7dULL, 0x588847c3ULL, 0xab2290c5ULL, 0x7f5665efULL},
+{0x886f1c0ULL, 0x12b46eebULL, 0x4a7a5911ULL, 0x44d5ed8cULL, 0x886f1c0ULL, 0xb8ef0e29ULL, 0x65dafe67ULL, 0x44d5ed8cULL, 0xc0f83c23ULL},
+{0x9a532448ULL, 0xc08abbc5ULL, 0x9db74748ULL, 0xf916b501ULL, 0x9a532448ULL, 0x8d50de51ULL, 0x1ee886dULL, 0xf916b501ULL, 0xff9ba843ULL},
+{0x831eb35aULL, 0x3bc3b85dULL, 0xd5f8958ULL, 0x641e1dddULL, 0x831eb35aULL, 0x508a29cfULL, 0x2924ca28ULL, 0x641e1dddULL, 0x75a87b26ULL},
+{0xbaa832f1ULL, 0xec77a64ULL, 0x2a13a22dULL, 0xf0129880ULL, 0xbaa832f1ULL, 0xed3cef2bULL, 0x4b3b9192ULL, 0xf0129880ULL, 0x3135eac4ULL},
+{0xf5e6a830ULL, 0x36d01b94ULL, 0x4ad102cfULL, 0xd43740ddULL, 0xf5e6a830ULL, 0x91321ffcULL, 0x660c78d5ULL, 0xd43740ddULL, 0xd43c74f0ULL},
+{0xab346eddULL, 0xd2c3586ULL, 0x2573222dULL, 0x24dfaa99ULL, 0xab346eddULL, 0xcaa6600dULL, 0x5a0db989ULL, 0x24dfaa99ULL, 0x2ccdc95aULL},
+{0x52c6ccdfULL, 0xa72a6eaULL, 0x558e5388ULL, 0xa38a1ca6ULL, 0x52c6ccdfULL, 0x7ae7213cULL, 0x703af837ULL, 0xa38a1ca6ULL, 0x86c30abdULL},
+{0x8dd91542ULL, 0x9d02a035ULL, 0x23e4ad3aULL, 0x53a19661ULL, 0x8dd91542ULL, 0x78cff825ULL, 0x97aa20aaULL, 0x53a19661ULL, 0x4e858f58ULL},
+{0xb502c6caULL, 0x10c1dc22ULL, 0xa344cbbeULL, 0xdea52f3eULL, 0xb502c6caULL, 0x2a528b5aULL, 0x3e3aca38ULL, 0xdea52f3eULL, 0xe6d04c9ULL},
+{0x69987859ULL, 0x243ace1dULL, 0x475f28bbULL, 0x8fabf618ULL, 0x69987859ULL, 0xea056129ULL, 0xd20ecc6fULL, 0x8fabf618ULL, 0xa1b603f1ULL},
+{0x1ff4c78cULL, 0xc293d0ebULL, 0x355be542ULL, 0xddb7259bULL, 0x1ff4c78cULL, 0x57a52c0cULL, 0x1134befdULL, 0xddb7259bULL, 0x7b0a1e68ULL},
+{0xe99385c9ULL, 0x12a7eb67ULL, 0xce42beeaULL, 0x661f712cULL, 0xe99385c9ULL, 0x77abc205ULL, 0xcc02f065ULL, 0x661f712cULL, 0x23dd0e6fULL},
+{0xeea5ce5cULL, 0xa8de96a2ULL, 0x780d4281ULL, 0xad6f24c6ULL, 0xeea5ce5cULL, 0xda19cca8ULL, 0x8c5fa90ULL, 0xad6f24c6ULL, 0x9f2da061ULL},
+{0xfcd2be34ULL, 0x7757cfdULL, 0x7d3b2108ULL, 0xecfbd066ULL, 0xfcd2be34ULL, 0x7b0832e1ULL, 0xd8ca4142ULL, 0xecfbd066ULL, 0x6bb53175ULL},
+{0x31360c29ULL, 0x65a0bbdbULL, 0x9befa29eULL, 0x2191c865ULL, 0x31360c29ULL, 0xebd96526ULL, 0xe94cebdaULL, 0x2191c865ULL, 0x4b415065ULL},
+{0x1f0568f8ULL, 0x842c50b7ULL, 0xf610a4e6ULL, 0x8914d75cULL, 0x1f0568f8ULL, 0x5e4567eeULL, 0xa465e644ULL, 0x8914d75cULL, 0x744e4304ULL},
+{0xcb7d6e35ULL, 0x9cd489fdULL, 0xc14cfd8ULL, 0xbe1c6b6ULL, 0xcb7d6e35ULL, 0x1bba1df1ULL, 0x8a0aa293ULL, 0xbe1c6b6ULL, 0xd798813ULL},
+{0xff91be26ULL, 0xfecf825ULL, 0x875f2becULL, 0x3a30c82eULL, 0xff91be26ULL, 0xa3151badULL, 0x31bfa9e9ULL, 0x3a30c82eULL, 0x2ce2c267ULL},
+{0x3f50620dULL, 0xe19208fbULL, 0xe5202f5dULL, 0xade0c6b0ULL, 0x3f50620dULL, 0xed9edf76ULL, 0xa54b5d3ULL, 0xade0c6b0ULL, 0x30f4f018ULL},
+{0xfe9cd80bULL, 0xa43e3624ULL, 0x33272608ULL, 0xc7ea9f1cULL, 0xfe9cd80bULL, 0x946b079eULL, 0xa2f22207ULL, 0xc7ea9f1cULL, 0xf9ee0738ULL},
+{0xfe7c44dULL, 0x4ea177b9ULL, 0x454cb45bULL, 0x4c226126ULL, 0xfe7c44dULL, 0x83fbff5fULL, 0xfe1269daULL, 0x4c226126ULL, 0x396f1a70ULL},
+{0xff3a404cULL, 0x2e28638eULL, 0x49931b10ULL, 0x628fb8ddULL, 0xff3a404cULL, 0x2748fb37ULL, 0xea8e6f48ULL, 0x628fb8ddULL, 0x5eda0c93ULL},
+{0x970a798aULL, 0xdfa41aeeULL, 0x477ffe5cULL, 0xdf6070f0ULL, 0x970a798aULL, 0xfd28ece3ULL, 0x7c17b5ceULL, 0xdf6070f0ULL, 0xe43d1ce3ULL},
+{0x36ca276bULL, 0xf7a70df9ULL, 0x431866edULL, 0xea6d74d9ULL, 0x36ca276bULL, 0x1c445f21ULL, 0x21ab8decULL, 0xea6d74d9ULL, 0x86f07041ULL},
+{0xcbdff6dULL, 0x4632277ULL, 0x21f98567ULL, 0x2d5bf328ULL, 0xcbdff6dULL, 0xb2dc3db4ULL, 0x394269c1ULL, 0x2d5bf328ULL, 0x542fcfebULL},
+{0x2cba48d9ULL, 0xbd4d641dULL, 0x5300296aULL, 0x99947701ULL, 0x2cba48d9ULL, 0xa7bab38dULL, 0x782d24deULL, 0x99947701ULL, 0x7c368aa2ULL},
+{0xd0a643d3ULL, 0x83a208f1ULL, 0xc6c369afULL, 0xa2e7e717ULL, 0xd0a643d3ULL, 0xd06af4afULL, 0xad597b4aULL, 0xa2e7e717ULL, 0xebfaa0b3ULL},
+{0xf4bb1386ULL, 0xaa0753adULL, 0xe522e55aULL, 0xfc0e85eaULL, 0xf4bb1386ULL, 0x8936d722ULL, 0xea85d0a3ULL, 0xfc0e85eaULL, 0xd312ade4ULL},
+{0xa598b4a5ULL, 0xf17f2d99ULL, 0xc81a5028ULL, 0x57e637d3ULL, 0xa598b4a5ULL, 0xda2b6da0ULL, 0x5a2ba003ULL, 0x57e637d3ULL, 0x42f81f10ULL},
+{0xd133eebcULL, 0x38353cedULL, 0x1dde7f9bULL, 0xe2d74090ULL, 0xd133eebcULL, 0x5de8a5d9ULL, 0x8d670e49ULL, 0xe2d74090ULL, 0x60689d0aULL},
+{0xa527a23cULL, 0xa6ddcaa2ULL, 0x37e23eb4ULL, 0x5901abf0ULL, 0xa527a23cULL, 0xd706df5aULL, 0x8a9b8993ULL, 0x5901abf0ULL, 0xf8dcc7b9ULL},
+{0xff34a4b7ULL, 0x3747c5c0ULL, 0xa63e16b2ULL, 0x77779a65ULL, 0xff34a4b7ULL, 0x4dbaea1dULL, 0x456d111cULL, 0x77779a65ULL, 0x714c5ab5ULL},
+{0x7c976e56ULL, 0x16098741ULL, 0xe2d052a1ULL, 0xac45c33eULL, 0x7c976e56ULL, 0x30c2ab5bULL, 0xf34698e2ULL, 0xac45c33eULL, 0x7ffbe575ULL},
+{0x81f99a16ULL, 0x8c7db09fULL, 0xc0c628adULL, 0x8e898c9bULL, 0x81f99a16ULL, 0xfc0e0f4dULL, 0x3bbd7cd8ULL, 0x8e898c9bULL, 0x868d130eULL},
+{0x57059654ULL, 0xb1e47bedULL, 0x3fb8026eULL, 0x82a7c412ULL, 0x57059654ULL, 0xd175e821ULL, 0xc2cfb815ULL, 0x82a7c412ULL, 0x9b084fa5ULL},
+{0xc8c2be23ULL, 0xf8680dd4ULL, 0x29329804ULL, 0x56350e94ULL, 0xc8c2be23ULL, 0x191e6c65ULL, 0x7100b42bULL, 0x56350e94ULL, 0x9976d931ULL},
+{0xe9c46234ULL, 0xe0c119fULL, 0x174e7522ULL, 0xa808aa45ULL, 0xe9c46234ULL, 0x9742dbc1ULL, 0x17147147ULL, 0xa808aa45ULL, 0x788f7749ULL},
+{0xca8a904aULL, 0x36122f31ULL, 0xca75b14bULL, 0x7bae2565ULL, 0xca8a904aULL, 0xc8f55fc9ULL, 0xfabe67d8ULL, 0x7bae2565ULL, 0x4f04de41ULL},
+{0xc1f899feULL, 0xf177a200ULL, 0x7de9e4acULL, 0xf8421fafULL, 0xc1f899feULL, 0x614998d4ULL, 0x514f0c0dULL, 0xf8421fafULL, 0xd1544b1fULL},
+{0x40da80d0ULL, 0x8fcb3f96ULL, 0x54872600ULL, 0xa54c7e8eULL, 0x40da80d0ULL, 0x37e9f72aULL, 0xe2038a68ULL, 0xa54c7e8eULL, 0x99085066ULL},
+{0x8a8d5d9eULL, 0x66495f54ULL, 0xa5fc2eULL, 0xa5dcb67aULL, 0x8a8d5d9eULL, 0xb4c1a4b4ULL, 0xb1a56679ULL, 0xa5dcb67aULL, 0xadf75370ULL},
+{0x853aee69ULL, 0x30a7b2f6ULL, 0xc61d21e4ULL, 0x2a6473c4ULL, 0x853aee69ULL, 0xce3982f9ULL, 0x84bdd63eULL, 0x2a6473c4ULL, 0x92b6a9d9ULL},
+{0x57162683ULL, 0xab01084aULL, 0xb104f6f4ULL, 0x53ec1e01ULL, 0x57162683ULL, 0xd00d332eULL, 0x7427c234ULL, 0x53ec1e01ULL, 0xa3feb5e8ULL},
+{0x348d8cedULL, 0xd6f42298ULL, 0xbdf22cebULL, 0xaf75430eULL, 0x348d8cedULL, 0xa80b4f7aULL, 0xa3dbe7d7ULL, 0xaf75430eULL, 0x7afcb7efULL},
+{0x372166d0ULL, 0xf300d28dULL, 0x9cf5e0a4ULL, 0xb0ca1bd6ULL, 0x372166d0ULL, 0xb9574b00ULL, 0x68ba9a38ULL, 0xb0ca1bd6ULL, 0x20e5933fULL},
+{0xc7f0bf05ULL, 0xf532fbcULL, 0x9ef77d41ULL, 0x32f58744ULL, 0xc7f0bf05ULL, 0xcd20bef9ULL, 0x5982a8eeULL, 0x32f58744ULL, 0x74c77551ULL},
+{0x889d06fbULL, 0x23880e31ULL, 0xfe9f351aULL, 0xe24b9d6fULL, 0x889d06fbULL, 0xb25f04c7ULL, 0x14418841ULL, 0xe24b9d6fULL, 0xad58327dULL},
+{0x775f42e7ULL, 0x69d4eaceULL, 0x560e2992ULL, 0x1ef3228fULL, 0x775f42e7ULL, 0x7dfba96ULL, 0xc5e4dee1ULL, 0x1ef3228fULL, 0x9f24d083ULL},
+{0xd19ec4ebULL, 0x59548573ULL, 0x77ace7c3ULL, 0xcccb0ee7ULL, 0xd19ec4ebULL, 0xd076e749ULL, 0xcedbb4f6ULL, 0xcccb0ee7ULL, 0x1d06fc88ULL},
+{0x710e8e58ULL, 0x338c4de0ULL, 0xdbdac995ULL, 0xfa98c11ULL, 0x710e8e58ULL, 0x963c7147ULL, 0x29891dc9ULL, 0xfa98c11ULL, 0x59da48d0ULL},
+{0x2d842048ULL, 0x32be25cULL, 0xa71ba208ULL, 0x2b5d796aULL, 0x2d842048ULL, 0xb359f6f4ULL, 0xe28922a3ULL, 0x2b5d796aULL, 0xa0c8308aULL},
+{0x76a6622cULL, 0xd0d3d5c0ULL, 0xe80672bdULL, 0x412139e1ULL, 0x76a6622cULL, 0xa5d76173ULL, 0x76f16fbcULL, 0x412139e1ULL, 0xac67c69eULL},
+{0xb3a1f42bULL, 0x2169fbfdULL, 0xb3354fcfULL, 0x6e3d904fULL, 0xb3a1f42bULL, 0x7f34e950ULL, 0x2d081669ULL, 0x6e3d904fULL, 0x16457bbcULL},
+{0xddf0dc01ULL, 0xf0dbe6daULL, 0xe2d9d424ULL, 0xdeaf5584ULL, 0xddf0dc01ULL, 0x933585a9ULL, 0x91608135ULL, 0xdeaf5584ULL, 0x1371ff9bULL},
+{0x5bf45471ULL, 0xa494e6c8ULL, 0xe332b06eULL, 0x7929e8d8ULL, 0x5bf45471ULL, 0xac042a26ULL, 0x8498ef81ULL, 0x7929e8d8ULL, 0x1621b26aULL},
+{0xf1379ad1ULL, 0x2a248fb7ULL, 0x3859b3dULL, 0x20eb350fULL, 0xf1379ad1ULL, 0xc8bb2a05ULL, 0x5ce6f056ULL, 0x20eb350fULL, 0xd31c406fULL},
+{0x76eae3b2ULL, 0xf7eefe58ULL, 0x16466763ULL, 0xfaf0f182ULL, 0x76eae3b2ULL, 0xabb64ab5ULL, 0x1f3cb91fULL, 0xfaf0f182ULL, 0x41945e70ULL},
+{0xc20909ULL, 0x8b2c1000ULL, 0xd62043a4ULL, 0x66326ea4ULL, 0xc20909ULL, 0x4c5c3215ULL, 0x144f0007ULL, 0x66326ea4ULL, 0xe4e31cbaULL},
+{0xbf7da80aULL, 0xcc28f7c1ULL, 0x1b67b30bULL, 0x30cd6dcdULL, 0xbf7da80aULL, 0x87e9843fULL, 0xedf1d381ULL, 0x30cd6dcdULL, 0x1b1570cdULL},
+{0xa54f5267ULL, 0x81e3e65fULL, 0x16ec4f01ULL, 0x4ed7841bULL, 0xa54f5267ULL, 0xde982117ULL, 0x736cd15bULL, 0x4ed7841bULL, 0x5e3cdad1ULL},
+{0x6d26443bULL, 0xf760b016ULL, 0x373c20b4ULL, 0x7672fc4aULL, 0x6d26443bULL, 0xc8ca0371ULL, 0xcf557f47ULL, 0x7672fc4aULL, 0xdb637f3cULL},
+{0x1aa95c01ULL, 0x33575747ULL, 0x18bf8c40ULL, 0xa281b7dcULL, 0x1aa95c01ULL, 0x31f2a7fdULL, 0x7a99509fULL, 0xa281b7dcULL, 0x71876523ULL},
+{0x807c7766ULL, 0x4f84a4feULL, 0x47f0b382ULL, 0xbf0690d9ULL, 0x807c7766ULL, 0xcee5d7d2ULL, 0x70e25685ULL, 0xbf0690d9ULL, 0xf4418d49ULL},
+{0x79a0a688ULL, 0x2c99a271ULL, 0xee04b572ULL, 0x4811df2dULL, 0x79a0a688ULL, 0xf9823c4bULL, 0x403911d2ULL, 0x4811df2dULL, 0xcf764b08ULL},
+{0x33045ee5ULL, 0xad4021e1ULL, 0x5ec4bdbfULL, 0x9968fb14ULL, 0x33045ee5ULL, 0x27d50833ULL, 0xf2287f47ULL, 0x9968fb14ULL, 0x1685c1ffULL},
+{0x621e68a4ULL, 0x95eb4f33ULL, 0x9c8e1a2fULL, 0x219f7feULL, 0x621e68a4ULL, 0xe4016b26ULL, 0x27dc7d1ULL, 0x219f7feULL, 0xbdd259a2ULL},
+{0xa170424aULL, 0xd5e518b3ULL, 0xa714a3b0ULL, 0x6df80cbcULL, 0xa170424aULL, 0x387180d8ULL, 0x4b3e1358ULL, 0x6df80cbcULL, 0x286a8b7cULL},
+{0x41238f26ULL, 0x68df38ebULL, 0xb2100284ULL, 0x7101885cULL, 0x41238f26ULL, 0x78c33f0dULL, 0xad598414ULL, 0x7101885cULL, 0x93b8cad9ULL},
+{0x8fb31c6aULL, 0x25bf81e1ULL, 0x312aad7aULL, 0xc22c1be4ULL, 0x8fb31c6aULL, 0x81bb621dULL, 0x1890ac60ULL, 0xc22c1be4ULL, 0x89ddd86bULL},
+{0x36cfa474ULL, 0x468e5bf0ULL, 0xc3c1697eULL, 0x279246ecULL, 0x36cfa474ULL, 0x7b63259fULL, 0xc9e88696ULL, 0x279246ecULL, 0xd988dac4ULL},
+{0xe70e35fULL, 0x51319ba8ULL, 0x3d78fe1bULL, 0x34db9e1bULL, 0xe70e35fULL, 0x1da0b57fULL, 0x2115183dULL, 0x34db9e1bULL, 0xc04a6081ULL},
+{0xf38654a6ULL, 0xd4c04a21ULL, 0xf8893776ULL, 0x24542e6bULL, 0xf38654a6ULL, 0x5fd860d1ULL, 0x6c7dcf6ULL, 0x24542e6bULL, 0x84aa61c7ULL},
+{0x90b57a4aULL, 0x16591e96ULL, 0x551fa259ULL, 0x9d301c30ULL, 0x90b57a4aULL, 0x5eda477dULL, 0x28fe38c4ULL, 0x9d301c30ULL, 0x711f3345ULL},
+{0x65d62954ULL, 0x5f8f80a4ULL, 0x6c583c2eULL, 0x5f53e260ULL, 0x65d62954ULL, 0x3ad6f1b6ULL, 0x31ffee1ULL, 0x5f53e260ULL, 0x979fe200ULL},
+{0x1946f16ULL, 0xeee3d57ULL, 0x3fdfc437ULL, 0xc1fc192ULL, 0x1946f16ULL, 0x416f6da7ULL, 0xa9c0afdfULL, 0xc1fc192ULL, 0xc95375bbULL},
+{0x682b335cULL, 0x2d9a5abbULL, 0x1e614e59ULL, 0x392e205fULL, 0x682b335cULL, 0x6d215f80ULL, 0xd867bdabULL, 0x392e205fULL, 0x93ddd085ULL},
+{0x3b2836cdULL, 0x2bcbcab0ULL, 0xd9e9d2a0ULL, 0x66bfdccfULL, 0x3b2836cdULL, 0x9c9a2986ULL, 0xca9651b2ULL, 0x66bfdccfULL, 0xa0af5389ULL},
+{0x74be3e81ULL, 0x9d4507b6ULL, 0x3b8db7b3ULL, 0x8e2ab10dULL, 0x74be3e81ULL, 0x462ace2eULL, 0x5c154a06ULL, 0x8e2ab10dULL, 0xbef793c7ULL},
+{0xd2d1ead2ULL, 0xcda91e1fULL, 0xd41a2ca2ULL, 0x8b4f60bdULL, 0xd2d1ead2ULL, 0x8a080b05ULL, 0xba00d079ULL, 0x8b4f60bdULL, 0xeeea7688ULL},
+{0x13156919ULL, 0x79009b0bULL, 0x789863bfULL, 0xf74345eaULL, 0x13156919ULL, 0xc435fff9ULL, 0xe107eb5aULL, 0xf74345eaULL, 0xe6db2eaeULL},
+{0xfc13d694ULL, 0x4e2598d6ULL, 0x7643c1c5ULL, 0xba46d5f2ULL, 0xfc13d694ULL, 0x4018fa1dULL, 0x91147c63ULL, 0xba46d5f2ULL, 0xc53d9e8dULL},
+{0x8d165647ULL, 0xaa76f6bbULL, 0x809990ebULL, 0x3a524d2bULL, 0x8d165647ULL, 0x64cbe3b3ULL, 0xc0ac3fdbULL, 0x3a524d2bULL, 0x8d080c2cULL},
+{0xb35be766ULL, 0x97b5f855ULL, 0xf416f455ULL, 0x59123019ULL, 0xb35be766ULL, 0x41aadc8dULL, 0xb2d92b4aULL, 0x59123019ULL, 0xf6a5e88eULL},
+{0x3d89e3a8ULL, 0xf406531fULL, 0xf493ac7bULL, 0x347325bULL, 0x3d89e3a8ULL, 0xb3f05f5bULL, 0x4f56920bULL, 0x347325bULL, 0x969fd6b5ULL},
+{0xb980df8fULL, 0xf4731607ULL, 0xaaa3fb18ULL, 0xf6958ab0ULL, 0xb980df8fULL, 0x5570e319ULL, 0x51cc0181ULL, 0xf6958ab0ULL, 0x27eb2d01ULL},
+{0x5d561b54ULL, 0x4210d541ULL, 0xa7f665a9ULL, 0x3a5b652ULL, 0x5d561b54ULL, 0x2a31753fULL, 0x32f6c10bULL, 0x3a5b652ULL, 0x57f037c8ULL},
+{0x2f52288dULL, 0x57ea7076ULL, 0xefc9308bULL, 0x42920405ULL, 0x2f52288dULL, 0xf5bfbbd3ULL, 0xaada5bcfULL, 0x42920405ULL, 0xa55d9154ULL},
+{0xae0d62d4ULL, 0x75248b2eULL, 0x4629bf33ULL, 0x7f4557a3ULL, 0xae0d62d4ULL, 0x39c49338ULL, 0x11a52439ULL, 0x7f4557a3ULL, 0xfe61e313ULL},
+{0x8261f95ULL, 0x734595a3ULL, 0x4fa489e2ULL, 0x72fd0f0bULL, 0x8261f95ULL, 0xbe5a10c6ULL, 0xf7517d4eULL, 0x72fd0f0bULL, 0x3e2b615fULL},
+{0xfd0d1d0dULL, 0x55c17796ULL, 0x9e88a7a4ULL, 0x267c2393ULL, 0xfd0d1d0dULL, 0xc65257dbULL, 0x5586f18cULL, 0x267c2393ULL, 0xfdd538d5ULL},
+{0x73d9e27eULL, 0xef7f9112ULL, 0x7c793f9cULL, 0xac7cba95ULL, 0x73d9e27eULL, 0x8027542eULL, 0x583dd23dULL, 0xac7cba95ULL, 0x7bb95972ULL},
+{0x6b91abdcULL, 0xce3eeda7ULL, 0x3c8f502dULL, 0x4b2486c4ULL, 0x6b91abdcULL, 0x4e7fbd39ULL, 0xf392b347ULL, 0x4b2486c4ULL, 0x7456dc5aULL},
+{0x1d6ab046ULL, 0x4ff8180dULL, 0x855765b1ULL, 0x99bd13ebULL, 0x1d6ab046ULL, 0x4ea355c9ULL, 0x82b97e6fULL, 0x99bd13ebULL, 0xb944899aULL},
+{0x8fec71b8ULL, 0x45c58b61ULL, 0xf8e264fcULL, 0x1be69410ULL, 0x8fec71b8ULL, 0xc3f2c03aULL, 0x4cf16c78ULL, 0x1be69410ULL, 0xfbcddc78ULL},
+{0xb3dacd58ULL, 0x2ecbde30ULL, 0xa5db94c7ULL, 0x9deafc80ULL, 0xb3dacd58ULL, 0x35c3947cULL, 0x723d1631ULL, 0x9deafc80ULL, 0x62689a0ULL},
+{0xb30e45dfULL, 0x559892b3ULL, 0x1b879802ULL, 0x29ab5ecbULL, 0xb30e45dfULL, 0xd78b5b55ULL, 0xd002c905ULL, 0x29ab5ecbULL, 0xa0494d07ULL},
+{0x15afa5d9ULL, 0x8c5cfbdULL, 0x5c1d7531ULL, 0xe34d9ea0ULL, 0x15afa5d9ULL, 0xc36531f1ULL, 0xbf61e04dULL, 0xe34d9ea0ULL, 0xdfb80d79ULL},
+{0xeb9ec01bULL, 0xc5313c29ULL, 0x254ce058ULL, 0x3d8c541aULL, 0xeb9ec01bULL, 0x82d98f45ULL, 0x1b2342b3ULL, 0x3d8c541aULL, 0xd5ff3c7cULL},
+{0x2f7e7fa5ULL, 0xb3ad1a30ULL, 0xc58d7a6fULL, 0x7f0d0671ULL, 0x2f7e7fa5ULL, 0xcac17b73ULL, 0x71f984a8ULL, 0x7f0d0671ULL, 0xec8b4607ULL},
+{0x4441d2f0ULL, 0xd2b2f4f6ULL, 0x68a9143aULL, 0x32d4bd85ULL, 0x4441d2f0ULL, 0x8db7e24bULL, 0x93ea17c4ULL, 0x32d4bd85ULL, 0x41366b9ULL},
+{0xe14c419bULL, 0x8d528002ULL, 0x41a02d67ULL, 0x24c21178ULL, 0xe14c419bULL, 0xcc945294ULL, 0x1d4851bcULL, 0x24c21178ULL, 0xa217de9ULL},
+{0xb9cb1d0fULL, 0x6d3edeadULL, 0x1a4f6254ULL, 0x9a89ccc6ULL, 0xb9cb1d0fULL, 0x687c59b2ULL, 0xa31d97f0ULL, 0x9a89ccc6ULL, 0x5b4c837cULL},
+{0x64dd7c0bULL, 0xcff1e4feULL, 0x1cc01caeULL, 0x44c920a7ULL, 0x64dd7c0bULL, 0x548d0a59ULL, 0x6c427892ULL, 0x44c920a7ULL, 0x7c558ae6ULL},
+{0x246d11beULL, 0xc5fac9c2ULL, 0x47b746ecULL, 0xb1c8a10cULL, 0x246d11beULL, 0xf66cf668ULL, 0xd269ccabULL, 0xb1c8a10cULL, 0x3a4b9430ULL},
+{0xca72ea74ULL, 0x73a9a1fULL, 0x5da483c8ULL, 0x767ed90bULL, 0xca72ea74ULL, 0x107d82b8ULL, 0xd909dac8ULL, 0x767ed90bULL, 0x2c2bcb23ULL},
+{0xe84ef031ULL, 0xe8dfb0fbULL, 0xbb43eca9ULL, 0xb1137a58ULL, 0xe84ef031ULL, 0xe1d5e6bcULL, 0xe5ae8578ULL, 0xb1137a58ULL, 0xed90237fULL},
+{0x2121be1eULL, 0x605044fdULL, 0x2d557859ULL, 0x611dde6eULL, 0x2121be1eULL, 0x4423d8b6ULL, 0xada9f4d7ULL, 0x611dde6eULL, 0x678ee92aULL},
+{0x2b87b3eaULL, 0xdb44c505ULL, 0xf5310087ULL, 0xb48b1df8ULL, 0x2b87b3eaULL, 0x3817ed90ULL, 0xa3cbe255ULL, 0xb48b1df8ULL, 0x8c31dda2ULL},
+{0x6f9a7485ULL, 0x90ba80feULL, 0x2f591fb8ULL, 0x2e846fcbULL, 0x6f9a7485ULL, 0xdc9ec80eULL, 0x1cd160cdULL, 0x2e846fcbULL, 0xb915065aULL},
+{0x5e2538cULL, 0xc7dd1316ULL, 0x99dbd947ULL, 0xb8d8c5f5ULL, 0x5e2538cULL, 0x49efd25ULL, 0x65c16096ULL, 0xb8d8c5f5ULL, 0xfc6201b7ULL},
+{0x93d25427ULL, 0x68a96d15ULL, 0x4e1376cULL, 0x561b7bfeULL, 0x93d25427ULL, 0x8e080312ULL, 0xcf143d3dULL, 0x561b7bfeULL, 0x6b266aadULL},
+{0xa8ae30dfULL, 0xec4aa01ULL, 0xa1191fd5ULL, 0xfbd8019cULL, 0xa8ae30dfULL, 0x93e913fbULL, 0x66509b54ULL, 0xfbd8019cULL, 0x6e2327aaULL},
+{0xcedf62c1ULL, 0x231d30e1ULL, 0xdc6cf501ULL, 0x1f5ac2e0ULL, 0xcedf62c1ULL, 0x4cb390d5ULL, 0xda280393ULL, 0x1f5ac2e0ULL, 0x18689277ULL},
+{0xe0346ad0ULL, 0x878581adULL, 0xc1827d8bULL, 0xdc00aa46ULL, 0xe0346ad0ULL, 0x2d74d0c4ULL, 0xd554663fULL, 0xdc00aa46ULL, 0x1eb8450eULL},
+{0x4efb8550ULL, 0xfcaebc2cULL, 0x91dc8324ULL, 0xfabaaab1ULL, 0x4efb8550ULL, 0x9a827218ULL, 0x92ddb97cULL, 0xfabaaab1ULL, 0xc740ee47ULL},
+{0xe7ed70b0ULL, 0x1046ce0dULL, 0xbf510c0fULL, 0xaea80928ULL, 0xe7ed70b0ULL, 0xaa301387ULL, 0xf308b135ULL, 0xaea80928ULL, 0x2a2b268dULL},
+{0x96093d8bULL, 0x6d4cd02bULL, 0x69824d2ULL, 0xc4a58ea4ULL, 0x96093d8bULL, 0x45de3516ULL, 0x4d9aed88ULL, 0xc4a58ea4ULL, 0x3417f129ULL},
+{0x874201e9ULL, 0x7c0ae8dULL, 0xfe29d5dULL, 0x49077e9fULL, 0x874201e9ULL, 0x61b45548ULL, 0x138a7651ULL, 0x49077e9fULL, 0xe5502fc1ULL},
+{0x2095f34bULL, 0x5de44bbbULL, 0xf31394efULL, 0xc62ac717ULL, 0x2095f34bULL, 0xe2060b7eULL, 0xa236ad8ULL, 0xc62ac717ULL, 0xbd8b60e0ULL},
+{0xbdb3e2cdULL, 0xce2d0fbULL, 0x8a1b43b2ULL, 0xbcc33fc6ULL, 0xbdb3e2cdULL, 0xe82cf67fULL, 0xc5b4da29ULL, 0xbcc33fc6ULL, 0xa54a5306ULL},
+{0x815eb7d3ULL, 0xf6ae9e0aULL, 0xfc417785ULL, 0x1faaafc1ULL, 0x815eb7d3ULL, 0xd90fabb8ULL, 0xc0d36ab1ULL, 0x1faaafc1ULL, 0xa7f794fdULL},
+{0xad47e4dcULL, 0x35fe5367ULL, 0xb5ab18c5ULL, 0x557e54f2ULL, 0xad47e4dcULL, 0xd3be8f68ULL, 0x87a4063bULL, 0x557e54f2ULL, 0xd947fbc0ULL},
+{0xb5578e2fULL, 0x1aa414dfULL, 0x553f2d28ULL, 0xf38cba99ULL, 0xb5578e2fULL, 0x53842800ULL, 0x1d70b99bULL, 0xf38cba99ULL, 0x47c52ecaULL},
+{0x1dbf4361ULL, 0x698d1291ULL, 0xbaa1fa42ULL, 0x972a902aULL, 0x1dbf4361ULL, 0x96bd1f76ULL, 0xfc933ea2ULL, 0x972a902aULL, 0x41eb59ULL},
+{0xcea020fcULL, 0x7aeea06cULL, 0x85d07e6fULL, 0x762db71ULL, 0xcea020fcULL, 0x653b1efbULL, 0x7ee671c5ULL, 0x762db71ULL, 0x4e500341ULL},
+{0x20fae7aaULL, 0x99c81c39ULL, 0x7d5efe15ULL, 0xe3cb9f07ULL, 0x20fae7aaULL, 0xc7d1cdceULL, 0xc63b4e21ULL, 0xe3cb9f07ULL, 0x488ef9b1ULL},
+{0xc643de45ULL, 0x42dca3f0ULL, 0x8ab05526ULL, 0x2de1ad81ULL, 0xc643de45ULL, 0x3af83459ULL, 0x6b146992ULL, 0x2de1ad81ULL, 0xbd6047a1ULL},
+{0x87dde9b1ULL, 0xe5224a0eULL, 0x971c03d8ULL, 0x726f0d48ULL, 0x87dde9b1ULL, 0xbbdcc46aULL, 0x3154164fULL, 0x726f0d48ULL, 0x11ad039ULL},
+{0x7851e754ULL, 0xe3bbe91bULL, 0x3b6d6300ULL, 0xb61274c8ULL, 0x7851e754ULL, 0x42e3414bULL, 0x69bb276bULL, 0xb61274c8ULL, 0xbd34fc63ULL},
+{0x450e25d9ULL, 0x326f6b63ULL, 0x1d166d59ULL, 0x1b086e87ULL, 0x450e25d9ULL, 0x9e13fe20ULL, 0xfb1e1eeaULL, 0x1b086e87ULL, 0x7d6e8817ULL},
+{0xa7cb64e3ULL, 0x3369630cULL, 0xff8b6410ULL, 0x6db6e6daULL, 0xa7cb64e3ULL, 0x37395a70ULL, 0x7cb042a0ULL, 0x6db6e6daULL, 0x2306b160ULL},
+{0x8ff1e71dULL, 0x9bd6c85cULL, 0x2683297fULL, 0x937e872ULL, 0x8ff1e71dULL, 0x62fc0526ULL, 0xf2e8884dULL, 0x937e872ULL, 0xf57d9c8ULL},
+{0xdffb04f7ULL, 0x34849387ULL, 0x3b2dd21fULL, 0x1b33187fULL, 0xdffb04f7ULL, 0xd293def6ULL, 0x35807d68ULL, 0x1b33187fULL, 0x5ed9c7afULL},
+{0xb070c505ULL, 0xd63f7afULL, 0x22e76eeaULL, 0x916df4e1ULL, 0xb070c505ULL, 0x1bb5344cULL, 0x47f76dc7ULL, 0x916df4e1ULL, 0x656d31afULL},
+{0x664626c0ULL, 0xeea5f8f2ULL, 0xcef2677eULL, 0xbd7b0d26ULL, 0x664626c0ULL, 0x83081da3ULL, 0x72b32907ULL, 0xbd7b0d26ULL, 0x2099f3bcULL},
+{0xe53528ceULL, 0x9d6af55eULL, 0xf479c9cbULL, 0x5f6ebb1cULL, 0xe53528ceULL, 0xf770bb05ULL, 0x208bfc0aULL, 0x5f6ebb1cULL, 0x4fc211a8ULL},
+{0xa0c5d433ULL, 0x5a037938ULL, 0x53200944ULL, 0xfd623708ULL, 0xa0c5d433ULL, 0xe178a040ULL, 0x9fb38f5fULL, 0xfd623708ULL, 0xb601f406ULL},
+{0x6b997e30ULL, 0x81a2e927ULL, 0x7dc374e8ULL, 0xd1925c97ULL, 0x6b997e30ULL, 0x7fd5917dULL, 0x412e48f0ULL, 0xd1925c97ULL, 0x376f8f8eULL},
+{0xc80f79ecULL, 0xa5b1915bULL, 0x7dd1b2a2ULL, 0xfc28deb3ULL, 0xc80f79ecULL, 0x4ac5cec8ULL, 0x211b7c3fULL, 0xfc28deb3ULL, 0xf0a2912eULL},
+{0x76b4dac0ULL, 0xa6e430beULL, 0xd6e2d928ULL, 0xf046f8b2ULL, 0x76b4dac0ULL, 0xf4e3c4d9ULL, 0xee542b79ULL, 0xf046f8b2ULL, 0xa6c365dULL},
+{0xfa7c45f2ULL, 0x821b060bULL, 0x6f246d7eULL, 0x2d848946ULL, 0xfa7c45f2ULL, 0x430d69fbULL, 0xb75a47c1ULL, 0x2d848946ULL, 0xa8be37e5ULL},
+{0x5d34380eULL, 0xa7b5f518ULL, 0x4c8fa057ULL, 0x79ef8909ULL, 0x5d34380eULL, 0x9a43609cULL, 0x8fb5a00bULL, 0x79ef8909ULL, 0x1601cf4eULL},
+{0xe0e17220ULL, 0xa323c4a5ULL, 0x8d6987dcULL, 0x3ac4b95aULL, 0xe0e17220ULL, 0x95431617ULL, 0x1ba60ad4ULL, 0x3ac4b95aULL, 0x47b54d65ULL},
+{0xe0adcde0ULL, 0x3ba34bd7ULL, 0x63833ac6ULL, 0x3a06d036ULL, 0xe0adcde0ULL, 0x4520ed42ULL, 0xd956145aULL, 0x3a06d036ULL, 0xa4586e0aULL},
+{0xd2eb3e0ULL, 0xb678ada3ULL, 0xa433b0deULL, 0xb4911c0aULL, 0xd2eb3e0ULL, 0x198f52efULL, 0x47b6c7acULL, 0xb4911c0aULL, 0xcd60d782ULL},
+{0x95a8e70eULL, 0x80585d32ULL, 0x85482170ULL, 0xe18d6603ULL, 0x95a8e70eULL, 0x96967acbULL, 0x2845244eULL, 0xe18d6603ULL, 0x5ca4ffdfULL},
+{0x98c1cb9ULL, 0x15a58deaULL, 0x6a84267cULL, 0xba67227bULL, 0x98c1cb9ULL, 0x807102e7ULL, 0x600e3f2fULL, 0xba67227bULL, 0x44bb069eULL},
+{0xde8f8f9fULL, 0xe299941cULL, 0xf8311a3bULL, 0xee1e6fd4ULL, 0xde8f8f9fULL, 0xac6e49fULL, 0x8133c10eULL, 0xee1e6fd4ULL, 0x104996f7ULL},
+{0x23fd3516ULL, 0xe38b7735ULL, 0x8990cc2bULL, 0x95942ae1ULL, 0x23fd3516ULL, 0xfb312993ULL, 0x5921a6ULL, 0x95942ae1ULL, 0xc41d7877ULL},
+{0x899879ffULL, 0x2aed8bfbULL, 0x6c9f3451ULL, 0x2576552dULL, 0x899879ffULL, 0x61920068ULL, 0x12e7fb37ULL, 0x2576552dULL, 0x82805cf3ULL},
+{0x1799e011ULL, 0x1c6d8deaULL, 0x5a6bf1f7ULL, 0x36dd7089ULL, 0x1799e011ULL, 0xbb980c5cULL, 0x5b38d0b6ULL, 0x36dd7089ULL, 0x535fc17fULL},
+{0xeec620d9ULL, 0x395c0ba4ULL, 0x5f2cb82cULL, 0x93e7e05ULL, 0xeec620d9ULL, 0xce941696ULL, 0x3b5a0e37ULL, 0x93e7e05ULL, 0x323d1597ULL},
+{0xc1776921ULL, 0x7ea10287ULL, 0x2fc69b73ULL, 0x7ca8e122ULL, 0xc1776921ULL, 0x37236965ULL, 0x5d806ad6ULL, 0x7ca8e122ULL, 0x97373215ULL},
+{0xc3c456eeULL, 0xa7829819ULL, 0x5db9a00aULL, 0xf7cb40efULL, 0xc3c456eeULL, 0xa52bb17cULL, 0x12805ddaULL, 0xf7cb40efULL, 0xc2ab05beULL},
+{0x574b40fdULL, 0x159b39dULL, 0x4f5a7ee8ULL, 0xf489e019ULL, 0x574b40fdULL, 0x3267d404ULL, 0xfc7d3ff5ULL, 0xf489e019ULL, 0x1122373ULL},
+{0xc32c1817ULL, 0x2657d64bULL, 0xd2d8b76fULL, 0x65a157d3ULL, 0xc32c1817ULL, 0xe7aa322cULL, 0x957d98fbULL, 0x65a157d3ULL, 0xe4ce31cbULL},
+{0x6b142e0cULL, 0xd062ae2aULL, 0xb80cd382ULL, 0xac075db9ULL, 0x6b142e0cULL, 0x37afc19dULL, 0x3fadd46bULL, 0xac075db9ULL, 0x226778b2ULL},
+{0x11bb57d8ULL, 0x20b556baULL, 0x531141e4ULL, 0x1186ce76ULL, 0x11bb57d8ULL, 0xad1c3c2fULL, 0x39b8c917ULL, 0x1186ce76ULL, 0x93cce033ULL},
+{0x98d7bb17ULL, 0xef0c9d38ULL, 0x748abd27ULL, 0x51c1e80ULL, 0x98d7bb17ULL, 0x58e22021ULL, 0x6ac35423ULL, 0x51c1e80ULL, 0xab803a77ULL},
+{0x4a907771ULL, 0x71ec7918ULL, 0xe6cb5360ULL, 0x9cf4f060ULL, 0x4a907771ULL, 0x4ce81c72ULL, 0xeff65cd3ULL, 0x9cf4f060ULL, 0x9bd99971ULL},
+{0x7dc0b177ULL, 0xdb1bac7eULL, 0xe6248a06ULL, 0xb9fbf932ULL, 0x7dc0b177ULL, 0xf3d49245ULL, 0xa8c56a05ULL, 0xb9fbf932ULL, 0xb889bebcULL},
+{0xb7ebc9bULL, 0xba70fcc5ULL, 0xc4c9a972ULL, 0xbaa6ac95ULL, 0xb7ebc9bULL, 0x58ea3834ULL, 0x2426522fULL, 0xbaa6ac95ULL, 0x47ee7d34ULL},
+{0x85bf31acULL, 0x54ad1b8eULL, 0x26e86f94ULL, 0x87aba73ULL, 0x85bf31acULL, 0x709083afULL, 0xcccf5c7eULL, 0x87aba73ULL, 0x73a7cad7ULL},
+{0x1f0d75e1ULL, 0x4940ed92ULL, 0x10beaf3eULL, 0xd2ed2abbULL, 0x1f0d75e1ULL, 0x5e1ea365ULL, 0x6a8d0f20ULL, 0xd2ed2abbULL, 0x5841a0f9ULL},
+{0xd2c8d903ULL, 0x72f626b4ULL, 0x3cb75312ULL, 0x82efbb7aULL, 0xd2c8d903ULL, 0x1254d47cULL, 0xd7ffa6cfULL, 0x82efbb7aULL, 0xaf96673cULL},
+{0x6573dc76ULL, 0xc77cbb90ULL, 0x775fed3eULL, 0xb3d7ccaaULL, 0x6573dc76ULL, 0x821a6ca3ULL, 0x70c364deULL, 0xb3d7ccaaULL, 0x86e5ff90ULL},
+{0x2f1a49c3ULL, 0x73496338ULL, 0x1faa1289ULL, 0x85af59a3ULL, 0x2f1a49c3ULL, 0x84becfb0ULL, 0xba6a36dbULL, 0x85af59a3ULL, 0xbed54242ULL},
+{0xc52dc6cfULL, 0x9001926bULL, 0xb4e6f9c6ULL, 0xf0853c6eULL, 0xc52dc6cfULL, 0x41211416ULL, 0x3e7883cfULL, 0xf0853c6eULL, 0xc63626eaULL},
+{0x550bdc8eULL, 0x978b52bULL, 0xcd52396eULL, 0x93ca8af6ULL, 0x550bdc8eULL, 0xcf43be9ULL, 0x79f47e84ULL, 0x93ca8af6ULL, 0x8beb97dcULL},
+{0x6b1146d9ULL, 0x5793ef78ULL, 0x69c3bfb0ULL, 0x8b7ac12fULL, 0x6b1146d9ULL, 0xc7ac7d24ULL, 0x2b350264ULL, 0x8b7ac12fULL, 0x28695cacULL},
+{0x5f57bae5ULL, 0x4031b2a1ULL, 0x7b347d4ULL, 0x5922cf05ULL, 0x5f57bae5ULL, 0x90485ac7ULL, 0x6325cb53ULL, 0x5922cf05ULL, 0x3618a637ULL},
+{0x9c57b39bULL, 0xf728e5c1ULL, 0x3b475a6dULL, 0x2147393bULL, 0x9c57b39bULL, 0x237634c3ULL, 0xab1568baULL, 0x2147393bULL, 0x18d2e1caULL},
+{0x7a251ac2ULL, 0xeac154bbULL, 0x49bb92aeULL, 0x1142a571ULL, 0x7a251ac2ULL, 0xaeb4c1caULL, 0x8bb40068ULL, 0x1142a571ULL, 0xe5f0532eULL},
+{0xabe0874dULL, 0x6a98533aULL, 0x2f56876ULL, 0xd745857dULL, 0xabe0874dULL, 0x210f1cfcULL, 0x7fcad9c5ULL, 0xd745857dULL, 0x30cc2ae0ULL},
+{0x71e37d70ULL, 0xd904ff79ULL, 0x7b23885eULL, 0x31d79272ULL, 0x71e37d70ULL, 0x57062d12ULL, 0x4097dc00ULL, 0x31d79272ULL, 0xc2f3c534ULL},
+{0x2679c51bULL, 0x41241543ULL, 0x7ee822b7ULL, 0xd6347717ULL, 0x2679c51bULL, 0x89451861ULL, 0xcb813beeULL, 0xd6347717ULL, 0xc8084e37ULL},
+{0x96ad2258ULL, 0x419a4654ULL, 0x77e3fe15ULL, 0xb9f2719dULL, 0x96ad2258ULL, 0x372d4c8eULL, 0x95bad0a6ULL, 0xb9f2719dULL, 0x6325938ULL},
+{0xc6d5063cULL, 0xded0ba59ULL, 0xc21eda2ULL, 0xbc4a5035ULL, 0xc6d5063cULL, 0xf679b672ULL, 0x2b7a2857ULL, 0xbc4a5035ULL, 0x82b4f549ULL},
+{0x4384741ULL, 0x65a22e40ULL, 0x6696df29ULL, 0xc34782c2ULL, 0x4384741ULL, 0x8de56f38ULL, 0xf383684eULL, 0xc34782c2ULL, 0x7b6350fcULL},
+{0xa46572dbULL, 0x5000f9eaULL, 0xd7bb083cULL, 0xbf149ce1ULL, 0xa46572dbULL, 0x1002eff6ULL, 0x4d133556ULL, 0xbf149ce1ULL, 0x372c978bULL},
+{0xea3feec5ULL, 0xdb765c82ULL, 0xba9dca0ULL, 0xc2ff6cbaULL, 0xea3feec5ULL, 0x52c1a845ULL, 0xcbc06439ULL, 0xc2ff6cbaULL, 0x9f40fb36ULL},
+{0x5d5ef5a8ULL, 0xa4ea3b9aULL, 0xdb6f2dedULL, 0x896b6c8bULL, 0x5d5ef5a8ULL, 0xb3f34a37ULL, 0x4bca50aeULL, 0x896b6c8bULL, 0x333ec7bdULL},
+{0x9d96d91dULL, 0x3cc75332ULL, 0x90ccdad3ULL, 0x53820f18ULL, 0x9d96d91dULL, 0xcdca93a6ULL, 0x91f9fd35ULL, 0x53820f18ULL, 0x8ed7b528ULL},
+{0xd78f8d29ULL, 0xbe70a229ULL, 0xacf38e1eULL, 0xfdc0eddeULL, 0xd78f8d29ULL, 0xbf53fea5ULL, 0x984d239ULL, 0xfdc0eddeULL, 0x2c775e08ULL},
+{0x6b33e857ULL, 0x35596a8cULL, 0x3d636705ULL, 0xbc5756a8ULL, 0x6b33e857ULL, 0x308615d5ULL, 0xfbdc740fULL, 0xbc5756a8ULL, 0xaf18bc06ULL},
+{0x2ca28be0ULL, 0xa3ce9393ULL, 0xfccf921dULL, 0x36dd057dULL, 0x2ca28be0ULL, 0x919fdb39ULL, 0x84030699ULL, 0x36dd057dULL, 0x76df6dabULL},
+{0xff3b9430ULL, 0x7e348208ULL, 0xeb3def31ULL, 0x296fbddfULL, 0xff3b9430ULL, 0x453f0e9ULL, 0xeb80ac47ULL, 0x296fbddfULL, 0xc49621c4ULL},
+{0x21548135ULL, 0xd5e3ad62ULL, 0xfc91de99ULL, 0x9c95f823ULL, 0x21548135ULL, 0x5c11968ULL, 0x22166180ULL, 0x9c95f823ULL, 0xb401baf4ULL},
+{0x83953aa1ULL, 0xc45bedd0ULL, 0x88705af8ULL, 0xf5d0b8b8ULL, 0x83953aa1ULL, 0xae021a20ULL, 0xdee73f22ULL, 0xf5d0b8b8ULL, 0xa061fe1fULL},
+{0x81a4ea6fULL, 0xbb17745eULL, 0xe2653f51ULL, 0x2965b0eULL, 0x81a4ea6fULL, 0xcbd53f62ULL, 0x300dd6f2ULL, 0x2965b0eULL, 0x5dd43fb6ULL},
+{0xe2ad8ff5ULL, 0xc3bfec5cULL, 0xac3c11c6ULL, 0x586db64cULL, 0xe2ad8ff5ULL, 0x916db71fULL, 0x259da6c8ULL, 0x586db64cULL, 0x80812889ULL},
+{0xb871d146ULL, 0xd2214ea9ULL, 0xd1464beULL, 0xe778b33eULL, 0xb871d146ULL, 0xf1958872ULL, 0xcdff838eULL, 0xe778b33eULL, 0x73d1222eULL},
+{0x8676e620ULL, 0x7758b241ULL, 0xa53ac7baULL, 0x8cf58b28ULL, 0x8676e620ULL, 0xec3e5fb6ULL, 0x13f36d8fULL, 0x8cf58b28ULL, 0x9543103dULL},
+{0x9e3ee5dfULL, 0x57b6bb00ULL, 0xefc701f6ULL, 0xe48d88c7ULL, 0x9e3ee5dfULL, 0x6489421cULL, 0x40f647f0ULL, 0xe48d88c7ULL, 0x2f938ea8ULL},
+{0x55ef4822ULL, 0x9124da93ULL, 0xe1f0458dULL, 0x658a4e88ULL, 0x55ef4822ULL, 0xe39f1cc1ULL, 0xf365fae5ULL, 0x658a4e88ULL, 0x40f57d81ULL},
+{0xf42528a7ULL, 0xe70fcdadULL, 0xae72988cULL, 0x3715a5f6ULL, 0xf42528a7ULL, 0xad2201adULL, 0x85fb6bb4ULL, 0x3715a5f6ULL, 0xed2764b5ULL},
+{0x2c8504dfULL, 0xd103ad25ULL, 0x75e2aec0ULL, 0xe78baf69ULL, 0x2c8504dfULL, 0x3d4bc1ffULL, 0x3b17df41ULL, 0xe78baf69ULL, 0xcc3c5bc5ULL},
+{0xe3b0a576ULL, 0xd894add2ULL, 0xf0cbcbfeULL, 0xd77bfbd9ULL, 0xe3b0a576ULL, 0x72b2bed2ULL, 0x1f24266cULL, 0xd77bfbd9ULL, 0x6526b87bULL},
+{0x94f8127bULL, 0xd0f7b005ULL, 0x23e19fd4ULL, 0x29844eafULL, 0x94f8127bULL, 0x19eab115ULL, 0x729388cbULL, 0x29844eafULL, 0xe9b551e5ULL},
+{0x60be35ecULL, 0x79317d62ULL, 0x854bb869ULL, 0xce7d48d7ULL, 0x60be35ecULL, 0x75de00e8ULL, 0xc2d1874bULL, 0xce7d48d7ULL, 0x2177c9e8ULL},
+{0x7ceef107ULL, 0xff64c90fULL, 0xce270d0eULL, 0x98e31f27ULL, 0x7ceef107ULL, 0x6da1d147ULL, 0x9ac2c3eaULL, 0x98e31f27ULL, 0xbc0772c6ULL},
+{0x16d9ce3aULL, 0x266314b0ULL, 0x1b5c4958ULL, 0xe02a967aULL, 0x16d9ce3aULL, 0x3b1c2eULL, 0xcb0b73e1ULL, 0xe02a967aULL, 0xf8715689ULL},
+{0x3bee9256ULL, 0xc45b6435ULL, 0xc64df3c5ULL, 0x2a417356ULL, 0x3bee9256ULL, 0x6b63bde6ULL, 0x9deb61a5ULL, 0x2a417356ULL, 0xbbafb8d3ULL},
+{0xbfc6ee45ULL, 0xfcde787bULL, 0xcc663e08ULL, 0xd2034927ULL, 0xbfc6ee45ULL, 0x2a7f8bfaULL, 0x14077d77ULL, 0xd2034927ULL, 0x67038556ULL},
+{0x6061591bULL, 0x3d673e6eULL, 0x7a814498ULL, 0xbdb275e5ULL, 0x6061591bULL, 0x6088a9d8ULL, 0x428fc228ULL, 0xbdb275e5ULL, 0x2ca06e97ULL},
+{0x945df62bULL, 0x5b7841e3ULL, 0x645a461fULL, 0xddf98507ULL, 0x945df62bULL, 0xaa50d879ULL, 0x9fa78caaULL, 0xddf98507ULL, 0xa8049823ULL},
+{0xe4dc987fULL, 0x3d6a52bdULL, 0xf9681ee7ULL, 0x6812da50ULL, 0xe4dc987fULL, 0x54c11e33ULL, 0x4ab82cdbULL, 0x6812da50ULL, 0x3fe8df26ULL},
+{0x8aebf136ULL, 0x62f2bd5ULL, 0xba6e618cULL, 0xa9634d1bULL, 0x8aebf136ULL, 0xcf2b4d72ULL, 0xca627ec4ULL, 0xa9634d1bULL, 0x32579789ULL},
+{0xaa77170ULL, 0x4f3cc6b5ULL, 0x6b53dbccULL, 0xcae70193ULL, 0xaa77170ULL, 0xefc5811aULL, 0x555d2b53ULL, 0xcae70193ULL, 0xfd10477bULL},
+{0x46b8b9f4ULL, 0xe998d381ULL, 0x52e47fb1ULL, 0x222d43c5ULL, 0x46b8b9f4ULL, 0x1ec0faffULL, 0x52c13abcULL, 0x222d43c5ULL, 0xc6c1fbabULL},
+{0xf7f3da90ULL, 0xa5443295ULL, 0xfc1829b1ULL, 0xf0e5c360ULL, 0xf7f3da90ULL, 0x42ee17ULL, 0x3fd155cdULL, 0xf0e5c360ULL, 0xce73417bULL},
+{0x45fc9b2cULL, 0xd81601bULL, 0x57c0a20fULL, 0xc212a16bULL, 0x45fc9b2cULL, 0x7d8c167cULL, 0xc852f9f1ULL, 0xc212a16bULL, 0x8145bafcULL},
+{0xe5ffabbdULL, 0xd022f484ULL, 0xc0527aedULL, 0xd1d5d25aULL, 0xe5ffabbdULL, 0xf26aa443ULL, 0xed4f14d4ULL, 0xd1d5d25aULL, 0x51528ce5ULL},
+{0x851bdcafULL, 0xa0e25f59ULL, 0xf025a610ULL, 0x9ac41beeULL, 0x851bdcafULL, 0x9c695f6fULL, 0x27d3bebeULL, 0x9ac41beeULL, 0x1fe2451fULL},
+{0x82014979ULL, 0xa7b5e1d3ULL, 0xb7c2756fULL, 0xf7741d3fULL, 0x82014979ULL, 0x57fc961fULL, 0xea39179dULL, 0xf7741d3fULL, 0x9da96cc9ULL}},
+  {{0x5848729eULL, 0xf59dba54ULL, 0x40e210ecULL, 0xfd3124fULL, 0x5848729eULL, 0xaa783970ULL, 0x11fd0b9cULL, 0xfd3124fULL, 0x7364a62bULL},
+{0x7de06959ULL, 0xa7b44874ULL, 0x3bb15174ULL, 0x466dbe8ULL, 0x7de06959ULL, 0xed462ffeULL, 0xc67eea21ULL, 0x466dbe8ULL, 0x7345a2d2ULL},
+{0xfca6fe58ULL, 0x6ac45271ULL, 0xda2480ddULL, 0x2d120f6fULL, 0xfca6fe58ULL, 0x480e01d0ULL, 0xda87374aULL, 0x2d120f6fULL, 0x6b4f92d5ULL},
+{0x6a2c45d8ULL, 0xda39f73bULL, 0xd12cf21dULL, 0xa419ded7ULL, 0x6a2c45d8ULL, 0xb9f5a365ULL, 0xd52d7157ULL, 0xa419ded7ULL, 0x20d8cc5aULL},
+{0x449961ebULL, 0xde56335fULL, 0x386e2e12ULL, 0xcc02cddfULL, 0x449961ebULL, 0xa3f04f62ULL, 0xe21174dbULL, 0xcc02cddfULL, 0x302ce7ccULL},
+{0x1993a916ULL, 0x577fdc13ULL, 0x2916cafaULL, 0xc165c3cfULL, 0x1993a916ULL, 0xa69d7727ULL, 0xca7b2badULL, 0xc165c3cfULL, 0xb230b9fULL},
+{0x569d48abULL, 0x1508ca29ULL, 0xd04b1debULL, 0x8b868400ULL, 0x569d48abULL, 0xdc7aefd4ULL, 0xc11d03c0ULL, 0x8b868400ULL, 0xc77dbc8ULL},
+{0x46a20b4cULL, 0x2308cc20ULL, 0x3be63585ULL, 0xe0547adcULL, 0x46a20b4cULL, 0x38788d38ULL, 0xe3316894ULL, 0xe0547adcULL, 0x8c348a16ULL},
+{0x3c884850ULL, 0xd2e64a18ULL, 0x68e28244ULL, 0x21aed82eULL, 0x3c884850ULL, 0xe88d1bcbULL, 0x41593cbULL, 0x21aed82eULL, 0x2ff0e5f7ULL},
+{0xbdacb259ULL, 0x254d8055ULL, 0x290a4a27ULL, 0x3e486194ULL, 0xbdacb259ULL, 0xcb572f7cULL, 0x9ae918fcULL, 0x3e486194ULL, 0xb473a8a5ULL},
+{0x38735f1dULL, 0x30cbd975ULL, 0xe77c6781ULL, 0x412541d0ULL, 0x38735f1dULL, 0xaa01c260ULL, 0x9b3f250dULL, 0x412541d0ULL, 0x9790f3c8ULL},
+{0xda6f3093ULL, 0x495c78c8ULL, 0x64cfb3b1ULL, 0x51ff74aULL, 0xda6f3093ULL, 0xfac94acbULL, 0x4e5de1baULL, 0x51ff74aULL, 0x3e7b9b05ULL},
+{0x5eaff2ccULL, 0xba3dc8fdULL, 0x4c593a6ULL, 0x6248a1b6ULL, 0x5eaff2ccULL, 0x5a3c763cULL, 0x436eb89dULL, 0x6248a1b6ULL, 0xb6f2ac34ULL},
+{0x758d2b30ULL, 0x7ac9f016ULL, 0xa71846faULL, 0x59533b5eULL, 0x758d2b30ULL, 0x26eca9e4ULL, 0x9d628a66ULL, 0x59533b5eULL, 0x9ae1953bULL},
+{0x81abaa27ULL, 0x16e901a3ULL, 0x7b90aebdULL, 0x7928e118ULL, 0x81abaa27ULL, 0x52529366ULL, 0xea3a6cdbULL, 0x7928e118ULL, 0xec299ed9ULL},
+{0x4e187ae2ULL, 0xd008660ULL, 0xbd1f5521ULL, 0x2daa3512ULL, 0x4e187ae2ULL, 0x6bcdb4c0ULL, 0x84b8202bULL, 0x2daa3512ULL, 0xe5b44ae0ULL},
+{0xf4bc0517ULL, 0x79588674ULL, 0x21980486ULL, 0x543002f8ULL, 0xf4bc0517ULL, 0x2db2d4e5ULL, 0xd9b0862dULL, 0x543002f8ULL, 0x7a337d50ULL},
+{0x50f40da9ULL, 0xfdeb3d4bULL, 0x3b2936ULL, 0xba8392b4ULL, 0x50f40da9ULL, 0x486cac04ULL, 0x1122dbffULL, 0xba8392b4ULL, 0xdf6ffb73ULL},
+{0x2cb7fa19ULL, 0xa875d0e6ULL, 0xf8361d57ULL, 0x1ba200a0ULL, 0x2cb7fa19ULL, 0x2aa573c1ULL, 0x56b9c0efULL, 0x1ba200a0ULL, 0xfec40efeULL},
+{0xfab000afULL, 0x750f05f2ULL, 0x41158511ULL, 0xfa569215ULL, 0xfab000afULL, 0x67b9f310ULL, 0x448b7db4ULL, 0xfa569215ULL, 0x88d30cd3ULL},
+{0x9cc7e945ULL, 0x11beb4e5ULL, 0x56ec4465ULL, 0x19fc2e6fULL, 0x9cc7e945ULL, 0xccb4f508ULL, 0x9b425481ULL, 0x19fc2e6fULL, 0x8155dc61ULL},
+{0xa39e6b12ULL, 0xe5f0a1eULL, 0xf343c8b4ULL, 0xb0ac4956ULL, 0xa39e6b12ULL, 0xa3104861ULL, 0x1c4d76beULL, 0xb0ac4956ULL, 0xf7d9edbbULL},
+{0xcb5b9a9fULL, 0x6dfcbb70ULL, 0xe29b0f74ULL, 0x956d2c59ULL, 0xcb5b9a9fULL, 0xbb240a9dULL, 0x7b2f217bULL, 0x956d2c59ULL, 0x159d7790ULL},
+{0xbb471114ULL, 0x1f840f49ULL, 0x65647aa0ULL, 0x8cb7852fULL, 0xbb471114ULL, 0x95d1a976ULL, 0x54f38113ULL, 0x8cb7852fULL, 0xf9e46a04ULL},
+{0x60b3a05ULL, 0x5636263ULL, 0x9056c353ULL, 0xe352856ULL, 0x60b3a05ULL, 0xdbc1e184ULL, 0xf26aafe6ULL, 0xe352856ULL, 0xe4880983ULL},
+{0xbdd34e86ULL, 0x4dca1221ULL, 0x42147613ULL, 0x397ab97cULL, 0xbdd34e86ULL, 0xb991e24bULL, 0xeeb904cULL, 0x397ab97cULL, 0x5b588401ULL},
+{0x2c530f90ULL, 0xaeafd4e6ULL, 0x8211fc17ULL, 0xf1a9592aULL, 0x2c530f90ULL, 0xde14e7dcULL, 0xd024c7e2ULL, 0xf1a9592aULL, 0x721ce801ULL},
+{0x88b33392ULL, 0xb53d212fULL, 0x252d15ccULL, 0x1c2f7f33ULL, 0x88b33392ULL, 0x81623d7bULL, 0x670ebca2ULL, 0x1c2f7f33ULL, 0xd75be895ULL},
+{0x85a05b02ULL, 0x6383347aULL, 0xb5fac4fULL, 0x51760df7ULL, 0x85a05b02ULL, 0x942a9d53ULL, 0xcafdddd5ULL, 0x51760df7ULL, 0xe9806978ULL},
+{0x45417ec2ULL, 0xc2adedb5ULL, 0xaab726edULL, 0x5f45affULL, 0x45417ec2ULL, 0x7b768ff5ULL, 0xbe17e0eaULL, 0x5f45affULL, 0x36fa290bULL},
+{0x61d505feULL, 0xe929c6ebULL, 0xf3b72dd0ULL, 0x5c8e14c9ULL, 0x61d505feULL, 0x82542968ULL, 0xf112e435ULL, 0x5c8e14c9ULL, 0x57c05d59ULL},
+{0x84f8de6aULL, 0xfcef99aaULL, 0x94885418ULL, 0xe4ae507cULL, 0x84f8de6aULL, 0xd8d0148bULL, 0xa9a4aa04ULL, 0xe4ae507cULL, 0xb7c84548ULL},
+{0x820d3f37ULL, 0x28d0af52ULL, 0xe961d1bdULL, 0x75e3d7bcULL, 0x820d3f37ULL, 0x9808bca1ULL, 0xbb722150ULL, 0x75e3d7bcULL, 0x2357af29ULL},
+{0x880bd8e8ULL, 0x516f4410ULL, 0x71e186e8ULL, 0xa3e2ffa1ULL, 0x880bd8e8ULL, 0x74b7c194ULL, 0x8b6b9b81ULL, 0xa3e2ffa1ULL, 0x5e4d0eafULL},
+{0xbe43b5acULL, 0x2ca12630ULL, 0x428cf7ddULL, 0xfc1abb9dULL, 0xbe43b5acULL, 0xc4c070a4ULL, 0x97ab8170ULL, 0xfc1abb9dULL, 0x1e759061ULL},
+{0x82025c1eULL, 0x721026fULL, 0x9b083590ULL, 0x174c6c03ULL, 0x82025c1eULL, 0x657404cfULL, 0x8e6b1f03ULL, 0x174c6c03ULL, 0x13ba2085ULL},
+{0xcf6c1b0ULL, 0xa5a901b1ULL, 0xb910c6eeULL, 0x27395851ULL, 0xcf6c1b0ULL, 0xda7c4350ULL, 0xcdd84c4cULL, 0x27395851ULL, 0x724f6e8dULL},
+{0xa40c7ca7ULL, 0x3d5792daULL, 0x2271538aULL, 0x9d2b467fULL, 0xa40c7ca7ULL, 0x71d1bda4ULL, 0xc975b647ULL, 0x9d2b467fULL, 0xb00f6200ULL},
+{0x95bcb317ULL, 0xeafe99e8ULL, 0xb531f099ULL, 0x2a89afecULL, 0x95bcb317ULL, 0x20e59613ULL, 0xfad10fdeULL, 0x2a89afecULL, 0xc7b7cc03ULL},
+{0x1e30390eULL, 0x4b8ca33eULL, 0x91e1c36ULL, 0x429e4337ULL, 0x1e30390eULL, 0xa9cb8829ULL, 0xb2e2e52eULL, 0x429e4337ULL, 0xeae188ccULL},
+{0x1baaedb0ULL, 0xe1cb117fULL, 0x41fc561ULL, 0xfc4579beULL, 0x1baaedb0ULL, 0xa4edefffULL, 0x9c715abaULL, 0xfc4579beULL, 0xec1fa13aULL},
+{0x56f31a2cULL, 0x47fd0615ULL, 0xaa87a88fULL, 0x49aa44caULL, 0x56f31a2cULL, 0xa4a34d92ULL, 0x7d591d90ULL, 0x49aa44caULL, 0x4a1994b2ULL},
+{0x2fc04e6fULL, 0x2b72db5aULL, 0x4cbf12cbULL, 0x2f643b85ULL, 0x2fc04e6fULL, 0x1a379604ULL, 0x4ef7a610ULL, 0x2f643b85ULL, 0x9339f6f4ULL},
+{0x1b92be1dULL, 0xbd9e7dd5ULL, 0xe43bba4eULL, 0x8d529d75ULL, 0x1b92be1dULL, 0x88521ee1ULL, 0x47444330ULL, 0x8d529d75ULL, 0x9b979a05ULL},
+{0x7533634cULL, 0x8255254aULL, 0xc5e4bb47ULL, 0xb6590f14ULL, 0x7533634cULL, 0xe0c9fa8ULL, 0x8234b719ULL, 0xb6590f14ULL, 0x5cda538ULL},
+{0x5b927f0bULL, 0xd63d1459ULL, 0x6c08c967ULL, 0xed304bdcULL, 0x5b927f0bULL, 0x12d7624cULL, 0x7c40f06dULL, 0xed304bdcULL, 0x4777e44bULL},
+{0xb525ee53ULL, 0x4654346aULL, 0x9b9c2665ULL, 0x1c88bf34ULL, 0xb525ee53ULL, 0xadd99479ULL, 0x55bb53ddULL, 0x1c88bf34ULL, 0x96219f8fULL},
+{0x5c0dfeedULL, 0x2e042878ULL, 0x8cea39d4ULL, 0xa2f0a1c0ULL, 0x5c0dfeedULL, 0x3984dcc5ULL, 0x8880cb84ULL, 0xa2f0a1c0ULL, 0xbcd29eb3ULL},
+{0x90b5d3bULL, 0x1068a425ULL, 0x949a9c3aULL, 0x8e11e42cULL, 0x90b5d3bULL, 0x1aecfb1dULL, 0xae3c9de1ULL, 0x8e11e42cULL, 0xca96d3e0ULL},
+{0x9c49758cULL, 0x2e8c6151ULL, 0x16f00daeULL, 0xfd70e777ULL, 0x9c49758cULL, 0xb152e06bULL, 0xe7a7ddf0ULL, 0xfd70e777ULL, 0x18c02d8ULL},
+{0xfdbba989ULL, 0x3e8cfa5ULL, 0x95ecce12ULL, 0xac3cd94fULL, 0xfdbba989ULL, 0xc82186e7ULL, 0x79b7763dULL, 0xac3cd94fULL, 0xfa1efb36ULL},
+{0xf9379dcfULL, 0x5ec7bc8dULL, 0x5a65070cULL, 0xe3345738ULL, 0xf9379dcfULL, 0x4cb4c9d8ULL, 0x47f1593fULL, 0xe3345738ULL, 0x1abc8d2bULL},
+{0x85bbca20ULL, 0x62569885ULL, 0x482c61e4ULL, 0x986ea3dfULL, 0x85bbca20ULL, 0x5c5bc676ULL, 0x9a5f4adcULL, 0x986ea3dfULL, 0xf459758eULL},
+{0x1de00416ULL, 0xfed92379ULL, 0xc6f24af7ULL, 0x346f27cbULL, 0x1de00416ULL, 0xb71b01f9ULL, 0xfa165e03ULL, 0x346f27cbULL, 0xb2611fa1ULL},
+{0x3bc8000cULL, 0x86a97d67ULL, 0xe967c14fULL, 0x5224e746ULL, 0x3bc8000cULL, 0xbf94f35eULL, 0x92674839ULL, 0x5224e746ULL, 0x829769b9ULL},
+{0x82dffe37ULL, 0xc4b0e895ULL, 0x71efe8bfULL, 0xdb36e3e5ULL, 0x82dffe37ULL, 0xb1983d01ULL, 0x4cd0c9a0ULL, 0xdb36e3e5ULL, 0x52334b91ULL},
+{0x74968b3ULL, 0x5098b13aULL, 0xaf9b61d8ULL, 0x5545435fULL, 0x74968b3ULL, 0x71e1acf3ULL, 0x88451953ULL, 0x5545435fULL, 0x5cd83650ULL},
+{0x95d136aeULL, 0x800969f0ULL, 0xf4579d6fULL, 0xf78163fULL, 0x95d136aeULL, 0xbb174fe8ULL, 0xb29bce6eULL, 0xf78163fULL, 0x64fee2b0ULL},
+{0x634663f5ULL, 0x3a948a92ULL, 0x27596038ULL, 0xbee123dULL, 0x634663f5ULL, 0x97497e24ULL, 0x57a1ae59ULL, 0xbee123dULL, 0x5b6071c7ULL},
+{0x279f4e33ULL, 0x50de4047ULL, 0x1cab8d01ULL, 0x47678fe6ULL, 0x279f4e33ULL, 0x4cddf898ULL, 0xab006eULL, 0x47678fe6ULL, 0xd6525581ULL},
+{0xc4e25459ULL, 0x6e0735d3ULL, 0x4cb95b0fULL, 0xc36773e4ULL, 0xc4e25459ULL, 0x549e3907ULL, 0x13db9e99ULL, 0xc36773e4ULL, 0x3114f6f3ULL},
+{0x108e41f2ULL, 0xeeca30e7ULL, 0x4c6f3a8fULL, 0x716db6fULL, 0x108e41f2ULL, 0xe136177ULL, 0x319cd565ULL, 0x716db6fULL, 0x76fd430ULL},
+{0x95d221e6ULL, 0x6d1c7e73ULL, 0xbee368daULL, 0x9a1cc1f2ULL, 0x95d221e6ULL, 0x5c971007ULL, 0xb0376977ULL, 0x9a1cc1f2ULL, 0x536db2e6ULL},
+{0x3b925ff9ULL, 0x574a5220ULL, 0xc757e682ULL, 0x38655c0bULL, 0x3b925ff9ULL, 0x14510feeULL, 0xdbc3258cULL, 0x38655c0bULL, 0xc0965c11ULL},
+{0x12c7bb8ULL, 0xf558f132ULL, 0x93322ae7ULL, 0xb920d58dULL, 0x12c7bb8ULL, 0x29323b8dULL, 0xe3fba132ULL, 0xb920d58dULL, 0x3978dc11ULL},
+{0x3289f477ULL, 0x7178fd9eULL, 0x69e87018ULL, 0x3e1459acULL, 0x3289f477ULL, 0x419b4972ULL, 0x6bbc6a77ULL, 0x3e1459acULL, 0x12964c5aULL},
+{0x5ad1c845ULL, 0x504a8e94ULL, 0xa9fee111ULL, 0xd70d796cULL, 0x5ad1c845ULL, 0x7f82a048ULL, 0xe0d26a0fULL, 0xd70d796cULL, 0x6722fd6bULL},
+{0x20e9f575ULL, 0x23b2641dULL, 0x4087c0c7ULL, 0xd6324c20ULL, 0x20e9f575ULL, 0xc1be6695ULL, 0xeab173ebULL, 0xd6324c20ULL, 0x19b7364eULL},
+{0x716c7e3dULL, 0xf7f5c200ULL, 0x4c128c35ULL, 0x5375157bULL, 0x716c7e3dULL, 0xf0029da1ULL, 0x455b0552ULL, 0x5375157bULL, 0x6237a70dULL},
+{0xfa0c539fULL, 0x42452bc3ULL, 0xc7d710b0ULL, 0xbe028361ULL, 0xfa0c539fULL, 0xc5485194ULL, 0xe004da3eULL, 0xbe028361ULL, 0x47885772ULL},
+{0x8d8c242ULL, 0xa2afaca9ULL, 0xdb82de6ULL, 0x8c344f91ULL, 0x8d8c242ULL, 0x5bd7bc55ULL, 0x7eb34cbULL, 0x8c344f91ULL, 0x72883bb1ULL},
+{0x1f77df43ULL, 0x3a7f1f11ULL, 0x2b08eae4ULL, 0x27dbbc18ULL, 0x1f77df43ULL, 0xd2396f4fULL, 0x8ed14842ULL, 0x27dbbc18ULL, 0x89deb01aULL},
+{0x9a88bdfbULL, 0x27b541caULL, 0x3f546420ULL, 0xe4aac7d7ULL, 0x9a88bdfbULL, 0x4643870cULL, 0x546f5c07ULL, 0xe4aac7d7ULL, 0xecf7da6cULL},
+{0x13a17fc9ULL, 0x69748b02ULL, 0x2cec273fULL, 0xefe16762ULL, 0x13a17fc9ULL, 0x6bd75c93ULL, 0x95e0c392ULL, 0xefe16762ULL, 0x674f9a81ULL},
+{0x91e5689ULL, 0x81648bffULL, 0xaa88206dULL, 0x7ece3f72ULL, 0x91e5689ULL, 0xa3109f18ULL, 0x6c79ae0ULL, 0x7ece3f72ULL, 0x1778d525ULL},
+{0x621e6d87ULL, 0x98849f16ULL, 0x77046157ULL, 0x45dc993cULL, 0x621e6d87ULL, 0x4e3cc520ULL, 0x850e2c79ULL, 0x45dc993cULL, 0x43d24522ULL},
+{0x9cfa92f6ULL, 0x618a5cdbULL, 0xa4f60e67ULL, 0xd1672b20ULL, 0x9cfa92f6ULL, 0x8ec0e28fULL, 0x710a6d52ULL, 0xd1672b20ULL, 0xd2b36598ULL},
+{0x5e78183eULL, 0xa00e2e4fULL, 0x731331dULL, 0xd049bd20ULL, 0x5e78183eULL, 0xaffac51eULL, 0x6d622d3aULL, 0xd049bd20ULL, 0x7189e3dfULL},
+{0x9f7dbf7aULL, 0x7721a508ULL, 0x31abac7cULL, 0xfae253f8ULL, 0x9f7dbf7aULL, 0x5786f247ULL, 0x32214d66ULL, 0xfae253f8ULL, 0xa3a03febULL},
+{0x1f37cdd1ULL, 0x3c7346f5ULL, 0x6c32995dULL, 0x7a6818ecULL, 0x1f37cdd1ULL, 0x181afda0ULL, 0x1f90b9b6ULL, 0x7a6818ecULL, 0x4e592ee6ULL},
+{0x9fb354ddULL, 0x79095516ULL, 0x785dd7b0ULL, 0x661f010aULL, 0x9fb354ddULL, 0x6aefe94dULL, 0xdaa16cdULL, 0x661f010aULL, 0x996b098aULL},
+{0x445138d7ULL, 0xf657857fULL, 0x2f27879cULL, 0x605fd878ULL, 0x445138d7ULL, 0xfcdd9e74ULL, 0x6a4eaa24ULL, 0x605fd878ULL, 0x4b6a2196ULL},
+{0xfeb2e6deULL, 0xb85aabb2ULL, 0x9cbad56eULL, 0x82dd9753ULL, 0xfeb2e6deULL, 0x25b5eff6ULL, 0x84ced8bULL, 0x82dd9753ULL, 0x8e990388ULL},
+{0x7baad9c0ULL, 0xf95cd45ULL, 0x4055df14ULL, 0xb161c0bULL, 0x7baad9c0ULL, 0x17cf6a74ULL, 0xab58c88eULL, 0xb161c0bULL, 0x3b4d47a5ULL},
+{0x9a6c930aULL, 0x82a75472ULL, 0x294c805ULL, 0xa84b9dc3ULL, 0x9a6c930aULL, 0x4de39746ULL, 0x94588358ULL, 0xa84b9dc3ULL, 0x8666b087ULL},
+{0xef61dbf6ULL, 0x872d6bb4ULL, 0xe1288ed5ULL, 0x23511235ULL, 0xef61dbf6ULL, 0x8ed09fULL, 0x385797a6ULL, 0x23511235ULL, 0xb447b070ULL},
+{0xf81445c4ULL, 0x21e2a9acULL, 0x2a94f17fULL, 0x992893e6ULL, 0xf81445c4ULL, 0xb556605ULL, 0x32610eccULL, 0x992893e6ULL, 0x70e66dabULL},
+{0x2c771b7eULL, 0x2d39a5b2ULL, 0x5dfb9bc6ULL, 0x425f4f4ULL, 0x2c771b7eULL, 0x623c8644ULL, 0xd1d157e0ULL, 0x425f4f4ULL, 0xfc3f80ceULL},
+{0xaec9b35eULL, 0xeca00a17ULL, 0xa2db0dafULL, 0x54194165ULL, 0xaec9b35eULL, 0xb7902e2cULL, 0x786274a2ULL, 0x54194165ULL, 0x9795e38dULL},
+{0x602d0985ULL, 0xc0d2863bULL, 0xf9d6de03ULL, 0x4b2fc6e8ULL, 0x602d0985ULL, 0x7039cdadULL, 0x3df2dd26ULL, 0x4b2fc6e8ULL, 0x372efa96ULL},
+{0x4f36844fULL, 0xadef9e6aULL, 0x5aeba1f6ULL, 0xcde4037bULL, 0x4f36844fULL, 0x486a2239ULL, 0x26ac0e87ULL, 0xcde4037bULL, 0x6e5e50e1ULL},
+{0x7d161020ULL, 0xd1dc6256ULL, 0x3eb6caadULL, 0xdedb437eULL, 0x7d161020ULL, 0x24c40ca0ULL, 0xcaa33a13ULL, 0xdedb437eULL, 0xaae11316ULL},
+{0x488d813ULL, 0xf5a2585ULL, 0xbca39483ULL, 0x4aadc104ULL, 0x488d813ULL, 0x2102ffe9ULL, 0xd68a775dULL, 0x4aadc104ULL, 0x370cc88ULL},
+{0xe2d7c92cULL, 0x3d579b2dULL, 0x5d59d847ULL, 0x1541ff6aULL, 0xe2d7c92cULL, 0x203611cdULL, 0xac3212bfULL, 0x1541ff6aULL, 0x9bd049cULL},
+{0x1ccee2a5ULL, 0xaa9812dcULL, 0xb505d385ULL, 0xbde780b2ULL, 0x1ccee2a5ULL, 0xba995b63ULL, 0xe0df7231ULL, 0xbde780b2ULL, 0xe2ffaf28ULL},
+{0x534b93adULL, 0x1a040f20ULL, 0xa6e9b2adULL, 0x7ddafb5dULL, 0x534b93adULL, 0xc66e13caULL, 0x5012ece5ULL, 0x7ddafb5dULL, 0x9bf5a5d4ULL},
+{0x60812a25ULL, 0xf40e0bb4ULL, 0x51cb6359ULL, 0x2e88e350ULL, 0x60812a25ULL, 0x1550b9fULL, 0x7fdde92cULL, 0x2e88e350ULL, 0xd799ccbULL},
+{0x8e19bbf5ULL, 0xa043ea5fULL, 0x59454637ULL, 0xdaf63423ULL, 0x8e19bbf5ULL, 0xec15347dULL, 0x1174dbd5ULL, 0xdaf63423ULL, 0x2c1d41bfULL},
+{0x95160282ULL, 0x80be4937ULL, 0x2add0593ULL, 0x2d0b8973ULL, 0x95160282ULL, 0xb37ff994ULL, 0xf3c0053cULL, 0x2d0b8973ULL, 0xb4f3603ULL},
+{0xb8b0c573ULL, 0x86128820ULL, 0xcd4fdb42ULL, 0x190d526cULL, 0xb8b0c573ULL, 0x7968ab6fULL, 0x1287922bULL, 0x190d526cULL, 0xd411c4a2ULL},
+{0x967be1c4ULL, 0xfe2cd4b3ULL, 0xe1962a72ULL, 0xd6ac3fa3ULL, 0x967be1c4ULL, 0xe4da53e4ULL, 0xa661d5eeULL, 0xd6ac3fa3ULL, 0x3aef07a9ULL},
+{0xfac15caULL, 0xebf9bb7dULL, 0xb71fb43ULL, 0x6c364318ULL, 0xfac15caULL, 0x822de86aULL, 0xf82f251bULL, 0x6c364318ULL, 0xc882419ULL},
+{0x2a268397ULL, 0x11339ccULL, 0x5d80c27cULL, 0x3b3fb943ULL, 0x2a268397ULL, 0x2f4fddf5ULL, 0xc6dbfd27ULL, 0x3b3fb943ULL, 0xefa6c37cULL},
+{0x5f9a4923ULL, 0x4fb35972ULL, 0x66d63300ULL, 0x5ab3c24bULL, 0x5f9a4923ULL, 0x4da50d84ULL, 0x7aa71e5eULL, 0x5ab3c24bULL, 0xd0cff3d0ULL},
+{0x3779a967ULL, 0x66409b53ULL, 0x78bfcf30ULL, 0x8e7e5645ULL, 0x3779a967ULL, 0xd43f333ULL, 0x53439d53ULL, 0x8e7e5645ULL, 0x34992897ULL},
+{0xb78edd53ULL, 0x11abd103ULL, 0x9029ff0bULL, 0x4a6686c6ULL, 0xb78edd53ULL, 0x8008303cULL, 0x9aa21e9eULL, 0x4a6686c6ULL, 0xb306cadULL},
+{0xcf503e83ULL, 0xd54e9b9bULL, 0xc9584dc9ULL, 0xffe7772fULL, 0xcf503e83ULL, 0xcf68c41eULL, 0x5d2068efULL, 0xffe7772fULL, 0x4ad96291ULL},
+{0xf2cd337bULL, 0xeef5c5c3ULL, 0xed434b05ULL, 0x4eee7b87ULL, 0xf2cd337bULL, 0x96f5e8edULL, 0x5d4618f8ULL, 0x4eee7b87ULL, 0x2ff7609ULL},
+{0x32adc81ULL, 0x202ca234ULL, 0xecc2c48aULL, 0x3d8ddb36ULL, 0x32adc81ULL, 0xe19b653ULL, 0xc78af6a0ULL, 0x3d8ddb36ULL, 0xf333b6c9ULL},
+{0x73ce8c91ULL, 0x33a61fffULL, 0x292a4ad1ULL, 0xf3db723cULL, 0x73ce8c91ULL, 0x7ee26608ULL, 0xd1b97982ULL, 0xf3db723cULL, 0x8be99505ULL},
+{0xdad11231ULL, 0x11c9b586ULL, 0x411dd490ULL, 0x2ca706d1ULL, 0xdad11231ULL, 0xec6bdb72ULL, 0xdb1587abULL, 0x2ca706d1ULL, 0x168fd349ULL},
+{0xcab9f7f6ULL, 0xdded8323ULL, 0x4cfab49fULL, 0xf5cbc66ULL, 0xcab9f7f6ULL, 0xe242dbddULL, 0x32d582fdULL, 0xf5cbc66ULL, 0xf42e66ULL},
+{0xcbf83621ULL, 0x92238e9fULL, 0xd4ab7899ULL, 0xdc4d4367ULL, 0xcbf83621ULL, 0xe68d403ULL, 0x2d3861e2ULL, 0xdc4d4367ULL, 0xada5039fULL},
+{0x76acb6b2ULL, 0x29941f67ULL, 0x49e26b23ULL, 0xaa77cb4fULL, 0x76acb6b2ULL, 0xa9fee7baULL, 0x4bc3e887ULL, 0xaa77cb4fULL, 0xdb8342c2ULL},
+{0x2cd5138fULL, 0xd810f437ULL, 0xca86e57dULL, 0xafed0b33ULL, 0x2cd5138fULL, 0xec16567eULL, 0x606b3980ULL, 0xafed0b33ULL, 0xe998e87dULL},
+{0xc5d5d0b0ULL, 0x67341266ULL, 0x89753fcULL, 0xb94ea18ULL, 0xc5d5d0b0ULL, 0xac18ccc8ULL, 0xf5847337ULL, 0xb94ea18ULL, 0xa13cc0dfULL},
+{0x6c3e8a04ULL, 0x8069b0dULL, 0x5a112379ULL, 0x4fa09426ULL, 0x6c3e8a04ULL, 0x97310570ULL, 0x21603fbdULL, 0x4fa09426ULL, 0x60b4a48dULL},
+{0xa51c76d2ULL, 0xd35f899eULL, 0xa4c953bbULL, 0x44a141e4ULL, 0xa51c76d2ULL, 0xe5f0b4faULL, 0xba0cd0baULL, 0x44a141e4ULL, 0x73e1ab64ULL},
+{0x1a2e7c90ULL, 0xcfb15adcULL, 0x8e3dc90ULL, 0x737605cfULL, 0x1a2e7c90ULL, 0x3bca9e3bULL, 0xe769a443ULL, 0x737605cfULL, 0xec06efaULL},
+{0x574a194aULL, 0x44583454ULL, 0x7484edd3ULL, 0x868dbfa1ULL, 0x574a194aULL, 0xe80cf39dULL, 0x3e88abd9ULL, 0x868dbfa1ULL, 0x87d12381ULL},
+{0xcb237a5eULL, 0xc82e966bULL, 0x82851a0bULL, 0x6dae11c3ULL, 0xcb237a5eULL, 0xbf2fd66cULL, 0x36d30c32ULL, 0x6dae11c3ULL, 0x8638db2ULL},
+{0xf496bd7bULL, 0x131032a1ULL, 0xb0cd5cc4ULL, 0x2c9775e8ULL, 0xf496bd7bULL, 0x940a1d85ULL, 0x7863cff3ULL, 0x2c9775e8ULL, 0xb3b051d0ULL},
+{0xf847b93ULL, 0x7e2b5a1aULL, 0x1f833873ULL, 0xe8b24c2ULL, 0xf847b93ULL, 0xc60beb8dULL, 0x22ff14e7ULL, 0xe8b24c2ULL, 0x1ab09ac0ULL},
+{0x808a8984ULL, 0x981ba0ddULL, 0x15459b5dULL, 0x8a1b7357ULL, 0x808a8984ULL, 0xe288adeeULL, 0xff0c3a87ULL, 0x8a1b7357ULL, 0xd2a3f4e5ULL},
+{0x21969c8cULL, 0x575e0fa5ULL, 0xd9a14373ULL, 0xe1486989ULL, 0x21969c8cULL, 0x9fd5bcc7ULL, 0x2e7aedceULL, 0xe1486989ULL, 0x23c52c27ULL},
+{0x35e19a0cULL, 0x8de0dd42ULL, 0x6fad4968ULL, 0xf5085b99ULL, 0x35e19a0cULL, 0x20aafa90ULL, 0xacdb0f67ULL, 0xf5085b99ULL, 0x9224e2ccULL},
+{0x209403e0ULL, 0x4dcd08afULL, 0xb5f0e5bdULL, 0x8c518d56ULL, 0x209403e0ULL, 0xde62a24aULL, 0x3b8e11efULL, 0x8c518d56ULL, 0x2be8d353ULL},
+{0x4915a568ULL, 0xcf47697aULL, 0x20c87064ULL, 0x8dc7955bULL, 0x4915a568ULL, 0x59039d10ULL, 0xf84da24ULL, 0x8dc7955bULL, 0xf666218dULL},
+{0xc24dd62bULL, 0x60107172ULL, 0x6f807867ULL, 0x3b4dc948ULL, 0xc24dd62bULL, 0x246ae377ULL, 0x77d06b25ULL, 0x3b4dc948ULL, 0x20246284ULL},
+{0x1b04fa0bULL, 0xd4763febULL, 0x2348acceULL, 0xe391bcd3ULL, 0x1b04fa0bULL, 0xc1982303ULL, 0x27b8fbdaULL, 0xe391bcd3ULL, 0x6017828ULL},
+{0xf139814cULL, 0xfba2048cULL, 0xee13a465ULL, 0xf8494709ULL, 0xf139814cULL, 0x233c47cULL, 0x91bae3e9ULL, 0xf8494709ULL, 0xb37385c3ULL},
+{0x2fb81db8ULL, 0x125c069dULL, 0xaadcee72ULL, 0xeb473bfbULL, 0x2fb81db8ULL, 0xf240f474ULL, 0xbfab548fULL, 0xeb473bfbULL, 0xfed6b747ULL},
+{0xd0176343ULL, 0x84d4883bULL, 0x4d16e21cULL, 0xc310f577ULL, 0xd0176343ULL, 0x633fac30ULL, 0x16c4278dULL, 0xc310f577ULL, 0xf6f7ee66ULL},
+{0x6ffe9bbbULL, 0x51de73caULL, 0x6b61c17ULL, 0x127b0059ULL, 0x6ffe9bbbULL, 0x6a028696ULL, 0xa67fdbbcULL, 0x127b0059ULL, 0x47162e31ULL},
+{0x9bd7e2d4ULL, 0xcb1f8fe4ULL, 0x5359bcf4ULL, 0x3ba25d0aULL, 0x9bd7e2d4ULL, 0xddeffe81ULL, 0xc48f4285ULL, 0x3ba25d0aULL, 0xb71c30a4ULL},
+{0xd2ea85f0ULL, 0x4b736995ULL, 0x4eba9924ULL, 0xfe90b39dULL, 0xd2ea85f0ULL, 0x30756329ULL, 0x32cf4ae1ULL, 0xfe90b39dULL, 0xa870ae31ULL},
+{0xf7867454ULL, 0x6d8ecceULL, 0xdf49295dULL, 0xf8e0b1fULL, 0xf7867454ULL, 0xfe8e71f0ULL, 0x7227b84cULL, 0xf8e0b1fULL, 0x93389b74ULL},
+{0xa5164aceULL, 0xb1d0cb7cULL, 0x6ebefdc8ULL, 0x94de3c11ULL, 0xa5164aceULL, 0xcedfcb0fULL, 0xf720c5d2ULL, 0x94de3c11ULL, 0x6424efcdULL},
+{0x222f1f90ULL, 0x3a4f7eeaULL, 0x33c3b298ULL, 0xc5208a5aULL, 0x222f1f90ULL, 0x8164cdc0ULL, 0xca128f83ULL, 0xc5208a5aULL, 0x14506728ULL},
+{0xbf0e0a9eULL, 0x917948dbULL, 0xabf17860ULL, 0x7c89f5d2ULL, 0xbf0e0a9eULL, 0xca85b839ULL, 0x4c7cbaa4ULL, 0x7c89f5d2ULL, 0x59a88a88ULL},
+{0x3e737841ULL, 0xfb73daaeULL, 0xd95d8a93ULL, 0x327101d6ULL, 0x3e737841ULL, 0xcd958b0ULL, 0xcb318133ULL, 0x327101d6ULL, 0xfe212ff6ULL},
+{0x1c2a2ffeULL, 0x4a8cd3f3ULL, 0x69d1495bULL, 0x6bbf9649ULL, 0x1c2a2ffeULL, 0xb7eaec54ULL, 0xb5440a88ULL, 0x6bbf9649ULL, 0x9171fe4fULL},
+{0xae80b64ULL, 0xb11cea88ULL, 0xff3eae0eULL, 0xbbef2ce8ULL, 0xae80b64ULL, 0x1ffa78a7ULL, 0x16b3b5a8ULL, 0xbbef2ce8ULL, 0x621d02c7ULL},
+{0xf9248dc7ULL, 0x4b22dea1ULL, 0x856f1b1eULL, 0xc3f44a22ULL, 0xf9248dc7ULL, 0x29506a24ULL, 0xacddf0c4ULL, 0xc3f44a22ULL, 0x2e62f488ULL},
+{0x4f41cb6bULL, 0xe702de9bULL, 0xf39a3cf5ULL, 0x9eb04ce9ULL, 0x4f41cb6bULL, 0x813ca5b7ULL, 0x9b063ab0ULL, 0x9eb04ce9ULL, 0xf74242d3ULL},
+{0x9c87d8a8ULL, 0x974c8cd0ULL, 0x2d5dc571ULL, 0xc5abcbd0ULL, 0x9c87d8a8ULL, 0x4fc08138ULL, 0x93374520ULL, 0xc5abcbd0ULL, 0xdbaa35dULL},
+{0xb731534fULL, 0xd71bfe7ULL, 0xb7584b0fULL, 0x46328dc0ULL, 0xb731534fULL, 0x7101840ULL, 0x2886bab2ULL, 0x46328dc0ULL, 0x42005ae0ULL},
+{0x10575e7bULL, 0x6631200aULL, 0x8689ffa6ULL, 0x730e422eULL, 0x10575e7bULL, 0xc4e80426ULL, 0xe8f71d0aULL, 0x730e422eULL, 0xee768deULL},
+{0x55f491bbULL, 0x94d2dca4ULL, 0xb0cc2d2fULL, 0xf9988501ULL, 0x55f491bbULL, 0x89bbd16fULL, 0xde1be499ULL, 0xf9988501ULL, 0xc6cb4a4bULL},
+{0x222cf3f7ULL, 0x7ef7324dULL, 0xda6f4b6cULL, 0x4d7a970ULL, 0x222cf3f7ULL, 0x7ca8e6b2ULL, 0x15332623ULL, 0x4d7a970ULL, 0x56c7c6f6ULL},
+{0xae02faebULL, 0xccabecbaULL, 0xccf014e4ULL, 0x19599671ULL, 0xae02faebULL, 0xb07188b2ULL, 0xa3e770f2ULL, 0x19599671ULL, 0xe51599e8ULL},
+{0x4248ae39ULL, 0xd33b8375ULL, 0x8eed63aULL, 0xeb28900fULL, 0x4248ae39ULL, 0x9b4531e4ULL, 0xa8b12f93ULL, 0xeb28900fULL, 0x9bc33aa0ULL},
+{0xefa664c4ULL, 0xd3978ba6ULL, 0x9555ffd9ULL, 0x90de959eULL, 0xefa664c4ULL, 0x7e439adbULL, 0xc5c4e478ULL, 0x90de959eULL, 0x9ec5aa76ULL},
+{0x7e44ace9ULL, 0xce13e08dULL, 0xdcb8ce55ULL, 0xd8594a9dULL, 0x7e44ace9ULL, 0x9bf92ee0ULL, 0x733de383ULL, 0xd8594a9dULL, 0xe2a158edULL},
+{0x7bbfd79cULL, 0x1021f518ULL, 0x7103f2a0ULL, 0xab1174cbULL, 0x7bbfd79cULL, 0x51ab02e4ULL, 0x4c56b8caULL, 0xab1174cbULL, 0xe09f0bbdULL},
+{0xe5f27401ULL, 0x958a307cULL, 0x8be5764fULL, 0x27d35497ULL, 0xe5f27401ULL, 0x482c411eULL, 0x45d8309cULL, 0x27d35497ULL, 0xd81dbdc5ULL},
+{0xedd3e028ULL, 0x96170783ULL, 0x4fccae20ULL, 0xf15c6d1dULL, 0xedd3e028ULL, 0xcc31302ULL, 0x96118603ULL, 0xf15c6d1dULL, 0x5ea2c69bULL},
+{0xbc144645ULL, 0xc8e319f3ULL, 0x3d67bd4eULL, 0x83d0661ULL, 0xbc144645ULL, 0xaeb45587ULL, 0x63d994acULL, 0x83d0661ULL, 0xc048bceeULL},
+{0x18a0892eULL, 0x5e615634ULL, 0x66c1c1c1ULL, 0xe0ecc2c5ULL, 0x18a0892eULL, 0xc8b312c9ULL, 0x91f389afULL, 0xe0ecc2c5ULL, 0xd7807bf2ULL},
+{0xeb7202f6ULL, 0xc31e5da4ULL, 0xf11d3e1aULL, 0x83cf23aaULL, 0xeb7202f6ULL, 0x1086d304ULL, 0x10b6b6e2ULL, 0x83cf23aaULL, 0x4893a5acULL},
+{0x4cfc238aULL, 0x1ef6395bULL, 0x95ff1b17ULL, 0xef6d40c3ULL, 0x4cfc238aULL, 0x392a996dULL, 0x432a635cULL, 0xef6d40c3ULL, 0xfe00d5bdULL},
+{0x1cc10c30ULL, 0xf2c08742ULL, 0xd5fd75b9ULL, 0x4902f1bbULL, 0x1cc10c30ULL, 0x804d4e8bULL, 0x163d2af2ULL, 0x4902f1bbULL, 0xe511ade5ULL},
+{0x6b824898ULL, 0xe665a7cbULL, 0x9e5068a4ULL, 0x75fb9b8bULL, 0x6b824898ULL, 0x8406e63cULL, 0xfef6769dULL, 0x75fb9b8bULL, 0x599debffULL},
+{0xd68e239aULL, 0x33817457ULL, 0x3175a07eULL, 0x4bd74015ULL, 0xd68e239aULL, 0xf59b020aULL, 0xbc667e54ULL, 0x4bd74015ULL, 0xa10e6002ULL},
+{0x6ce29328ULL, 0x23f5205dULL, 0x7b64a075ULL, 0xd711e67dULL, 0x6ce29328ULL, 0xb0997891ULL, 0x698c3a60ULL, 0xd711e67dULL, 0x29ec0e73ULL},
+{0xb8e4b77ULL, 0x53918a89ULL, 0x272ecf51ULL, 0x41d1c28aULL, 0xb8e4b77ULL, 0xffe56b44ULL, 0x9ccfbc6fULL, 0x41d1c28aULL, 0xdaf0412fULL},
+{0xb21ba9c9ULL, 0x6fb3a1a6ULL, 0xeec5a2fdULL, 0x74f6409fULL, 0xb21ba9c9ULL, 0x741e792eULL, 0x3ef9e7adULL, 0x74f6409fULL, 0x7d36848eULL},
+{0x471e4af5ULL, 0x5d711620ULL, 0x441bcafcULL, 0x1bdf06f6ULL, 0x471e4af5ULL, 0xcd655b8fULL, 0x6e168fa9ULL, 0x1bdf06f6ULL, 0x5446a9b1ULL},
+{0xdf4f07cfULL, 0xc2a64edeULL, 0xd1e0a35dULL, 0x9e8827b1ULL, 0xdf4f07cfULL, 0x4b8c0b0bULL, 0x4e3ebbeeULL, 0x9e8827b1ULL, 0xfa1d1f31ULL},
+{0x8d5e50caULL, 0x96c1a58dULL, 0x18cf2cf1ULL, 0xcd7cdeecULL, 0x8d5e50caULL, 0x65fb6075ULL, 0xba53b8aaULL, 0xcd7cdeecULL, 0xdb4bd31eULL},
+{0x48dfb244ULL, 0x84b3f6e9ULL, 0x26d5526cULL, 0xc62f7086ULL, 0x48dfb244ULL, 0xbef31828ULL, 0x937a0d34ULL, 0xc62f7086ULL, 0x7e9e6c96ULL},
+{0xa2f9c6a0ULL, 0xd393272aULL, 0x94522969ULL, 0xb78186f0ULL, 0xa2f9c6a0ULL, 0x9a116043ULL, 0x4591adceULL, 0xb78186f0ULL, 0xcf3652a5ULL},
+{0x1490b53ULL, 0xd754b382ULL, 0xf64e0987ULL, 0x952ab14bULL, 0x1490b53ULL, 0xf448a85bULL, 0xdf6da89bULL, 0x952ab14bULL, 0xd1568ffeULL},
+{0xa7e7edd7ULL, 0x2d2abdcbULL, 0xbef874ffULL, 0x6c662a69ULL, 0xa7e7edd7ULL, 0x8f51ee58ULL, 0x43ad50ULL, 0x6c662a69ULL, 0x98d51125ULL},
+{0xc436c046ULL, 0x57db83e1ULL, 0xcda6e1f5ULL, 0x105cf859ULL, 0xc436c046ULL, 0xebb8bc10ULL, 0xf60a14efULL, 0x105cf859ULL, 0xed22d4f7ULL},
+{0x6e5c6684ULL, 0x576d49f0ULL, 0x736ebca5ULL, 0x88fddc79ULL, 0x6e5c6684ULL, 0x527eb576ULL, 0xee9e9944ULL, 0x88fddc79ULL, 0x26e0c6eaULL},
+{0xa2554c80ULL, 0xc5a01e9eULL, 0x898c3437ULL, 0xa709e665ULL, 0xa2554c80ULL, 0xe1f3e5d3ULL, 0x8ff6bb9eULL, 0xa709e665ULL, 0x261f11acULL},
+{0x54b7b6f3ULL, 0xff00f50ULL, 0x6af8fa58ULL, 0x70351c18ULL, 0x54b7b6f3ULL, 0x7d2837eULL, 0x26b2de42ULL, 0x70351c18ULL, 0x1800f25dULL},
+{0x57acb769ULL, 0x844bc3eaULL, 0xf1c09906ULL, 0x29f1a936ULL, 0x57acb769ULL, 0xf3eefdc4ULL, 0x1f73899aULL, 0x29f1a936ULL, 0x45c3d01bULL},
+{0xd747f1e8ULL, 0xd35c713cULL, 0x869b5316ULL, 0x19ea0eecULL, 0xd747f1e8ULL, 0xaebb8954ULL, 0xc343a000ULL, 0x19ea0eecULL, 0xd77d3bffULL},
+{0xb3ab568aULL, 0xd1522de3ULL, 0xb09e4a13ULL, 0xa468d2edULL, 0xb3ab568aULL, 0x590996a9ULL, 0x1a10895eULL, 0xa468d2edULL, 0x7b69c780ULL},
+{0x7a13ceb1ULL, 0x380f8280ULL, 0x2b652996ULL, 0xfaa0983cULL, 0x7a13ceb1ULL, 0x741af939ULL, 0x70b2cfdbULL, 0xfaa0983cULL, 0x180b74beULL},
+{0x2f473e06ULL, 0x7df350b8ULL, 0xe3d79480ULL, 0x12249f6ULL, 0x2f473e06ULL, 0x4c303beULL, 0xf7ab8047ULL, 0x12249f6ULL, 0x2eba103cULL},
+{0xc13633e9ULL, 0x7cd4b176ULL, 0xa60c039ULL, 0xab62dad4ULL, 0xc13633e9ULL, 0x5bff1f93ULL, 0x4a9fc42dULL, 0xab62dad4ULL, 0x44b12a16ULL},
+{0xfb1f4279ULL, 0x3a5c550eULL, 0xe34ba5dcULL, 0x7eeee430ULL, 0xfb1f4279ULL, 0x31946fe1ULL, 0xf1e031c5ULL, 0x7eeee430ULL, 0xc8b46dbdULL},
+{0x952d7785ULL, 0xe02e5504ULL, 0x9563954cULL, 0x7abfddcbULL, 0x952d7785ULL, 0xe6f8e7ceULL, 0x5f9f5d8dULL, 0x7abfddcbULL, 0x63ec5912ULL},
+{0xecfcf520ULL, 0x32449c6aULL, 0xf69bdc65ULL, 0x180401eULL, 0xecfcf520ULL, 0xd980d685ULL, 0x3efd702ULL, 0x180401eULL, 0x28a395e6ULL},
+{0xdc24587eULL, 0x4b28c516ULL, 0xfe79d65fULL, 0x6d7348a4ULL, 0xdc24587eULL, 0xfe84c177ULL, 0x15ddfb78ULL, 0x6d7348a4ULL, 0x7623e97cULL},
+{0xa8547f28ULL, 0x5f4c35e3ULL, 0x65838770ULL, 0x2e1dd5b2ULL, 0xa8547f28ULL, 0xcf9b5a32ULL, 0x6bdbb681ULL, 0x2e1dd5b2ULL, 0x65e03b99ULL},
+{0x9ca99b8ULL, 0xd6e2c927ULL, 0x365d969dULL, 0x9262058bULL, 0x9ca99b8ULL, 0xb9a9023ULL, 0xb705cfe3ULL, 0x9262058bULL, 0x565d8103ULL},
+{0xbd90016aULL, 0x2c535feULL, 0x394cdb47ULL, 0xd1a619e9ULL, 0xbd90016aULL, 0x7fc9312dULL, 0x16208ecfULL, 0xd1a619e9ULL, 0xe610a514ULL},
+{0x2775b1c6ULL, 0x798c3f65ULL, 0xedd6d746ULL, 0x8b9f20a4ULL, 0x2775b1c6ULL, 0x103c2bfULL, 0x752e80c0ULL, 0x8b9f20a4ULL, 0x6d1b8061ULL},
+{0x573ea1e9ULL, 0xaaa3e16ULL, 0xb3520bccULL, 0x7dc06ee9ULL, 0x573ea1e9ULL, 0xbdc6a1b8ULL, 0x57f785a0ULL, 0x7dc06ee9ULL, 0x98dffefcULL},
+{0xa1d0793aULL, 0xe2d51f2aULL, 0xf6575ecfULL, 0x64998a94ULL, 0xa1d0793aULL, 0x2352e75fULL, 0xf7d094f8ULL, 0x64998a94ULL, 0xe8676728ULL},
+{0x9efee22eULL, 0xa6e0eaa9ULL, 0x8e2375d5ULL, 0xc3ea8730ULL, 0x9efee22eULL, 0x79002db4ULL, 0x5cc13d87ULL, 0xc3ea8730ULL, 0x7ea2159cULL},
+{0x9b914c16ULL, 0xdcfcb66bULL, 0x719c0e28ULL, 0x8bbdaa02ULL, 0x9b914c16ULL, 0xb3766944ULL, 0xf6e02834ULL, 0x8bbdaa02ULL, 0x1301d716ULL},
+{0x208ad6dcULL, 0xa9258cb8ULL, 0x4150f97cULL, 0x90003cafULL, 0x208ad6dcULL, 0x43cb1f45ULL, 0x3a6518a4ULL, 0x90003cafULL, 0x1a6f303aULL},
+{0x90668a47ULL, 0x6d8b6376ULL, 0xe7ca86a3ULL, 0x727ca50cULL, 0x90668a47ULL, 0xd708e062ULL, 0xa141b859ULL, 0x727ca50cULL, 0x6670139ULL},
+{0x46fb03b9ULL, 0x541ae917ULL, 0x55dda8ddULL, 0x7d7c931eULL, 0x46fb03b9ULL, 0x762e3250ULL, 0xa2366f82ULL, 0x7d7c931eULL, 0xa51704eeULL},
+{0xd385d1d8ULL, 0xce9667ULL, 0x1581ea93ULL, 0x400332d8ULL, 0xd385d1d8ULL, 0xd4a94459ULL, 0xf4d2a90dULL, 0x400332d8ULL, 0x91266162ULL},
+{0x9a96ac24ULL, 0x374d1d98ULL, 0x965eb07bULL, 0xef6833a4ULL, 0x9a96ac24ULL, 0xd6c5645fULL, 0xf98a893fULL, 0xef6833a4ULL, 0xc3833982ULL},
+{0xced4040cULL, 0x956d7202ULL, 0xa094edc5ULL, 0xac8bf7adULL, 0xced4040cULL, 0xd424cd74ULL, 0x450dff9dULL, 0xac8bf7adULL, 0x1be114d8ULL},
+{0xa83628f4ULL, 0xc6a133eULL, 0xcaef02e6ULL, 0x441bf2c9ULL, 0xa83628f4ULL, 0x54b98cbfULL, 0x91ea6a95ULL, 0x441bf2c9ULL, 0x15488bfaULL},
+{0x13f39a96ULL, 0x41470eaaULL, 0x4b709a8ULL, 0x72aff1ecULL, 0x13f39a96ULL, 0xd464d813ULL, 0xeddad82eULL, 0x72aff1ecULL, 0xf635d070ULL},
+{0x76529167ULL, 0xf51ff7c1ULL, 0xfe7ecf79ULL, 0x6c434f2aULL, 0x76529167ULL, 0xb1ecadc7ULL, 0x576766b4ULL, 0x6c434f2aULL, 0x152b48f1ULL},
+{0xbb1f0070ULL, 0x723af6f7ULL, 0x71e75617ULL, 0x25772b71ULL, 0xbb1f0070ULL, 0x5a79fe6aULL, 0x68058104ULL, 0x25772b71ULL, 0x7472e4d0ULL},
+{0xb3f0b79bULL, 0x1d98a8d3ULL, 0x3fb35ff3ULL, 0x7047ce66ULL, 0xb3f0b79bULL, 0xed171fb5ULL, 0xbfde4a3ULL, 0x7047ce66ULL, 0xc3725411ULL},
+{0x71001104ULL, 0x1676f683ULL, 0x6d0c6e5cULL, 0xd15e69cdULL, 0x71001104ULL, 0xa8e395afULL, 0x8ef3d8ffULL, 0xd15e69cdULL, 0xe3a5ee73ULL},
+{0xfcfdb186ULL, 0x29e32408ULL, 0xf2f78967ULL, 0x4c4c34b6ULL, 0xfcfdb186ULL, 0xe5505b01ULL, 0x4263afb1ULL, 0x4c4c34b6ULL, 0xd8287a05ULL},
+{0x1ad6638eULL, 0xae87013bULL, 0x630f55a9ULL, 0x32c4497ULL, 0x1ad6638eULL, 0xad0465a1ULL, 0xc459e7e7ULL, 0x32c4497ULL, 0xb2af1c61ULL},
+{0x3898a1a6ULL, 0x3e091a40ULL, 0xa46b1337ULL, 0x6bb66617ULL, 0x3898a1a6ULL, 0x83a3e819ULL, 0x4b47e307ULL, 0x6bb66617ULL, 0x2f2a8ac8ULL},
+{0xa4db825ULL, 0x54baa1ULL, 0x59d84f7fULL, 0xcac4612cULL, 0xa4db825ULL, 0xd2f66bfULL, 0x127c635dULL, 0xcac4612cULL, 0x98c3a267ULL},
+{0x7033449dULL, 0x51f6d5cdULL, 0x17eb2551ULL, 0xbc471271ULL, 0x7033449dULL, 0x50dd5459ULL, 0xda7ab60aULL, 0xbc471271ULL, 0xefd2ad92ULL},
+{0x9a844ea0ULL, 0xab7444eULL, 0x74eb10c7ULL, 0x7a98a745ULL, 0x9a844ea0ULL, 0xf5587f55ULL, 0xb6d11f80ULL, 0x7a98a745ULL, 0xef087c64ULL},
+{0xf954444aULL, 0xcd708861ULL, 0x1d62bcdeULL, 0x2c37318aULL, 0xf954444aULL, 0x94ec12cdULL, 0xdd0488fdULL, 0x2c37318aULL, 0xdb14f8c6ULL},
+{0xa390ecc2ULL, 0x7f5324c2ULL, 0x8d83b26cULL, 0xff71d356ULL, 0xa390ecc2ULL, 0x19fcafd3ULL, 0x1ad4936dULL, 0xff71d356ULL, 0xd8186749ULL},
+{0xac83877dULL, 0xb008cd33ULL, 0xebd262a3ULL, 0x83129490ULL, 0xac83877dULL, 0x5ae3ed63ULL, 0xf398d5c7ULL, 0x83129490ULL, 0x3e43c7e2ULL},
+{0xc0d98cbaULL, 0x52d92dbcULL, 0xa18030d0ULL, 0x7dde6e16ULL, 0xc0d98cbaULL, 0x9b378080ULL, 0x72b6b42ULL, 0x7dde6e16ULL, 0xdd426f0bULL},
+{0x19ce20cfULL, 0x5b134a34ULL, 0x8fd15a5eULL, 0x24d8a6d5ULL, 0x19ce20cfULL, 0x2414d1f4ULL, 0x78bd7164ULL, 0x24d8a6d5ULL, 0x8d0f4b26ULL},
+{0x147e4ffaULL, 0xac947661ULL, 0x22355152ULL, 0x9d13ca1aULL, 0x147e4ffaULL, 0xc37964dcULL, 0x50aae0b0ULL, 0x9d13ca1aULL, 0x7c5cb1ddULL},
+{0x742ccf8ULL, 0x20d46ce8ULL, 0x665d5875ULL, 0xd83e1f65ULL, 0x742ccf8ULL, 0x27e530e5ULL, 0xcdd7c8ULL, 0xd83e1f65ULL, 0x251ec54ULL},
+{0xede89646ULL, 0x8cc55380ULL, 0x4c5a228bULL, 0x2d1202c0ULL, 0xede89646ULL, 0xd9cf0f09ULL, 0x226e6c1aULL, 0x2d1202c0ULL, 0xe6305f85ULL},
+{0xf3df7155ULL, 0x95671c4fULL, 0x10ef10a9ULL, 0x2c222ddULL, 0xf3df7155ULL, 0x2a55ba94ULL, 0xa4dfde17ULL, 0x2c222ddULL, 0xf07b9c29ULL},
+{0xb5242aaULL, 0x72cdb6e6ULL, 0xbf93d234ULL, 0x31e081f3ULL, 0xb5242aaULL, 0xa19f5fceULL, 0x54725314ULL, 0x31e081f3ULL, 0x60de461dULL},
+{0xf7b49d27ULL, 0xea5f14fdULL, 0x648bf8ecULL, 0x7de74603ULL, 0xf7b49d27ULL, 0x55791e74ULL, 0x2952f696ULL, 0x7de74603ULL, 0xabf09ff7ULL},
+{0xb29de37bULL, 0xb1595c19ULL, 0xa1c18f1ULL, 0x767c8b08ULL, 0xb29de37bULL, 0xda16e949ULL, 0x6fb6a6bfULL, 0x767c8b08ULL, 0x22a56ac9ULL},
+{0x97e406eULL, 0xf1c53f4eULL, 0xd1f86f49ULL, 0xf245a8bbULL, 0x97e406eULL, 0xf49bb8bULL, 0x9b4d659aULL, 0xf245a8bbULL, 0x922081a6ULL},
+{0x2c028904ULL, 0x4462cd4eULL, 0x871c5d81ULL, 0x63ff8316ULL, 0x2c028904ULL, 0x779c5ULL, 0xa81cd49eULL, 0x63ff8316ULL, 0x5b508f1cULL},
+{0x4e5f10fbULL, 0x76a63562ULL, 0xd3b81fe1ULL, 0x1f6f4029ULL, 0x4e5f10fbULL, 0xd2cc0d5eULL, 0x410a09edULL, 0x1f6f4029ULL, 0x1a95ffe7ULL},
+{0xa75dfb9fULL, 0x7b9271f1ULL, 0x4b5d359ULL, 0xcc5e72dcULL, 0xa75dfb9fULL, 0x4c77ee29ULL, 0xbd52e6fULL, 0xcc5e72dcULL, 0xd48b3f60ULL},
+{0x61073b9eULL, 0xb9ba62cdULL, 0x6278a254ULL, 0xb56c3a43ULL, 0x61073b9eULL, 0x77284796ULL, 0x7c5d9c6eULL, 0xb56c3a43ULL, 0x1b3dc291ULL},
+{0xd9b6fc85ULL, 0xc781db4bULL, 0x5a44636aULL, 0x7de63729ULL, 0xd9b6fc85ULL, 0xf036873bULL, 0x976a7eaaULL, 0x7de63729ULL, 0xb9f11397ULL},
+{0x36759ca9ULL, 0xd2ce1ce9ULL, 0xd918edecULL, 0x1f40a2c8ULL, 0x36759ca9ULL, 0x8358bc7aULL, 0x61706dfeULL, 0x1f40a2c8ULL, 0xff31cff1ULL},
+{0xf229624dULL, 0xfebf1b11ULL, 0x3db9b900ULL, 0x7723b278ULL, 0xf229624dULL, 0xeb8697c1ULL, 0x9bf91fdfULL, 0x7723b278ULL, 0x6d017d9bULL},
+{0xb7d16b61ULL, 0xd5d336ecULL, 0xfd7686adULL, 0x922323f9ULL, 0xb7d16b61ULL, 0xe1c8a692ULL, 0x42e14a8ULL, 0x922323f9ULL, 0xf9086c5ULL},
+{0xa551667ULL, 0x9841afd3ULL, 0x29416c25ULL, 0x3755cb89ULL, 0xa551667ULL, 0x1ab3e9f3ULL, 0x290804f5ULL, 0x3755cb89ULL, 0x5cf5a0fdULL},
+{0x31e5cca4ULL, 0x3ba06ba4ULL, 0xc0fc21eULL, 0xbc698795ULL, 0x31e5cca4ULL, 0xb097873ULL, 0x20b8c7daULL, 0xbc698795ULL, 0x6371d7dfULL},
+{0xbb15705bULL, 0x2058e359ULL, 0x8525b092ULL, 0x2a564efeULL, 0xbb15705bULL, 0xf0148d7cULL, 0x24f1de30ULL, 0x2a564efeULL, 0x13d188d4ULL},
+{0xcc1d943cULL, 0xf4da1622ULL, 0x22d77af2ULL, 0x3414c1ffULL, 0xcc1d943cULL, 0x941ae81fULL, 0x4cfc5966ULL, 0x3414c1ffULL, 0xba3ce38cULL},
+{0x18e5a23bULL, 0xc05f98f6ULL, 0x2754e2e8ULL, 0xf03c7e5eULL, 0x18e5a23bULL, 0xf83ce414ULL, 0x63f0e631ULL, 0xf03c7e5eULL, 0x290c97b0ULL},
+{0x1afbcc00ULL, 0x481d28fdULL, 0xd0fa01f5ULL, 0xf13af96cULL, 0x1afbcc00ULL, 0x10a39545ULL, 0x9d2fef83ULL, 0xf13af96cULL, 0xffdfe6b0ULL},
+{0xdb3c6777ULL, 0x44715d80ULL, 0x49df4598ULL, 0x794dbb18ULL, 0xdb3c6777ULL, 0x6f9ff542ULL, 0xb579e09aULL, 0x794dbb18ULL, 0x1fa09786ULL},
+{0xa603ba8eULL, 0xf70892fbULL, 0x9e6d420ULL, 0x81f3a2b7ULL, 0xa603ba8eULL, 0x44ff5713ULL, 0x44a6a668ULL, 0x81f3a2b7ULL, 0x3be29aeULL},
+{0xe4580e4bULL, 0x1f2c9e3ULL, 0x25e99beULL, 0xc647466fULL, 0xe4580e4bULL, 0x9addc80aULL, 0x69493cc4ULL, 0xc647466fULL, 0xaf1e0fdaULL},
+{0x9fc7adebULL, 0x4ee736acULL, 0x5cbe763cULL, 0xb4ea9a9eULL, 0x9fc7adebULL, 0x3e2c6a49ULL, 0xd3cca7d8ULL, 0xb4ea9a9eULL, 0xe94ef63eULL},
+{0x8a08d049ULL, 0xb8b6076ULL, 0x8171bc6dULL, 0x53cae864ULL, 0x8a08d049ULL, 0x1b23fa62ULL, 0x7d776e5aULL, 0x53cae864ULL, 0x10719e86ULL},
+{0xe64b9051ULL, 0x63375daULL, 0xaf194419ULL, 0x894c9ea7ULL, 0xe64b9051ULL, 0x9e9cc317ULL, 0xa295f7d3ULL, 0x894c9ea7ULL, 0x37c1b0b9ULL},
+{0xabe24be8ULL, 0x6847610dULL, 0x67572a12ULL, 0x396a9dd4ULL, 0xabe24be8ULL, 0xaabb189dULL, 0x89b694b0ULL, 0x396a9dd4ULL, 0x256c4008ULL},
+{0x8cb3d061ULL, 0x41b25d19ULL, 0xb7ce42c9ULL, 0x23ff243fULL, 0x8cb3d061ULL, 0xf6283553ULL, 0xb91a0a62ULL, 0x23ff243fULL, 0x1c6e701aULL},
+{0x26c7d466ULL, 0x6ff5efeULL, 0xc29d8ff3ULL, 0xcbb0c2deULL, 0x26c7d466ULL, 0x9ecc0873ULL, 0x71dd51bULL, 0xcbb0c2deULL, 0x96b0dcaULL},
+{0x9f05b35ULL, 0xbdcec168ULL, 0x1df53605ULL, 0xe247aa07ULL, 0x9f05b35ULL, 0xbdfa82ffULL, 0x581e12e4ULL, 0xe247aa07ULL, 0xf7fc3791ULL},
+{0x71dfb078ULL, 0x1074fc24ULL, 0x85581d69ULL, 0x9782c708ULL, 0x71dfb078ULL, 0xd6337159ULL, 0x4e5a674eULL, 0x9782c708ULL, 0x99f3003bULL},
+{0xf8ba6587ULL, 0xdd8e8d66ULL, 0x9fab57d4ULL, 0xcd263363ULL, 0xf8ba6587ULL, 0x913770e4ULL, 0x388bc3a2ULL, 0xcd263363ULL, 0xa365b53eULL},
+{0x3ecbadd1ULL, 0xc7e175e7ULL, 0x56187d37ULL, 0x26b86de6ULL, 0x3ecbadd1ULL, 0x8947497aULL, 0xf4e90df3ULL, 0x26b86de6ULL, 0x859dfe63ULL},
+{0x90a97125ULL, 0x1be8e181ULL, 0x980d4ce4ULL, 0x4ad77bdeULL, 0x90a97125ULL, 0x7a99051bULL, 0x11141eULL, 0x4ad77bdeULL, 0xec8d1bfeULL}},
+  {{0x4c2b3c08ULL, 0x12865ffeULL, 0xa7ff10dcULL, 0xb81d093dULL, 0x4c2b3c08ULL, 0xc4e5f9c9ULL, 0x957bb2eaULL, 0xb81d093dULL, 0xdd4ec94aULL},
+{0x1cb97daaULL, 0x143d6eacULL, 0x670b6abdULL, 0x60bf8225ULL, 0x1cb97daaULL, 0x83ac1c26ULL, 0xbb932472ULL, 0x60bf8225ULL, 0x1e4e4362ULL},
+{0x42db39cbULL, 0x7e52eb29ULL, 0xc0ca1269ULL, 0xb8a01135ULL, 0x42db39cbULL, 0x6e9d5787ULL, 0x504568eeULL, 0xb8a01135ULL, 0x78990557ULL},
+{0xbb18230eULL, 0x8df8590fULL, 0x76c0f636ULL, 0x3d10cbc3ULL, 0xbb18230eULL, 0x7e882542ULL, 0x56a1f750ULL, 0x3d10cbc3ULL, 0x3824f6ecULL},
+{0xd85f9fe5ULL, 0x7da7a1ecULL, 0xa59b8eebULL, 0x91883353ULL, 0xd85f9fe5ULL, 0x15bfadd9ULL, 0x90bc612eULL, 0x91883353ULL, 0xe90b76f9ULL},
+{0xc0dc500bULL, 0x1dcb0e32ULL, 0xc1d2f2d4ULL, 0x2fcd71e7ULL, 0xc0dc500bULL, 0x8396da88ULL, 0x4798c4c9ULL, 0x2fcd71e7ULL, 0xa1457524ULL},
+{0xc3881860ULL, 0x28ad7cceULL, 0xa157993fULL, 0x6b584d18ULL, 0xc3881860ULL, 0xa501c9b3ULL, 0x7788df7bULL, 0x6b584d18ULL, 0x6393ad7fULL},
+{0x92f29a2fULL, 0x52e935bdULL, 0xc66b0f41ULL, 0x6c988025ULL, 0x92f29a2fULL, 0x50140690ULL, 0xd97ede49ULL, 0x6c988025ULL, 0x6c471ca4ULL},
+{0x22ec29a5ULL, 0x14ede6a1ULL, 0x371090cfULL, 0x81274e86ULL, 0x22ec29a5ULL, 0x311472f5ULL, 0xa3a5d40aULL, 0x81274e86ULL, 0x89e1c7b6ULL},
+{0x22bcc33bULL, 0x4dda93f9ULL, 0x5ddac2e5ULL, 0xf8692f17ULL, 0x22bcc33bULL, 0x10f95be7ULL, 0xba406e1fULL, 0xf8692f17ULL, 0x9760f2a2ULL},
+{0xc82afa0bULL, 0xf83d835dULL, 0xc54fc400ULL, 0x21ccba3bULL, 0xc82afa0bULL, 0x39e025acULL, 0x6fb2ed90ULL, 0x21ccba3bULL, 0x126ed795ULL},
+{0x6f170adULL, 0x7e842e8dULL, 0x6519ab64ULL, 0x16bbc2ccULL, 0x6f170adULL, 0xaec50d68ULL, 0xc0010219ULL, 0x16bbc2ccULL, 0xa3702ef0ULL},
+{0x5f45f0b6ULL, 0xa4a4a358ULL, 0x28c3120fULL, 0xb1b8e0a1ULL, 0x5f45f0b6ULL, 0xec6a2b6eULL, 0x261aacd3ULL, 0xb1b8e0a1ULL, 0x4f65c18ULL},
+{0xb4edc194ULL, 0x82194380ULL, 0x8c226d6fULL, 0x26094350ULL, 0xb4edc194ULL, 0x5ff4ef9ULL, 0x1c877eaaULL, 0x26094350ULL, 0x1c918f5dULL},
+{0x918a5020ULL, 0xdbe5069aULL, 0xe50afca7ULL, 0x228077aULL, 0x918a5020ULL, 0x3ec8221bULL, 0x32396ff6ULL, 0x228077aULL, 0x813dab29ULL},
+{0x71238a8ULL, 0xc831e2c0ULL, 0x9494fd9cULL, 0x14cac660ULL, 0x71238a8ULL, 0x94befd0fULL, 0xc0db112eULL, 0x14cac660ULL, 0xf0fdb000ULL},
+{0xeee3c42eULL, 0x22160398ULL, 0xd74d1eb6ULL, 0x691bda36ULL, 0xeee3c42eULL, 0x18f3633ULL, 0x7ae6ba8ULL, 0x691bda36ULL, 0xe46042a8ULL},
+{0x88e60e3dULL, 0x1ee7be73ULL, 0x5809faf8ULL, 0xcc89e3d0ULL, 0x88e60e3dULL, 0xf66fc7bULL, 0xce5c7d76ULL, 0xcc89e3d0ULL, 0x9531c751ULL},
+{0x484f197fULL, 0xe3b524efULL, 0xe80432edULL, 0x4b77041cULL, 0x484f197fULL, 0x9cfdd908ULL, 0xcbc6c4ULL, 0x4b77041cULL, 0x395915a2ULL},
+{0xee1a3092ULL, 0xe0afc09eULL, 0xa359f15fULL, 0x9bf6091fULL, 0xee1a3092ULL, 0x3a18a769ULL, 0xac75bbd1ULL, 0x9bf6091fULL, 0x249949cbULL},
+{0xd80a85feULL, 0x5c327672ULL, 0xc9d327e0ULL, 0xb80e6ce7ULL, 0xd80a85feULL, 0x6385412aULL, 0xe097494bULL, 0xb80e6ce7ULL, 0x2ef90f6eULL},
+{0xfeab79fcULL, 0xcbcf7fa9ULL, 0x9ffc2856ULL, 0xad268fa7ULL, 0xfeab79fcULL, 0x1dbebd96ULL, 0xf24301eULL, 0xad268fa7ULL, 0x7782be41ULL},
+{0x123fe449ULL, 0xce4bc307ULL, 0xf7b92dc4ULL, 0xf894718bULL, 0x123fe449ULL, 0x7c4de008ULL, 0xc4b838d0ULL, 0xf894718bULL, 0x72a0955fULL},
+{0x1cd16317ULL, 0xce7f34c9ULL, 0x3e634550ULL, 0x98fc3ba6ULL, 0x1cd16317ULL, 0xb91c8d22ULL, 0xe943c7daULL, 0x98fc3ba6ULL, 0x1c475081ULL},
+{0x8f896811ULL, 0xa49b5e64ULL, 0xb8dbc608ULL, 0xa646d383ULL, 0x8f896811ULL, 0x217268c9ULL, 0xdb3c8ffbULL, 0xa646d383ULL, 0x7d3fe3cbULL},
+{0xb145a951ULL, 0xd224c21cULL, 0xf8c4f17bULL, 0xa5e8175ULL, 0xb145a951ULL, 0x358fec5dULL, 0xc6be0b0cULL, 0xa5e8175ULL, 0x234d62f5ULL},
+{0x75301ecbULL, 0x75055378ULL, 0x5d4d4a7ULL, 0x7a2560ccULL, 0x75301ecbULL, 0xe2154516ULL, 0xa1441da5ULL, 0x7a2560ccULL, 0xa4c04227ULL},
+{0x716c29b0ULL, 0xa5d9b41fULL, 0x85ead7dULL, 0xcf8f1bdbULL, 0x716c29b0ULL, 0xd6959295ULL, 0xde88d6eULL, 0xcf8f1bdbULL, 0x9e9a7b71ULL},
+{0x7b47448aULL, 0x8cb0125fULL, 0xc550e4e1ULL, 0x884a3086ULL, 0x7b47448aULL, 0xe4046852ULL, 0x7ff634daULL, 0x884a3086ULL, 0xe732db50ULL},
+{0xe65166c8ULL, 0x1c49cfc3ULL, 0x15ec364cULL, 0x37d944f8ULL, 0xe65166c8ULL, 0xb3463289ULL, 0x4a4b7398ULL, 0x37d944f8ULL, 0x355c0120ULL},
+{0xeecae48dULL, 0x88affcc6ULL, 0x9e3d8b55ULL, 0xfc66f3f0ULL, 0xeecae48dULL, 0x46b2ac7bULL, 0xdb93448bULL, 0xfc66f3f0ULL, 0x11147fc2ULL},
+{0x894603d2ULL, 0xc8ef8002ULL, 0x7549cdfdULL, 0x23ae5eb6ULL, 0x894603d2ULL, 0x6c6bee1dULL, 0x7a251501ULL, 0x23ae5eb6ULL, 0xf3f6e8beULL},
+{0x249161dcULL, 0x2944e686ULL, 0x7bab998aULL, 0x896f4660ULL, 0x249161dcULL, 0x18e2e192ULL, 0xafefbbe3ULL, 0x896f4660ULL, 0x98e78fd6ULL},
+{0x7191482fULL, 0x3e25de61ULL, 0xdac961e0ULL, 0xf501623bULL, 0x7191482fULL, 0x822fed5fULL, 0xbcbb3b48ULL, 0xf501623bULL, 0xb05347faULL},
+{0x3499e27aULL, 0xe76a66c3ULL, 0xf496f09ULL, 0xdb5bdb72ULL, 0x3499e27aULL, 0x81ae6beULL, 0x42cffdf0ULL, 0xdb5bdb72ULL, 0xbe96c3c2ULL},
+{0xaf42da26ULL, 0xdf482cb9ULL, 0x6f6a1b8fULL, 0xea9f609fULL, 0xaf42da26ULL, 0x9a46559aULL, 0xb83f540fULL, 0xea9f609fULL, 0x366de1e6ULL},
+{0xe6889e13ULL, 0xdff2c83aULL, 0x612ad547ULL, 0xb3bd6a15ULL, 0xe6889e13ULL, 0x431d3cfcULL, 0xc61dcaadULL, 0xb3bd6a15ULL, 0xfa769a3dULL},
+{0x44bc4decULL, 0xf7ab48f5ULL, 0x398225e5ULL, 0x4cde6b41ULL, 0x44bc4decULL, 0x7e2a1192ULL, 0xd4320f6bULL, 0x4cde6b41ULL, 0x5db92e3cULL},
+{0xb5789007ULL, 0x3183a8dULL, 0x35912e50ULL, 0x799ce043ULL, 0xb5789007ULL, 0x950f66d2ULL, 0x5a71ac2ULL, 0x799ce043ULL, 0x27b9740ULL},
+{0x784016feULL, 0x5cfffaf3ULL, 0xd627ab60ULL, 0x877db891ULL, 0x784016feULL, 0xbc4b9cffULL, 0xffb6d8a3ULL, 0x877db891ULL, 0x56a0389eULL},
+{0xbfbd568bULL, 0x3ca7cb79ULL, 0x6ee00754ULL, 0xa6c79cf6ULL, 0xbfbd568bULL, 0x536b828eULL, 0x8ee7e4d4ULL, 0xa6c79cf6ULL, 0xe6515e4bULL},
+{0x98e50312ULL, 0x83dcaa22ULL, 0x55d00c21ULL, 0x2bf75f3bULL, 0x98e50312ULL, 0xf2ad7eaULL, 0x9c9ab4b5ULL, 0x2bf75f3bULL, 0x73152af6ULL},
+{0x4ff61bebULL, 0x59741150ULL, 0x393ad47aULL, 0xd1ee047fULL, 0x4ff61bebULL, 0xb5cd2e9eULL, 0x7c425670ULL, 0xd1ee047fULL, 0x5771eaa7ULL},
+{0xf53dbdf6ULL, 0xb681fb9eULL, 0xaa329aadULL, 0x14ce4d63ULL, 0xf53dbdf6ULL, 0x52c97c47ULL, 0x14a7b590ULL, 0x14ce4d63ULL, 0xb0098c5aULL},
+{0x5932970ULL, 0x640c5192ULL, 0xe948f786ULL, 0x36f59c5fULL, 0x5932970ULL, 0xbe953ed5ULL, 0x4c73b8f2ULL, 0x36f59c5fULL, 0xad20724aULL},
+{0xeeb5fbfdULL, 0x1af1b41cULL, 0x8efd9960ULL, 0xb02d8597ULL, 0xeeb5fbfdULL, 0x1c32cd47ULL, 0x941ddb09ULL, 0xb02d8597ULL, 0xcbb94f3aULL},
+{0x71bc30d1ULL, 0x84b9ed67ULL, 0x8e9220d6ULL, 0x4b8214a1ULL, 0x71bc30d1ULL, 0x4d0c4495ULL, 0xc4743bd8ULL, 0x4b8214a1ULL, 0xd9fbf2b4ULL},
+{0x35783addULL, 0x2d7f8265ULL, 0xe4b98191ULL, 0x119082c0ULL, 0x35783addULL, 0x94d35229ULL, 0x873cbc2fULL, 0x119082c0ULL, 0xd06de001ULL},
+{0x9f618733ULL, 0xaba34731ULL, 0xef4a3c7dULL, 0x510144b6ULL, 0x9f618733ULL, 0x373ba495ULL, 0x9a45d6bfULL, 0x510144b6ULL, 0x8985d2f6ULL},
+{0xf67535d9ULL, 0x8f8fe39cULL, 0xceb5f5efULL, 0xd5e90149ULL, 0xf67535d9ULL, 0x85fdb946ULL, 0x1bb37fdcULL, 0xd5e90149ULL, 0x340fb6dULL},
+{0xd19557dbULL, 0xf653ee1ULL, 0x622760e0ULL, 0xf851d9bULL, 0xd19557dbULL, 0xa140ddefULL, 0xd259742fULL, 0xf851d9bULL, 0x4c020af2ULL},
+{0xfa1bb9d3ULL, 0x916e9cf4ULL, 0xc34a808bULL, 0xfe9d6fc1ULL, 0xfa1bb9d3ULL, 0x7564fc7eULL, 0xac0965fcULL, 0xfe9d6fc1ULL, 0x72dc58f1ULL},
+{0xdaba0982ULL, 0xdc5a4d2ULL, 0xefaf855eULL, 0x15c6009bULL, 0xdaba0982ULL, 0x4a07e5dULL, 0xed6db29eULL, 0x15c6009bULL, 0xee88134eULL},
+{0x1fc65130ULL, 0x7a9da0dULL, 0x3a74309dULL, 0x52e4880bULL, 0x1fc65130ULL, 0x2d5318d6ULL, 0x265fcffULL, 0x52e4880bULL, 0xe8aac291ULL},
+{0x20a77adaULL, 0x93303a7aULL, 0x38ef6403ULL, 0x87dcad8cULL, 0x20a77adaULL, 0x97756409ULL, 0x465aad3aULL, 0x87dcad8cULL, 0x8261aa3dULL},
+{0xfe52c502ULL, 0x5dac5d97ULL, 0x9ab42241ULL, 0x6a05060cULL, 0xfe52c502ULL, 0xdcf096baULL, 0x3952c626ULL, 0x6a05060cULL, 0xe44aa4c6ULL},
+{0xc0aba020ULL, 0x426cfd5eULL, 0xd7ab3b56ULL, 0x30a141a6ULL, 0xc0aba020ULL, 0xcde9d682ULL, 0xc90efb03ULL, 0x30a141a6ULL, 0x5f0c7ca7ULL},
+{0x9108e2f8ULL, 0x5953b4baULL, 0x2342c5d7ULL, 0x53582c7aULL, 0x9108e2f8ULL, 0xc209ebbeULL, 0x83f291efULL, 0x53582c7aULL, 0x8887280dULL},
+{0xe24bdfc9ULL, 0x7472cba4ULL, 0xb59ea5aULL, 0xbb4453d0ULL, 0xe24bdfc9ULL, 0x4a9fc0ebULL, 0xfaecd24fULL, 0xbb4453d0ULL, 0xad704105ULL},
+{0x52e52d9dULL, 0x15a6d29eULL, 0x6495adceULL, 0x7df5a332ULL, 0x52e52d9dULL, 0xa5f45c4eULL, 0x63ac3c57ULL, 0x7df5a332ULL, 0xd8190570ULL},
+{0x6c39a0b1ULL, 0x99effa06ULL, 0x99b0be36ULL, 0x384025c0ULL, 0x6c39a0b1ULL, 0xcdfd198dULL, 0xf3008fe5ULL, 0x384025c0ULL, 0x1d430cd3ULL},
+{0x6922d132ULL, 0x795023b0ULL, 0x981df694ULL, 0xcfca1bddULL, 0x6922d132ULL, 0xfe0a4aa8ULL, 0x4161fe70ULL, 0xcfca1bddULL, 0x1533e6aaULL},
+{0x996b7d7eULL, 0x4cbc522cULL, 0x8d777cb5ULL, 0x59850651ULL, 0x996b7d7eULL, 0x9b01e36aULL, 0x48abf465ULL, 0x59850651ULL, 0x146a6afcULL},
+{0xb4eb5601ULL, 0xecb3569dULL, 0xd846238ULL, 0xc85e29aeULL, 0xb4eb5601ULL, 0xa751559cULL, 0x137824f7ULL, 0xc85e29aeULL, 0xbb981dfeULL},
+{0xd24e86e0ULL, 0x4a1e1f83ULL, 0x6293b744ULL, 0x54775885ULL, 0xd24e86e0ULL, 0xefbe54eULL, 0x7578900fULL, 0x54775885ULL, 0xb584bd52ULL},
+{0xf66f2e96ULL, 0x16f65ba9ULL, 0xba33ae77ULL, 0x485e3a38ULL, 0xf66f2e96ULL, 0x4c78a162ULL, 0x67a25a2fULL, 0x485e3a38ULL, 0xc67da211ULL},
+{0x1ede6548ULL, 0xa22d03d2ULL, 0x39ca5f5dULL, 0xd2c7b066ULL, 0x1ede6548ULL, 0x9f009828ULL, 0xc74e745eULL, 0xd2c7b066ULL, 0x2a3711dbULL},
+{0xf1db64ecULL, 0x9ae09050ULL, 0xd2b416b7ULL, 0x6af2ab21ULL, 0xf1db64ecULL, 0x7a7591d3ULL, 0x653a85ffULL, 0x6af2ab21ULL, 0xe6ced314ULL},
+{0x873c3611ULL, 0x9bb0a0c0ULL, 0x95d9ecf9ULL, 0x81e6aa5bULL, 0x873c3611ULL, 0x61c9efb3ULL, 0x465f271eULL, 0x81e6aa5bULL, 0xd1601623ULL},
+{0x1d7cc358ULL, 0x22ea6329ULL, 0xdeb34721ULL, 0xaccfcfa1ULL, 0x1d7cc358ULL, 0x6cf5da2dULL, 0x60c0dddULL, 0xaccfcfa1ULL, 0xe905d932ULL},
+{0x67c8125cULL, 0xc06f1318ULL, 0xfd831441ULL, 0xa85da97ULL, 0x67c8125cULL, 0xdc2608a7ULL, 0x62bfd949ULL, 0xa85da97ULL, 0x94e274d1ULL},
+{0xdeeaf2eULL, 0x68978242ULL, 0x940115d7ULL, 0x5206b71aULL, 0xdeeaf2eULL, 0x74e7eaa2ULL, 0x56034600ULL, 0x5206b71aULL, 0x9e7bea0cULL},
+{0x9a270db8ULL, 0x2b2331b6ULL, 0x33a75bdcULL, 0x70074f7bULL, 0x9a270db8ULL, 0x4c12ce08ULL, 0xf2d51fb6ULL, 0x70074f7bULL, 0xa4234b97ULL},
+{0x1c907402ULL, 0x1fc925b9ULL, 0x73a435a7ULL, 0x3a03b869ULL, 0x1c907402ULL, 0x99cfb91dULL, 0x503756adULL, 0x3a03b869ULL, 0xba6e370aULL},
+{0xf64e1ee6ULL, 0xe057376dULL, 0x69f8eadcULL, 0x9855ac7bULL, 0xf64e1ee6ULL, 0x5cc1ed0aULL, 0x429a7160ULL, 0x9855ac7bULL, 0xc907b0d7ULL},
+{0xb5715592ULL, 0x82f35ebULL, 0x87c97340ULL, 0x8dee927fULL, 0xb5715592ULL, 0x3b17fedbULL, 0x8d42611bULL, 0x8dee927fULL, 0x9dc073e6ULL},
+{0x37fb44f5ULL, 0x17c9620dULL, 0x94cad7aULL, 0x5d9052fdULL, 0x37fb44f5ULL, 0x5d5139fbULL, 0x52f4978aULL, 0x5d9052fdULL, 0xb879efe7ULL},
+{0x29354226ULL, 0x1c3b2c8cULL, 0x40bbd0ULL, 0x2f15667eULL, 0x29354226ULL, 0x43f77ab9ULL, 0x8e89f760ULL, 0x2f15667eULL, 0x3f298eedULL},
+{0x64db6698ULL, 0x21a3ea89ULL, 0xcd996c5eULL, 0x8c2fe771ULL, 0x64db6698ULL, 0x59e0a4f8ULL, 0x8016c9d1ULL, 0x8c2fe771ULL, 0x89cb3ee1ULL},
+{0xef0c1797ULL, 0xa272a1c7ULL, 0x1e844cf4ULL, 0x5c220044ULL, 0xef0c1797ULL, 0x9d95e122ULL, 0x77d03936ULL, 0x5c220044ULL, 0xd89a173aULL},
+{0xa4ea6d2eULL, 0xff38bdeULL, 0xd152177dULL, 0xc875488aULL, 0xa4ea6d2eULL, 0xfd686cdaULL, 0x78b358a3ULL, 0xc875488aULL, 0x2b0925abULL},
+{0xe1a3658aULL, 0x255445d2ULL, 0xcc876c70ULL, 0xe10f9051ULL, 0xe1a3658aULL, 0x7568a963ULL, 0xce81dd8aULL, 0xe10f9051ULL, 0xf14f0ee5ULL},
+{0xa0d3c9d0ULL, 0xf69fd6d2ULL, 0x67b657abULL, 0xb415b81cULL, 0xa0d3c9d0ULL, 0x7abb12b9ULL, 0xd2f5e38bULL, 0xb415b81cULL, 0x24302950ULL},
+{0xf1d699fdULL, 0xb9a5d0fULL, 0x696bc847ULL, 0x3e4f87c4ULL, 0xf1d699fdULL, 0x4943908bULL, 0xe0f541e9ULL, 0x3e4f87c4ULL, 0x8d256e3aULL},
+{0xcee6caabULL, 0xeeee2603ULL, 0xbe952abcULL, 0xf0c42cccULL, 0xcee6caabULL, 0xf4ae7a41ULL, 0x729eb838ULL, 0xf0c42cccULL, 0x59540007ULL},
+{0xc9ef7ba8ULL, 0xd6474589ULL, 0x49b3b7f7ULL, 0x54a034a0ULL, 0xc9ef7ba8ULL, 0x5e70da79ULL, 0xff8a8744ULL, 0x54a034a0ULL, 0xe82da6deULL},
+{0x1286812fULL, 0x84984ffeULL, 0xb18c8557ULL, 0x5ab5806bULL, 0x1286812fULL, 0xfe55b965ULL, 0xaf8f1cf5ULL, 0x5ab5806bULL, 0x8c51f4eULL},
+{0xfb6dcc0bULL, 0x5cd54dabULL, 0x8655bc2dULL, 0x7886c63cULL, 0xfb6dcc0bULL, 0xf8954c32ULL, 0x7bfef2eeULL, 0x7886c63cULL, 0xc964eef0ULL},
+{0x27db2528ULL, 0xb88f6e9dULL, 0xa15baa43ULL, 0x5feb54bbULL, 0x27db2528ULL, 0xf1dc2d57ULL, 0x6107b1c4ULL, 0x5feb54bbULL, 0xa06d9494ULL},
+{0xfc9fe7cfULL, 0xf171b730ULL, 0x39012de1ULL, 0x81eca2a2ULL, 0xfc9fe7cfULL, 0x2bd23617ULL, 0x5eec5557ULL, 0x81eca2a2ULL, 0x25d43d6fULL},
+{0x2643e5daULL, 0x5dca8cd2ULL, 0xa2ff1785ULL, 0xa24a106dULL, 0x2643e5daULL, 0x4bbf87b9ULL, 0x86422c6fULL, 0xa24a106dULL, 0xc3993e1aULL},
+{0x43ab2df6ULL, 0x65823272ULL, 0x55f92329ULL, 0xd4bc5187ULL, 0x43ab2df6ULL, 0xbf0a7f0cULL, 0x28263193ULL, 0xd4bc5187ULL, 0xe0a76f64ULL},
+{0xe1db6bebULL, 0xb10913a9ULL, 0xda301eULL, 0xe549a5f6ULL, 0xe1db6bebULL, 0x456687c2ULL, 0x2fa5d4afULL, 0xe549a5f6ULL, 0x20bc24aULL},
+{0x24168341ULL, 0x7f098d2eULL, 0xddd66558ULL, 0x1efdb462ULL, 0x24168341ULL, 0x845d551cULL, 0x5d78c132ULL, 0x1efdb462ULL, 0xec6c257bULL},
+{0x633a1536ULL, 0xfb7f9eafULL, 0xb8d095aeULL, 0xa64b1447ULL, 0x633a1536ULL, 0x641f763aULL, 0xd787543eULL, 0xa64b1447ULL, 0x36a259e3ULL},
+{0xb9d94d77ULL, 0x3dd17581ULL, 0x5f61ab02ULL, 0xb049b6a3ULL, 0xb9d94d77ULL, 0x19cf7932ULL, 0xae72cd1fULL, 0xb049b6a3ULL, 0xedc88766ULL},
+{0xb6b5ef9eULL, 0x3373547eULL, 0xbb1807cULL, 0xfadbf0aeULL, 0xb6b5ef9eULL, 0x2ce78242ULL, 0x11f44735ULL, 0xfadbf0aeULL, 0x54d5952aULL},
+{0xb56f1465ULL, 0xdf2ad416ULL, 0x522aea97ULL, 0x5668fc44ULL, 0xb56f1465ULL, 0xffcdac09ULL, 0x3fa5d453ULL, 0x5668fc44ULL, 0x565fc6d3ULL},
+{0x3543e835ULL, 0x4b9d1241ULL, 0x749fb69eULL, 0x5e0e5e72ULL, 0x3543e835ULL, 0x91bc4f96ULL, 0x6d7671f1ULL, 0x5e0e5e72ULL, 0x942f8c45ULL},
+{0x87a45747ULL, 0x7ebb15dfULL, 0x80376b5fULL, 0xd4f4b01bULL, 0x87a45747ULL, 0x113d0219ULL, 0xefc10692ULL, 0xd4f4b01bULL, 0x9cf883cbULL},
+{0x4d4e23b1ULL, 0xfcf9ac96ULL, 0x8efffc85ULL, 0xc2ebd22cULL, 0x4d4e23b1ULL, 0x36691391ULL, 0x50596237ULL, 0xc2ebd22cULL, 0xfef01664ULL},
+{0x1e7c12d4ULL, 0x9d48c40bULL, 0xea9f5d4cULL, 0x6f856f54ULL, 0x1e7c12d4ULL, 0x87948c4fULL, 0xee20f5a6ULL, 0x6f856f54ULL, 0x6a61adb6ULL},
+{0x5df0e11cULL, 0xc7b7bdd6ULL, 0x8689b286ULL, 0xc0050e6cULL, 0x5df0e11cULL, 0xb98483e8ULL, 0xa57b70f6ULL, 0xc0050e6cULL, 0x5aa2e007ULL},
+{0xdb61345cULL, 0xbc1fa1d8ULL, 0x2a719570ULL, 0x18a6bf4dULL, 0xdb61345cULL, 0xf997a99cULL, 0x224ac125ULL, 0x18a6bf4dULL, 0xb2329439ULL},
+{0x5f174583ULL, 0xa107bef9ULL, 0xf7c4046dULL, 0x4c5681bcULL, 0x5f174583ULL, 0x912b6cc9ULL, 0x851b6898ULL, 0x4c5681bcULL, 0x4cc37381ULL},
+{0xf0753c17ULL, 0xbad0963cULL, 0x7eb1c18ULL, 0xc1d76181ULL, 0xf0753c17ULL, 0x828c4c9cULL, 0xe6e8c9e3ULL, 0xc1d76181ULL, 0xd9874876ULL},
+{0x94348057ULL, 0x2f60a9e5ULL, 0x54fdc2b9ULL, 0x86e0569ULL, 0x94348057ULL, 0xc2aefeb7ULL, 0x3704d18eULL, 0x86e0569ULL, 0x84ac8dbdULL},
+{0xb8a59935ULL, 0x188ed911ULL, 0xbd39bb78ULL, 0x102e302fULL, 0xb8a59935ULL, 0x1271f7eULL, 0xe74f8d69ULL, 0x102e302fULL, 0xafcf09a5ULL},
+{0x7ab70c85ULL, 0xbc5bdcfeULL, 0x8acc5c83ULL, 0xfeeafc01ULL, 0x7ab70c85ULL, 0x5b9dd7ddULL, 0xc5dc9885ULL, 0xfeeafc01ULL, 0xd051803aULL},
+{0x42d5076dULL, 0x4f035a31ULL, 0x87842152ULL, 0x49e98bc7ULL, 0x42d5076dULL, 0x6da5c073ULL, 0x5321a6d4ULL, 0x49e98bc7ULL, 0x2e6e311cULL},
+{0x68073b82ULL, 0x5b3cf6e2ULL, 0xf8697259ULL, 0x9154486cULL, 0x68073b82ULL, 0x20906406ULL, 0xba5c8065ULL, 0x9154486cULL, 0xb6753cbcULL},
+{0x906c7089ULL, 0xb8269735ULL, 0x3b4ed387ULL, 0xd75c4478ULL, 0x906c7089ULL, 0xe613ffbULL, 0xaa558d60ULL, 0xd75c4478ULL, 0x6f5de0b6ULL},
+{0xa2fe0925ULL, 0xc743674dULL, 0xd5019986ULL, 0x99031b61ULL, 0xa2fe0925ULL, 0xaa35d9c6ULL, 0x2f875d7aULL, 0x99031b61ULL, 0x623de36cULL},
+{0x46b44adeULL, 0x27e97de2ULL, 0xbfa67ccULL, 0x4d1101daULL, 0x46b44adeULL, 0xf45cf9dULL, 0x9f20482aULL, 0x4d1101daULL, 0x3cf05673ULL},
+{0xd3a82170ULL, 0xf8829351ULL, 0x17540020ULL, 0xbbbe0bbbULL, 0xd3a82170ULL, 0x21b221e1ULL, 0x2d12733fULL, 0xbbbe0bbbULL, 0xc638d40fULL},
+{0xc28ab99bULL, 0x1b1fc136ULL, 0x8086e9a2ULL, 0x56ea274eULL, 0xc28ab99bULL, 0xa8c3ee9fULL, 0x877b7a3dULL, 0x56ea274eULL, 0x615ad0d4ULL},
+{0x30454b4fULL, 0x7ca41f27ULL, 0x1b5f45c2ULL, 0x6d7c9642ULL, 0x30454b4fULL, 0x6099f575ULL, 0x8d0d5b0dULL, 0x6d7c9642ULL, 0x3a2ea3ceULL},
+{0xc1c1b0cbULL, 0xb9fb4108ULL, 0x24f433deULL, 0xbb22c522ULL, 0xc1c1b0cbULL, 0x937b199aULL, 0x70da11fdULL, 0xbb22c522ULL, 0x1efb0891ULL},
+{0x773f3118ULL, 0xc3d06165ULL, 0xd3ac5b4dULL, 0x3b68703bULL, 0x773f3118ULL, 0x6269005bULL, 0xa53cb65bULL, 0x3b68703bULL, 0x59be08cfULL},
+{0x53d83f6aULL, 0xe073a2eaULL, 0x75092ba0ULL, 0xe05c4922ULL, 0x53d83f6aULL, 0x29168d51ULL, 0xcaef8e0dULL, 0xe05c4922ULL, 0xb28c8998ULL},
+{0x9af58e6ULL, 0x6e406786ULL, 0xa92f0d1eULL, 0x474773daULL, 0x9af58e6ULL, 0x71150e19ULL, 0xe45ac5d8ULL, 0x474773daULL, 0x5513d00ULL},
+{0xe98192afULL, 0xec12ac6ULL, 0xa7750f18ULL, 0xf21a534fULL, 0xe98192afULL, 0xb18e6d2eULL, 0x8033ba08ULL, 0xf21a534fULL, 0xbabadc0aULL},
+{0xc4854ce1ULL, 0xfc93c160ULL, 0x6fa85e15ULL, 0xd615f803ULL, 0xc4854ce1ULL, 0xf4d86232ULL, 0xa51ac0fULL, 0xd615f803ULL, 0xaf0fa34eULL},
+{0x134bcd96ULL, 0x284cb012ULL, 0xf4091870ULL, 0x307591f4ULL, 0x134bcd96ULL, 0x3eff54aeULL, 0xd07c39c0ULL, 0x307591f4ULL, 0x64e6a8ffULL},
+{0x7b56493bULL, 0x63583caULL, 0x80ae1fedULL, 0x45ac148bULL, 0x7b56493bULL, 0x43c4d833ULL, 0x8415837dULL, 0x45ac148bULL, 0xeb160c22ULL},
+{0x907ca955ULL, 0xafc28af0ULL, 0xc26bdac9ULL, 0x5d300a70ULL, 0x907ca955ULL, 0x1847c482ULL, 0xacf6990fULL, 0x5d300a70ULL, 0x3c924b2fULL},
+{0x94f31375ULL, 0x4b787f3dULL, 0x827c5764ULL, 0xa3b3eb41ULL, 0x94f31375ULL, 0xbb698cb7ULL, 0xcfc12123ULL, 0xa3b3eb41ULL, 0x774d27a9ULL},
+{0x69c1a425ULL, 0xf920177bULL, 0xbb74ff64ULL, 0x64a8555fULL, 0x69c1a425ULL, 0x5a7980cULL, 0x8ac1a695ULL, 0x64a8555fULL, 0xa61bbb13ULL},
+{0x4cefc91bULL, 0x45c271cULL, 0xdd86a2aeULL, 0x339320b8ULL, 0x4cefc91bULL, 0xe7dc1f63ULL, 0x6fc4b41cULL, 0x339320b8ULL, 0x611a274dULL},
+{0x8e5ac892ULL, 0x66a84fccULL, 0x35671ce7ULL, 0x452d5618ULL, 0x8e5ac892ULL, 0x4aa78f9bULL, 0xb3185d70ULL, 0x452d5618ULL, 0x3474d709ULL},
+{0x44559432ULL, 0x4f8c77c8ULL, 0xbad32f4dULL, 0x7d25f052ULL, 0x44559432ULL, 0xa48b563dULL, 0xb578b2faULL, 0x7d25f052ULL, 0x45614e07ULL},
+{0xc2d3ff1ULL, 0x1c261ae9ULL, 0x232bbc16ULL, 0x22d85501ULL, 0xc2d3ff1ULL, 0xb712914ULL, 0x97ea6a40ULL, 0x22d85501ULL, 0x63de1b7ULL},
+{0x8c3a20b6ULL, 0x32c4e61eULL, 0xe880384cULL, 0x908e5cefULL, 0x8c3a20b6ULL, 0x62b75ab9ULL, 0xffc59c72ULL, 0x908e5cefULL, 0x3be25e08ULL},
+{0xa3127f2eULL, 0x4021fb18ULL, 0x96dc142bULL, 0x961ba3feULL, 0xa3127f2eULL, 0x5a94d559ULL, 0x17cacd7cULL, 0x961ba3feULL, 0x70a87d0aULL},
+{0xdb447711ULL, 0x16c4d90ULL, 0xc74990eaULL, 0xf5351fULL, 0xdb447711ULL, 0x576b367aULL, 0x34ce42b3ULL, 0xf5351fULL, 0x9896ba9bULL},
+{0xf614e1a8ULL, 0x503eb33aULL, 0x62ce621bULL, 0x61dc5033ULL, 0xf614e1a8ULL, 0x663b4fe1ULL, 0x9bf68311ULL, 0x61dc5033ULL, 0xfe3eb81bULL},
+{0xd3c09e4cULL, 0x4cc5d36dULL, 0x7258fcf7ULL, 0x45bb5a64ULL, 0xd3c09e4cULL, 0x30f6b0ffULL, 0xfaf0110eULL, 0x45bb5a64ULL, 0xa8506ecaULL},
+{0x54d3caaULL, 0x6889f5bcULL, 0x704ba73cULL, 0xefd87ae5ULL, 0x54d3caaULL, 0xf3faa11cULL, 0xba8758deULL, 0xefd87ae5ULL, 0xa561ae0dULL},
+{0x32794f30ULL, 0x57afa185ULL, 0xc07155aeULL, 0x8a2465e4ULL, 0x32794f30ULL, 0xe0f62e18ULL, 0xb90dcb2fULL, 0x8a2465e4ULL, 0x17450aa1ULL},
+{0x4dcd673fULL, 0x66d92c83ULL, 0xc9903966ULL, 0x80538791ULL, 0x4dcd673fULL, 0x948f8adcULL, 0x61756daULL, 0x80538791ULL, 0x3d8d34b2ULL},
+{0xd08eabd1ULL, 0x783ecfb3ULL, 0x62ad8103ULL, 0x1ed635bULL, 0xd08eabd1ULL, 0xda34504dULL, 0x866b9f88ULL, 0x1ed635bULL, 0xf6ce16abULL},
+{0xb5261e44ULL, 0xcffa4ea9ULL, 0xb03b22d4ULL, 0x4c794452ULL, 0xb5261e44ULL, 0x1531dc55ULL, 0x8135a990ULL, 0x4c794452ULL, 0x6b7a6dfULL},
+{0x5f15c4acULL, 0x2a5e0e50ULL, 0x3a963fbcULL, 0x655fb60ULL, 0x5f15c4acULL, 0x839b2f77ULL, 0xafc22fefULL, 0x655fb60ULL, 0x1f41ed78ULL},
+{0x5228de16ULL, 0x89e933e6ULL, 0x284f0457ULL, 0xcc1381a0ULL, 0x5228de16ULL, 0x7fc6e91eULL, 0xcceace6dULL, 0xcc1381a0ULL, 0x1c8b9822ULL},
+{0x55160ff5ULL, 0x8a74ee3aULL, 0x557fef2bULL, 0xa0fc5c10ULL, 0x55160ff5ULL, 0x1cfa2701ULL, 0x6f2556caULL, 0xa0fc5c10ULL, 0x1e8a1be3ULL},
+{0x15617408ULL, 0x7df98a18ULL, 0x9ba06669ULL, 0x3a2acec3ULL, 0x15617408ULL, 0x1cda5286ULL, 0x1d87f57bULL, 0x3a2acec3ULL, 0x9d58f49dULL},
+{0x2e8338a0ULL, 0xed1b60ccULL, 0xad37c535ULL, 0x5cfc2da9ULL, 0x2e8338a0ULL, 0x1d31d62aULL, 0xdfdc9064ULL, 0x5cfc2da9ULL, 0x44e1d5aaULL},
+{0x73f127b9ULL, 0x4a6a391bULL, 0x9524e5ffULL, 0x7237709fULL, 0x73f127b9ULL, 0xa83086fcULL, 0x4cfe5eebULL, 0x7237709fULL, 0x5a15ab8fULL},
+{0x7ac61bbcULL, 0x3aeb6bfbULL, 0x1597a505ULL, 0xd508d2cbULL, 0x7ac61bbcULL, 0xfcb40050ULL, 0xcb2a53b6ULL, 0xd508d2cbULL, 0x73e8d7c0ULL},
+{0x5de35592ULL, 0xd7751c83ULL, 0x3845b7a5ULL, 0x4659a43ULL, 0x5de35592ULL, 0xdbd3db5cULL, 0x11da45bULL, 0x4659a43ULL, 0xf4bac5c5ULL},
+{0xdda58d42ULL, 0xc23f09efULL, 0xedf5c923ULL, 0x60a09278ULL, 0xdda58d42ULL, 0x6ac1d2f2ULL, 0xe83804ebULL, 0x60a09278ULL, 0xcd999d5cULL},
+{0x189d6835ULL, 0x71b20894ULL, 0x1eb47649ULL, 0x20ecce78ULL, 0x189d6835ULL, 0x295d402fULL, 0x39bfb209ULL, 0x20ecce78ULL, 0xa5029748ULL},
+{0x4f52b0b8ULL, 0x7cf7aa16ULL, 0x608bb038ULL, 0xff8f9008ULL, 0x4f52b0b8ULL, 0xa385e48aULL, 0x7516834dULL, 0xff8f9008ULL, 0x7d3811fcULL},
+{0xc381fb1ULL, 0x21e42153ULL, 0xeff1de8bULL, 0x7fed0da6ULL, 0xc381fb1ULL, 0x405f1518ULL, 0x68658992ULL, 0x7fed0da6ULL, 0x3c44e6c2ULL},
+{0x2bb298bbULL, 0xaeb05adcULL, 0xe8455a97ULL, 0xaafac1fbULL, 0x2bb298bbULL, 0xf3fecb89ULL, 0x9baf2d52ULL, 0xaafac1fbULL, 0x5551c494ULL},
+{0x2005d37fULL, 0x30ac5e20ULL, 0xdaee8ae5ULL, 0xcd24797dULL, 0x2005d37fULL, 0x9fc74da1ULL, 0xd7bc702ULL, 0xcd24797dULL, 0xed706529ULL},
+{0x8ae0898dULL, 0x4a84c198ULL, 0xf66fd7ddULL, 0x9380c17eULL, 0x8ae0898dULL, 0x917ab469ULL, 0x7db7ca96ULL, 0x9380c17eULL, 0xbbd13301ULL},
+{0xc05cb5bdULL, 0x4dca7672ULL, 0x8408cf03ULL, 0x10d9ca4fULL, 0xc05cb5bdULL, 0x9aedccc8ULL, 0x67d76573ULL, 0x10d9ca4fULL, 0x813d4619ULL},
+{0x9032ced7ULL, 0x6d9b74fdULL, 0xfd7443d9ULL, 0xdb8a2ca8ULL, 0x9032ced7ULL, 0x458ee519ULL, 0x3e6c218ULL, 0xdb8a2ca8ULL, 0xa7a8162eULL},
+{0xd3da3095ULL, 0x3167d63cULL, 0x6407031dULL, 0x2c5ea347ULL, 0xd3da3095ULL, 0x2e2cbc44ULL, 0x65f97621ULL, 0x2c5ea347ULL, 0xc477f3bbULL},
+{0xac458378ULL, 0xd02e57ceULL, 0x672bb5ceULL, 0x24cda89ULL, 0xac458378ULL, 0x3bceb95dULL, 0x866a200ULL, 0x24cda89ULL, 0xaf43453fULL},
+{0xe7282c0eULL, 0x284f24e6ULL, 0x9b4db5adULL, 0x95736814ULL, 0xe7282c0eULL, 0xeb8e6c2ULL, 0x8dd44588ULL, 0x95736814ULL, 0x6f614c69ULL},
+{0x26749566ULL, 0xfe53cb4cULL, 0xfe97ae65ULL, 0x48c0bd46ULL, 0x26749566ULL, 0xf5b4bf8aULL, 0x69f8cbd2ULL, 0x48c0bd46ULL, 0x2b758a99ULL},
+{0xaf5fd470ULL, 0x75ffd955ULL, 0x8795c6f4ULL, 0x39c47078ULL, 0xaf5fd470ULL, 0xa7066755ULL, 0x26b4e49dULL, 0x39c47078ULL, 0x76147502ULL},
+{0xe44c6e87ULL, 0x761c77edULL, 0x900a9deaULL, 0x8c5d2a13ULL, 0xe44c6e87ULL, 0x43a7cebeULL, 0xc8b9d519ULL, 0x8c5d2a13ULL, 0x8f0c2675ULL},
+{0x15f31285ULL, 0x94b211e1ULL, 0x3a99bbc6ULL, 0x268d5811ULL, 0x15f31285ULL, 0xfb87886cULL, 0xae0ba146ULL, 0x268d5811ULL, 0xf45931aULL},
+{0xd9746619ULL, 0xbc033a85ULL, 0xfba312adULL, 0xb79342e9ULL, 0xd9746619ULL, 0x6d4248ecULL, 0x8a2b05ffULL, 0xb79342e9ULL, 0xfc3a41ffULL},
+{0x702b5b9dULL, 0x7380dd51ULL, 0x607c1c83ULL, 0xc5077e27ULL, 0x702b5b9dULL, 0x31f99ee8ULL, 0xd34b5b66ULL, 0xc5077e27ULL, 0xd8e2ff2bULL},
+{0xc34ddc56ULL, 0x2cadfa26ULL, 0x8996de4bULL, 0x9f2b1c06ULL, 0xc34ddc56ULL, 0x24381a39ULL, 0x971be7e9ULL, 0x9f2b1c06ULL, 0x4338c86aULL},
+{0x769c975eULL, 0x9f92afd6ULL, 0x519d026eULL, 0x2076b0a1ULL, 0x769c975eULL, 0x4accd99fULL, 0xd929d5c0ULL, 0x2076b0a1ULL, 0x516c4ea1ULL},
+{0x3913dbf3ULL, 0xc276acd8ULL, 0xb15fd277ULL, 0x2adfd6ceULL, 0x3913dbf3ULL, 0x605451fcULL, 0xf26453f2ULL, 0x2adfd6ceULL, 0x9e3afd21ULL},
+{0xf2bafbeaULL, 0xf796f3e1ULL, 0x7e5a4b4eULL, 0x41f49c6fULL, 0xf2bafbeaULL, 0x51291f1aULL, 0xc4465038ULL, 0x41f49c6fULL, 0xa154168aULL},
+{0x47b87ULL, 0xa463a633ULL, 0x7bb3da5dULL, 0xee96f198ULL, 0x47b87ULL, 0x5dab202ULL, 0xd3569216ULL, 0xee96f198ULL, 0xa422fa64ULL},
+{0x62ef5cdULL, 0x336e505bULL, 0x6d821563ULL, 0x46e206b6ULL, 0x62ef5cdULL, 0xf701e8aaULL, 0xcff05d1aULL, 0x46e206b6ULL, 0x3db92362ULL},
+{0xec631f41ULL, 0x89587209ULL, 0x59b6066bULL, 0xd36ab1b1ULL, 0xec631f41ULL, 0x90060013ULL, 0x18efeed3ULL, 0xd36ab1b1ULL, 0x8f381b75ULL},
+{0x33192c5cULL, 0x37a5aedfULL, 0x558b3a0fULL, 0x75f0e5a0ULL, 0x33192c5cULL, 0xb40ab258ULL, 0xc690851fULL, 0x75f0e5a0ULL, 0x7a2e9999ULL},
+{0xe89112fULL, 0xc21eac15ULL, 0x39b488dfULL, 0x8851e559ULL, 0xe89112fULL, 0xef37d4f3ULL, 0x386f819dULL, 0x8851e559ULL, 0x6ea51592ULL},
+{0x2969e2eaULL, 0x928c03eeULL, 0xe3cd31a8ULL, 0x373be1ebULL, 0x2969e2eaULL, 0x7ba2ffb0ULL, 0x6a2a4616ULL, 0x373be1ebULL, 0xda71ca80ULL},
+{0xb525f529ULL, 0x8a32d59aULL, 0x16aa472cULL, 0x3f7eb535ULL, 0xb525f529ULL, 0x4e283487ULL, 0x9af43374ULL, 0x3f7eb535ULL, 0x6d2c0afULL},
+{0x616e8f8ULL, 0xf56bcbb0ULL, 0xd31462f2ULL, 0x7b14dc5cULL, 0x616e8f8ULL, 0x1a45346fULL, 0x7d471ee0ULL, 0x7b14dc5cULL, 0xde3e277ULL},
+{0xd9c49dbcULL, 0x3e187c5fULL, 0x1ccc406bULL, 0x62aaaf08ULL, 0xd9c49dbcULL, 0x7e5d7eebULL, 0x4cdbcbd7ULL, 0x62aaaf08ULL, 0xf9d9ab3eULL},
+{0xba934cddULL, 0xc9468ab8ULL, 0xb16d6b59ULL, 0xccf1c7e3ULL, 0xba934cddULL, 0xdee748b5ULL, 0x96fb2e2ULL, 0xccf1c7e3ULL, 0xb5155d80ULL},
+{0x8e97b0c7ULL, 0x2055ad2cULL, 0xd2d79ec6ULL, 0x534177ebULL, 0x8e97b0c7ULL, 0xe210c89ULL, 0x575109c5ULL, 0x534177ebULL, 0x8fa8dc63ULL},
+{0xb851941bULL, 0x3097b2d2ULL, 0x8018f9fdULL, 0x80f4e466ULL, 0xb851941bULL, 0xac6ba246ULL, 0x997e809dULL, 0x80f4e466ULL, 0x741d2b19ULL},
+{0x66bf7ec7ULL, 0x17256557ULL, 0x15a1b07dULL, 0xc2437999ULL, 0x66bf7ec7ULL, 0xb73722a1ULL, 0xba283a7fULL, 0xc2437999ULL, 0x6e07c7e1ULL},
+{0xbf9cd0f4ULL, 0xb0af14a1ULL, 0xd9f9f083ULL, 0x5770f103ULL, 0xbf9cd0f4ULL, 0xe206d7f5ULL, 0x5608ab88ULL, 0x5770f103ULL, 0xcaab8890ULL},
+{0xaebf975fULL, 0xe4034afULL, 0x345099bdULL, 0xfa34ad1aULL, 0xaebf975fULL, 0xb5923797ULL, 0xa838ebd0ULL, 0xfa34ad1aULL, 0xffbe4430ULL},
+{0x875f18cdULL, 0x58c37e3eULL, 0xef39023cULL, 0x9b7740dbULL, 0x875f18cdULL, 0x3272ff2fULL, 0x68e19909ULL, 0x9b7740dbULL, 0x1ba1dfd9ULL},
+{0xfb6bb611ULL, 0x5f80b5c4ULL, 0xa88d2c72ULL, 0xba8f55b3ULL, 0xfb6bb611ULL, 0x254dc4d4ULL, 0x931b98efULL, 0xba8f55b3ULL, 0xe88d3420ULL},
+{0xde0dce4bULL, 0x128b528aULL, 0x2cbeab91ULL, 0x279a8330ULL, 0xde0dce4bULL, 0xe86c42e8ULL, 0xf882a1a8ULL, 0x279a8330ULL, 0x5f823956ULL},
+{0x2cf3d043ULL, 0x7d1eb265ULL, 0x7b1d9d1bULL, 0xfb7a8a70ULL, 0x2cf3d043ULL, 0x541c691aULL, 0xec6138b4ULL, 0xfb7a8a70ULL, 0x82c9e9a3ULL},
+{0xfe73965eULL, 0x709e9dbeULL, 0x66769182ULL, 0x57cf4521ULL, 0xfe73965eULL, 0x87def03eULL, 0x2829eb34ULL, 0x57cf4521ULL, 0x308bfe3cULL},
+{0xacf3ef92ULL, 0x26296118ULL, 0xba75350dULL, 0xe6b87033ULL, 0xacf3ef92ULL, 0xe3e2ef84ULL, 0x84db155cULL, 0xe6b87033ULL, 0x9f75260fULL},
+{0x2e5821dbULL, 0xe8b82d14ULL, 0x10f9857cULL, 0x549edfafULL, 0x2e5821dbULL, 0xac20f9b1ULL, 0xfb25fbfbULL, 0x549edfafULL, 0xdb44ddebULL},
+{0x7323c738ULL, 0x40fca652ULL, 0x8ac68d05ULL, 0x83cb54a9ULL, 0x7323c738ULL, 0x18cc157eULL, 0x759272b8ULL, 0x83cb54a9ULL, 0x5e98512fULL},
+{0x3203defcULL, 0x7e72f8eaULL, 0x9a53b1adULL, 0x520c4275ULL, 0x3203defcULL, 0x93d2d735ULL, 0x76ed6e97ULL, 0x520c4275ULL, 0xf04cf65bULL},
+{0xe754bb24ULL, 0xb5ef6459ULL, 0x50d9fe6aULL, 0x9d56d53bULL, 0xe754bb24ULL, 0x5abdf108ULL, 0x5f43bc9dULL, 0x9d56d53bULL, 0xa899997bULL},
+{0x41b39c03ULL, 0xc2a7de7ULL, 0x4d0ec5e0ULL, 0x60af3915ULL, 0x41b39c03ULL, 0x9f500302ULL, 0xdf33977bULL, 0x60af3915ULL, 0xabea8269ULL},
+{0x28029b8ULL, 0xec6a8a1aULL, 0xf2c6a04bULL, 0x3244a89dULL, 0x28029b8ULL, 0xe35bee96ULL, 0xefafe8b5ULL, 0x3244a89dULL, 0x132641f2ULL},
+{0xc8e3eab6ULL, 0x5bde7eb0ULL, 0xbb958201ULL, 0x7c858f8eULL, 0xc8e3eab6ULL, 0x23c8f126ULL, 0x5c1b67f9ULL, 0x7c858f8eULL, 0x5ba56bdbULL},
+{0x4f885de9ULL, 0xaf79780bULL, 0xcdea22f5ULL, 0x8a3a391eULL, 0x4f885de9ULL, 0xb553ac50ULL, 0xae4ee3a7ULL, 0x8a3a391eULL, 0x19873643ULL},
+{0x527c8054ULL, 0x867f0dc8ULL, 0xf67296ccULL, 0x269a85ceULL, 0x527c8054ULL, 0xe89bd3cbULL, 0x317d54c7ULL, 0x269a85ceULL, 0xc52b63c9ULL},
+{0x894a9c2dULL, 0xf7aa0069ULL, 0xfad920f9ULL, 0x1ab6b1cdULL, 0x894a9c2dULL, 0xdaf3b15eULL, 0x1714d231ULL, 0x1ab6b1cdULL, 0x6f1bbc1cULL},
+{0xeec36ffaULL, 0xdd9fcb6eULL, 0x4a6e3e54ULL, 0x6abb40e6ULL, 0xeec36ffaULL, 0x10a5c2c0ULL, 0x123e0833ULL, 0x6abb40e6ULL, 0x5bccb3ddULL},
+{0xbba064c7ULL, 0x679c4950ULL, 0x5c7011d3ULL, 0x2c6abc4bULL, 0xbba064c7ULL, 0x38ddb07eULL, 0xba6dba17ULL, 0x2c6abc4bULL, 0x3db51724ULL},
+{0x436fc059ULL, 0xbfbff10cULL, 0x2226d711ULL, 0x645625e2ULL, 0x436fc059ULL, 0x48790847ULL, 0x90e7ea59ULL, 0x645625e2ULL, 0x54a4830bULL},
+{0x5ab062bULL, 0xbc48da30ULL, 0x73a1a7bULL, 0x9a6c96d8ULL, 0x5ab062bULL, 0x7adab4efULL, 0x3fe535c4ULL, 0x9a6c96d8ULL, 0x35ce2d49ULL},
+{0x9ad022c8ULL, 0xfc4c0740ULL, 0xd6b1e675ULL, 0x9ece7c39ULL, 0x9ad022c8ULL, 0x389b443aULL, 0xdf83702cULL, 0x9ece7c39ULL, 0x5b948302ULL},
+{0x892c1fcfULL, 0xdfbf23c7ULL, 0x553de98aULL, 0x63905246ULL, 0x892c1fcfULL, 0xeb41c2aeULL, 0x24c58066ULL, 0x63905246ULL, 0xdcec0fd2ULL},
+{0xe0cbc454ULL, 0x72209bcaULL, 0x9bf8dd1bULL, 0x21573877ULL, 0xe0cbc454ULL, 0x442edb58ULL, 0x69cb08ffULL, 0x21573877ULL, 0xcb5e27d5ULL},
+{0xbc525317ULL, 0x4b879a68ULL, 0x9dbd0ca3ULL, 0x4835aa1aULL, 0xbc525317ULL, 0x8e2450eeULL, 0xddc95ac1ULL, 0x4835aa1aULL, 0x7258dfa1ULL},
+{0x119e873eULL, 0x21bd38bcULL, 0x8ea46f99ULL, 0x6a430d0fULL, 0x119e873eULL, 0x4e117e7dULL, 0x93ac171dULL, 0x6a430d0fULL, 0x8bd77f54ULL},
+{0x3303af5ULL, 0x85b46f07ULL, 0xa4184216ULL, 0x6c7bef68ULL, 0x3303af5ULL, 0xe0b96e2ULL, 0x23952bf5ULL, 0x6c7bef68ULL, 0x40296e8cULL},
+{0xcbbcc065ULL, 0xc9a78cb3ULL, 0xb33d0869ULL, 0xf44e8bb3ULL, 0xcbbcc065ULL, 0x50996199ULL, 0xe60389cbULL, 0xf44e8bb3ULL, 0x4259cf30ULL},
+{0x12debd6aULL, 0x63a944e4ULL, 0xeaaf7c90ULL, 0x436009cbULL, 0x12debd6aULL, 0x19985922ULL, 0x8d0a1ab4ULL, 0x436009cbULL, 0x79eed3edULL},
+{0xa9531925ULL, 0x152c220eULL, 0x6d9f3b7fULL, 0xab03ee20ULL, 0xa9531925ULL, 0x846c8044ULL, 0x228a8d39ULL, 0xab03ee20ULL, 0x9007fae6ULL},
+{0xda773424ULL, 0x622ebfb7ULL, 0x16b2529ULL, 0x50222884ULL, 0xda773424ULL, 0xfaa886eaULL, 0x8b71a198ULL, 0x50222884ULL, 0x75b031f2ULL},
+{0x2937032cULL, 0x4da14312ULL, 0xf8fb4d5eULL, 0x32871809ULL, 0x2937032cULL, 0x528de790ULL, 0x22702461ULL, 0x32871809ULL, 0x3804780cULL},
+{0xefc1a04eULL, 0xc207fc37ULL, 0x67590674ULL, 0x4e8491b7ULL, 0xefc1a04eULL, 0xffba774aULL, 0xeab4094bULL, 0x4e8491b7ULL, 0xf12365f1ULL},
+{0x1e398adfULL, 0x39997b77ULL, 0xc3946dcfULL, 0xea6d9d5bULL, 0x1e398adfULL, 0x48641550ULL, 0xb00534a2ULL, 0xea6d9d5bULL, 0x87789fe0ULL},
+{0x844f014eULL, 0x6c63a983ULL, 0x7d3c6c25ULL, 0xe0332916ULL, 0x844f014eULL, 0x49ad81eaULL, 0x3a6007e3ULL, 0xe0332916ULL, 0xb5955f8ULL},
+{0xe4d9dbdeULL, 0xbdb98a28ULL, 0x191453ccULL, 0x9658c51fULL, 0xe4d9dbdeULL, 0x467203c5ULL, 0x1d025d56ULL, 0x9658c51fULL, 0x792f2e7eULL},
+{0xceecc025ULL, 0xabf0a22dULL, 0x40085f9dULL, 0xce815d6aULL, 0xceecc025ULL, 0xc9559a08ULL, 0x82ff2e29ULL, 0xce815d6aULL, 0x7e19803ULL},
+{0xe4a599b0ULL, 0x93d0d911ULL, 0xa69fb3b8ULL, 0x408df1aULL, 0xe4a599b0ULL, 0x86f8ed30ULL, 0x8b2796bcULL, 0x408df1aULL, 0x5138889aULL},
+{0xe386eb17ULL, 0xed73649fULL, 0xce8b16e7ULL, 0x6dc29df6ULL, 0xe386eb17ULL, 0xbe81006cULL, 0xab82ab9aULL, 0x6dc29df6ULL, 0x90b95aebULL},
+{0xea916972ULL, 0xf188e15ULL, 0xdae7995cULL, 0x3df971cULL, 0xea916972ULL, 0x97afc7a2ULL, 0x25aeab0cULL, 0x3df971cULL, 0x5fdd0d64ULL},
+{0x3aeaac6cULL, 0x77338dcfULL, 0xa7f2eb0aULL, 0xc5c663fdULL, 0x3aeaac6cULL, 0x5d2641bdULL, 0xfa0e771aULL, 0xc5c663fdULL, 0xcb116b14ULL},
+{0x9111ca00ULL, 0x3fc6e842ULL, 0x78235d2ULL, 0x9670f349ULL, 0x9111ca00ULL, 0x821e00f9ULL, 0x94d7e969ULL, 0x9670f349ULL, 0x83b81693ULL},
+{0x44627bf2ULL, 0x104f8292ULL, 0xd53a78ebULL, 0x2f14b6b7ULL, 0x44627bf2ULL, 0xd17df4a4ULL, 0x6e031ab6ULL, 0x2f14b6b7ULL, 0x551654bcULL},
+{0x1a43673aULL, 0xed0bae83ULL, 0x9c229aa8ULL, 0x2f94d471ULL, 0x1a43673aULL, 0xc9f04b6dULL, 0x51b30a09ULL, 0x2f94d471ULL, 0xb8a965d0ULL},
+{0x197d61a4ULL, 0x46caa5c7ULL, 0x5f25d2b0ULL, 0x43f2ace1ULL, 0x197d61a4ULL, 0x5683ccd6ULL, 0xe322208aULL, 0x43f2ace1ULL, 0xca65f956ULL},
+{0xbe0e8070ULL, 0x1e8f2668ULL, 0x48455fd9ULL, 0xebdd0a67ULL, 0xbe0e8070ULL, 0x4d03e4b2ULL, 0xe8eda3faULL, 0xebdd0a67ULL, 0xba61ddd0ULL},
+{0x81dc668aULL, 0xc262aa4fULL, 0xcfffc561ULL, 0x4d151deaULL, 0x81dc668aULL, 0xf25fdeccULL, 0x31efaa79ULL, 0x4d151deaULL, 0x357cfc1bULL},
+{0x8166456fULL, 0xdff06b31ULL, 0xbc16d086ULL, 0x365ad0edULL, 0x8166456fULL, 0xac656628ULL, 0xfe1d098dULL, 0x365ad0edULL, 0xb3bd76bULL},
+{0x94af85aeULL, 0xa39f98f2ULL, 0x55c4c79aULL, 0xd1ee591dULL, 0x94af85aeULL, 0x7848424fULL, 0xc9e78356ULL, 0xd1ee591dULL, 0xc311d583ULL},
+{0x9160f5cbULL, 0x9965e1e0ULL, 0xe9690a8ULL, 0xa6d8a380ULL, 0x9160f5cbULL, 0xb29870faULL, 0x2995e885ULL, 0xa6d8a380ULL, 0x1ee7b4cULL},
+{0x2f25452bULL, 0x483716deULL, 0xb0196fc2ULL, 0x13ea13e1ULL, 0x2f25452bULL, 0x3eeead82ULL, 0x16ed49cdULL, 0x13ea13e1ULL, 0x6ef6c726ULL},
+{0x3318dd7bULL, 0x5b33a1bfULL, 0x26ddbe43ULL, 0xa7ba497bULL, 0x3318dd7bULL, 0x619ab4f6ULL, 0x3b76793ULL, 0xa7ba497bULL, 0x41918d15ULL},
+{0xeae08102ULL, 0xdffe3af1ULL, 0xf56dc89aULL, 0x8ac1e4feULL, 0xeae08102ULL, 0x9349befdULL, 0x9c9a0eaeULL, 0x8ac1e4feULL, 0xf1d280f6ULL},
+{0xe15da4e6ULL, 0xa67927d5ULL, 0xbb30b904ULL, 0x45186b23ULL, 0xe15da4e6ULL, 0x8bf17a8ULL, 0x6d97525cULL, 0x45186b23ULL, 0x4862fc1dULL},
+{0x2bcb97a4ULL, 0x16725d81ULL, 0xc6c3a946ULL, 0x7102d463ULL, 0x2bcb97a4ULL, 0x632da86dULL, 0xd77cff3cULL, 0x7102d463ULL, 0x4a78babeULL},
+{0xf9e86050ULL, 0x672de905ULL, 0xb470df24ULL, 0xecbcfc06ULL, 0xf9e86050ULL, 0x446ffbe5ULL, 0x5e12a92cULL, 0xecbcfc06ULL, 0x373c7d1eULL},
+{0xd96aae8dULL, 0x9678b8d0ULL, 0xc1258b20ULL, 0xb7e3379dULL, 0xd96aae8dULL, 0xf12f33b2ULL, 0xeb63aa1aULL, 0xb7e3379dULL, 0xbcf63c5dULL},
+{0x198170e5ULL, 0x17e950e5ULL, 0xa163763cULL, 0x50ddc6d7ULL, 0x198170e5ULL, 0x16507cb6ULL, 0x1a0ec341ULL, 0x50ddc6d7ULL, 0xfae98486ULL},
+{0x5fcfb530ULL, 0x6801669bULL, 0x8227cef9ULL, 0x879b9728ULL, 0x5fcfb530ULL, 0x4a120779ULL, 0xf4003e9dULL, 0x879b9728ULL, 0x2da251abULL},
+{0x485c838ULL, 0xb66ca4bfULL, 0xd2a2c561ULL, 0x982363f1ULL, 0x485c838ULL, 0x2a451523ULL, 0xc71fe370ULL, 0x982363f1ULL, 0xfd46b86dULL},
+{0xe1b2e58eULL, 0x4c2564afULL, 0xe23694ddULL, 0xf66712fdULL, 0xe1b2e58eULL, 0xaad2d82bULL, 0xe018aa25ULL, 0xf66712fdULL, 0x8c4aabf1ULL},
+{0x6ef06df4ULL, 0xe9ba224cULL, 0x9cb44963ULL, 0x6f0645bfULL, 0x6ef06df4ULL, 0xa1a88c73ULL, 0x75bda7e3ULL, 0x6f0645bfULL, 0xa0ddedc5ULL},
+{0xdb6ea2f7ULL, 0xd825b1d6ULL, 0x4fa3c438ULL, 0x98dd011dULL, 0xdb6ea2f7ULL, 0xebe18a03ULL, 0x9738ac3fULL, 0x98dd011dULL, 0x86379089ULL},
+{0xa1b3fd22ULL, 0x45960c21ULL, 0x94cb5d6dULL, 0xeac40139ULL, 0xa1b3fd22ULL, 0xd347a6f5ULL, 0x543a99d5ULL, 0xeac40139ULL, 0x80dc27e1ULL},
+{0x3c765a74ULL, 0xa139fb6dULL, 0xca96425ULL, 0xb663e189ULL, 0x3c765a74ULL, 0x4d5e3589ULL, 0x1403ce7fULL, 0xb663e189ULL, 0x5530e26bULL},
+{0x9c932fc0ULL, 0x5a9b55aeULL, 0xa4c0384fULL, 0xbb257b56ULL, 0x9c932fc0ULL, 0x1b72fe0dULL, 0x34e8f77ULL, 0xbb257b56ULL, 0x432565bdULL},
+{0x544e3c29ULL, 0x5ebe6c3eULL, 0x673be4ebULL, 0x8ab89321ULL, 0x544e3c29ULL, 0x1597df63ULL, 0x105d7c91ULL, 0x8ab89321ULL, 0xebfd5f90ULL},
+{0x58c24f1cULL, 0xb91a93f6ULL, 0x307a42d3ULL, 0x459ce9a1ULL, 0x58c24f1cULL, 0xcb467912ULL, 0x201f18d4ULL, 0x459ce9a1ULL, 0xc309a9adULL},
+{0x5b0259d2ULL, 0xcbeaa4a3ULL, 0x106b85b0ULL, 0xd01094dULL, 0x5b0259d2ULL, 0x5b9f815dULL, 0x31be9dbULL, 0xd01094dULL, 0x1236894dULL}}
+};
+
+#endif
@@ -32,12 +32,12 @@
 #define __MT19937_H__
 
 #include "prand.h"
+#include "prand_mt19937_inline.h"
 
 /*============================================================================*\
       Definitions for the representation of polynomials with 32-bit words
 \*============================================================================*/
 
-#define MT19937_N       624
 #define WORD_SIZE       32
 #define MUL_NBIT(x)     ((x) << 5)
 #define DIV_NBIT(x)     ((x) >> 5)
@@ -58,12 +58,43 @@ Arguments:
   * `a`, `b`:   pointers to the two multipliers, each with `n` words;
   * `n`:        the length of `a` and `b` (in words);
   * `tmp`:      a temporary array with a rough requirement of 4 * `n` words.
-TODO:
-  Include the toom-3 algorithm for long polynomials.
 ******************************************************************************/
 void poly_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
     const unsigned int n, uint32_t *tmp);
 
+/******************************************************************************
+Function `poly_mul_clmul`:
+  Check whether the carry-less multiply instructions are used for the
+  polynomial multiplications.
+Return:
+  1 if the instructions are used, and 0 otherwise.
+******************************************************************************/
+int poly_mul_clmul(void);
+
+/******************************************************************************
+Function `poly_mul_toom3`:
+  Set the minimum number of words for the Toom-Cook 3-way multiplication,
+  with the base case in use, for benchmarks and tests. It is not thread-safe.
+Arguments:
+  * `thres`:    the threshold, 0 for disabling the Toom-Cook algorithm, and
+                values between 1 and 11 are raised to 12.
+Return:
+  The previous threshold.
+******************************************************************************/
+unsigned int poly_mul_toom3(unsigned int thres);
+
+/******************************************************************************
+Function `poly_mul_school`:
+  Compute r = a * b, where a and b contain both n words,
+    using the grade-school multiplication algorithm, as a reference.
+Arguments:
+  * `r`:        pointer to the result, with at least 2 * `n` words;
+  * `a`, `b`:   pointers to the two multipliers, each with `n` words;
+  * `n`:        the length of `a` and `b` (in words).
+******************************************************************************/
+void poly_mul_school(uint32_t *r, const uint32_t *a, const uint32_t *b,
+    const unsigned int n);
+
 /******************************************************************************
 Function `poly_mul_ub`:
   Compute r = a * b, where a and b contain 2n and n words, respectively.
@@ -86,6 +117,84 @@ Arguments:
 ******************************************************************************/
 void poly_mod_phi(uint32_t *r, uint32_t *tmp);
 
+/******************************************************************************
+Function `poly_mod_barrett`:
+  Compute r %= phi with the Barrett reduction, for an arbitrary polynomial
+  phi with degree k, and mu = floor(t^(2k) / phi).
+Arguments:
+  * `r`:        pointer to the polynomial with degree lower than 2k, with
+                2 * `n` words, and the first `n` words being the result;
+  * `phi`:      the divisor, with `n` words;
+  * `mu`:       the pre-computed quotient, with `n` words;
+  * `k`:        the degree of phi, must be lower than 32 * `n`;
+  * `n`:        the length of `phi` and `mu` (in words);
+  * `tmp`:      a temporary array with a rough requirement of 7 * `n` words.
+******************************************************************************/
+void poly_mod_barrett(uint32_t *r, const uint32_t *phi, const uint32_t *mu,
+    const unsigned int k, const unsigned int n, uint32_t *tmp);
+
+/******************************************************************************
+Function `poly_pow_mod`:
+  Compute r = t^e mod phi, for an arbitrary polynomial phi with degree k.
+Arguments:
+  * `r`:        pointer to the result, with `n` words;
+  * `e`:        the exponent;
+  * `phi`:      the divisor, with `n` words;
+  * `mu`:       the pre-computed quotient for the Barrett reduction;
+  * `k`:        the degree of phi, must be lower than 32 * `n`;
+  * `n`:        the length of `phi` and `mu` (in words);
+  * `tmp`:      a temporary array with a rough requirement of 9 * `n` words.
+******************************************************************************/
+void poly_pow_mod(uint32_t *r, const uint64_t e, const uint32_t *phi,
+    const uint32_t *mu, const unsigned int k, const unsigned int n,
+    uint32_t *tmp);
+
+
+/*============================================================================*\
+             Kernels for generating and tempering the state array
+\*============================================================================*/
+
+typedef struct {
+  /* generate `MT19937_N` words of the state array at one time */
+  void (*twist) (uint32_t *);
+  /* temper an array of words, and convert them to the output format */
+  void (*temper) (uint64_t *, const uint32_t *, const size_t);
+  void (*temper_double) (double *, const uint32_t *, const size_t);
+  void (*temper_double_pos) (double *, const uint32_t *, const size_t);
+} mt19937_kernel_t;
+
+/******************************************************************************
+Function `mt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const mt19937_kernel_t *mt19937_kernel(void);
+
+
+#ifdef MT19937_POLY_LAZY
+/*============================================================================*\
+            Pre-computed jump-ahead polynomials loaded at runtime
+\*============================================================================*/
+
+/* The table of `MT19937_MAX_STEP_B8` * 7 * `MT19937_N` words, available
+ * after a successful call of `mt19937_poly_load`. */
+extern const uint32_t *mt19937_poly_lazy;
+
+/******************************************************************************
+Function `mt19937_poly_load`:
+  Load the table of the pre-computed jump-ahead polynomials on the first
+  call, from a sidecar file, or by computing it. It can be called
+  concurrently by different threads.
+Arguments:
+  * `err`:      an integer for storing the error message.
+Return:
+  The table on success; NULL on error.
+******************************************************************************/
+const uint32_t *mt19937_poly_load(int *err);
+
+#endif
+
 
 /*============================================================================*\
                             Initialisation function
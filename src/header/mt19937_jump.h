@@ -52,6 +52,9 @@
 #define MT19937_MAX_STEP_B8     21      /* maximum skip length (in log8) */
 #define MT19937_MAX_STEP        0x7fffffffffffffffULL   /* max skip length */
 
+/* The table is loaded at runtime with `-DMT19937_POLY_LAZY`, see
+ * mt19937_table.c. */
+#ifndef MT19937_POLY_LAZY
 const uint32_t mt19937_poly[MT19937_MAX_STEP_B8][7][MT19937_N] = {
 {  {0x2UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
   {0x4UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
@@ -201,6 +204,7 @@ const uint32_t mt19937_poly[MT19937_MAX_STEP_B8][7][MT19937_N] = {
   {0x11af70e6UL,0x62d0b00dUL,0x2262a2e2UL,0x33e88001UL,0x5949790aUL,0x93b23587UL,0xd80a5851UL,0x983a65a4UL,0x7da7fb4bUL,0xf2b77c7aUL,0xb45f1eb4UL,0x48f25a4eUL,0x92d3e406UL,0xae57b1ebUL,0x4a90fe9dUL,0x70c9d30bUL,0xe3bd41b9UL,0x5722a202UL,0xa49b750aUL,0x20920f9dUL,0x895714edUL,0x5dc5ec81UL,0x58f0b421UL,0xf139d1c5UL,0xa7d77c76UL,0x21c105b8UL,0x847c3f30UL,0xdc9fae04UL,0xc80b0411UL,0x8a145be6UL,0x69622127UL,0x45c3c074UL,0x3b2761cfUL,0x51aaa5b8UL,0xa514de91UL,0x89dfaa55UL,0xe1bf22deUL,0x4c26f809UL,0xffc24275UL,0x4f52d961UL,0xb625c4c2UL,0x54e87331UL,0x6fdad14bUL,0x3cebaf30UL,0xd0f6746bUL,0x2ff425cfUL,0xe04cb49eUL,0x8df1d483UL,0x958f0caeUL,0x48543cfdUL,0x45324b7eUL,0xb2595bb8UL,0x4791de6eUL,0xff752b89UL,0x73ffc410UL,0xcfb6ab1aUL,0x57c4e851UL,0x1a2ea7c8UL,0x5a4415ecUL,0x14979dc6UL,0x26d6b63cUL,0xaa5c969bUL,0xab4badcdUL,0x7e921d94UL,0xebac2b21UL,0x5d76f4f3UL,0xbc96331eUL,0x3dd8f841UL,0xe0a8be55UL,0x2e7c7097UL,0x86c4f897UL,0x3c0c0995UL,0x12888fd0UL,0x782736f1UL,0xb58b860fUL,0xe0100bf8UL,0xba1846fbUL,0x7fa8a341UL,0x9e7055e8UL,0x4f2940c9UL,0xda6c17ccUL,0xe85ae668UL,0x12fcfd83UL,0x5d1321bbUL,0x4febb802UL,0x5277cb92UL,0x29d9b934UL,0x8452c24fUL,0x23c50178UL,0xdfd600beUL,0x48460efbUL,0x13fc04ecUL,0x1c0d0d88UL,0xdbbfdcbUL,0x3a26e63fUL,0x94624e6UL,0x73aadf8eUL,0xdb398097UL,0x9cd7850cUL,0xe7603c2dUL,0xe51ea02bUL,0x7a83bd8dUL,0x97a24abcUL,0x1877d2a8UL,0xa3536708UL,0x99c7f463UL,0xba3bb463UL,0xfff59164UL,0x11744ddbUL,0x639a7712UL,0x8f0f8d23UL,0xa7da5a62UL,0x207bf50fUL,0xcba66184UL,0x6ee9df7aUL,0xf39bc6e5UL,0x715bb6a0UL,0x71e7cb64UL,0xd467d8b5UL,0xe9eaf91eUL,0x4e655fccUL,0x84ca0444UL,0x1dac1c3dUL,0x8cb2adcbUL,0x278adbc3UL,0xb5bc9030UL,0xcb55751eUL,0xf6b45b45UL,0xf29ee98fUL,0x3d2e7b35UL,0xf62d3f6bUL,0xba624effUL,0x8e7d48d2UL,0x306e6a85UL,0x30a0fccdUL,0x62806903UL,0x9e66ce15UL,0x1bc28f84UL,0x99d177c7UL,0xe1e29e4bUL,0x2811137cUL,0x8d2f2000UL,0x3c01d1aaUL,0xa395fa5dUL,0x85664d58UL,0xd106284aUL,0xa0572fabUL,0xcfef1a6cUL,0x6ec04ad4UL,0xa0eec7bfUL,0x3a0a6020UL,0x664d4bfcUL,0xdda4e128UL,0x756ebf86UL,0x4a708358UL,0xb9a29700UL,0x7732fd31UL,0x49d56ecUL,0x29ae590cUL,0xeffd43d7UL,0x6318128aUL,0xaabc0189UL,0x6ed21c5eUL,0x5a73c991UL,0x1c550121UL,0x9c9dd8c2UL,0xcd47f292UL,0xf59482a6UL,0x9dbd010aUL,0x391c1a2UL,0x686337bfUL,0x77759378UL,0x7074aa11UL,0x7857a6ccUL,0xa98318e2UL,0x3b728b19UL,0x4a266191UL,0x3d0fa709UL,0xf0690d17UL,0x102aad69UL,0xe97f7d4dUL,0x1ab76010UL,0x8da305ffUL,0xedda1894UL,0x91185c18UL,0x9dacd8ebUL,0x264227c2UL,0x368d8d5UL,0x6b32a15aUL,0x573ee979UL,0xd1246e6eUL,0x2114fc8dUL,0x16449647UL,0xba016625UL,0x2f0168c7UL,0xcaeab91fUL,0x3adca6c4UL,0x5eb17d8dUL,0xbdf8ec29UL,0xaa696253UL,0xe687d0d0UL,0x6c6f1dc7UL,0xb4723aceUL,0xc0c0252dUL,0xe8b68db9UL,0x1c28a014UL,0x2c626022UL,0x239f9690UL,0x913c85a5UL,0x9b1891a0UL,0x9a444171UL,0xbf646210UL,0xf1024b90UL,0xdf3846bfUL,0xe66196aUL,0x6cc5d07bUL,0x217a8cb1UL,0x80ec77a9UL,0x8331fb9dUL,0x4a83d220UL,0x15fd7c7eUL,0x1a347ca5UL,0x91eb42cfUL,0x47dd7fefUL,0x8e05bf9bUL,0x1352118bUL,0x7d825557UL,0x1b404a04UL,0x8271cb82UL,0xb56e4742UL,0x1eed0bc8UL,0x884fabccUL,0xadc42e3dUL,0x6fc77947UL,0x1d965861UL,0x28fe3423UL,0xa9507d26UL,0xeecb7b28UL,0xdedaad0fUL,0xb7bff01dUL,0x2336963eUL,0x463fdf34UL,0x4edc9bbdUL,0xb9eb375dUL,0x78be5397UL,0x2ceb6ea4UL,0x340c21f4UL,0x69fb0128UL,0x85aa515UL,0x89f3d028UL,0xe7ce5b7UL,0xac04149bUL,0xc35e8af4UL,0x8da524e0UL,0xee4b99ccUL,0x96824de1UL,0x92879b6eUL,0xa0254c89UL,0xeee5dbbUL,0xdd1c69bUL,0xaa8830edUL,0xceb1e6f7UL,0x7a2e07edUL,0xcd5a2e94UL,0x17755705UL,0x7fee8d0fUL,0x865b0c63UL,0xac3513a9UL,0xfb0fc9feUL,0x9e31cfd7UL,0x5c12b2bUL,0xbfbe2dcbUL,0xe31c7ba6UL,0x5dc574a8UL,0xa402d0f9UL,0x863e6cc5UL,0xdaa3d7d8UL,0x85fa2f8bUL,0x9180cc04UL,0x516e28d4UL,0xdc72b5b5UL,0x91cdb381UL,0x7417e7b4UL,0x3bab8bfcUL,0xe01dfc88UL,0x14187217UL,0xa56b3a96UL,0x9a763ee8UL,0xf2166d19UL,0xa033a552UL,0x6235ea26UL,0x2607b420UL,0xc1c6f800UL,0xbe4573fUL,0xb4c92fcbUL,0x25135d7dUL,0x1df8d9a8UL,0xa7c5e452UL,0x48d02f6cUL,0x9eee05b6UL,0x5648fc83UL,0xe663468dUL,0x7432c580UL,0xc4cb09d3UL,0xbd1b7899UL,0x42d73552UL,0x430fd513UL,0xfb7c74b7UL,0x6d9fd617UL,0x2f5f5e3fUL,0x12ac1e74UL,0xd9cc6fbUL,0x8fd7cbc4UL,0x23aef1c8UL,0xd0cfca9dUL,0xd466ef33UL,0xd4528a4bUL,0xa2e96a92UL,0x57c4b41eUL,0x4a2ca6b0UL,0x52a306c1UL,0x5ab49096UL,0x1c22fecUL,0x4140b9caUL,0x849bb82cUL,0xf3392019UL,0x6a396708UL,0xb3124a85UL,0x74ae1dbaUL,0x99b583a1UL,0xfece9538UL,0xe3f61e1eUL,0x3120eddfUL,0xe1c7018eUL,0x854817e4UL,0xc5094ed2UL,0xb705d014UL,0x3881f6c5UL,0x3a356996UL,0xe5688c2UL,0x5137cf80UL,0xc1ab0354UL,0xf82fa3f8UL,0x2e6b9d56UL,0xfed2854aUL,0xf0f2790UL,0xc3bff9b1UL,0x1c49475dUL,0xe27027efUL,0xca22d351UL,0x68abc127UL,0x39356d3UL,0x17cc278cUL,0x5e257d6bUL,0x76a1a7b1UL,0x15ea0280UL,0xcf78e191UL,0xb9ebdfc5UL,0x98f437f6UL,0x9c3bb412UL,0x2383bddbUL,0xc7226ea7UL,0x4bcc5eb9UL,0xf2d8f068UL,0x5e74d528UL,0x234188dcUL,0xe8ce1a8bUL,0xd78cda26UL,0x80692917UL,0x2423332fUL,0xbdd8cde2UL,0xfcd359adUL,0xa240c656UL,0xabb69487UL,0x26e35c8fUL,0xa6e29675UL,0x906ef6e3UL,0x318f168dUL,0x61657c8eUL,0x3d1da981UL,0xe200eef0UL,0x80e6b7a6UL,0x314105c6UL,0x8b10fae8UL,0xdbff1233UL,0x77a4e4dUL,0x87633b43UL,0x477a3607UL,0xc4bf25d0UL,0x6c668f6bUL,0x8e0cbd8eUL,0xfefc6ea6UL,0xf355538cUL,0x6f17ed97UL,0x4fed568eUL,0xf93926a7UL,0xebf0ff8aUL,0xd8ac8ddfUL,0x9ce7bbbbUL,0x8e5878bcUL,0xe7f312ecUL,0xa1d78e5cUL,0x8a8c6713UL,0xb02f9e11UL,0x37d33c20UL,0x7133780aUL,0x4ed49305UL,0xe00f654aUL,0xf01300caUL,0xbc04462fUL,0xbac5c184UL,0x26a6dab5UL,0x4f3431cbUL,0xdc7c4dccUL,0x680f4b56UL,0x25585d0bUL,0xbef62002UL,0xadd0e912UL,0xa51805b0UL,0xacfc5d46UL,0x4c083a6dUL,0x398d3345UL,0x36238d58UL,0xc0ad91d2UL,0xef7ef712UL,0x1c29bf3cUL,0xe2b3cdd1UL,0x9d270610UL,0x4bdba511UL,0x99cc88b5UL,0x60bf0940UL,0xc404f7b8UL,0x3c7e0094UL,0xd32aafa9UL,0x6aa326e6UL,0xb81b8a0cUL,0xe9acc4ddUL,0x2b8ad119UL,0x98056162UL,0x19dbade7UL,0x9ef35467UL,0x9ce8a961UL,0x6996cba1UL,0xc643c307UL,0x7856c439UL,0xc1038247UL,0x754c50e1UL,0x1591ac74UL,0xf24a556aUL,0x25731932UL,0x7c366214UL,0xfacd55beUL,0x8421d93fUL,0x8917e5daUL,0xf4557f97UL,0x92ffa95aUL,0x4cac9a37UL,0xa42d68a4UL,0x3ba3df14UL,0x4b2273d4UL,0x8dca4997UL,0xa2bc9721UL,0xad8b840bUL,0xf17f6ae4UL,0x82f23c5aUL,0x80b29a86UL,0x3214c8c9UL,0xeb553606UL,0x2ef33f55UL,0x829d8bacUL,0xeb0ec5eeUL,0x50911f83UL,0x2410ec44UL,0x300a7eb4UL,0x2f28d13UL,0x8c41de62UL,0xdf37cebdUL,0xe556d048UL,0xc8104475UL,0xabed0945UL,0xc3238ecUL,0x5a0b56efUL,0x6e90120dUL,0x37c98816UL,0xc94dee3aUL,0x524ebf24UL,0x73bab941UL,0x81c7d81eUL,0x8543ad4fUL,0x5ed399d1UL,0x786ccf0fUL,0xea339678UL,0xefddd9b6UL,0xeb320bd3UL,0x5fb3da67UL,0x7c783522UL,0x359314b9UL,0xedffe4fcUL,0x9496c686UL,0x972fe5b8UL,0x1bb7558eUL,0xf689bf6fUL,0x385f6b2eUL,0x39b878c7UL,0xa751542dUL,0xcb4ca88aUL,0x7758c822UL,0x2f2f3d0fUL,0x77739f35UL,0x3c93df95UL,0x503ddeaaUL,0xcce66bcdUL,0xfb310f71UL,0x84b1981eUL,0xac1d4b85UL,0xafebfd75UL,0x9b81e22UL,0x1fae291eUL,0x5b8d982bUL,0xfb055459UL,0x1e530f30UL,0x1ff6fae2UL,0x5d3de675UL,0x51a26ceaUL,0xa4d3f7fbUL,0x3b48bd8fUL,0x495fced8UL,0xfaa18488UL,0x8b7b99cdUL,0x5a34cf5bUL,0x7cf1ce11UL,0x6028bdfeUL,0x122e7e02UL,0x60fda272UL,0x6e367751UL,0xa28b60dUL,0x58291e64UL,0x367b87e2UL,0xc1e59c65UL,0x8a1e2e8cUL,0x64886306UL,0x52c0b8b4UL,0x574a1446UL,0xe420c440UL,0x30881165UL,0x6c509cbfUL,0x559370b1UL,0xccc94b32UL,0x53eb0b8eUL,0x580b98a7UL,0x7fece4b9UL,0x3e007e53UL,0xe5889cb0UL,0xfaff6459UL,0x9cd5d6b4UL,0xc6cc8847UL,0x461800eeUL,0x4285ba06UL,0xac803bb3UL,0x86a160a4UL,0x7b13e5b8UL,0x4ca35506UL,0x89439e4aUL,0xc05e7119UL,0x367af64eUL,0x61caacdcUL,0xc70fb209UL,0x9db25adaUL,0x125b5055UL,0x2c93470dUL,0x92a0857dUL,0x750c5c99UL,0xef207c4fUL,0x68eb57f2UL,0x643fccUL,0x4b0e4d5dUL,0x2b6ce96UL,0xc6e73ec3UL,0x4881c70bUL,0x5df5ceccUL,0x41885414UL,0x396ea362UL,0xd6508c4fUL,0xd9856a76UL,0x524245c6UL,0xac951bb0UL,0x26ec3609UL,0x2819d455UL,0xc062f3c1UL,0xf0709880UL,0xf8c143d7UL,0x6e323091UL,0x2c9aa21eUL,0x152fa4e4UL,0x1dd12e81UL,0x6f790925UL,0x16f03f2bUL,0x2a00e31dUL,0xc08ef02bUL,0xd37783edUL,0x5605d249UL,0xace2793bUL,0xe5cc8c0bUL,0x9baa8dbdUL,0x5e371618UL,0xe0d9771UL,0xbf2a1b2dUL,0x5ca66cdbUL,0x3d86a562UL,0xa2d049c2UL,0x7dac6f47UL,0x15751b84UL,0x12a93318UL,0xb20befb5UL,0xd8aeadd3UL,0xcf436e8bUL,0x1218cef6UL,0x4b9b0dd7UL,0xce6df5dUL,0x5fd4ba48UL,0xd44459fUL,0x6658d414UL,0xc93644d3UL,0x1UL},
   {0x9276f2dbUL,0x4611052aUL,0xce2d25ddUL,0x11cd0616UL,0xa9c3abb9UL,0xc693ac69UL,0xeb871dccUL,0xc67fc16dUL,0xb9434943UL,0x1d4a9efaUL,0xbc9e254bUL,0x5c52ed4bUL,0x703c2258UL,0xa473fa6cUL,0x35599190UL,0x6f5467fdUL,0x67fd6056UL,0x79a5ac2fUL,0xa8c7436fUL,0x729774b2UL,0x995820a1UL,0xcc0e8debUL,0x59e926aUL,0x43851bc7UL,0x27f06109UL,0x20979178UL,0x730151f5UL,0x2ffe80d7UL,0x47fd58caUL,0xbd161a87UL,0x9c98849UL,0xfcdb4016UL,0xd470d9cbUL,0xc497a00fUL,0xc4ebda22UL,0xee00adcaUL,0xd60e29e1UL,0x88a702b8UL,0xb9921b7cUL,0x2ea55a82UL,0x9b02c5a0UL,0x1f151827UL,0x17cd136eUL,0xe81d2819UL,0x5c38accdUL,0x3f31f251UL,0xb10b6377UL,0xe63fcc12UL,0x76463cedUL,0xa7f5cd85UL,0xc307dbb5UL,0xd908ef24UL,0x9258b4f0UL,0x16ec1e98UL,0x96d4bb4dUL,0x6a767d53UL,0x84e7b18fUL,0x88c780abUL,0xacf4ebb8UL,0x333c53bUL,0xb3b05be7UL,0x88096364UL,0x360f71b5UL,0xb8fb8d61UL,0x6679bd99UL,0xbe3628d9UL,0x503cac44UL,0x1c2069acUL,0x358631b3UL,0x26d55ecdUL,0xe6b6efabUL,0xbe658899UL,0xcd69210cUL,0x99d05bb2UL,0x4b29650dUL,0x23e71f56UL,0xcbc2940aUL,0x6ab9dd1cUL,0x8120417eUL,0x22f7c83aUL,0xb0f7827eUL,0xdb1af35UL,0xd7c5b348UL,0xe64251ebUL,0x3cdbcbc9UL,0xde7a8cb0UL,0x39d740eeUL,0xfc5bb317UL,0x211e3d4fUL,0xcb51cb0eUL,0x5e85ea1aUL,0xb4decf16UL,0x9e3dc7fUL,0xbf0b892eUL,0x7df4b876UL,0xf23e8cfcUL,0x4d4be184UL,0x3a7796abUL,0xfb714e2bUL,0xe0a4c68dUL,0xd6428055UL,0x1d3faa59UL,0x2a40db03UL,0x2365102UL,0xd1f171f9UL,0xd828ca3aUL,0x4bb3ca1fUL,0x3682a66fUL,0xf1940b0cUL,0xfa7c8642UL,0xa5a4a939UL,0x8ebb3548UL,0xe1cd0488UL,0xaf93ae0eUL,0xa90e1b19UL,0xe321a948UL,0x1c18df09UL,0xbe3ef067UL,0xeb4cb888UL,0x7a671c41UL,0xabca2fbeUL,0x396de76UL,0x87fa43a0UL,0xac0f847UL,0xceb7b770UL,0xd930059aUL,0x873ad52UL,0xd26f3e3eUL,0x613a8facUL,0xc52a33e6UL,0x120cddcbUL,0xa8ebab21UL,0x989aac71UL,0xb50e0abbUL,0xc6215d8UL,0xfefb8db3UL,0xb4850a13UL,0xfb2f1272UL,0xf419db1dUL,0x1adeec1dUL,0xb9db4fabUL,0x11acfeaaUL,0x8eb7100UL,0x4f0af7afUL,0xe8921556UL,0xc412bf7UL,0x595f18e4UL,0x151b375UL,0x36867504UL,0x1cdeb568UL,0x35fda267UL,0xb53be9b4UL,0xcba4d9b9UL,0xd4902ddcUL,0xb5c289aUL,0xede6e2d2UL,0x7d84b577UL,0xe0919607UL,0x8da6c562UL,0xfad57946UL,0xcd7127a3UL,0x3d32871UL,0xc12a74dcUL,0x65978371UL,0xd9283be6UL,0x2fdb7b6aUL,0xd669c9cUL,0x627a7756UL,0x9e2137dfUL,0xf62dee9aUL,0x190cecd3UL,0x1e22fc0cUL,0xdd1f8990UL,0xbb508382UL,0x6c4de198UL,0xfbcd7851UL,0xf849e9eUL,0x4d2f0e34UL,0x1f10dbe4UL,0xb1344d12UL,0x6d956d37UL,0x615c18aaUL,0xbb61f4a2UL,0x6dfff15eUL,0x837f86dfUL,0x6371919cUL,0xb9d51f9dUL,0x4f6b911eUL,0x494c783bUL,0xc2747f30UL,0xc2d81bcbUL,0x13e7f8fbUL,0xe51ea160UL,0x8c25239UL,0x4d03ef92UL,0xd2544bebUL,0x3d79d4d7UL,0x890bb26bUL,0x3ce1d7a3UL,0xc45d0e3cUL,0xa474ea0fUL,0x903c03b6UL,0x67f1c8beUL,0xed48d475UL,0xa7805cdeUL,0x8d7c2f95UL,0x9172a373UL,0xd9236c91UL,0xd2bc4b2UL,0x5c5f7aa1UL,0xceb131c4UL,0x952ddfa7UL,0xd0568fcfUL,0x9372a80bUL,0xf7c1be8UL,0x5b2d9113UL,0xdb333f7cUL,0x50d4906cUL,0xa21d6330UL,0xad576b0cUL,0xbaf24ffaUL,0x97f61097UL,0x6da4002UL,0xb881a854UL,0xf54cadf9UL,0x355900e8UL,0x5ae6a284UL,0xdf465e4fUL,0x45512309UL,0xeb2fa29eUL,0x1ffe7cdbUL,0xc6eeecd1UL,0xafaf6e73UL,0xfd9920b2UL,0xfe81e481UL,0x2b92ce6UL,0xacc2aafbUL,0x8d027affUL,0x3d63c263UL,0x3c0c5ac3UL,0x2d15de9dUL,0x4c7141c5UL,0x39b02ab2UL,0xecbfa7b4UL,0x52232113UL,0x3ff7cc8aUL,0x6f099aa3UL,0xc446c12UL,0xbbc1902cUL,0xca1d146dUL,0x6f43f1b8UL,0xff2dae7UL,0x4f00c5c9UL,0xa2a3eec8UL,0xf8ad63d6UL,0x9f1b0c8cUL,0xc1982bcbUL,0xe41b3186UL,0xfce3bac9UL,0x6356c373UL,0x4e7a1413UL,0xa714146fUL,0x65e33836UL,0xdc12ae2cUL,0xca767a60UL,0xbb511c04UL,0xaaedd352UL,0x47494f10UL,0xd23f4c46UL,0x19d2ab3eUL,0xffbac182UL,0x48301ab8UL,0x70de11beUL,0xf3611b39UL,0x6ac32147UL,0xf60519a0UL,0x656bf5b3UL,0xdf1aa1deUL,0x485f476eUL,0xf9b247dcUL,0x4797e96fUL,0xcb5a9276UL,0xd8389154UL,0xdfd9934dUL,0x4753dfcbUL,0x91734a9bUL,0x4cf2a10dUL,0x92b10e2cUL,0x8f157cd5UL,0xb69ecd12UL,0x86c87ebcUL,0x72bc8387UL,0xb18eace7UL,0xe28ade0dUL,0xef23a07eUL,0xadc7d3fUL,0x6874833aUL,0x4b0c70b8UL,0x97c1595bUL,0x6c4f643bUL,0x4be68952UL,0x41847d1dUL,0x52586e96UL,0x4ece6961UL,0x6bd13625UL,0xacfa9187UL,0x257dcd1cUL,0xe054c726UL,0x548e6c03UL,0x7dcf91b6UL,0x7018e812UL,0x91f1ba7aUL,0x10f99bc8UL,0xe536c212UL,0xcf4d4906UL,0x9dbce59aUL,0xfd72c9e8UL,0xb251b04bUL,0xa425286aUL,0xbf88f4b0UL,0x381fd021UL,0xa3a1dd1UL,0xf79bb81aUL,0xaa06730bUL,0xdcaa8545UL,0xce58c90eUL,0x3a2048ebUL,0xdf9f0d3UL,0xcb1dc6afUL,0x745523aUL,0xe6c9c471UL,0x54e72576UL,0x3fee6e64UL,0x864e66ecUL,0xdb9c0657UL,0x2fe7bb5cUL,0x97204ab4UL,0x41f48bddUL,0xbd687237UL,0x93e5c016UL,0x210c656UL,0xb09d9884UL,0x93599863UL,0x810b9c9cUL,0x4b5b02aUL,0x565915c7UL,0x6c128957UL,0xd97fbee4UL,0xffecc94cUL,0x8aafa26cUL,0xa2835c3dUL,0x1283c4aaUL,0x7eb96e75UL,0x40ab3902UL,0xdb57426bUL,0xcb76ed3fUL,0x8f687d7cUL,0x3f76534fUL,0xaa24269fUL,0x1db92bcbUL,0x52f6d0ffUL,0x23055ec7UL,0xa1f0742fUL,0xc5fdedaUL,0xcf82048bUL,0x4d40d819UL,0x8e32c89bUL,0xd0907345UL,0x8ebdd862UL,0xa9a5c641UL,0xdf93bcdcUL,0xa4f24f0cUL,0x3b867b7fUL,0x2665b1b6UL,0xefed0f7bUL,0x35e581a1UL,0x3e3a4bdbUL,0x296473afUL,0xc9d37995UL,0x306cffbUL,0xe1ae0a1eUL,0xcb5bf70bUL,0xd886d297UL,0xe2a2d6fdUL,0xdc4c8b1dUL,0xce3c9f64UL,0x90cb3d9eUL,0x4cfea878UL,0x5153aa8aUL,0x7c4d1581UL,0xfbc13f76UL,0xec7a8edaUL,0x562197dcUL,0x269c6bc7UL,0x233b9c81UL,0x8403a722UL,0x10681ed3UL,0x9781416UL,0xff9602f1UL,0xc774a9e7UL,0x354a433bUL,0x670637bcUL,0xddce68ccUL,0x966b9225UL,0xc09b9b97UL,0x5ef47480UL,0xebf59ae4UL,0xb8a3c6aaUL,0x8bfdc2f2UL,0xb505a57aUL,0x8ca206fdUL,0x6aa9ab61UL,0x3a4275d1UL,0xe3d4bb45UL,0x513481d6UL,0x9cb03268UL,0x35122f1dUL,0x235c52deUL,0x88dc536aUL,0x43e8ea0UL,0x7b7e213eUL,0x16552696UL,0xf02d23dUL,0x6a95aa0dUL,0xc17784ebUL,0x84307077UL,0x1225cde7UL,0x1f668c36UL,0xc79cf134UL,0x305f6acdUL,0xd6faad37UL,0xb96cd630UL,0xfdbc8cf5UL,0x6e868ee4UL,0x47d25e52UL,0xc7c8734fUL,0x6a9e378UL,0x5da6141fUL,0xa8a49b6cUL,0x905a0094UL,0x502d26dcUL,0x1ee8648aUL,0x899f64e2UL,0x862ff1cfUL,0x1ff405cbUL,0xc419f78cUL,0x4695d855UL,0xd8e89531UL,0x9ac79ad3UL,0x21ffe048UL,0x70df7abbUL,0xd88be2e2UL,0x76a17faeUL,0xe27550fcUL,0x88df8ed6UL,0x8075dd07UL,0x2abae3ffUL,0xc34c27bbUL,0x15b0720bUL,0x3bef7923UL,0x75a313e3UL,0x24476150UL,0xf0e9447UL,0x7de8608dUL,0xbae88cd9UL,0x4e485b91UL,0xb155d7d2UL,0xf9c0e6e9UL,0x3035b2b7UL,0x3bc6db89UL,0x10b6d079UL,0x12549155UL,0x83c839f2UL,0x4ea31e3aUL,0xfacee001UL,0x87d0b362UL,0x35155f7fUL,0x2e8037b6UL,0xc2e1e663UL,0x26c05bc0UL,0xe2fe0c1fUL,0x45c8abf5UL,0xf8f5e752UL,0xca6cf8cUL,0xb5415ca1UL,0x6361e6cUL,0x8a66869cUL,0x39086b5UL,0x85fee7a1UL,0x3b0e74d5UL,0x5c47a018UL,0x602d78a9UL,0x425b1774UL,0x6e29e07fUL,0xfde8e06eUL,0x2938ff15UL,0x15f7dc3aUL,0x72452d13UL,0xe7f74817UL,0xfd1a85dUL,0x612d9275UL,0x321358ebUL,0x77351c6UL,0x4ced74a0UL,0xbf164474UL,0xd7fc8a1cUL,0x6791659UL,0x6eed942bUL,0xdcbf1b9aUL,0x341e75beUL,0x5c6774a2UL,0xdd5b0c47UL,0xfb0006b5UL,0x9ee4bf75UL,0xddc4a28aUL,0xc1c98e20UL,0xeb67f889UL,0x428ab36dUL,0x412d4bf0UL,0xc7bb85a2UL,0x3a82c58fUL,0x455f7319UL,0x7eb63480UL,0xc3a2211UL,0xb7b25bd4UL,0xdd0c5185UL,0x82fcba21UL,0xa3e3296cUL,0x673172efUL,0x83ab5dc6UL,0x845f1efaUL,0xe24724c7UL,0xd77aa75aUL,0x3cc9b06aUL,0x9cf4d6e7UL,0x5ca700e3UL,0x993efdd6UL,0x63c0effdUL,0xe54dbafbUL,0x23d97341UL,0x1543d9d1UL,0x8c230178UL,0xe167de46UL,0xd0207a7UL,0xc4e37017UL,0x5c4da453UL,0x4913904cUL,0x1ba116e5UL,0x5bdcbf15UL,0x1301aa5fUL,0x7f00af4cUL,0x3ff411ddUL,0x263482dbUL,0xdd02b1bfUL,0xfa442f10UL,0x8bf93ac6UL,0x8678ff73UL,0xa00ebf59UL,0xb82a6e20UL,0xd5af5957UL,0xecc92232UL,0xcef744ccUL,0x51d22b7eUL,0x27a5d06cUL,0x70372b78UL,0xcfe5cffdUL,0x7c6899f4UL,0x20da5561UL,0x580344e4UL,0xb8dc9e2dUL,0x2137241eUL,0xad2452e7UL,0x203a202cUL,0x5bce0ce8UL,0x37c4635dUL,0xe8ae2124UL,0x61c38fb4UL,0x37c25c82UL,0x1ace634UL,0xa20881c2UL,0x7ac753baUL,0x150859d6UL,0xf47eb24fUL,0x6220f8d9UL,0x73191f23UL,0xff61c194UL,0x4e80c1cdUL,0xd43e30b5UL,0xfa78064eUL,0x8763480UL,0x374dc57dUL,0x6ae12cabUL,0x56ded794UL,0x886bee64UL,0x2e039dafUL,0x7a1f391dUL,0xbf028235UL,0xa891a594UL,0x7860b87fUL,0x727157edUL,0x3e25ba4aUL,0xfbc35e61UL,0x1b88e1ddUL,0xd3405972UL,0x8a7f220UL,0x6c4a70e9UL,0xe1c79ce3UL,0x6d0bbfc8UL,0x1108cb6cUL,0x5f7e630cUL,0xd2f7c1dUL,0x7f66286fUL,0xfbb483a6UL,0xfdb72303UL,0x493988e8UL,0x6aa32bc9UL,0x9566bee4UL,0x446180c8UL,0x7820054bUL,0xbb1c446UL,0x3d3dcae7UL,0x6c83d7a6UL,0xe663f82eUL,0x1UL}  }
 };
+#endif
 
 #endif
 
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* philox4x32.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PHILOX4X32_H__
+#define __PHILOX4X32_H__
+
+#include "prand.h"
+#include "prand_philox4x32_inline.h"
+
+/*============================================================================*\
+                  Kernels for generating blocks of the outputs
+\*============================================================================*/
+
+typedef struct {
+  /* encrypt the counters ctr, ctr + 1, ..., ctr + n - 1 with the same key,
+   * and store the 4 words of every block consecutively */
+  void (*blocks) (uint32_t *, const uint32_t *, const uint32_t *,
+      const size_t);
+} philox4x32_kernel_t;
+
+/******************************************************************************
+Function `philox4x32_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const philox4x32_kernel_t *philox4x32_kernel(void);
+
+
+/*============================================================================*\
+                            Initialisation function
+\*============================================================================*/
+
+/******************************************************************************
+Function `philox4x32_init`:
+  Initialisation of the Philox4x32-10 generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *philox4x32_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err);
+
+#endif
@@ -32,13 +32,18 @@
 #define __PRAND_H__
 
 #include <stdint.h>
+#include <stddef.h>
 
 /*============================================================================*\
                    List of available random number generators
 \*============================================================================*/
 typedef enum {
   PRAND_RNG_MRG32K3A = 0,
-  PRAND_RNG_MT19937 = 1
+  PRAND_RNG_MT19937 = 1,
+  PRAND_RNG_PHILOX4X32 = 2,
+  PRAND_RNG_XOSHIRO256PP = 3,
+  PRAND_RNG_SFMT19937 = 4,
+  PRAND_RNG_DSFMT19937 = 5
 } prand_rng_enum;
 
 
@@ -49,6 +54,17 @@ typedef enum {
 #define PRAND_ERR_MEMORY_JUMP           (-2)
 #define PRAND_ERR_STEP                  (-3)
 #define PRAND_ERR_UNDEF_RNG             (-4)
+#define PRAND_ERR_JUMP_TYPE             (-5)
+#define PRAND_ERR_PARAM                 (-6)
+#define PRAND_ERR_FILE                  (-7)
+#define PRAND_ERR_SAVE_FORMAT           (-8)
+#define PRAND_ERR_SAVE_SIZE             (-9)
+#define PRAND_ERR_TABLE                 (-10)
+#define PRAND_ERR_STREAM                (-11)
+#define PRAND_ERR_SUBSTREAM             (-12)
+#define PRAND_ERR_STATS                 (-13)
+#define PRAND_ERR_PIPE                  (-14)
+#define PRAND_ERR_EVICTED               (-15)
 #define PRAND_WARN_SEED                 1
 
 #define PRAND_IS_ERROR(err)             ((err) < 0)
@@ -58,6 +74,25 @@ typedef enum {
               Universal interface of the random number generators
 \*============================================================================*/
 
+/* Pre-computed jump-ahead for a given step size. */
+typedef struct {
+  prand_rng_enum type;          /* type of the random number generator */
+  uint64_t step;                /* step size for jumping ahead */
+  void *data;                   /* pre-computed data for jumping ahead */
+} prand_jump_t;
+
+/* Counters of the operations on streams, available if the library is
+ * compiled with `-DPRAND_STATS`. */
+typedef struct {
+  uint64_t ndraw;               /* numbers sampled with the interface */
+  uint64_t nregen;              /* regenerations of the state arrays */
+  uint64_t njump;               /* jumps performed */
+  uint64_t nskip;               /* steps skipped by the jumps, modulo 2^64 */
+  uint64_t nfail;               /* jumps failed to allocate memory */
+  double time_poly;             /* seconds for jump polynomials or matrices */
+  double time_forward;          /* seconds for advancing the states */
+} prand_stats_t;
+
 typedef struct prand_struct {
   void *state;                  /* the state for single stream */
   void **state_stream;          /* states for multiple streams */
@@ -65,10 +100,27 @@ typedef struct prand_struct {
   prand_rng_enum type;          /* type of the random number generator */
   int64_t min;                  /* minimum value of the random integer */
   int64_t max;                  /* maximum value of the random integer */
+  int ndraw53;                  /* steps consumed by every `get_double53` */
+  void *cache;                  /* cache of recently used jumps */
+  void *substream;              /* starting points of the substreams */
   /* function pointers for sampling numbers */
   uint64_t (*get) (void *);
   double (*get_double) (void *);
   double (*get_double_pos) (void *);
+  double (*get_double53) (void *);
+  /* function pointers for sampling numbers in batch */
+  void (*fill) (void *, uint64_t *, const size_t);
+  void (*fill_double) (void *, double *, const size_t);
+  void (*fill_double_pos) (void *, double *, const size_t);
+  void (*fill_double53) (void *, double *, const size_t);
+  /* function pointers for sampling numbers from all streams in lock-step */
+  void (*fill_all) (struct prand_struct *, uint64_t *, const size_t);
+  void (*fill_all_double) (struct prand_struct *, double *, const size_t);
+  void (*fill_all_double_pos) (struct prand_struct *, double *, const size_t);
+  void (*fill_all_double53) (struct prand_struct *, double *, const size_t);
+  /* function pointers for sampling Gaussian numbers */
+  double (*get_gaussian) (void *);
+  void (*fill_gaussian) (void *, double *, const size_t);
   /* function pointers for reseting states with seed and skipping steps */
   void (*reset) (void *, const uint64_t, const uint64_t, int *);
   void (*reset_all) (struct prand_struct *, const uint64_t, const uint64_t,
@@ -76,6 +128,12 @@ typedef struct prand_struct {
   /* function pointers for jumping ahead */
   void (*jump) (void *, const uint64_t, int *);
   void (*jump_all) (struct prand_struct *, const uint64_t, int *);
+  /* function pointers for pre-computed jumps */
+  prand_jump_t *(*jump_prepare) (struct prand_struct *, const uint64_t, int *);
+  void (*jump_apply) (void *, const prand_jump_t *, int *);
+#ifdef PRAND_STATS
+  prand_stats_t stats;          /* counters of the operations on all streams */
+#endif
 } prand_t;
 
 /******************************************************************************
@@ -93,6 +151,25 @@ Return:
 prand_t *prand_init(const prand_rng_enum type, const uint64_t seed,
     const unsigned int nstream, const uint64_t step, int *err);
 
+/******************************************************************************
+Function `prand_init_slice`:
+  Initialisation of the interface with only a contiguous slice of streams,
+  which are identical to the ones of `prand_init` with `nstream` larger than
+  `first` + `count` - 1, without computing the streams before the slice.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `first`:    index of the first stream in the slice;
+  * `count`:    number of streams in the slice;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_init_slice(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int first, const unsigned int count, const uint64_t step,
+    int *err);
+
 /******************************************************************************
 Function `prand_errmsg`:
   Produce error message for a given error code.
@@ -111,5 +188,447 @@ Arguments:
 ******************************************************************************/
 void prand_destroy(prand_t *rng);
 
+/******************************************************************************
+Function `prand_jump_destroy`:
+  Release memory allocated for a pre-computed jump.
+Arguments:
+  * `jmp`:      the pre-computed jump.
+******************************************************************************/
+void prand_jump_destroy(prand_jump_t *jmp);
+
+/******************************************************************************
+Function `prand_jump_multi`:
+  Jump ahead for all streams, with different step sizes. The jump for a step
+  size shared by multiple streams is pre-computed only once, and no stream is
+  altered if any of the step sizes is too large.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step sizes for all the streams, with `rng->nstream` elements;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_jump_multi(prand_t *rng, const uint64_t *step, int *err);
+
+
+/*============================================================================*\
+                     Substreams inside every stream
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_substream_init`:
+  Split every stream into substreams with a given length, starting from the
+  current states of the streams. The jump to the next substream is
+  pre-computed only once.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `substep`:  length of every substream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_substream_init(prand_t *rng, const uint64_t substep, int *err);
+
+/******************************************************************************
+Function `prand_next_substream`:
+  Move a stream to the starting point of its next substream.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_next_substream(prand_t *rng, const int i, int *err);
+
+/******************************************************************************
+Function `prand_reset_substream`:
+  Move a stream back to the starting point of its current substream.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_reset_substream(prand_t *rng, const int i, int *err);
+
+
+/*============================================================================*\
+                   Checkpointing the states of all the streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_save_size`:
+  Size of the checkpoint of all the streams of an interface.
+Arguments:
+  * `rng`:      the random number generator interface.
+Return:
+  The size of the checkpoint, in bytes.
+******************************************************************************/
+size_t prand_save_size(const prand_t *rng);
+
+/******************************************************************************
+Function `prand_save`:
+  Write the states of all the streams to a buffer, in a versioned binary
+  format that is independent of the byte order of the machine.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `buf`:      the buffer for storing the checkpoint;
+  * `size`:     size of the buffer, at least `prand_save_size(rng)` bytes;
+  * `err`:      an integer for storing the error message.
+Return:
+  The number of bytes written.
+******************************************************************************/
+size_t prand_save(const prand_t *rng, void *buf, const size_t size,
+    int *err);
+
+/******************************************************************************
+Function `prand_load`:
+  Restore an interface from the checkpoint in a buffer, without jumping.
+Arguments:
+  * `buf`:      the buffer storing the checkpoint;
+  * `size`:     size of the buffer, in bytes;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_load(const void *buf, const size_t size, int *err);
+
+/******************************************************************************
+Function `prand_save_fd`:
+  Write the states of all the streams to a file descriptor, in the format of
+  `prand_save`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `fd`:       the file descriptor opened for writing;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_save_fd(const prand_t *rng, const int fd, int *err);
+
+/******************************************************************************
+Function `prand_load_fd`:
+  Restore an interface from the checkpoint read from a file descriptor,
+  without jumping.
+Arguments:
+  * `fd`:       the file descriptor opened for reading;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_load_fd(const int fd, int *err);
+
+
+/*============================================================================*\
+                Pre-computed tables of the states of all streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_table_create`:
+  Initialise the streams with a given configuration, and write the starting
+  states of all streams to a table file, in the native memory layout.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `fname`:    name of the table file;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_table_create(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int nstream, const uint64_t step, const char *fname,
+    int *err);
+
+/******************************************************************************
+Function `prand_init_from_file`:
+  Initialisation of the interface with the starting states of all streams
+  mapped from a table file created by `prand_table_create`, with the same
+  configuration. The file is mapped privately, so it is not modified by the
+  interface.
+Arguments:
+  * `fname`:    name of the table file;
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_init_from_file(const char *fname, const prand_rng_enum type,
+    const uint64_t seed, const unsigned int nstream, const uint64_t step,
+    int *err);
+
+
+/*============================================================================*\
+                  Streams materialised lazily on first access
+\*============================================================================*/
+
+/* Streams whose states are computed only when they are accessed. */
+typedef struct {
+  prand_t *rng;                 /* interface with the functions for sampling */
+  unsigned int nstream;         /* total number of streams */
+  uint64_t step;                /* step size between adjacent streams */
+  unsigned int max_idle;        /* maximum number of released states kept */
+  void *data;                   /* the states and their bookkeeping */
+} prand_lazy_t;
+
+/******************************************************************************
+Function `prand_init_lazy`:
+  Initialisation of streams that are materialised only on first access, with
+  the same starting states as the ones of `prand_init`.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `max_idle`: maximum number of released streams kept in memory;
+  * `err`:      an integer for storing the error message.
+Return:
+  The lazily materialised streams; NULL on error.
+******************************************************************************/
+prand_lazy_t *prand_init_lazy(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int nstream, const uint64_t step,
+    const unsigned int max_idle, int *err);
+
+/******************************************************************************
+Function `prand_lazy_stream`:
+  Acquire the state of a stream, which is computed if it is not in memory.
+  If the library is compiled with OpenMP, it can be called concurrently.
+  A stream evicted after being sampled is not restarted, and the error
+  `PRAND_ERR_EVICTED` is reported instead.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+Return:
+  The state of the stream; NULL on error.
+******************************************************************************/
+void *prand_lazy_stream(prand_lazy_t *lz, const unsigned int i, int *err);
+
+/******************************************************************************
+Function `prand_lazy_release`:
+  Release a stream acquired by `prand_lazy_stream`. Once a stream is not
+  acquired anymore, its state may be evicted. An evicted stream that has
+  not been sampled restarts from its starting point, or the position
+  recorded by `prand_lazy_compact`, on the next access, while the access of
+  one that has been sampled fails, instead of replaying its numbers.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream.
+******************************************************************************/
+void prand_lazy_release(prand_lazy_t *lz, const unsigned int i);
+
+/******************************************************************************
+Function `prand_lazy_compact`:
+  Release a stream acquired only by the caller, and free its state at once,
+  keeping only its position. On the next access, the stream is materialised
+  at `offset` steps after its starting point, with one more jump. A cached
+  Gaussian number is discarded.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream;
+  * `offset`:   position of the stream, i.e., the number of steps consumed
+                since its starting point;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_lazy_compact(prand_lazy_t *lz, const unsigned int i,
+    const uint64_t offset, int *err);
+
+/******************************************************************************
+Function `prand_lazy_destroy`:
+  Release memory allocated for the lazily materialised streams.
+Arguments:
+  * `lz`:       the lazily materialised streams.
+******************************************************************************/
+void prand_lazy_destroy(prand_lazy_t *lz);
+
+
+/*============================================================================*\
+                  Instrumentation of the sampling and jumps
+\*============================================================================*/
+
+/* Events reported to the hook for tracing the jumps. */
+#define PRAND_HOOK_JUMP_BEGIN           0
+#define PRAND_HOOK_JUMP_END             1
+
+/* Information of a jump passed to the hook. */
+typedef struct {
+  int event;                    /* `PRAND_HOOK_JUMP_BEGIN` or `_END` */
+  prand_rng_enum type;          /* type of the random number generator */
+  uint64_t step;                /* step size for jumping ahead */
+  int nstream;                  /* number of streams jumped ahead */
+  int err;                      /* the error status after the jump */
+} prand_hook_info_t;
+
+typedef void (*prand_hook_t) (const prand_hook_info_t *, void *);
+
+/******************************************************************************
+Function `prand_stats`:
+  Retrieve the counters of a stream, or the totals of all streams, including
+  the jumps shared by the streams, if the index is negative. It is available
+  only if the library is compiled with `-DPRAND_STATS`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream, or a negative number for all streams;
+  * `stats`:    the structure for storing the counters;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_stats(const prand_t *rng, const int i, prand_stats_t *stats,
+    int *err);
+
+/******************************************************************************
+Function `prand_stats_reset`:
+  Reset the counters of all the streams of an interface.
+Arguments:
+  * `rng`:      the random number generator interface.
+******************************************************************************/
+void prand_stats_reset(prand_t *rng);
+
+/******************************************************************************
+Function `prand_set_jump_hook`:
+  Register a function that is called before and after every jump, reset, or
+  pre-computed jump of all interfaces, with the information of the jump and
+  a user-supplied pointer. It replaces the previously registered hook, or
+  removes it if `hook` is NULL, and must not be called while any stream is
+  jumping ahead. The hook may be called concurrently by different threads.
+  It is available only if the library is compiled with `-DPRAND_STATS`.
+Arguments:
+  * `hook`:     the function to be called;
+  * `arg`:      the pointer passed to the function;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_set_jump_hook(prand_hook_t hook, void *arg, int *err);
+
+/*============================================================================*\
+               Conversion of the outputs to floating-point numbers
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_double53`:
+  Combine two consecutive 32-bit integers into a double-precision
+  floating-point number in the range [0,1), with 53-bit resolution, as is
+  done by `get_double53` for generators with 32-bit outputs.
+Arguments:
+  * `a`:        the integer providing the 27 most significant bits;
+  * `b`:        the integer providing the 26 least significant bits.
+Return:
+  The floating-point number.
+******************************************************************************/
+static inline double prand_double53(const uint32_t a, const uint32_t b) {
+  return ((int32_t) (a >> 5) * 67108864.0 + (int32_t) (b >> 6)) * 0x1p-53;
+}
+
+
+/*============================================================================*\
+                   Sampling numbers from other distributions
+\*============================================================================*/
+
+/******************************************************************************
+  The following functions transform numbers from the uniform distribution by
+  inversion, with exactly one uniform number consumed for every output, so
+  that the sequences are reproducible with any number of streams.
+******************************************************************************/
+
+/* Maximum mean value of the Poisson distribution. */
+#define PRAND_POISSON_MAX_MEAN          1e8
+
+/* Pre-computed look-up table of the Poisson distribution. */
+typedef struct {
+  double mean;                  /* the mean value */
+  uint64_t lo;                  /* the minimum integer of the table */
+  size_t len;                   /* number of elements of the table */
+  double *cdf;                  /* cumulative distribution function */
+  size_t *guide;                /* guide table for the search */
+} prand_poisson_t;
+
+/******************************************************************************
+Function `prand_fill_exp`:
+  Generate an array of numbers following the exponential distribution with
+  unit mean, from the numbers of `rng->get_double_pos`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+void prand_fill_exp(prand_t *rng, void *state, double *out, const size_t n);
+
+/******************************************************************************
+Function `prand_fill_normal`:
+  Generate an array of numbers following the standard normal distribution,
+  with the inverse of the cumulative distribution function, from the numbers
+  of `rng->get_double_pos`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+void prand_fill_normal(prand_t *rng, void *state, double *out, const size_t n);
+
+/******************************************************************************
+Function `prand_fill_uint`:
+  Generate an array of integers in the range [0,range), with the
+  multiply-shift method, from the numbers of `rng->get`. The integers are not
+  exactly uniform, with a relative bias below
+  range / (rng->max - rng->min + 1).
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `range`:    the upper bound (exclusive) of the integers, must be in the
+                range [1, rng->max - rng->min + 1];
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_fill_uint(prand_t *rng, void *state, uint64_t *out, const size_t n,
+    const uint64_t range, int *err);
+
+/******************************************************************************
+Function `prand_fill_poisson`:
+  Generate an array of integers following the Poisson distribution, by
+  inverting the look-up table of the cumulative distribution function, from
+  the numbers of `rng->get_double`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `mean`:     the mean value, must be in the range
+                (0, PRAND_POISSON_MAX_MEAN];
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_fill_poisson(prand_t *rng, void *state, uint64_t *out,
+    const size_t n, const double mean, int *err);
+
+/******************************************************************************
+Function `prand_poisson_prepare`:
+  Construct the look-up table of the Poisson distribution with a given mean,
+  to be reused by `prand_fill_poisson_prepared`.
+Arguments:
+  * `mean`:     the mean value, must be in the range
+                (0, PRAND_POISSON_MAX_MEAN];
+  * `err`:      an integer for storing the error message.
+Return:
+  The address of the table on success; NULL on error.
+******************************************************************************/
+prand_poisson_t *prand_poisson_prepare(const double mean, int *err);
+
+/******************************************************************************
+Function `prand_fill_poisson_prepared`:
+  Generate an array of integers following the Poisson distribution, by
+  inverting a pre-computed look-up table, from the numbers of
+  `rng->get_double`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `pois`:     the look-up table from `prand_poisson_prepare`.
+******************************************************************************/
+void prand_fill_poisson_prepared(prand_t *rng, void *state, uint64_t *out,
+    const size_t n, const prand_poisson_t *pois);
+
+/******************************************************************************
+Function `prand_poisson_destroy`:
+  Release memory allocated for the look-up table of the Poisson distribution.
+Arguments:
+  * `pois`:     the look-up table.
+******************************************************************************/
+void prand_poisson_destroy(prand_poisson_t *pois);
+
 #endif
 
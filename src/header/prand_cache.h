@@ -0,0 +1,100 @@
+/*******************************************************************************
+* prand_cache.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_CACHE_H__
+#define __PRAND_CACHE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*============================================================================*\
+             Least-recently-used cache of pre-computed jump-aheads
+\*============================================================================*/
+
+/* Maximum number of step sizes kept in the cache of each interface. */
+#ifndef PRAND_CACHE_SIZE
+  #define PRAND_CACHE_SIZE      8
+#endif
+
+typedef struct {
+  size_t size;                          /* size of the data for each step */
+  int num;                              /* number of cached step sizes */
+  uint64_t clock;                       /* counter of cache accesses */
+  uint64_t step[PRAND_CACHE_SIZE];      /* the cached step sizes */
+  uint64_t used[PRAND_CACHE_SIZE];      /* time of the last accesses */
+  unsigned char *data;                  /* pre-computed data for all steps */
+  void *work;                           /* workspace for evaluating jumps */
+} prand_cache_t;
+
+/******************************************************************************
+Function `prand_cache_init`:
+  Initialise an empty cache, together with the workspace for evaluating and
+  applying jumps with the whole interface.
+Arguments:
+  * `size`:     size of the pre-computed data for each step, in bytes;
+  * `wsize`:    size of the workspace, in bytes.
+Return:
+  The pointer to the cache on success; NULL on error.
+******************************************************************************/
+prand_cache_t *prand_cache_init(const size_t size, const size_t wsize);
+
+/******************************************************************************
+Function `prand_cache_find`:
+  Look up the pre-computed data for a given step size.
+Arguments:
+  * `cache`:    the cache;
+  * `step`:     the step size for jumping ahead.
+Return:
+  The pointer to the pre-computed data; NULL if the step is not cached.
+******************************************************************************/
+void *prand_cache_find(prand_cache_t *cache, const uint64_t step);
+
+/******************************************************************************
+Function `prand_cache_insert`:
+  Reserve the space for the pre-computed data of a given step size, by
+  evicting the least recently used entry if the cache is full.
+Arguments:
+  * `cache`:    the cache;
+  * `step`:     the step size for jumping ahead.
+Return:
+  The pointer to the space for the pre-computed data, to be filled by the
+  caller.
+******************************************************************************/
+void *prand_cache_insert(prand_cache_t *cache, const uint64_t step);
+
+/******************************************************************************
+Function `prand_cache_destroy`:
+  Release memory allocated for the cache.
+Arguments:
+  * `cache`:    the cache.
+******************************************************************************/
+void prand_cache_destroy(prand_cache_t *cache);
+
+#endif
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* prand_cpu.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_CPU_H__
+#define __PRAND_CPU_H__
+
+/*============================================================================*\
+              Macros for the runtime dispatch of vectorised kernels
+\*============================================================================*/
+
+/*******************************************************************************
+  On x86 machines, kernels for different instruction sets are compiled in the
+  same translation unit with the `target` attribute of GCC/Clang, and the
+  fastest one supported by the CPU is selected at runtime. Only the baseline
+  SSE2 instructions are required for compiling the library.
+
+  On AArch64 machines, the NEON instructions are always available, so the
+  kernels are selected at compile time.
+
+  The vectorised kernels can be disabled by defining `PRAND_NO_SIMD`.
+*******************************************************************************/
+
+#if !defined(PRAND_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+  #define PRAND_SIMD_X86
+  #include <immintrin.h>
+  #define PRAND_TARGET(isa)     __attribute__((target(isa)))
+  #define PRAND_CPU_HAS(isa)    __builtin_cpu_supports(isa)
+#elif !defined(PRAND_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+  #define PRAND_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+#endif
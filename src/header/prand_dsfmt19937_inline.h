@@ -0,0 +1,156 @@
+/*******************************************************************************
+* prand_dsfmt19937_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_DSFMT19937_INLINE_H__
+#define __PRAND_DSFMT19937_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the dSFMT19937 generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_DSFMT19937` can be sampled with
+  the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+  The state array is regenerated by the vectorised kernel of the library.
+*******************************************************************************/
+
+/*============================================================================*\
+                       Definitions of the dSFMT19937 state
+\*============================================================================*/
+
+#define DSFMT19937_N            191     /* number of 128-bit words */
+#define DSFMT19937_N64          (DSFMT19937_N * 2)
+
+typedef struct {
+  uint64_t s[DSFMT19937_N64 + 2];       /* the state array and the lung */
+  int idx;
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_dsfmt19937_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_dsfmt19937_gen_all`:
+  Generate `DSFMT19937_N` 128-bit words of the state array at one time, with
+  the fastest kernel supported by the CPU.
+Arguments:
+  * `s`:        the state array, followed by the lung.
+******************************************************************************/
+void prand_dsfmt19937_gen_all(uint64_t *s);
+
+/******************************************************************************
+Function `prand_dsfmt19937_to_double`:
+  Reinterpret a 64-bit word as a double-precision floating-point number.
+Arguments:
+  * `x`:        the word to be converted.
+Return:
+  The floating-point number.
+******************************************************************************/
+static inline double prand_dsfmt19937_to_double(const uint64_t x) {
+  union { uint64_t u; double d; } r;
+  r.u = x;
+  return r.d;
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_next`:
+  Retrieve the next word of the state array, and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  The bits of a floating-point number in the range [1,2).
+******************************************************************************/
+static inline uint64_t prand_dsfmt19937_next(prand_dsfmt19937_state_t *stat) {
+  if (stat->idx >= DSFMT19937_N64) {    /* generate N64 words at one time */
+    prand_dsfmt19937_gen_all(stat->s);
+    stat->idx = 0;
+  }
+  return stat->s[stat->idx++];
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_get`:
+  Generate an integer from the 32 least significant bits of a word, and
+  update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static inline uint64_t prand_dsfmt19937_get(prand_dsfmt19937_state_t *stat) {
+  return prand_dsfmt19937_next(stat) & 0xffffffffUL;
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_get_double`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  52-bit resolution.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_dsfmt19937_get_double(
+    prand_dsfmt19937_state_t *stat) {
+  return prand_dsfmt19937_to_double(prand_dsfmt19937_next(stat)) - 1.0;
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_dsfmt19937_get_double_pos(
+    prand_dsfmt19937_state_t *stat) {
+  return prand_dsfmt19937_to_double(prand_dsfmt19937_next(stat) | 1) - 1.0;
+}
+
+/******************************************************************************
+Function `prand_dsfmt19937_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), which
+  is identical to `prand_dsfmt19937_get_double`, with 52-bit resolution.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_dsfmt19937_get_double53(
+    prand_dsfmt19937_state_t *stat) {
+  return prand_dsfmt19937_get_double(stat);
+}
+
+#endif
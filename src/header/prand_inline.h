@@ -0,0 +1,105 @@
+/*******************************************************************************
+* prand_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_INLINE_H__
+#define __PRAND_INLINE_H__
+
+#include "prand.h"
+#include "prand_mrg32k3a_inline.h"
+#include "prand_mt19937_inline.h"
+#include "prand_philox4x32_inline.h"
+#include "prand_xoshiro256pp_inline.h"
+#include "prand_sfmt19937_inline.h"
+#include "prand_dsfmt19937_inline.h"
+
+/*******************************************************************************
+  Inline interface of all the random number generators. The state of a
+  stream initialised by `prand_init` is converted to the concrete type of the
+  generator, e.g.
+
+    prand_mt19937_state_t *stat = rng->state_stream[i];
+
+  and then sampled with the type-specialised functions, e.g.
+  `prand_mt19937_get_double(stat)`, or the following macros, which select the
+  functions by the generator name:
+
+    PRAND_INLINE_GET_DOUBLE(mt19937, stat)
+
+  With C11 compilers, the functions can also be selected by the type of the
+  state, e.g. `prand_inline_get_double(stat)`. The results are identical to
+  those of the function pointers of `prand_t`, and the two interfaces can be
+  mixed freely on the same state.
+*******************************************************************************/
+
+/*============================================================================*\
+                  Type-specialised macros for the C99 standard
+\*============================================================================*/
+
+#define PRAND_INLINE_GET(gen, stat)             prand_##gen##_get(stat)
+#define PRAND_INLINE_GET_DOUBLE(gen, stat)      prand_##gen##_get_double(stat)
+#define PRAND_INLINE_GET_DOUBLE_POS(gen, stat)                          \
+  prand_##gen##_get_double_pos(stat)
+#define PRAND_INLINE_GET_DOUBLE53(gen, stat)                            \
+  prand_##gen##_get_double53(stat)
+
+
+/*============================================================================*\
+                    Type-generic selection for the C11 standard
+\*============================================================================*/
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+/******************************************************************************
+Macro `PRAND_INLINE_GENERIC`:
+  Select the function of a given kind by the type of the state.
+Arguments:
+  * `stat`:     the pointer to the state of the concrete type;
+  * `func`:     the kind of the function, e.g. `get_double`.
+******************************************************************************/
+#define PRAND_INLINE_GENERIC(stat, func) _Generic((stat),               \
+  prand_mrg32k3a_state_t *: prand_mrg32k3a_##func,                      \
+  prand_mt19937_state_t *: prand_mt19937_##func,                        \
+  prand_philox4x32_state_t *: prand_philox4x32_##func,                  \
+  prand_xoshiro256pp_state_t *: prand_xoshiro256pp_##func,              \
+  prand_sfmt19937_state_t *: prand_sfmt19937_##func,                    \
+  prand_dsfmt19937_state_t *: prand_dsfmt19937_##func)
+
+#define prand_inline_get(stat)                                          \
+  PRAND_INLINE_GENERIC(stat, get)(stat)
+#define prand_inline_get_double(stat)                                   \
+  PRAND_INLINE_GENERIC(stat, get_double)(stat)
+#define prand_inline_get_double_pos(stat)                               \
+  PRAND_INLINE_GENERIC(stat, get_double_pos)(stat)
+#define prand_inline_get_double53(stat)                                 \
+  PRAND_INLINE_GENERIC(stat, get_double53)(stat)
+
+#endif
+
+#endif
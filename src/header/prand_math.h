@@ -0,0 +1,71 @@
+/*******************************************************************************
+* prand_math.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_MATH_H__
+#define __PRAND_MATH_H__
+
+#include <stddef.h>
+
+/*============================================================================*\
+            Kernels for transforming uniform numbers to other distributions
+\*============================================================================*/
+
+typedef struct {
+  /* transform pairs of uniform numbers in the range (0,1), stored in place
+   * as (u1, u2), into pairs of independent standard Gaussian numbers */
+  void (*box_muller) (double *, const size_t);
+  /* compute -ln(x) in place, for x in the range (0,1) */
+  void (*neg_log) (double *, const size_t);
+  /* compute the inverse of the standard normal CDF in place, for x in the
+   * range (0,1) */
+  void (*norm_icdf) (double *, const size_t);
+} prand_math_kernel_t;
+
+/******************************************************************************
+Function `prand_box_muller`:
+  Transform pairs of uniform numbers into Gaussian numbers with the
+  Box-Muller method, using the scalar code. The results are identical to those
+  of the vectorised kernels.
+Arguments:
+  * `z`:        the uniform numbers in (0,1) on input, and the Gaussian numbers
+                on output, with 2 * `npair` elements;
+  * `npair`:    the number of pairs.
+******************************************************************************/
+void prand_box_muller(double *z, const size_t npair);
+
+/******************************************************************************
+Function `prand_math_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const prand_math_kernel_t *prand_math_kernel(void);
+
+#endif
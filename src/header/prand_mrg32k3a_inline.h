@@ -0,0 +1,155 @@
+/*******************************************************************************
+* prand_mrg32k3a_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_MRG32K3A_INLINE_H__
+#define __PRAND_MRG32K3A_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the MRG32k3a generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_MRG32K3A` can be sampled with
+  the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+*******************************************************************************/
+
+/*============================================================================*\
+                  Definitions of the MRG32k3a state transition
+\*============================================================================*/
+
+#define MRG32K3A_M1     4294967087LL            /* 2^32 - 209 */
+#define MRG32K3A_M2     4294944443LL            /* 2^32 - 22853 */
+#define MRG32K3A_A12    1403580
+#define MRG32K3A_A13    (-810728)
+#define MRG32K3A_A21    527612
+#define MRG32K3A_A23    (-1370589)
+
+/* The following two numbers ensure postive p1 and p2. */
+#define MRG32K3A_ADD1   3482050076509336LL      /* m1 * a13 */
+#define MRG32K3A_ADD2   5886603609186927LL      /* m2 * a23 */
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define MRG32K3A_NORM           0x1.000000d00000bp-32   /* 1 / (1 + m1) */
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define MRG32K3A_NORM_POS       0x1.000000cf0000ap-32   /* 1 / (2 + m1) */
+/* Weight of the second number for a float-point number with 53-bit
+ * resolution. */
+#define MRG32K3A_NORM53         0x1p-24                 /* 2^{-24} */
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+typedef struct {
+  int64_t s10, s11, s12;
+  int64_t s20, s21, s22;
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_mrg32k3a_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_mrg32k3a_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer in the range [1, MRG32K3A_M1].
+******************************************************************************/
+static inline uint64_t prand_mrg32k3a_get(prand_mrg32k3a_state_t *stat) {
+  /* Component 1 */
+  int64_t p1 = (MRG32K3A_A12 * stat->s11 + MRG32K3A_A13 * stat->s10 +
+      MRG32K3A_ADD1) % MRG32K3A_M1;
+  stat->s10 = stat->s11;
+  stat->s11 = stat->s12;
+  stat->s12 = p1;
+
+  /* Component 2 */
+  int64_t p2 = (MRG32K3A_A21 * stat->s22 + MRG32K3A_A23 * stat->s20 +
+      MRG32K3A_ADD2) % MRG32K3A_M2;
+  stat->s20 = stat->s21;
+  stat->s21 = stat->s22;
+  stat->s22 = p2;
+
+  /* Combination */
+  if (p1 <= p2) return (p1 - p2 + MRG32K3A_M1);
+  else return (p1 - p2);
+}
+
+/******************************************************************************
+Function `prand_mrg32k3a_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mrg32k3a_get_double(prand_mrg32k3a_state_t *stat) {
+  return prand_mrg32k3a_get(stat) * MRG32K3A_NORM;
+}
+
+/******************************************************************************
+Function `prand_mrg32k3a_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mrg32k3a_get_double_pos(
+    prand_mrg32k3a_state_t *stat) {
+  return (prand_mrg32k3a_get(stat) + 1) * MRG32K3A_NORM_POS;
+}
+
+/******************************************************************************
+Function `prand_mrg32k3a_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive numbers u1 and u2 in the range
+  [0,1): (u1 + u2 * 2^{-24}) mod 1.
+  ref: https://doi.org/10.1287/opre.50.6.1073.358
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mrg32k3a_get_double53(
+    prand_mrg32k3a_state_t *stat) {
+  const double u = prand_mrg32k3a_get(stat) * MRG32K3A_NORM;
+  const double v = u +
+    prand_mrg32k3a_get(stat) * MRG32K3A_NORM * MRG32K3A_NORM53;
+  return (v < 1) ? v : v - 1;
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* prand_mt19937_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_MT19937_INLINE_H__
+#define __PRAND_MT19937_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the MT19937 generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_MT19937` can be sampled with
+  the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+  The state array is regenerated by the vectorised kernel of the library.
+*******************************************************************************/
+
+/*============================================================================*\
+                  Definitions of the MT19937 state transition
+\*============================================================================*/
+
+#define MT19937_N       624
+#define MT19937_M       397
+#define MT19937_MA      0x9908b0dfUL
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define MT19937_NORM            0x1p-32                 /* 2^{-32} */
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define MT19937_NORM_POS        0x1.fffffffep-33        /* 1 / (2^{32} + 1) */
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+typedef struct {
+  uint32_t mt[MT19937_N];
+  int idx;
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_mt19937_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_mt19937_twist`:
+  Generate `MT19937_N` words of the state array at one time, with the fastest
+  kernel supported by the CPU.
+Arguments:
+  * `mt`:       the state array.
+******************************************************************************/
+void prand_mt19937_twist(uint32_t *mt);
+
+/******************************************************************************
+Function `prand_mt19937_temper`:
+  Tempering of an element of the state array.
+Arguments:
+  * `y`:        the element to be tempered.
+Return:
+  The tempered integer.
+******************************************************************************/
+static inline uint32_t prand_mt19937_temper(uint32_t y) {
+  y ^= (y >> 11);
+  y ^= (y << 7) & 0x9d2c5680UL;
+  y ^= (y << 15) & 0xefc60000UL;
+  y ^= (y >> 18);
+  return y;
+}
+
+/******************************************************************************
+Function `prand_mt19937_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static inline uint64_t prand_mt19937_get(prand_mt19937_state_t *stat) {
+  if (stat->idx >= MT19937_N) { /* generate N words at one time */
+    prand_mt19937_twist(stat->mt);
+    stat->idx = 0;
+  }
+  return prand_mt19937_temper(stat->mt[stat->idx++]);
+}
+
+/******************************************************************************
+Function `prand_mt19937_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mt19937_get_double(prand_mt19937_state_t *stat) {
+  return prand_mt19937_get(stat) * MT19937_NORM;
+}
+
+/******************************************************************************
+Function `prand_mt19937_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mt19937_get_double_pos(
+    prand_mt19937_state_t *stat) {
+  return (prand_mt19937_get(stat) + 1) * MT19937_NORM_POS;
+}
+
+/******************************************************************************
+Function `prand_mt19937_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_mt19937_get_double53(prand_mt19937_state_t *stat) {
+  const uint32_t a = prand_mt19937_get(stat);
+  return prand_double53(a, prand_mt19937_get(stat));
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* prand_philox4x32_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_PHILOX4X32_INLINE_H__
+#define __PRAND_PHILOX4X32_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the Philox4x32-10 generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_PHILOX4X32` can be sampled with
+  the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+*******************************************************************************/
+
+/*============================================================================*\
+                 Definitions of the Philox4x32-10 bijection
+\*============================================================================*/
+
+#define PHILOX4X32_M0           0xD2511F53UL
+#define PHILOX4X32_M1           0xCD9E8D57UL
+#define PHILOX4X32_W0           0x9E3779B9UL    /* golden ratio */
+#define PHILOX4X32_W1           0xBB67AE85UL    /* sqrt(3) - 1 */
+#define PHILOX4X32_ROUNDS       10
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define PHILOX4X32_NORM         0x1p-32                 /* 2^{-32} */
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define PHILOX4X32_NORM_POS     0x1.fffffffep-33        /* 1 / (2^{32} + 1) */
+
+/******************************************************************************
+Function `prand_philox4x32_block`:
+  Encrypt a 128-bit counter with a 64-bit key.
+Arguments:
+  * `out`:      the 4 output words;
+  * `ctr`:      the 4 words of the counter, from the least significant one;
+  * `key`:      the 2 words of the key.
+******************************************************************************/
+static inline void prand_philox4x32_block(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key) {
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < PHILOX4X32_ROUNDS; r++) {
+    if (r) {
+      k0 += PHILOX4X32_W0;
+      k1 += PHILOX4X32_W1;
+    }
+    const uint64_t p0 = (uint64_t) PHILOX4X32_M0 * c0;
+    const uint64_t p1 = (uint64_t) PHILOX4X32_M1 * c2;
+    c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+    c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+    c1 = (uint32_t) p1;
+    c3 = (uint32_t) p0;
+  }
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/******************************************************************************
+Function `prand_philox4x32_ctr_add`:
+  Increase a 128-bit counter.
+Arguments:
+  * `ctr`:      the 4 words of the counter, from the least significant one;
+  * `n`:        the increment.
+******************************************************************************/
+static inline void prand_philox4x32_ctr_add(uint32_t *ctr, const uint64_t n) {
+  uint64_t s = (uint64_t) ctr[0] + (n & 0xffffffffUL);
+  ctr[0] = (uint32_t) s;
+  s = (s >> 32) + ctr[1] + (n >> 32);
+  ctr[1] = (uint32_t) s;
+  s = (s >> 32) + ctr[2];
+  ctr[2] = (uint32_t) s;
+  ctr[3] += (uint32_t) (s >> 32);
+}
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+typedef struct {
+  uint32_t ctr[4];              /* counter of the next block */
+  uint32_t key[2];              /* the key, i.e., the seed */
+  uint32_t buf[4];              /* the current block */
+  int idx;                      /* index of the next word in `buf` */
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_philox4x32_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_philox4x32_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static inline uint64_t prand_philox4x32_get(prand_philox4x32_state_t *stat) {
+  if (stat->idx >= 4) {         /* generate 4 words at one time */
+    prand_philox4x32_block(stat->buf, stat->ctr, stat->key);
+    prand_philox4x32_ctr_add(stat->ctr, 1);
+    stat->idx = 0;
+  }
+  return stat->buf[stat->idx++];
+}
+
+/******************************************************************************
+Function `prand_philox4x32_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_philox4x32_get_double(
+    prand_philox4x32_state_t *stat) {
+  return prand_philox4x32_get(stat) * PHILOX4X32_NORM;
+}
+
+/******************************************************************************
+Function `prand_philox4x32_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_philox4x32_get_double_pos(
+    prand_philox4x32_state_t *stat) {
+  return (prand_philox4x32_get(stat) + 1) * PHILOX4X32_NORM_POS;
+}
+
+/******************************************************************************
+Function `prand_philox4x32_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_philox4x32_get_double53(
+    prand_philox4x32_state_t *stat) {
+  const uint32_t a = prand_philox4x32_get(stat);
+  return prand_double53(a, prand_philox4x32_get(stat));
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* prand_sfmt19937_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_SFMT19937_INLINE_H__
+#define __PRAND_SFMT19937_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the SFMT19937 generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_SFMT19937` can be sampled with
+  the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+  The state array is regenerated by the vectorised kernel of the library.
+*******************************************************************************/
+
+/*============================================================================*\
+                        Definitions of the SFMT19937 state
+\*============================================================================*/
+
+#define SFMT19937_N             156     /* number of 128-bit words */
+#define SFMT19937_N32           (SFMT19937_N * 4)
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define SFMT19937_NORM          0x1p-32                 /* 2^{-32} */
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define SFMT19937_NORM_POS      0x1.fffffffep-33        /* 1 / (2^{32} + 1) */
+
+typedef struct {
+  uint32_t sfmt[SFMT19937_N32];
+  int idx;
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_sfmt19937_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_sfmt19937_gen_all`:
+  Generate `SFMT19937_N` 128-bit words of the state array at one time, with
+  the fastest kernel supported by the CPU.
+Arguments:
+  * `sfmt`:     the state array.
+******************************************************************************/
+void prand_sfmt19937_gen_all(uint32_t *sfmt);
+
+/******************************************************************************
+Function `prand_sfmt19937_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static inline uint64_t prand_sfmt19937_get(prand_sfmt19937_state_t *stat) {
+  if (stat->idx >= SFMT19937_N32) {     /* generate N32 words at one time */
+    prand_sfmt19937_gen_all(stat->sfmt);
+    stat->idx = 0;
+  }
+  return stat->sfmt[stat->idx++];
+}
+
+/******************************************************************************
+Function `prand_sfmt19937_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_sfmt19937_get_double(
+    prand_sfmt19937_state_t *stat) {
+  return prand_sfmt19937_get(stat) * SFMT19937_NORM;
+}
+
+/******************************************************************************
+Function `prand_sfmt19937_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_sfmt19937_get_double_pos(
+    prand_sfmt19937_state_t *stat) {
+  return (prand_sfmt19937_get(stat) + 1) * SFMT19937_NORM_POS;
+}
+
+/******************************************************************************
+Function `prand_sfmt19937_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_sfmt19937_get_double53(
+    prand_sfmt19937_state_t *stat) {
+  const uint32_t a = prand_sfmt19937_get(stat);
+  return prand_double53(a, prand_sfmt19937_get(stat));
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* prand_state.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_STATE_H__
+#define __PRAND_STATE_H__
+
+#include "prand.h"
+#include <stddef.h>
+
+/*============================================================================*\
+                    Memory layout of the states of all streams
+\*============================================================================*/
+
+/* Alignment for the states of the streams, to avoid false sharing. */
+#ifndef PRAND_CACHE_LINE
+  #define PRAND_CACHE_LINE      64
+#endif
+/* Alignment for large states, so that every state occupies its own pages. */
+#ifndef PRAND_PAGE_SIZE
+  #define PRAND_PAGE_SIZE       4096
+#endif
+
+/* Offset of the counters of a stream, which are stored right after the state
+ * if the library is compiled with `-DPRAND_STATS`. */
+#define PRAND_STATS_OFFSET(size)        (((size) + 7) & ~(size_t) 7)
+
+/******************************************************************************
+Function `prand_state_stride`:
+  Distance between the states of adjacent streams, with the space for the
+  counters of the stream if the library is compiled with `-DPRAND_STATS`.
+Arguments:
+  * `size`:     size of each state, in bytes;
+  * `align`:    alignment of the states in bytes, must be a power of 2.
+Return:
+  The distance between adjacent states, in bytes.
+******************************************************************************/
+size_t prand_state_stride(const size_t size, const size_t align);
+
+/******************************************************************************
+Function `prand_state_alloc`:
+  Allocate the states for all streams in a single block, with every state
+  aligned to the given boundary. If the library is compiled with OpenMP, the
+  states are first touched in parallel, with the same static distribution of
+  streams as `#pragma omp for schedule(static)`, so that the memory pages of
+  the states are placed close to the threads owning the streams.
+Arguments:
+  * `stream`:   the array for storing the pointers to the states;
+  * `size`:     size of each state, in bytes;
+  * `num`:      number of states;
+  * `align`:    alignment of the states in bytes, must be a power of 2.
+Return:
+  The pointer to the first state on success; NULL on error.
+******************************************************************************/
+void *prand_state_alloc(void **stream, const size_t size,
+    const unsigned int num, const size_t align);
+
+/******************************************************************************
+Function `prand_state_free`:
+  Release memory allocated for the states.
+Arguments:
+  * `state`:    the pointer to the first state.
+******************************************************************************/
+void prand_state_free(void *state);
+
+/* Space reserved before the first state, for the information of the block. */
+#define PRAND_STATE_RESERVE     (sizeof(void *) + sizeof(size_t))
+
+/******************************************************************************
+Function `prand_state_adopt`:
+  Take over the states of all streams stored in a memory-mapped file, which
+  is released together with the states by `prand_state_free`.
+Arguments:
+  * `stream`:   the array for storing the pointers to the states;
+  * `map`:      address of the mapping;
+  * `map_size`: size of the mapping, in bytes;
+  * `offset`:   offset of the first state in the mapping, which must be no
+                smaller than `PRAND_STATE_RESERVE`;
+  * `stride`:   distance between the states of adjacent streams, in bytes;
+  * `num`:      number of states.
+Return:
+  The pointer to the first state.
+******************************************************************************/
+void *prand_state_adopt(void **stream, void *map, const size_t map_size,
+    const size_t offset, const size_t stride, const unsigned int num);
+
+/******************************************************************************
+Function `prand_state_layout`:
+  Size and alignment of the state of a given type of generator, as is used by
+  `prand_init`.
+Arguments:
+  * `type`:     type of the random number generator;
+  * `align`:    the alignment of the state, in bytes.
+Return:
+  The size of the state, in bytes; 0 if the type is undefined.
+******************************************************************************/
+size_t prand_state_layout(const prand_rng_enum type, size_t *align);
+
+
+/*============================================================================*\
+                   Starting points of the substreams of streams
+\*============================================================================*/
+
+/* Starting points of the current substreams of all streams. */
+typedef struct {
+  prand_jump_t *jmp;            /* jump to the next substream */
+  size_t size;                  /* size of each state, in bytes */
+  void *block;                  /* the block of all the starting states */
+  void **start;                 /* starting states of the current substreams */
+} prand_substream_t;
+
+#endif
@@ -0,0 +1,249 @@
+/*******************************************************************************
+* prand_stats.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_STATS_H__
+#define __PRAND_STATS_H__
+
+#include "prand.h"
+#include "prand_state.h"
+
+/*******************************************************************************
+  Instrumentation of the interfaces, which is compiled only with
+  `-DPRAND_STATS`, so that it costs nothing otherwise. The counters of every
+  stream are stored right after its state, and updated by the wrappers of the
+  functions of the interface, which are defined by `PRAND_STATS_FUNCS` for
+  every generator, and installed by `PRAND_STATS_WRAP` once the streams are
+  initialised. The counters of the jumps shared by all streams, i.e., the
+  cached jump-ahead polynomials or matrices, are stored in the interface.
+*******************************************************************************/
+
+#ifdef PRAND_STATS
+
+/* Bookkeeping of a jump in progress. */
+typedef struct {
+  prand_hook_info_t info;       /* information passed to the hook */
+  prand_stats_t *stats;         /* counters for the time of the jump */
+  double time_poly;             /* `stats->time_poly` before the jump */
+  double start;                 /* time at the beginning of the jump */
+} prand_stats_jump_t;
+
+/******************************************************************************
+Function `prand_stats_clock`:
+  The wall-clock time from an arbitrary point.
+Return:
+  The time in seconds.
+******************************************************************************/
+double prand_stats_clock(void);
+
+/******************************************************************************
+Function `prand_stats_jump_begin`:
+  Start recording a jump, and report it to the hook.
+Arguments:
+  * `jmp`:      the bookkeeping of the jump;
+  * `stats`:    the counters for the time of the jump;
+  * `type`:     type of the random number generator;
+  * `step`:     step size for jumping ahead;
+  * `nstream`:  number of streams jumped ahead;
+  * `err`:      the error status before the jump.
+******************************************************************************/
+void prand_stats_jump_begin(prand_stats_jump_t *jmp, prand_stats_t *stats,
+    const prand_rng_enum type, const uint64_t step, const int nstream,
+    const int err);
+
+/******************************************************************************
+Function `prand_stats_jump_end`:
+  Finish recording a jump, and report it to the hook. The time of the jump
+  apart from the evaluation of polynomials or matrices is accounted for
+  advancing the states.
+Arguments:
+  * `jmp`:      the bookkeeping of the jump;
+  * `err`:      the error status after the jump.
+Return:
+  Non-zero if the jump is successful.
+******************************************************************************/
+int prand_stats_jump_end(prand_stats_jump_t *jmp, const int err);
+
+/******************************************************************************
+Function `prand_stats_stream_all`:
+  Update the counters of all streams of an interface, for sampling or
+  jumping ahead all of them in lock-step.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `size`:     size of the state, in bytes;
+  * `ndraw`:    number of numbers sampled from every stream;
+  * `step`:     number of steps skipped by every stream.
+******************************************************************************/
+void prand_stats_stream_all(prand_t *rng, const size_t size,
+    const uint64_t ndraw, const uint64_t step);
+
+/* The counters of the stream with a given state. */
+#define PRAND_STATS_STREAM(state, size)                                 \
+  ((prand_stats_t *) ((unsigned char *) (state) + PRAND_STATS_OFFSET(size)))
+
+/* Clear the counters of the interface. */
+#define PRAND_STATS_CLEAR(rng)                                          \
+  memset(&(rng)->stats, 0, sizeof(prand_stats_t))
+
+/* Count the regeneration of the state array of a stream, if the condition
+ * is true. */
+#define PRAND_STATS_REGEN(stat, cond)                                   \
+  do {                                                                  \
+    if (cond) PRAND_STATS_STREAM(stat, sizeof(*(stat)))->nregen++;      \
+  } while (0)
+
+/* Account the time of evaluating jump-ahead polynomials or matrices to the
+ * counters of an interface or a stream. */
+#define PRAND_STATS_POLY(stats, expr) {                                 \
+  const double prand_stats_t0 = prand_stats_clock();                    \
+  expr;                                                                 \
+  (stats)->time_poly += prand_stats_clock() - prand_stats_t0;           \
+}
+
+/* Install the wrappers defined by `PRAND_STATS_FUNCS`, with the counters of
+ * all streams reset. */
+#define PRAND_STATS_WRAP(rng, pre) {                                    \
+  prand_stats_reset(rng);                                               \
+  (rng)->get = &pre##_stats_get;                                        \
+  (rng)->get_double = &pre##_stats_get_double;                          \
+  (rng)->get_double_pos = &pre##_stats_get_double_pos;                  \
+  (rng)->get_double53 = &pre##_stats_get_double53;                      \
+  (rng)->fill = &pre##_stats_fill;                                      \
+  (rng)->fill_double = &pre##_stats_fill_double;                        \
+  (rng)->fill_double_pos = &pre##_stats_fill_double_pos;                \
+  (rng)->fill_double53 = &pre##_stats_fill_double53;                    \
+  (rng)->get_gaussian = &pre##_stats_get_gaussian;                      \
+  (rng)->fill_gaussian = &pre##_stats_fill_gaussian;                    \
+  (rng)->fill_all = &pre##_stats_fill_all;                              \
+  (rng)->fill_all_double = &pre##_stats_fill_all_double;                \
+  (rng)->fill_all_double_pos = &pre##_stats_fill_all_double_pos;        \
+  (rng)->fill_all_double53 = &pre##_stats_fill_all_double53;            \
+  (rng)->reset = &pre##_stats_reset;                                    \
+  (rng)->reset_all = &pre##_stats_reset_all;                            \
+  (rng)->jump = &pre##_stats_jump;                                      \
+  (rng)->jump_all = &pre##_stats_jump_all;                              \
+  (rng)->jump_prepare = &pre##_stats_jump_prepare;                      \
+  (rng)->jump_apply = &pre##_stats_jump_apply;                          \
+}
+
+/* Wrapper of a function sampling one number from a stream. */
+#define PRAND_STATS_GET(pre, func, state_t, ret_t)                      \
+static ret_t pre##_stats_##func(void *state) {                          \
+  PRAND_STATS_STREAM(state, sizeof(state_t))->ndraw++;                  \
+  return pre##_##func(state);                                           \
+}
+
+/* Wrapper of a function sampling an array of numbers from a stream. */
+#define PRAND_STATS_FILL(pre, func, state_t, out_t)                     \
+static void pre##_stats_##func(void *state, out_t *out, const size_t n) { \
+  PRAND_STATS_STREAM(state, sizeof(state_t))->ndraw += n;               \
+  pre##_##func(state, out, n);                                          \
+}
+
+/* Wrapper of a function sampling arrays of numbers from all streams. */
+#define PRAND_STATS_FILL_ALL(pre, func, state_t, out_t)                 \
+static void pre##_stats_##func(prand_t *rng, out_t *out, const size_t n) { \
+  prand_stats_stream_all(rng, sizeof(state_t), n, 0);                   \
+  pre##_##func(rng, out, n);                                            \
+}
+
+/* Wrapper of a function jumping ahead one stream, with the step size given
+ * by an expression of the arguments `args`. */
+#define PRAND_STATS_JUMP(pre, func, state_t, type, step, params, args)  \
+static void pre##_stats_##func params {                                 \
+  prand_stats_t *stats = PRAND_STATS_STREAM(state, sizeof(state_t));    \
+  prand_stats_jump_t jump;                                              \
+  if (PRAND_IS_ERROR(*err)) return;                                     \
+  prand_stats_jump_begin(&jump, stats, type, step, 1, *err);            \
+  pre##_##func args;                                                    \
+  if (prand_stats_jump_end(&jump, *err) && (step)) {                    \
+    stats->njump++;                                                     \
+    stats->nskip += (step);                                             \
+  }                                                                     \
+}
+
+/* Wrapper of a function jumping ahead all streams. */
+#define PRAND_STATS_JUMP_ALL(pre, func, state_t, type, params, args)    \
+static void pre##_stats_##func params {                                 \
+  prand_stats_jump_t jump;                                              \
+  if (PRAND_IS_ERROR(*err)) return;                                     \
+  prand_stats_jump_begin(&jump, &rng->stats, type, step, rng->nstream,  \
+      *err);                                                            \
+  pre##_##func args;                                                    \
+  if (prand_stats_jump_end(&jump, *err) && step)                        \
+    prand_stats_stream_all(rng, sizeof(state_t), 0, step);              \
+}
+
+/* Define the wrappers of all the functions of the interface for the
+ * generator with the function prefix `pre`. */
+#define PRAND_STATS_FUNCS(pre, state_t, type)                           \
+PRAND_STATS_GET(pre, get, state_t, uint64_t)                            \
+PRAND_STATS_GET(pre, get_double, state_t, double)                       \
+PRAND_STATS_GET(pre, get_double_pos, state_t, double)                   \
+PRAND_STATS_GET(pre, get_double53, state_t, double)                     \
+PRAND_STATS_GET(pre, get_gaussian, state_t, double)                     \
+PRAND_STATS_FILL(pre, fill, state_t, uint64_t)                          \
+PRAND_STATS_FILL(pre, fill_double, state_t, double)                     \
+PRAND_STATS_FILL(pre, fill_double_pos, state_t, double)                 \
+PRAND_STATS_FILL(pre, fill_double53, state_t, double)                   \
+PRAND_STATS_FILL(pre, fill_gaussian, state_t, double)                   \
+PRAND_STATS_FILL_ALL(pre, fill_all, state_t, uint64_t)                  \
+PRAND_STATS_FILL_ALL(pre, fill_all_double, state_t, double)             \
+PRAND_STATS_FILL_ALL(pre, fill_all_double_pos, state_t, double)         \
+PRAND_STATS_FILL_ALL(pre, fill_all_double53, state_t, double)           \
+PRAND_STATS_JUMP(pre, jump, state_t, type, step,                        \
+    (void *state, const uint64_t step, int *err), (state, step, err))   \
+PRAND_STATS_JUMP(pre, jump_apply, state_t, type, jmp->step,             \
+    (void *state, const prand_jump_t *jmp, int *err), (state, jmp, err)) \
+PRAND_STATS_JUMP(pre, reset, state_t, type, step,                       \
+    (void *state, const uint64_t seed, const uint64_t step, int *err),  \
+    (state, seed, step, err))                                           \
+PRAND_STATS_JUMP_ALL(pre, jump_all, state_t, type,                      \
+    (prand_t *rng, const uint64_t step, int *err), (rng, step, err))    \
+PRAND_STATS_JUMP_ALL(pre, reset_all, state_t, type,                     \
+    (prand_t *rng, const uint64_t seed, const uint64_t step, int *err), \
+    (rng, seed, step, err))                                             \
+static prand_jump_t *pre##_stats_jump_prepare(prand_t *rng,             \
+    const uint64_t step, int *err) {                                    \
+  prand_jump_t *jmp = pre##_jump_prepare(rng, step, err);               \
+  if (*err == PRAND_ERR_MEMORY_JUMP) rng->stats.nfail++;                \
+  return jmp;                                                           \
+}
+
+#else
+
+#define PRAND_STATS_CLEAR(rng)
+#define PRAND_STATS_REGEN(stat, cond)   do { } while (0)
+#define PRAND_STATS_POLY(stats, expr)   { expr; }
+#define PRAND_STATS_WRAP(rng, pre)
+#define PRAND_STATS_FUNCS(pre, state_t, type)
+
+#endif
+
+#endif
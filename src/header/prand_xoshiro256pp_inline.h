@@ -0,0 +1,171 @@
+/*******************************************************************************
+* prand_xoshiro256pp_inline.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __PRAND_XOSHIRO256PP_INLINE_H__
+#define __PRAND_XOSHIRO256PP_INLINE_H__
+
+#include "prand.h"
+
+/*******************************************************************************
+  Inline interface of the xoshiro256++ generator. The states of streams
+  initialised by `prand_init` with `PRAND_RNG_XOSHIRO256PP` can be sampled
+  with the following functions, which give the same numbers as the function
+  pointers of `prand_t`, but can be inlined into the loops of the caller.
+*******************************************************************************/
+
+/*============================================================================*\
+                Definitions of the xoshiro256++ state transition
+\*============================================================================*/
+
+/* Normalisation for sampling a float-point number in the range [0,1), from
+ * the 53 most significant bits of an output. */
+#define XOSHIRO256PP_NORM       0x1p-53                 /* 2^{-53} */
+/* Normalisation for sampling a float-point number in the range (0,1), from
+ * the 52 most significant bits of an output. */
+#define XOSHIRO256PP_NORM_POS   0x1p-52                 /* 2^{-52} */
+
+/******************************************************************************
+Function `prand_xoshiro256pp_rotl`:
+  Rotate a 64-bit word to the left.
+Arguments:
+  * `x`:        the word to be rotated;
+  * `k`:        the number of bits, in the range [1,63].
+Return:
+  The rotated word.
+******************************************************************************/
+static inline uint64_t prand_xoshiro256pp_rotl(const uint64_t x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+/******************************************************************************
+Macro `XOSHIRO256PP_NEXT`:
+  Generate a 64-bit output and update the state, kept in local variables.
+Arguments:
+  * `x`:        the variable for storing the output;
+  * `s0`-`s3`:  the words of the state.
+******************************************************************************/
+#define XOSHIRO256PP_NEXT(x, s0, s1, s2, s3) {                          \
+  const uint64_t t = (s1) << 17;                                        \
+  (x) = prand_xoshiro256pp_rotl((s0) + (s3), 23) + (s0);                \
+  (s2) ^= (s0);                                                         \
+  (s3) ^= (s1);                                                         \
+  (s1) ^= (s2);                                                         \
+  (s0) ^= (s3);                                                         \
+  (s2) ^= t;                                                            \
+  (s3) = prand_xoshiro256pp_rotl((s3), 45);                             \
+}
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+typedef struct {
+  uint64_t s[4];
+  double gauss;                 /* cached Gaussian number */
+  int has_gauss;                /* indicate whether `gauss` is available */
+} prand_xoshiro256pp_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_xoshiro256pp_next`:
+  Generate a 64-bit output and update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  The 64-bit output.
+******************************************************************************/
+static inline uint64_t prand_xoshiro256pp_next(
+    prand_xoshiro256pp_state_t *stat) {
+  uint64_t x;
+  XOSHIRO256PP_NEXT(x, stat->s[0], stat->s[1], stat->s[2], stat->s[3]);
+  return x;
+}
+
+/******************************************************************************
+Function `prand_xoshiro256pp_get`:
+  Generate an integer from the 32 most significant bits of an output, and
+  update the state.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static inline uint64_t prand_xoshiro256pp_get(
+    prand_xoshiro256pp_state_t *stat) {
+  return prand_xoshiro256pp_next(stat) >> 32;
+}
+
+/******************************************************************************
+Function `prand_xoshiro256pp_get_double`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_xoshiro256pp_get_double(
+    prand_xoshiro256pp_state_t *stat) {
+  return (prand_xoshiro256pp_next(stat) >> 11) * XOSHIRO256PP_NORM;
+}
+
+/******************************************************************************
+Function `prand_xoshiro256pp_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_xoshiro256pp_get_double_pos(
+    prand_xoshiro256pp_state_t *stat) {
+  return ((prand_xoshiro256pp_next(stat) >> 12) + 0.5) * XOSHIRO256PP_NORM_POS;
+}
+
+/******************************************************************************
+Function `prand_xoshiro256pp_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, which is identical to `prand_xoshiro256pp_get_double`.
+Arguments:
+  * `stat`:     the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static inline double prand_xoshiro256pp_get_double53(
+    prand_xoshiro256pp_state_t *stat) {
+  return prand_xoshiro256pp_get_double(stat);
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* sfmt19937.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __SFMT19937_H__
+#define __SFMT19937_H__
+
+#include "prand.h"
+#include "prand_sfmt19937_inline.h"
+
+/*============================================================================*\
+                  Definitions of the SFMT19937 state transition
+\*============================================================================*/
+
+#define SFMT19937_POS1          122
+#define SFMT19937_SL1           18
+#define SFMT19937_SL2           1       /* in bytes */
+#define SFMT19937_SR1           11
+#define SFMT19937_SR2           1       /* in bytes */
+#define SFMT19937_MSK1          0xdfffffefUL
+#define SFMT19937_MSK2          0xddfecb7fUL
+#define SFMT19937_MSK3          0xbffaffffUL
+#define SFMT19937_MSK4          0xbffffff6UL
+
+/******************************************************************************
+Function `sfmt19937_recursion`:
+  Generate a 128-bit word of the state array, with 32-bit words stored from
+  the least significant one.
+Arguments:
+  * `r`:        the generated word, which can be the same as `a`;
+  * `a`:        the word to be replaced;
+  * `b`:        the word with the offset POS1;
+  * `c`, `d`:   the last two generated words.
+******************************************************************************/
+static inline void sfmt19937_recursion(uint32_t *r, const uint32_t *a,
+    const uint32_t *b, const uint32_t *c, const uint32_t *d) {
+  /* 128-bit shifts of a by SL2 bytes to the left, and c by SR2 bytes to the
+   * right, with 64-bit integers. */
+  const uint64_t ah = ((uint64_t) a[3] << 32) | a[2];
+  const uint64_t al = ((uint64_t) a[1] << 32) | a[0];
+  const uint64_t ch = ((uint64_t) c[3] << 32) | c[2];
+  const uint64_t cl = ((uint64_t) c[1] << 32) | c[0];
+  const uint64_t xh = (ah << (SFMT19937_SL2 * 8)) |
+    (al >> (64 - SFMT19937_SL2 * 8));
+  const uint64_t xl = al << (SFMT19937_SL2 * 8);
+  const uint64_t yh = ch >> (SFMT19937_SR2 * 8);
+  const uint64_t yl = (cl >> (SFMT19937_SR2 * 8)) |
+    (ch << (64 - SFMT19937_SR2 * 8));
+
+  const uint32_t r0 = a[0] ^ (uint32_t) xl ^
+    ((b[0] >> SFMT19937_SR1) & SFMT19937_MSK1) ^ (uint32_t) yl ^
+    (d[0] << SFMT19937_SL1);
+  const uint32_t r1 = a[1] ^ (uint32_t) (xl >> 32) ^
+    ((b[1] >> SFMT19937_SR1) & SFMT19937_MSK2) ^ (uint32_t) (yl >> 32) ^
+    (d[1] << SFMT19937_SL1);
+  const uint32_t r2 = a[2] ^ (uint32_t) xh ^
+    ((b[2] >> SFMT19937_SR1) & SFMT19937_MSK3) ^ (uint32_t) yh ^
+    (d[2] << SFMT19937_SL1);
+  const uint32_t r3 = a[3] ^ (uint32_t) (xh >> 32) ^
+    ((b[3] >> SFMT19937_SR1) & SFMT19937_MSK4) ^ (uint32_t) (yh >> 32) ^
+    (d[3] << SFMT19937_SL1);
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3;
+}
+
+
+/*============================================================================*\
+                   Kernels for generating the state array
+\*============================================================================*/
+
+typedef struct {
+  /* generate `SFMT19937_N` 128-bit words of the state array at one time */
+  void (*gen_all) (uint32_t *);
+} sfmt19937_kernel_t;
+
+/******************************************************************************
+Function `sfmt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const sfmt19937_kernel_t *sfmt19937_kernel(void);
+
+
+/*============================================================================*\
+                            Initialisation function
+\*============================================================================*/
+
+/******************************************************************************
+Function `sfmt19937_init`:
+  Initialisation of the SFMT19937 generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *sfmt19937_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err);
+
+#endif
@@ -0,0 +1,274 @@
+/*******************************************************************************
+* sfmt19937_jump.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __SFMT19937_JUMP_H__
+#define __SFMT19937_JUMP_H__
+
+#include <stdint.h>
+
+/*============================================================================*\
+            Pre-computed polynomials for the modular reduction
+\*============================================================================*/
+
+/*******************************************************************************
+  ref: https://doi.org/10.1007/978-3-540-85912-3_26
+
+  phi is the characteristic polynomial of the state transition of SFMT19937,
+  with the state being the 156 128-bit words for generating the next words.
+  Its degree is the dimension of the state, which includes the 31 bits not
+  covered by the period of 2^19937 - 1.
+
+  The jump-ahead polynomials t^step mod phi are evaluated on the fly, with
+  the Barrett reduction:
+      mu = floor(t^(2 * deg) / phi).
+  The coefficients are stored from the lowest order, with 32-bit words.
+
+*******************************************************************************/
+
+#define SFMT19937_POLY_DEG     19968   /* degree of phi */
+#define SFMT19937_POLY_NW      625     /* number of words of phi and mu */
+
+const uint32_t sfmt19937_phi[SFMT19937_POLY_NW] = {
+  0x00000001UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00020000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00002800UL,0x00010000UL,0x00001000UL,0x00000000UL,0x00000000UL,
+  0x000000a0UL,0x00000000UL,0x00000140UL,0x00000000UL,0x00000000UL,0x0000000aUL,
+  0x00000000UL,0x11000014UL,0x00000000UL,0x82000000UL,0x00200000UL,0x00000000UL,
+  0x00540001UL,0x00000000UL,0x08280000UL,0x00008000UL,0x00000000UL,0x00114000UL,
+  0x00000000UL,0x00a08000UL,0x00000000UL,0x00004000UL,0x00000040UL,0x00000004UL,
+  0x000a0800UL,0x00000088UL,0x00000500UL,0x10000044UL,0x00000200UL,0x000080a0UL,
+  0x00000020UL,0x44000014UL,0x04400010UL,0x00000020UL,0x08000808UL,0x50088001UL,
+  0x05500001UL,0x00100001UL,0xa2200002UL,0x000200a0UL,0x11008200UL,0x04410000UL,
+  0x20810400UL,0x08028040UL,0x0008000aUL,0x01110088UL,0x01054100UL,0x000a0400UL,
+  0x82a20805UL,0x20200000UL,0x0015140aUL,0x40004050UL,0x10002804UL,0x88200008UL,
+  0x08808808UL,0x00094158UL,0x00010500UL,0xa00102a4UL,0xa0a0202aUL,0xc2800000UL,
+  0x0002d011UL,0x00040444UL,0x0ad444a2UL,0x0a820002UL,0x15028080UL,0x01110401UL,
+  0x26050105UL,0x028c1708UL,0x00828020UL,0x15122800UL,0x44141282UL,0x42201440UL,
+  0x44880c20UL,0x80082000UL,0x29419208UL,0x04d05010UL,0x01342400UL,0x2260a9a2UL,
+  0x8200a0a0UL,0x42b01180UL,0x44470047UL,0x60436680UL,0x80028a42UL,0x02800a02UL,
+  0x0d038108UL,0x10144884UL,0x8605200fUL,0x8a024985UL,0x44282080UL,0x0614be11UL,
+  0x7854480eUL,0x98284606UL,0x80a040d4UL,0x005aa004UL,0xe1456171UL,0x24915400UL,
+  0x41a1a172UL,0x41a80028UL,0x70e58020UL,0x8236063bUL,0x02c2c14eUL,0x045a0e43UL,
+  0x0c8a020eUL,0x1e1281a0UL,0x18ba8948UL,0x363f2145UL,0x61458186UL,0x02718122UL,
+  0x01222930UL,0x1cc00e44UL,0xa7263278UL,0x2854d800UL,0xa02c9855UL,0x68b8aa40UL,
+  0x04111bdcUL,0x03734509UL,0x602350a0UL,0x2600f3a0UL,0xb0bb80a5UL,0x644f4c31UL,
+  0x08ef2560UL,0xd20a1d46UL,0x11312406UL,0x8a0b4b92UL,0x009f9982UL,0x82ae7517UL,
+  0x9a200074UL,0x60175653UL,0x2436867cUL,0x640a7012UL,0xc862a715UL,0x8020484dUL,
+  0x48d8b424UL,0xe2e2e81bUL,0x0548ac38UL,0x72b122c3UL,0x90381012UL,0xd2a38707UL,
+  0xce1c70b7UL,0xcb56e0eeUL,0x47470682UL,0x35029903UL,0x5c7411e1UL,0xa8601f8bUL,
+  0x833a30b5UL,0x3775a12aUL,0x016f9a44UL,0x052143a0UL,0x12780c22UL,0xce3b6a12UL,
+  0xc11b954eUL,0xc05c5070UL,0x23bc8d00UL,0xa6b0b132UL,0xd7d998c0UL,0x26110291UL,
+  0x61246d50UL,0x2097e7a1UL,0x574d475cUL,0x8d4d25c4UL,0x7c8b1e6bUL,0x152e1418UL,
+  0xcb88e537UL,0xda950b3fUL,0x1836d521UL,0x83594475UL,0x53002240UL,0x2636a402UL,
+  0x964912a5UL,0xffef9c51UL,0xc523308cUL,0x7d4964adUL,0xaa726ab9UL,0x69f98f32UL,
+  0x425091ddUL,0x47130b37UL,0x24e21061UL,0x401ab0ffUL,0xe050cd4bUL,0x9453c512UL,
+  0x0d88fa5fUL,0x1ac68451UL,0xb2933017UL,0xa16ca218UL,0xea03afbaUL,0x5424cd6cUL,
+  0x3b286b75UL,0x3df8a93bUL,0x471bc681UL,0x32873ba3UL,0xecd48145UL,0x5b798315UL,
+  0xba2e3b9eUL,0xb45a9468UL,0x7ecae4b2UL,0xd571d445UL,0xd3bbfa43UL,0xc9d63e3bUL,
+  0xa9441ce2UL,0x192bea7fUL,0xc6cfa705UL,0x79b6d1bcUL,0xfa82ca0bUL,0xd63fc57eUL,
+  0xa64d7f35UL,0xc839574cUL,0x70ee9058UL,0xecf5868dUL,0x68cf95dbUL,0x29f4a755UL,
+  0x93eac127UL,0x67a63824UL,0x9f4a71cbUL,0xd196437fUL,0x7d461c7fUL,0x1b3022c2UL,
+  0x4085d0bcUL,0xa6a567ceUL,0xb7278a1eUL,0xae311af7UL,0x94a94bfcUL,0xa48c6002UL,
+  0x2f95b256UL,0xd624ca7aUL,0x5d847f18UL,0x56024161UL,0xa520d42cUL,0xc6371879UL,
+  0xd17e3abdUL,0xd08d5f07UL,0x7ad73124UL,0x3df9d3beUL,0x2cb4cbfaUL,0xc3368661UL,
+  0x0e8090c0UL,0x2dbe7974UL,0x6d4c79ecUL,0x30a4a80fUL,0x2ce7f435UL,0x5519d791UL,
+  0x9d0b2688UL,0xc764fa90UL,0xecc233f7UL,0x27c655cfUL,0xaf20a5f9UL,0xe85987a8UL,
+  0x14c8d5dcUL,0xd411bc73UL,0x6b45a3f0UL,0x93899b01UL,0xc20b0df0UL,0x61f5d113UL,
+  0x4a096903UL,0xb25da61eUL,0x6d3567afUL,0x0dbe028dUL,0x0c694a8bUL,0x9fa2ffe9UL,
+  0x3fbb001bUL,0xddbc8fc1UL,0x007675b1UL,0xd4f0394bUL,0x1439b4c5UL,0x82a77db8UL,
+  0xcba15b02UL,0xe3926b17UL,0x74f90065UL,0x8c9459c7UL,0x97a7280dUL,0xc96951bdUL,
+  0x2bca7f94UL,0xd05abe91UL,0x815f1c57UL,0x60711d1aUL,0x0d6cfd66UL,0x042d25ceUL,
+  0x63178c4fUL,0xe26807fcUL,0xb575c993UL,0x7ce8a197UL,0x348c4e6eUL,0x40b7cd97UL,
+  0x0b44faf6UL,0x4121abcaUL,0x7e436e7cUL,0xe5201805UL,0x348ff820UL,0xeee29d71UL,
+  0xbe049411UL,0x5897af73UL,0x2abfe601UL,0x0a6fdc8aUL,0x06e9acb9UL,0x9927489fUL,
+  0x4d2b3555UL,0x212a9e20UL,0x52c7e23bUL,0x726f34b1UL,0x9081e787UL,0xba18032bUL,
+  0x1f8d4fceUL,0x1e6fd762UL,0x680b74f2UL,0xddc1ca0aUL,0x3926fb78UL,0x0b73fbbbUL,
+  0xfbcb7c8cUL,0x99f11bf5UL,0x32e55b88UL,0xfa95b50dUL,0xf32feb9fUL,0x898481c3UL,
+  0x1a0da142UL,0x0c553080UL,0xf97df770UL,0xe8d7a917UL,0xa8423596UL,0x4875f816UL,
+  0x30a50aa9UL,0xdbb428b0UL,0x612c5231UL,0x0e3950a4UL,0x23c04d1dUL,0xe3e81823UL,
+  0x70a31febUL,0x391f65ddUL,0xa87036c2UL,0xd0037d2eUL,0x8d024115UL,0x585cb2a6UL,
+  0xb82e08daUL,0x3ca80652UL,0x8994a108UL,0x1222a69bUL,0xceae67bcUL,0x4de6d9cdUL,
+  0xbd55bf58UL,0xddca8edaUL,0x4667e48eUL,0xf6a0757eUL,0xb71a27e7UL,0x9b32d9f9UL,
+  0x8f20f8f8UL,0x40f2769fUL,0x7c88737fUL,0x45043e80UL,0x38f6f4afUL,0xb8ee0dd0UL,
+  0x7d62c435UL,0x1484c5e7UL,0xfa4d9131UL,0x8dd2569dUL,0x99db3861UL,0x5f523ec9UL,
+  0x37e8b00dUL,0x3418fa67UL,0x674ff9a5UL,0x269f5801UL,0x4925f868UL,0x0cd977b5UL,
+  0x2f5aac13UL,0x0efe2acaUL,0xa2f6b8c4UL,0x56317da6UL,0x50fa24ddUL,0xe534d382UL,
+  0xfeb39524UL,0xdfa8dc9aUL,0xbfe9f66fUL,0xf68b95bdUL,0x72132bd7UL,0xcd69cc67UL,
+  0xd98e8544UL,0xb5b4dfdeUL,0xcb87d8d7UL,0x0387409dUL,0x2ffcb147UL,0x8f002383UL,
+  0xafc4140fUL,0x2765011aUL,0x2eca2bddUL,0x83081b65UL,0x4b5b0ac3UL,0x4d14a10eUL,
+  0x819ec2c9UL,0x7c88af6eUL,0x25748090UL,0x0e191e6fUL,0x110a22f4UL,0xd6495ebdUL,
+  0xfb3cbcdfUL,0xdbf1f3ceUL,0x59c292caUL,0x9448bef7UL,0xe4d4acfbUL,0xa5634a3aUL,
+  0xc26ad6a4UL,0x7164a8c8UL,0xfb55c640UL,0x965e5a7cUL,0x992e424eUL,0xdcf519a0UL,
+  0xff342da1UL,0x8f610efdUL,0xaf2415d8UL,0xf9242248UL,0x164603b8UL,0x10c4b695UL,
+  0x2fa1757bUL,0x1e87d608UL,0x9015387cUL,0x7a57a7a9UL,0xd18197c4UL,0x286a730fUL,
+  0x8db3d5d7UL,0x33730359UL,0xffa6cb03UL,0xfec20b20UL,0x112f2932UL,0x420ebf29UL,
+  0x53939260UL,0x854a5d8bUL,0xf27695a2UL,0xcb1a14d9UL,0x26ac668eUL,0x70d1a3a7UL,
+  0x84c007a7UL,0xf1b6da42UL,0x5cb3134eUL,0x72a04fdcUL,0xe51d6b08UL,0x2a3d847fUL,
+  0x91cea167UL,0x3b3b804aUL,0x363cac3bUL,0xc59263aaUL,0x08af0885UL,0x034e7994UL,
+  0x52a6fa26UL,0x006262edUL,0x778a11e8UL,0xe0acc024UL,0x8447afcaUL,0xcd4d4ab1UL,
+  0x23a6c70cUL,0x576f1604UL,0x24500040UL,0x10631e86UL,0x8cc007feUL,0x02221f66UL,
+  0x05120745UL,0x4b061c01UL,0x4b520260UL,0x2b15ed7dUL,0xd63883d1UL,0x20410d99UL,
+  0xc3b54b20UL,0xe3375e48UL,0x34ecdea6UL,0xcc86a050UL,0xe91014a1UL,0xced1542aUL,
+  0x4f61246eUL,0x62298002UL,0x9c68f806UL,0x08b01365UL,0xf128b242UL,0xf5909002UL,
+  0x7a8458beUL,0x67d3234aUL,0xeeaa9176UL,0x201ac293UL,0x6d5fa140UL,0x0cb84802UL,
+  0x11114816UL,0x5c028837UL,0x4631ec3aUL,0x1c518a7cUL,0x407e6130UL,0x164ab085UL,
+  0xb1288189UL,0x00609822UL,0x8aad0882UL,0x420e0358UL,0xa144a900UL,0xa0558040UL,
+  0xb0022848UL,0x0054b1a8UL,0x486c5464UL,0x0a974810UL,0x422a4880UL,0x20406990UL,
+  0x0c864f08UL,0x04201d5aUL,0x208b518bUL,0x00a14580UL,0x80740015UL,0x2020d0b0UL,
+  0x3000a400UL,0xc000b332UL,0x400a9948UL,0x13011049UL,0x6a884c49UL,0x8348220cUL,
+  0x81080941UL,0x91500a57UL,0x92002140UL,0x16a001b4UL,0x3051a804UL,0x00a48092UL,
+  0x60854081UL,0x1b110014UL,0x1c20810aUL,0x01044200UL,0x01a30803UL,0x001a4d81UL,
+  0x82b32021UL,0x45520011UL,0xb61000a0UL,0x900000c8UL,0x10402074UL,0x48310080UL,
+  0x00180808UL,0xa9d1000aUL,0x42038108UL,0x2040020cUL,0xa0a03122UL,0x80400040UL,
+  0x8a111020UL,0x44880804UL,0x001440a0UL,0x0e8a1110UL,0x00080804UL,0x08891002UL,
+  0x05400101UL,0x22011208UL,0x40888030UL,0x20000000UL,0x48841500UL,0x04508800UL,
+  0x00800028UL,0x04088011UL,0x02010808UL,0x00a84140UL,0x80560201UL,0x22200102UL,
+  0x0000a804UL,0x00000002UL,0x000a0050UL,0x20050080UL,0x00000000UL,0x01000a00UL,
+  0x00000008UL,0x11008004UL,0x00004020UL,0x00220000UL,0x00100080UL,0x00000000UL,
+  0x00000004UL,0x00000000UL,0x00000000UL,0x08000000UL,0x40000000UL,0x00100000UL,
+  0x00000002UL,0x00002000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000001UL
+};
+
+const uint32_t sfmt19937_mu[SFMT19937_POLY_NW] = {
+  0x5972b513UL,0x39746789UL,0xae045512UL,0xff3c0f03UL,0x6b67fec3UL,0x4d9664b5UL,
+  0xa20c1cf0UL,0x0f47b286UL,0xd224f54fUL,0x0922634aUL,0xa8b243bbUL,0x876a759cUL,
+  0xe8dfdf47UL,0xb50ef825UL,0xe280c89fUL,0x5551de93UL,0x582c5d60UL,0x5aef0293UL,
+  0x06b80adaUL,0xfd088526UL,0x5ef73435UL,0x4e9f22f0UL,0xe7087fafUL,0x5e6f35d2UL,
+  0xfcc67dc9UL,0x83ab85adUL,0xfa36cfc5UL,0x392c09cdUL,0x7b8ac59dUL,0xb93ad46bUL,
+  0x33fb13ecUL,0xc7354813UL,0x653339b9UL,0x38c59a71UL,0xf2b80ad4UL,0x09665432UL,
+  0x1e2ad918UL,0x2b96ab03UL,0x0def9736UL,0x1a144c80UL,0x34b76f06UL,0x431ef878UL,
+  0x3a0b8c78UL,0xc7a97ecdUL,0xf1973ee5UL,0x63ffe916UL,0x1108363fUL,0x2deb9f0fUL,
+  0xf8ade3caUL,0xe14d4b34UL,0xd7cbc278UL,0xc698fa51UL,0x51954179UL,0x1845cf29UL,
+  0x398da17aUL,0xf338badfUL,0x4ec921ecUL,0x2f55df16UL,0x42a78ba0UL,0x595168cdUL,
+  0x09e3992aUL,0x009e383dUL,0x686f26daUL,0x31429d8bUL,0xb51cfaa1UL,0xfc4ed5c6UL,
+  0x25a5ff8cUL,0xcfee0563UL,0x6ca68b47UL,0x18bd6130UL,0x9d1e4955UL,0x7ced4a85UL,
+  0x9b94c454UL,0x8665d2fcUL,0xaaae66d9UL,0x0dd9948eUL,0x08890de6UL,0x42986222UL,
+  0x611ff747UL,0xe906805bUL,0x74f5ec28UL,0xc75dfc11UL,0x33570e72UL,0x68107a3eUL,
+  0xfcdaeaffUL,0x43d3400dUL,0xf35cafa0UL,0xfeaac0caUL,0x998f1af4UL,0xa018b991UL,
+  0x154205f1UL,0xa8202e98UL,0x0a6050cbUL,0xded52d78UL,0x0ec8f304UL,0x8ea931c1UL,
+  0xd726d677UL,0xe840ce22UL,0xb88a2f3bUL,0x13d5ec15UL,0x12b1fc40UL,0x8f189d77UL,
+  0xcedeeb92UL,0x6e648d73UL,0x6f1ac6f5UL,0xd9f94291UL,0x4f891f88UL,0x79fa57a8UL,
+  0xe3fc46aeUL,0x3a8629a5UL,0x96b54e3cUL,0x65b6dc86UL,0x47941632UL,0x6f8211deUL,
+  0xfaee765eUL,0xf7477dcaUL,0x1aa9650eUL,0x88cc8081UL,0x5d103cf8UL,0x7a98e55eUL,
+  0x4b816a4bUL,0xf5ce323aUL,0x4271ed1dUL,0x33c7c9abUL,0xb881ccc9UL,0x420379aaUL,
+  0xf13e0206UL,0x72e9bf8dUL,0x477e6ceaUL,0x99136d04UL,0x4c97eebfUL,0x0456f90dUL,
+  0x67fc4a38UL,0x145b9215UL,0x44241fb3UL,0x43c21e3cUL,0xea5052d8UL,0xc39c464aUL,
+  0x3675c0daUL,0xf657c86dUL,0x62258f46UL,0x367ec40cUL,0x290e0154UL,0x7c20adf9UL,
+  0x7c301a7fUL,0x6a5a0223UL,0x06393fd5UL,0xc8fde6d4UL,0x1d82ffb8UL,0x49527440UL,
+  0x146193d4UL,0x75b91869UL,0xc1bcc2b2UL,0x89e8dcbcUL,0x29e5430dUL,0x12ea6459UL,
+  0x6ee56a3fUL,0xc2bfaac6UL,0x826f50bfUL,0x7b452564UL,0x852c6898UL,0x11f0eb4aUL,
+  0x467a1831UL,0x2203f8d5UL,0x408799a5UL,0xc6ae78d8UL,0xdeb25ab0UL,0x8d454e3bUL,
+  0x64a9fd10UL,0x64b1c6f6UL,0x345fba30UL,0x2aa60e47UL,0xcbb50aa6UL,0x1ea87670UL,
+  0x5c44296cUL,0x543e9cdeUL,0x35a53eddUL,0x46b123c1UL,0x9dc1dd8eUL,0x622e3bdbUL,
+  0x52221a4cUL,0xed08191cUL,0x2cf8178aUL,0xdedd0819UL,0x158d30f9UL,0x60f37aedUL,
+  0xe6d8b68fUL,0xa430d93cUL,0xaba42a9bUL,0x78db3405UL,0x3b2aaea4UL,0x920f1eb9UL,
+  0x2abe57d0UL,0x72b66cd1UL,0x3727d6e9UL,0x5f8c319aUL,0x21bb6a8dUL,0xaba71c50UL,
+  0x80e7e770UL,0x591496edUL,0xd448e417UL,0xa4572108UL,0xbc03ac8aUL,0xb6674e79UL,
+  0x92b8ef31UL,0xed193322UL,0xb3c0287bUL,0x0ac87124UL,0xe9b74c18UL,0xe3397b94UL,
+  0xfbf05c22UL,0xf48a6a18UL,0xbcf988b5UL,0x8e95acd3UL,0x8132e64aUL,0x46e2c872UL,
+  0x28deda24UL,0xa8b0f016UL,0xcb6a3461UL,0x4cf0c842UL,0x486257e7UL,0x28fcb8c0UL,
+  0xd911c75cUL,0xd2cf552fUL,0x3019ef79UL,0x8940fa64UL,0x02fd4b25UL,0x2f9c2d21UL,
+  0x05185834UL,0x8a52d075UL,0xbf05ff9eUL,0xd7b3967fUL,0xb62bf05bUL,0xc0fb1418UL,
+  0xb375f1f1UL,0xd9874942UL,0xa087ce01UL,0x45bdc27dUL,0x2a454a18UL,0x254b9f2fUL,
+  0xd4358adbUL,0xe431ae7bUL,0x6eb82d54UL,0x75f3284fUL,0xa134b78cUL,0x9de2e3c2UL,
+  0xbbd085ebUL,0xdae08313UL,0xc7729a26UL,0x5c4779fcUL,0xa8254a65UL,0xa3224818UL,
+  0x69c2c09fUL,0x3de8414eUL,0xa083e667UL,0xcf828ba8UL,0x193af671UL,0xa75068feUL,
+  0x2d9f9d97UL,0xf92f5ea5UL,0x808a81c4UL,0xa82a8204UL,0x44917a84UL,0x66a60144UL,
+  0xfe425ae5UL,0x8c38a033UL,0x652cfda6UL,0x1d17c433UL,0x7a52fb02UL,0x542b9da6UL,
+  0x0af039a1UL,0xa7789169UL,0x3cf751daUL,0x6399a24dUL,0x3f37aab6UL,0x31a1f39cUL,
+  0x05972770UL,0x705d3812UL,0xaea15df2UL,0x78d97263UL,0xc3d42e87UL,0x1b780bd1UL,
+  0xbce2f793UL,0xde6e3e5bUL,0xb3dcb0e3UL,0xef3479d7UL,0x87a4060bUL,0x56b410f0UL,
+  0xdc6ca362UL,0x5d3aa6c7UL,0xffe5b408UL,0x3167a938UL,0x1a614e73UL,0x40319e39UL,
+  0x73ed5c2aUL,0x7da2e800UL,0x077fb8e7UL,0x8c5985adUL,0x68dec632UL,0xe5733b71UL,
+  0xa8690d51UL,0x9b128692UL,0xf6aa06e7UL,0x31f17704UL,0x9f1e59caUL,0x2192d618UL,
+  0xeb33693eUL,0x88c4f226UL,0x8970450bUL,0x849044e0UL,0x80c2cc14UL,0xf99cde4eUL,
+  0xaece56e8UL,0x3dee1c28UL,0x19a0fd06UL,0x4f3ece7bUL,0x7e4cc9edUL,0x37804cc7UL,
+  0x46670ab3UL,0x1f608203UL,0x11e18285UL,0xacc402bcUL,0x79a5bc59UL,0x49a6f2c9UL,
+  0xcfc1a33aUL,0xf180d94cUL,0xa129ee57UL,0x7977a279UL,0xb42d91ecUL,0x37a1b77fUL,
+  0xdcc25d94UL,0xf9a4e827UL,0xae7f6f23UL,0xe316607dUL,0x61d495cbUL,0x88e0360cUL,
+  0xa0ce2425UL,0xc99a67c6UL,0x4ee18db8UL,0x9c1b1540UL,0xfc6fdbaeUL,0x7638bce8UL,
+  0x1273836fUL,0xce606c40UL,0x2a82c598UL,0x5e668292UL,0xa7f2cac8UL,0x3af9c166UL,
+  0x4fc740d9UL,0x9a87c8e8UL,0xddd88074UL,0x0d477a3fUL,0xff33407fUL,0xb5497364UL,
+  0xa2a39e99UL,0xbb60957aUL,0x1fd888d0UL,0xda2abe0cUL,0xed8aa31aUL,0xffab8cd6UL,
+  0xc53ff8c6UL,0x42bf188fUL,0x4f041e15UL,0x5d7027b1UL,0xe1d545f7UL,0xf3f856bfUL,
+  0xf083a1acUL,0x06c4ca7fUL,0xf83aca0bUL,0xe81cdb62UL,0x7ffb0b3bUL,0x095c48e1UL,
+  0xf5d0e549UL,0x50f100a8UL,0xf4a29b09UL,0x60e3e74aUL,0xbaa69a5aUL,0x3a7216c0UL,
+  0xa70a3b7bUL,0x92791d2fUL,0x2d47a842UL,0xbb80147dUL,0x0f1e53f7UL,0xb34c7301UL,
+  0xe24c3732UL,0x1c5723ceUL,0x6ac9408fUL,0x87e1fba6UL,0x25c0b652UL,0x2a33e8afUL,
+  0x85781802UL,0x22ed341cUL,0x0221735dUL,0x195b91e4UL,0x8933ac66UL,0x74c2d4a2UL,
+  0x99f46483UL,0x54835f6bUL,0x43907567UL,0x2e9e1de4UL,0x22a19c11UL,0x43a43ad8UL,
+  0x60bff340UL,0x192d65b7UL,0x27ee5692UL,0xa7886a76UL,0x92ac6e3fUL,0x95a1041aUL,
+  0x53c0084fUL,0xdf0942d5UL,0x80c95312UL,0xa81545a1UL,0x77d0efa2UL,0xcfd0c1dbUL,
+  0x2a45c0b5UL,0x01b1cd41UL,0x68536bb6UL,0xd4472f14UL,0x7585074bUL,0x036639d4UL,
+  0x1071bdedUL,0x75286172UL,0x9a2b5fe9UL,0xbb2e33e3UL,0x1f90ed8cUL,0x0ae60a9cUL,
+  0xcb89e073UL,0x7f05719eUL,0x9d86cb19UL,0x63cb584eUL,0x3511fca5UL,0x79ed6e24UL,
+  0x5fc31557UL,0xf4108e16UL,0x5cdd04a2UL,0xf790409cUL,0xaada91c9UL,0x43d10951UL,
+  0xd9c88af5UL,0xf8bce416UL,0xc7bbb110UL,0x4423e906UL,0x10dfb8ffUL,0xc6565950UL,
+  0x25023100UL,0x042dd9d6UL,0x23bd0b7bUL,0xe5bc37f1UL,0x51ee2326UL,0x5baecf25UL,
+  0x51807a5fUL,0xdd5afec8UL,0x8c8eac9dUL,0x5af3df3dUL,0x9e19a854UL,0x9de9758cUL,
+  0x7acf9765UL,0x4a0d122dUL,0xc4d777a3UL,0x971c4aebUL,0xfb446b1dUL,0xbbb59fe2UL,
+  0x8a9031a8UL,0x6e042288UL,0xdc89c5beUL,0x66861c9aUL,0xd4adbd9fUL,0xa9b4a04bUL,
+  0xacdac22cUL,0x4bc5c8c8UL,0x0cdd516dUL,0x5661ab5cUL,0x60c988f8UL,0xa5bc6ac4UL,
+  0x06a4ff15UL,0x36a74072UL,0x6b079df1UL,0x638a3b1dUL,0x40ddfc5eUL,0xe9ae6953UL,
+  0xeb4a3226UL,0x62ef878cUL,0xf4ec8b82UL,0x978146fcUL,0x161a9e7eUL,0x574bce59UL,
+  0x2db06e4eUL,0x940a3224UL,0x0add6a43UL,0x15d0840eUL,0xc2281f7aUL,0x2afb55f6UL,
+  0xf5758243UL,0x025aaf47UL,0xabb15228UL,0x3b8e78f2UL,0x9895c185UL,0x4c4441d5UL,
+  0xcf62bc08UL,0xa33f28acUL,0xecedce1eUL,0x40b0aa49UL,0x4b4143f5UL,0x3c3c952dUL,
+  0x8c4137d2UL,0x2f7d9a00UL,0x808d0761UL,0x00e50832UL,0xa742e7b0UL,0x1490981eUL,
+  0x44590086UL,0x97513899UL,0xc9bb98d0UL,0xe0146044UL,0xe97af148UL,0x6c111d8aUL,
+  0x4a55a586UL,0xf5000d28UL,0x3ab14057UL,0xa400583cUL,0x1298cc68UL,0xd17e1200UL,
+  0xfa3d0b80UL,0x817a10e0UL,0x8a294c92UL,0x4e28a5f9UL,0xb045a5a1UL,0x4459d2a9UL,
+  0xb428090cUL,0x0a848178UL,0x108e1803UL,0xaa94483aUL,0x86e84888UL,0x1043ea94UL,
+  0x2c8a49abUL,0x0462bbd4UL,0xab9a4b87UL,0x0e45c0d0UL,0xd03402a1UL,0x4a288038UL,
+  0x30100c44UL,0xca81f936UL,0x0068f8d9UL,0x901182c0UL,0x4058c849UL,0xc70c2808UL,
+  0xdba90de1UL,0x8052c247UL,0x3a142148UL,0x540301a0UL,0x10198084UL,0x8c0881daUL,
+  0xe085e2d0UL,0x1b10001eUL,0x1800800eUL,0x89040000UL,0x01891913UL,0x241a4541UL,
+  0x82b37021UL,0x04100001UL,0xb4140000UL,0xd08880c8UL,0x90002074UL,0x48320580UL,
+  0x00088058UL,0xa9d14408UL,0x16038118UL,0x2140020cUL,0xa0a03562UL,0x80000041UL,
+  0x8a111028UL,0x45888c00UL,0x081440a0UL,0x0e8a1010UL,0x00080884UL,0x08891002UL,
+  0x05400111UL,0x22011208UL,0x40888030UL,0x20000000UL,0x48841500UL,0x04508800UL,
+  0x00800028UL,0x04488011UL,0x02010808UL,0x10a84140UL,0x80560201UL,0x22200002UL,
+  0x0000a800UL,0x00000002UL,0x040a0050UL,0x20050080UL,0x00000000UL,0x01000a00UL,
+  0x00000008UL,0x11008004UL,0x00004020UL,0x00220000UL,0x00100080UL,0x00000000UL,
+  0x00000004UL,0x00000000UL,0x00000000UL,0x08000000UL,0x40000000UL,0x00100000UL,
+  0x00000002UL,0x00002000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,0x00000000UL,
+  0x00000001UL
+};
+
+#endif
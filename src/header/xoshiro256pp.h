@@ -0,0 +1,63 @@
+/*******************************************************************************
+* xoshiro256pp.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __XOSHIRO256PP_H__
+#define __XOSHIRO256PP_H__
+
+#include "prand.h"
+#include "prand_xoshiro256pp_inline.h"
+
+/*============================================================================*\
+                Definitions of the xoshiro256++ state transition
+\*============================================================================*/
+
+#define XOSHIRO256PP_DEG        256     /* degree of the characteristic poly */
+#define XOSHIRO256PP_NWORD      8       /* 32-bit words of the polynomials */
+
+
+/*============================================================================*\
+                            Initialisation function
+\*============================================================================*/
+
+/******************************************************************************
+Function `xoshiro256pp_init`:
+  Initialisation of the xoshiro256++ generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *xoshiro256pp_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err);
+
+#endif
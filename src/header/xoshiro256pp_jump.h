@@ -0,0 +1,205 @@
+/*******************************************************************************
+* xoshiro256pp_jump.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __XOSHIRO256PP_JUMP_H__
+#define __XOSHIRO256PP_JUMP_H__
+
+#include <stdint.h>
+
+/*============================================================================*\
+                   Pre-computed polynomials for jumping ahead
+\*============================================================================*/
+
+/*******************************************************************************
+  ref: https://doi.org/10.1007/978-3-540-85912-3_26
+
+  The polynomials for skip length (g * 8^i) are computed:
+      p = t^(g * 8^i) mod phi
+  with g from 1 to 7, and i from 0 to (XOSHIRO256PP_MAX_STEP_B8 - 1), where
+  phi is the characteristic polynomial of the xoshiro256 state transition,
+  of degree 256. The coefficients are stored from the lowest order, with
+  32-bit words.
+
+*******************************************************************************/
+
+#define XOSHIRO256PP_MAX_STEP_B8        21      /* max skip length in log8 */
+#define XOSHIRO256PP_MAX_STEP   0x7fffffffffffffffULL   /* max skip length */
+
+const uint32_t xoshiro256pp_poly[XOSHIRO256PP_MAX_STEP_B8][7][8] = {
+{  {0x2UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x4UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x8UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x10UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x20UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x40UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x80UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL}  },
+{  {0x100UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x10000UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x1000000UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x1UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x100UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x10000UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x1000000UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL}  },
+{  {0x0UL,0x0UL,0x1UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x0UL,0x0UL,0x0UL,0x1UL,0x0UL,0x0UL,0x0UL},
+  {0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x0UL,0x1UL,0x0UL},
+  {0xb0f0f001UL,0x9d116f2bUL,0xcefd1a5eUL,0x280002bUL,0x26259f85UL,0x4b4edcfUL,0x3f3ecb19UL,0x3c03cUL},
+  {0xda224298UL,0xd1e3ca82UL,0xff10da08UL,0x8ddf01dcUL,0x66abab3aUL,0x2c19d64bUL,0x3c8006ebUL,0x132b59d3UL},
+  {0x585199e1UL,0xd44069b0UL,0x2522d514UL,0xdb783282UL,0x37479c68UL,0x233bd406UL,0x89370dd1UL,0xaa131648UL},
+  {0x9c5a6b7UL,0x8f74984UL,0xca769170UL,0x84933cbfUL,0xb12a101UL,0x16fc5bafUL,0x1f222ed2UL,0x93a8df01UL}  },
+{  {0xe34b489UL,0xc7327d13UL,0xa4ef7d84UL,0x81f675e7UL,0x6055c9daUL,0x6dd49b65UL,0x2e930435UL,0xbe797637UL},
+  {0xbe4ff028UL,0x60106bbUL,0x54ddda93UL,0x1be1d768UL,0x6230d984UL,0x8456faebUL,0xcf43f0e2UL,0x65507439UL},
+  {0x79c58914UL,0x2f121b2bUL,0xe89ab189UL,0xdca1a0f9UL,0x79a6dd3fUL,0xdd3ee70UL,0x1466c19fUL,0xbaaf4786UL},
+  {0x125a85c0UL,0x876c2301UL,0x28b16f04UL,0x15fe8226UL,0xc9a74fa7UL,0x3c8ca36eUL,0x819e01ffUL,0x51edef31UL},
+  {0xf9282570UL,0x1ec5f22cUL,0xf9692623UL,0x7a35edaeUL,0xb14b622bUL,0x73a4cf99UL,0xf25cb0beUL,0x93b8c505UL},
+  {0xdd4cd00aUL,0x195f824bUL,0xba5f7a35UL,0xb162081eUL,0x4eafdb96UL,0x9fead7e4UL,0x607b74a9UL,0x3611b9c8UL},
+  {0x588e1172UL,0xc1c3da7fUL,0xc36c9e18UL,0xb0478674UL,0xbd5bcaaUL,0xac2c9fc0UL,0xd42480d0UL,0xb33bbb70UL}  },
+{  {0x7e228b85UL,0xd7f4e8daUL,0xc5bcf595UL,0xd638d47eUL,0xcbf9ce10UL,0xaa6eb691UL,0x698fad39UL,0xf41cce3UL},
+  {0x73880674UL,0x669da123UL,0x4a6f1548UL,0xb1df898aUL,0xfe2534d3UL,0x32104b94UL,0x52b341d1UL,0xda66e09eUL},
+  {0x14ab14d4UL,0x2f8694c4UL,0x30906447UL,0xb9aa0df9UL,0xb0472623UL,0x8d238798UL,0xcd5cad87UL,0x47038a0bUL},
+  {0x5e780231UL,0x4f20eb91UL,0x9b885248UL,0x3886af21UL,0x3f717fceUL,0x23ecbeeUL,0x5bef249cUL,0x3cec2c37UL},
+  {0x405806d1UL,0x16cdc7c2UL,0xddf96c76UL,0xe327175dUL,0xa1bca727UL,0x2708019UL,0x1a0ece4bUL,0x8e0ee0a8UL},
+  {0x95982aaaUL,0x95c3c962UL,0xaf4a3e60UL,0x48c424ddUL,0x89525844UL,0xdd2fc0e0UL,0x5b509fcUL,0xb80482abUL},
+  {0x5f2ab37bUL,0x39b2c0adUL,0x20127ba4UL,0xa63f750dUL,0x5df5f6ceUL,0xd40755caUL,0xce51ff62UL,0xde5205cUL}  },
+{  {0x93888c8cUL,0x449b3ae7UL,0x1f077568UL,0xc3ce2f06UL,0xd837e54UL,0xa69393acUL,0x4ae47603UL,0x1a9dcf94UL},
+  {0xa2fbf2c7UL,0x7e89ac5cUL,0x70c0bf6bUL,0x92ae7ca3UL,0x6f02fb8UL,0xef43beaaUL,0x30817a21UL,0xd87f8ce2UL},
+  {0x2294bbc9UL,0xf534a080UL,0xe835d27UL,0x6869ee4aUL,0xbc8d2c3aUL,0xa77c71cUL,0x4eb1eee7UL,0x55aca192UL},
+  {0x8e29df8aUL,0x6c4adbe1UL,0x697d477fUL,0x54adade3UL,0x9cdba61fUL,0xf0c16864UL,0x96368bbbUL,0xbd530276UL},
+  {0xb84e562fUL,0x2140963eUL,0x421b891dUL,0xc1c251f9UL,0xdfc3015aUL,0x3db7816aUL,0x654c7172UL,0xc9187558UL},
+  {0x53408121UL,0xd3656796UL,0xddd5e08bUL,0xbb4b7592UL,0x1c88d2dfUL,0x9ddc26a7UL,0xddd3c1a7UL,0x21e7eefcUL},
+  {0x5edc5a43UL,0x52bb5d01UL,0xbb5a006fUL,0xfac9ef2dUL,0x9bbcedccUL,0x5356731aUL,0x598337eUL,0x51d4d8e3UL}  },
+{  {0xf40e36b8UL,0x1a673fecUL,0xb5ed002bUL,0xf2c602feUL,0x67452594UL,0x1ea49b50UL,0xd882cd37UL,0xf78a97c0UL},
+  {0x56224c47UL,0xef4606daUL,0xb8d437bdUL,0x770323eaUL,0x2ec52531UL,0x590923d0UL,0x968e3c5UL,0x1639a36eUL},
+  {0x4baa3224UL,0x534d7ebeUL,0xe7db7702UL,0x1a0029d1UL,0x1cf61babUL,0xe911f251UL,0x30031301UL,0xc9c82973UL},
+  {0x5d95f3cdUL,0x31d9d05cUL,0x17a3ce0fUL,0x7cde2418UL,0x4a74c76aUL,0x2f679f69UL,0xd298a415UL,0x8b3919a9UL},
+  {0x7e9d9f3bUL,0xa7060f77UL,0x33196b14UL,0xc7d963aeUL,0x95e7e78fUL,0x2f206954UL,0x2751a50aUL,0xa9bc8444UL},
+  {0xfa5660f6UL,0x256a18a1UL,0x52f6b88cUL,0xddd65fb3UL,0x54044eebUL,0xc6f6cccaUL,0xbc7a294aUL,0x9af86f16UL},
+  {0xd0852963UL,0xe47a1450UL,0xfacd9bd4UL,0xfbc7f247UL,0x4cd9f60bUL,0xd1c2beedUL,0x7df8a698UL,0x1754d10aUL}  },
+{  {0x9590047aUL,0x6b6622aeUL,0x40b79fefUL,0xeace6d38UL,0xfd70ec83UL,0xd9b36372UL,0x3c322e71UL,0x624eb7b6UL},
+  {0xa98d9e23UL,0x1b91fd9bUL,0xd3c33d2eUL,0xeb2c7e29UL,0xf4e9aff4UL,0xcebbfd2eUL,0xc9469796UL,0x2bac5517UL},
+  {0xa5f05020UL,0x601411a5UL,0x9d75edfaUL,0x1580b2e3UL,0xbb891b67UL,0x722ddbd8UL,0xb763ce08UL,0x5231923UL},
+  {0x83fe109UL,0x1f356e6UL,0x62a3a28aUL,0xba0ffb65UL,0x6317866bUL,0x657a6b73UL,0xe5dac186UL,0xfb678bd3UL},
+  {0x4671b344UL,0xe4af3802UL,0xfba0813UL,0xe55775deUL,0xa0b6a4c0UL,0x26e7de52UL,0x9f2388b8UL,0xf3602807UL},
+  {0xd1645d99UL,0x9247e371UL,0x1342e9c9UL,0xa6ec86e0UL,0x9bebe5c3UL,0x8e97a595UL,0x9ab8073fUL,0x448cd689UL},
+  {0x51d5758dUL,0x5c0ccd67UL,0x365c0873UL,0x61344c60UL,0xb6f710b3UL,0xdce08f8cUL,0x1d4bf907UL,0xeb3d1ba8UL}  },
+{  {0xf197a7e8UL,0xc5461100UL,0x426b676dUL,0xe46916a1UL,0x4fe25d26UL,0xf3469dbbUL,0x9e83bc3fUL,0xf5c01005UL},
+  {0xb8c259dcUL,0x22dc028cUL,0x495ce5aaUL,0x3eec4eb6UL,0xdc7b84dcUL,0x5de3e273UL,0x207f6afdUL,0xe677849eUL},
+  {0x27cfd9ceUL,0x77116fdeUL,0x3d9ce737UL,0x283acedfUL,0xd75f8e04UL,0x45eb72acUL,0x9328ca4fUL,0x412f4c89UL},
+  {0xfd3b0fUL,0x832d4189UL,0xb7c36788UL,0x114e10c3UL,0x78d9c8dcUL,0xdf2332a7UL,0xceb7522cUL,0xd19a1bdUL},
+  {0x3151547bUL,0x1028ba06UL,0x34517da4UL,0xe2aafb8cUL,0x87a6476dUL,0x106bb3cfUL,0x3aa6b902UL,0x106850cdUL},
+  {0xff2055f8UL,0xd08eefe4UL,0x2bf88b40UL,0xc64d4dbcUL,0x685fa1a9UL,0x2621431eUL,0x2f4f951eUL,0xd7d82ef6UL},
+  {0xfc6f53adUL,0x1970bcbbUL,0xe7e3271eUL,0x317f67c8UL,0xb2b5ea32UL,0xbc079ce8UL,0x8d0eaafaUL,0x59d35afUL}  },
+{  {0xe8d7157UL,0xe2d0c9c1UL,0x7e947e38UL,0x8b3ed7c3UL,0x18ad073eUL,0x98273f4dUL,0xd5f4f2aUL,0xf38f7e75UL},
+  {0xf3510d70UL,0xe7109518UL,0xeadb90b9UL,0x34f30137UL,0x6d56754dUL,0x6d48dd20UL,0x5fea15c3UL,0xafa9e3feUL},
+  {0x2c7c6b42UL,0xbfc8d76cUL,0x53e188ddUL,0x5d7d204UL,0x36b4a6d5UL,0x255a90fdUL,0x8e83a855UL,0xfc6eb7d3UL},
+  {0x7ec9f39UL,0x8ee774f5UL,0x51ecf6c4UL,0xd7c26ebdUL,0x998ddc4cUL,0xc76a456dUL,0x511bcb05UL,0x1ca234ffUL},
+  {0x33e5b5cdUL,0xcefd16b3UL,0xe08e1568UL,0x6c4e6999UL,0x6aae939fUL,0x37573347UL,0x6b8931eaUL,0xd1d1b373UL},
+  {0x465824dcUL,0x82684628UL,0xeaad3f6cUL,0x663da7d8UL,0xa8073986UL,0x62839d89UL,0x946a4f47UL,0xc0074be1UL},
+  {0x44d99a62UL,0x831170a8UL,0xdb5b7d50UL,0xd07d306eUL,0x1987a076UL,0xc61dcdc8UL,0x5c5957beUL,0x9517b67cUL}  },
+{  {0x1158a7bcUL,0x4905d826UL,0x2137de83UL,0x352f8b5dUL,0x5826626dUL,0xe0e9fa34UL,0xcaa54d16UL,0x3e667662UL},
+  {0x4bac7912UL,0x272a32beUL,0x6bb38173UL,0xe1185a16UL,0x8fe2ed58UL,0x82b9aa35UL,0x8704d536UL,0xa43d3746UL},
+  {0x4e06235fUL,0x497c4d3bUL,0xd70b806UL,0xda0cbc7cUL,0xaeff71eUL,0x7af9683aUL,0x315d3c2eUL,0x6eb26285UL},
+  {0x3c112f69UL,0x58120d58UL,0xbd08e6acUL,0x7d8d0632UL,0xfbdbc208UL,0x214fafc0UL,0x20fdb9d7UL,0xe055d35UL},
+  {0xe58336e0UL,0x4fdb893UL,0xc17ee506UL,0x4c92c966UL,0x5a1f8204UL,0xd137efc5UL,0xd40ec8e9UL,0xdb49e516UL},
+  {0x1cef4c5dUL,0x6624a797UL,0xb3bdfc16UL,0xef4722daUL,0x9db68af7UL,0x79a061a9UL,0xa15aa9dbUL,0x7b8ae9c0UL},
+  {0xb03f2a11UL,0x9ef98d79UL,0x8b7b0fd7UL,0x3a1eaf0cUL,0x4c096861UL,0xadfaf1dcUL,0xf7627593UL,0x1ccef754UL}  },
+{  {0x5a9ebb7dUL,0xd9eb3e22UL,0x77777716UL,0x5d33a221UL,0xcf857b42UL,0xffed2ffbUL,0x81a90f09UL,0xa1b7ebf5UL},
+  {0xff8501f4UL,0x3a433a5cUL,0xa3a44f3bUL,0xc2e65cfUL,0x33f1c8f4UL,0xa59f09abUL,0x9a7881b0UL,0xafe9730UL},
+  {0x53b9ff9aUL,0x92a8fc05UL,0x2a9ff428UL,0x5e104f15UL,0x3ec974bfUL,0x50ba396fUL,0xccab833dUL,0x8650f6dfUL},
+  {0x82ce5c6aUL,0x635e9c68UL,0x808ef457UL,0x53a34398UL,0x142a68bdUL,0x94295f82UL,0xa717c897UL,0xc1cdf918UL},
+  {0x9dc66855UL,0x3222f016UL,0x6ee0d8feUL,0x11a9d477UL,0xa6182155UL,0x37bf2668UL,0x545c17faUL,0x736294f3UL},
+  {0xbd58cc86UL,0x8f7c65f8UL,0x3b3d6e35UL,0xb93d4ee7UL,0xecc89cd6UL,0xb22dd9c8UL,0xd6f77fa3UL,0x22e59c89UL},
+  {0x2cbe2ac4UL,0xf0161fc5UL,0x4507b499UL,0xf477b11cUL,0x75aa7fd6UL,0xd2c307dcUL,0x311c288fUL,0x31451a22UL}  },
+{  {0xf78e2ed4UL,0x1a2c804aUL,0x1040af1eUL,0x306c4d37UL,0x102dfa7eUL,0x63d3f9dfUL,0x6aecd6c8UL,0xac7fe080UL},
+  {0xe17a5e9bUL,0x7743a154UL,0x9453899bUL,0x7823a1cdUL,0xfbb1c7f5UL,0x976589eeUL,0x260fa29eUL,0x702cf168UL},
+  {0xf2f7efdUL,0xa59756ebUL,0xb8fea03cUL,0x68d48d7aUL,0x95d0ac25UL,0xf450abaeUL,0x1f60ffb8UL,0x5cb1a376UL},
+  {0x667bf3fUL,0x2edfce1bUL,0xf2d9c5b2UL,0x68ef5242UL,0x9ea7d7e8UL,0x3803bdbUL,0x1b902baeUL,0xc4671ec9UL},
+  {0x9cd6f628UL,0x4e9b2c23UL,0x5645c400UL,0x3ff52b60UL,0x18c05280UL,0xcb2d189cUL,0x580bdf8cUL,0xae8158ffUL},
+  {0x6ec3564bUL,0x8bdc6729UL,0xbcbb50b2UL,0x896d019dUL,0xde38110dUL,0x23da244dUL,0xaed75b08UL,0xe8a987b7UL},
+  {0x702322aUL,0x840fac0fUL,0x419dfd9bUL,0xae910590UL,0xbdc2b3e2UL,0x4bb0d8b1UL,0x284a1964UL,0xe82bd5e0UL}  },
+{  {0xb0f7980fUL,0x4d2c07a0UL,0xfcff185UL,0xaf3e614UL,0xea7109fdUL,0xaf03bea7UL,0x31d1e7c9UL,0x755b16e2UL},
+  {0x16542ea0UL,0xd24b31abUL,0x6460a3b0UL,0x13a31dc3UL,0x5df18361UL,0xeece73d8UL,0xb1974e73UL,0x51fc9b8eUL},
+  {0xa41c3cdbUL,0xfab3c12cUL,0x11895c81UL,0xcc33c8b4UL,0xf1a5da87UL,0xb9901741UL,0xa6f7efcbUL,0x2a716827UL},
+  {0xd62a4a91UL,0xec9c79ebUL,0x22d660aaUL,0xa374bf98UL,0x23fdecb5UL,0xde49d57fUL,0x4658ae1bUL,0xfb43cf1fUL},
+  {0x55c0079eUL,0xb0c8be73UL,0xb4d23ea1UL,0xe9375647UL,0xb1dd672dUL,0x39ae4031UL,0x4453e7efUL,0x926f937dUL},
+  {0xf4e3a697UL,0xc1ee1d04UL,0xdb40bf63UL,0x21bbff8bUL,0x37ec9f03UL,0x664468ceUL,0x23454db2UL,0x50005c93UL},
+  {0xf7ed5b6fUL,0xdcb7c482UL,0xbdc6a7fbUL,0xd3813326UL,0x26f2b68fUL,0x404bb7afUL,0x898eddb5UL,0x1e802e56UL}  },
+{  {0x37bf1c08UL,0x7602414aUL,0xf008a91UL,0x48b8b057UL,0x68a9c562UL,0x3aa3d493UL,0x7d00f97UL,0x9b48db89UL},
+  {0x4f972355UL,0xf7569be7UL,0xfcced20eUL,0x9e11e129UL,0xec2d6d85UL,0xa6994477UL,0x27957370UL,0x8ec1a9ddUL},
+  {0x463a1f76UL,0x18ac017dUL,0xfdbada7dUL,0xaead7f89UL,0xf20aa070UL,0xf78184c2UL,0xd930ed0cUL,0x14ef8698UL},
+  {0xd6e8a0UL,0xc2239432UL,0xebd9baffUL,0x82f1f8d3UL,0xeb4f76dbUL,0xf6c987b8UL,0xe4521854UL,0xba8b1a7bUL},
+  {0xf0390710UL,0xe6fd6294UL,0xf5e48b5bUL,0x9abc4688UL,0x902f5ad2UL,0x3f93d4c6UL,0x8248fc67UL,0x184a09c3UL},
+  {0xe2cca62dUL,0x3634821cUL,0xf82aff92UL,0x83767924UL,0x942f6b36UL,0xdb13e092UL,0xbd4ecde8UL,0x487539bbUL},
+  {0xbe639292UL,0x751fce4aUL,0xf75b0d19UL,0x9fa65db2UL,0x3e0ec525UL,0xb6660547UL,0xa3220541UL,0xcb7a3d27UL}  },
+{  {0x9e7f9d4fUL,0xe226bff9UL,0x92dc08c7UL,0xf6faaff5UL,0x7a438d37UL,0xbad2e348UL,0xd772d2d2UL,0xa8f7de3eUL},
+  {0x362137f1UL,0x6322f95dUL,0x69247fbdUL,0xb0062414UL,0x9bfc7e7bUL,0x181d6c74UL,0x5954e65eUL,0x3c63f6f9UL},
+  {0x259f6c20UL,0x6c889a1bUL,0xc9840770UL,0x3560ee89UL,0x3157296eUL,0x97668bcdUL,0xb6c5b77cUL,0xc1845ce6UL},
+  {0x402dab5fUL,0xaa878816UL,0xf33b48faUL,0x69811136UL,0xf12f17f4UL,0xdf6566fUL,0x1b843692UL,0x81f45088UL},
+  {0x4b87eac1UL,0x20f4ab4eUL,0x98652102UL,0x97b71b30UL,0xf3bd448fUL,0x612f2f96UL,0xe9c95445UL,0xc444f6b2UL},
+  {0x1a5ba2f6UL,0x577d6f9dUL,0x5dc35ceeUL,0x18f88188UL,0xc5b237f1UL,0x469e0481UL,0xba3c2f38UL,0x1fc0a529UL},
+  {0xdf4befecUL,0x8dcb712bUL,0xc6e06fbaUL,0x4c76a06cUL,0xdb4224ccUL,0xabe5a268UL,0x566c5653UL,0x7a69e04bUL}  },
+{  {0xea62c7f1UL,0xf11fb4faUL,0xee5e4763UL,0xf825539dUL,0x2f705634UL,0x47457929UL,0xc97e9066UL,0x5f728be2UL},
+  {0xeac5120eUL,0xf18ac1f5UL,0x4bcb56f5UL,0x36d6c9bcUL,0x42b386beUL,0xec104b99UL,0x441a364cUL,0x5ff98760UL},
+  {0xa1b719caUL,0xd8c89f29UL,0xed227440UL,0xdf2a05fbUL,0xc1a8752eUL,0xb2467099UL,0x1c1d1047UL,0x1b285078UL},
+  {0x6ddc86afUL,0x12b82590UL,0x131ea856UL,0x168b84acUL,0x1f3cddfUL,0xd1c440c8UL,0xeb0b05f6UL,0xb01e1ff4UL},
+  {0x5222c99eUL,0x779a0bcaUL,0x119ba32dUL,0xe1ab8374UL,0x693455bbUL,0x1cfc9d1fUL,0x7e95e313UL,0x1e96220aUL},
+  {0x84de70e6UL,0x6ad04690UL,0x4991ea02UL,0xbd94f826UL,0x80caf24bUL,0x36c42975UL,0xbb2919f7UL,0xac450e83UL},
+  {0x691d3911UL,0x1526e062UL,0xa29d10dUL,0xf3768f7dUL,0xf34b5c9fUL,0x6395026UL,0xf200878eUL,0xffac9e0fUL}  },
+{  {0x59ffcbe3UL,0x5696a9edUL,0x3c3158aUL,0xb5bb35feUL,0x1577ad4eUL,0xf1ab1bceUL,0xe00ffdaaUL,0x140bd5e4UL},
+  {0xf9f0e0faUL,0x61507225UL,0xa304405fUL,0x8eadd052UL,0x6ebe9c68UL,0x49c2df73UL,0x86d5e31bUL,0x5177664eUL},
+  {0x8a4390a7UL,0x1802ff14UL,0xe2173d65UL,0x1f578f69UL,0xc51a3d6cUL,0x3d7a5f8dUL,0xd9aff627UL,0x60a2ab96UL},
+  {0xc0c1abaeUL,0x87aac36cUL,0x6e8fdf33UL,0xca120d88UL,0xce3357a7UL,0x5b8d5f58UL,0xeced9cd7UL,0xa93a7aadUL},
+  {0xe4416ccfUL,0x9a94cc46UL,0xa93a64f6UL,0x6164efcUL,0x4d20f973UL,0xb05eed14UL,0xd7026e94UL,0xb00d18a9UL},
+  {0x4cd1d9f2UL,0x3c37d909UL,0xd2830a0fUL,0x972990e6UL,0xbb4eb05dUL,0x2d41a844UL,0xec861afeUL,0xfb16c640UL},
+  {0x549bf8c2UL,0x912eee67UL,0x9567642cUL,0x4a06c032UL,0xf504a8f0UL,0x97a3fbbcUL,0xd534fbe3UL,0x54704e81UL}  },
+{  {0x4a9ac499UL,0xd4eb4706UL,0x79346af1UL,0x2b959395UL,0x423cc2f6UL,0xa6f4a2eaUL,0xd87157efUL,0xd5372758UL},
+  {0xf12aebc3UL,0x549bf83eUL,0xd6712eedUL,0x56df3905UL,0xcb3059a5UL,0xb86994c9UL,0x53e950f8UL,0x7e0b8abeUL},
+  {0x7dc52a0fUL,0xac18d023UL,0x6d191f95UL,0x9a7c3397UL,0x978f0092UL,0x5609992fUL,0x7f9c79d2UL,0xc9c55caeUL},
+  {0xe851dd9dUL,0xb32b0dbUL,0x479b95dfUL,0x27cc40c1UL,0x4a3a6d49UL,0xc405c116UL,0x3969763bUL,0x888f2c3UL},
+  {0x769c25bbUL,0xc3292a89UL,0x8d9ea42cUL,0x55c07604UL,0xf2610a44UL,0xaea034a6UL,0xd926b269UL,0xcf57245aUL},
+  {0x66f44543UL,0xa81222a9UL,0x28a15a80UL,0xc3496d0dUL,0x23d41f04UL,0xde9441c8UL,0xbb527665UL,0xbaec2d19UL},
+  {0x6276eb35UL,0x1a11becdUL,0xd35c21cUL,0x93834f60UL,0x4c33fa30UL,0xd5435b69UL,0x4008c80bUL,0xe5c60aa8UL}  },
+{  {0x72aa1155UL,0x920a67edUL,0x47cefb5eUL,0x7e5cbd20UL,0x3e87d9d3UL,0x31acd0e2UL,0xfb96f078UL,0xfecb2b39UL},
+  {0x510c4700UL,0x9841d4c5UL,0xd2cdf9acUL,0x97a6c4a0UL,0x6b9b17c0UL,0x82f88d9eUL,0x55f06741UL,0xf643cc92UL},
+  {0x49929860UL,0xcc452b4aUL,0xde534b5dUL,0x851e011fUL,0x5186ac08UL,0x2e2adad2UL,0xb87cb11dUL,0x5180f561UL},
+  {0x41c0b04fUL,0x30ac8485UL,0xb136961fUL,0x55756dedUL,0x5fe59ed1UL,0x65ba2fdfUL,0x5188af0fUL,0xe8e07ed0UL},
+  {0xe1c206bfUL,0xb1b73208UL,0x12da6e0fUL,0xe378c496UL,0x63c1dfaUL,0x8196213eUL,0xafb9885dUL,0x2508a999UL},
+  {0x35dde161UL,0x39152442UL,0x3e9fd25fUL,0x74bac4e8UL,0xbef8177cUL,0x895c958aUL,0x3dfb10dUL,0xb272664cUL},
+  {0xd7eda232UL,0x6a03e290UL,0x5318be36UL,0x8166f0fbUL,0xee92575bUL,0x3a7be962UL,0xb053771UL,0x4b81490bUL}  },
+{  {0xbb92b99UL,0xadcede28UL,0x321527a7UL,0x6d885bb5UL,0x62544db2UL,0x4ad0ecdUL,0x8f3bbdcbUL,0x679b8895UL},
+  {0x8a94ce16UL,0x84db0e33UL,0x9b106201UL,0xaaee46b8UL,0xa56d6131UL,0xbbf25302UL,0x74213644UL,0xd10d621bUL},
+  {0xf6f21547UL,0x780e9f7fUL,0x696bc03aUL,0x7c941289UL,0x912b51c4UL,0x20a3b973UL,0x6f5b6eaeUL,0x4c12f9e4UL},
+  {0x3147ca9bUL,0xed3c94e0UL,0xa2035587UL,0x31fbe8b0UL,0x93b632b7UL,0x5083dee0UL,0x2ddf72b1UL,0x6ff47767UL},
+  {0x84ceded3UL,0xe9c6363dUL,0xca9c4fd7UL,0x9786da91UL,0x565bc423UL,0x9364ff68UL,0x58711914UL,0x43c3daa2UL},
+  {0xde034024UL,0xea3795e7UL,0x5ea3d17aUL,0x938f5f45UL,0x79671024UL,0x638b7aaaUL,0x2ab40a15UL,0xd620307aUL},
+  {0xa92aa5a6UL,0x370523e8UL,0xd7beec5bUL,0xf4f35740UL,0x5511eaa6UL,0xbe71d15cUL,0x33e8cfecUL,0xa788faa3UL}  }
+};
+
+#endif
@@ -30,9 +30,16 @@
 
 #include "mrg32k3a.h"
 #include "mrg32k3a_jump.h"
+#include "prand_cache.h"
+#include "prand_state.h"
+#include "prand_stats.h"
+#include "prand_math.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /*******************************************************************************
   Implementation of the MRG32k3a random number generator.
@@ -43,21 +50,32 @@
                             Definitions of constants
 \*============================================================================*/
 
-#define m1              4294967087LL            /* 2^32 - 209 */
-#define m2              4294944443LL            /* 2^32 - 22853 */
-#define a12             1403580
-#define a13             (-810728)
-#define a21             527612
-#define a23             (-1370589)
+#define m1              MRG32K3A_M1
+#define m2              MRG32K3A_M2
+#define a12             MRG32K3A_A12
+#define a13             MRG32K3A_A13
+#define a21             MRG32K3A_A21
+#define a23             MRG32K3A_A23
 
 /* The following two numbers ensure postive p1 and p2. */
-#define add1            3482050076509336LL      /* m1 * a13 */
-#define add2            5886603609186927LL      /* m2 * a23 */
+#define add1            MRG32K3A_ADD1
+#define add2            MRG32K3A_ADD2
 
 /* Normalisation for sampling a float-point number in the range [0,1). */
-#define norm            0x1.000000d00000bp-32   /* 1 / (1 + m1) */
+#define norm            MRG32K3A_NORM
 /* Normalisation for sampling a float-point number in the range (0,1). */
-#define norm_pos        0x1.000000cf0000ap-32   /* 1 / (2 + m1) */
+#define norm_pos        MRG32K3A_NORM_POS
+/* Weight of the second number for a float-point number with 53-bit
+ * resolution. */
+#define norm53          MRG32K3A_NORM53
+
+/* Number of steps generated at one time when advancing multiple streams. */
+#define FILL_ALL_CHUNK  64
+/* Minimum number of streams for which the vectorised kernel is faster. */
+#define FILL_ALL_MIN_LANES      5
+
+/* Minimum number of streams for jumping ahead in parallel with OpenMP. */
+#define JUMP_ALL_PAR_MIN        4096
 
 
 /*============================================================================*\
@@ -74,10 +92,8 @@
                             Definition of the state
 \*============================================================================*/
 
-typedef struct {
-  int64_t s10, s11, s12;
-  int64_t s20, s21, s22;
-} mrg32k3a_state_t;
+/* The state is shared with the inline interface. */
+typedef prand_mrg32k3a_state_t mrg32k3a_state_t;
 
 
 /*============================================================================*\
@@ -109,6 +125,8 @@ static void mrg32k3a_seed(void *state, uint64_t seed) {
   stat->s21 = seed % m2;
   seed = PRAND_LCG(seed);
   stat->s22 = seed % m2;
+
+  stat->has_gauss = 0;
 }
 
 /******************************************************************************
@@ -120,23 +138,7 @@ Return:
   A pseudo-random integer.
 ******************************************************************************/
 static uint64_t mrg32k3a_get(void *state) {
-  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) state;
-
-  /* Component 1 */
-  int64_t p1 = (a12 * stat->s11 + a13 * stat->s10 + add1) % m1;
-  stat->s10 = stat->s11;
-  stat->s11 = stat->s12;
-  stat->s12 = p1;
-
-  /* Component 2 */
-  int64_t p2 = (a21 * stat->s22 + a23 * stat->s20 + add2) % m2;
-  stat->s20 = stat->s21;
-  stat->s21 = stat->s22;
-  stat->s22 = p2;
-
-  /* Combination */
-  if (p1 <= p2) return (p1 - p2 + m1);
-  else return (p1 - p2);
+  return prand_mrg32k3a_get((mrg32k3a_state_t *) state);
 }
 
 /******************************************************************************
@@ -163,6 +165,187 @@ static double mrg32k3a_get_double_pos(void *state) {
   return (mrg32k3a_get(state) + 1) * norm_pos;
 }
 
+/******************************************************************************
+Function `mrg32k3a_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive numbers u1 and u2 in the range
+  [0,1): (u1 + u2 * 2^{-24}) mod 1.
+  ref: https://doi.org/10.1287/opre.50.6.1073.358
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double mrg32k3a_get_double53(void *state) {
+  return prand_mrg32k3a_get_double53((mrg32k3a_state_t *) state);
+}
+
+/******************************************************************************
+Macro `MRG32K3A_FILL`:
+  Generate an array of numbers and update the state, with the state kept in
+  local variables throughout the loop.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `expr`:     expression for converting the integer `x` to the output.
+******************************************************************************/
+#define MRG32K3A_FILL(state, out, n, expr) {                            \
+  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) (state);                \
+  int64_t s10 = stat->s10, s11 = stat->s11, s12 = stat->s12;            \
+  int64_t s20 = stat->s20, s21 = stat->s21, s22 = stat->s22;            \
+  for (size_t i = 0; i < (n); i++) {                                    \
+    int64_t p1 = (a12 * s11 + a13 * s10 + add1) % m1;                   \
+    s10 = s11; s11 = s12; s12 = p1;                                     \
+    int64_t p2 = (a21 * s22 + a23 * s20 + add2) % m2;                   \
+    s20 = s21; s21 = s22; s22 = p2;                                     \
+    int64_t x = p1 - p2 + ((p1 <= p2) ? m1 : 0);                        \
+    (out)[i] = (expr);                                                  \
+  }                                                                     \
+  stat->s10 = s10; stat->s11 = s11; stat->s12 = s12;                    \
+  stat->s20 = s20; stat->s21 = s21; stat->s22 = s22;                    \
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill`:
+  Generate an array of integers and update the state.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated.
+******************************************************************************/
+static void mrg32k3a_fill(void *state, uint64_t *out, const size_t n) {
+  MRG32K3A_FILL(state, out, n, x);
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_double`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mrg32k3a_fill_double(void *state, double *out, const size_t n) {
+  MRG32K3A_FILL(state, out, n, x * norm);
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_double_pos`:
+  Generate an array of double-precision floating-point numbers in the
+  range (0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mrg32k3a_fill_double_pos(void *state, double *out,
+    const size_t n) {
+  MRG32K3A_FILL(state, out, n, (x + 1) * norm_pos);
+}
+
+/******************************************************************************
+Macro `MRG32K3A_FILL53`:
+  Generate an array of floating-point numbers with 53-bit resolution, with
+  the state kept in local variables throughout the loop, and two steps taken
+  for every output. The i-th number is stored as the (i * stride)-th element
+  of the output array.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array.
+******************************************************************************/
+#define MRG32K3A_FILL53(state, out, n, stride) {                        \
+  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) (state);                \
+  int64_t s10 = stat->s10, s11 = stat->s11, s12 = stat->s12;            \
+  int64_t s20 = stat->s20, s21 = stat->s21, s22 = stat->s22;            \
+  for (size_t i = 0; i < (n); i++) {                                    \
+    double u[2];                                                        \
+    for (int k = 0; k < 2; k++) {                                       \
+      int64_t p1 = (a12 * s11 + a13 * s10 + add1) % m1;                 \
+      s10 = s11; s11 = s12; s12 = p1;                                   \
+      int64_t p2 = (a21 * s22 + a23 * s20 + add2) % m2;                 \
+      s20 = s21; s21 = s22; s22 = p2;                                   \
+      u[k] = (p1 - p2 + ((p1 <= p2) ? m1 : 0)) * norm;                  \
+    }                                                                   \
+    const double v = u[0] + u[1] * norm53;                              \
+    (out)[i * (stride)] = (v < 1) ? v : v - 1;                          \
+  }                                                                     \
+  stat->s10 = s10; stat->s11 = s11; stat->s12 = s12;                    \
+  stat->s20 = s20; stat->s21 = s21; stat->s22 = s22;                    \
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_double53`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1), with 53-bit resolution. The results are identical to those of
+  calling `mrg32k3a_get_double53` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mrg32k3a_fill_double53(void *state, double *out,
+    const size_t n) {
+  MRG32K3A_FILL53(state, out, n, 1);
+}
+
+/******************************************************************************
+Function `mrg32k3a_get_gaussian`:
+  Generate a Gaussian number with zero mean and unit variance, and update the
+  state. The numbers are generated in pairs with the Box-Muller method, from
+  two floating-point numbers in the range (0,1) each, and the second number
+  of a pair is cached for the next call.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random Gaussian number.
+******************************************************************************/
+static double mrg32k3a_get_gaussian(void *state) {
+  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) state;
+  if (stat->has_gauss) {
+    stat->has_gauss = 0;
+    return stat->gauss;
+  }
+
+  double z[2];
+  z[0] = mrg32k3a_get_double_pos(state);
+  z[1] = mrg32k3a_get_double_pos(state);
+  prand_box_muller(z, 1);
+  stat->gauss = z[1];
+  stat->has_gauss = 1;
+  return z[0];
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_gaussian`:
+  Generate an array of Gaussian numbers with zero mean and unit variance, and
+  update the state. The results are identical to those of calling
+  `mrg32k3a_get_gaussian` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of Gaussian numbers to be generated.
+******************************************************************************/
+static void mrg32k3a_fill_gaussian(void *state, double *out, const size_t n) {
+  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) state;
+  size_t i = 0;
+  if (!n) return;
+  if (stat->has_gauss) {
+    out[i++] = stat->gauss;
+    stat->has_gauss = 0;
+  }
+
+  /* Generate pairs in place from the uniform numbers. */
+  const size_t npair = (n - i) >> 1;
+  mrg32k3a_fill_double_pos(state, out + i, npair << 1);
+  prand_math_kernel()->box_muller(out + i, npair);
+  i += npair << 1;
+  if (i < n) out[i] = mrg32k3a_get_gaussian(state);
+}
+
 
 /*============================================================================*\
                          Functions for multiple streams
@@ -173,37 +356,70 @@ static double mrg32k3a_get_double_pos(void *state) {
 ******************************************************************************/
 
 /******************************************************************************
-Function `matrix_dot`:
-  Inplace 3x3 matrix manipulation: C = (A * B) % m.
+  The moduli are of the form m = 2^32 - c, with small c, so the products of
+  two residues are reduced with 2^32 = c (mod m), by folding the high 32 bits
+  into the low ones, which is considerably cheaper than 64-bit divisions.
+******************************************************************************/
+
+#define c1              209             /* 2^32 - m1 */
+#define c2              22853           /* 2^32 - m2 */
+
+/******************************************************************************
+Function `mod_fold`:
+  Partial modular reduction: x = hi * 2^32 + lo = hi * c + lo (mod 2^32 - c).
 Arguments:
-  * `C`:        the output matrix, can be the same as either of the multipliers;
-  * `A`, `B`:   the multipliers;
-  * `m`:        the divisor for modular reduction.
+  * `x`:        the integer to be reduced;
+  * `c`:        the difference between 2^32 and the modulus.
+Return:
+  An integer congruent to `x`, smaller than (x >> 32) * c + 2^32.
 ******************************************************************************/
-static inline void matrix_dot(uint64_t C[9], const uint64_t A[9],
-    const uint64_t B[9], const int64_t m) {
-  uint64_t out[9];
+static inline uint64_t mod_fold(const uint64_t x, const uint64_t c) {
+  return (x >> 32) * c + (x & 0xffffffffULL);
+}
 
-  /* Perform modular reduction at all steps to prevent overflow. */
-  out[0] = ((A[0] * B[0]) % m + (A[1] * B[3]) % m + (A[2] * B[6]) % m) % m;
-  out[1] = ((A[0] * B[1]) % m + (A[1] * B[4]) % m + (A[2] * B[7]) % m) % m;
-  out[2] = ((A[0] * B[2]) % m + (A[1] * B[5]) % m + (A[2] * B[8]) % m) % m;
-  out[3] = ((A[3] * B[0]) % m + (A[4] * B[3]) % m + (A[5] * B[6]) % m) % m;
-  out[4] = ((A[3] * B[1]) % m + (A[4] * B[4]) % m + (A[5] * B[7]) % m) % m;
-  out[5] = ((A[3] * B[2]) % m + (A[4] * B[5]) % m + (A[5] * B[8]) % m) % m;
-  out[6] = ((A[6] * B[0]) % m + (A[7] * B[3]) % m + (A[8] * B[6]) % m) % m;
-  out[7] = ((A[6] * B[1]) % m + (A[7] * B[4]) % m + (A[8] * B[7]) % m) % m;
-  out[8] = ((A[6] * B[2]) % m + (A[7] * B[5]) % m + (A[8] * B[8]) % m) % m;
+/******************************************************************************
+Function `mod_dot3`:
+  Modular dot product of two vectors with 3 residues each.
+Arguments:
+  * `a0`-`a2`:  elements of the first vector;
+  * `b0`-`b2`:  elements of the second vector;
+  * `c`:        the difference between 2^32 and the modulus.
+Return:
+  (a0 * b0 + a1 * b1 + a2 * b2) % (2^32 - c).
+******************************************************************************/
+static inline uint64_t mod_dot3(const uint64_t a0, const uint64_t a1,
+    const uint64_t a2, const uint64_t b0, const uint64_t b1,
+    const uint64_t b2, const uint64_t c) {
+  /* Every folded product is below 2^48, so the sum does not overflow. */
+  uint64_t x = mod_fold(a0 * b0, c) + mod_fold(a1 * b1, c) +
+    mod_fold(a2 * b2, c);
+  x = mod_fold(x, c);           /* x < 3 * 2^32 */
+  x = mod_fold(x, c);           /* x < m + 3 * c */
+  return (x >= 0x100000000ULL - c) ? x - (0x100000000ULL - c) : x;
+}
 
-  C[0] = out[0];
-  C[1] = out[1];
-  C[2] = out[2];
-  C[3] = out[3];
-  C[4] = out[4];
-  C[5] = out[5];
-  C[6] = out[6];
-  C[7] = out[7];
-  C[8] = out[8];
+/******************************************************************************
+Function `matrix_dot2`:
+  Inplace 3x3 matrix manipulations for both components of MRG32k3a, with the
+  elements of the two products interleaved, to overlap their latencies:
+    A1 = (B1 * A1) % m1, A2 = (B2 * A2) % m2.
+Arguments:
+  * `A1`, `A2`: the multipliers, overwritten by the products;
+  * `B1`, `B2`: the other multipliers.
+******************************************************************************/
+static inline void matrix_dot2(uint64_t A1[9], const uint64_t B1[9],
+    uint64_t A2[9], const uint64_t B2[9]) {
+  uint64_t out1[9], out2[9];
+  for (int i = 0; i < 9; i += 3) {
+    for (int j = 0; j < 3; j++) {
+      out1[i+j] = mod_dot3(B1[i], B1[i+1], B1[i+2], A1[j], A1[j+3],
+          A1[j+6], c1);
+      out2[i+j] = mod_dot3(B2[i], B2[i+1], B2[i+2], A2[j], A2[j+3],
+          A2[j+6], c2);
+    }
+  }
+  memcpy(A1, out1, sizeof(uint64_t) * 9);
+  memcpy(A2, out2, sizeof(uint64_t) * 9);
 }
 
 /******************************************************************************
@@ -211,39 +427,33 @@ Function `matrix_pow`:
   Compute the power of the two state advancing matrices for MRG32k3a,
   with modular reduction:
     A1 = A1^(step) % m1, A2 = A2^(step) % m2
+  The step is decomposed into digits of the radix `MRG32K3A_JUMP_RADIX`, and
+  the pre-computed matrices of all non-zero digits are multiplied, for both
+  components together.
 Arguments:
   * `A1`, `A2`: the two state advancing matrices for the MRG32k3a generator;
   * `step`:     the number of steps to be skipped.
 ******************************************************************************/
 static void matrix_pow(uint64_t A1[9], uint64_t A2[9], const uint64_t step) {
   uint64_t n = step;
-
-  int i = 0;
   bool init = false;
-  while (n) {
-    int j = n & 0x07UL;
-    if (j) {
-      if (!init) {      /* Initialise A1 and A2. */
-        for (int k = 0; k < 9; k++) {
-          A1[k] = A1gj8i[i][j-1][k];
-          A2[k] = A2gj8i[i][j-1][k];
-          init = 1;
-        }
-      }
-      else {            /* Compute A1 and A2 by matrix production. */
-        matrix_dot(A1, A1gj8i[i][j-1], A1, m1);
-        matrix_dot(A2, A2gj8i[i][j-1], A2, m2);
-      }
+
+  for (int i = 0; n; i++, n >>= MRG32K3A_JUMP_BITS) {
+    const int j = n & (MRG32K3A_JUMP_RADIX - 1);
+    if (!j) continue;
+    if (!init) {        /* Initialise A1 and A2. */
+      memcpy(A1, MRG32K3A_JUMP_A1[i][j-1], sizeof(uint64_t) * 9);
+      memcpy(A2, MRG32K3A_JUMP_A2[i][j-1], sizeof(uint64_t) * 9);
+      init = true;
+    }
+    else {              /* Compute A1 and A2 by matrix production. */
+      matrix_dot2(A1, MRG32K3A_JUMP_A1[i][j-1], A2, MRG32K3A_JUMP_A2[i][j-1]);
     }
-    i += 1;
-    n >>= 3;
   }
 
   if (!init) {          /* step == 0 */
-    for (int k = 0; k < 9; k++) {
-      A1[k] = A1gj8i[0][0][k];
-      A2[k] = A2gj8i[0][0][k];
-    }
+    memcpy(A1, MRG32K3A_JUMP_A1[0][0], sizeof(uint64_t) * 9);
+    memcpy(A2, MRG32K3A_JUMP_A2[0][0], sizeof(uint64_t) * 9);
   }
 }
 
@@ -263,6 +473,8 @@ static inline void copy_state(mrg32k3a_state_t *dst,
   dst->s20 = src->s20;
   dst->s21 = src->s21;
   dst->s22 = src->s22;
+  dst->gauss = src->gauss;
+  dst->has_gauss = src->has_gauss;
 }
 
 /******************************************************************************
@@ -279,16 +491,37 @@ static inline void state_forward(mrg32k3a_state_t *out,
   s0 = in->s10;
   s1 = in->s11;
   s2 = in->s12;
-  out->s10 = ((A1[0]*s0) % m1 + (A1[1]*s1) % m1 + (A1[2]*s2) % m1) % m1;
-  out->s11 = ((A1[3]*s0) % m1 + (A1[4]*s1) % m1 + (A1[5]*s2) % m1) % m1;
-  out->s12 = ((A1[6]*s0) % m1 + (A1[7]*s1) % m1 + (A1[8]*s2) % m1) % m1;
+  out->s10 = mod_dot3(A1[0], A1[1], A1[2], s0, s1, s2, c1);
+  out->s11 = mod_dot3(A1[3], A1[4], A1[5], s0, s1, s2, c1);
+  out->s12 = mod_dot3(A1[6], A1[7], A1[8], s0, s1, s2, c1);
 
   s0 = in->s20;
   s1 = in->s21;
   s2 = in->s22;
-  out->s20 = ((A2[0]*s0) % m2 + (A2[1]*s1) % m2 + (A2[2]*s2) % m2) % m2;
-  out->s21 = ((A2[3]*s0) % m2 + (A2[4]*s1) % m2 + (A2[5]*s2) % m2) % m2;
-  out->s22 = ((A2[6]*s0) % m2 + (A2[7]*s1) % m2 + (A2[8]*s2) % m2) % m2;
+  out->s20 = mod_dot3(A2[0], A2[1], A2[2], s0, s1, s2, c2);
+  out->s21 = mod_dot3(A2[3], A2[4], A2[5], s0, s1, s2, c2);
+  out->s22 = mod_dot3(A2[6], A2[7], A2[8], s0, s1, s2, c2);
+
+  /* The cached Gaussian number does not belong to the new position. */
+  out->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `cached_matrix`:
+  Retrieve the jump-ahead matrices from the cache of the interface, and
+  evaluate them if they are not cached.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     the number of steps to be skipped.
+Return:
+  The pointer to the matrices A1 and A2 (9 elements each), owned by the cache.
+******************************************************************************/
+static const uint64_t *cached_matrix(prand_t *rng, const uint64_t step) {
+  uint64_t *A = prand_cache_find(rng->cache, step);
+  if (A) return A;
+  A = prand_cache_insert(rng->cache, step);
+  PRAND_STATS_POLY(&rng->stats, matrix_pow(A, A + 9, step));
+  return A;
 }
 
 /******************************************************************************
@@ -299,31 +532,21 @@ Arguments:
   * `state`:            the state array for multiple streams;
   * `init_state`:       the pointer to the initial state;
   * `nstream`:          total number of streams;
-  * `step`:             step size for jumping ahead;
+  * `A`:                the jump-ahead matrices A1 and A2;
   * `err`:              an integer for storing the error message.
 ******************************************************************************/
 static void mrg32k3a_jump_seq(void **state, const void *init_state,
-    const unsigned int nstream, const uint64_t step, int *err) {
+    const unsigned int nstream, const uint64_t *A, int *err) {
   mrg32k3a_state_t **stat = (mrg32k3a_state_t **) state;
   mrg32k3a_state_t *istat = (mrg32k3a_state_t *) init_state;
-  uint64_t A1[9], A2[9];
 
   if (PRAND_IS_ERROR(*err)) return;
   /* fill state[0] with init_state */
   copy_state(stat[0], istat);
 
-  /* check of the upper limit should be done before calling this function */
-  if (!step) {
-    for (unsigned int i = 1; i < nstream; i++) copy_state(stat[i], stat[i - 1]);
-    return;
-  }
-
-  /* jump-ahead matrices */
-  matrix_pow(A1, A2, step);
-
   /* Advance states with the matrices. */
   for (unsigned int i = 1; i < nstream; i++)
-    state_forward(stat[i], stat[i - 1], A1, A2);
+    state_forward(stat[i], stat[i - 1], A, A + 9);
 }
 
 /******************************************************************************
@@ -346,7 +569,8 @@ static void mrg32k3a_jump(void *state, const uint64_t step, int *err) {
   }
 
   /* jump-ahead matrices */
-  matrix_pow(A1, A2, step);
+  PRAND_STATS_POLY(PRAND_STATS_STREAM(stat, sizeof(mrg32k3a_state_t)),
+      matrix_pow(A1, A2, step));
 
   /* Advance states with the matrices. */
   state_forward(stat, stat, A1, A2);
@@ -355,13 +579,14 @@ static void mrg32k3a_jump(void *state, const uint64_t step, int *err) {
 /******************************************************************************
 Function `mrg32k3a_jump_all`:
   Jump ahead the same number of steps for all streams.
+  If the library is compiled with OpenMP, the streams are distributed over
+  threads, which share the cached matrices.
 Arguments:
   * `rng`:      the random number generator interface;
   * `step`:     step size for jumping ahead;
   * `err`:      an integer for storing the error message.
 ******************************************************************************/
 static void mrg32k3a_jump_all(prand_t *rng, const uint64_t step, int *err) {
-  uint64_t A1[9], A2[9];
   if (PRAND_IS_ERROR(*err)) return;
 
   if (!step) return;
@@ -371,12 +596,80 @@ static void mrg32k3a_jump_all(prand_t *rng, const uint64_t step, int *err) {
   }
 
   /* jump-ahead matrices */
-  matrix_pow(A1, A2, step);
+  const uint64_t *A = cached_matrix(rng, step);
+  mrg32k3a_state_t **stat = (mrg32k3a_state_t **) rng->state_stream;
+
+#ifdef _OPENMP
+  if (rng->nstream >= JUMP_ALL_PAR_MIN && omp_get_max_threads() > 1
+      && !omp_in_parallel()) {
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < rng->nstream; i++)
+      state_forward(stat[i], stat[i], A, A + 9);
+    return;
+  }
+#endif
 
   /* Advance states with the matrices. */
   for (int i = 0; i < rng->nstream; i++)
-    state_forward(((mrg32k3a_state_t **) (rng->state_stream))[i],
-        ((mrg32k3a_state_t **) (rng->state_stream))[i], A1, A2);
+    state_forward(stat[i], stat[i], A, A + 9);
+}
+
+/******************************************************************************
+Function `mrg32k3a_jump_prepare`:
+  Pre-compute the jump-ahead matrices for a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  The pre-computed jump on success; NULL on error.
+******************************************************************************/
+static prand_jump_t *mrg32k3a_jump_prepare(prand_t *rng, const uint64_t step,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (step > MRG32K3A_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return NULL;
+  }
+
+  prand_jump_t *jmp = malloc(sizeof(prand_jump_t));
+  if (!jmp) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return NULL;
+  }
+  jmp->type = PRAND_RNG_MRG32K3A;
+  jmp->step = step;
+  jmp->data = NULL;
+  if (!step) return jmp;
+
+  if (!(jmp->data = malloc(sizeof(uint64_t) * 18))) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    free(jmp);
+    return NULL;
+  }
+  memcpy(jmp->data, cached_matrix(rng, step), sizeof(uint64_t) * 18);
+  return jmp;
+}
+
+/******************************************************************************
+Function `mrg32k3a_jump_apply`:
+  Jump ahead for one stream, with a pre-computed jump.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `jmp`:      the pre-computed jump;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void mrg32k3a_jump_apply(void *state, const prand_jump_t *jmp,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (jmp->type != PRAND_RNG_MRG32K3A) {
+    *err = PRAND_ERR_JUMP_TYPE;
+    return;
+  }
+  if (!jmp->step) return;
+
+  const uint64_t *A = (const uint64_t *) jmp->data;
+  state_forward(state, state, A, A + 9);
 }
 
 /******************************************************************************
@@ -402,6 +695,32 @@ static void mrg32k3a_reset(void *state, const uint64_t seed,
   mrg32k3a_jump(stat, step, err);
 }
 
+/******************************************************************************
+Function `mrg32k3a_spread`:
+  Initialise the states of all streams from the seeded first stream, with
+  the starting points separated by a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void mrg32k3a_spread(prand_t *rng, const uint64_t step, int *err) {
+  mrg32k3a_state_t *stat = (mrg32k3a_state_t *) (rng->state);
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (!step) {
+    for (int i = 1; i < rng->nstream; i++)
+      memcpy(rng->state_stream[i], stat, sizeof(mrg32k3a_state_t));
+    return;
+  }
+
+  /* jump-ahead matrices */
+  const uint64_t *A = cached_matrix(rng, step);
+
+  if (rng->nstream <= 1) state_forward(stat, stat, A, A + 9);
+  else mrg32k3a_jump_seq(rng->state_stream, stat, rng->nstream, A, err);
+}
+
 /******************************************************************************
 Function `mrg32k3a_reset_all`:
   Reset the state for all streams, with a given seed and number of skip steps.
@@ -422,21 +741,145 @@ static void mrg32k3a_reset_all(prand_t *rng, const uint64_t seed,
   }
   else mrg32k3a_seed(stat, seed);
 
-  if (!step) {
-    for (int i = 1; i < rng->nstream; i++)
-      memcpy(rng->state_stream[i], stat, sizeof(mrg32k3a_state_t));
-    return;
-  }
-  else if (step > MRG32K3A_MAX_STEP) {
+  if (step > MRG32K3A_MAX_STEP) {
     *err = PRAND_ERR_STEP;
     return;
   }
+  mrg32k3a_spread(rng, step, err);
+}
+
+/******************************************************************************
+Macro `MRG32K3A_FILL_ALL`:
+  Generate numbers from all streams in lock-step, with `MRG32K3A_NLANE`
+  streams advanced simultaneously by the vectorised kernel. The i-th number
+  of the s-th stream is stored as the (i * nstream + s)-th element of the
+  output array. The outputs are generated in chunks of `FILL_ALL_CHUNK`
+  steps, to keep the scattered writes in cache. Groups with too few streams
+  for the lanes to pay off are advanced one stream after another.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream;
+  * `offset`:   the offset added to the generated integers;
+  * `scale`:    the factor multiplied to the integers after adding the offset.
+******************************************************************************/
+#define MRG32K3A_FILL_ALL(rng, out, n, offset, scale) {                 \
+  const mrg32k3a_kernel_t *kernel = mrg32k3a_kernel();                  \
+  const size_t ns = (rng)->nstream;                                     \
+  double s[6 * MRG32K3A_NLANE];                                         \
+  double buf[FILL_ALL_CHUNK * MRG32K3A_NLANE];                          \
+  for (size_t j0 = 0; j0 < (n); j0 += FILL_ALL_CHUNK) {                 \
+    const size_t len = ((n) - j0 < FILL_ALL_CHUNK) ? (n) - j0 :         \
+      FILL_ALL_CHUNK;                                                   \
+    for (size_t i0 = 0; i0 < ns; i0 += MRG32K3A_NLANE) {                \
+      const size_t nl = (ns - i0 < MRG32K3A_NLANE) ? ns - i0 :          \
+        MRG32K3A_NLANE;                                                 \
+      if (!kernel || (nl < FILL_ALL_MIN_LANES && nl < MRG32K3A_NLANE)) { \
+        for (size_t l = 0; l < nl; l++) {       /* per-stream path */   \
+          MRG32K3A_FILL((rng)->state_stream[i0 + l], buf, len,          \
+              (x + (offset)) * (scale));                                \
+          for (size_t j = 0; j < len; j++)                              \
+            (out)[(j0 + j) * ns + i0 + l] = buf[j];                     \
+        }                                                               \
+        continue;                                                       \
+      }                                                                 \
+      /* Unused lanes are filled with a copy of the first stream. */    \
+      for (size_t l = 0; l < MRG32K3A_NLANE; l++) {                     \
+        mrg32k3a_state_t *stat =                                        \
+          (rng)->state_stream[i0 + (l < nl ? l : 0)];                   \
+        s[l] = stat->s10;                                               \
+        s[l + MRG32K3A_NLANE] = stat->s11;                              \
+        s[l + 2 * MRG32K3A_NLANE] = stat->s12;                          \
+        s[l + 3 * MRG32K3A_NLANE] = stat->s20;                          \
+        s[l + 4 * MRG32K3A_NLANE] = stat->s21;                          \
+        s[l + 5 * MRG32K3A_NLANE] = stat->s22;                          \
+      }                                                                 \
+      kernel->lanes(s, buf, len, offset, scale);                        \
+      for (size_t j = 0; j < len; j++) {                                \
+        for (size_t l = 0; l < nl; l++)                                 \
+          (out)[(j0 + j) * ns + i0 + l] = buf[j * MRG32K3A_NLANE + l];  \
+      }                                                                 \
+      for (size_t l = 0; l < nl; l++) {                                 \
+        mrg32k3a_state_t *stat = (rng)->state_stream[i0 + l];           \
+        stat->s10 = s[l];                                               \
+        stat->s11 = s[l + MRG32K3A_NLANE];                              \
+        stat->s12 = s[l + 2 * MRG32K3A_NLANE];                          \
+        stat->s20 = s[l + 3 * MRG32K3A_NLANE];                          \
+        stat->s21 = s[l + 4 * MRG32K3A_NLANE];                          \
+        stat->s22 = s[l + 5 * MRG32K3A_NLANE];                          \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_all`:
+  Generate integers from all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated for each stream.
+******************************************************************************/
+static void mrg32k3a_fill_all(prand_t *rng, uint64_t *out, const size_t n) {
+  MRG32K3A_FILL_ALL(rng, out, n, 0, 1);
+}
 
-  if (rng->nstream <= 1) mrg32k3a_jump(stat, step, err);
-  else mrg32k3a_jump_seq(rng->state_stream, stat, rng->nstream, step, err);
+/******************************************************************************
+Function `mrg32k3a_fill_all_double`:
+  Generate double-precision floating-point numbers in the range [0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mrg32k3a_fill_all_double(prand_t *rng, double *out,
+    const size_t n) {
+  MRG32K3A_FILL_ALL(rng, out, n, 0, norm);
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_all_double_pos`:
+  Generate double-precision floating-point numbers in the range (0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mrg32k3a_fill_all_double_pos(prand_t *rng, double *out,
+    const size_t n) {
+  MRG32K3A_FILL_ALL(rng, out, n, 1, norm_pos);
+}
+
+/******************************************************************************
+Function `mrg32k3a_fill_all_double53`:
+  Generate double-precision floating-point numbers in the range [0,1), with
+  53-bit resolution, from all streams in lock-step. The streams are processed
+  one after another, since the lanes of the vectorised kernel produce one
+  number per step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mrg32k3a_fill_all_double53(prand_t *rng, double *out,
+    const size_t n) {
+  const size_t ns = rng->nstream;
+  for (size_t s = 0; s < ns; s++)
+    MRG32K3A_FILL53(rng->state_stream[s], out + s, n, ns);
 }
 
 
+/*============================================================================*\
+                     Wrappers of the functions with counters
+\*============================================================================*/
+
+/* The wrappers are defined only if the library is compiled with
+ * `-DPRAND_STATS`, see `prand_stats.h`. */
+PRAND_STATS_FUNCS(mrg32k3a, mrg32k3a_state_t, PRAND_RNG_MRG32K3A)
+
+
 /*============================================================================*\
                           Interface for initialisation
 \*============================================================================*/
@@ -474,29 +917,53 @@ prand_t *mrg32k3a_init(const uint64_t seed, const unsigned int nstream,
     return NULL;
   }
 
-  mrg32k3a_state_t *states = malloc(sizeof(mrg32k3a_state_t) * numstr);
+  void *states = prand_state_alloc(rng->state_stream,
+      sizeof(mrg32k3a_state_t), numstr, PRAND_CACHE_LINE);
   if (!states) {
     free(rng->state_stream);
     free(rng);
     *err = PRAND_ERR_MEMORY;
     return NULL;
   }
-  for (unsigned int i = 0; i < numstr; i++)
-    rng->state_stream[i] = states + i;
+
+  rng->cache = prand_cache_init(sizeof(uint64_t) * 18, 0);
+  if (!rng->cache) {
+    prand_state_free(states);
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
 
   rng->state = rng->state_stream[0];
+  rng->substream = NULL;
+  PRAND_STATS_CLEAR(rng);
   rng->nstream = numstr;
   rng->type = PRAND_RNG_MRG32K3A;
   rng->min = 0;
   rng->max = m1;
+  rng->ndraw53 = 2;
 
   rng->get = &mrg32k3a_get;
   rng->get_double = &mrg32k3a_get_double;
   rng->get_double_pos = &mrg32k3a_get_double_pos;
+  rng->get_double53 = &mrg32k3a_get_double53;
+  rng->fill = &mrg32k3a_fill;
+  rng->fill_double = &mrg32k3a_fill_double;
+  rng->fill_double_pos = &mrg32k3a_fill_double_pos;
+  rng->fill_double53 = &mrg32k3a_fill_double53;
+  rng->get_gaussian = &mrg32k3a_get_gaussian;
+  rng->fill_gaussian = &mrg32k3a_fill_gaussian;
+  rng->fill_all = &mrg32k3a_fill_all;
+  rng->fill_all_double = &mrg32k3a_fill_all_double;
+  rng->fill_all_double_pos = &mrg32k3a_fill_all_double_pos;
+  rng->fill_all_double53 = &mrg32k3a_fill_all_double53;
   rng->reset = &mrg32k3a_reset;
   rng->reset_all = &mrg32k3a_reset_all;
   rng->jump = &mrg32k3a_jump;
   rng->jump_all = &mrg32k3a_jump_all;
+  rng->jump_prepare = &mrg32k3a_jump_prepare;
+  rng->jump_apply = &mrg32k3a_jump_apply;
 
   if (seed == 0) {
     *err = PRAND_WARN_SEED;
@@ -506,9 +973,10 @@ prand_t *mrg32k3a_init(const uint64_t seed, const unsigned int nstream,
 
   if (nstream == 0)
     mrg32k3a_jump(rng->state, step, err);
-  else
-    mrg32k3a_jump_seq(rng->state_stream, rng->state, nstream, step, err);
+  else if (nstream > 1)
+    mrg32k3a_spread(rng, step, err);
 
+  PRAND_STATS_WRAP(rng, mrg32k3a);
   return rng;
 }
 
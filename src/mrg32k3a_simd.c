@@ -0,0 +1,351 @@
+/*******************************************************************************
+* mrg32k3a_simd.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "mrg32k3a.h"
+#include "prand_cpu.h"
+
+/*******************************************************************************
+  Kernels for advancing multiple MRG32k3a streams simultaneously, with the
+  states of different streams stored in separate lanes of vector registers.
+
+  All the operations are carried out with double-precision floating-point
+  numbers. Since the products of the multipliers and the state components are
+  smaller than 2^53, they are exact. The modular reduction p - k * m is then
+  exact as well, for any integer k close to p / m, and a final correction
+  gives the unique representative in [0,m). Thus all the kernels produce
+  results that are identical to those of `mrg32k3a_get`.
+
+  Without vector instructions, there is no kernel for multiple streams, and
+  the streams are advanced one after another with the scalar code.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define NLANE           MRG32K3A_NLANE
+
+#if NLANE != 4 && NLANE != 8 && NLANE != 16
+  #error `MRG32K3A_NLANE` must be 4, 8, or 16
+#endif
+
+#define M1              ((double) MRG32K3A_M1)
+#define M2              ((double) MRG32K3A_M2)
+#define A12             ((double) MRG32K3A_A12)
+#define A13             ((double) MRG32K3A_A13)
+#define A21             ((double) MRG32K3A_A21)
+#define A23             ((double) MRG32K3A_A23)
+#define INV_M1          (1.0 / M1)
+#define INV_M2          (1.0 / M2)
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+/* Magic number for rounding double-precision numbers to integers. */
+#define ROUND_MAGIC     0x1.8p52
+
+/******************************************************************************
+Function `mod_sse2`:
+  Reduce 2 integer-valued floating-point numbers modulo m.
+Arguments:
+  * `p`:        the numbers to be reduced, with |p| < 2^53;
+  * `m`:        the modulus;
+  * `inv`:      the reciprocal of the modulus.
+Return:
+  The remainders in the range [0,m).
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline __m128d mod_sse2(__m128d p, const __m128d m, const __m128d inv) {
+  const __m128d magic = _mm_set1_pd(ROUND_MAGIC);
+  __m128d k = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(p, inv), magic), magic);
+  p = _mm_sub_pd(p, _mm_mul_pd(k, m));
+  return _mm_add_pd(p, _mm_and_pd(_mm_cmplt_pd(p, _mm_setzero_pd()), m));
+}
+
+/******************************************************************************
+Function `step_sse2`:
+  Advance 2 streams by one step.
+Arguments:
+  * `s`:        the 6 state components of the streams.
+Return:
+  The outputs of the streams.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline __m128d step_sse2(__m128d *s) {
+  __m128d p1 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(A12), s[1]),
+      _mm_mul_pd(_mm_set1_pd(A13), s[0]));
+  p1 = mod_sse2(p1, _mm_set1_pd(M1), _mm_set1_pd(INV_M1));
+  s[0] = s[1]; s[1] = s[2]; s[2] = p1;
+  __m128d p2 = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(A21), s[5]),
+      _mm_mul_pd(_mm_set1_pd(A23), s[3]));
+  p2 = mod_sse2(p2, _mm_set1_pd(M2), _mm_set1_pd(INV_M2));
+  s[3] = s[4]; s[4] = s[5]; s[5] = p2;
+  __m128d x = _mm_sub_pd(p1, p2);
+  return _mm_add_pd(x, _mm_and_pd(_mm_cmple_pd(x, _mm_setzero_pd()),
+        _mm_set1_pd(M1)));
+}
+
+PRAND_TARGET("sse2")
+static void lanes_sse2(double *s, double *out, const size_t n,
+    const double offset, const double scale) {
+  const __m128d voff = _mm_set1_pd(offset);
+  const __m128d vscale = _mm_set1_pd(scale);
+  /* Process 2 vectors at one time, to hide the latency. */
+  for (int l = 0; l < NLANE; l += 4) {
+    __m128d a[6], b[6];
+    for (int c = 0; c < 6; c++) {
+      a[c] = _mm_loadu_pd(s + c * NLANE + l);
+      b[c] = _mm_loadu_pd(s + c * NLANE + l + 2);
+    }
+    for (size_t j = 0; j < n; j++) {
+      __m128d xa = step_sse2(a);
+      __m128d xb = step_sse2(b);
+      _mm_storeu_pd(out + j * NLANE + l, _mm_mul_pd(_mm_add_pd(xa, voff),
+            vscale));
+      _mm_storeu_pd(out + j * NLANE + l + 2, _mm_mul_pd(_mm_add_pd(xb, voff),
+            vscale));
+    }
+    for (int c = 0; c < 6; c++) {
+      _mm_storeu_pd(s + c * NLANE + l, a[c]);
+      _mm_storeu_pd(s + c * NLANE + l + 2, b[c]);
+    }
+  }
+}
+
+static const mrg32k3a_kernel_t kernel_sse2 = { &lanes_sse2 };
+
+
+/*============================================================================*\
+                           Kernels with AVX2 and FMA
+\*============================================================================*/
+
+PRAND_TARGET("avx2,fma")
+static inline __m256d mod_avx2(__m256d p, const __m256d m, const __m256d inv) {
+  __m256d k = _mm256_round_pd(_mm256_mul_pd(p, inv),
+      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  p = _mm256_fnmadd_pd(k, m, p);
+  return _mm256_add_pd(p, _mm256_and_pd(_mm256_cmp_pd(p,
+          _mm256_setzero_pd(), _CMP_LT_OQ), m));
+}
+
+PRAND_TARGET("avx2,fma")
+static inline __m256d step_avx2(__m256d *s) {
+  __m256d p1 = _mm256_fmadd_pd(_mm256_set1_pd(A12), s[1],
+      _mm256_mul_pd(_mm256_set1_pd(A13), s[0]));
+  p1 = mod_avx2(p1, _mm256_set1_pd(M1), _mm256_set1_pd(INV_M1));
+  s[0] = s[1]; s[1] = s[2]; s[2] = p1;
+  __m256d p2 = _mm256_fmadd_pd(_mm256_set1_pd(A21), s[5],
+      _mm256_mul_pd(_mm256_set1_pd(A23), s[3]));
+  p2 = mod_avx2(p2, _mm256_set1_pd(M2), _mm256_set1_pd(INV_M2));
+  s[3] = s[4]; s[4] = s[5]; s[5] = p2;
+  __m256d x = _mm256_sub_pd(p1, p2);
+  return _mm256_add_pd(x, _mm256_and_pd(_mm256_cmp_pd(x,
+          _mm256_setzero_pd(), _CMP_LE_OQ), _mm256_set1_pd(M1)));
+}
+
+PRAND_TARGET("avx2,fma")
+static void lanes_avx2(double *s, double *out, const size_t n,
+    const double offset, const double scale) {
+  const __m256d voff = _mm256_set1_pd(offset);
+  const __m256d vscale = _mm256_set1_pd(scale);
+#if NLANE == 4
+  __m256d a[6];
+  for (int c = 0; c < 6; c++) a[c] = _mm256_loadu_pd(s + c * NLANE);
+  for (size_t j = 0; j < n; j++) {
+    __m256d xa = step_avx2(a);
+    _mm256_storeu_pd(out + j * NLANE, _mm256_mul_pd(_mm256_add_pd(xa, voff),
+          vscale));
+  }
+  for (int c = 0; c < 6; c++) _mm256_storeu_pd(s + c * NLANE, a[c]);
+#else
+  for (int l = 0; l < NLANE; l += 8) {
+    __m256d a[6], b[6];
+    for (int c = 0; c < 6; c++) {
+      a[c] = _mm256_loadu_pd(s + c * NLANE + l);
+      b[c] = _mm256_loadu_pd(s + c * NLANE + l + 4);
+    }
+    for (size_t j = 0; j < n; j++) {
+      __m256d xa = step_avx2(a);
+      __m256d xb = step_avx2(b);
+      _mm256_storeu_pd(out + j * NLANE + l,
+          _mm256_mul_pd(_mm256_add_pd(xa, voff), vscale));
+      _mm256_storeu_pd(out + j * NLANE + l + 4,
+          _mm256_mul_pd(_mm256_add_pd(xb, voff), vscale));
+    }
+    for (int c = 0; c < 6; c++) {
+      _mm256_storeu_pd(s + c * NLANE + l, a[c]);
+      _mm256_storeu_pd(s + c * NLANE + l + 4, b[c]);
+    }
+  }
+#endif
+}
+
+static const mrg32k3a_kernel_t kernel_avx2 = { &lanes_avx2 };
+
+
+#if NLANE == 16
+/*============================================================================*\
+                             Kernels with AVX-512
+\*============================================================================*/
+
+/* With fewer lanes, a single AVX-512 vector per step is latency bound, and
+ * does not outperform the AVX2 kernels. */
+
+PRAND_TARGET("avx512f")
+static inline __m512d mod_avx512(__m512d p, const __m512d m,
+    const __m512d inv) {
+  __m512d k = _mm512_roundscale_pd(_mm512_mul_pd(p, inv),
+      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  p = _mm512_fnmadd_pd(k, m, p);
+  return _mm512_mask_add_pd(p, _mm512_cmp_pd_mask(p, _mm512_setzero_pd(),
+        _CMP_LT_OQ), p, m);
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512d step_avx512(__m512d *s) {
+  __m512d p1 = _mm512_fmadd_pd(_mm512_set1_pd(A12), s[1],
+      _mm512_mul_pd(_mm512_set1_pd(A13), s[0]));
+  p1 = mod_avx512(p1, _mm512_set1_pd(M1), _mm512_set1_pd(INV_M1));
+  s[0] = s[1]; s[1] = s[2]; s[2] = p1;
+  __m512d p2 = _mm512_fmadd_pd(_mm512_set1_pd(A21), s[5],
+      _mm512_mul_pd(_mm512_set1_pd(A23), s[3]));
+  p2 = mod_avx512(p2, _mm512_set1_pd(M2), _mm512_set1_pd(INV_M2));
+  s[3] = s[4]; s[4] = s[5]; s[5] = p2;
+  __m512d x = _mm512_sub_pd(p1, p2);
+  return _mm512_mask_add_pd(x, _mm512_cmp_pd_mask(x, _mm512_setzero_pd(),
+        _CMP_LE_OQ), x, _mm512_set1_pd(M1));
+}
+
+PRAND_TARGET("avx512f")
+static void lanes_avx512(double *s, double *out, const size_t n,
+    const double offset, const double scale) {
+  const __m512d voff = _mm512_set1_pd(offset);
+  const __m512d vscale = _mm512_set1_pd(scale);
+  __m512d a[6], b[6];
+  for (int c = 0; c < 6; c++) {
+    a[c] = _mm512_loadu_pd(s + c * NLANE);
+    b[c] = _mm512_loadu_pd(s + c * NLANE + 8);
+  }
+  for (size_t j = 0; j < n; j++) {
+    __m512d xa = step_avx512(a);
+    __m512d xb = step_avx512(b);
+    _mm512_storeu_pd(out + j * NLANE, _mm512_mul_pd(_mm512_add_pd(xa, voff),
+          vscale));
+    _mm512_storeu_pd(out + j * NLANE + 8,
+        _mm512_mul_pd(_mm512_add_pd(xb, voff), vscale));
+  }
+  for (int c = 0; c < 6; c++) {
+    _mm512_storeu_pd(s + c * NLANE, a[c]);
+    _mm512_storeu_pd(s + c * NLANE + 8, b[c]);
+  }
+}
+
+static const mrg32k3a_kernel_t kernel_avx512 = { &lanes_avx512 };
+#endif
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline float64x2_t mod_neon(float64x2_t p, const float64x2_t m,
+    const float64x2_t inv) {
+  float64x2_t k = vrndnq_f64(vmulq_f64(p, inv));
+  p = vfmsq_f64(p, k, m);
+  return vbslq_f64(vcltzq_f64(p), vaddq_f64(p, m), p);
+}
+
+static inline float64x2_t step_neon(float64x2_t *s) {
+  float64x2_t p1 = vfmaq_f64(vmulq_n_f64(s[0], A13), s[1], vdupq_n_f64(A12));
+  p1 = mod_neon(p1, vdupq_n_f64(M1), vdupq_n_f64(INV_M1));
+  s[0] = s[1]; s[1] = s[2]; s[2] = p1;
+  float64x2_t p2 = vfmaq_f64(vmulq_n_f64(s[3], A23), s[5], vdupq_n_f64(A21));
+  p2 = mod_neon(p2, vdupq_n_f64(M2), vdupq_n_f64(INV_M2));
+  s[3] = s[4]; s[4] = s[5]; s[5] = p2;
+  float64x2_t x = vsubq_f64(p1, p2);
+  return vbslq_f64(vclezq_f64(x), vaddq_f64(x, vdupq_n_f64(M1)), x);
+}
+
+static void lanes_neon(double *s, double *out, const size_t n,
+    const double offset, const double scale) {
+  const float64x2_t voff = vdupq_n_f64(offset);
+  const float64x2_t vscale = vdupq_n_f64(scale);
+  for (int l = 0; l < NLANE; l += 4) {
+    float64x2_t a[6], b[6];
+    for (int c = 0; c < 6; c++) {
+      a[c] = vld1q_f64(s + c * NLANE + l);
+      b[c] = vld1q_f64(s + c * NLANE + l + 2);
+    }
+    for (size_t j = 0; j < n; j++) {
+      float64x2_t xa = step_neon(a);
+      float64x2_t xb = step_neon(b);
+      vst1q_f64(out + j * NLANE + l, vmulq_f64(vaddq_f64(xa, voff), vscale));
+      vst1q_f64(out + j * NLANE + l + 2,
+          vmulq_f64(vaddq_f64(xb, voff), vscale));
+    }
+    for (int c = 0; c < 6; c++) {
+      vst1q_f64(s + c * NLANE + l, a[c]);
+      vst1q_f64(s + c * NLANE + l + 2, b[c]);
+    }
+  }
+}
+
+static const mrg32k3a_kernel_t kernel_neon = { &lanes_neon };
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `mrg32k3a_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels, or NULL if vector instructions are not
+  available.
+******************************************************************************/
+const mrg32k3a_kernel_t *mrg32k3a_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+#if NLANE == 16
+  if (PRAND_CPU_HAS("avx512f")) return &kernel_avx512;
+#endif
+  if (PRAND_CPU_HAS("avx2") && PRAND_CPU_HAS("fma")) return &kernel_avx2;
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return NULL;
+}
@@ -30,8 +30,15 @@
 
 #include "mt19937.h"
 #include "mt19937_jump.h"
+#include "prand_cache.h"
+#include "prand_state.h"
+#include "prand_stats.h"
+#include "prand_math.h"
 #include <stdlib.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /*******************************************************************************
   Implementation of the Mersenne Twister 19937 random number generator.
@@ -55,40 +62,47 @@
   #define N               MT19937_N
 #endif
 
-#define M               397
+#define M               MT19937_M
 #define K               19937
-#define MA              0x9908b0dfUL
+#define MA              MT19937_MA
 #define UPPER_MASK(x)   (0x80000000UL & x)      /* most significant w-r bits */
 #define LOWER_MASK(x)   (0x7fffffffUL & x)      /* least significant r bits */
 
 /* Normalisation for sampling a float-point number in the range [0,1). */
-#define NORM            0x1p-32                 /* 2^{-32} */
+#define NORM            MT19937_NORM
 /* Normalisation for sampling a float-point number in the range (0,1). */
-#define NORM_POS        0x1.fffffffep-33        /* 1 / (2^{32} + 1) */
+#define NORM_POS        MT19937_NORM_POS
 
 #define DEFAULT_SEED    1
 
-#ifndef MT19937_UNROLL
-  #define MAGIC(y)      (((y) & 1) ? MA : 0)
+/* The table of pre-computed polynomials, which is needed only for the steps
+ * no less than K, is loaded on demand with `-DMT19937_POLY_LAZY`. */
+#ifdef MT19937_POLY_LAZY
+  #define POLY_TABLE            ((const uint32_t (*)[7][N]) mt19937_poly_lazy)
+  #define POLY_LOAD(need, err)  ((need) && !mt19937_poly_load(err))
 #else
-/******************************************************************************
-  The following trick is taken from
-  https://github.com/cslarsen/mersenne-twister
-  which is distributed under the modified BSD license.
-  It is supposed to work faster with `-ftree-vectorize`, especially for
-  machines with SSE/AVX.
-******************************************************************************/
-  #define MAGIC(y)      (((((int32_t)y) << 31) >> 31) & MA)
+  #define POLY_TABLE            mt19937_poly
+  #define POLY_LOAD(need, err)  0
 #endif
 
+/* Width of the window for the sliding-window Horner scheme. */
+#define HORNER_WIN      4
+/* Maximum number of non-zero terms of the jump-ahead polynomial for the
+ * Horner scheme, if the carry-less multiply instructions are available. */
+#define HORNER_MAX_TERMS        2048
+
+/* Minimum number of streams for the parallel initialisation with OpenMP. */
+#define JUMP_SEQ_PAR_MIN        8
+/* Minimum number of streams for jumping ahead in parallel with OpenMP. */
+#define JUMP_ALL_PAR_MIN        2
+
+
 /*============================================================================*\
                             Definition of the state
 \*============================================================================*/
 
-typedef struct {
-  uint32_t mt[N];
-  int idx;
-} mt19937_state_t;
+/* The state is shared with the inline interface. */
+typedef prand_mt19937_state_t mt19937_state_t;
 
 
 /*============================================================================*\
@@ -112,6 +126,7 @@ static void mt19937_seed(void *state, uint64_t seed) {
     stat->mt[i] = 1812433253UL * (stat->mt[i-1] ^ (stat->mt[i-1] >> 30)) + i;
 
   stat->idx = i;
+  stat->has_gauss = 0;
 }
 
 /******************************************************************************
@@ -124,33 +139,8 @@ Return:
 ******************************************************************************/
 static uint64_t mt19937_get(void *state) {
   mt19937_state_t *stat = (mt19937_state_t *) state;
-  uint32_t y;
-
-  if (stat->idx >= N) {         /* generate N words at one time */
-    int k;
-    for (k = 0; k < N - M; k++) {
-      y = UPPER_MASK(stat->mt[k]) | LOWER_MASK(stat->mt[k+1]);
-      stat->mt[k] = stat->mt[k+M] ^ (y >> 1) ^ MAGIC(y);
-    }
-    for (; k < N - 1; k++) {
-      y = UPPER_MASK(stat->mt[k]) | LOWER_MASK(stat->mt[k+1]);
-      stat->mt[k] = stat->mt[k+M-N] ^ (y >> 1) ^ MAGIC(y);
-    }
-    y = UPPER_MASK(stat->mt[N-1]) | LOWER_MASK(stat->mt[0]);
-    stat->mt[N-1] = stat->mt[M-1] ^ (y >> 1) ^ MAGIC(y);
-    stat->idx = 0;
-  }
-
-  /* tempering */
-  y = stat->mt[stat->idx];
-
-  y ^= (y >> 11);
-  y ^= (y << 7) & 0x9d2c5680UL;
-  y ^= (y << 15) & 0xefc60000UL;
-  y ^= (y >> 18);
-
-  stat->idx += 1;
-  return y;
+  PRAND_STATS_REGEN(stat, stat->idx >= N);
+  return prand_mt19937_get(stat);
 }
 
 /******************************************************************************
@@ -177,6 +167,212 @@ static double mt19937_get_double_pos(void *state) {
   return (mt19937_get(state) + 1) * NORM_POS;
 }
 
+/******************************************************************************
+Function `mt19937_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double mt19937_get_double53(void *state) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  PRAND_STATS_REGEN(stat, stat->idx >= N - 1);
+  return prand_mt19937_get_double53(stat);
+}
+
+/******************************************************************************
+Function `mt19937_block`:
+  Retrieve a block of untempered words from the state array, and regenerate
+  the state array if all the words are consumed.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `kernel`:   the kernels for generating the state array;
+  * `len`:      the requested number of words, which is updated to the
+                number of available words in the block.
+Return:
+  The pointer to the first word of the block.
+******************************************************************************/
+static inline const uint32_t *mt19937_block(mt19937_state_t *stat,
+    const mt19937_kernel_t *kernel, size_t *len) {
+  PRAND_STATS_REGEN(stat, stat->idx >= N);
+  if (stat->idx >= N) {         /* generate N words at one time */
+    kernel->twist(stat->mt);
+    stat->idx = 0;
+  }
+  if (*len > (size_t) (N - stat->idx)) *len = N - stat->idx;
+
+  const uint32_t *mt = stat->mt + stat->idx;
+  stat->idx += *len;
+  return mt;
+}
+
+/******************************************************************************
+Function `mt19937_fill`:
+  Generate an array of integers and update the state.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated.
+******************************************************************************/
+static void mt19937_fill(void *state, uint64_t *out, const size_t n) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  const mt19937_kernel_t *kernel = mt19937_kernel();
+  size_t i = 0;
+  while (i < n) {
+    size_t len = n - i;
+    const uint32_t *mt = mt19937_block(stat, kernel, &len);
+    kernel->temper(out + i, mt, len);
+    i += len;
+  }
+}
+
+/******************************************************************************
+Function `mt19937_fill_double`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mt19937_fill_double(void *state, double *out, const size_t n) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  const mt19937_kernel_t *kernel = mt19937_kernel();
+  size_t i = 0;
+  while (i < n) {
+    size_t len = n - i;
+    const uint32_t *mt = mt19937_block(stat, kernel, &len);
+    kernel->temper_double(out + i, mt, len);
+    i += len;
+  }
+}
+
+/******************************************************************************
+Function `mt19937_fill_double_pos`:
+  Generate an array of double-precision floating-point numbers in the
+  range (0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mt19937_fill_double_pos(void *state, double *out, const size_t n) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  const mt19937_kernel_t *kernel = mt19937_kernel();
+  size_t i = 0;
+  while (i < n) {
+    size_t len = n - i;
+    const uint32_t *mt = mt19937_block(stat, kernel, &len);
+    kernel->temper_double_pos(out + i, mt, len);
+    i += len;
+  }
+}
+
+/******************************************************************************
+Macro `MT19937_FILL53`:
+  Generate an array of floating-point numbers with 53-bit resolution from one
+  stream, with pairs of words taken from the blocks of the state array, and
+  tempered by the vectorised kernel. The i-th number is stored as the
+  (i * stride)-th element of the output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array.
+******************************************************************************/
+#define MT19937_FILL53(stat, out, n, stride) {                          \
+  const mt19937_kernel_t *kernel = mt19937_kernel();                    \
+  uint64_t buf[N];                                                      \
+  size_t i = 0;                                                         \
+  while (i < (n)) {                                                     \
+    size_t len = ((n) - i) << 1;                                        \
+    const uint32_t *mt = mt19937_block(stat, kernel, &len);             \
+    if (len == 1) {             /* the pair spans two blocks */         \
+      const uint32_t a = prand_mt19937_temper(mt[0]);                   \
+      (out)[(i++) * (stride)] = prand_double53(a, mt19937_get(stat));   \
+      continue;                                                         \
+    }                                                                   \
+    (stat)->idx -= len & 1;     /* leave the unpaired word */           \
+    kernel->temper(buf, mt, len);                                       \
+    len >>= 1;                                                          \
+    for (size_t j = 0; j < len; j++) {                                  \
+      (out)[(i + j) * (stride)] =                                       \
+        prand_double53(buf[j << 1], buf[(j << 1) + 1]);                 \
+    }                                                                   \
+    i += len;                                                           \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `mt19937_fill_double53`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1), with 53-bit resolution. The results are identical to those of
+  calling `mt19937_get_double53` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void mt19937_fill_double53(void *state, double *out, const size_t n) {
+  MT19937_FILL53((mt19937_state_t *) state, out, n, 1);
+}
+
+/******************************************************************************
+Function `mt19937_get_gaussian`:
+  Generate a Gaussian number with zero mean and unit variance, and update the
+  state. The numbers are generated in pairs with the Box-Muller method, from
+  two floating-point numbers in the range (0,1) each, and the second number
+  of a pair is cached for the next call.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random Gaussian number.
+******************************************************************************/
+static double mt19937_get_gaussian(void *state) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  if (stat->has_gauss) {
+    stat->has_gauss = 0;
+    return stat->gauss;
+  }
+
+  double z[2];
+  z[0] = mt19937_get_double_pos(state);
+  z[1] = mt19937_get_double_pos(state);
+  prand_box_muller(z, 1);
+  stat->gauss = z[1];
+  stat->has_gauss = 1;
+  return z[0];
+}
+
+/******************************************************************************
+Function `mt19937_fill_gaussian`:
+  Generate an array of Gaussian numbers with zero mean and unit variance, and
+  update the state. The results are identical to those of calling
+  `mt19937_get_gaussian` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of Gaussian numbers to be generated.
+******************************************************************************/
+static void mt19937_fill_gaussian(void *state, double *out, const size_t n) {
+  mt19937_state_t *stat = (mt19937_state_t *) state;
+  size_t i = 0;
+  if (!n) return;
+  if (stat->has_gauss) {
+    out[i++] = stat->gauss;
+    stat->has_gauss = 0;
+  }
+
+  /* Generate pairs in place from the uniform numbers. */
+  const size_t npair = (n - i) >> 1;
+  mt19937_fill_double_pos(state, out + i, npair << 1);
+  prand_math_kernel()->box_muller(out + i, npair);
+  i += npair << 1;
+  if (i < n) out[i] = mt19937_get_gaussian(state);
+}
+
 
 /*============================================================================*\
                          Functions for multiple streams
@@ -208,6 +404,8 @@ static inline void copy_state(mt19937_state_t *dst,
   if (dst == src) return;
   for (int i = 0; i < N; i++) dst->mt[i] = src->mt[i];
   dst->idx = src->idx;
+  dst->gauss = src->gauss;
+  dst->has_gauss = src->has_gauss;
 }
 
 /******************************************************************************
@@ -220,18 +418,7 @@ Return:
 ******************************************************************************/
 static uint32_t next_state(mt19937_state_t *s) {
   if (s->idx >= N) {            /* generate N words at one time */
-    int k;
-    uint32_t y;
-    for (k = 0; k < N - M; k++) {
-      y = UPPER_MASK(s->mt[k]) | LOWER_MASK(s->mt[k+1]);
-      s->mt[k] = s->mt[k+M] ^ (y >> 1) ^ MAGIC(y);
-    }
-    for (; k < N - 1; k++) {
-      y = UPPER_MASK(s->mt[k]) | LOWER_MASK(s->mt[k+1]);
-      s->mt[k] = s->mt[k+M-N] ^ (y >> 1) ^ MAGIC(y);
-    }
-    y = UPPER_MASK(s->mt[N-1]) | LOWER_MASK(s->mt[0]);
-    s->mt[N-1] = s->mt[M-1] ^ (y >> 1) ^ MAGIC(y);
+    mt19937_kernel()->twist(s->mt);
     s->idx = 0;
   }
   return s->mt[s->idx++];
@@ -260,22 +447,24 @@ static void recover_state(mt19937_state_t *s, const uint32_t *poly) {
 }
 
 /******************************************************************************
-Function `get_poly`:
+Function `poly_table`:
   Compute the polynomial for a given skipping step from pre-computed values.
 Arguments:
+  * `poly`:     the array for storing the polynomial, with also the temporary
+                space for multiplications, at least 11 * N words;
   * `step`:     the number of steps to be skipped.
-Return:
-  The pointer to the evaluated polynomial.
 ******************************************************************************/
-static uint32_t *get_poly(const uint64_t step) {
-  uint32_t *poly = calloc(N * 11, sizeof(uint32_t));
-  if (!poly) {
-    return NULL;
-  }
-
+static void poly_table(uint32_t *poly, const uint64_t step) {
   uint32_t *pm = poly + N;      /* 2N words for the result of multiplication */
   uint32_t *tmp = pm + (N << 1);        /* temporary array for multiplication */
 
+  /* The polynomial is simply x^step if no modular reduction is needed. */
+  if (step && step < K) {
+    memset(poly, 0, sizeof(uint32_t) * N);
+    poly[DIV_NBIT(step)] = UINT32_C(1) << MOD_NBIT(step);
+    return;
+  }
+
   /* split n with base 8 */
   int i, init;
   uint64_t n = step;
@@ -284,11 +473,11 @@ static uint32_t *get_poly(const uint64_t step) {
     int j = n & 0x07UL;
     if (j) {
       if (!init) {      /* initialise the polynomial */
-        memcpy(poly, mt19937_poly[i][j-1], sizeof(uint32_t) * N);
+        memcpy(poly, POLY_TABLE[i][j-1], sizeof(uint32_t) * N);
         init = 1;
       }
       else {            /* polynomial multiplication and modular reduction */
-        poly_mul(pm, poly, mt19937_poly[i][j-1], N, tmp);
+        poly_mul(pm, poly, POLY_TABLE[i][j-1], N, tmp);
         poly_mod_phi(pm, tmp);
         memcpy(poly, pm, sizeof(uint32_t) * N);
       }
@@ -297,24 +486,62 @@ static uint32_t *get_poly(const uint64_t step) {
     n >>= 3;
   }
 
-  if (!init) memcpy(poly, mt19937_poly[0][0], sizeof(uint32_t) * N);
-  return poly;
+  if (!init) memcpy(poly, POLY_TABLE[0][0], sizeof(uint32_t) * N);
 }
 
+#ifdef _OPENMP
 /******************************************************************************
-Function `state_forward`:
+Function `poly_seq`:
+  Compute the polynomial for skipping `i` * `step` steps. The pre-computed
+  values are used if possible, otherwise the polynomial for `step` is raised
+  to the power of `i`, with the square-and-multiply algorithm.
+Arguments:
+  * `poly`:     the array for storing the polynomial, with also the temporary
+                space for multiplications, at least 11 * N words;
+  * `base`:     the polynomial for skipping `step` steps;
+  * `step`:     the number of steps for each jump;
+  * `i`:        the number of jumps, must be positive.
+******************************************************************************/
+static void poly_seq(uint32_t *poly, const uint32_t *base, const uint64_t step,
+    const uint64_t i) {
+  if (i <= MT19937_MAX_STEP / step) {
+    poly_table(poly, i * step);
+    return;
+  }
+
+  uint32_t *pm = poly + N;
+  uint32_t *tmp = pm + (N << 1);
+  int b = 63;
+  while (!((i >> b) & 1)) b--;
+
+  memcpy(poly, base, sizeof(uint32_t) * N);
+  while (--b >= 0) {
+    poly_mul(pm, poly, poly, N, tmp);
+    poly_mod_phi(pm, tmp);
+    memcpy(poly, pm, sizeof(uint32_t) * N);
+    if ((i >> b) & 1) {
+      poly_mul(pm, poly, base, N, tmp);
+      poly_mod_phi(pm, tmp);
+      memcpy(poly, pm, sizeof(uint32_t) * N);
+    }
+  }
+}
+#endif
+
+/******************************************************************************
+Function `poly_forward`:
   Update the state with polynomial multiplication.
 Arguments:
   * `out`:      the pointer to the resulting state;
   * `in`:       the pointer to the initial state;
-  * `poly`:     the pre-computed power of minimal polynomial.
+  * `pt`:       the pre-computed power of minimal polynomial;
+  * `work`:     the temporary space for multiplications, with 10 * N words.
 ******************************************************************************/
-static void state_forward(mt19937_state_t *out, const mt19937_state_t *in,
-    uint32_t *poly) {
-  uint32_t *pt, *pm, *ph, *tmp;
+static void poly_forward(mt19937_state_t *out, const mt19937_state_t *in,
+    const uint32_t *pt, uint32_t *work) {
+  uint32_t *pm, *ph, *tmp;
 
-  pt = poly;            /* N words for storing the pre-computed polynomial */
-  pm = poly + N;        /* 2N words for the polynomial from advancing states */
+  pm = work;            /* 2N words for the polynomial from advancing states */
   ph = pm + (N << 1);   /* 3N words for the multiplication */
   tmp = ph + N * 3;     /* 5N words for temporary array */
 
@@ -337,50 +564,237 @@ static void state_forward(mt19937_state_t *out, const mt19937_state_t *in,
   recover_state(out, pm);
 }
 
+/******************************************************************************
+Function `seq_next`:
+  Append the next element to a sequence generated by the state transition.
+Arguments:
+  * `x`:        pointer to the last N elements of the sequence, followed by
+                the space for the new element.
+******************************************************************************/
+static inline void seq_next(uint32_t *x) {
+  const uint32_t y = UPPER_MASK(x[0]) | LOWER_MASK(x[1]);
+  x[N] = x[M] ^ (y >> 1) ^ ((y & 1UL) ? MA : 0);
+}
+
+/******************************************************************************
+Function `horner_step`:
+  Advance the sequence in the sliding buffer for the Horner scheme by one
+  element, and move the window back to the start of the buffer if necessary.
+Arguments:
+  * `buf`:      the buffer, with 2 * N words;
+  * `pos`:      the starting position of the window in the buffer.
+******************************************************************************/
+static inline void horner_step(uint32_t *buf, int *pos) {
+  seq_next(buf + *pos);
+  if (++(*pos) == N) {
+    memcpy(buf, buf + N, sizeof(uint32_t) * N);
+    *pos = 0;
+  }
+}
+
+/******************************************************************************
+Function `horner_forward`:
+  Update the state by applying the jump-ahead polynomial to the state
+  directly, with the sliding-window Horner scheme.
+  ref: https://doi.org/10.1287/ijoc.1070.0251
+  The state is represented by the N elements to be returned next, and the
+  polynomials of the state transition with degrees lower than `HORNER_WIN`
+  are pre-computed for the initial state.
+Arguments:
+  * `out`:      the pointer to the resulting state;
+  * `in`:       the pointer to the initial state;
+  * `pt`:       the pre-computed power of minimal polynomial;
+  * `work`:     the temporary space, with 10 * N words.
+******************************************************************************/
+static void horner_forward(mt19937_state_t *out, const mt19937_state_t *in,
+    const uint32_t *pt, uint32_t *work) {
+  uint32_t *tab = work;         /* 2^(HORNER_WIN-1) * N words for the table */
+  uint32_t *buf = tab + (N << (HORNER_WIN - 1));        /* 2N words */
+
+  /* Sequence to be returned by the initial state. */
+  copy_state(out, in);
+  for (int i = 0; i < N + HORNER_WIN - 1; i++) buf[i] = next_state(out);
+
+  /* Table of h(T) x, for all the polynomials h with the constant term 1,
+   * and degrees lower than HORNER_WIN. */
+  memcpy(tab, buf, sizeof(uint32_t) * N);
+  for (int h = 3; h < (1 << HORNER_WIN); h += 2) {
+    int k = HORNER_WIN - 1;
+    while (!((h >> k) & 1)) k--;
+    uint32_t *dst = tab + N * (h >> 1);
+    const uint32_t *src = tab + N * ((h ^ (1 << k)) >> 1);
+    for (int i = 0; i < N; i++) dst[i] = src[i] ^ buf[k + i];
+  }
+
+  /* Horner's scheme with sliding windows ending with non-zero terms. */
+  int pos = 0;
+  int i = K - 1;
+  while (i >= 0 && !COEF(pt, i)) i--;
+  memset(buf, 0, sizeof(uint32_t) * N);
+  while (i >= 0) {
+    if (!COEF(pt, i)) {
+      horner_step(buf, &pos);
+      i--;
+      continue;
+    }
+    int j = (i >= HORNER_WIN - 1) ? i - HORNER_WIN + 1 : 0;
+    while (!COEF(pt, j)) j++;
+    int h = 0;
+    for (int k = i; k >= j; k--) {
+      h = (h << 1) | COEF(pt, k);
+      horner_step(buf, &pos);
+    }
+    const uint32_t *src = tab + N * (h >> 1);
+    uint32_t *dst = buf + pos;
+    for (int k = 0; k < N; k++) dst[k] ^= src[k];
+    i = j - 1;
+  }
+
+  /* Only the lower bits of the first element are not determined by the
+   * polynomial, since they are not part of the 19937-bit state. They are
+   * recovered by inverting the state transition. */
+  uint32_t *x = buf + pos;
+  uint32_t y = x[N - 1] ^ x[M - 1];
+  y = (y & 0x80000000UL) ? ((y ^ MA) << 1) | UINT32_C(1) : y << 1;
+  for (int k = 1; k < N; k++) out->mt[k] = x[k];
+  out->mt[0] = UPPER_MASK(x[0]) | LOWER_MASK(y);
+  out->idx = 0;
+}
+
+/******************************************************************************
+Function `poly_terms`:
+  Count the number of non-zero terms of a polynomial.
+Arguments:
+  * `poly`:     the polynomial, with N words.
+Return:
+  The number of non-zero coefficients.
+******************************************************************************/
+static int poly_terms(const uint32_t *poly) {
+  int num = 0;
+  for (int i = 0; i < N; i++) {
+    uint32_t x = poly[i];
+    x = x - ((x >> 1) & UINT32_C(0x55555555));
+    x = (x & UINT32_C(0x33333333)) + ((x >> 2) & UINT32_C(0x33333333));
+    x = (x + (x >> 4)) & UINT32_C(0x0f0f0f0f);
+    num += (x * UINT32_C(0x01010101)) >> 24;
+  }
+  return num;
+}
+
+/******************************************************************************
+Function `state_forward`:
+  Update the state with the jump-ahead polynomial, using the faster one of
+  the polynomial multiplication and the sliding-window Horner scheme.
+  The cost of the Horner scheme scales with the number of non-zero terms of
+  the polynomial, while the multiplication is faster for dense polynomials
+  only if the carry-less multiply instructions are available.
+Arguments:
+  * `out`:      the pointer to the resulting state;
+  * `in`:       the pointer to the initial state;
+  * `pt`:       the pre-computed power of minimal polynomial;
+  * `work`:     the temporary space, with 10 * N words.
+******************************************************************************/
+static void state_forward(mt19937_state_t *out, const mt19937_state_t *in,
+    const uint32_t *pt, uint32_t *work) {
+  if (!poly_mul_clmul() || poly_terms(pt) <= HORNER_MAX_TERMS)
+    horner_forward(out, in, pt, work);
+  else poly_forward(out, in, pt, work);
+
+  /* The cached Gaussian number does not belong to the new position. */
+  out->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `cached_poly`:
+  Retrieve the jump-ahead polynomial from the cache of the interface, and
+  evaluate it with the workspace of the cache if it is not cached.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     the number of steps to be skipped, must be positive.
+Return:
+  The pointer to the polynomial with N words, owned by the cache.
+******************************************************************************/
+static const uint32_t *cached_poly(prand_t *rng, const uint64_t step) {
+  prand_cache_t *cache = (prand_cache_t *) rng->cache;
+  uint32_t *poly = prand_cache_find(cache, step);
+  if (poly) return poly;
+
+  PRAND_STATS_POLY(&rng->stats, poly_table(cache->work, step));
+  poly = prand_cache_insert(cache, step);
+  memcpy(poly, cache->work, sizeof(uint32_t) * N);
+  return poly;
+}
+
 /******************************************************************************
 Function `mt19937_jump_seq`:
   Jump ahead in sequence for each stream.
   It is supposed to be called only at initialisation.
+  If the library is compiled with OpenMP, the streams are initialised in
+  parallel, and the results are identical to the serial version.
 Arguments:
   * `state`:            the state array for multiple streams;
   * `init_state`:       the pointer to the initial state;
   * `nstream`:          total number of streams;
   * `step`:             step size for jumping ahead;
+  * `poly`:             the jump-ahead polynomial for `step`;
+  * `work`:             the workspace for multiplications, with 10 * N words;
   * `err`:              an integer for storing the error message.
 ******************************************************************************/
 static void mt19937_jump_seq(void **state, const void *init_state,
-    const unsigned int nstream, const uint64_t step, int *err) {
+    const unsigned int nstream, const uint64_t step, const uint32_t *poly,
+    uint32_t *work, int *err) {
   mt19937_state_t **stat = (mt19937_state_t **) state;
   mt19937_state_t *istat = (mt19937_state_t *) init_state;
-  uint32_t *poly;
 
   if (PRAND_IS_ERROR(*err)) return;
   /* fill state[0] with init_state */
   copy_state(stat[0], istat);
 
-  /* check of the upper limit should be done before calling this function */
-  if (!step) {
-    for (unsigned int i = 1; i < nstream; i++) copy_state(stat[i], stat[i - 1]);
-    return;
-  }
-
-  /* jump-ahead polynomial */
-  poly = get_poly(step);
-  if (!poly) {
-    *err = PRAND_ERR_MEMORY_JUMP;
+#ifdef _OPENMP
+  /* Split the streams into contiguous chunks for different threads. The
+   * first state of every chunk is computed directly from the initial state,
+   * and the rest ones are advanced successively. */
+  if (nstream >= JUMP_SEQ_PAR_MIN && omp_get_max_threads() > 1
+      && !omp_in_parallel()) {
+    int fail = 0;
+#pragma omp parallel
+    {
+      const uint64_t nt = omp_get_num_threads();
+      const uint64_t id = omp_get_thread_num();
+      unsigned int lo = 1 + (nstream - 1) * id / nt;
+      unsigned int hi = 1 + (nstream - 1) * (id + 1) / nt;
+      /* 11N words for the first polynomial, and 10N words for the
+       * multiplications. */
+      uint32_t *ply = (lo < hi) ? malloc(sizeof(uint32_t) * N * 21) : NULL;
+      if (lo < hi && !ply) {
+#pragma omp atomic write
+        fail = 1;
+      }
+      else if (lo < hi) {
+        uint32_t *work = ply + N * 11;
+        poly_seq(ply, poly, step, lo);
+        state_forward(stat[lo], istat, ply, work);
+        for (unsigned int i = lo + 1; i < hi; i++)
+          state_forward(stat[i], stat[i - 1], poly, work);
+        free(ply);
+      }
+    }
+    if (fail) *err = PRAND_ERR_MEMORY_JUMP;
     return;
   }
+#else
+  (void) step;
+#endif
 
   /* Advance states with the polynomial. */
   for (unsigned int i = 1; i < nstream; i++)
-    state_forward(stat[i], stat[i - 1], poly);
-
-  free(poly);
+    state_forward(stat[i], stat[i - 1], poly, work);
 }
 
 /******************************************************************************
 Function `mt19937_jump`:
-  Jump ahead for one stream.
+  Jump ahead for one stream. The workspace is allocated on the stack, so
+  that different streams can jump concurrently without touching the heap.
 Arguments:
   * `state`:    the current state (to be over-written);
   * `step`:     step size for jumping ahead;
@@ -395,23 +809,23 @@ static void mt19937_jump(void *state, const uint64_t step, int *err) {
     *err = PRAND_ERR_STEP;
     return;
   }
+  if (POLY_LOAD(step >= K, err)) return;
 
-  /* jump-ahead polynomial */
-  uint32_t *poly = get_poly(step);
-  if (!poly) {
-    *err = PRAND_ERR_MEMORY_JUMP;
-    return;
-  }
+  /* jump-ahead polynomial, followed by the workspace for multiplications */
+  uint32_t poly[N * 11];
+  PRAND_STATS_POLY(PRAND_STATS_STREAM(stat, sizeof(mt19937_state_t)),
+      poly_table(poly, step));
 
   /* Advance states with the polynomial. */
-  state_forward(stat, stat, poly);
-
-  free(poly);
+  state_forward(stat, stat, poly, poly + N);
 }
 
 /******************************************************************************
 Function `mt19937_jump_all`:
   Jump ahead the same number of steps for all streams.
+  If the library is compiled with OpenMP, the streams are distributed over
+  threads, which share the cached polynomial, with their own workspaces on
+  the stack.
 Arguments:
   * `rng`:      the random number generator interface;
   * `step`:     step size for jumping ahead;
@@ -425,20 +839,93 @@ static void mt19937_jump_all(prand_t *rng, const uint64_t step, int *err) {
     *err = PRAND_ERR_STEP;
     return;
   }
+  if (POLY_LOAD(step >= K, err)) return;
 
   /* jump-ahead polynomial */
-  uint32_t *poly = get_poly(step);
-  if (!poly) {
-    *err = PRAND_ERR_MEMORY_JUMP;
+  const uint32_t *poly = cached_poly(rng, step);
+  mt19937_state_t **stat = (mt19937_state_t **) rng->state_stream;
+
+#ifdef _OPENMP
+  if (rng->nstream >= JUMP_ALL_PAR_MIN && omp_get_max_threads() > 1
+      && !omp_in_parallel()) {
+#pragma omp parallel
+    {
+      uint32_t work[N * 10];
+#pragma omp for schedule(static)
+      for (int i = 0; i < rng->nstream; i++)
+        state_forward(stat[i], stat[i], poly, work);
+    }
     return;
   }
+#endif
 
   /* Advance states with the polynomial. */
+  uint32_t *work = ((prand_cache_t *) rng->cache)->work;
   for (int i = 0; i < rng->nstream; i++)
-    state_forward(((mt19937_state_t **) (rng->state_stream))[i],
-        ((mt19937_state_t **) (rng->state_stream))[i], poly);
+    state_forward(stat[i], stat[i], poly, work);
+}
+
+/******************************************************************************
+Function `mt19937_jump_prepare`:
+  Pre-compute the jump-ahead polynomial for a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  The pre-computed jump on success; NULL on error.
+******************************************************************************/
+static prand_jump_t *mt19937_jump_prepare(prand_t *rng, const uint64_t step,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (step > MT19937_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return NULL;
+  }
+
+  prand_jump_t *jmp = malloc(sizeof(prand_jump_t));
+  if (!jmp) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return NULL;
+  }
+  jmp->type = PRAND_RNG_MT19937;
+  jmp->step = step;
+  jmp->data = NULL;
+  if (!step) return jmp;
+  if (POLY_LOAD(step >= K, err)) {
+    free(jmp);
+    return NULL;
+  }
+
+  if (!(jmp->data = malloc(sizeof(uint32_t) * N))) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    free(jmp);
+    return NULL;
+  }
+  memcpy(jmp->data, cached_poly(rng, step), sizeof(uint32_t) * N);
+  return jmp;
+}
+
+/******************************************************************************
+Function `mt19937_jump_apply`:
+  Jump ahead for one stream, with a pre-computed jump. The workspace is
+  allocated on the stack, as for `mt19937_jump`.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `jmp`:      the pre-computed jump;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void mt19937_jump_apply(void *state, const prand_jump_t *jmp,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (jmp->type != PRAND_RNG_MT19937) {
+    *err = PRAND_ERR_JUMP_TYPE;
+    return;
+  }
+  if (!jmp->step) return;
 
-  free(poly);
+  uint32_t work[N * 10];
+  state_forward(state, state, jmp->data, work);
 }
 
 /******************************************************************************
@@ -464,6 +951,37 @@ static void mt19937_reset(void *state, const uint64_t seed,
   mt19937_jump(stat, step, err);
 }
 
+/******************************************************************************
+Function `mt19937_spread`:
+  Initialise the states of all streams from the seeded first stream, with
+  the starting points separated by a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void mt19937_spread(prand_t *rng, const uint64_t step, int *err) {
+  mt19937_state_t *stat = (mt19937_state_t *) (rng->state);
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (!step) {
+    for (int i = 1; i < rng->nstream; i++)
+      memcpy(rng->state_stream[i], stat, sizeof(mt19937_state_t));
+    return;
+  }
+
+  /* The multiples of the step are also needed for parallel initialisation. */
+  if (POLY_LOAD(step >= K || rng->nstream > 1, err)) return;
+
+  /* jump-ahead polynomial */
+  const uint32_t *poly = cached_poly(rng, step);
+  uint32_t *work = ((prand_cache_t *) rng->cache)->work;
+
+  if (rng->nstream <= 1) state_forward(stat, stat, poly, work);
+  else mt19937_jump_seq(rng->state_stream, stat, rng->nstream, step, poly,
+      work, err);
+}
+
 /******************************************************************************
 Function `mt19937_reset_all`:
   Reset the state for all streams, with a given seed and number of skip steps.
@@ -484,21 +1002,114 @@ static void mt19937_reset_all(prand_t *rng, const uint64_t seed,
   }
   else mt19937_seed(stat, seed);
 
-  if (!step) {
-    for (int i = 1; i < rng->nstream; i++)
-      memcpy(rng->state_stream[i], stat, sizeof(mt19937_state_t));
-    return;
-  }
-  else if (step > MT19937_MAX_STEP) {
+  if (step > MT19937_MAX_STEP) {
     *err = PRAND_ERR_STEP;
     return;
   }
+  mt19937_spread(rng, step, err);
+}
+
+/******************************************************************************
+Macro `MT19937_FILL_ALL`:
+  Generate numbers from all streams in lock-step. The i-th number of the
+  s-th stream is stored as the (i * nstream + s)-th element of the output
+  array. Since the tempering is already vectorised within each stream, the
+  streams are processed one after another, with blocks of the state arrays
+  tempered into a buffer before being scattered to the output array.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream;
+  * `type`:     data type of the outputs;
+  * `temper`:   the kernel for tempering the words.
+******************************************************************************/
+#define MT19937_FILL_ALL(rng, out, n, type, temper) {                   \
+  const mt19937_kernel_t *kernel = mt19937_kernel();                    \
+  const size_t ns = (rng)->nstream;                                     \
+  type buf[N];                                                          \
+  for (size_t s = 0; s < ns; s++) {                                     \
+    mt19937_state_t *stat = (mt19937_state_t *) (rng)->state_stream[s]; \
+    size_t i = 0;                                                       \
+    while (i < (n)) {                                                   \
+      size_t len = (n) - i;                                             \
+      const uint32_t *mt = mt19937_block(stat, kernel, &len);           \
+      kernel->temper(buf, mt, len);                                     \
+      for (size_t j = 0; j < len; j++) (out)[(i + j) * ns + s] = buf[j]; \
+      i += len;                                                         \
+    }                                                                   \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `mt19937_fill_all`:
+  Generate integers from all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated for each stream.
+******************************************************************************/
+static void mt19937_fill_all(prand_t *rng, uint64_t *out, const size_t n) {
+  MT19937_FILL_ALL(rng, out, n, uint64_t, temper);
+}
+
+/******************************************************************************
+Function `mt19937_fill_all_double`:
+  Generate double-precision floating-point numbers in the range [0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mt19937_fill_all_double(prand_t *rng, double *out,
+    const size_t n) {
+  MT19937_FILL_ALL(rng, out, n, double, temper_double);
+}
+
+/******************************************************************************
+Function `mt19937_fill_all_double_pos`:
+  Generate double-precision floating-point numbers in the range (0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mt19937_fill_all_double_pos(prand_t *rng, double *out,
+    const size_t n) {
+  MT19937_FILL_ALL(rng, out, n, double, temper_double_pos);
+}
 
-  if (rng->nstream <= 1) mt19937_jump(stat, step, err);
-  else mt19937_jump_seq(rng->state_stream, stat, rng->nstream, step, err);
+/******************************************************************************
+Function `mt19937_fill_all_double53`:
+  Generate double-precision floating-point numbers in the range [0,1), with
+  53-bit resolution, from all streams in lock-step.
+  The streams are processed one after another, with the outputs of every
+  stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void mt19937_fill_all_double53(prand_t *rng, double *out,
+    const size_t n) {
+  const size_t ns = rng->nstream;
+  for (size_t s = 0; s < ns; s++) {
+    mt19937_state_t *stat = (mt19937_state_t *) rng->state_stream[s];
+    MT19937_FILL53(stat, out + s, n, ns);
+  }
 }
 
 
+/*============================================================================*\
+                     Wrappers of the functions with counters
+\*============================================================================*/
+
+/* The wrappers are defined only if the library is compiled with
+ * `-DPRAND_STATS`, see `prand_stats.h`. */
+PRAND_STATS_FUNCS(mt19937, mt19937_state_t, PRAND_RNG_MT19937)
+
+
 /*============================================================================*\
                           Interface for initialisation
 \*============================================================================*/
@@ -536,29 +1147,54 @@ prand_t *mt19937_init(const uint64_t seed, const unsigned int nstream,
     return NULL;
   }
 
-  mt19937_state_t *states =  malloc(sizeof(mt19937_state_t) * numstr);
+  void *states = prand_state_alloc(rng->state_stream, sizeof(mt19937_state_t),
+      numstr, PRAND_PAGE_SIZE);
   if (!states) {
     free(rng->state_stream);
     free(rng);
     *err = PRAND_ERR_MEMORY;
     return NULL;
   }
-  for (unsigned int i = 0; i < numstr; i++)
-    rng->state_stream[i] = states + i;
+
+  rng->cache = prand_cache_init(sizeof(uint32_t) * N,
+      sizeof(uint32_t) * N * 11);
+  if (!rng->cache) {
+    prand_state_free(states);
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
 
   rng->state = rng->state_stream[0];
+  rng->substream = NULL;
+  PRAND_STATS_CLEAR(rng);
   rng->nstream = numstr;
   rng->type = PRAND_RNG_MT19937;
   rng->min = 0;
   rng->max = 0xffffffffUL;      /* 2^32 - 1 */
+  rng->ndraw53 = 2;
 
   rng->get = &mt19937_get;
   rng->get_double = &mt19937_get_double;
   rng->get_double_pos = &mt19937_get_double_pos;
+  rng->get_double53 = &mt19937_get_double53;
+  rng->fill = &mt19937_fill;
+  rng->fill_double = &mt19937_fill_double;
+  rng->fill_double_pos = &mt19937_fill_double_pos;
+  rng->fill_double53 = &mt19937_fill_double53;
+  rng->get_gaussian = &mt19937_get_gaussian;
+  rng->fill_gaussian = &mt19937_fill_gaussian;
+  rng->fill_all = &mt19937_fill_all;
+  rng->fill_all_double = &mt19937_fill_all_double;
+  rng->fill_all_double_pos = &mt19937_fill_all_double_pos;
+  rng->fill_all_double53 = &mt19937_fill_all_double53;
   rng->reset = &mt19937_reset;
   rng->reset_all = &mt19937_reset_all;
   rng->jump = &mt19937_jump;
   rng->jump_all = &mt19937_jump_all;
+  rng->jump_prepare = &mt19937_jump_prepare;
+  rng->jump_apply = &mt19937_jump_apply;
 
   if (seed == 0) {
     *err = PRAND_WARN_SEED;
@@ -566,11 +1202,9 @@ prand_t *mt19937_init(const uint64_t seed, const unsigned int nstream,
   }
   else mt19937_seed(rng->state, seed);
 
-  if (nstream <= 1)
-    mt19937_jump(rng->state, step, err);
-  else
-    mt19937_jump_seq(rng->state_stream, rng->state, nstream, step, err);
+  mt19937_spread(rng, step, err);
 
+  PRAND_STATS_WRAP(rng, mt19937);
   return rng;
 }
 
@@ -29,6 +29,7 @@
 *******************************************************************************/
 
 #include "mt19937.h"
+#include "prand_cpu.h"
 #include <string.h>
 
 /*============================================================================*\
@@ -38,6 +39,27 @@
 /* Maximum number of words for the expanded multiplication functions. */
 #define EXPD_MUL_THRES  6
 
+/* Minimum number of words for the Toom-Cook 3-way multiplication, with the
+   bitwise and carry-less multiplication base cases, respectively.
+   The Toom-Cook algorithm is disabled if the threshold is 0.
+   The defaults are the fastest for the 624-word polynomials of MT19937 in
+   the `poly_mul` rows of `make bench`: with the carry-less base case, the
+   Karatsuba algorithm is faster than any Toom-Cook layer. */
+#ifndef TOOM3_MUL_THRES
+  #define TOOM3_MUL_THRES       48
+#endif
+#ifndef TOOM3_CLMUL_THRES
+  #define TOOM3_CLMUL_THRES     0
+#endif
+#if (TOOM3_MUL_THRES != 0 && TOOM3_MUL_THRES < 12) || \
+    (TOOM3_CLMUL_THRES != 0 && TOOM3_CLMUL_THRES < 12)
+  #error the thresholds of the Toom-Cook multiplication must be 0 or >= 12
+#endif
+
+/* The thresholds in use, which can be overridden by `poly_mul_toom3`. */
+static unsigned int toom3_mul_thres = TOOM3_MUL_THRES;
+static unsigned int toom3_clmul_thres = TOOM3_CLMUL_THRES;
+
 /* Lookup table for the grade-school multiplication algorithm. */
 static const uint32_t WORD_MASK[2] = {UINT32_C(0), UINT32_C(0xffffffff)};
 
@@ -216,6 +238,119 @@ static void kara_mul6(uint32_t *r, const uint32_t *a, const uint32_t *b,
   r[8] ^= tmp[2] ^ r[11];
 }
 
+/*============================================================================*\
+        Multiplication with hardware carry-less multiply instructions
+\*============================================================================*/
+
+/*******************************************************************************
+  With the PCLMULQDQ instruction on x86 or the PMULL instruction on AArch64,
+  the product of two 64-bit polynomials is evaluated by a single instruction.
+  Pairs of 32-bit words are then treated as 64-bit words, which is valid for
+  the little-endian byte order, and the short polynomials are multiplied with
+  the grade-school algorithm. These are used as the base case of the
+  Karatsuba algorithm, and are selected at runtime on x86 machines.
+*******************************************************************************/
+
+#if defined(PRAND_SIMD_NEON) && !defined(__AARCH64EB__) && \
+    (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+  #define PRAND_CLMUL_NEON
+#endif
+
+/* Maximum number of 32-bit words for the carry-less multiplication. */
+#ifndef CLMUL_MUL_THRES
+  #define CLMUL_MUL_THRES       24
+#endif
+
+#if defined(PRAND_SIMD_X86) || defined(PRAND_CLMUL_NEON)
+/******************************************************************************
+Function `load_limbs`:
+  Convert a polynomial with 32-bit words into 64-bit words.
+Arguments:
+  * `r`:        pointer to the result, with at least (`n` + 1) / 2 words;
+  * `a`:        pointer to the polynomial;
+  * `n`:        the length of `a` (in 32-bit words).
+******************************************************************************/
+static inline void load_limbs(uint64_t *r, const uint32_t *a,
+    const unsigned int n) {
+  r[(n - 1) >> 1] = 0;
+  memcpy(r, a, sizeof(uint32_t) * n);
+}
+#endif
+
+#ifdef PRAND_SIMD_X86
+/******************************************************************************
+Function `clmul_mul`:
+  Compute r = a * b, where a and b contain both n words, using the
+  carry-less multiply instructions.
+Arguments:
+  * `r`:        pointer to the result, with at least 2 * `n` words;
+  * `a`, `b`:   pointers to the two multipliers, each with `n` words;
+  * `n`:        the length of `a` and `b` (in words), at most
+                `CLMUL_MUL_THRES`.
+******************************************************************************/
+PRAND_TARGET("pclmul,sse2")
+static void clmul_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+    const unsigned int n) {
+  const unsigned int nl = (n + 1) >> 1;         /* number of 64-bit words */
+  uint64_t la[CLMUL_MUL_THRES / 2 + 1], lb[CLMUL_MUL_THRES / 2 + 1];
+  uint64_t out[CLMUL_MUL_THRES + 2];
+  __m128i acc[CLMUL_MUL_THRES + 1];
+
+  load_limbs(la, a, n);
+  load_limbs(lb, b, n);
+  for (unsigned int k = 0; k < 2 * nl - 1; k++) acc[k] = _mm_setzero_si128();
+  for (unsigned int i = 0; i < nl; i++) {
+    __m128i x = _mm_loadl_epi64((const __m128i *) (la + i));
+    for (unsigned int j = 0; j < nl; j++) {
+      __m128i y = _mm_loadl_epi64((const __m128i *) (lb + j));
+      acc[i + j] = _mm_xor_si128(acc[i + j], _mm_clmulepi64_si128(x, y, 0));
+    }
+  }
+
+  /* Combine the overlapping 128-bit partial products. */
+  out[0] = 0;
+  for (unsigned int k = 0; k < 2 * nl - 1; k++) {
+    uint64_t t[2];
+    _mm_storeu_si128((__m128i *) t, acc[k]);
+    out[k] ^= t[0];
+    out[k + 1] = t[1];
+  }
+  memcpy(r, out, sizeof(uint32_t) * 2 * n);
+}
+#elif defined(PRAND_CLMUL_NEON)
+static void clmul_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+    const unsigned int n) {
+  const unsigned int nl = (n + 1) >> 1;         /* number of 64-bit words */
+  uint64_t la[CLMUL_MUL_THRES / 2 + 1], lb[CLMUL_MUL_THRES / 2 + 1];
+  uint64_t out[CLMUL_MUL_THRES + 2];
+  uint64x2_t acc[CLMUL_MUL_THRES + 1];
+
+  load_limbs(la, a, n);
+  load_limbs(lb, b, n);
+  for (unsigned int k = 0; k < 2 * nl - 1; k++) acc[k] = vdupq_n_u64(0);
+  for (unsigned int i = 0; i < nl; i++) {
+    for (unsigned int j = 0; j < nl; j++) {
+      uint64x2_t p = vreinterpretq_u64_p128(vmull_p64((poly64_t) la[i],
+            (poly64_t) lb[j]));
+      acc[i + j] = veorq_u64(acc[i + j], p);
+    }
+  }
+
+  /* Combine the overlapping 128-bit partial products. */
+  out[0] = 0;
+  for (unsigned int k = 0; k < 2 * nl - 1; k++) {
+    out[k] ^= vgetq_lane_u64(acc[k], 0);
+    out[k + 1] = vgetq_lane_u64(acc[k], 1);
+  }
+  memcpy(r, out, sizeof(uint32_t) * 2 * n);
+}
+#endif
+
+
+/*============================================================================*\
+                          Dispatch of the multiplication
+\*============================================================================*/
+
 /******************************************************************************
 Function `kara_mul`:
   Compute r = a * b, where a and b contain both n words,
@@ -278,6 +413,184 @@ static void kara_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
   }
 }
 
+/******************************************************************************
+Function `toom3_eval_x`:
+  Evaluate a(X) = a0 + a1 * X + a2 * X^2 at X = x, where a0 and a1 contain
+    k words, and a2 contains n2 words.
+Arguments:
+  * `r`:        pointer to the result, with at least `k` + 1 words;
+  * `a`:        pointer to the polynomial, with 2 * `k` + `n2` words;
+  * `k`:        the length of a0 and a1 (in words);
+  * `n2`:       the length of a2 (in words), no larger than `k`.
+******************************************************************************/
+static inline void toom3_eval_x(uint32_t *r, const uint32_t *a,
+    const unsigned int k, const unsigned int n2) {
+  const uint32_t *a1 = a + k;
+  const uint32_t *a2 = a1 + k;
+  uint32_t c1 = 0, c2 = 0;      /* bits shifted out of the previous words */
+  unsigned int i;
+
+  for (i = 0; i < n2; i++) {
+    r[i] = a[i] ^ (a1[i] << 1) ^ c1 ^ (a2[i] << 2) ^ c2;
+    c1 = a1[i] >> 31;
+    c2 = a2[i] >> 30;
+  }
+  for (; i < k; i++) {
+    r[i] = a[i] ^ (a1[i] << 1) ^ c1 ^ c2;
+    c1 = a1[i] >> 31;
+    c2 = 0;
+  }
+  r[k] = c1 ^ c2;
+}
+
+/******************************************************************************
+Function `toom3_div_x`:
+  Compute a = a / x, where a is divisible by x.
+Arguments:
+  * `a`:        pointer to the polynomial;
+  * `n`:        the length of `a` (in words).
+******************************************************************************/
+static inline void toom3_div_x(uint32_t *a, const unsigned int n) {
+  for (unsigned int i = 0; i < n - 1; i++)
+    a[i] = (a[i] >> 1) | (a[i + 1] << 31);
+  a[n - 1] >>= 1;
+}
+
+/******************************************************************************
+Function `toom3_div_x1`:
+  Compute a = a / (x + 1), where a is divisible by x + 1.
+Arguments:
+  * `a`:        pointer to the polynomial;
+  * `n`:        the length of `a` (in words).
+******************************************************************************/
+static inline void toom3_div_x1(uint32_t *a, const unsigned int n) {
+  /* The coefficients of the quotient are prefix sums of the coefficients
+     of the dividend, i.e., q_i = a_i + q_{i-1}. */
+  uint32_t c = 0;
+  for (unsigned int i = 0; i < n; i++) {
+    uint32_t q = a[i];
+    q ^= q << 1;
+    q ^= q << 2;
+    q ^= q << 4;
+    q ^= q << 8;
+    q ^= q << 16;
+    q ^= c;
+    a[i] = q;
+    c = WORD_MASK[q >> 31];
+  }
+}
+
+/******************************************************************************
+Function `toom3_mul`:
+  Compute r = a * b, where a and b contain both n words,
+    using the Toom-Cook 3-way algorithm.
+  The multipliers are split as a = a0 + a1 * X + a2 * X^2, with X = x^(32k),
+  and the product is evaluated at X = 0, 1, x, x + 1, and infinity.
+  See Bodrato 2007, Towards Optimal Toom-Cook Multiplication for Univariate
+  and Multivariate Polynomials in Characteristic 2 and 0 (WAIFI 2007).
+Arguments:
+  * `r`:        pointer to the result, with at least 2 * `n` words;
+  * `a`, `b`:   pointers to the two multipliers, each with `n` words;
+  * `n`:        the length of `a` and `b` (in words);
+  * `tmp`:      a temporary array with a rough requirement of 4 * `n` words.
+******************************************************************************/
+static void toom3_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
+    const unsigned int n, uint32_t *tmp) {
+  unsigned int i;
+  const unsigned int k = (n + 2) / 3;           /* ceil(n / 3) */
+  const unsigned int n2 = n - (k << 1);         /* length of a2 and b2 */
+  const unsigned int m = (k << 1) + 2;          /* length of W(x), W(x+1) */
+  const uint32_t *a1 = a + k;
+  const uint32_t *a2 = a1 + k;
+  const uint32_t *b1 = b + k;
+  const uint32_t *b2 = b1 + k;
+  uint32_t *c0 = r;                             /* lowest part of r */
+  uint32_t *c1 = r + (k << 1);                  /* W(1), and then c1 */
+  uint32_t *c4 = c1 + (k << 1);                 /* highest part of r */
+  const unsigned int lc3 = (k << 1) < (n << 1) - 3 * k ?
+      (k << 1) : (n << 1) - 3 * k;              /* length of c3 */
+
+  /* Temporary variables for evaluation and interpolation. */
+  uint32_t *ea = tmp;
+  uint32_t *eb = ea + k + 1;
+  uint32_t *wx = eb + k + 1;
+  uint32_t *wx1 = wx + m;
+
+  /* Temporary array for recursive calls, starting from (tmp + 3 * m) */
+  tmp = wx1 + m;
+
+  /* W(0) = a0 * b0, W(inf) = a2 * b2 */
+  poly_mul(c0, a, b, k, tmp);
+  poly_mul(c4, a2, b2, n2, tmp);
+
+  /* W(1) = (a0 + a1 + a2) * (b0 + b1 + b2) */
+  for (i = 0; i < n2; i++) {
+    ea[i] = a[i] ^ a1[i] ^ a2[i];
+    eb[i] = b[i] ^ b1[i] ^ b2[i];
+  }
+  for (; i < k; i++) {
+    ea[i] = a[i] ^ a1[i];
+    eb[i] = b[i] ^ b1[i];
+  }
+  poly_mul(c1, ea, eb, k, tmp);
+
+  /* W(x) = a(x) * b(x) */
+  toom3_eval_x(ea, a, k, n2);
+  toom3_eval_x(eb, b, k, n2);
+  poly_mul(wx, ea, eb, k + 1, tmp);
+
+  /* W(x+1) = a(x+1) * b(x+1), with a(x+1) = a(x) + a1 + a2 */
+  for (i = 0; i < n2; i++) {
+    ea[i] ^= a1[i] ^ a2[i];
+    eb[i] ^= b1[i] ^ b2[i];
+  }
+  for (; i < k; i++) {
+    ea[i] ^= a1[i];
+    eb[i] ^= b1[i];
+  }
+  poly_mul(wx1, ea, eb, k + 1, tmp);
+
+  /* Interpolation: W(1) + c0 + c4 = c1 + c2 + c3 */
+  for (i = 0; i < (k << 1); i++) c1[i] ^= c0[i];
+  for (i = 0; i < (n2 << 1); i++) c1[i] ^= c4[i];
+
+  /* P = (W(x) + c0 + c4 * x^4) / x = c1 + c2 * x + c3 * x^2,
+     Q = (W(x+1) + c0 + c4 * (x^4 + 1)) / (x + 1)
+       = c1 + c2 * (x + 1) + c3 * (x + 1)^2 */
+  for (i = 0; i < (k << 1); i++) {
+    wx[i] ^= c0[i];
+    wx1[i] ^= c0[i];
+  }
+  uint32_t c = 0;
+  for (i = 0; i < (n2 << 1); i++) {
+    const uint32_t s = (c4[i] << 4) ^ c;
+    c = c4[i] >> 28;
+    wx[i] ^= s;
+    wx1[i] ^= s ^ c4[i];
+  }
+  wx[i] ^= c;
+  wx1[i] ^= c;
+  toom3_div_x(wx, m);
+  toom3_div_x1(wx1, m);
+
+  /* S = P + Q = c2 + c3, and then c1 = W(1) + c0 + c4 + S */
+  for (i = 0; i < m; i++) wx1[i] ^= wx[i];
+  for (i = 0; i < (k << 1); i++) c1[i] ^= wx1[i];
+
+  /* c3 = ((P + c1) / x + S) / (x + 1), and then c2 = S + c3 */
+  for (i = 0; i < (k << 1); i++) wx[i] ^= c1[i];
+  toom3_div_x(wx, m);
+  for (i = 0; i < m; i++) wx[i] ^= wx1[i];
+  toom3_div_x1(wx, m);
+  for (i = 0; i < m; i++) wx1[i] ^= wx[i];
+
+  /* Combination: r = c0 + c1 * X + c2 * X^2 + c3 * X^3 + c4 * X^4 */
+  memcpy(ea, c1, (k << 1) * sizeof(uint32_t));
+  memcpy(c1, wx1, (k << 1) * sizeof(uint32_t));
+  for (i = 0; i < (k << 1); i++) r[k + i] ^= ea[i];
+  for (i = 0; i < lc3; i++) r[3 * k + i] ^= wx[i];
+}
+
 /******************************************************************************
 Function `poly_mul`:
   Compute r = a * b, where a and b contain both n words,
@@ -287,11 +600,25 @@ Arguments:
   * `a`, `b`:   pointers to the two multipliers, each with `n` words;
   * `n`:        the length of `a` and `b` (in words);
   * `tmp`:      a temporary array with a rough requirement of 4 * `n` words.
-TODO:
-  Include the toom-3 algorithm for long polynomials.
 ******************************************************************************/
 void poly_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
     const unsigned int n, uint32_t *tmp) {
+  unsigned int toom3_thres = toom3_mul_thres;
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("pclmul")) {
+    if (n <= CLMUL_MUL_THRES) {
+      clmul_mul(r, a, b, n);
+      return;
+    }
+    toom3_thres = toom3_clmul_thres;
+  }
+#elif defined(PRAND_CLMUL_NEON)
+  if (n <= CLMUL_MUL_THRES) {
+    clmul_mul(r, a, b, n);
+    return;
+  }
+  toom3_thres = toom3_clmul_thres;
+#endif
   if (n <= EXPD_MUL_THRES) {
     switch (n) {
       case 1:
@@ -316,7 +643,66 @@ void poly_mul(uint32_t *r, const uint32_t *a, const uint32_t *b,
         return;
     }
   }
-  kara_mul(r, a, b, n, tmp);
+  if (toom3_thres && n >= toom3_thres) toom3_mul(r, a, b, n, tmp);
+  else kara_mul(r, a, b, n, tmp);
+}
+
+/******************************************************************************
+Function `poly_mul_clmul`:
+  Check whether the carry-less multiply instructions are used for the
+  polynomial multiplications.
+Return:
+  1 if the instructions are used, and 0 otherwise.
+******************************************************************************/
+int poly_mul_clmul(void) {
+#if defined(PRAND_SIMD_X86)
+  return PRAND_CPU_HAS("pclmul") ? 1 : 0;
+#elif defined(PRAND_CLMUL_NEON)
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+/******************************************************************************
+Function `poly_mul_toom3`:
+  Set the minimum number of words for the Toom-Cook 3-way multiplication,
+  with the base case in use, for benchmarks and tests. It is not thread-safe.
+Arguments:
+  * `thres`:    the threshold, 0 for disabling the Toom-Cook algorithm, and
+                values between 1 and 11 are raised to 12.
+Return:
+  The previous threshold.
+******************************************************************************/
+unsigned int poly_mul_toom3(unsigned int thres) {
+  unsigned int *cur = &toom3_mul_thres;
+  if (poly_mul_clmul()) cur = &toom3_clmul_thres;
+  if (thres && thres < 12) thres = 12;
+  const unsigned int prev = *cur;
+  *cur = thres;
+  return prev;
+}
+
+/******************************************************************************
+Function `poly_mul_school`:
+  Compute r = a * b, where a and b contain both n words,
+    using the grade-school multiplication algorithm, as a reference.
+Arguments:
+  * `r`:        pointer to the result, with at least 2 * `n` words;
+  * `a`, `b`:   pointers to the two multipliers, each with `n` words;
+  * `n`:        the length of `a` and `b` (in words).
+******************************************************************************/
+void poly_mul_school(uint32_t *r, const uint32_t *a, const uint32_t *b,
+    const unsigned int n) {
+  uint32_t t[2];
+  memset(r, 0, sizeof(uint32_t) * (n << 1));
+  for (unsigned int i = 0; i < n; i++) {
+    for (unsigned int j = 0; j < n; j++) {
+      poly_mul1(t, a[i], b[j]);
+      r[i + j] ^= t[0];
+      r[i + j + 1] ^= t[1];
+    }
+  }
 }
 
 /******************************************************************************
@@ -409,7 +795,7 @@ static inline void copy_bits(uint32_t *restrict r, const uint32_t *restrict a,
     for (i = 0; i < n; i++)
       r[i] = (a[i] >> left) | (a[i+1] << right);
   }
-  else memcpy(r, a, MUL_NBIT(n));
+  else memcpy(r, a, sizeof(uint32_t) * n);
 
   if ((i = MOD_NBIT(len))) {            /* the last word is used partially */
     r[n] = a[n] >> left;
@@ -467,3 +853,81 @@ void poly_mod_phi(uint32_t *r, uint32_t *tmp) {
   }
 }
 
+
+
+/*============================================================================*\
+            Functions for arithmetics modulo dense polynomials
+\*============================================================================*/
+
+/******************************************************************************
+Function `poly_mod_barrett`:
+  Compute r %= phi with the Barrett reduction, for an arbitrary polynomial
+  phi with degree k:
+      q = floor(floor(r / t^k) * mu / t^k),   r -= q * phi,
+  where mu = floor(t^(2k) / phi). The quotient is exact for polynomials over
+  GF(2), so no correction is needed.
+Arguments:
+  * `r`:        pointer to the polynomial with degree lower than 2k, with
+                2 * `n` words, and the first `n` words being the result;
+  * `phi`:      the divisor, with `n` words;
+  * `mu`:       the pre-computed quotient, with `n` words;
+  * `k`:        the degree of phi, must be lower than 32 * `n`;
+  * `n`:        the length of `phi` and `mu` (in words);
+  * `tmp`:      a temporary array with a rough requirement of 7 * `n` words.
+******************************************************************************/
+void poly_mod_barrett(uint32_t *r, const uint32_t *phi, const uint32_t *mu,
+    const unsigned int k, const unsigned int n, uint32_t *tmp) {
+  uint32_t *q = tmp;            /* n words for the (partial) quotient */
+  uint32_t *pm = q + n;         /* 2n words for the products */
+  tmp = pm + (n << 1);
+
+  memset(q, 0, sizeof(uint32_t) * n);
+  copy_bits(q, r, k, k << 1);
+  poly_mul(pm, q, mu, n, tmp);
+  memset(q, 0, sizeof(uint32_t) * n);
+  copy_bits(q, pm, k, k << 1);
+  poly_mul(pm, q, phi, n, tmp);
+  for (unsigned int i = 0; i < n; i++) r[i] ^= pm[i];
+}
+
+/******************************************************************************
+Function `poly_pow_mod`:
+  Compute r = t^e mod phi, with the left-to-right square-and-multiply
+  algorithm, for an arbitrary polynomial phi with degree k.
+Arguments:
+  * `r`:        pointer to the result, with `n` words;
+  * `e`:        the exponent;
+  * `phi`:      the divisor, with `n` words;
+  * `mu`:       the pre-computed quotient for the Barrett reduction,
+                see `poly_mod_barrett`;
+  * `k`:        the degree of phi, must be lower than 32 * `n`;
+  * `n`:        the length of `phi` and `mu` (in words);
+  * `tmp`:      a temporary array with a rough requirement of 9 * `n` words.
+******************************************************************************/
+void poly_pow_mod(uint32_t *r, const uint64_t e, const uint32_t *phi,
+    const uint32_t *mu, const unsigned int k, const unsigned int n,
+    uint32_t *tmp) {
+  uint32_t *pm = tmp;           /* 2n words for the squares */
+  tmp = pm + (n << 1);
+
+  /* Start with the leading bits of e that do not need reductions. */
+  int b = 0;
+  while ((e >> b) >= k) b++;
+  const unsigned int e0 = e >> b;
+  memset(r, 0, sizeof(uint32_t) * n);
+  r[DIV_NBIT(e0)] = UINT32_C(1) << MOD_NBIT(e0);
+
+  while (--b >= 0) {
+    poly_mul(pm, r, r, n, tmp);
+    poly_mod_barrett(pm, phi, mu, k, n, tmp);
+    memcpy(r, pm, sizeof(uint32_t) * n);
+    if ((e >> b) & 1) {         /* r *= t */
+      for (unsigned int i = n - 1; i > 0; i--)
+        r[i] = (r[i] << 1) | (r[i-1] >> (WORD_SIZE - 1));
+      r[0] <<= 1;
+      if (COEF(r, k)) {
+        for (unsigned int i = 0; i < n; i++) r[i] ^= phi[i];
+      }
+    }
+  }
+}
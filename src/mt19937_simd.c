@@ -0,0 +1,557 @@
+/*******************************************************************************
+* mt19937_simd.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "mt19937.h"
+#include "prand_cpu.h"
+
+/*******************************************************************************
+  Kernels for generating and tempering the state array of MT19937, with
+  optional vectorisation. All the kernels produce identical results.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define N               MT19937_N
+#define M               MT19937_M
+#define MA              MT19937_MA
+#define UPPER_MASK(x)   (0x80000000UL & x)      /* most significant w-r bits */
+#define LOWER_MASK(x)   (0x7fffffffUL & x)      /* least significant r bits */
+
+#define NORM            MT19937_NORM
+#define NORM_POS        MT19937_NORM_POS
+
+/* Masks for tempering. */
+#define TEMPER_B        0x9d2c5680UL
+#define TEMPER_C        0xefc60000UL
+
+#ifndef MT19937_UNROLL
+  #define MAGIC(y)      (((y) & 1) ? MA : 0)
+#else
+/******************************************************************************
+  The following trick is taken from
+  https://github.com/cslarsen/mersenne-twister
+  which is distributed under the modified BSD license.
+  It is supposed to work faster with `-ftree-vectorize`, especially for
+  machines with SSE/AVX.
+******************************************************************************/
+  #define MAGIC(y)      (((((int32_t)y) << 31) >> 31) & MA)
+#endif
+
+/* Generate the k-th word of the state array, with the i-th and j-th words
+ * being the next one and the one with the offset M, respectively. */
+#define TWIST(mt,k,i,j) {                                               \
+  uint32_t y = UPPER_MASK((mt)[k]) | LOWER_MASK((mt)[i]);               \
+  (mt)[k] = (mt)[j] ^ (y >> 1) ^ MAGIC(y);                              \
+}
+
+
+/*============================================================================*\
+                                 Scalar kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `twist_scalar`:
+  Generate N words at one time.
+Arguments:
+  * `mt`:       the state array.
+******************************************************************************/
+static void twist_scalar(uint32_t *mt) {
+  int k;
+  for (k = 0; k < N - M; k++) TWIST(mt, k, k + 1, k + M);
+  for (; k < N - 1; k++) TWIST(mt, k, k + 1, k + M - N);
+  TWIST(mt, N - 1, 0, M - 1);
+}
+
+/******************************************************************************
+Function `temper_scalar`:
+  Temper an array of words, and convert them to integers.
+Arguments:
+  * `out`:      the array for storing the outputs;
+  * `mt`:       the words to be tempered;
+  * `n`:        the number of words to be tempered.
+******************************************************************************/
+static void temper_scalar(uint64_t *out, const uint32_t *mt, const size_t n) {
+  for (size_t i = 0; i < n; i++) out[i] = prand_mt19937_temper(mt[i]);
+}
+
+/******************************************************************************
+Function `temper_double_scalar`:
+  Temper an array of words, and convert them to floating-point numbers in
+  the range [0,1).
+Arguments:
+  * `out`:      the array for storing the outputs;
+  * `mt`:       the words to be tempered;
+  * `n`:        the number of words to be tempered.
+******************************************************************************/
+static void temper_double_scalar(double *out, const uint32_t *mt,
+    const size_t n) {
+  for (size_t i = 0; i < n; i++) out[i] = prand_mt19937_temper(mt[i]) * NORM;
+}
+
+/******************************************************************************
+Function `temper_double_pos_scalar`:
+  Temper an array of words, and convert them to floating-point numbers in
+  the range (0,1).
+Arguments:
+  * `out`:      the array for storing the outputs;
+  * `mt`:       the words to be tempered;
+  * `n`:        the number of words to be tempered.
+******************************************************************************/
+static void temper_double_pos_scalar(double *out, const uint32_t *mt,
+    const size_t n) {
+  for (size_t i = 0; i < n; i++)
+    out[i] = ((uint64_t) prand_mt19937_temper(mt[i]) + 1) * NORM_POS;
+}
+
+static const mt19937_kernel_t kernel_scalar = {
+  &twist_scalar, &temper_scalar, &temper_double_scalar,
+  &temper_double_pos_scalar
+};
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+/******************************************************************************
+Function `twist_sse2_vec`:
+  Generate 4 words of the state array.
+Arguments:
+  * `a`:        pointer to the words to be replaced;
+  * `b`:        pointer to the words with the offset M.
+Return:
+  The generated words.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline __m128i twist_sse2_vec(const uint32_t *a, const uint32_t *b) {
+  const __m128i upper = _mm_set1_epi32((int) 0x80000000U);
+  const __m128i lower = _mm_set1_epi32(0x7fffffff);
+  const __m128i ma = _mm_set1_epi32((int) MA);
+  __m128i y = _mm_or_si128(_mm_and_si128(_mm_loadu_si128((__m128i *) a),
+      upper), _mm_and_si128(_mm_loadu_si128((__m128i *) (a + 1)), lower));
+  __m128i mag = _mm_and_si128(_mm_srai_epi32(_mm_slli_epi32(y, 31), 31), ma);
+  return _mm_xor_si128(_mm_xor_si128(_mm_loadu_si128((__m128i *) b),
+      _mm_srli_epi32(y, 1)), mag);
+}
+
+/******************************************************************************
+Function `temper_sse2_vec`:
+  Temper 4 words.
+Arguments:
+  * `y`:        the words to be tempered.
+Return:
+  The tempered words.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline __m128i temper_sse2_vec(__m128i y) {
+  y = _mm_xor_si128(y, _mm_srli_epi32(y, 11));
+  y = _mm_xor_si128(y, _mm_and_si128(_mm_slli_epi32(y, 7),
+      _mm_set1_epi32((int) TEMPER_B)));
+  y = _mm_xor_si128(y, _mm_and_si128(_mm_slli_epi32(y, 15),
+      _mm_set1_epi32((int) TEMPER_C)));
+  return _mm_xor_si128(y, _mm_srli_epi32(y, 18));
+}
+
+/******************************************************************************
+Function `cvt_double_sse2`:
+  Convert 4 unsigned 32-bit integers to floating-point numbers:
+    out = (y + offset) * norm.
+Arguments:
+  * `out`:      the array for storing the outputs;
+  * `y`:        the integers to be converted;
+  * `offset`:   the offset before normalisation;
+  * `norm`:     the normalisation factor.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline void cvt_double_sse2(double *out, __m128i y,
+    const __m128d offset, const __m128d norm) {
+  /* There is no unsigned conversion with SSE2, so convert y - 2^31 and add
+   * 2^31 back to the results, which are exact. */
+  const __m128d bias = _mm_set1_pd(0x1p31);
+  y = _mm_xor_si128(y, _mm_set1_epi32((int) 0x80000000U));
+  __m128d lo = _mm_add_pd(_mm_cvtepi32_pd(y), bias);
+  __m128d hi = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(y, 8)), bias);
+  _mm_storeu_pd(out, _mm_mul_pd(_mm_add_pd(lo, offset), norm));
+  _mm_storeu_pd(out + 2, _mm_mul_pd(_mm_add_pd(hi, offset), norm));
+}
+
+PRAND_TARGET("sse2")
+static void twist_sse2(uint32_t *mt) {
+  int k;
+  for (k = 0; k + 4 <= N - M; k += 4)
+    _mm_storeu_si128((__m128i *) (mt + k), twist_sse2_vec(mt + k, mt + k + M));
+  for (; k < N - M; k++) TWIST(mt, k, k + 1, k + M);
+  for (; k + 4 <= N - 1; k += 4)
+    _mm_storeu_si128((__m128i *) (mt + k),
+        twist_sse2_vec(mt + k, mt + k + M - N));
+  for (; k < N - 1; k++) TWIST(mt, k, k + 1, k + M - N);
+  TWIST(mt, N - 1, 0, M - 1);
+}
+
+PRAND_TARGET("sse2")
+static void temper_sse2(uint64_t *out, const uint32_t *mt, const size_t n) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4) {
+    __m128i y = temper_sse2_vec(_mm_loadu_si128((__m128i *) (mt + i)));
+    _mm_storeu_si128((__m128i *) (out + i), _mm_unpacklo_epi32(y, zero));
+    _mm_storeu_si128((__m128i *) (out + i + 2), _mm_unpackhi_epi32(y, zero));
+  }
+  temper_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("sse2")
+static void temper_double_sse2(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m128d offset = _mm_setzero_pd();
+  const __m128d norm = _mm_set1_pd(NORM);
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4)
+    cvt_double_sse2(out + i,
+        temper_sse2_vec(_mm_loadu_si128((__m128i *) (mt + i))), offset, norm);
+  temper_double_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("sse2")
+static void temper_double_pos_sse2(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m128d offset = _mm_set1_pd(1);
+  const __m128d norm = _mm_set1_pd(NORM_POS);
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4)
+    cvt_double_sse2(out + i,
+        temper_sse2_vec(_mm_loadu_si128((__m128i *) (mt + i))), offset, norm);
+  temper_double_pos_scalar(out + i, mt + i, n - i);
+}
+
+static const mt19937_kernel_t kernel_sse2 = {
+  &twist_sse2, &temper_sse2, &temper_double_sse2, &temper_double_pos_sse2
+};
+
+
+/*============================================================================*\
+                              Kernels with AVX2
+\*============================================================================*/
+
+PRAND_TARGET("avx2")
+static inline __m256i twist_avx2_vec(const uint32_t *a, const uint32_t *b) {
+  const __m256i upper = _mm256_set1_epi32((int) 0x80000000U);
+  const __m256i lower = _mm256_set1_epi32(0x7fffffff);
+  const __m256i ma = _mm256_set1_epi32((int) MA);
+  __m256i y = _mm256_or_si256(
+      _mm256_and_si256(_mm256_loadu_si256((__m256i *) a), upper),
+      _mm256_and_si256(_mm256_loadu_si256((__m256i *) (a + 1)), lower));
+  __m256i mag = _mm256_and_si256(
+      _mm256_srai_epi32(_mm256_slli_epi32(y, 31), 31), ma);
+  return _mm256_xor_si256(_mm256_xor_si256(
+      _mm256_loadu_si256((__m256i *) b), _mm256_srli_epi32(y, 1)), mag);
+}
+
+PRAND_TARGET("avx2")
+static inline __m256i temper_avx2_vec(__m256i y) {
+  y = _mm256_xor_si256(y, _mm256_srli_epi32(y, 11));
+  y = _mm256_xor_si256(y, _mm256_and_si256(_mm256_slli_epi32(y, 7),
+      _mm256_set1_epi32((int) TEMPER_B)));
+  y = _mm256_xor_si256(y, _mm256_and_si256(_mm256_slli_epi32(y, 15),
+      _mm256_set1_epi32((int) TEMPER_C)));
+  return _mm256_xor_si256(y, _mm256_srli_epi32(y, 18));
+}
+
+PRAND_TARGET("avx2")
+static inline void cvt_double_avx2(double *out, __m256i y,
+    const __m256d offset, const __m256d norm) {
+  const __m256d bias = _mm256_set1_pd(0x1p31);
+  y = _mm256_xor_si256(y, _mm256_set1_epi32((int) 0x80000000U));
+  __m256d lo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(y)),
+      bias);
+  __m256d hi = _mm256_add_pd(
+      _mm256_cvtepi32_pd(_mm256_extracti128_si256(y, 1)), bias);
+  _mm256_storeu_pd(out, _mm256_mul_pd(_mm256_add_pd(lo, offset), norm));
+  _mm256_storeu_pd(out + 4, _mm256_mul_pd(_mm256_add_pd(hi, offset), norm));
+}
+
+PRAND_TARGET("avx2")
+static void twist_avx2(uint32_t *mt) {
+  int k;
+  for (k = 0; k + 8 <= N - M; k += 8)
+    _mm256_storeu_si256((__m256i *) (mt + k),
+        twist_avx2_vec(mt + k, mt + k + M));
+  for (; k < N - M; k++) TWIST(mt, k, k + 1, k + M);
+  for (; k + 8 <= N - 1; k += 8)
+    _mm256_storeu_si256((__m256i *) (mt + k),
+        twist_avx2_vec(mt + k, mt + k + M - N));
+  for (; k < N - 1; k++) TWIST(mt, k, k + 1, k + M - N);
+  TWIST(mt, N - 1, 0, M - 1);
+}
+
+PRAND_TARGET("avx2")
+static void temper_avx2(uint64_t *out, const uint32_t *mt, const size_t n) {
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m256i y = temper_avx2_vec(_mm256_loadu_si256((__m256i *) (mt + i)));
+    _mm256_storeu_si256((__m256i *) (out + i),
+        _mm256_cvtepu32_epi64(_mm256_castsi256_si128(y)));
+    _mm256_storeu_si256((__m256i *) (out + i + 4),
+        _mm256_cvtepu32_epi64(_mm256_extracti128_si256(y, 1)));
+  }
+  temper_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("avx2")
+static void temper_double_avx2(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m256d offset = _mm256_setzero_pd();
+  const __m256d norm = _mm256_set1_pd(NORM);
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8)
+    cvt_double_avx2(out + i, temper_avx2_vec(
+        _mm256_loadu_si256((__m256i *) (mt + i))), offset, norm);
+  temper_double_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("avx2")
+static void temper_double_pos_avx2(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m256d offset = _mm256_set1_pd(1);
+  const __m256d norm = _mm256_set1_pd(NORM_POS);
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8)
+    cvt_double_avx2(out + i, temper_avx2_vec(
+        _mm256_loadu_si256((__m256i *) (mt + i))), offset, norm);
+  temper_double_pos_scalar(out + i, mt + i, n - i);
+}
+
+static const mt19937_kernel_t kernel_avx2 = {
+  &twist_avx2, &temper_avx2, &temper_double_avx2, &temper_double_pos_avx2
+};
+
+
+/*============================================================================*\
+                             Kernels with AVX-512
+\*============================================================================*/
+
+PRAND_TARGET("avx512f")
+static inline __m512i twist_avx512_vec(const uint32_t *a, const uint32_t *b) {
+  const __m512i upper = _mm512_set1_epi32((int) 0x80000000U);
+  const __m512i lower = _mm512_set1_epi32(0x7fffffff);
+  const __m512i ma = _mm512_set1_epi32((int) MA);
+  __m512i y = _mm512_or_si512(_mm512_and_si512(_mm512_loadu_si512(a), upper),
+      _mm512_and_si512(_mm512_loadu_si512(a + 1), lower));
+  __m512i mag = _mm512_and_si512(
+      _mm512_srai_epi32(_mm512_slli_epi32(y, 31), 31), ma);
+  return _mm512_xor_si512(_mm512_xor_si512(_mm512_loadu_si512(b),
+      _mm512_srli_epi32(y, 1)), mag);
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512i temper_avx512_vec(__m512i y) {
+  y = _mm512_xor_si512(y, _mm512_srli_epi32(y, 11));
+  y = _mm512_xor_si512(y, _mm512_and_si512(_mm512_slli_epi32(y, 7),
+      _mm512_set1_epi32((int) TEMPER_B)));
+  y = _mm512_xor_si512(y, _mm512_and_si512(_mm512_slli_epi32(y, 15),
+      _mm512_set1_epi32((int) TEMPER_C)));
+  return _mm512_xor_si512(y, _mm512_srli_epi32(y, 18));
+}
+
+PRAND_TARGET("avx512f")
+static inline void cvt_double_avx512(double *out, __m512i y,
+    const __m512d offset, const __m512d norm) {
+  __m512d lo = _mm512_cvtepu32_pd(_mm512_castsi512_si256(y));
+  __m512d hi = _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(y, 1));
+  _mm512_storeu_pd(out, _mm512_mul_pd(_mm512_add_pd(lo, offset), norm));
+  _mm512_storeu_pd(out + 8, _mm512_mul_pd(_mm512_add_pd(hi, offset), norm));
+}
+
+PRAND_TARGET("avx512f")
+static void twist_avx512(uint32_t *mt) {
+  int k;
+  for (k = 0; k + 16 <= N - M; k += 16)
+    _mm512_storeu_si512(mt + k, twist_avx512_vec(mt + k, mt + k + M));
+  for (; k < N - M; k++) TWIST(mt, k, k + 1, k + M);
+  for (; k + 16 <= N - 1; k += 16)
+    _mm512_storeu_si512(mt + k, twist_avx512_vec(mt + k, mt + k + M - N));
+  for (; k < N - 1; k++) TWIST(mt, k, k + 1, k + M - N);
+  TWIST(mt, N - 1, 0, M - 1);
+}
+
+PRAND_TARGET("avx512f")
+static void temper_avx512(uint64_t *out, const uint32_t *mt, const size_t n) {
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __m512i y = temper_avx512_vec(_mm512_loadu_si512(mt + i));
+    _mm512_storeu_si512(out + i,
+        _mm512_cvtepu32_epi64(_mm512_castsi512_si256(y)));
+    _mm512_storeu_si512(out + i + 8,
+        _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(y, 1)));
+  }
+  temper_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("avx512f")
+static void temper_double_avx512(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m512d offset = _mm512_setzero_pd();
+  const __m512d norm = _mm512_set1_pd(NORM);
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16)
+    cvt_double_avx512(out + i, temper_avx512_vec(_mm512_loadu_si512(mt + i)),
+        offset, norm);
+  temper_double_scalar(out + i, mt + i, n - i);
+}
+
+PRAND_TARGET("avx512f")
+static void temper_double_pos_avx512(double *out, const uint32_t *mt,
+    const size_t n) {
+  const __m512d offset = _mm512_set1_pd(1);
+  const __m512d norm = _mm512_set1_pd(NORM_POS);
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16)
+    cvt_double_avx512(out + i, temper_avx512_vec(_mm512_loadu_si512(mt + i)),
+        offset, norm);
+  temper_double_pos_scalar(out + i, mt + i, n - i);
+}
+
+static const mt19937_kernel_t kernel_avx512 = {
+  &twist_avx512, &temper_avx512, &temper_double_avx512,
+  &temper_double_pos_avx512
+};
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline uint32x4_t twist_neon_vec(const uint32_t *a, const uint32_t *b) {
+  const uint32x4_t upper = vdupq_n_u32(0x80000000U);
+  const uint32x4_t lower = vdupq_n_u32(0x7fffffffU);
+  uint32x4_t y = vorrq_u32(vandq_u32(vld1q_u32(a), upper),
+      vandq_u32(vld1q_u32(a + 1), lower));
+  uint32x4_t mag = vandq_u32(vtstq_u32(y, vdupq_n_u32(1)), vdupq_n_u32(MA));
+  return veorq_u32(veorq_u32(vld1q_u32(b), vshrq_n_u32(y, 1)), mag);
+}
+
+static inline uint32x4_t temper_neon_vec(uint32x4_t y) {
+  y = veorq_u32(y, vshrq_n_u32(y, 11));
+  y = veorq_u32(y, vandq_u32(vshlq_n_u32(y, 7), vdupq_n_u32(TEMPER_B)));
+  y = veorq_u32(y, vandq_u32(vshlq_n_u32(y, 15), vdupq_n_u32(TEMPER_C)));
+  return veorq_u32(y, vshrq_n_u32(y, 18));
+}
+
+static inline void cvt_double_neon(double *out, uint32x4_t y,
+    const float64x2_t offset, const float64x2_t norm) {
+  float64x2_t lo = vcvtq_f64_u64(vmovl_u32(vget_low_u32(y)));
+  float64x2_t hi = vcvtq_f64_u64(vmovl_high_u32(y));
+  vst1q_f64(out, vmulq_f64(vaddq_f64(lo, offset), norm));
+  vst1q_f64(out + 2, vmulq_f64(vaddq_f64(hi, offset), norm));
+}
+
+static void twist_neon(uint32_t *mt) {
+  int k;
+  for (k = 0; k + 4 <= N - M; k += 4)
+    vst1q_u32(mt + k, twist_neon_vec(mt + k, mt + k + M));
+  for (; k < N - M; k++) TWIST(mt, k, k + 1, k + M);
+  for (; k + 4 <= N - 1; k += 4)
+    vst1q_u32(mt + k, twist_neon_vec(mt + k, mt + k + M - N));
+  for (; k < N - 1; k++) TWIST(mt, k, k + 1, k + M - N);
+  TWIST(mt, N - 1, 0, M - 1);
+}
+
+static void temper_neon(uint64_t *out, const uint32_t *mt, const size_t n) {
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4) {
+    uint32x4_t y = temper_neon_vec(vld1q_u32(mt + i));
+    vst1q_u64(out + i, vmovl_u32(vget_low_u32(y)));
+    vst1q_u64(out + i + 2, vmovl_high_u32(y));
+  }
+  temper_scalar(out + i, mt + i, n - i);
+}
+
+static void temper_double_neon(double *out, const uint32_t *mt,
+    const size_t n) {
+  const float64x2_t offset = vdupq_n_f64(0);
+  const float64x2_t norm = vdupq_n_f64(NORM);
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4)
+    cvt_double_neon(out + i, temper_neon_vec(vld1q_u32(mt + i)), offset, norm);
+  temper_double_scalar(out + i, mt + i, n - i);
+}
+
+static void temper_double_pos_neon(double *out, const uint32_t *mt,
+    const size_t n) {
+  const float64x2_t offset = vdupq_n_f64(1);
+  const float64x2_t norm = vdupq_n_f64(NORM_POS);
+  size_t i;
+  for (i = 0; i + 4 <= n; i += 4)
+    cvt_double_neon(out + i, temper_neon_vec(vld1q_u32(mt + i)), offset, norm);
+  temper_double_pos_scalar(out + i, mt + i, n - i);
+}
+
+static const mt19937_kernel_t kernel_neon = {
+  &twist_neon, &temper_neon, &temper_double_neon, &temper_double_pos_neon
+};
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `mt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const mt19937_kernel_t *mt19937_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("avx512f")) return &kernel_avx512;
+  if (PRAND_CPU_HAS("avx2")) return &kernel_avx2;
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return &kernel_scalar;
+}
+
+/******************************************************************************
+Function `prand_mt19937_twist`:
+  Generate `MT19937_N` words of the state array at one time, with the fastest
+  kernel supported by the CPU.
+Arguments:
+  * `mt`:       the state array.
+******************************************************************************/
+void prand_mt19937_twist(uint32_t *mt) {
+  mt19937_kernel()->twist(mt);
+}
@@ -0,0 +1,296 @@
+/*******************************************************************************
+* mt19937_table.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include "mt19937.h"
+
+#ifdef MT19937_POLY_LAZY
+#include "mt19937_jump.h"
+#include "prand_state.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*******************************************************************************
+  Table of the pre-computed jump-ahead polynomials of MT19937, which is
+  loaded on the first long jump instead of being embedded in the binary, if
+  the library is compiled with `-DMT19937_POLY_LAZY`. The (i,j)-th entry is
+      t^((j + 1) * 8^i) mod phi,
+  with i from 0 to (MT19937_MAX_STEP_B8 - 1), and j from 0 to 6.
+
+  If the environment variable `PRAND_MT19937_POLY`, or the path defined by
+  `MT19937_POLY_FILE` at compile time, names a valid sidecar file, the table
+  is mapped from it, so that the pages are shared by all processes using the
+  file, and only the ones for the digits of the jumps in use are read.
+  Otherwise the table is computed with 186 polynomial multiplications, and
+  written to the sidecar file if a path is given, for later processes. The
+  layout of the file is
+
+    offset          content
+    0               the header (`mt19937_poly_head_t`)
+    PRAND_PAGE_SIZE the table, in the native byte order
+
+  The polynomials are dense, so the file is not compressed. Both a mapped
+  and a computed table are verified against the checksum of the correct
+  table, so that a corrupted file never produces wrong jumps. The table is
+  loaded only once with `pthread_once`, so the first jumps can be done by
+  any threads concurrently, and it is kept until the process exits.
+*******************************************************************************/
+
+/*============================================================================*\
+                       Definition of the sidecar file
+\*============================================================================*/
+
+#define N               MT19937_N
+#define NPOLY           (MT19937_MAX_STEP_B8 * 7)       /* number of entries */
+
+#define POLY_ENV        "PRAND_MT19937_POLY"
+#define POLY_MAGIC      "PRANDMTP"
+#define POLY_VERSION    2
+#define POLY_ENDIAN     0x01020304UL    /* for checking the byte order */
+/* Checksum of the correct table, see `poly_checksum`. */
+#define POLY_CHECKSUM   UINT64_C(0x5e7ae6ef3440973d)
+
+typedef struct {
+  char magic[8];                /* the magic string "PRANDMTP" */
+  uint32_t version;             /* version of the file */
+  uint32_t endian;              /* the byte order check `POLY_ENDIAN` */
+  uint32_t nword;               /* number of words of each polynomial */
+  uint32_t npoly;               /* number of polynomials */
+  uint64_t offset;              /* offset of the table */
+  uint64_t checksum;            /* checksum of the table */
+} mt19937_poly_head_t;
+
+const uint32_t *mt19937_poly_lazy = NULL;
+
+/* Initialisation of the table shared by all threads. */
+static pthread_once_t poly_once = PTHREAD_ONCE_INIT;
+
+/******************************************************************************
+Function `poly_checksum`:
+  Compute the FNV-1a checksum of the table, with one 32-bit word at a time.
+Arguments:
+  * `table`:    the table.
+Return:
+  The checksum.
+******************************************************************************/
+static uint64_t poly_checksum(const uint32_t *table) {
+  uint64_t h = UINT64_C(0xcbf29ce484222325);
+  for (size_t k = 0; k < (size_t) N * NPOLY; k++) {
+    h ^= table[k];
+    h *= UINT64_C(0x100000001b3);
+  }
+  return h;
+}
+
+/******************************************************************************
+Function `poly_head`:
+  Construct the header of the sidecar file.
+Arguments:
+  * `head`:     the header to be filled.
+******************************************************************************/
+static void poly_head(mt19937_poly_head_t *head) {
+  memset(head, 0, sizeof(mt19937_poly_head_t));
+  memcpy(head->magic, POLY_MAGIC, 8);
+  head->version = POLY_VERSION;
+  head->endian = POLY_ENDIAN;
+  head->nword = N;
+  head->npoly = NPOLY;
+  head->offset = PRAND_PAGE_SIZE;
+  head->checksum = POLY_CHECKSUM;
+}
+
+
+/*============================================================================*\
+                     Functions for loading and saving the table
+\*============================================================================*/
+
+/******************************************************************************
+Function `poly_map`:
+  Map the table from a sidecar file, and verify its checksum.
+Arguments:
+  * `fname`:    name of the sidecar file.
+Return:
+  The table on success; NULL if the file is absent or invalid.
+******************************************************************************/
+static const uint32_t *poly_map(const char *fname) {
+  mt19937_poly_head_t head, fhead;
+  poly_head(&head);
+
+  int fd = open(fname, O_RDONLY);
+  if (fd < 0) return NULL;
+  const size_t map_size = head.offset + sizeof(uint32_t) * N * NPOLY;
+  struct stat st;
+  if (fstat(fd, &st) || (uint64_t) st.st_size != map_size ||
+      read(fd, &fhead, sizeof(mt19937_poly_head_t)) !=
+      (ssize_t) sizeof(mt19937_poly_head_t) ||
+      memcmp(&head, &fhead, sizeof(mt19937_poly_head_t))) {
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) return NULL;
+  const uint32_t *table = (const uint32_t *) ((const char *) map + head.offset);
+  if (poly_checksum(table) != POLY_CHECKSUM) {
+    munmap(map, map_size);
+    return NULL;
+  }
+  return table;
+}
+
+/******************************************************************************
+Function `poly_compute`:
+  Compute the table, with t^(8^i) being the 8-th power of t^(8^(i-1)), and
+  the rest of the entries for each i being its multiples.
+Return:
+  The newly allocated table; NULL on error.
+******************************************************************************/
+static uint32_t *poly_compute(void) {
+  uint32_t *table = malloc(sizeof(uint32_t) * N * NPOLY);
+  /* 2N words for the result of multiplication, and 8N for the workspace */
+  uint32_t *pm = malloc(sizeof(uint32_t) * N * 10);
+  if (!table || !pm) {
+    free(table);
+    free(pm);
+    return NULL;
+  }
+  uint32_t *tmp = pm + (N << 1);
+
+  memset(table, 0, sizeof(uint32_t) * N);
+  table[0] = UINT32_C(1) << 1;          /* t^1 */
+  for (int i = 0; i < MT19937_MAX_STEP_B8; i++) {
+    uint32_t *poly = table + (size_t) N * 7 * i;
+    if (i) {
+      memcpy(poly, poly - N * 7, sizeof(uint32_t) * N);
+      for (int k = 0; k < 3; k++) {
+        poly_mul(pm, poly, poly, N, tmp);
+        poly_mod_phi(pm, tmp);
+        memcpy(poly, pm, sizeof(uint32_t) * N);
+      }
+    }
+    for (int j = 1; j < 7; j++) {
+      poly_mul(pm, poly + N * (j - 1), poly, N, tmp);
+      poly_mod_phi(pm, tmp);
+      memcpy(poly + N * j, pm, sizeof(uint32_t) * N);
+    }
+  }
+
+  free(pm);
+  return table;
+}
+
+/******************************************************************************
+Function `poly_save`:
+  Write the table to a sidecar file. The file is written with a temporary
+  name and then renamed, so that other processes never map an incomplete
+  file. Failures are ignored, as the table is still available in memory.
+Arguments:
+  * `fname`:    name of the sidecar file;
+  * `table`:    the table.
+******************************************************************************/
+static void poly_save(const char *fname, const uint32_t *table) {
+  mt19937_poly_head_t head;
+  poly_head(&head);
+
+  const size_t len = strlen(fname) + 32;
+  char *tmpname = malloc(len);
+  unsigned char *zero = calloc(head.offset, 1);
+  if (!tmpname || !zero) {
+    free(tmpname);
+    free(zero);
+    return;
+  }
+  snprintf(tmpname, len, "%s.%ld.tmp", fname, (long) getpid());
+
+  FILE *fp = fopen(tmpname, "wb");
+  if (fp) {
+    int fail = fwrite(&head, sizeof(mt19937_poly_head_t), 1, fp) != 1 ||
+        fwrite(zero, head.offset - sizeof(mt19937_poly_head_t), 1, fp) != 1 ||
+        fwrite(table, sizeof(uint32_t) * N, NPOLY, fp) != NPOLY;
+    if (fclose(fp)) fail = 1;
+    if (fail || rename(tmpname, fname)) remove(tmpname);
+  }
+
+  free(tmpname);
+  free(zero);
+}
+
+/******************************************************************************
+Function `poly_init`:
+  Load the table from the sidecar file, or compute it, exactly once. A
+  failure is not retried, and reported by every `mt19937_poly_load`.
+******************************************************************************/
+static void poly_init(void) {
+  const char *fname = getenv(POLY_ENV);
+#ifdef MT19937_POLY_FILE
+  if (!fname || !*fname) fname = MT19937_POLY_FILE;
+#endif
+  if (fname && !*fname) fname = NULL;
+
+  const uint32_t *table = fname ? poly_map(fname) : NULL;
+  if (!table) {
+    uint32_t *poly = poly_compute();
+    if (poly && poly_checksum(poly) != POLY_CHECKSUM) {
+      free(poly);
+      poly = NULL;
+    }
+    if (poly && fname) poly_save(fname, poly);
+    table = poly;
+  }
+  mt19937_poly_lazy = table;
+}
+
+/******************************************************************************
+Function `mt19937_poly_load`:
+  Load the table of the pre-computed jump-ahead polynomials on the first
+  call, from a sidecar file, or by computing it. It can be called
+  concurrently by different threads.
+Arguments:
+  * `err`:      an integer for storing the error message.
+Return:
+  The table on success; NULL on error.
+******************************************************************************/
+const uint32_t *mt19937_poly_load(int *err) {
+  /* The table written by the first caller is visible after `pthread_once`
+   * returns in every thread. */
+  pthread_once(&poly_once, poly_init);
+  const uint32_t *table = mt19937_poly_lazy;
+  if (!table) *err = PRAND_ERR_MEMORY_JUMP;
+  return table;
+}
+
+#endif
@@ -0,0 +1,683 @@
+/*******************************************************************************
+* philox4x32.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "philox4x32.h"
+#include "prand_state.h"
+#include "prand_stats.h"
+#include "prand_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+  Implementation of the Philox4x32-10 counter-based random number generator.
+  ref: https://doi.org/10.1145/2063384.2063405
+  The outputs are the 32-bit words of the encrypted 128-bit counters, with
+  the 64-bit seed being the key. Jumping ahead is an addition to the counter,
+  so the cost does not depend on the step size, and the blocks of different
+  counters are generated independently, with the vectorised kernels.
+  The results are identical to those of the Random123 library:
+  https://www.deshawresearch.com/resources_random123.html
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define NORM            PHILOX4X32_NORM
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define NORM_POS        PHILOX4X32_NORM_POS
+
+#define DEFAULT_SEED    1
+
+/* Number of words generated at one time for the batch sampling. */
+#define FILL_CHUNK      1024
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+/* The state is shared with the inline interface. */
+typedef prand_philox4x32_state_t philox4x32_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `philox4x32_seed`:
+  Initialise the state with an integer.
+Arguments:
+  * `state`:    the state to be intialised;
+  * `seed`:     a positive integer for the initialisation.
+******************************************************************************/
+static void philox4x32_seed(void *state, uint64_t seed) {
+  philox4x32_state_t *stat = (philox4x32_state_t *) state;
+  /* validation of seed is done in `philox4x32_init' */
+  stat->key[0] = (uint32_t) seed;
+  stat->key[1] = (uint32_t) (seed >> 32);
+  for (int i = 0; i < 4; i++) stat->ctr[i] = stat->buf[i] = 0;
+
+  stat->idx = 4;
+  stat->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `philox4x32_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static uint64_t philox4x32_get(void *state) {
+  return prand_philox4x32_get((philox4x32_state_t *) state);
+}
+
+/******************************************************************************
+Function `philox4x32_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double philox4x32_get_double(void *state) {
+  return philox4x32_get(state) * NORM;
+}
+
+/******************************************************************************
+Function `philox4x32_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double philox4x32_get_double_pos(void *state) {
+  return (philox4x32_get(state) + 1) * NORM_POS;
+}
+
+/******************************************************************************
+Function `philox4x32_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double philox4x32_get_double53(void *state) {
+  return prand_philox4x32_get_double53((philox4x32_state_t *) state);
+}
+
+/******************************************************************************
+Function `philox4x32_words`:
+  Generate consecutive words of the sequence, with the full blocks encrypted
+  by the vectorised kernels.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `kernel`:   the kernels for encrypting the counters;
+  * `w`:        the array for storing the words;
+  * `n`:        the number of words to be generated.
+******************************************************************************/
+static inline void philox4x32_words(philox4x32_state_t *stat,
+    const philox4x32_kernel_t *kernel, uint32_t *w, const size_t n) {
+  size_t i = 0;
+  while (i < n && stat->idx < 4) w[i++] = stat->buf[stat->idx++];
+
+  const size_t nblk = (n - i) >> 2;
+  if (nblk) {
+    kernel->blocks(w + i, stat->ctr, stat->key, nblk);
+    prand_philox4x32_ctr_add(stat->ctr, nblk);
+    i += nblk << 2;
+  }
+
+  if (i < n) {                  /* the remaining words of a partial block */
+    prand_philox4x32_block(stat->buf, stat->ctr, stat->key);
+    prand_philox4x32_ctr_add(stat->ctr, 1);
+    stat->idx = 0;
+    while (i < n) w[i++] = stat->buf[stat->idx++];
+  }
+}
+
+/******************************************************************************
+Macro `PHILOX4X32_FILL`:
+  Generate an array of numbers from one stream, with the words converted to
+  the outputs chunk by chunk. The i-th number is stored as the (i * stride)-th
+  element of the output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array;
+  * `conv`:     the expression for converting a word `x` to an output.
+******************************************************************************/
+#define PHILOX4X32_FILL(stat, out, n, stride, conv) {                   \
+  const philox4x32_kernel_t *kernel = philox4x32_kernel();              \
+  uint32_t w[FILL_CHUNK];                                               \
+  for (size_t i = 0; i < (n); i += FILL_CHUNK) {                        \
+    const size_t len = ((n) - i < FILL_CHUNK) ? (n) - i : FILL_CHUNK;   \
+    philox4x32_words(stat, kernel, w, len);                             \
+    for (size_t j = 0; j < len; j++) {                                  \
+      const uint32_t x = w[j];                                          \
+      (out)[(i + j) * (stride)] = conv;                                 \
+    }                                                                   \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `philox4x32_fill`:
+  Generate an array of integers and update the state.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated.
+******************************************************************************/
+static void philox4x32_fill(void *state, uint64_t *out, const size_t n) {
+  PHILOX4X32_FILL((philox4x32_state_t *) state, out, n, 1, x);
+}
+
+/******************************************************************************
+Function `philox4x32_fill_double`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void philox4x32_fill_double(void *state, double *out, const size_t n) {
+  PHILOX4X32_FILL((philox4x32_state_t *) state, out, n, 1, x * NORM);
+}
+
+/******************************************************************************
+Function `philox4x32_fill_double_pos`:
+  Generate an array of double-precision floating-point numbers in the
+  range (0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void philox4x32_fill_double_pos(void *state, double *out,
+    const size_t n) {
+  PHILOX4X32_FILL((philox4x32_state_t *) state, out, n, 1,
+      (x + 1.0) * NORM_POS);
+}
+
+/******************************************************************************
+Macro `PHILOX4X32_FILL53`:
+  Generate an array of floating-point numbers with 53-bit resolution from one
+  stream, with pairs of words converted chunk by chunk. The i-th number is
+  stored as the (i * stride)-th element of the output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array.
+******************************************************************************/
+#define PHILOX4X32_FILL53(stat, out, n, stride) {                       \
+  const philox4x32_kernel_t *kernel = philox4x32_kernel();              \
+  uint32_t w[FILL_CHUNK];                                               \
+  for (size_t i = 0; i < (n); i += FILL_CHUNK >> 1) {                   \
+    const size_t len = ((n) - i < (FILL_CHUNK >> 1)) ? (n) - i :        \
+      FILL_CHUNK >> 1;                                                  \
+    philox4x32_words(stat, kernel, w, len << 1);                        \
+    for (size_t j = 0; j < len; j++) {                                  \
+      (out)[(i + j) * (stride)] =                                       \
+        prand_double53(w[j << 1], w[(j << 1) + 1]);                     \
+    }                                                                   \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `philox4x32_fill_double53`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1), with 53-bit resolution. The results are identical to those of
+  calling `philox4x32_get_double53` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void philox4x32_fill_double53(void *state, double *out,
+    const size_t n) {
+  PHILOX4X32_FILL53((philox4x32_state_t *) state, out, n, 1);
+}
+
+/******************************************************************************
+Function `philox4x32_get_gaussian`:
+  Generate a Gaussian number with zero mean and unit variance, and update the
+  state. The numbers are generated in pairs with the Box-Muller method, from
+  two floating-point numbers in the range (0,1) each, and the second number
+  of a pair is cached for the next call.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random Gaussian number.
+******************************************************************************/
+static double philox4x32_get_gaussian(void *state) {
+  philox4x32_state_t *stat = (philox4x32_state_t *) state;
+  if (stat->has_gauss) {
+    stat->has_gauss = 0;
+    return stat->gauss;
+  }
+
+  double z[2];
+  z[0] = philox4x32_get_double_pos(state);
+  z[1] = philox4x32_get_double_pos(state);
+  prand_box_muller(z, 1);
+  stat->gauss = z[1];
+  stat->has_gauss = 1;
+  return z[0];
+}
+
+/******************************************************************************
+Function `philox4x32_fill_gaussian`:
+  Generate an array of Gaussian numbers with zero mean and unit variance, and
+  update the state. The results are identical to those of calling
+  `philox4x32_get_gaussian` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of Gaussian numbers to be generated.
+******************************************************************************/
+static void philox4x32_fill_gaussian(void *state, double *out,
+    const size_t n) {
+  philox4x32_state_t *stat = (philox4x32_state_t *) state;
+  size_t i = 0;
+  if (!n) return;
+  if (stat->has_gauss) {
+    out[i++] = stat->gauss;
+    stat->has_gauss = 0;
+  }
+
+  /* Generate pairs in place from the uniform numbers. */
+  const size_t npair = (n - i) >> 1;
+  philox4x32_fill_double_pos(state, out + i, npair << 1);
+  prand_math_kernel()->box_muller(out + i, npair);
+  i += npair << 1;
+  if (i < n) out[i] = philox4x32_get_gaussian(state);
+}
+
+
+/*============================================================================*\
+                         Functions for multiple streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `philox4x32_skip`:
+  Advance the state by a given number of words, by increasing the counter.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `step`:     the number of words to be skipped.
+******************************************************************************/
+static void philox4x32_skip(philox4x32_state_t *stat, const uint64_t step) {
+  uint64_t q = step >> 2;       /* number of full blocks to be skipped */
+  int off = step & 3;           /* offset of the next word in its block */
+
+  stat->has_gauss = 0;
+  if (stat->idx < 4) {          /* the current block has the counter ctr - 1 */
+    off += stat->idx;
+    if (off >= 4) off -= 4;
+    else if (!q) {              /* still in the current block */
+      stat->idx = off;
+      return;
+    }
+    else q--;
+  }
+
+  prand_philox4x32_ctr_add(stat->ctr, q);
+  if (off) {
+    prand_philox4x32_block(stat->buf, stat->ctr, stat->key);
+    prand_philox4x32_ctr_add(stat->ctr, 1);
+    stat->idx = off;
+  }
+  else stat->idx = 4;
+}
+
+/******************************************************************************
+Function `philox4x32_jump`:
+  Jump ahead for one stream.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void philox4x32_jump(void *state, const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (!step) return;
+  philox4x32_skip((philox4x32_state_t *) state, step);
+}
+
+/******************************************************************************
+Function `philox4x32_jump_all`:
+  Jump ahead the same number of steps for all streams.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void philox4x32_jump_all(prand_t *rng, const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (!step) return;
+  for (int i = 0; i < rng->nstream; i++)
+    philox4x32_skip((philox4x32_state_t *) rng->state_stream[i], step);
+}
+
+/******************************************************************************
+Function `philox4x32_jump_prepare`:
+  Prepare the jump for a given step size. No pre-computation is needed, as
+  the cost of jumping ahead does not depend on the step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  The pre-computed jump on success; NULL on error.
+******************************************************************************/
+static prand_jump_t *philox4x32_jump_prepare(prand_t *rng,
+    const uint64_t step, int *err) {
+  (void) rng;
+  if (PRAND_IS_ERROR(*err)) return NULL;
+
+  prand_jump_t *jmp = malloc(sizeof(prand_jump_t));
+  if (!jmp) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return NULL;
+  }
+  jmp->type = PRAND_RNG_PHILOX4X32;
+  jmp->step = step;
+  jmp->data = NULL;
+  return jmp;
+}
+
+/******************************************************************************
+Function `philox4x32_jump_apply`:
+  Jump ahead for one stream, with a pre-computed jump.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `jmp`:      the pre-computed jump;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void philox4x32_jump_apply(void *state, const prand_jump_t *jmp,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (jmp->type != PRAND_RNG_PHILOX4X32) {
+    *err = PRAND_ERR_JUMP_TYPE;
+    return;
+  }
+  if (!jmp->step) return;
+  philox4x32_skip((philox4x32_state_t *) state, jmp->step);
+}
+
+/******************************************************************************
+Function `philox4x32_reset`:
+  Reset the state for one stream, with a given seed and number of skip steps.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void philox4x32_reset(void *state, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    philox4x32_seed(state, DEFAULT_SEED);
+  }
+  else philox4x32_seed(state, seed);
+
+  philox4x32_jump(state, step, err);
+}
+
+/******************************************************************************
+Function `philox4x32_spread`:
+  Initialise the states of all streams from the seeded first stream, with
+  the starting points separated by a given step size. All streams share the
+  same key, and differ only in the counters.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead.
+******************************************************************************/
+static void philox4x32_spread(prand_t *rng, const uint64_t step) {
+  philox4x32_state_t *stat = (philox4x32_state_t *) (rng->state);
+
+  if (rng->nstream <= 1) {
+    if (step) philox4x32_skip(stat, step);
+    return;
+  }
+  for (int i = 1; i < rng->nstream; i++) {
+    memcpy(rng->state_stream[i], rng->state_stream[i - 1],
+        sizeof(philox4x32_state_t));
+    if (step) philox4x32_skip(rng->state_stream[i], step);
+  }
+}
+
+/******************************************************************************
+Function `philox4x32_reset_all`:
+  Reset the state for all streams, with a given seed and number of skip steps.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void philox4x32_reset_all(prand_t *rng, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    philox4x32_seed(rng->state, DEFAULT_SEED);
+  }
+  else philox4x32_seed(rng->state, seed);
+
+  philox4x32_spread(rng, step);
+}
+
+/******************************************************************************
+Macro `PHILOX4X32_FILL_ALL`:
+  Generate numbers from all streams in lock-step. The i-th number of the
+  s-th stream is stored as the (i * nstream + s)-th element of the output
+  array. The streams are processed one after another, with the outputs of
+  every stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream;
+  * `conv`:     the expression for converting a word `x` to an output.
+******************************************************************************/
+#define PHILOX4X32_FILL_ALL(rng, out, n, conv) {                        \
+  const size_t ns = (rng)->nstream;                                     \
+  for (size_t s = 0; s < ns; s++) {                                     \
+    philox4x32_state_t *stat =                                          \
+      (philox4x32_state_t *) (rng)->state_stream[s];                    \
+    PHILOX4X32_FILL(stat, (out) + s, n, ns, conv);                      \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `philox4x32_fill_all`:
+  Generate integers from all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated for each stream.
+******************************************************************************/
+static void philox4x32_fill_all(prand_t *rng, uint64_t *out, const size_t n) {
+  PHILOX4X32_FILL_ALL(rng, out, n, x);
+}
+
+/******************************************************************************
+Function `philox4x32_fill_all_double`:
+  Generate double-precision floating-point numbers in the range [0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void philox4x32_fill_all_double(prand_t *rng, double *out,
+    const size_t n) {
+  PHILOX4X32_FILL_ALL(rng, out, n, x * NORM);
+}
+
+/******************************************************************************
+Function `philox4x32_fill_all_double_pos`:
+  Generate double-precision floating-point numbers in the range (0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void philox4x32_fill_all_double_pos(prand_t *rng, double *out,
+    const size_t n) {
+  PHILOX4X32_FILL_ALL(rng, out, n, (x + 1.0) * NORM_POS);
+}
+
+/******************************************************************************
+Function `philox4x32_fill_all_double53`:
+  Generate double-precision floating-point numbers in the range [0,1), with
+  53-bit resolution, from all streams in lock-step.
+  The streams are processed one after another, with the outputs of every
+  stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void philox4x32_fill_all_double53(prand_t *rng, double *out,
+    const size_t n) {
+  const size_t ns = rng->nstream;
+  for (size_t s = 0; s < ns; s++) {
+    philox4x32_state_t *stat = (philox4x32_state_t *) rng->state_stream[s];
+    PHILOX4X32_FILL53(stat, out + s, n, ns);
+  }
+}
+
+
+/*============================================================================*\
+                     Wrappers of the functions with counters
+\*============================================================================*/
+
+/* The wrappers are defined only if the library is compiled with
+ * `-DPRAND_STATS`, see `prand_stats.h`. */
+PRAND_STATS_FUNCS(philox4x32, philox4x32_state_t, PRAND_RNG_PHILOX4X32)
+
+
+/*============================================================================*\
+                          Interface for initialisation
+\*============================================================================*/
+
+/******************************************************************************
+Function `philox4x32_init`:
+  Initialisation of the Philox4x32-10 generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *philox4x32_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err) {
+  prand_t *rng = malloc(sizeof(prand_t));
+  if (!rng) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  unsigned int numstr = (nstream == 0) ? 1 : nstream;
+  rng->state_stream = malloc(sizeof(philox4x32_state_t *) * numstr);
+  if (!rng->state_stream) {
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  void *states = prand_state_alloc(rng->state_stream,
+      sizeof(philox4x32_state_t), numstr, PRAND_CACHE_LINE);
+  if (!states) {
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  rng->state = rng->state_stream[0];
+  rng->substream = NULL;
+  PRAND_STATS_CLEAR(rng);
+  rng->nstream = numstr;
+  rng->type = PRAND_RNG_PHILOX4X32;
+  rng->min = 0;
+  rng->max = 0xffffffffUL;      /* 2^32 - 1 */
+  rng->ndraw53 = 2;
+  rng->cache = NULL;            /* jumps are not pre-computed */
+
+  rng->get = &philox4x32_get;
+  rng->get_double = &philox4x32_get_double;
+  rng->get_double_pos = &philox4x32_get_double_pos;
+  rng->get_double53 = &philox4x32_get_double53;
+  rng->fill = &philox4x32_fill;
+  rng->fill_double = &philox4x32_fill_double;
+  rng->fill_double_pos = &philox4x32_fill_double_pos;
+  rng->fill_double53 = &philox4x32_fill_double53;
+  rng->get_gaussian = &philox4x32_get_gaussian;
+  rng->fill_gaussian = &philox4x32_fill_gaussian;
+  rng->fill_all = &philox4x32_fill_all;
+  rng->fill_all_double = &philox4x32_fill_all_double;
+  rng->fill_all_double_pos = &philox4x32_fill_all_double_pos;
+  rng->fill_all_double53 = &philox4x32_fill_all_double53;
+  rng->reset = &philox4x32_reset;
+  rng->reset_all = &philox4x32_reset_all;
+  rng->jump = &philox4x32_jump;
+  rng->jump_all = &philox4x32_jump_all;
+  rng->jump_prepare = &philox4x32_jump_prepare;
+  rng->jump_apply = &philox4x32_jump_apply;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    philox4x32_seed(rng->state, DEFAULT_SEED);
+  }
+  else philox4x32_seed(rng->state, seed);
+
+  philox4x32_spread(rng, step);
+
+  PRAND_STATS_WRAP(rng, philox4x32);
+  return rng;
+}
@@ -0,0 +1,374 @@
+/*******************************************************************************
+* philox4x32_simd.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "philox4x32.h"
+#include "prand_cpu.h"
+
+/*******************************************************************************
+  Kernels for encrypting consecutive counters of Philox4x32-10, with the
+  counters of different blocks stored in separate lanes of vector registers.
+  The 32-bit products are computed with the widening multiplications of the
+  even lanes, and the blocks are transposed back before being stored. All the
+  kernels produce identical results.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define M0              PHILOX4X32_M0
+#define M1              PHILOX4X32_M1
+#define W0              PHILOX4X32_W0
+#define W1              PHILOX4X32_W1
+#define ROUNDS          PHILOX4X32_ROUNDS
+
+
+/*============================================================================*\
+                                 Scalar kernels
+\*============================================================================*/
+
+static void blocks_scalar(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key, const size_t n) {
+  uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+  for (size_t i = 0; i < n; i++) {
+    prand_philox4x32_block(out + 4 * i, c, key);
+    prand_philox4x32_ctr_add(c, 1);
+  }
+}
+
+static const philox4x32_kernel_t kernel_scalar = { &blocks_scalar };
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+PRAND_TARGET("sse2")
+static inline void mulhilo_sse2(const __m128i a, const __m128i m,
+    __m128i *hi, __m128i *lo) {
+  const __m128i mask = _mm_set1_epi64x(0xffffffffLL);
+  const __m128i pe = _mm_mul_epu32(a, m);
+  const __m128i po = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+  *lo = _mm_or_si128(_mm_and_si128(pe, mask), _mm_slli_epi64(po, 32));
+  *hi = _mm_or_si128(_mm_srli_epi64(pe, 32), _mm_andnot_si128(mask, po));
+}
+
+/* Encrypt 4 counters, with the words of the counters in separate vectors. */
+PRAND_TARGET("sse2")
+static inline void rounds_sse2(__m128i *c, const uint32_t *key) {
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < ROUNDS; r++) {
+    if (r) {
+      k0 += W0;
+      k1 += W1;
+    }
+    __m128i hi0, lo0, hi1, lo1;
+    mulhilo_sse2(c[0], _mm_set1_epi32((int32_t) M0), &hi0, &lo0);
+    mulhilo_sse2(c[2], _mm_set1_epi32((int32_t) M1), &hi1, &lo1);
+    c[0] = _mm_xor_si128(_mm_xor_si128(hi1, c[1]), _mm_set1_epi32(k0));
+    c[2] = _mm_xor_si128(_mm_xor_si128(hi0, c[3]), _mm_set1_epi32(k1));
+    c[1] = lo1;
+    c[3] = lo0;
+  }
+}
+
+PRAND_TARGET("sse2")
+static void blocks_sse2(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key, const size_t n) {
+  uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    /* The carries between words are left to the scalar code. */
+    if (c[0] > UINT32_MAX - 3) blocks_scalar(out + 4 * i, c, key, 4);
+    else {
+      __m128i v[4];
+      v[0] = _mm_add_epi32(_mm_set1_epi32(c[0]), _mm_set_epi32(3, 2, 1, 0));
+      v[1] = _mm_set1_epi32(c[1]);
+      v[2] = _mm_set1_epi32(c[2]);
+      v[3] = _mm_set1_epi32(c[3]);
+      rounds_sse2(v, key);
+      const __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]);
+      const __m128i t1 = _mm_unpacklo_epi32(v[2], v[3]);
+      const __m128i t2 = _mm_unpackhi_epi32(v[0], v[1]);
+      const __m128i t3 = _mm_unpackhi_epi32(v[2], v[3]);
+      __m128i *dst = (__m128i *) (out + 4 * i);
+      _mm_storeu_si128(dst, _mm_unpacklo_epi64(t0, t1));
+      _mm_storeu_si128(dst + 1, _mm_unpackhi_epi64(t0, t1));
+      _mm_storeu_si128(dst + 2, _mm_unpacklo_epi64(t2, t3));
+      _mm_storeu_si128(dst + 3, _mm_unpackhi_epi64(t2, t3));
+    }
+    prand_philox4x32_ctr_add(c, 4);
+  }
+  blocks_scalar(out + 4 * i, c, key, n - i);
+}
+
+static const philox4x32_kernel_t kernel_sse2 = { &blocks_sse2 };
+
+
+/*============================================================================*\
+                              Kernels with AVX2
+\*============================================================================*/
+
+PRAND_TARGET("avx2")
+static inline void mulhilo_avx2(const __m256i a, const __m256i m,
+    __m256i *hi, __m256i *lo) {
+  const __m256i pe = _mm256_mul_epu32(a, m);
+  const __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+  *lo = _mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xaa);
+  *hi = _mm256_blend_epi32(_mm256_srli_epi64(pe, 32), po, 0xaa);
+}
+
+/* Encrypt 8 counters, with the words of the counters in separate vectors. */
+PRAND_TARGET("avx2")
+static inline void rounds_avx2(__m256i *c, const uint32_t *key) {
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < ROUNDS; r++) {
+    if (r) {
+      k0 += W0;
+      k1 += W1;
+    }
+    __m256i hi0, lo0, hi1, lo1;
+    mulhilo_avx2(c[0], _mm256_set1_epi32((int32_t) M0), &hi0, &lo0);
+    mulhilo_avx2(c[2], _mm256_set1_epi32((int32_t) M1), &hi1, &lo1);
+    c[0] = _mm256_xor_si256(_mm256_xor_si256(hi1, c[1]),
+        _mm256_set1_epi32(k0));
+    c[2] = _mm256_xor_si256(_mm256_xor_si256(hi0, c[3]),
+        _mm256_set1_epi32(k1));
+    c[1] = lo1;
+    c[3] = lo0;
+  }
+}
+
+PRAND_TARGET("avx2")
+static void blocks_avx2(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key, const size_t n) {
+  uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    /* The carries between words are left to the scalar code. */
+    if (c[0] > UINT32_MAX - 7) blocks_scalar(out + 4 * i, c, key, 8);
+    else {
+      __m256i v[4];
+      v[0] = _mm256_add_epi32(_mm256_set1_epi32(c[0]),
+          _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+      v[1] = _mm256_set1_epi32(c[1]);
+      v[2] = _mm256_set1_epi32(c[2]);
+      v[3] = _mm256_set1_epi32(c[3]);
+      rounds_avx2(v, key);
+      /* Transpose within 128-bit lanes, giving blocks (j, j + 4). */
+      const __m256i t0 = _mm256_unpacklo_epi32(v[0], v[1]);
+      const __m256i t1 = _mm256_unpacklo_epi32(v[2], v[3]);
+      const __m256i t2 = _mm256_unpackhi_epi32(v[0], v[1]);
+      const __m256i t3 = _mm256_unpackhi_epi32(v[2], v[3]);
+      const __m256i b0 = _mm256_unpacklo_epi64(t0, t1);
+      const __m256i b1 = _mm256_unpackhi_epi64(t0, t1);
+      const __m256i b2 = _mm256_unpacklo_epi64(t2, t3);
+      const __m256i b3 = _mm256_unpackhi_epi64(t2, t3);
+      __m256i *dst = (__m256i *) (out + 4 * i);
+      _mm256_storeu_si256(dst, _mm256_permute2x128_si256(b0, b1, 0x20));
+      _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(b2, b3, 0x20));
+      _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(b0, b1, 0x31));
+      _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(b2, b3, 0x31));
+    }
+    prand_philox4x32_ctr_add(c, 8);
+  }
+  blocks_sse2(out + 4 * i, c, key, n - i);
+}
+
+static const philox4x32_kernel_t kernel_avx2 = { &blocks_avx2 };
+
+
+/*============================================================================*\
+                             Kernels with AVX-512
+\*============================================================================*/
+
+PRAND_TARGET("avx512f")
+static inline void mulhilo_avx512(const __m512i a, const __m512i m,
+    __m512i *hi, __m512i *lo) {
+  const __m512i pe = _mm512_mul_epu32(a, m);
+  const __m512i po = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), m);
+  *lo = _mm512_mask_blend_epi32(0xaaaa, pe, _mm512_slli_epi64(po, 32));
+  *hi = _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(pe, 32), po);
+}
+
+/* Encrypt 16 counters, with the words of the counters in separate vectors. */
+PRAND_TARGET("avx512f")
+static inline void rounds_avx512(__m512i *c, const uint32_t *key) {
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < ROUNDS; r++) {
+    if (r) {
+      k0 += W0;
+      k1 += W1;
+    }
+    __m512i hi0, lo0, hi1, lo1;
+    mulhilo_avx512(c[0], _mm512_set1_epi32((int32_t) M0), &hi0, &lo0);
+    mulhilo_avx512(c[2], _mm512_set1_epi32((int32_t) M1), &hi1, &lo1);
+    c[0] = _mm512_xor_si512(_mm512_xor_si512(hi1, c[1]),
+        _mm512_set1_epi32(k0));
+    c[2] = _mm512_xor_si512(_mm512_xor_si512(hi0, c[3]),
+        _mm512_set1_epi32(k1));
+    c[1] = lo1;
+    c[3] = lo0;
+  }
+}
+
+PRAND_TARGET("avx512f")
+static void blocks_avx512(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key, const size_t n) {
+  uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    /* The carries between words are left to the scalar code. */
+    if (c[0] > UINT32_MAX - 15) blocks_scalar(out + 4 * i, c, key, 16);
+    else {
+      __m512i v[4];
+      v[0] = _mm512_add_epi32(_mm512_set1_epi32(c[0]),
+          _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+            7, 6, 5, 4, 3, 2, 1, 0));
+      v[1] = _mm512_set1_epi32(c[1]);
+      v[2] = _mm512_set1_epi32(c[2]);
+      v[3] = _mm512_set1_epi32(c[3]);
+      rounds_avx512(v, key);
+      /* Transpose within 128-bit lanes, giving blocks (j, j + 4, j + 8,
+       * j + 12), and then reorder the lanes. */
+      const __m512i t0 = _mm512_unpacklo_epi32(v[0], v[1]);
+      const __m512i t1 = _mm512_unpacklo_epi32(v[2], v[3]);
+      const __m512i t2 = _mm512_unpackhi_epi32(v[0], v[1]);
+      const __m512i t3 = _mm512_unpackhi_epi32(v[2], v[3]);
+      const __m512i b0 = _mm512_unpacklo_epi64(t0, t1);
+      const __m512i b1 = _mm512_unpackhi_epi64(t0, t1);
+      const __m512i b2 = _mm512_unpacklo_epi64(t2, t3);
+      const __m512i b3 = _mm512_unpackhi_epi64(t2, t3);
+      const __m512i u0 = _mm512_shuffle_i64x2(b0, b1, 0x44);
+      const __m512i u1 = _mm512_shuffle_i64x2(b2, b3, 0x44);
+      const __m512i u2 = _mm512_shuffle_i64x2(b0, b1, 0xee);
+      const __m512i u3 = _mm512_shuffle_i64x2(b2, b3, 0xee);
+      uint32_t *dst = out + 4 * i;
+      _mm512_storeu_si512(dst, _mm512_shuffle_i64x2(u0, u1, 0x88));
+      _mm512_storeu_si512(dst + 16, _mm512_shuffle_i64x2(u0, u1, 0xdd));
+      _mm512_storeu_si512(dst + 32, _mm512_shuffle_i64x2(u2, u3, 0x88));
+      _mm512_storeu_si512(dst + 48, _mm512_shuffle_i64x2(u2, u3, 0xdd));
+    }
+    prand_philox4x32_ctr_add(c, 16);
+  }
+  blocks_avx2(out + 4 * i, c, key, n - i);
+}
+
+static const philox4x32_kernel_t kernel_avx512 = { &blocks_avx512 };
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline void mulhilo_neon(const uint32x4_t a, const uint32x4_t m,
+    uint32x4_t *hi, uint32x4_t *lo) {
+  const uint32x4_t pl = vreinterpretq_u32_u64(vmull_u32(vget_low_u32(a),
+        vget_low_u32(m)));
+  const uint32x4_t ph = vreinterpretq_u32_u64(vmull_high_u32(a, m));
+  *lo = vuzp1q_u32(pl, ph);
+  *hi = vuzp2q_u32(pl, ph);
+}
+
+/* Encrypt 4 counters, with the words of the counters in separate vectors. */
+static inline void rounds_neon(uint32x4_t *c, const uint32_t *key) {
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < ROUNDS; r++) {
+    if (r) {
+      k0 += W0;
+      k1 += W1;
+    }
+    uint32x4_t hi0, lo0, hi1, lo1;
+    mulhilo_neon(c[0], vdupq_n_u32(M0), &hi0, &lo0);
+    mulhilo_neon(c[2], vdupq_n_u32(M1), &hi1, &lo1);
+    c[0] = veorq_u32(veorq_u32(hi1, c[1]), vdupq_n_u32(k0));
+    c[2] = veorq_u32(veorq_u32(hi0, c[3]), vdupq_n_u32(k1));
+    c[1] = lo1;
+    c[3] = lo0;
+  }
+}
+
+static void blocks_neon(uint32_t *out, const uint32_t *ctr,
+    const uint32_t *key, const size_t n) {
+  static const uint32_t inc[4] = {0, 1, 2, 3};
+  uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    /* The carries between words are left to the scalar code. */
+    if (c[0] > UINT32_MAX - 3) blocks_scalar(out + 4 * i, c, key, 4);
+    else {
+      uint32x4_t v[4];
+      v[0] = vaddq_u32(vdupq_n_u32(c[0]), vld1q_u32(inc));
+      v[1] = vdupq_n_u32(c[1]);
+      v[2] = vdupq_n_u32(c[2]);
+      v[3] = vdupq_n_u32(c[3]);
+      rounds_neon(v, key);
+      const uint64x2_t t0 = vreinterpretq_u64_u32(vzip1q_u32(v[0], v[1]));
+      const uint64x2_t t1 = vreinterpretq_u64_u32(vzip1q_u32(v[2], v[3]));
+      const uint64x2_t t2 = vreinterpretq_u64_u32(vzip2q_u32(v[0], v[1]));
+      const uint64x2_t t3 = vreinterpretq_u64_u32(vzip2q_u32(v[2], v[3]));
+      uint32_t *dst = out + 4 * i;
+      vst1q_u32(dst, vreinterpretq_u32_u64(vzip1q_u64(t0, t1)));
+      vst1q_u32(dst + 4, vreinterpretq_u32_u64(vzip2q_u64(t0, t1)));
+      vst1q_u32(dst + 8, vreinterpretq_u32_u64(vzip1q_u64(t2, t3)));
+      vst1q_u32(dst + 12, vreinterpretq_u32_u64(vzip2q_u64(t2, t3)));
+    }
+    prand_philox4x32_ctr_add(c, 4);
+  }
+  blocks_scalar(out + 4 * i, c, key, n - i);
+}
+
+static const philox4x32_kernel_t kernel_neon = { &blocks_neon };
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `philox4x32_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const philox4x32_kernel_t *philox4x32_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("avx512f")) return &kernel_avx512;
+  if (PRAND_CPU_HAS("avx2")) return &kernel_avx2;
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return &kernel_scalar;
+}
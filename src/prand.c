@@ -31,7 +31,31 @@
 #include "prand.h"
 #include "mrg32k3a.h"
 #include "mt19937.h"
+#include "philox4x32.h"
+#include "xoshiro256pp.h"
+#include "sfmt19937.h"
+#include "dsfmt19937.h"
+#include "prand_cache.h"
+#include "prand_state.h"
 #include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Jump of a stream in `prand_jump_multi`. */
+typedef struct {
+  uint64_t step;                /* step size for jumping ahead */
+  int idx;                      /* index of the stream */
+  prand_jump_t *jmp;            /* pre-computed jump, if shared */
+} prand_multi_task_t;
+
+
+/* Maximum step size of a single jump, which is allowed by all generators. */
+#define SLICE_MAX_STEP  0x7fffffffffffffffULL
+
+/* Maximum number of jumps that cannot be doubled in the shift of a slice. */
+#define SLICE_MAX_JUMP  64
 
 /******************************************************************************
 Function `prand_init`:
@@ -53,12 +77,91 @@ prand_t *prand_init(const prand_rng_enum type, const uint64_t seed,
       return mrg32k3a_init(seed, nstream, step, err);
     case PRAND_RNG_MT19937:
       return mt19937_init(seed, nstream, step, err);
+    case PRAND_RNG_PHILOX4X32:
+      return philox4x32_init(seed, nstream, step, err);
+    case PRAND_RNG_XOSHIRO256PP:
+      return xoshiro256pp_init(seed, nstream, step, err);
+    case PRAND_RNG_SFMT19937:
+      return sfmt19937_init(seed, nstream, step, err);
+    case PRAND_RNG_DSFMT19937:
+      return dsfmt19937_init(seed, nstream, step, err);
     default:
       *err = PRAND_ERR_UNDEF_RNG;
       return NULL;
   }
 }
 
+/******************************************************************************
+Function `jump_all_mult`:
+  Jump ahead all streams by the product of two numbers, which may be larger
+  than the maximum step size, with the step size doubled for every bit of the
+  multiplier, as long as it is allowed by all generators. The shift is
+  rejected if more than `SLICE_MAX_JUMP` jumps of the largest size remain.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `n`:        the multiplier;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void jump_all_mult(prand_t *rng, uint64_t n, uint64_t step, int *err) {
+  uint64_t rem = n;
+  for (uint64_t s = step; rem && s <= (SLICE_MAX_STEP >> 1); s <<= 1)
+    rem >>= 1;
+  if (rem > SLICE_MAX_JUMP) {
+    *err = PRAND_ERR_STEP;
+    return;
+  }
+
+  for (; n && step <= (SLICE_MAX_STEP >> 1); n >>= 1, step <<= 1) {
+    if (n & 1) rng->jump_all(rng, step, err);
+    if (PRAND_IS_ERROR(*err)) return;
+  }
+  for (; n && !PRAND_IS_ERROR(*err); n--) rng->jump_all(rng, step, err);
+}
+
+/******************************************************************************
+Function `prand_init_slice`:
+  Initialisation of the interface with only a contiguous slice of streams,
+  which are identical to the ones of `prand_init` with `nstream` larger than
+  `first` + `count` - 1, without computing the streams before the slice.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `first`:    index of the first stream in the slice;
+  * `count`:    number of streams in the slice;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_init_slice(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int first, const unsigned int count, const uint64_t step,
+    int *err) {
+  if (count == 0) {
+    *err = PRAND_ERR_STREAM;
+    return NULL;
+  }
+  /* The streams are spaced as usual, with the spacing polynomial or matrix
+   * computed only once, and then shifted together to the slice. */
+  prand_t *rng = prand_init(type, seed, count, (count == 1) ? 0 : step, err);
+  if (PRAND_IS_ERROR(*err)) {
+    if (rng) prand_destroy(rng);
+    return NULL;
+  }
+
+  if (!step || first <= SLICE_MAX_STEP / step) {
+    /* A single jump for all streams, with the jump evaluated once. */
+    if (first && step) rng->jump_all(rng, (uint64_t) first * step, err);
+  }
+  else jump_all_mult(rng, first, step, err);
+
+  if (PRAND_IS_ERROR(*err) && rng) {
+    prand_destroy(rng);
+    return NULL;
+  }
+  return rng;
+}
+
 /******************************************************************************
 Function `prand_errmsg`:
   Produce error message for a given error code.
@@ -79,6 +182,30 @@ const char *prand_errmsg(const int err) {
       return "the step size for jumping ahead is too large";
     case PRAND_ERR_UNDEF_RNG:
       return "the type of the random number generator is undefined";
+    case PRAND_ERR_JUMP_TYPE:
+      return "the pre-computed jump is for another type of generator";
+    case PRAND_ERR_PARAM:
+      return "invalid parameter of the distribution";
+    case PRAND_ERR_FILE:
+      return "failed to read or write the checkpoint file";
+    case PRAND_ERR_SAVE_FORMAT:
+      return "invalid or incompatible checkpoint data";
+    case PRAND_ERR_SAVE_SIZE:
+      return "the buffer is too small for the checkpoint";
+    case PRAND_ERR_TABLE:
+      return "the table file is invalid or created with another configuration";
+    case PRAND_ERR_STREAM:
+      return "the index of the stream is out of range";
+    case PRAND_ERR_SUBSTREAM:
+      return "the substreams are not initialised";
+    case PRAND_ERR_STATS:
+      return "the library is compiled without `PRAND_STATS`";
+    case PRAND_ERR_PIPE:
+      return "invalid settings of the producer pipeline, "
+          "or failed to start the producer thread";
+    case PRAND_ERR_EVICTED:
+      return "the stream was evicted after being sampled, "
+          "and cannot be restored";
     case PRAND_WARN_SEED:
       return "invalid seed value";
     default:
@@ -86,6 +213,20 @@ const char *prand_errmsg(const int err) {
   }
 }
 
+/******************************************************************************
+Function `substream_destroy`:
+  Release memory allocated for the substreams.
+Arguments:
+  * `sub`:      the starting points of the substreams.
+******************************************************************************/
+static void substream_destroy(prand_substream_t *sub) {
+  if (!sub) return;
+  prand_jump_destroy(sub->jmp);
+  if (sub->block) prand_state_free(sub->block);
+  free(sub->start);
+  free(sub);
+}
+
 /******************************************************************************
 Function `prand_destroy`:
   Release memory allocated for the random number generator interface.
@@ -93,8 +234,202 @@ Arguments:
   * `rng`:      the instance of the random number generator.
 ******************************************************************************/
 void prand_destroy(prand_t *rng) {
-  free(rng->state);
+  substream_destroy(rng->substream);
+  prand_cache_destroy(rng->cache);
+  prand_state_free(rng->state);
   free(rng->state_stream);
   free(rng);
 }
 
+/******************************************************************************
+Function `prand_jump_destroy`:
+  Release memory allocated for a pre-computed jump.
+Arguments:
+  * `jmp`:      the pre-computed jump.
+******************************************************************************/
+void prand_jump_destroy(prand_jump_t *jmp) {
+  if (!jmp) return;
+  free(jmp->data);
+  free(jmp);
+}
+
+
+/******************************************************************************
+Function `multi_task_cmp`:
+  Compare two jumps by their step sizes, for sorting with `qsort`.
+Arguments:
+  * `a`:        pointer to the first jump;
+  * `b`:        pointer to the second jump.
+Return:
+  A negative, zero, or positive integer if the first step size is smaller,
+  equal, or larger.
+******************************************************************************/
+static int multi_task_cmp(const void *a, const void *b) {
+  const prand_multi_task_t *ta = (const prand_multi_task_t *) a;
+  const prand_multi_task_t *tb = (const prand_multi_task_t *) b;
+  if (ta->step != tb->step) return (ta->step > tb->step) ? 1 : -1;
+  return ta->idx - tb->idx;
+}
+
+/******************************************************************************
+Function `prand_jump_multi`:
+  Jump ahead for all streams, with different step sizes. The jump for a step
+  size shared by multiple streams is pre-computed only once, as well as the
+  one for the largest step size, so that all step sizes are checked before
+  any stream is altered. If the library is compiled with OpenMP, the streams
+  are distributed over threads.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step sizes for all the streams, with `rng->nstream` elements;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_jump_multi(prand_t *rng, const uint64_t *step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  const int n = rng->nstream;
+
+  /* Sort the streams by the step sizes, to find the repeated ones. */
+  prand_multi_task_t *task = malloc(sizeof(prand_multi_task_t) * n);
+  if (!task) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    task[i].step = step[i];
+    task[i].idx = i;
+    task[i].jmp = NULL;
+  }
+  qsort(task, n, sizeof(prand_multi_task_t), multi_task_cmp);
+
+  /* Pre-compute the shared jumps, and the largest one. */
+  int e = 0;
+  for (int i = 0, j; i < n; i = j) {
+    for (j = i + 1; j < n && task[j].step == task[i].step; j++);
+    if (!task[i].step || (j == i + 1 && j != n)) continue;
+    prand_jump_t *jmp = rng->jump_prepare(rng, task[i].step, &e);
+    if (PRAND_IS_ERROR(e)) break;
+    for (int k = i; k < j; k++) task[k].jmp = jmp;
+  }
+
+  /* Jump ahead for all the streams. */
+  if (!PRAND_IS_ERROR(e)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided) if (n > 1 && \
+    omp_get_max_threads() > 1 && !omp_in_parallel())
+#endif
+    for (int i = 0; i < n; i++) {
+      int ei = 0;
+      void *state = rng->state_stream[task[i].idx];
+      if (task[i].jmp) rng->jump_apply(state, task[i].jmp, &ei);
+      else rng->jump(state, task[i].step, &ei);
+      if (PRAND_IS_ERROR(ei)) {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+        e = ei;
+      }
+    }
+  }
+
+  /* Release the pre-computed jumps. */
+  for (int i = 0; i < n; i++) {
+    if (task[i].jmp && (i == n - 1 || task[i + 1].jmp != task[i].jmp))
+      prand_jump_destroy(task[i].jmp);
+  }
+  free(task);
+  if (PRAND_IS_ERROR(e)) *err = e;
+}
+
+/******************************************************************************
+Function `prand_substream_init`:
+  Split every stream into substreams with a given length, starting from the
+  current states of the streams. The jump to the next substream is
+  pre-computed only once, and the starting points of the current substreams
+  are kept with the interface.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `substep`:  length of every substream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_substream_init(prand_t *rng, const uint64_t substep, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  prand_jump_t *jmp = rng->jump_prepare(rng, substep, err);
+  if (!jmp) return;
+
+  prand_substream_t *sub = calloc(1, sizeof(prand_substream_t));
+  if (!sub) {
+    prand_jump_destroy(jmp);
+    *err = PRAND_ERR_MEMORY;
+    return;
+  }
+  sub->jmp = jmp;
+
+  size_t align;
+  sub->size = prand_state_layout(rng->type, &align);
+  if (!(sub->start = malloc(sizeof(void *) * rng->nstream)) ||
+      !(sub->block = prand_state_alloc(sub->start, sub->size, rng->nstream,
+      align))) {
+    substream_destroy(sub);
+    *err = PRAND_ERR_MEMORY;
+    return;
+  }
+  for (int i = 0; i < rng->nstream; i++)
+    memcpy(sub->start[i], rng->state_stream[i], sub->size);
+
+  substream_destroy(rng->substream);
+  rng->substream = sub;
+}
+
+/******************************************************************************
+Function `substream_check`:
+  Check the substreams and the index of the stream.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+Return:
+  The starting points of the substreams; NULL on error.
+******************************************************************************/
+static prand_substream_t *substream_check(prand_t *rng, const int i,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (!rng->substream) {
+    *err = PRAND_ERR_SUBSTREAM;
+    return NULL;
+  }
+  if (i < 0 || i >= rng->nstream) {
+    *err = PRAND_ERR_STREAM;
+    return NULL;
+  }
+  return (prand_substream_t *) rng->substream;
+}
+
+/******************************************************************************
+Function `prand_next_substream`:
+  Move a stream to the starting point of its next substream. Different
+  streams can be moved concurrently.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_next_substream(prand_t *rng, const int i, int *err) {
+  prand_substream_t *sub = substream_check(rng, i, err);
+  if (!sub) return;
+  rng->jump_apply(sub->start[i], sub->jmp, err);
+  if (PRAND_IS_ERROR(*err)) return;
+  memcpy(rng->state_stream[i], sub->start[i], sub->size);
+}
+
+/******************************************************************************
+Function `prand_reset_substream`:
+  Move a stream back to the starting point of its current substream.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_reset_substream(prand_t *rng, const int i, int *err) {
+  prand_substream_t *sub = substream_check(rng, i, err);
+  if (!sub) return;
+  memcpy(rng->state_stream[i], sub->start[i], sub->size);
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* prand_cache.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "prand_cache.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+  The pre-computed polynomials or matrices for jumping ahead are expensive to
+  evaluate, but are often requested repeatedly with only a few step sizes.
+  They are therefore kept in a small cache of each interface, and the least
+  recently used entry is replaced when the cache is full. As the cache is
+  small, it is simply searched linearly. The cache also owns a workspace, so
+  that jumps of the whole interface do not allocate memory.
+
+  The cache is only accessed by functions operating on the whole interface,
+  so it is not protected against concurrent accesses.
+*******************************************************************************/
+
+/******************************************************************************
+Function `prand_cache_init`:
+  Initialise an empty cache, together with the workspace for evaluating and
+  applying jumps with the whole interface.
+Arguments:
+  * `size`:     size of the pre-computed data for each step, in bytes;
+  * `wsize`:    size of the workspace, in bytes.
+Return:
+  The pointer to the cache on success; NULL on error.
+******************************************************************************/
+prand_cache_t *prand_cache_init(const size_t size, const size_t wsize) {
+  prand_cache_t *cache = malloc(sizeof(prand_cache_t));
+  if (!cache) return NULL;
+  cache->data = malloc(size * PRAND_CACHE_SIZE);
+  cache->work = NULL;
+  if (!cache->data || (wsize && !(cache->work = malloc(wsize)))) {
+    free(cache->data);
+    free(cache);
+    return NULL;
+  }
+  cache->size = size;
+  cache->num = 0;
+  cache->clock = 0;
+  return cache;
+}
+
+/******************************************************************************
+Function `prand_cache_find`:
+  Look up the pre-computed data for a given step size.
+Arguments:
+  * `cache`:    the cache;
+  * `step`:     the step size for jumping ahead.
+Return:
+  The pointer to the pre-computed data; NULL if the step is not cached.
+******************************************************************************/
+void *prand_cache_find(prand_cache_t *cache, const uint64_t step) {
+  for (int i = 0; i < cache->num; i++) {
+    if (cache->step[i] == step) {
+      cache->used[i] = ++cache->clock;
+      return cache->data + cache->size * i;
+    }
+  }
+  return NULL;
+}
+
+/******************************************************************************
+Function `prand_cache_insert`:
+  Reserve the space for the pre-computed data of a given step size, by
+  evicting the least recently used entry if the cache is full.
+Arguments:
+  * `cache`:    the cache;
+  * `step`:     the step size for jumping ahead.
+Return:
+  The pointer to the space for the pre-computed data, to be filled by the
+  caller.
+******************************************************************************/
+void *prand_cache_insert(prand_cache_t *cache, const uint64_t step) {
+  int idx = 0;
+  if (cache->num < PRAND_CACHE_SIZE) idx = cache->num++;
+  else {
+    for (int i = 1; i < PRAND_CACHE_SIZE; i++)
+      if (cache->used[i] < cache->used[idx]) idx = i;
+  }
+  cache->step[idx] = step;
+  cache->used[idx] = ++cache->clock;
+  return cache->data + cache->size * idx;
+}
+
+/******************************************************************************
+Function `prand_cache_destroy`:
+  Release memory allocated for the cache.
+Arguments:
+  * `cache`:    the cache.
+******************************************************************************/
+void prand_cache_destroy(prand_cache_t *cache) {
+  if (!cache) return;
+  free(cache->work);
+  free(cache->data);
+  free(cache);
+}
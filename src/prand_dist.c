@@ -0,0 +1,280 @@
+/*******************************************************************************
+* prand_dist.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "prand.h"
+#include "prand_math.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+  Sampling from non-uniform distributions by inversion. Every output is
+  generated from exactly one uniform number, so the results of a stream do
+  not depend on how the numbers are requested. The uniform numbers are
+  generated in batch, and transformed in place by the vectorised kernels.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+/* Number of uniform numbers generated at one time for the look-up tables. */
+#define DIST_CHUNK              256
+/* Probabilities below this threshold are omitted by the Poisson table. */
+#define POISSON_TAIL            1e-20
+
+
+/*============================================================================*\
+                       Functions for continuous distributions
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_fill_exp`:
+  Generate an array of numbers following the exponential distribution with
+  unit mean, from the numbers of `rng->get_double_pos`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+void prand_fill_exp(prand_t *rng, void *state, double *out, const size_t n) {
+  rng->fill_double_pos(state, out, n);
+  prand_math_kernel()->neg_log(out, n);
+}
+
+/******************************************************************************
+Function `prand_fill_normal`:
+  Generate an array of numbers following the standard normal distribution,
+  with the inverse of the cumulative distribution function, from the numbers
+  of `rng->get_double_pos`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+void prand_fill_normal(prand_t *rng, void *state, double *out, const size_t n) {
+  rng->fill_double_pos(state, out, n);
+  prand_math_kernel()->norm_icdf(out, n);
+}
+
+
+/*============================================================================*\
+                       Functions for discrete distributions
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_fill_uint`:
+  Generate an array of integers in the range [0,range), with the
+  multiply-shift method, from the numbers of `rng->get`. The integers are not
+  exactly uniform, with a relative bias below
+  range / (rng->max - rng->min + 1).
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `range`:    the upper bound (exclusive) of the integers, must be in the
+                range [1, rng->max - rng->min + 1];
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_fill_uint(prand_t *rng, void *state, uint64_t *out, const size_t n,
+    const uint64_t range, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  /* The integers of all generators have at most 32 bits. */
+  const uint64_t span = rng->max - rng->min + 1;
+  if (!range || range > span) {
+    *err = PRAND_ERR_PARAM;
+    return;
+  }
+
+  rng->fill(state, out, n);
+  const uint64_t min = rng->min;
+  if (span & (span - 1)) {
+    for (size_t i = 0; i < n; i++) out[i] = (out[i] - min) * range / span;
+  }
+  else {
+    int shift = 0;
+    while ((UINT64_C(1) << shift) < span) shift++;
+    for (size_t i = 0; i < n; i++) out[i] = ((out[i] - min) * range) >> shift;
+  }
+}
+
+/******************************************************************************
+Function `poisson_table`:
+  Construct the look-up table of the cumulative distribution function for
+  the Poisson distribution, starting from the mode, to avoid underflows.
+Arguments:
+  * `pois`:     the table to be filled, with the mean value set.
+Return:
+  Zero on success; non-zero on error.
+******************************************************************************/
+static int poisson_table(prand_poisson_t *pois) {
+  const double mean = pois->mean;
+  const uint64_t mode = (uint64_t) mean;
+  uint64_t kmin = mode, kmax = mode;
+  double w = 1;
+  while (kmin > 0 && (w *= kmin / mean) > POISSON_TAIL) kmin--;
+  w = 1;
+  while ((w *= mean / (kmax + 1)) > POISSON_TAIL) kmax++;
+
+  const size_t num = kmax - kmin + 1;
+  double *cdf = malloc(sizeof(double) * num);
+  size_t *gd = malloc(sizeof(size_t) * num);
+  if (!cdf || !gd) {
+    free(cdf);
+    free(gd);
+    return 1;
+  }
+
+  /* Probabilities relative to that of the mode. */
+  const size_t imode = mode - kmin;
+  cdf[imode] = 1;
+  for (size_t i = imode; i > 0; i--) cdf[i - 1] = cdf[i] * (kmin + i) / mean;
+  for (size_t i = imode + 1; i < num; i++)
+    cdf[i] = cdf[i - 1] * mean / (kmin + i);
+
+  double sum = 0;
+  for (size_t i = 0; i < num; i++) {
+    sum += cdf[i];
+    cdf[i] = sum;
+  }
+  for (size_t i = 0; i < num - 1; i++) cdf[i] /= sum;
+  cdf[num - 1] = 1;
+
+  /* The search for the number u starts from guide[(int) (u * num)]. */
+  for (size_t i = 0, k = 0; i < num; i++) {
+    while (cdf[k] <= (double) i / num) k++;
+    gd[i] = k;
+  }
+
+  pois->lo = kmin;
+  pois->len = num;
+  pois->cdf = cdf;
+  pois->guide = gd;
+  return 0;
+}
+
+/******************************************************************************
+Function `prand_poisson_prepare`:
+  Construct the look-up table of the Poisson distribution with a given mean,
+  to be reused by `prand_fill_poisson_prepared`.
+Arguments:
+  * `mean`:     the mean value, must be in the range
+                (0, PRAND_POISSON_MAX_MEAN];
+  * `err`:      an integer for storing the error message.
+Return:
+  The address of the table on success; NULL on error.
+******************************************************************************/
+prand_poisson_t *prand_poisson_prepare(const double mean, int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (!(mean > 0 && mean <= PRAND_POISSON_MAX_MEAN)) {
+    *err = PRAND_ERR_PARAM;
+    return NULL;
+  }
+
+  prand_poisson_t *pois = malloc(sizeof(prand_poisson_t));
+  if (!pois) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  pois->mean = mean;
+  if (poisson_table(pois)) {
+    free(pois);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  return pois;
+}
+
+/******************************************************************************
+Function `prand_fill_poisson_prepared`:
+  Generate an array of integers following the Poisson distribution, by
+  inverting a pre-computed look-up table, from the numbers of
+  `rng->get_double`.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `pois`:     the look-up table from `prand_poisson_prepare`.
+******************************************************************************/
+void prand_fill_poisson_prepared(prand_t *rng, void *state, uint64_t *out,
+    const size_t n, const prand_poisson_t *pois) {
+  const double *cdf = pois->cdf;
+  const size_t *guide = pois->guide;
+  const size_t len = pois->len;
+  double u[DIST_CHUNK];
+  for (size_t i = 0; i < n; i += DIST_CHUNK) {
+    const size_t num = (n - i < DIST_CHUNK) ? n - i : DIST_CHUNK;
+    rng->fill_double(state, u, num);
+    for (size_t j = 0; j < num; j++) {
+      size_t g = u[j] * len;
+      if (g >= len) g = len - 1;
+      size_t k = guide[g];
+      while (u[j] >= cdf[k]) k++;
+      out[i + j] = pois->lo + k;
+    }
+  }
+}
+
+/******************************************************************************
+Function `prand_poisson_destroy`:
+  Release memory allocated for the look-up table of the Poisson distribution.
+Arguments:
+  * `pois`:     the look-up table.
+******************************************************************************/
+void prand_poisson_destroy(prand_poisson_t *pois) {
+  if (!pois) return;
+  free(pois->cdf);
+  free(pois->guide);
+  free(pois);
+}
+
+/******************************************************************************
+Function `prand_fill_poisson`:
+  Generate an array of integers following the Poisson distribution, by
+  inverting the look-up table of the cumulative distribution function, from
+  the numbers of `rng->get_double`. The table is constructed for every call.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream to be sampled;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated;
+  * `mean`:     the mean value, must be in the range
+                (0, PRAND_POISSON_MAX_MEAN];
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_fill_poisson(prand_t *rng, void *state, uint64_t *out,
+    const size_t n, const double mean, int *err) {
+  prand_poisson_t *pois = prand_poisson_prepare(mean, err);
+  if (!pois) return;
+  prand_fill_poisson_prepared(rng, state, out, n, pois);
+  prand_poisson_destroy(pois);
+}
@@ -0,0 +1,507 @@
+/*******************************************************************************
+* prand_lazy.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "prand.h"
+#include "prand_state.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+  Streams materialised on first access. Only the starting state of the first
+  stream is kept, together with the pre-computed jumps for the steps
+  `step` * 2^b, so that the starting state of the i-th stream is computed
+  with at most log2(`nstream`) jumps, following the binary representation of
+  i, and the results are identical to the ones of `prand_init`. The states
+  acquired by the caller are reference counted. The released ones are kept
+  in the order of release, and the least recently released one is evicted
+  once there are more than `max_idle` of them. As the position of an evicted
+  stream is unknown, a fingerprint of every state is taken when it is
+  materialised, and the streams evicted with modified states are marked, so
+  that they are never silently restarted. Streams can also be compacted
+  explicitly, i.e., their states are freed with only their positions kept,
+  and they are materialised at the positions with one more jump.
+
+  If the library is compiled with OpenMP, the bookkeeping is protected by a
+  lock, while the jumps are done without holding it, so that different
+  streams are materialised concurrently. If the same stream is materialised
+  by two threads at the same time, the state computed later is discarded.
+  If the stream is materialised, and then evicted or compacted by others
+  during the jumps, the computed state is outdated, which is detected by the
+  number of times the state has been freed, and the stream is looked up
+  again.
+*******************************************************************************/
+
+/*============================================================================*\
+                  Definition of the lazily materialised streams
+\*============================================================================*/
+
+#define LAZY_NONE       UINT_MAX        /* end of the list of idle streams */
+#define LAZY_MAX_JUMP   64              /* maximum number of jumps */
+
+typedef struct {
+  void **state;                 /* states of the streams; NULL if not in use */
+  unsigned int *ref;            /* number of acquisitions of the streams */
+  unsigned int *prev;           /* previous stream in the idle list */
+  unsigned int *next;           /* next stream in the idle list */
+  unsigned int head;            /* the least recently released idle stream */
+  unsigned int tail;            /* the most recently released idle stream */
+  unsigned int nidle;           /* number of idle streams in memory */
+  uint64_t *offset;             /* positions of the compacted streams, or
+                                   NULL if no stream has been compacted */
+  uint64_t *hash;               /* fingerprints of the materialised states */
+  uint64_t *gen;                /* number of times the states were freed */
+  unsigned char *evicted;       /* flags of the streams evicted after being
+                                   sampled, which cannot be restored */
+  size_t size;                  /* size of each state, in bytes */
+  size_t align;                 /* alignment of each state, in bytes */
+  int njump;                    /* number of pre-computed jumps */
+  prand_jump_t *jump[LAZY_MAX_JUMP];    /* jumps for `step` * 2^b */
+#ifdef _OPENMP
+  omp_lock_t lock;              /* lock for the bookkeeping */
+#endif
+} prand_lazy_data_t;
+
+
+/*============================================================================*\
+                      Functions for the bookkeeping of states
+\*============================================================================*/
+
+/******************************************************************************
+Function `lazy_lock`:
+  Acquire the lock for the bookkeeping, if the library is compiled with
+  OpenMP.
+Arguments:
+  * `d`:        the bookkeeping of the states.
+******************************************************************************/
+static inline void lazy_lock(prand_lazy_data_t *d) {
+#ifdef _OPENMP
+  omp_set_lock(&d->lock);
+#else
+  (void) d;
+#endif
+}
+
+/******************************************************************************
+Function `lazy_unlock`:
+  Release the lock for the bookkeeping, if the library is compiled with
+  OpenMP.
+Arguments:
+  * `d`:        the bookkeeping of the states.
+******************************************************************************/
+static inline void lazy_unlock(prand_lazy_data_t *d) {
+#ifdef _OPENMP
+  omp_unset_lock(&d->lock);
+#else
+  (void) d;
+#endif
+}
+
+/******************************************************************************
+Function `idle_remove`:
+  Remove a stream from the list of idle streams.
+Arguments:
+  * `d`:        the bookkeeping of the states;
+  * `i`:        index of the stream.
+******************************************************************************/
+static void idle_remove(prand_lazy_data_t *d, const unsigned int i) {
+  if (d->prev[i] != LAZY_NONE) d->next[d->prev[i]] = d->next[i];
+  else d->head = d->next[i];
+  if (d->next[i] != LAZY_NONE) d->prev[d->next[i]] = d->prev[i];
+  else d->tail = d->prev[i];
+  d->nidle--;
+}
+
+/******************************************************************************
+Function `idle_append`:
+  Append a stream to the end of the list of idle streams.
+Arguments:
+  * `d`:        the bookkeeping of the states;
+  * `i`:        index of the stream.
+******************************************************************************/
+static void idle_append(prand_lazy_data_t *d, const unsigned int i) {
+  d->prev[i] = d->tail;
+  d->next[i] = LAZY_NONE;
+  if (d->tail != LAZY_NONE) d->next[d->tail] = i;
+  else d->head = i;
+  d->tail = i;
+  d->nidle++;
+}
+
+/******************************************************************************
+Function `state_hash`:
+  Compute the FNV-1a fingerprint of a state, for detecting whether the state
+  has been sampled since it was materialised.
+Arguments:
+  * `state`:    the state;
+  * `size`:     size of the state, in bytes.
+Return:
+  The fingerprint.
+******************************************************************************/
+static uint64_t state_hash(const void *state, const size_t size) {
+  const unsigned char *p = (const unsigned char *) state;
+  uint64_t h = UINT64_C(0xcbf29ce484222325);
+  for (size_t k = 0; k < size; k++) {
+    h ^= p[k];
+    h *= UINT64_C(0x100000001b3);
+  }
+  return h;
+}
+
+/******************************************************************************
+Function `stream_acquire`:
+  Increase the reference count of a stream in memory, with the lock held.
+Arguments:
+  * `d`:        the bookkeeping of the states;
+  * `i`:        index of the stream.
+Return:
+  The state of the stream.
+******************************************************************************/
+static void *stream_acquire(prand_lazy_data_t *d, const unsigned int i) {
+  if (d->ref[i]++ == 0) idle_remove(d, i);
+  return d->state[i];
+}
+
+/******************************************************************************
+Function `stream_skip`:
+  Advance a state by an arbitrary number of steps, with two jumps of half
+  the length if it exceeds the maximum step size of the generator.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state to be advanced;
+  * `offset`:   the number of steps;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void stream_skip(prand_t *rng, void *state, const uint64_t offset,
+    int *err) {
+  int e = 0;
+  rng->jump(state, offset, &e);
+  if (e == PRAND_ERR_STEP) {
+    e = 0;
+    rng->jump(state, offset >> 1, &e);
+    rng->jump(state, offset >> 1, &e);
+    rng->jump(state, offset & 1, &e);
+  }
+  if (PRAND_IS_ERROR(e)) *err = e;
+}
+
+/******************************************************************************
+Function `stream_compute`:
+  Compute the state of a stream at a given position, from the starting state
+  of the first stream.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream;
+  * `offset`:   position of the stream, relative to its starting point;
+  * `err`:      an integer for storing the error message.
+Return:
+  The newly allocated state; NULL on error.
+******************************************************************************/
+static void *stream_compute(prand_lazy_t *lz, const unsigned int i,
+    const uint64_t offset, int *err) {
+  prand_lazy_data_t *d = (prand_lazy_data_t *) lz->data;
+  void *state;
+  if (!prand_state_alloc(&state, d->size, 1, d->align)) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  memcpy(state, lz->rng->state, d->size);
+
+  /* The largest jump is applied repeatedly if `step` * i overflows. */
+  if (i && d->njump) {
+    const int top = d->njump - 1;
+    for (unsigned int n = i >> top; n; n--)
+      lz->rng->jump_apply(state, d->jump[top], err);
+    for (int b = 0; b < top; b++) {
+      if ((i >> b) & 1) lz->rng->jump_apply(state, d->jump[b], err);
+    }
+  }
+  if (offset) stream_skip(lz->rng, state, offset, err);
+
+  if (PRAND_IS_ERROR(*err)) {
+    prand_state_free(state);
+    return NULL;
+  }
+  return state;
+}
+
+
+/*============================================================================*\
+                        Interfaces of the lazy streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_lazy_destroy`:
+  Release memory allocated for the lazily materialised streams.
+Arguments:
+  * `lz`:       the lazily materialised streams.
+******************************************************************************/
+void prand_lazy_destroy(prand_lazy_t *lz) {
+  if (!lz) return;
+  prand_lazy_data_t *d = (prand_lazy_data_t *) lz->data;
+  if (d) {
+    if (d->state) {
+      for (unsigned int i = 0; i < lz->nstream; i++)
+        if (d->state[i]) prand_state_free(d->state[i]);
+      free(d->state);
+    }
+    free(d->ref);
+    free(d->prev);
+    free(d->next);
+    free(d->offset);
+    free(d->hash);
+    free(d->gen);
+    free(d->evicted);
+    for (int b = 0; b < d->njump; b++) prand_jump_destroy(d->jump[b]);
+#ifdef _OPENMP
+    omp_destroy_lock(&d->lock);
+#endif
+    free(d);
+  }
+  if (lz->rng) prand_destroy(lz->rng);
+  free(lz);
+}
+
+/******************************************************************************
+Function `prand_init_lazy`:
+  Initialisation of streams that are materialised only on first access, with
+  the same starting states as the ones of `prand_init`.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `max_idle`: maximum number of released streams kept in memory;
+  * `err`:      an integer for storing the error message.
+Return:
+  The lazily materialised streams; NULL on error.
+******************************************************************************/
+prand_lazy_t *prand_init_lazy(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int nstream, const uint64_t step,
+    const unsigned int max_idle, int *err) {
+  /* The state of the first stream is not jumped. */
+  prand_t *rng = prand_init(type, seed, 1, 0, err);
+  if (PRAND_IS_ERROR(*err)) {
+    if (rng) prand_destroy(rng);
+    return NULL;
+  }
+
+  prand_lazy_t *lz = malloc(sizeof(prand_lazy_t));
+  prand_lazy_data_t *d = calloc(1, sizeof(prand_lazy_data_t));
+  if (!lz || !d) {
+    prand_destroy(rng);
+    free(lz);
+    free(d);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  lz->rng = rng;
+  lz->nstream = (nstream == 0) ? 1 : nstream;
+  lz->step = step;
+  lz->max_idle = max_idle;
+  lz->data = d;
+#ifdef _OPENMP
+  omp_init_lock(&d->lock);
+#endif
+
+  d->head = d->tail = LAZY_NONE;
+  d->size = prand_state_layout(type, &d->align);
+  d->state = calloc(lz->nstream, sizeof(void *));
+  d->ref = calloc(lz->nstream, sizeof(unsigned int));
+  d->prev = malloc(sizeof(unsigned int) * lz->nstream);
+  d->next = malloc(sizeof(unsigned int) * lz->nstream);
+  d->hash = malloc(sizeof(uint64_t) * lz->nstream);
+  d->gen = calloc(lz->nstream, sizeof(uint64_t));
+  d->evicted = calloc(lz->nstream, sizeof(unsigned char));
+  if (!d->state || !d->ref || !d->prev || !d->next || !d->hash || !d->gen ||
+      !d->evicted) {
+    prand_lazy_destroy(lz);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  /* Pre-compute the jumps for all the bits of the stream indices, until the
+   * step size overflows or exceeds the limit of the generator. The first
+   * one is always computed, for validating the step size. */
+  if (step) {
+    const uint64_t imax = lz->nstream - 1;
+    for (int b = 0; b < LAZY_MAX_JUMP && (!b || (imax >> b)); b++) {
+      if (b && (step << b) >> b != step) break;
+      int e = 0;
+      prand_jump_t *jmp = rng->jump_prepare(rng, step << b, &e);
+      if (e == PRAND_ERR_STEP && b) break;
+      if (PRAND_IS_ERROR(e)) {
+        prand_lazy_destroy(lz);
+        *err = e;
+        return NULL;
+      }
+      d->jump[d->njump++] = jmp;
+    }
+  }
+  return lz;
+}
+
+/******************************************************************************
+Function `prand_lazy_stream`:
+  Acquire the state of a stream, which is computed if it is not in memory.
+  If the library is compiled with OpenMP, it can be called concurrently.
+  A stream evicted after being sampled is not restarted, and the error
+  `PRAND_ERR_EVICTED` is reported instead.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream;
+  * `err`:      an integer for storing the error message.
+Return:
+  The state of the stream; NULL on error.
+******************************************************************************/
+void *prand_lazy_stream(prand_lazy_t *lz, const unsigned int i, int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (i >= lz->nstream) {
+    *err = PRAND_ERR_STREAM;
+    return NULL;
+  }
+  prand_lazy_data_t *d = (prand_lazy_data_t *) lz->data;
+
+  lazy_lock(d);
+  for (;;) {
+    if (d->state[i]) {
+      void *state = stream_acquire(d, i);
+      lazy_unlock(d);
+      return state;
+    }
+    if (d->evicted[i]) {
+      lazy_unlock(d);
+      *err = PRAND_ERR_EVICTED;
+      return NULL;
+    }
+    const uint64_t offset = d->offset ? d->offset[i] : 0;
+    const uint64_t gen = d->gen[i];
+    lazy_unlock(d);
+
+    /* Jump ahead without holding the lock. */
+    void *state = stream_compute(lz, i, offset, err);
+    if (!state) return NULL;
+    const uint64_t hash = state_hash(state, d->size);
+
+    lazy_lock(d);
+    /* Unless the state has been freed meanwhile, it is up to date, or
+     * materialised by another thread and still in memory. */
+    if (d->gen[i] == gen) {
+      if (d->state[i]) {
+        prand_state_free(state);
+        state = stream_acquire(d, i);
+      }
+      else {
+        d->state[i] = state;
+        d->ref[i] = 1;
+        d->hash[i] = hash;
+      }
+      lazy_unlock(d);
+      return state;
+    }
+    prand_state_free(state);
+  }
+}
+
+/******************************************************************************
+Function `prand_lazy_release`:
+  Release a stream acquired by `prand_lazy_stream`. Once a stream is not
+  acquired anymore, its state may be evicted. An evicted stream that has
+  not been sampled restarts from its starting point, or the position
+  recorded by `prand_lazy_compact`, on the next access, while the access of
+  one that has been sampled fails, instead of replaying its numbers.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream.
+******************************************************************************/
+void prand_lazy_release(prand_lazy_t *lz, const unsigned int i) {
+  if (i >= lz->nstream) return;
+  prand_lazy_data_t *d = (prand_lazy_data_t *) lz->data;
+
+  lazy_lock(d);
+  if (d->state[i] && d->ref[i] && --d->ref[i] == 0) {
+    idle_append(d, i);
+    /* Evict the least recently released streams. */
+    while (d->nidle > lz->max_idle) {
+      const unsigned int j = d->head;
+      idle_remove(d, j);
+      if (state_hash(d->state[j], d->size) != d->hash[j]) d->evicted[j] = 1;
+      prand_state_free(d->state[j]);
+      d->state[j] = NULL;
+      d->gen[j]++;
+    }
+  }
+  lazy_unlock(d);
+}
+
+/******************************************************************************
+Function `prand_lazy_compact`:
+  Release a stream acquired only by the caller, and free its state at once,
+  keeping only its position. On the next access, the stream is materialised
+  at `offset` steps after its starting point, with one more jump. A cached
+  Gaussian number is discarded.
+Arguments:
+  * `lz`:       the lazily materialised streams;
+  * `i`:        index of the stream;
+  * `offset`:   position of the stream, i.e., the number of steps consumed
+                since its starting point;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_lazy_compact(prand_lazy_t *lz, const unsigned int i,
+    const uint64_t offset, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (i >= lz->nstream) {
+    *err = PRAND_ERR_STREAM;
+    return;
+  }
+  prand_lazy_data_t *d = (prand_lazy_data_t *) lz->data;
+
+  lazy_lock(d);
+  /* The state cannot be freed if it is shared with other callers. */
+  if (!d->state[i] || d->ref[i] != 1) {
+    lazy_unlock(d);
+    *err = PRAND_ERR_STREAM;
+    return;
+  }
+  if (!d->offset && !(d->offset = calloc(lz->nstream, sizeof(uint64_t)))) {
+    lazy_unlock(d);
+    *err = PRAND_ERR_MEMORY;
+    return;
+  }
+  d->offset[i] = offset;
+  d->ref[i] = 0;
+  prand_state_free(d->state[i]);
+  d->state[i] = NULL;
+  d->gen[i]++;
+  lazy_unlock(d);
+}
@@ -0,0 +1,1055 @@
+/*******************************************************************************
+* prand_math.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "prand_math.h"
+#include "prand_cpu.h"
+#include <stdint.h>
+#include <string.h>
+
+/*******************************************************************************
+  Kernels for transforming uniform numbers into other distributions, i.e.,
+  Gaussian numbers with the Box-Muller method:
+    z0 = sqrt(-2 ln u1) cos(2 pi u2),  z1 = sqrt(-2 ln u1) sin(2 pi u2),
+  exponential numbers with -ln(u), and Gaussian numbers with the inverse of
+  the normal CDF, using the rational approximations of Wichura (1988).
+
+  The logarithm and the trigonometric functions are evaluated with the
+  polynomial approximations of fdlibm (with errors below 1 ulp), and the
+  square root is computed by Newton iterations of the reciprocal square root.
+  Only IEEE 754 additions, multiplications, divisions, and bit operations are
+  used, in the same order for all the kernels, so the vectorised kernels
+  produce results that are identical to those of the scalar code, and no
+  function from the math library is required.
+
+  This requires that the compiler does not contract multiplications and
+  additions into fused multiply-add instructions, which is the default for
+  ISO C (e.g. `-std=c99`) with GCC.
+*******************************************************************************/
+
+#ifdef __clang__
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+/* Magic numbers for extracting the exponent of a floating-point number. */
+#define EXP_BITS        0x4330000000000000ULL   /* 2^52 */
+#define EXP_BIAS        0x1.00000000003ffp52    /* 2^52 + 1023 */
+#define MANT_MASK       0x000fffffffffffffULL
+#define ONE_BITS        0x3ff0000000000000ULL   /* 1.0 */
+#define SQRT2           0x1.6a09e667f3bcdp0
+
+/* Coefficients for the logarithm. */
+#define LN2_HI          6.93147180369123816490e-01
+#define LN2_LO          1.90821492927058770002e-10
+#define LG1             6.666666666666735130e-01
+#define LG2             3.999999999940941908e-01
+#define LG3             2.857142874366239149e-01
+#define LG4             2.222219843214978396e-01
+#define LG5             1.818357216161805012e-01
+#define LG6             1.531383769920937332e-01
+#define LG7             1.479819860511658591e-01
+
+/* Magic number for rounding double-precision numbers to integers. */
+#define ROUND_MAGIC     0x1.8p52
+#define PIO2            0x1.921fb54442d18p0     /* pi / 2 */
+
+/* Coefficients for the sine function in [-pi/4, pi/4]. */
+#define S1              (-1.66666666666666324348e-01)
+#define S2              8.33333333332248946124e-03
+#define S3              (-1.98412698298579493134e-04)
+#define S4              2.75573137070700676789e-06
+#define S5              (-2.50507602534068634195e-08)
+#define S6              1.58969099521155010221e-10
+
+/* Coefficients for the cosine function in [-pi/4, pi/4]. */
+#define C1              4.16666666666666019037e-02
+#define C2              (-1.38888888888741095749e-03)
+#define C3              2.48015872894767294178e-05
+#define C4              (-2.75573143513906633035e-07)
+#define C5              2.08757232129817482790e-09
+#define C6              (-1.13596475577881948265e-11)
+
+/* Magic number for the initial guess of the reciprocal square root. */
+#define RSQRT_MAGIC     0x5fe6eb50c7b537a9ULL
+#define RSQRT_ITER      4
+
+/* Constants for the inverse of the standard normal CDF, see
+ * Wichura 1988, Algorithm AS 241, Appl. Statist. 37(3):477. */
+#define ICDF_CONST1     0.180625                /* 0.425^2 */
+#define ICDF_CONST2     1.6
+#define ICDF_SPLIT2     5.0
+#define ICDF_DEG        7
+
+/* Coefficients for |p - 0.5| <= 0.425. */
+static const double icdf_a[ICDF_DEG + 1] = {
+  3.3871328727963666080e0, 1.3314166789178437745e+2,
+  1.9715909503065514427e+3, 1.3731693765509461125e+4,
+  4.5921953931549871457e+4, 6.7265770927008700853e+4,
+  3.3430575583588128105e+4, 2.5090809287301226727e+3
+};
+static const double icdf_b[ICDF_DEG + 1] = {
+  1.0, 4.2313330701600911252e+1,
+  6.8718700749205790830e+2, 5.3941960214247511077e+3,
+  2.1213794301586595867e+4, 3.9307895800092710610e+4,
+  2.8729085735721942674e+4, 5.2264952788528545610e+3
+};
+/* Coefficients for r = sqrt(-ln(min(p, 1 - p))) <= 5. */
+static const double icdf_c[ICDF_DEG + 1] = {
+  1.42343711074968357734e0, 4.63033784615654529590e0,
+  5.76949722146069140550e0, 3.64784832476320460504e0,
+  1.27045825245236838258e0, 2.41780725177450611770e-1,
+  2.27238449892691845833e-2, 7.74545014278341407640e-4
+};
+static const double icdf_d[ICDF_DEG + 1] = {
+  1.0, 2.05319162663775882187e0,
+  1.67638483018380384940e0, 6.89767334985100004550e-1,
+  1.48103976427480074590e-1, 1.51986665636164571966e-2,
+  5.47593808499534494600e-4, 1.05075007164441684324e-9
+};
+/* Coefficients for r > 5. */
+static const double icdf_e[ICDF_DEG + 1] = {
+  6.65790464350110377720e0, 5.46378491116411436990e0,
+  1.78482653991729133580e0, 2.96560571828504891230e-1,
+  2.65321895265761230930e-2, 1.24266094738807843860e-3,
+  2.71155556874348757815e-5, 2.01033439929228813265e-7
+};
+static const double icdf_f[ICDF_DEG + 1] = {
+  1.0, 5.99832206555887937690e-1,
+  1.36929880922735805310e-1, 1.48753612908506148525e-2,
+  7.86869131145613259100e-4, 1.84631831751005468180e-5,
+  1.42151175831644588870e-7, 2.04426310338993978564e-15
+};
+
+
+/*============================================================================*\
+                                 Scalar kernels
+\*============================================================================*/
+
+static inline uint64_t dbl2bits(const double x) {
+  uint64_t b;
+  memcpy(&b, &x, sizeof(double));
+  return b;
+}
+
+static inline double bits2dbl(const uint64_t b) {
+  double x;
+  memcpy(&x, &b, sizeof(double));
+  return x;
+}
+
+/******************************************************************************
+Function `log_scalar`:
+  Compute the natural logarithm of a positive normal number.
+Arguments:
+  * `x`:        the input number.
+Return:
+  ln(x).
+******************************************************************************/
+static inline double log_scalar(const double x) {
+  const uint64_t b = dbl2bits(x);
+  /* x = 2^e * m, with m in [sqrt(2)/2, sqrt(2)). */
+  double e = bits2dbl((b >> 52) | EXP_BITS) - EXP_BIAS;
+  double m = bits2dbl((b & MANT_MASK) | ONE_BITS);
+  if (m > SQRT2) {
+    m *= 0.5;
+    e += 1.0;
+  }
+  const double f = m - 1.0;
+  const double s = f / (2.0 + f);
+  const double z = s * s;
+  const double w = z * z;
+  const double t1 = w * (LG2 + w * (LG4 + w * LG6));
+  const double t2 = z * (LG1 + w * (LG3 + w * (LG5 + w * LG7)));
+  const double r = t2 + t1;
+  const double hfsq = 0.5 * f * f;
+  return e * LN2_HI - ((hfsq - (s * (hfsq + r) + e * LN2_LO)) - f);
+}
+
+/******************************************************************************
+Function `sincos_scalar`:
+  Compute cos(2 pi u) and sin(2 pi u).
+Arguments:
+  * `u`:        the input number in the range [0,1];
+  * `c`:        the cosine on output;
+  * `s`:        the sine on output.
+******************************************************************************/
+static inline void sincos_scalar(const double u, double *c, double *s) {
+  /* 2 pi u = q * pi / 2 + x, with x in [-pi/4, pi/4]. */
+  const double t = u * 4.0;
+  const double y = t + ROUND_MAGIC;
+  const uint64_t q = dbl2bits(y);
+  const double x = (t - (y - ROUND_MAGIC)) * PIO2;
+  const double z = x * x;
+
+  const double v = z * x;
+  const double ps = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+  const double sn = x + v * (S1 + z * ps);
+
+  const double pc = z * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 +
+      z * C6)))));
+  const double hz = 0.5 * z;
+  const double w = 1.0 - hz;
+  const double cs = w + (((1.0 - w) - hz) + z * pc);
+
+  /* Rotate by q * pi / 2. */
+  uint64_t bc = dbl2bits((q & 1) ? sn : cs);
+  uint64_t bs = dbl2bits((q & 1) ? cs : sn);
+  bc ^= ((q + 1) & 2) << 62;
+  bs ^= (q & 2) << 62;
+  *c = bits2dbl(bc);
+  *s = bits2dbl(bs);
+}
+
+/******************************************************************************
+Function `sqrt_scalar`:
+  Compute the square root of a positive normal number.
+Arguments:
+  * `a`:        the input number.
+Return:
+  sqrt(a).
+******************************************************************************/
+static inline double sqrt_scalar(const double a) {
+  const double h = 0.5 * a;
+  double y = bits2dbl(RSQRT_MAGIC - (dbl2bits(a) >> 1));
+  for (int i = 0; i < RSQRT_ITER; i++) y = y * (1.5 - h * y * y);
+  return a * y;
+}
+
+/******************************************************************************
+Function `radius_scalar`:
+  Compute sqrt(-2 ln u).
+Arguments:
+  * `u`:        the input number in the range (0,1).
+Return:
+  The radius of the Box-Muller transformation.
+******************************************************************************/
+static inline double radius_scalar(const double u) {
+  return sqrt_scalar(-2.0 * log_scalar(u));
+}
+
+/******************************************************************************
+Function `poly_scalar`:
+  Evaluate a polynomial of degree `ICDF_DEG` with the Horner scheme.
+Arguments:
+  * `x`:        the variable;
+  * `c`:        the coefficients, from the constant term.
+Return:
+  The value of the polynomial.
+******************************************************************************/
+static inline double poly_scalar(const double x, const double *c) {
+  double p = c[ICDF_DEG];
+  for (int i = ICDF_DEG - 1; i >= 0; i--) p = p * x + c[i];
+  return p;
+}
+
+/******************************************************************************
+Function `icdf_scalar`:
+  Compute the inverse of the standard normal CDF.
+Arguments:
+  * `p`:        the input number in the range (0,1).
+Return:
+  The quantile of the standard normal distribution.
+******************************************************************************/
+static inline double icdf_scalar(const double p) {
+  const double q = p - 0.5;
+  double r = ICDF_CONST1 - q * q;
+  if (r >= 0) return q * poly_scalar(r, icdf_a) / poly_scalar(r, icdf_b);
+
+  r = sqrt_scalar(-log_scalar((q < 0) ? p : 1.0 - p));
+  double x;
+  if (r <= ICDF_SPLIT2) {
+    r -= ICDF_CONST2;
+    x = poly_scalar(r, icdf_c) / poly_scalar(r, icdf_d);
+  }
+  else {
+    r -= ICDF_SPLIT2;
+    x = poly_scalar(r, icdf_e) / poly_scalar(r, icdf_f);
+  }
+  return (q < 0) ? -x : x;
+}
+
+/******************************************************************************
+Function `prand_box_muller`:
+  Transform pairs of uniform numbers into Gaussian numbers with the
+  Box-Muller method, using the scalar code. The results are identical to those
+  of the vectorised kernels.
+Arguments:
+  * `z`:        the uniform numbers in (0,1) on input, and the Gaussian numbers
+                on output, with 2 * `npair` elements;
+  * `npair`:    the number of pairs.
+******************************************************************************/
+void prand_box_muller(double *z, const size_t npair) {
+  for (size_t i = 0; i < npair; i++) {
+    double c, s;
+    const double r = radius_scalar(z[2 * i]);
+    sincos_scalar(z[2 * i + 1], &c, &s);
+    z[2 * i] = r * c;
+    z[2 * i + 1] = r * s;
+  }
+}
+
+static void neg_log_scalar(double *x, const size_t n) {
+  for (size_t i = 0; i < n; i++) x[i] = -log_scalar(x[i]);
+}
+
+static void norm_icdf_scalar(double *x, const size_t n) {
+  for (size_t i = 0; i < n; i++) x[i] = icdf_scalar(x[i]);
+}
+
+static const prand_math_kernel_t kernel_scalar = {
+  &prand_box_muller, &neg_log_scalar, &norm_icdf_scalar
+};
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+PRAND_TARGET("sse2")
+static inline __m128d log_sse2(const __m128d x) {
+  const __m128i b = _mm_castpd_si128(x);
+  __m128d e = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(b, 52),
+        _mm_set1_epi64x(EXP_BITS))), _mm_set1_pd(EXP_BIAS));
+  __m128d m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(b,
+          _mm_set1_epi64x(MANT_MASK)), _mm_set1_epi64x(ONE_BITS)));
+  const __m128d big = _mm_cmpgt_pd(m, _mm_set1_pd(SQRT2));
+  m = _mm_or_pd(_mm_and_pd(big, _mm_mul_pd(m, _mm_set1_pd(0.5))),
+      _mm_andnot_pd(big, m));
+  e = _mm_add_pd(e, _mm_and_pd(big, _mm_set1_pd(1.0)));
+
+  const __m128d f = _mm_sub_pd(m, _mm_set1_pd(1.0));
+  const __m128d s = _mm_div_pd(f, _mm_add_pd(_mm_set1_pd(2.0), f));
+  const __m128d z = _mm_mul_pd(s, s);
+  const __m128d w = _mm_mul_pd(z, z);
+  __m128d t1 = _mm_add_pd(_mm_set1_pd(LG4),
+      _mm_mul_pd(w, _mm_set1_pd(LG6)));
+  t1 = _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LG2), _mm_mul_pd(w, t1)));
+  __m128d t2 = _mm_add_pd(_mm_set1_pd(LG5),
+      _mm_mul_pd(w, _mm_set1_pd(LG7)));
+  t2 = _mm_add_pd(_mm_set1_pd(LG3), _mm_mul_pd(w, t2));
+  t2 = _mm_mul_pd(z, _mm_add_pd(_mm_set1_pd(LG1), _mm_mul_pd(w, t2)));
+  const __m128d r = _mm_add_pd(t2, t1);
+  const __m128d hfsq = _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(0.5), f), f);
+  __m128d y = _mm_add_pd(_mm_mul_pd(s, _mm_add_pd(hfsq, r)),
+      _mm_mul_pd(e, _mm_set1_pd(LN2_LO)));
+  y = _mm_sub_pd(_mm_sub_pd(hfsq, y), f);
+  return _mm_sub_pd(_mm_mul_pd(e, _mm_set1_pd(LN2_HI)), y);
+}
+
+PRAND_TARGET("sse2")
+static inline void sincos_sse2(const __m128d u, __m128d *c, __m128d *s) {
+  const __m128d t = _mm_mul_pd(u, _mm_set1_pd(4.0));
+  const __m128d y = _mm_add_pd(t, _mm_set1_pd(ROUND_MAGIC));
+  const __m128i q = _mm_castpd_si128(y);
+  const __m128d x = _mm_mul_pd(_mm_sub_pd(t,
+        _mm_sub_pd(y, _mm_set1_pd(ROUND_MAGIC))), _mm_set1_pd(PIO2));
+  const __m128d z = _mm_mul_pd(x, x);
+
+  const __m128d v = _mm_mul_pd(z, x);
+  __m128d ps = _mm_add_pd(_mm_set1_pd(S5), _mm_mul_pd(z, _mm_set1_pd(S6)));
+  ps = _mm_add_pd(_mm_set1_pd(S4), _mm_mul_pd(z, ps));
+  ps = _mm_add_pd(_mm_set1_pd(S3), _mm_mul_pd(z, ps));
+  ps = _mm_add_pd(_mm_set1_pd(S2), _mm_mul_pd(z, ps));
+  const __m128d sn = _mm_add_pd(x, _mm_mul_pd(v,
+        _mm_add_pd(_mm_set1_pd(S1), _mm_mul_pd(z, ps))));
+
+  __m128d pc = _mm_add_pd(_mm_set1_pd(C5), _mm_mul_pd(z, _mm_set1_pd(C6)));
+  pc = _mm_add_pd(_mm_set1_pd(C4), _mm_mul_pd(z, pc));
+  pc = _mm_add_pd(_mm_set1_pd(C3), _mm_mul_pd(z, pc));
+  pc = _mm_add_pd(_mm_set1_pd(C2), _mm_mul_pd(z, pc));
+  pc = _mm_mul_pd(z, _mm_add_pd(_mm_set1_pd(C1), _mm_mul_pd(z, pc)));
+  const __m128d hz = _mm_mul_pd(_mm_set1_pd(0.5), z);
+  const __m128d w = _mm_sub_pd(_mm_set1_pd(1.0), hz);
+  const __m128d cs = _mm_add_pd(w, _mm_add_pd(_mm_sub_pd(_mm_sub_pd(
+            _mm_set1_pd(1.0), w), hz), _mm_mul_pd(z, pc)));
+
+  const __m128i one = _mm_set1_epi64x(1);
+  const __m128i two = _mm_set1_epi64x(2);
+  const __m128d swap = _mm_castsi128_pd(_mm_sub_epi64(_mm_setzero_si128(),
+        _mm_and_si128(q, one)));
+  const __m128d sc = _mm_castsi128_pd(_mm_slli_epi64(_mm_and_si128(
+          _mm_add_epi64(q, one), two), 62));
+  const __m128d ss = _mm_castsi128_pd(_mm_slli_epi64(_mm_and_si128(q, two),
+        62));
+  *c = _mm_xor_pd(_mm_or_pd(_mm_and_pd(swap, sn), _mm_andnot_pd(swap, cs)),
+      sc);
+  *s = _mm_xor_pd(_mm_or_pd(_mm_and_pd(swap, cs), _mm_andnot_pd(swap, sn)),
+      ss);
+}
+
+PRAND_TARGET("sse2")
+static inline __m128d sqrt_sse2(const __m128d a) {
+  const __m128d h = _mm_mul_pd(_mm_set1_pd(0.5), a);
+  __m128d y = _mm_castsi128_pd(_mm_sub_epi64(_mm_set1_epi64x(RSQRT_MAGIC),
+        _mm_srli_epi64(_mm_castpd_si128(a), 1)));
+  for (int i = 0; i < RSQRT_ITER; i++) {
+    y = _mm_mul_pd(y, _mm_sub_pd(_mm_set1_pd(1.5),
+          _mm_mul_pd(_mm_mul_pd(h, y), y)));
+  }
+  return _mm_mul_pd(a, y);
+}
+
+PRAND_TARGET("sse2")
+static inline __m128d radius_sse2(const __m128d u) {
+  return sqrt_sse2(_mm_mul_pd(_mm_set1_pd(-2.0), log_sse2(u)));
+}
+
+PRAND_TARGET("sse2")
+static void box_muller_sse2(double *z, const size_t npair) {
+  size_t i = 0;
+  for (; i + 2 <= npair; i += 2) {
+    const __m128d p0 = _mm_loadu_pd(z + 2 * i);
+    const __m128d p1 = _mm_loadu_pd(z + 2 * i + 2);
+    __m128d c, s;
+    const __m128d r = radius_sse2(_mm_unpacklo_pd(p0, p1));
+    sincos_sse2(_mm_unpackhi_pd(p0, p1), &c, &s);
+    c = _mm_mul_pd(r, c);
+    s = _mm_mul_pd(r, s);
+    _mm_storeu_pd(z + 2 * i, _mm_unpacklo_pd(c, s));
+    _mm_storeu_pd(z + 2 * i + 2, _mm_unpackhi_pd(c, s));
+  }
+  prand_box_muller(z + 2 * i, npair - i);
+}
+
+PRAND_TARGET("sse2")
+static inline __m128d sel_sse2(const __m128d mask, const __m128d a,
+    const __m128d b) {
+  return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+/* Evaluate the polynomial with coefficients `c1` for the lanes in `mask`,
+ * and `c0` for the others. */
+PRAND_TARGET("sse2")
+static inline __m128d poly_sse2(const __m128d x, const double *c0,
+    const double *c1, const __m128d mask) {
+  __m128d p = sel_sse2(mask, _mm_set1_pd(c1[ICDF_DEG]),
+      _mm_set1_pd(c0[ICDF_DEG]));
+  for (int i = ICDF_DEG - 1; i >= 0; i--) {
+    p = _mm_add_pd(_mm_mul_pd(p, x), sel_sse2(mask, _mm_set1_pd(c1[i]),
+          _mm_set1_pd(c0[i])));
+  }
+  return p;
+}
+
+PRAND_TARGET("sse2")
+static inline __m128d icdf_sse2(const __m128d p) {
+  const __m128d zero = _mm_setzero_pd();
+  const __m128d sign = _mm_set1_pd(-0.0);
+  const __m128d q = _mm_sub_pd(p, _mm_set1_pd(0.5));
+  const __m128d rc = _mm_sub_pd(_mm_set1_pd(ICDF_CONST1), _mm_mul_pd(q, q));
+  const __m128d mid = _mm_cmpge_pd(rc, zero);
+  __m128d x = _mm_div_pd(_mm_mul_pd(q, poly_sse2(rc, icdf_a, icdf_a, zero)),
+      poly_sse2(rc, icdf_b, icdf_b, zero));
+  if (_mm_movemask_pd(mid) == 3) return x;
+
+  const __m128d neg = _mm_cmplt_pd(q, zero);
+  __m128d r = sel_sse2(neg, p, _mm_sub_pd(_mm_set1_pd(1.0), p));
+  r = sqrt_sse2(_mm_xor_pd(log_sse2(r), sign));
+  const __m128d far = _mm_cmpgt_pd(r, _mm_set1_pd(ICDF_SPLIT2));
+  r = _mm_sub_pd(r, sel_sse2(far, _mm_set1_pd(ICDF_SPLIT2),
+        _mm_set1_pd(ICDF_CONST2)));
+  __m128d t = _mm_div_pd(poly_sse2(r, icdf_c, icdf_e, far),
+      poly_sse2(r, icdf_d, icdf_f, far));
+  t = _mm_xor_pd(t, _mm_and_pd(q, sign));
+  return sel_sse2(mid, x, t);
+}
+
+PRAND_TARGET("sse2")
+static void neg_log_sse2(double *x, const size_t n) {
+  const __m128d sign = _mm_set1_pd(-0.0);
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(x + i, _mm_xor_pd(log_sse2(_mm_loadu_pd(x + i)), sign));
+  neg_log_scalar(x + i, n - i);
+}
+
+PRAND_TARGET("sse2")
+static void norm_icdf_sse2(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(x + i, icdf_sse2(_mm_loadu_pd(x + i)));
+  norm_icdf_scalar(x + i, n - i);
+}
+
+static const prand_math_kernel_t kernel_sse2 = {
+  &box_muller_sse2, &neg_log_sse2, &norm_icdf_sse2
+};
+
+
+/*============================================================================*\
+                              Kernels with AVX2
+\*============================================================================*/
+
+/* Fused multiply-add instructions are not used for identical results. */
+
+PRAND_TARGET("avx2")
+static inline __m256d log_avx2(const __m256d x) {
+  const __m256i b = _mm256_castpd_si256(x);
+  __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+          _mm256_srli_epi64(b, 52), _mm256_set1_epi64x(EXP_BITS))),
+      _mm256_set1_pd(EXP_BIAS));
+  __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(b,
+          _mm256_set1_epi64x(MANT_MASK)), _mm256_set1_epi64x(ONE_BITS)));
+  const __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(SQRT2), _CMP_GT_OQ);
+  m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+  e = _mm256_add_pd(e, _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+
+  const __m256d f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+  const __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+  const __m256d z = _mm256_mul_pd(s, s);
+  const __m256d w = _mm256_mul_pd(z, z);
+  __m256d t1 = _mm256_add_pd(_mm256_set1_pd(LG4),
+      _mm256_mul_pd(w, _mm256_set1_pd(LG6)));
+  t1 = _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LG2),
+        _mm256_mul_pd(w, t1)));
+  __m256d t2 = _mm256_add_pd(_mm256_set1_pd(LG5),
+      _mm256_mul_pd(w, _mm256_set1_pd(LG7)));
+  t2 = _mm256_add_pd(_mm256_set1_pd(LG3), _mm256_mul_pd(w, t2));
+  t2 = _mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(LG1),
+        _mm256_mul_pd(w, t2)));
+  const __m256d r = _mm256_add_pd(t2, t1);
+  const __m256d hfsq = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f),
+      f);
+  __m256d y = _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, r)),
+      _mm256_mul_pd(e, _mm256_set1_pd(LN2_LO)));
+  y = _mm256_sub_pd(_mm256_sub_pd(hfsq, y), f);
+  return _mm256_sub_pd(_mm256_mul_pd(e, _mm256_set1_pd(LN2_HI)), y);
+}
+
+PRAND_TARGET("avx2")
+static inline void sincos_avx2(const __m256d u, __m256d *c, __m256d *s) {
+  const __m256d t = _mm256_mul_pd(u, _mm256_set1_pd(4.0));
+  const __m256d y = _mm256_add_pd(t, _mm256_set1_pd(ROUND_MAGIC));
+  const __m256i q = _mm256_castpd_si256(y);
+  const __m256d x = _mm256_mul_pd(_mm256_sub_pd(t,
+        _mm256_sub_pd(y, _mm256_set1_pd(ROUND_MAGIC))), _mm256_set1_pd(PIO2));
+  const __m256d z = _mm256_mul_pd(x, x);
+
+  const __m256d v = _mm256_mul_pd(z, x);
+  __m256d ps = _mm256_add_pd(_mm256_set1_pd(S5),
+      _mm256_mul_pd(z, _mm256_set1_pd(S6)));
+  ps = _mm256_add_pd(_mm256_set1_pd(S4), _mm256_mul_pd(z, ps));
+  ps = _mm256_add_pd(_mm256_set1_pd(S3), _mm256_mul_pd(z, ps));
+  ps = _mm256_add_pd(_mm256_set1_pd(S2), _mm256_mul_pd(z, ps));
+  const __m256d sn = _mm256_add_pd(x, _mm256_mul_pd(v,
+        _mm256_add_pd(_mm256_set1_pd(S1), _mm256_mul_pd(z, ps))));
+
+  __m256d pc = _mm256_add_pd(_mm256_set1_pd(C5),
+      _mm256_mul_pd(z, _mm256_set1_pd(C6)));
+  pc = _mm256_add_pd(_mm256_set1_pd(C4), _mm256_mul_pd(z, pc));
+  pc = _mm256_add_pd(_mm256_set1_pd(C3), _mm256_mul_pd(z, pc));
+  pc = _mm256_add_pd(_mm256_set1_pd(C2), _mm256_mul_pd(z, pc));
+  pc = _mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(C1),
+        _mm256_mul_pd(z, pc)));
+  const __m256d hz = _mm256_mul_pd(_mm256_set1_pd(0.5), z);
+  const __m256d w = _mm256_sub_pd(_mm256_set1_pd(1.0), hz);
+  const __m256d cs = _mm256_add_pd(w, _mm256_add_pd(_mm256_sub_pd(
+          _mm256_sub_pd(_mm256_set1_pd(1.0), w), hz), _mm256_mul_pd(z, pc)));
+
+  const __m256i one = _mm256_set1_epi64x(1);
+  const __m256i two = _mm256_set1_epi64x(2);
+  const __m256d swap = _mm256_castsi256_pd(_mm256_sub_epi64(
+        _mm256_setzero_si256(), _mm256_and_si256(q, one)));
+  const __m256d sc = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(
+          _mm256_add_epi64(q, one), two), 62));
+  const __m256d ss = _mm256_castsi256_pd(_mm256_slli_epi64(
+        _mm256_and_si256(q, two), 62));
+  *c = _mm256_xor_pd(_mm256_blendv_pd(cs, sn, swap), sc);
+  *s = _mm256_xor_pd(_mm256_blendv_pd(sn, cs, swap), ss);
+}
+
+PRAND_TARGET("avx2")
+static inline __m256d sqrt_avx2(const __m256d a) {
+  const __m256d h = _mm256_mul_pd(_mm256_set1_pd(0.5), a);
+  __m256d y = _mm256_castsi256_pd(_mm256_sub_epi64(
+        _mm256_set1_epi64x(RSQRT_MAGIC),
+        _mm256_srli_epi64(_mm256_castpd_si256(a), 1)));
+  for (int i = 0; i < RSQRT_ITER; i++) {
+    y = _mm256_mul_pd(y, _mm256_sub_pd(_mm256_set1_pd(1.5),
+          _mm256_mul_pd(_mm256_mul_pd(h, y), y)));
+  }
+  return _mm256_mul_pd(a, y);
+}
+
+PRAND_TARGET("avx2")
+static inline __m256d radius_avx2(const __m256d u) {
+  return sqrt_avx2(_mm256_mul_pd(_mm256_set1_pd(-2.0), log_avx2(u)));
+}
+
+PRAND_TARGET("avx2")
+static void box_muller_avx2(double *z, const size_t npair) {
+  size_t i = 0;
+  for (; i + 4 <= npair; i += 4) {
+    /* p0 = (a0, b0, a1, b1), p1 = (a2, b2, a3, b3). */
+    const __m256d p0 = _mm256_loadu_pd(z + 2 * i);
+    const __m256d p1 = _mm256_loadu_pd(z + 2 * i + 4);
+    __m256d c, s;
+    /* The lanes are in the order of (0, 2, 1, 3). */
+    const __m256d r = radius_avx2(_mm256_unpacklo_pd(p0, p1));
+    sincos_avx2(_mm256_unpackhi_pd(p0, p1), &c, &s);
+    c = _mm256_mul_pd(r, c);
+    s = _mm256_mul_pd(r, s);
+    _mm256_storeu_pd(z + 2 * i, _mm256_unpacklo_pd(c, s));
+    _mm256_storeu_pd(z + 2 * i + 4, _mm256_unpackhi_pd(c, s));
+  }
+  prand_box_muller(z + 2 * i, npair - i);
+}
+
+/* Evaluate the polynomial with coefficients `c1` for the lanes in `mask`,
+ * and `c0` for the others. */
+PRAND_TARGET("avx2")
+static inline __m256d poly_avx2(const __m256d x, const double *c0,
+    const double *c1, const __m256d mask) {
+  __m256d p = _mm256_blendv_pd(_mm256_set1_pd(c0[ICDF_DEG]),
+      _mm256_set1_pd(c1[ICDF_DEG]), mask);
+  for (int i = ICDF_DEG - 1; i >= 0; i--) {
+    p = _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_blendv_pd(
+          _mm256_set1_pd(c0[i]), _mm256_set1_pd(c1[i]), mask));
+  }
+  return p;
+}
+
+PRAND_TARGET("avx2")
+static inline __m256d icdf_avx2(const __m256d p) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d q = _mm256_sub_pd(p, _mm256_set1_pd(0.5));
+  const __m256d rc = _mm256_sub_pd(_mm256_set1_pd(ICDF_CONST1),
+      _mm256_mul_pd(q, q));
+  const __m256d mid = _mm256_cmp_pd(rc, zero, _CMP_GE_OQ);
+  __m256d x = _mm256_div_pd(_mm256_mul_pd(q,
+        poly_avx2(rc, icdf_a, icdf_a, zero)),
+      poly_avx2(rc, icdf_b, icdf_b, zero));
+  if (_mm256_movemask_pd(mid) == 0xf) return x;
+
+  const __m256d neg = _mm256_cmp_pd(q, zero, _CMP_LT_OQ);
+  __m256d r = _mm256_blendv_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), p), p,
+      neg);
+  r = sqrt_avx2(_mm256_xor_pd(log_avx2(r), sign));
+  const __m256d far = _mm256_cmp_pd(r, _mm256_set1_pd(ICDF_SPLIT2),
+      _CMP_GT_OQ);
+  r = _mm256_sub_pd(r, _mm256_blendv_pd(_mm256_set1_pd(ICDF_CONST2),
+        _mm256_set1_pd(ICDF_SPLIT2), far));
+  __m256d t = _mm256_div_pd(poly_avx2(r, icdf_c, icdf_e, far),
+      poly_avx2(r, icdf_d, icdf_f, far));
+  t = _mm256_xor_pd(t, _mm256_and_pd(q, sign));
+  return _mm256_blendv_pd(t, x, mid);
+}
+
+PRAND_TARGET("avx2")
+static void neg_log_avx2(double *x, const size_t n) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(x + i, _mm256_xor_pd(log_avx2(_mm256_loadu_pd(x + i)),
+          sign));
+  }
+  neg_log_scalar(x + i, n - i);
+}
+
+PRAND_TARGET("avx2")
+static void norm_icdf_avx2(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(x + i, icdf_avx2(_mm256_loadu_pd(x + i)));
+  norm_icdf_scalar(x + i, n - i);
+}
+
+static const prand_math_kernel_t kernel_avx2 = {
+  &box_muller_avx2, &neg_log_avx2, &norm_icdf_avx2
+};
+
+
+/*============================================================================*\
+                             Kernels with AVX-512
+\*============================================================================*/
+
+PRAND_TARGET("avx512f")
+static inline __m512d log_avx512(const __m512d x) {
+  const __m512i b = _mm512_castpd_si512(x);
+  __m512d e = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(
+          _mm512_srli_epi64(b, 52), _mm512_set1_epi64(EXP_BITS))),
+      _mm512_set1_pd(EXP_BIAS));
+  __m512d m = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(b,
+          _mm512_set1_epi64(MANT_MASK)), _mm512_set1_epi64(ONE_BITS)));
+  const __mmask8 big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(SQRT2),
+      _CMP_GT_OQ);
+  m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+  e = _mm512_mask_add_pd(e, big, e, _mm512_set1_pd(1.0));
+
+  const __m512d f = _mm512_sub_pd(m, _mm512_set1_pd(1.0));
+  const __m512d s = _mm512_div_pd(f, _mm512_add_pd(_mm512_set1_pd(2.0), f));
+  const __m512d z = _mm512_mul_pd(s, s);
+  const __m512d w = _mm512_mul_pd(z, z);
+  __m512d t1 = _mm512_add_pd(_mm512_set1_pd(LG4),
+      _mm512_mul_pd(w, _mm512_set1_pd(LG6)));
+  t1 = _mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(LG2),
+        _mm512_mul_pd(w, t1)));
+  __m512d t2 = _mm512_add_pd(_mm512_set1_pd(LG5),
+      _mm512_mul_pd(w, _mm512_set1_pd(LG7)));
+  t2 = _mm512_add_pd(_mm512_set1_pd(LG3), _mm512_mul_pd(w, t2));
+  t2 = _mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(LG1),
+        _mm512_mul_pd(w, t2)));
+  const __m512d r = _mm512_add_pd(t2, t1);
+  const __m512d hfsq = _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(0.5), f),
+      f);
+  __m512d y = _mm512_add_pd(_mm512_mul_pd(s, _mm512_add_pd(hfsq, r)),
+      _mm512_mul_pd(e, _mm512_set1_pd(LN2_LO)));
+  y = _mm512_sub_pd(_mm512_sub_pd(hfsq, y), f);
+  return _mm512_sub_pd(_mm512_mul_pd(e, _mm512_set1_pd(LN2_HI)), y);
+}
+
+PRAND_TARGET("avx512f")
+static inline void sincos_avx512(const __m512d u, __m512d *c, __m512d *s) {
+  const __m512d t = _mm512_mul_pd(u, _mm512_set1_pd(4.0));
+  const __m512d y = _mm512_add_pd(t, _mm512_set1_pd(ROUND_MAGIC));
+  const __m512i q = _mm512_castpd_si512(y);
+  const __m512d x = _mm512_mul_pd(_mm512_sub_pd(t,
+        _mm512_sub_pd(y, _mm512_set1_pd(ROUND_MAGIC))), _mm512_set1_pd(PIO2));
+  const __m512d z = _mm512_mul_pd(x, x);
+
+  const __m512d v = _mm512_mul_pd(z, x);
+  __m512d ps = _mm512_add_pd(_mm512_set1_pd(S5),
+      _mm512_mul_pd(z, _mm512_set1_pd(S6)));
+  ps = _mm512_add_pd(_mm512_set1_pd(S4), _mm512_mul_pd(z, ps));
+  ps = _mm512_add_pd(_mm512_set1_pd(S3), _mm512_mul_pd(z, ps));
+  ps = _mm512_add_pd(_mm512_set1_pd(S2), _mm512_mul_pd(z, ps));
+  const __m512d sn = _mm512_add_pd(x, _mm512_mul_pd(v,
+        _mm512_add_pd(_mm512_set1_pd(S1), _mm512_mul_pd(z, ps))));
+
+  __m512d pc = _mm512_add_pd(_mm512_set1_pd(C5),
+      _mm512_mul_pd(z, _mm512_set1_pd(C6)));
+  pc = _mm512_add_pd(_mm512_set1_pd(C4), _mm512_mul_pd(z, pc));
+  pc = _mm512_add_pd(_mm512_set1_pd(C3), _mm512_mul_pd(z, pc));
+  pc = _mm512_add_pd(_mm512_set1_pd(C2), _mm512_mul_pd(z, pc));
+  pc = _mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(C1),
+        _mm512_mul_pd(z, pc)));
+  const __m512d hz = _mm512_mul_pd(_mm512_set1_pd(0.5), z);
+  const __m512d w = _mm512_sub_pd(_mm512_set1_pd(1.0), hz);
+  const __m512d cs = _mm512_add_pd(w, _mm512_add_pd(_mm512_sub_pd(
+          _mm512_sub_pd(_mm512_set1_pd(1.0), w), hz), _mm512_mul_pd(z, pc)));
+
+  const __m512i one = _mm512_set1_epi64(1);
+  const __m512i two = _mm512_set1_epi64(2);
+  const __mmask8 swap = _mm512_test_epi64_mask(q, one);
+  const __m512i sc = _mm512_slli_epi64(_mm512_and_si512(
+        _mm512_add_epi64(q, one), two), 62);
+  const __m512i ss = _mm512_slli_epi64(_mm512_and_si512(q, two), 62);
+  *c = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(
+          _mm512_mask_blend_pd(swap, cs, sn)), sc));
+  *s = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(
+          _mm512_mask_blend_pd(swap, sn, cs)), ss));
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512d sqrt_avx512(const __m512d a) {
+  const __m512d h = _mm512_mul_pd(_mm512_set1_pd(0.5), a);
+  __m512d y = _mm512_castsi512_pd(_mm512_sub_epi64(
+        _mm512_set1_epi64(RSQRT_MAGIC),
+        _mm512_srli_epi64(_mm512_castpd_si512(a), 1)));
+  for (int i = 0; i < RSQRT_ITER; i++) {
+    y = _mm512_mul_pd(y, _mm512_sub_pd(_mm512_set1_pd(1.5),
+          _mm512_mul_pd(_mm512_mul_pd(h, y), y)));
+  }
+  return _mm512_mul_pd(a, y);
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512d radius_avx512(const __m512d u) {
+  return sqrt_avx512(_mm512_mul_pd(_mm512_set1_pd(-2.0), log_avx512(u)));
+}
+
+PRAND_TARGET("avx512f")
+static void box_muller_avx512(double *z, const size_t npair) {
+  size_t i = 0;
+  for (; i + 8 <= npair; i += 8) {
+    const __m512d p0 = _mm512_loadu_pd(z + 2 * i);
+    const __m512d p1 = _mm512_loadu_pd(z + 2 * i + 8);
+    __m512d c, s;
+    const __m512d r = radius_avx512(_mm512_unpacklo_pd(p0, p1));
+    sincos_avx512(_mm512_unpackhi_pd(p0, p1), &c, &s);
+    c = _mm512_mul_pd(r, c);
+    s = _mm512_mul_pd(r, s);
+    _mm512_storeu_pd(z + 2 * i, _mm512_unpacklo_pd(c, s));
+    _mm512_storeu_pd(z + 2 * i + 8, _mm512_unpackhi_pd(c, s));
+  }
+  box_muller_avx2(z + 2 * i, npair - i);
+}
+
+/* Evaluate the polynomial with coefficients `c1` for the lanes in `mask`,
+ * and `c0` for the others. */
+PRAND_TARGET("avx512f")
+static inline __m512d poly_avx512(const __m512d x, const double *c0,
+    const double *c1, const __mmask8 mask) {
+  __m512d p = _mm512_mask_blend_pd(mask, _mm512_set1_pd(c0[ICDF_DEG]),
+      _mm512_set1_pd(c1[ICDF_DEG]));
+  for (int i = ICDF_DEG - 1; i >= 0; i--) {
+    p = _mm512_add_pd(_mm512_mul_pd(p, x), _mm512_mask_blend_pd(mask,
+          _mm512_set1_pd(c0[i]), _mm512_set1_pd(c1[i])));
+  }
+  return p;
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512d neg_avx512(const __m512d x) {
+  return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x),
+        _mm512_set1_epi64(0x8000000000000000ULL)));
+}
+
+PRAND_TARGET("avx512f")
+static inline __m512d icdf_avx512(const __m512d p) {
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d q = _mm512_sub_pd(p, _mm512_set1_pd(0.5));
+  const __m512d rc = _mm512_sub_pd(_mm512_set1_pd(ICDF_CONST1),
+      _mm512_mul_pd(q, q));
+  const __mmask8 mid = _mm512_cmp_pd_mask(rc, zero, _CMP_GE_OQ);
+  __m512d x = _mm512_div_pd(_mm512_mul_pd(q,
+        poly_avx512(rc, icdf_a, icdf_a, 0)),
+      poly_avx512(rc, icdf_b, icdf_b, 0));
+  if (mid == 0xff) return x;
+
+  const __mmask8 neg = _mm512_cmp_pd_mask(q, zero, _CMP_LT_OQ);
+  __m512d r = _mm512_mask_blend_pd(neg,
+      _mm512_sub_pd(_mm512_set1_pd(1.0), p), p);
+  r = sqrt_avx512(neg_avx512(log_avx512(r)));
+  const __mmask8 far = _mm512_cmp_pd_mask(r, _mm512_set1_pd(ICDF_SPLIT2),
+      _CMP_GT_OQ);
+  r = _mm512_sub_pd(r, _mm512_mask_blend_pd(far, _mm512_set1_pd(ICDF_CONST2),
+        _mm512_set1_pd(ICDF_SPLIT2)));
+  __m512d t = _mm512_div_pd(poly_avx512(r, icdf_c, icdf_e, far),
+      poly_avx512(r, icdf_d, icdf_f, far));
+  t = _mm512_mask_blend_pd(neg, t, neg_avx512(t));
+  return _mm512_mask_blend_pd(mid, t, x);
+}
+
+PRAND_TARGET("avx512f")
+static void neg_log_avx512(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(x + i, neg_avx512(log_avx512(_mm512_loadu_pd(x + i))));
+  neg_log_avx2(x + i, n - i);
+}
+
+PRAND_TARGET("avx512f")
+static void norm_icdf_avx512(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(x + i, icdf_avx512(_mm512_loadu_pd(x + i)));
+  norm_icdf_avx2(x + i, n - i);
+}
+
+static const prand_math_kernel_t kernel_avx512 = {
+  &box_muller_avx512, &neg_log_avx512, &norm_icdf_avx512
+};
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline float64x2_t log_neon(const float64x2_t x) {
+  const uint64x2_t b = vreinterpretq_u64_f64(x);
+  float64x2_t e = vsubq_f64(vreinterpretq_f64_u64(vorrq_u64(
+          vshrq_n_u64(b, 52), vdupq_n_u64(EXP_BITS))), vdupq_n_f64(EXP_BIAS));
+  float64x2_t m = vreinterpretq_f64_u64(vorrq_u64(vandq_u64(b,
+          vdupq_n_u64(MANT_MASK)), vdupq_n_u64(ONE_BITS)));
+  const uint64x2_t big = vcgtq_f64(m, vdupq_n_f64(SQRT2));
+  m = vbslq_f64(big, vmulq_f64(m, vdupq_n_f64(0.5)), m);
+  e = vaddq_f64(e, vreinterpretq_f64_u64(vandq_u64(big,
+          vreinterpretq_u64_f64(vdupq_n_f64(1.0)))));
+
+  const float64x2_t f = vsubq_f64(m, vdupq_n_f64(1.0));
+  const float64x2_t s = vdivq_f64(f, vaddq_f64(vdupq_n_f64(2.0), f));
+  const float64x2_t z = vmulq_f64(s, s);
+  const float64x2_t w = vmulq_f64(z, z);
+  float64x2_t t1 = vaddq_f64(vdupq_n_f64(LG4),
+      vmulq_f64(w, vdupq_n_f64(LG6)));
+  t1 = vmulq_f64(w, vaddq_f64(vdupq_n_f64(LG2), vmulq_f64(w, t1)));
+  float64x2_t t2 = vaddq_f64(vdupq_n_f64(LG5),
+      vmulq_f64(w, vdupq_n_f64(LG7)));
+  t2 = vaddq_f64(vdupq_n_f64(LG3), vmulq_f64(w, t2));
+  t2 = vmulq_f64(z, vaddq_f64(vdupq_n_f64(LG1), vmulq_f64(w, t2)));
+  const float64x2_t r = vaddq_f64(t2, t1);
+  const float64x2_t hfsq = vmulq_f64(vmulq_f64(vdupq_n_f64(0.5), f), f);
+  float64x2_t y = vaddq_f64(vmulq_f64(s, vaddq_f64(hfsq, r)),
+      vmulq_f64(e, vdupq_n_f64(LN2_LO)));
+  y = vsubq_f64(vsubq_f64(hfsq, y), f);
+  return vsubq_f64(vmulq_f64(e, vdupq_n_f64(LN2_HI)), y);
+}
+
+static inline void sincos_neon(const float64x2_t u, float64x2_t *c,
+    float64x2_t *s) {
+  const float64x2_t t = vmulq_f64(u, vdupq_n_f64(4.0));
+  const float64x2_t y = vaddq_f64(t, vdupq_n_f64(ROUND_MAGIC));
+  const uint64x2_t q = vreinterpretq_u64_f64(y);
+  const float64x2_t x = vmulq_f64(vsubq_f64(t,
+        vsubq_f64(y, vdupq_n_f64(ROUND_MAGIC))), vdupq_n_f64(PIO2));
+  const float64x2_t z = vmulq_f64(x, x);
+
+  const float64x2_t v = vmulq_f64(z, x);
+  float64x2_t ps = vaddq_f64(vdupq_n_f64(S5), vmulq_f64(z, vdupq_n_f64(S6)));
+  ps = vaddq_f64(vdupq_n_f64(S4), vmulq_f64(z, ps));
+  ps = vaddq_f64(vdupq_n_f64(S3), vmulq_f64(z, ps));
+  ps = vaddq_f64(vdupq_n_f64(S2), vmulq_f64(z, ps));
+  const float64x2_t sn = vaddq_f64(x, vmulq_f64(v,
+        vaddq_f64(vdupq_n_f64(S1), vmulq_f64(z, ps))));
+
+  float64x2_t pc = vaddq_f64(vdupq_n_f64(C5), vmulq_f64(z, vdupq_n_f64(C6)));
+  pc = vaddq_f64(vdupq_n_f64(C4), vmulq_f64(z, pc));
+  pc = vaddq_f64(vdupq_n_f64(C3), vmulq_f64(z, pc));
+  pc = vaddq_f64(vdupq_n_f64(C2), vmulq_f64(z, pc));
+  pc = vmulq_f64(z, vaddq_f64(vdupq_n_f64(C1), vmulq_f64(z, pc)));
+  const float64x2_t hz = vmulq_f64(vdupq_n_f64(0.5), z);
+  const float64x2_t w = vsubq_f64(vdupq_n_f64(1.0), hz);
+  const float64x2_t cs = vaddq_f64(w, vaddq_f64(vsubq_f64(vsubq_f64(
+            vdupq_n_f64(1.0), w), hz), vmulq_f64(z, pc)));
+
+  const uint64x2_t one = vdupq_n_u64(1);
+  const uint64x2_t two = vdupq_n_u64(2);
+  const uint64x2_t swap = vtstq_u64(q, one);
+  const uint64x2_t sc = vshlq_n_u64(vandq_u64(vaddq_u64(q, one), two), 62);
+  const uint64x2_t ss = vshlq_n_u64(vandq_u64(q, two), 62);
+  *c = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(
+          vbslq_f64(swap, sn, cs)), sc));
+  *s = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(
+          vbslq_f64(swap, cs, sn)), ss));
+}
+
+static inline float64x2_t sqrt_neon(const float64x2_t a) {
+  const float64x2_t h = vmulq_f64(vdupq_n_f64(0.5), a);
+  float64x2_t y = vreinterpretq_f64_u64(vsubq_u64(vdupq_n_u64(RSQRT_MAGIC),
+        vshrq_n_u64(vreinterpretq_u64_f64(a), 1)));
+  for (int i = 0; i < RSQRT_ITER; i++) {
+    y = vmulq_f64(y, vsubq_f64(vdupq_n_f64(1.5),
+          vmulq_f64(vmulq_f64(h, y), y)));
+  }
+  return vmulq_f64(a, y);
+}
+
+static inline float64x2_t radius_neon(const float64x2_t u) {
+  return sqrt_neon(vmulq_f64(vdupq_n_f64(-2.0), log_neon(u)));
+}
+
+static void box_muller_neon(double *z, const size_t npair) {
+  size_t i = 0;
+  for (; i + 2 <= npair; i += 2) {
+    const float64x2_t p0 = vld1q_f64(z + 2 * i);
+    const float64x2_t p1 = vld1q_f64(z + 2 * i + 2);
+    float64x2_t c, s;
+    const float64x2_t r = radius_neon(vuzp1q_f64(p0, p1));
+    sincos_neon(vuzp2q_f64(p0, p1), &c, &s);
+    c = vmulq_f64(r, c);
+    s = vmulq_f64(r, s);
+    vst1q_f64(z + 2 * i, vzip1q_f64(c, s));
+    vst1q_f64(z + 2 * i + 2, vzip2q_f64(c, s));
+  }
+  prand_box_muller(z + 2 * i, npair - i);
+}
+
+/* Evaluate the polynomial with coefficients `c1` for the lanes in `mask`,
+ * and `c0` for the others. */
+static inline float64x2_t poly_neon(const float64x2_t x, const double *c0,
+    const double *c1, const uint64x2_t mask) {
+  float64x2_t p = vbslq_f64(mask, vdupq_n_f64(c1[ICDF_DEG]),
+      vdupq_n_f64(c0[ICDF_DEG]));
+  for (int i = ICDF_DEG - 1; i >= 0; i--) {
+    p = vaddq_f64(vmulq_f64(p, x), vbslq_f64(mask, vdupq_n_f64(c1[i]),
+          vdupq_n_f64(c0[i])));
+  }
+  return p;
+}
+
+static inline float64x2_t icdf_neon(const float64x2_t p) {
+  const float64x2_t zero = vdupq_n_f64(0.0);
+  const uint64x2_t none = vdupq_n_u64(0);
+  const float64x2_t q = vsubq_f64(p, vdupq_n_f64(0.5));
+  const float64x2_t rc = vsubq_f64(vdupq_n_f64(ICDF_CONST1), vmulq_f64(q, q));
+  const uint64x2_t mid = vcgeq_f64(rc, zero);
+  float64x2_t x = vdivq_f64(vmulq_f64(q, poly_neon(rc, icdf_a, icdf_a, none)),
+      poly_neon(rc, icdf_b, icdf_b, none));
+  if (vgetq_lane_u64(mid, 0) && vgetq_lane_u64(mid, 1)) return x;
+
+  const uint64x2_t neg = vcltq_f64(q, zero);
+  float64x2_t r = vbslq_f64(neg, p, vsubq_f64(vdupq_n_f64(1.0), p));
+  r = sqrt_neon(vnegq_f64(log_neon(r)));
+  const uint64x2_t far = vcgtq_f64(r, vdupq_n_f64(ICDF_SPLIT2));
+  r = vsubq_f64(r, vbslq_f64(far, vdupq_n_f64(ICDF_SPLIT2),
+        vdupq_n_f64(ICDF_CONST2)));
+  float64x2_t t = vdivq_f64(poly_neon(r, icdf_c, icdf_e, far),
+      poly_neon(r, icdf_d, icdf_f, far));
+  t = vbslq_f64(neg, vnegq_f64(t), t);
+  return vbslq_f64(mid, x, t);
+}
+
+static void neg_log_neon(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    vst1q_f64(x + i, vnegq_f64(log_neon(vld1q_f64(x + i))));
+  neg_log_scalar(x + i, n - i);
+}
+
+static void norm_icdf_neon(double *x, const size_t n) {
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) vst1q_f64(x + i, icdf_neon(vld1q_f64(x + i)));
+  norm_icdf_scalar(x + i, n - i);
+}
+
+static const prand_math_kernel_t kernel_neon = {
+  &box_muller_neon, &neg_log_neon, &norm_icdf_neon
+};
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_math_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const prand_math_kernel_t *prand_math_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("avx512f")) return &kernel_avx512;
+  if (PRAND_CPU_HAS("avx2")) return &kernel_avx2;
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return &kernel_scalar;
+}
@@ -0,0 +1,683 @@
+/*******************************************************************************
+* prand_save.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include "prand.h"
+#include "prand_inline.h"
+#include "prand_state.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+/*******************************************************************************
+  The states of all streams are serialised in a compact binary format, which
+  does not depend on the memory layout of the states, nor the byte order of
+  the machine. All integers are stored in little-endian order, and the
+  floating-point numbers are stored with the bits of their IEEE-754
+  representations. The format is as follows:
+
+    offset  size    content
+    0       4       the magic string "PRND"
+    4       4       version of the format
+    8       4       type of the random number generator
+    12      4       number of streams
+    16      4       size of the record of every stream, in bytes
+    20      ...     records of all the streams, in order
+    ...     8       length of the substreams, 0 if they are not initialised
+    ...     ...     records of the starting points of the current substreams
+                    of all the streams, only if the length is non-zero
+
+  As the interface is restored by copying the records, no jump is required,
+  except for pre-computing the jump to the next substreams. Checkpoints of
+  version 1, which end with the records of the streams, are still accepted.
+*******************************************************************************/
+
+/*============================================================================*\
+                        Definitions of the binary format
+\*============================================================================*/
+
+#define SAVE_MAGIC      "PRND"
+#define SAVE_VERSION    2
+#define SAVE_VERSION_MIN        1       /* the oldest version accepted */
+#define SAVE_HEAD_SIZE  20
+#define SAVE_SUB_SIZE   8       /* size of the length of the substreams */
+/* Size of the buffer for reading or writing file descriptors, in bytes. */
+#define SAVE_BUF_SIZE   65536
+
+/* Sizes of the records of all the streams, in bytes. */
+#define SAVE_SIZE_GAUSS         12      /* cached Gaussian number and flag */
+#define SAVE_SIZE_MRG32K3A      (6 * 8 + SAVE_SIZE_GAUSS)
+#define SAVE_SIZE_MT19937       (MT19937_N * 4 + 4 + SAVE_SIZE_GAUSS)
+#define SAVE_SIZE_PHILOX4X32    ((4 + 2 + 4) * 4 + 4 + SAVE_SIZE_GAUSS)
+#define SAVE_SIZE_XOSHIRO256PP  (4 * 8 + SAVE_SIZE_GAUSS)
+#define SAVE_SIZE_SFMT19937     (SFMT19937_N32 * 4 + 4 + SAVE_SIZE_GAUSS)
+#define SAVE_SIZE_DSFMT19937    ((DSFMT19937_N64 + 2) * 8 + 4 + SAVE_SIZE_GAUSS)
+
+
+/*============================================================================*\
+                   Conversions between integers and byte arrays
+\*============================================================================*/
+
+/******************************************************************************
+Function `io_u32`:
+  Write a 32-bit integer to a byte array, or read it from the array.
+Arguments:
+  * `p`:        pointer to the current position in the array;
+  * `x`:        the integer;
+  * `save`:     non-zero for writing the integer, and zero for reading it.
+******************************************************************************/
+static inline void io_u32(unsigned char **p, uint32_t *x, const int save) {
+  unsigned char *b = *p;
+  if (save) {
+    for (int i = 0; i < 4; i++) b[i] = (unsigned char) (*x >> (i * 8));
+  }
+  else {
+    *x = 0;
+    for (int i = 0; i < 4; i++) *x |= (uint32_t) b[i] << (i * 8);
+  }
+  *p += 4;
+}
+
+/******************************************************************************
+Function `io_u64`:
+  Write a 64-bit integer to a byte array, or read it from the array.
+Arguments:
+  * `p`:        pointer to the current position in the array;
+  * `x`:        the integer;
+  * `save`:     non-zero for writing the integer, and zero for reading it.
+******************************************************************************/
+static inline void io_u64(unsigned char **p, uint64_t *x, const int save) {
+  unsigned char *b = *p;
+  if (save) {
+    for (int i = 0; i < 8; i++) b[i] = (unsigned char) (*x >> (i * 8));
+  }
+  else {
+    *x = 0;
+    for (int i = 0; i < 8; i++) *x |= (uint64_t) b[i] << (i * 8);
+  }
+  *p += 8;
+}
+
+/******************************************************************************
+Function `io_i64`:
+  Write a signed 64-bit integer to a byte array, or read it from the array.
+Arguments:
+  * `p`:        pointer to the current position in the array;
+  * `x`:        the integer;
+  * `save`:     non-zero for writing the integer, and zero for reading it.
+******************************************************************************/
+static inline void io_i64(unsigned char **p, int64_t *x, const int save) {
+  uint64_t u = (uint64_t) *x;
+  io_u64(p, &u, save);
+  if (!save) memcpy(x, &u, sizeof(int64_t));
+}
+
+/******************************************************************************
+Function `io_int`:
+  Write an index or flag to a byte array, or read it from the array.
+Arguments:
+  * `p`:        pointer to the current position in the array;
+  * `x`:        the index or flag;
+  * `save`:     non-zero for writing the integer, and zero for reading it.
+******************************************************************************/
+static inline void io_int(unsigned char **p, int *x, const int save) {
+  uint32_t u = (uint32_t) *x;
+  io_u32(p, &u, save);
+  if (!save) *x = (u > INT32_MAX) ? -1 : (int) u;
+}
+
+/******************************************************************************
+Function `io_gauss`:
+  Write the cached Gaussian number to a byte array, or read it from the array.
+Arguments:
+  * `p`:        pointer to the current position in the array;
+  * `gauss`:    the cached Gaussian number;
+  * `has`:      the flag indicating whether the number is available;
+  * `save`:     non-zero for writing the numbers, and zero for reading them.
+******************************************************************************/
+static inline void io_gauss(unsigned char **p, double *gauss, int *has,
+    const int save) {
+  uint64_t u;
+  memcpy(&u, gauss, sizeof(double));
+  io_u64(p, &u, save);
+  if (!save) memcpy(gauss, &u, sizeof(double));
+  io_int(p, has, save);
+}
+
+
+/*============================================================================*\
+                    Serialisation of the states of the streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `record_size`:
+  Size of the record of one stream for a given type of generator.
+Arguments:
+  * `type`:     type of the random number generator.
+Return:
+  The size of the record, in bytes; 0 if the type is undefined.
+******************************************************************************/
+static size_t record_size(const prand_rng_enum type) {
+  switch (type) {
+    case PRAND_RNG_MRG32K3A:
+      return SAVE_SIZE_MRG32K3A;
+    case PRAND_RNG_MT19937:
+      return SAVE_SIZE_MT19937;
+    case PRAND_RNG_PHILOX4X32:
+      return SAVE_SIZE_PHILOX4X32;
+    case PRAND_RNG_XOSHIRO256PP:
+      return SAVE_SIZE_XOSHIRO256PP;
+    case PRAND_RNG_SFMT19937:
+      return SAVE_SIZE_SFMT19937;
+    case PRAND_RNG_DSFMT19937:
+      return SAVE_SIZE_DSFMT19937;
+    default:
+      return 0;
+  }
+}
+
+/******************************************************************************
+Function `record_io`:
+  Write the state of a stream to its record, or read the state from a record.
+Arguments:
+  * `type`:     type of the random number generator;
+  * `state`:    the state of the stream;
+  * `buf`:      the record;
+  * `save`:     non-zero for writing the record, and zero for reading it.
+Return:
+  Zero on success; non-zero if the state read from the record is invalid.
+******************************************************************************/
+static int record_io(const prand_rng_enum type, void *state,
+    unsigned char *buf, const int save) {
+  unsigned char *p = buf;
+  switch (type) {
+    case PRAND_RNG_MRG32K3A: {
+      prand_mrg32k3a_state_t *s = (prand_mrg32k3a_state_t *) state;
+      io_i64(&p, &s->s10, save);
+      io_i64(&p, &s->s11, save);
+      io_i64(&p, &s->s12, save);
+      io_i64(&p, &s->s20, save);
+      io_i64(&p, &s->s21, save);
+      io_i64(&p, &s->s22, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (s->s10 < 0 || s->s10 >= MRG32K3A_M1 || s->s11 < 0 ||
+          s->s11 >= MRG32K3A_M1 || s->s12 < 0 || s->s12 >= MRG32K3A_M1 ||
+          s->s20 < 0 || s->s20 >= MRG32K3A_M2 || s->s21 < 0 ||
+          s->s21 >= MRG32K3A_M2 || s->s22 < 0 || s->s22 >= MRG32K3A_M2)
+        return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    case PRAND_RNG_MT19937: {
+      prand_mt19937_state_t *s = (prand_mt19937_state_t *) state;
+      for (int i = 0; i < MT19937_N; i++) io_u32(&p, s->mt + i, save);
+      io_int(&p, &s->idx, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (s->idx < 0 || s->idx > MT19937_N) return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    case PRAND_RNG_PHILOX4X32: {
+      prand_philox4x32_state_t *s = (prand_philox4x32_state_t *) state;
+      for (int i = 0; i < 4; i++) io_u32(&p, s->ctr + i, save);
+      for (int i = 0; i < 2; i++) io_u32(&p, s->key + i, save);
+      for (int i = 0; i < 4; i++) io_u32(&p, s->buf + i, save);
+      io_int(&p, &s->idx, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (s->idx < 0 || s->idx > 4) return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    case PRAND_RNG_XOSHIRO256PP: {
+      prand_xoshiro256pp_state_t *s = (prand_xoshiro256pp_state_t *) state;
+      for (int i = 0; i < 4; i++) io_u64(&p, s->s + i, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (!(s->s[0] | s->s[1] | s->s[2] | s->s[3])) return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    case PRAND_RNG_SFMT19937: {
+      prand_sfmt19937_state_t *s = (prand_sfmt19937_state_t *) state;
+      for (int i = 0; i < SFMT19937_N32; i++) io_u32(&p, s->sfmt + i, save);
+      io_int(&p, &s->idx, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (s->idx < 0 || s->idx > SFMT19937_N32) return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    case PRAND_RNG_DSFMT19937: {
+      prand_dsfmt19937_state_t *s = (prand_dsfmt19937_state_t *) state;
+      for (int i = 0; i < DSFMT19937_N64 + 2; i++) io_u64(&p, s->s + i, save);
+      io_int(&p, &s->idx, save);
+      io_gauss(&p, &s->gauss, &s->has_gauss, save);
+      if (s->idx < 0 || s->idx > DSFMT19937_N64) return 1;
+      return (s->has_gauss != 0 && s->has_gauss != 1);
+    }
+    default:
+      return 1;
+  }
+}
+
+/******************************************************************************
+Function `head_io`:
+  Write the header of the binary format, or read and validate it.
+Arguments:
+  * `buf`:      the header, with `SAVE_HEAD_SIZE` bytes;
+  * `type`:     type of the random number generator;
+  * `nstream`:  number of streams;
+  * `version`:  version of the format;
+  * `save`:     non-zero for writing the header, and zero for reading it.
+Return:
+  Zero on success; non-zero if the header read is invalid.
+******************************************************************************/
+static int head_io(unsigned char *buf, prand_rng_enum *type, int *nstream,
+    uint32_t *version, const int save) {
+  unsigned char *p = buf + 4;
+  uint32_t t = (uint32_t) *type;
+  uint32_t size = (uint32_t) record_size(*type);
+
+  if (save) memcpy(buf, SAVE_MAGIC, 4);
+  else if (memcmp(buf, SAVE_MAGIC, 4)) return 1;
+
+  io_u32(&p, version, save);
+  io_u32(&p, &t, save);
+  io_int(&p, nstream, save);
+  io_u32(&p, &size, save);
+  if (save) return 0;
+
+  *type = (prand_rng_enum) t;
+  if (*version < SAVE_VERSION_MIN || *version > SAVE_VERSION ||
+      *nstream <= 0) return 1;
+  if (t > PRAND_RNG_DSFMT19937 || size != record_size(*type)) return 1;
+  return 0;
+}
+
+/******************************************************************************
+Function `load_init`:
+  Initialise an interface for restoring the states from a checkpoint. The
+  states are simply seeded, and overwritten by the caller.
+Arguments:
+  * `type`:     type of the random number generator;
+  * `nstream`:  number of streams;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator.
+******************************************************************************/
+static prand_t *load_init(const prand_rng_enum type, const int nstream,
+    int *err) {
+  prand_t *rng = prand_init(type, 1, nstream, 0, err);
+  if (PRAND_IS_ERROR(*err)) {
+    if (rng) prand_destroy(rng);
+    return NULL;
+  }
+  *err = 0;
+  return rng;
+}
+
+
+/******************************************************************************
+Function `load_substream`:
+  Initialise the substreams of a restored interface, with the starting points
+  overwritten by the caller.
+Arguments:
+  * `rng`:      the restored interface;
+  * `substep`:  length of the substreams;
+  * `err`:      an integer for storing the error message.
+Return:
+  The starting points of the substreams; NULL on error.
+******************************************************************************/
+static prand_substream_t *load_substream(prand_t *rng, const uint64_t substep,
+    int *err) {
+  prand_substream_init(rng, substep, err);
+  if (*err == PRAND_ERR_STEP) *err = PRAND_ERR_SAVE_FORMAT;
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  return (prand_substream_t *) rng->substream;
+}
+
+
+/*============================================================================*\
+                     Interfaces for checkpointing the streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_save_size`:
+  Size of the checkpoint of all the streams of an interface.
+Arguments:
+  * `rng`:      the random number generator interface.
+Return:
+  The size of the checkpoint, in bytes.
+******************************************************************************/
+size_t prand_save_size(const prand_t *rng) {
+  const size_t size = record_size(rng->type) * rng->nstream;
+  return SAVE_HEAD_SIZE + size + SAVE_SUB_SIZE + (rng->substream ? size : 0);
+}
+
+/******************************************************************************
+Function `prand_save`:
+  Write the states of all the streams to a buffer.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `buf`:      the buffer for storing the checkpoint;
+  * `size`:     size of the buffer, in bytes;
+  * `err`:      an integer for storing the error message.
+Return:
+  The number of bytes written.
+******************************************************************************/
+size_t prand_save(const prand_t *rng, void *buf, const size_t size,
+    int *err) {
+  const size_t rsize = record_size(rng->type);
+  if (PRAND_IS_ERROR(*err)) return 0;
+  if (size < prand_save_size(rng)) {
+    *err = PRAND_ERR_SAVE_SIZE;
+    return 0;
+  }
+
+  unsigned char *p = (unsigned char *) buf;
+  prand_rng_enum type = rng->type;
+  int nstream = rng->nstream;
+  uint32_t version = SAVE_VERSION;
+  head_io(p, &type, &nstream, &version, 1);
+  p += SAVE_HEAD_SIZE;
+  for (int i = 0; i < rng->nstream; i++, p += rsize)
+    record_io(rng->type, rng->state_stream[i], p, 1);
+
+  const prand_substream_t *sub = (const prand_substream_t *) rng->substream;
+  uint64_t substep = sub ? sub->jmp->step : 0;
+  io_u64(&p, &substep, 1);
+  if (sub) {
+    for (int i = 0; i < rng->nstream; i++, p += rsize)
+      record_io(rng->type, sub->start[i], p, 1);
+  }
+  return prand_save_size(rng);
+}
+
+/******************************************************************************
+Function `prand_load`:
+  Restore an interface from the checkpoint in a buffer.
+Arguments:
+  * `buf`:      the buffer storing the checkpoint;
+  * `size`:     size of the buffer, in bytes;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_load(const void *buf, const size_t size, int *err) {
+  unsigned char head[SAVE_HEAD_SIZE];
+  prand_rng_enum type;
+  int nstream;
+  uint32_t version;
+  *err = 0;
+
+  if (size < SAVE_HEAD_SIZE) {
+    *err = PRAND_ERR_SAVE_FORMAT;
+    return NULL;
+  }
+  memcpy(head, buf, SAVE_HEAD_SIZE);
+  if (head_io(head, &type, &nstream, &version, 0)) {
+    *err = PRAND_ERR_SAVE_FORMAT;
+    return NULL;
+  }
+  const size_t rsize = record_size(type);
+  size_t left = size - SAVE_HEAD_SIZE;
+  if (left / rsize < (size_t) nstream) {
+    *err = PRAND_ERR_SAVE_FORMAT;
+    return NULL;
+  }
+  left -= rsize * nstream;
+
+  /* The length of the substreams, which is absent in version 1. */
+  unsigned char *p = (unsigned char *) buf + SAVE_HEAD_SIZE + rsize * nstream;
+  uint64_t substep = 0;
+  if (version >= 2) {
+    if (left < SAVE_SUB_SIZE) {
+      *err = PRAND_ERR_SAVE_FORMAT;
+      return NULL;
+    }
+    io_u64(&p, &substep, 0);
+    left -= SAVE_SUB_SIZE;
+    if (substep && left / rsize < (size_t) nstream) {
+      *err = PRAND_ERR_SAVE_FORMAT;
+      return NULL;
+    }
+  }
+
+  prand_t *rng = load_init(type, nstream, err);
+  if (!rng) return NULL;
+
+  p = (unsigned char *) buf + SAVE_HEAD_SIZE;
+  for (int i = 0; i < nstream; i++, p += rsize) {
+    if (record_io(type, rng->state_stream[i], p, 0)) {
+      prand_destroy(rng);
+      *err = PRAND_ERR_SAVE_FORMAT;
+      return NULL;
+    }
+  }
+  if (!substep) return rng;
+
+  prand_substream_t *sub = load_substream(rng, substep, err);
+  if (!sub) {
+    prand_destroy(rng);
+    return NULL;
+  }
+  p += SAVE_SUB_SIZE;
+  for (int i = 0; i < nstream; i++, p += rsize) {
+    if (record_io(type, sub->start[i], p, 0)) {
+      prand_destroy(rng);
+      *err = PRAND_ERR_SAVE_FORMAT;
+      return NULL;
+    }
+  }
+  return rng;
+}
+
+/******************************************************************************
+Function `write_records`:
+  Write the records of states to a file descriptor, after the bytes already
+  in the buffer, which is flushed whenever it is full, and at the end.
+Arguments:
+  * `fd`:       the file descriptor opened for writing;
+  * `type`:     type of the random number generator;
+  * `state`:    the states to be written;
+  * `num`:      number of the states;
+  * `buf`:      the buffer, with `cap` bytes;
+  * `len`:      number of bytes already in the buffer;
+  * `cap`:      capacity of the buffer, no smaller than a record.
+Return:
+  Zero on success; non-zero on error.
+******************************************************************************/
+static int write_records(const int fd, const prand_rng_enum type,
+    void *const *state, const int num, unsigned char *buf, size_t len,
+    const size_t cap) {
+  const size_t rsize = record_size(type);
+  for (int i = 0; i <= num; i++) {
+    /* Flush the buffer if it is full, or all the states are processed. */
+    if (i == num || len + rsize > cap) {
+      size_t done = 0;
+      while (done < len) {
+        ssize_t n = write(fd, buf + done, len - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 1;
+        done += n;
+      }
+      len = 0;
+    }
+    if (i == num) break;
+    record_io(type, state[i], buf + len, 1);
+    len += rsize;
+  }
+  return 0;
+}
+
+/******************************************************************************
+Function `prand_save_fd`:
+  Write the states of all the streams to a file descriptor.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `fd`:       the file descriptor opened for writing;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_save_fd(const prand_t *rng, const int fd, int *err) {
+  const size_t rsize = record_size(rng->type);
+  if (PRAND_IS_ERROR(*err)) return;
+
+  /* The buffer holds at least the header, or a record. */
+  const size_t nrec = (SAVE_BUF_SIZE > rsize) ? SAVE_BUF_SIZE / rsize : 1;
+  unsigned char *buf = malloc(rsize * nrec);
+  if (!buf) {
+    *err = PRAND_ERR_MEMORY;
+    return;
+  }
+
+  prand_rng_enum type = rng->type;
+  int nstream = rng->nstream;
+  uint32_t version = SAVE_VERSION;
+  head_io(buf, &type, &nstream, &version, 1);
+  int fail = write_records(fd, type, rng->state_stream, nstream, buf,
+      SAVE_HEAD_SIZE, rsize * nrec);
+
+  const prand_substream_t *sub = (const prand_substream_t *) rng->substream;
+  uint64_t substep = sub ? sub->jmp->step : 0;
+  unsigned char *p = buf;
+  io_u64(&p, &substep, 1);
+  if (!fail) fail = write_records(fd, type, sub ? sub->start : NULL,
+      sub ? nstream : 0, buf, SAVE_SUB_SIZE, rsize * nrec);
+
+  free(buf);
+  if (fail) *err = PRAND_ERR_FILE;
+}
+
+/******************************************************************************
+Function `read_full`:
+  Read a given number of bytes from a file descriptor.
+Arguments:
+  * `fd`:       the file descriptor opened for reading;
+  * `buf`:      the buffer for storing the bytes;
+  * `len`:      the number of bytes to be read.
+Return:
+  Zero on success; non-zero on error or at the end of the file.
+******************************************************************************/
+static int read_full(const int fd, unsigned char *buf, const size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = read(fd, buf + done, len - done);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return 1;
+    done += n;
+  }
+  return 0;
+}
+
+/******************************************************************************
+Function `read_records`:
+  Read the records of states from a file descriptor, in batches.
+Arguments:
+  * `fd`:       the file descriptor opened for reading;
+  * `type`:     type of the random number generator;
+  * `state`:    the states to be restored;
+  * `num`:      number of the states;
+  * `buf`:      the buffer, with `nrec` records;
+  * `nrec`:     number of records that the buffer holds.
+Return:
+  Zero on success; the error code otherwise.
+******************************************************************************/
+static int read_records(const int fd, const prand_rng_enum type,
+    void *const *state, const int num, unsigned char *buf,
+    const size_t nrec) {
+  const size_t rsize = record_size(type);
+  for (int i = 0; i < num; i += nrec) {
+    const size_t left = (size_t) (num - i);
+    const size_t n = (left < nrec) ? left : nrec;
+    if (read_full(fd, buf, rsize * n)) return PRAND_ERR_FILE;
+    for (size_t j = 0; j < n; j++) {
+      if (record_io(type, state[i + j], buf + rsize * j, 0))
+        return PRAND_ERR_SAVE_FORMAT;
+    }
+  }
+  return 0;
+}
+
+/******************************************************************************
+Function `prand_load_fd`:
+  Restore an interface from the checkpoint read from a file descriptor.
+Arguments:
+  * `fd`:       the file descriptor opened for reading;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_load_fd(const int fd, int *err) {
+  unsigned char head[SAVE_HEAD_SIZE];
+  prand_rng_enum type;
+  int nstream;
+  uint32_t version;
+  *err = 0;
+
+  if (read_full(fd, head, SAVE_HEAD_SIZE)) {
+    *err = PRAND_ERR_FILE;
+    return NULL;
+  }
+  if (head_io(head, &type, &nstream, &version, 0)) {
+    *err = PRAND_ERR_SAVE_FORMAT;
+    return NULL;
+  }
+
+  const size_t rsize = record_size(type);
+  const size_t nrec = (SAVE_BUF_SIZE > rsize) ? SAVE_BUF_SIZE / rsize : 1;
+  unsigned char *buf = malloc(rsize * nrec);
+  if (!buf) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  prand_t *rng = load_init(type, nstream, err);
+  if (!rng) {
+    free(buf);
+    return NULL;
+  }
+
+  *err = read_records(fd, type, rng->state_stream, nstream, buf, nrec);
+
+  /* The length of the substreams, which is absent in version 1. */
+  if (!*err && version >= 2) {
+    uint64_t substep;
+    unsigned char *p = buf;
+    if (read_full(fd, buf, SAVE_SUB_SIZE)) *err = PRAND_ERR_FILE;
+    else {
+      io_u64(&p, &substep, 0);
+      if (substep) {
+        prand_substream_t *sub = load_substream(rng, substep, err);
+        if (sub) *err = read_records(fd, type, sub->start, nstream, buf, nrec);
+      }
+    }
+  }
+
+  free(buf);
+  if (*err) {
+    prand_destroy(rng);
+    return NULL;
+  }
+  return rng;
+}
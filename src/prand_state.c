@@ -0,0 +1,200 @@
+/*******************************************************************************
+* prand_state.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include "prand_state.h"
+#include "prand_inline.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+  The states of different streams are usually owned by different threads.
+  Even if they are small, every state is padded to a multiple of the
+  alignment, so that no two streams share a cache line (or a page). As ISO
+  C99 does not provide aligned allocations, the block is over-allocated, and
+  the address returned by `malloc` is stored right before the first state.
+  The states can also be placed in a memory-mapped file, in which case the
+  size of the mapping is stored as well, for releasing it with `munmap`.
+*******************************************************************************/
+
+/* Information stored right before the first state. */
+typedef struct {
+  void *raw;                    /* address of the allocated or mapped block */
+  size_t map_size;              /* size of the mapping; 0 for `malloc` */
+} prand_state_block_t;
+
+/******************************************************************************
+Function `prand_state_stride`:
+  Distance between the states of adjacent streams, with the space for the
+  counters of the stream if the library is compiled with `-DPRAND_STATS`.
+Arguments:
+  * `size`:     size of each state, in bytes;
+  * `align`:    alignment of the states in bytes, must be a power of 2.
+Return:
+  The distance between adjacent states, in bytes.
+******************************************************************************/
+size_t prand_state_stride(const size_t size, const size_t align) {
+#ifdef PRAND_STATS
+  const size_t len = PRAND_STATS_OFFSET(size) + sizeof(prand_stats_t);
+#else
+  const size_t len = size;
+#endif
+  return (len + align - 1) & ~(align - 1);
+}
+
+/******************************************************************************
+Function `prand_state_alloc`:
+  Allocate the states for all streams in a single block, with every state
+  aligned to the given boundary. If the library is compiled with OpenMP, the
+  states are first touched in parallel, with the same static distribution of
+  streams as `#pragma omp for schedule(static)`, so that the memory pages of
+  the states are placed close to the threads owning the streams.
+Arguments:
+  * `stream`:   the array for storing the pointers to the states;
+  * `size`:     size of each state, in bytes;
+  * `num`:      number of states;
+  * `align`:    alignment of the states in bytes, must be a power of 2.
+Return:
+  The pointer to the first state on success; NULL on error.
+******************************************************************************/
+void *prand_state_alloc(void **stream, const size_t size,
+    const unsigned int num, const size_t align) {
+  const size_t stride = prand_state_stride(size, align);
+  const size_t hsize = sizeof(prand_state_block_t);
+  if (num && stride > (SIZE_MAX - align - hsize) / num) return NULL;
+
+  unsigned char *raw = malloc(stride * num + align + hsize);
+  if (!raw) return NULL;
+
+  /* Reserve the space for the address of the block before the first state. */
+  uintptr_t addr = (uintptr_t) (raw + hsize);
+  unsigned char *base = raw + hsize +
+      ((align - (addr & (align - 1))) & (align - 1));
+  prand_state_block_t blk = {raw, 0};
+  memcpy(base - hsize, &blk, hsize);
+
+  for (unsigned int i = 0; i < num; i++) stream[i] = base + stride * i;
+
+#ifdef _OPENMP
+  if (num > 1 && omp_get_max_threads() > 1 && !omp_in_parallel()) {
+    const int n = num;
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) memset(stream[i], 0, stride);
+  }
+#endif
+#ifdef PRAND_STATS
+  for (unsigned int i = 0; i < num; i++) {
+    memset((unsigned char *) stream[i] + PRAND_STATS_OFFSET(size), 0,
+        sizeof(prand_stats_t));
+  }
+#endif
+  return base;
+}
+
+/******************************************************************************
+Function `prand_state_free`:
+  Release memory allocated for the states.
+Arguments:
+  * `state`:    the pointer to the first state.
+******************************************************************************/
+void prand_state_free(void *state) {
+  prand_state_block_t blk;
+  if (!state) return;
+  memcpy(&blk, (unsigned char *) state - sizeof(prand_state_block_t),
+      sizeof(prand_state_block_t));
+  if (blk.map_size) munmap(blk.raw, blk.map_size);
+  else free(blk.raw);
+}
+
+/******************************************************************************
+Function `prand_state_adopt`:
+  Take over the states of all streams stored in a memory-mapped file, which
+  is released together with the states by `prand_state_free`.
+Arguments:
+  * `stream`:   the array for storing the pointers to the states;
+  * `map`:      address of the mapping;
+  * `map_size`: size of the mapping, in bytes;
+  * `offset`:   offset of the first state in the mapping, which must be no
+                smaller than `PRAND_STATE_RESERVE`;
+  * `stride`:   distance between the states of adjacent streams, in bytes;
+  * `num`:      number of states.
+Return:
+  The pointer to the first state.
+******************************************************************************/
+void *prand_state_adopt(void **stream, void *map, const size_t map_size,
+    const size_t offset, const size_t stride, const unsigned int num) {
+  unsigned char *base = (unsigned char *) map + offset;
+  prand_state_block_t blk = {map, map_size};
+  memcpy(base - sizeof(prand_state_block_t), &blk,
+      sizeof(prand_state_block_t));
+  for (unsigned int i = 0; i < num; i++) stream[i] = base + stride * i;
+  return base;
+}
+
+/******************************************************************************
+Function `prand_state_layout`:
+  Size and alignment of the state of a given type of generator, as is used by
+  `prand_init`.
+Arguments:
+  * `type`:     type of the random number generator;
+  * `align`:    the alignment of the state, in bytes.
+Return:
+  The size of the state, in bytes; 0 if the type is undefined.
+******************************************************************************/
+size_t prand_state_layout(const prand_rng_enum type, size_t *align) {
+  switch (type) {
+    case PRAND_RNG_MRG32K3A:
+      *align = PRAND_CACHE_LINE;
+      return sizeof(prand_mrg32k3a_state_t);
+    case PRAND_RNG_MT19937:
+      *align = PRAND_PAGE_SIZE;
+      return sizeof(prand_mt19937_state_t);
+    case PRAND_RNG_PHILOX4X32:
+      *align = PRAND_CACHE_LINE;
+      return sizeof(prand_philox4x32_state_t);
+    case PRAND_RNG_XOSHIRO256PP:
+      *align = PRAND_CACHE_LINE;
+      return sizeof(prand_xoshiro256pp_state_t);
+    case PRAND_RNG_SFMT19937:
+      *align = PRAND_PAGE_SIZE;
+      return sizeof(prand_sfmt19937_state_t);
+    case PRAND_RNG_DSFMT19937:
+      *align = PRAND_PAGE_SIZE;
+      return sizeof(prand_dsfmt19937_state_t);
+    default:
+      *align = 0;
+      return 0;
+  }
+}
@@ -0,0 +1,233 @@
+/*******************************************************************************
+* prand_stats.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include "prand_stats.h"
+#include <string.h>
+#include <time.h>
+
+#ifdef PRAND_STATS
+
+/*============================================================================*\
+                        Internal functions for the counters
+\*============================================================================*/
+
+/* The hook for tracing the jumps, shared by all interfaces. */
+static prand_hook_t stats_hook = NULL;
+static void *stats_hook_arg = NULL;
+
+/******************************************************************************
+Function `prand_stats_clock`:
+  The wall-clock time from an arbitrary point.
+Return:
+  The time in seconds.
+******************************************************************************/
+double prand_stats_clock(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/******************************************************************************
+Function `prand_stats_jump_begin`:
+  Start recording a jump, and report it to the hook.
+Arguments:
+  * `jmp`:      the bookkeeping of the jump;
+  * `stats`:    the counters for the time of the jump;
+  * `type`:     type of the random number generator;
+  * `step`:     step size for jumping ahead;
+  * `nstream`:  number of streams jumped ahead;
+  * `err`:      the error status before the jump.
+******************************************************************************/
+void prand_stats_jump_begin(prand_stats_jump_t *jmp, prand_stats_t *stats,
+    const prand_rng_enum type, const uint64_t step, const int nstream,
+    const int err) {
+  jmp->info.event = PRAND_HOOK_JUMP_BEGIN;
+  jmp->info.type = type;
+  jmp->info.step = step;
+  jmp->info.nstream = nstream;
+  jmp->info.err = err;
+  if (stats_hook) stats_hook(&jmp->info, stats_hook_arg);
+
+  jmp->stats = stats;
+  jmp->time_poly = stats->time_poly;
+  jmp->start = prand_stats_clock();
+}
+
+/******************************************************************************
+Function `prand_stats_jump_end`:
+  Finish recording a jump, and report it to the hook. The time of the jump
+  apart from the evaluation of polynomials or matrices is accounted for
+  advancing the states.
+Arguments:
+  * `jmp`:      the bookkeeping of the jump;
+  * `err`:      the error status after the jump.
+Return:
+  Non-zero if the jump is successful.
+******************************************************************************/
+int prand_stats_jump_end(prand_stats_jump_t *jmp, const int err) {
+  const double time = prand_stats_clock() - jmp->start;
+  prand_stats_t *stats = jmp->stats;
+  stats->time_forward += time - (stats->time_poly - jmp->time_poly);
+  if (err == PRAND_ERR_MEMORY_JUMP) stats->nfail++;
+
+  jmp->info.event = PRAND_HOOK_JUMP_END;
+  jmp->info.err = err;
+  if (stats_hook) stats_hook(&jmp->info, stats_hook_arg);
+  return !PRAND_IS_ERROR(err);
+}
+
+/******************************************************************************
+Function `prand_stats_stream_all`:
+  Update the counters of all streams of an interface, for sampling or
+  jumping ahead all of them in lock-step.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `size`:     size of the state, in bytes;
+  * `ndraw`:    number of numbers sampled from every stream;
+  * `step`:     number of steps skipped by every stream.
+******************************************************************************/
+void prand_stats_stream_all(prand_t *rng, const size_t size,
+    const uint64_t ndraw, const uint64_t step) {
+  for (int i = 0; i < rng->nstream; i++) {
+    prand_stats_t *stats = PRAND_STATS_STREAM(rng->state_stream[i], size);
+    stats->ndraw += ndraw;
+    if (step) {
+      stats->njump++;
+      stats->nskip += step;
+    }
+  }
+}
+
+/******************************************************************************
+Function `stats_add`:
+  Add up two sets of counters.
+Arguments:
+  * `sum`:      the counters to be increased;
+  * `stats`:    the counters to be added.
+******************************************************************************/
+static void stats_add(prand_stats_t *sum, const prand_stats_t *stats) {
+  sum->ndraw += stats->ndraw;
+  sum->nregen += stats->nregen;
+  sum->njump += stats->njump;
+  sum->nskip += stats->nskip;
+  sum->nfail += stats->nfail;
+  sum->time_poly += stats->time_poly;
+  sum->time_forward += stats->time_forward;
+}
+
+#endif
+
+
+/*============================================================================*\
+                          Interfaces for the counters
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_stats`:
+  Retrieve the counters of a stream, or the totals of all streams, including
+  the jumps shared by the streams, if the index is negative. The counters of
+  streams that are being sampled or jumped ahead by other threads may not be
+  up to date.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `i`:        index of the stream, or a negative number for all streams;
+  * `stats`:    the structure for storing the counters;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_stats(const prand_t *rng, const int i, prand_stats_t *stats,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  memset(stats, 0, sizeof(prand_stats_t));
+#ifdef PRAND_STATS
+  if (i >= rng->nstream) {
+    *err = PRAND_ERR_STREAM;
+    return;
+  }
+
+  size_t align;
+  const size_t size = prand_state_layout(rng->type, &align);
+  if (i >= 0) {
+    *stats = *PRAND_STATS_STREAM(rng->state_stream[i], size);
+    return;
+  }
+  *stats = rng->stats;
+  for (int j = 0; j < rng->nstream; j++)
+    stats_add(stats, PRAND_STATS_STREAM(rng->state_stream[j], size));
+#else
+  (void) rng;
+  (void) i;
+  *err = PRAND_ERR_STATS;
+#endif
+}
+
+/******************************************************************************
+Function `prand_stats_reset`:
+  Reset the counters of all the streams of an interface.
+Arguments:
+  * `rng`:      the random number generator interface.
+******************************************************************************/
+void prand_stats_reset(prand_t *rng) {
+#ifdef PRAND_STATS
+  size_t align;
+  const size_t size = prand_state_layout(rng->type, &align);
+  PRAND_STATS_CLEAR(rng);
+  for (int i = 0; i < rng->nstream; i++) {
+    memset(PRAND_STATS_STREAM(rng->state_stream[i], size), 0,
+        sizeof(prand_stats_t));
+  }
+#else
+  (void) rng;
+#endif
+}
+
+/******************************************************************************
+Function `prand_set_jump_hook`:
+  Register a function that is called before and after every jump, reset, or
+  pre-computed jump of all interfaces, with the information of the jump and
+  a user-supplied pointer. It replaces the previously registered hook, or
+  removes it if `hook` is NULL, and must not be called while any stream is
+  jumping ahead.
+Arguments:
+  * `hook`:     the function to be called;
+  * `arg`:      the pointer passed to the function;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_set_jump_hook(prand_hook_t hook, void *arg, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+#ifdef PRAND_STATS
+  stats_hook = hook;
+  stats_hook_arg = arg;
+#else
+  (void) hook;
+  (void) arg;
+  *err = PRAND_ERR_STATS;
+#endif
+}
@@ -0,0 +1,254 @@
+/*******************************************************************************
+* prand_table.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include "prand.h"
+#include "prand_state.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*******************************************************************************
+  Tables of the starting states of all streams, for a fixed configuration of
+  the generator, seed, number of streams, and step size. The states are
+  stored in the memory layout of the library, with the same strides as the
+  ones of `prand_init`, after a page of header:
+
+    offset          content
+    0               the header (`prand_table_head_t`)
+    PRAND_PAGE_SIZE the state of the first stream
+    + stride * i    the state of the (i+1)-th stream
+
+  The file is mapped privately, and the states of the streams are used in
+  place, so that only the pages of the streams in use are read, and they are
+  copied on the first modification. As the layout of the states is native, a
+  table is only valid for builds of the library with the same ABI.
+*******************************************************************************/
+
+/*============================================================================*\
+                       Definition of the table of states
+\*============================================================================*/
+
+#define TABLE_MAGIC     "PRANDTAB"
+#define TABLE_VERSION   1
+#define TABLE_ENDIAN    0x01020304UL    /* for checking the byte order */
+
+typedef struct {
+  char magic[8];                /* the magic string "PRANDTAB" */
+  uint32_t version;             /* version of the table */
+  uint32_t endian;              /* the byte order check `TABLE_ENDIAN` */
+  uint32_t type;                /* type of the random number generator */
+  uint32_t nstream;             /* number of streams */
+  uint64_t seed;                /* the seed for initialisation */
+  uint64_t step;                /* step size for jumping ahead */
+  uint64_t size;                /* size of each state, in bytes */
+  uint64_t stride;              /* distance between adjacent states */
+  uint64_t offset;              /* offset of the first state */
+} prand_table_head_t;
+
+/******************************************************************************
+Function `table_head`:
+  Construct the header of the table for a given configuration.
+Arguments:
+  * `head`:     the header to be filled;
+  * `type`:     type of the random number generator;
+  * `seed`:     the seed for initialisation;
+  * `nstream`:  number of streams;
+  * `step`:     step size for jumping ahead.
+Return:
+  Zero on success; non-zero if the type is undefined.
+******************************************************************************/
+static int table_head(prand_table_head_t *head, const prand_rng_enum type,
+    const uint64_t seed, const unsigned int nstream, const uint64_t step) {
+  size_t align;
+  const size_t size = prand_state_layout(type, &align);
+  if (!size) return 1;
+
+  memset(head, 0, sizeof(prand_table_head_t));
+  memcpy(head->magic, TABLE_MAGIC, 8);
+  head->version = TABLE_VERSION;
+  head->endian = TABLE_ENDIAN;
+  head->type = type;
+  head->nstream = (nstream == 0) ? 1 : nstream;
+  head->seed = seed;
+  head->step = step;
+  head->size = size;
+  head->stride = prand_state_stride(size, align);
+  head->offset = PRAND_PAGE_SIZE;
+  return 0;
+}
+
+
+/*============================================================================*\
+                    Interfaces for the tables of the states
+\*============================================================================*/
+
+/******************************************************************************
+Function `prand_table_create`:
+  Initialise the streams with a given configuration, and write the starting
+  states of all streams to a table file.
+Arguments:
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `fname`:    name of the table file;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+void prand_table_create(const prand_rng_enum type, const uint64_t seed,
+    const unsigned int nstream, const uint64_t step, const char *fname,
+    int *err) {
+  prand_table_head_t head;
+  if (table_head(&head, type, seed, nstream, step)) {
+    *err = PRAND_ERR_UNDEF_RNG;
+    return;
+  }
+
+  prand_t *rng = prand_init(type, seed, nstream, step, err);
+  if (PRAND_IS_ERROR(*err)) {
+    if (rng) prand_destroy(rng);
+    return;
+  }
+
+  /* The padding of the header and the states is filled with zeros. */
+  const size_t pad = (head.offset > head.stride) ? head.offset : head.stride;
+  unsigned char *zero = calloc(pad, 1);
+  if (!zero) {
+    prand_destroy(rng);
+    *err = PRAND_ERR_MEMORY;
+    return;
+  }
+
+  FILE *fp = fopen(fname, "wb");
+  if (!fp) {
+    free(zero);
+    prand_destroy(rng);
+    *err = PRAND_ERR_FILE;
+    return;
+  }
+
+  int fail = fwrite(&head, sizeof(prand_table_head_t), 1, fp) != 1 ||
+      fwrite(zero, head.offset - sizeof(prand_table_head_t), 1, fp) != 1;
+  for (int i = 0; !fail && i < rng->nstream; i++) {
+    fail = fwrite(rng->state_stream[i], head.size, 1, fp) != 1;
+    if (!fail && head.stride > head.size)
+      fail = fwrite(zero, head.stride - head.size, 1, fp) != 1;
+  }
+  if (fclose(fp)) fail = 1;
+  if (fail) {
+    remove(fname);
+    *err = PRAND_ERR_FILE;
+  }
+
+  free(zero);
+  prand_destroy(rng);
+}
+
+/******************************************************************************
+Function `prand_init_from_file`:
+  Initialisation of the interface with the starting states of all streams
+  mapped from a table file created by `prand_table_create`, with the same
+  configuration. The file is mapped privately, so it is not modified by the
+  interface.
+Arguments:
+  * `fname`:    name of the table file;
+  * `type`:     the ID of the pre-defined random number generator;
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal interface of the random number generator; NULL on error.
+******************************************************************************/
+prand_t *prand_init_from_file(const char *fname, const prand_rng_enum type,
+    const uint64_t seed, const unsigned int nstream, const uint64_t step,
+    int *err) {
+  prand_table_head_t head, fhead;
+  *err = 0;
+  if (table_head(&head, type, seed, nstream, step)) {
+    *err = PRAND_ERR_UNDEF_RNG;
+    return NULL;
+  }
+
+  int fd = open(fname, O_RDONLY);
+  if (fd < 0) {
+    *err = PRAND_ERR_FILE;
+    return NULL;
+  }
+  struct stat st;
+  if (fstat(fd, &st) || read(fd, &fhead, sizeof(prand_table_head_t)) !=
+      (ssize_t) sizeof(prand_table_head_t)) {
+    close(fd);
+    *err = PRAND_ERR_FILE;
+    return NULL;
+  }
+
+  /* The table must be created with the same configuration and layout. */
+  const size_t map_size = head.offset + head.stride * head.nstream;
+  if (memcmp(&head, &fhead, sizeof(prand_table_head_t)) ||
+      (uint64_t) st.st_size < map_size) {
+    close(fd);
+    *err = PRAND_ERR_TABLE;
+    return NULL;
+  }
+
+  void *map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    *err = PRAND_ERR_FILE;
+    return NULL;
+  }
+
+  /* Only the functions of the interface are initialised, with one stream. */
+  prand_t *rng = prand_init(type, seed, 1, 0, err);
+  if (PRAND_IS_ERROR(*err)) {
+    if (rng) prand_destroy(rng);
+    munmap(map, map_size);
+    return NULL;
+  }
+
+  void **stream = realloc(rng->state_stream, sizeof(void *) * head.nstream);
+  if (!stream) {
+    prand_destroy(rng);
+    munmap(map, map_size);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+  prand_state_free(rng->state);
+  rng->state_stream = stream;
+  rng->state = prand_state_adopt(stream, map, map_size, head.offset,
+      head.stride, head.nstream);
+  rng->nstream = head.nstream;
+  return rng;
+}
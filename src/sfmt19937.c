@@ -0,0 +1,886 @@
+/*******************************************************************************
+* sfmt19937.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+#include "sfmt19937.h"
+#include "sfmt19937_jump.h"
+#include "mt19937.h"            /* polynomial arithmetics */
+#include "prand_cache.h"
+#include "prand_state.h"
+#include "prand_stats.h"
+#include "prand_math.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+  Implementation of the SIMD-oriented Fast Mersenne Twister (SFMT19937).
+  ref: https://doi.org/10.1007/978-3-540-74496-2_36
+
+  The initialisation with a seed and the outputs are identical to those of
+  the 32-bit integers generated by the version provided by the authors of
+  the algorithm (with `sfmt_init_gen_rand` and `sfmt_genrand_uint32`):
+  http://www.math.sci.hiroshima-u.ac.jp/m-mat/MT/SFMT/index.html
+  The floating-point numbers are converted from the 32-bit integers in the
+  same way as MT19937.
+
+  Jumping ahead is performed by advancing the 128-bit words of the state
+  array with the polynomials t^(step / 4) mod phi, with phi being the
+  characteristic polynomial of the transition for one 128-bit word. The
+  polynomials are evaluated on the fly with the Barrett reduction.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define N               SFMT19937_N
+#define N32             SFMT19937_N32
+#define POS1            SFMT19937_POS1
+#define K               SFMT19937_POLY_DEG
+#define NW              SFMT19937_POLY_NW
+
+/* Parity check vector for the period certification. */
+#define PARITY1         0x00000001UL
+#define PARITY2         0x00000000UL
+#define PARITY3         0x00000000UL
+#define PARITY4         0x13c9e684UL
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define NORM            SFMT19937_NORM
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define NORM_POS        SFMT19937_NORM_POS
+
+#define DEFAULT_SEED    1
+
+/* Workspace for evaluating the jump-ahead polynomials, in words. */
+#define POLY_WORK       (NW * 10)
+
+/* Minimum number of streams for jumping ahead in parallel with OpenMP. */
+#define JUMP_ALL_PAR_MIN        2
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+/* The state is shared with the inline interface. */
+typedef prand_sfmt19937_state_t sfmt19937_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `sfmt19937_seed`:
+  Initialise the state with an integer.
+Arguments:
+  * `state`:    the state to be intialised;
+  * `seed`:     a positive integer for the initialisation.
+******************************************************************************/
+static void sfmt19937_seed(void *state, uint64_t seed) {
+  sfmt19937_state_t *stat = (sfmt19937_state_t *) state;
+  uint32_t *s = stat->sfmt;
+  const uint32_t parity[4] = {PARITY1, PARITY2, PARITY3, PARITY4};
+
+  /* Initialise the state with LCG, as MT19937. */
+  s[0] = seed;          /* validation of seed is done in `sfmt19937_init' */
+  for (int i = 1; i < N32; i++)
+    s[i] = 1812433253UL * (s[i-1] ^ (s[i-1] >> 30)) + i;
+
+  /* Period certification: flip one bit if the state is not in the
+   * sub-space with the period 2^19937 - 1. */
+  uint32_t inner = 0;
+  for (int i = 0; i < 4; i++) inner ^= s[i] & parity[i];
+  for (int i = 16; i > 0; i >>= 1) inner ^= inner >> i;
+  if (!(inner & 1)) {
+    for (int i = 0; i < 4; i++) {
+      if (parity[i]) {
+        s[i] ^= parity[i] & (~parity[i] + 1);   /* lowest non-zero bit */
+        break;
+      }
+    }
+  }
+
+  stat->idx = N32;
+  stat->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `sfmt19937_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static uint64_t sfmt19937_get(void *state) {
+  sfmt19937_state_t *stat = (sfmt19937_state_t *) state;
+  PRAND_STATS_REGEN(stat, stat->idx >= N32);
+  return prand_sfmt19937_get(stat);
+}
+
+/******************************************************************************
+Function `sfmt19937_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double sfmt19937_get_double(void *state) {
+  return sfmt19937_get(state) * NORM;
+}
+
+/******************************************************************************
+Function `sfmt19937_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double sfmt19937_get_double_pos(void *state) {
+  return (sfmt19937_get(state) + 1) * NORM_POS;
+}
+
+/******************************************************************************
+Function `sfmt19937_get_double53`:
+  Generate a double-precision floating-point number in the range [0,1), with
+  53-bit resolution, from two consecutive integers.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double sfmt19937_get_double53(void *state) {
+  sfmt19937_state_t *stat = (sfmt19937_state_t *) state;
+  PRAND_STATS_REGEN(stat, stat->idx >= N32 - 1);
+  return prand_sfmt19937_get_double53(stat);
+}
+
+/******************************************************************************
+Function `sfmt19937_block`:
+  Retrieve a block of words from the state array, and regenerate the state
+  array if all the words are consumed.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `kernel`:   the kernels for generating the state array;
+  * `len`:      the requested number of words, which is updated to the
+                number of available words in the block.
+Return:
+  The pointer to the first word of the block.
+******************************************************************************/
+static inline const uint32_t *sfmt19937_block(sfmt19937_state_t *stat,
+    const sfmt19937_kernel_t *kernel, size_t *len) {
+  PRAND_STATS_REGEN(stat, stat->idx >= N32);
+  if (stat->idx >= N32) {       /* generate N32 words at one time */
+    kernel->gen_all(stat->sfmt);
+    stat->idx = 0;
+  }
+  if (*len > (size_t) (N32 - stat->idx)) *len = N32 - stat->idx;
+
+  const uint32_t *s = stat->sfmt + stat->idx;
+  stat->idx += *len;
+  return s;
+}
+
+/******************************************************************************
+Macro `SFMT19937_FILL`:
+  Generate an array of numbers from one stream, block by block. The i-th
+  number is stored as the (i * stride)-th element of the output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array;
+  * `conv`:     the expression for converting a word `x` to a number.
+******************************************************************************/
+#define SFMT19937_FILL(stat, out, n, stride, conv) {                    \
+  const sfmt19937_kernel_t *kernel = sfmt19937_kernel();                \
+  size_t i = 0;                                                         \
+  while (i < (n)) {                                                     \
+    size_t len = (n) - i;                                               \
+    const uint32_t *blk = sfmt19937_block(stat, kernel, &len);          \
+    for (size_t j = 0; j < len; j++) {                                  \
+      const uint32_t x = blk[j];                                        \
+      (out)[(i + j) * (stride)] = conv;                                 \
+    }                                                                   \
+    i += len;                                                           \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `sfmt19937_fill`:
+  Generate an array of integers and update the state.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated.
+******************************************************************************/
+static void sfmt19937_fill(void *state, uint64_t *out, const size_t n) {
+  SFMT19937_FILL((sfmt19937_state_t *) state, out, n, 1, x);
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_double`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void sfmt19937_fill_double(void *state, double *out, const size_t n) {
+  SFMT19937_FILL((sfmt19937_state_t *) state, out, n, 1, x * NORM);
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_double_pos`:
+  Generate an array of double-precision floating-point numbers in the
+  range (0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void sfmt19937_fill_double_pos(void *state, double *out,
+    const size_t n) {
+  SFMT19937_FILL((sfmt19937_state_t *) state, out, n, 1,
+      ((uint64_t) x + 1) * NORM_POS);
+}
+
+/******************************************************************************
+Macro `SFMT19937_FILL53`:
+  Generate an array of floating-point numbers with 53-bit resolution from one
+  stream, with pairs of words taken from the blocks of the state array. The
+  i-th number is stored as the (i * stride)-th element of the output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array.
+******************************************************************************/
+#define SFMT19937_FILL53(stat, out, n, stride) {                        \
+  const sfmt19937_kernel_t *kernel = sfmt19937_kernel();                \
+  size_t i = 0;                                                         \
+  while (i < (n)) {                                                     \
+    size_t len = ((n) - i) << 1;                                        \
+    const uint32_t *blk = sfmt19937_block(stat, kernel, &len);          \
+    if (len == 1) {             /* the pair spans two blocks */         \
+      const uint32_t a = blk[0];                                        \
+      (out)[(i++) * (stride)] = prand_double53(a, sfmt19937_get(stat)); \
+      continue;                                                         \
+    }                                                                   \
+    (stat)->idx -= len & 1;     /* leave the unpaired word */           \
+    len >>= 1;                                                          \
+    for (size_t j = 0; j < len; j++) {                                  \
+      (out)[(i + j) * (stride)] =                                       \
+        prand_double53(blk[j << 1], blk[(j << 1) + 1]);                 \
+    }                                                                   \
+    i += len;                                                           \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_double53`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1), with 53-bit resolution. The results are identical to those of
+  calling `sfmt19937_get_double53` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void sfmt19937_fill_double53(void *state, double *out, const size_t n) {
+  SFMT19937_FILL53((sfmt19937_state_t *) state, out, n, 1);
+}
+
+/******************************************************************************
+Function `sfmt19937_get_gaussian`:
+  Generate a Gaussian number with zero mean and unit variance, and update the
+  state. The numbers are generated in pairs with the Box-Muller method, from
+  two floating-point numbers in the range (0,1) each, and the second number
+  of a pair is cached for the next call.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random Gaussian number.
+******************************************************************************/
+static double sfmt19937_get_gaussian(void *state) {
+  sfmt19937_state_t *stat = (sfmt19937_state_t *) state;
+  if (stat->has_gauss) {
+    stat->has_gauss = 0;
+    return stat->gauss;
+  }
+
+  double z[2];
+  z[0] = sfmt19937_get_double_pos(state);
+  z[1] = sfmt19937_get_double_pos(state);
+  prand_box_muller(z, 1);
+  stat->gauss = z[1];
+  stat->has_gauss = 1;
+  return z[0];
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_gaussian`:
+  Generate an array of Gaussian numbers with zero mean and unit variance, and
+  update the state. The results are identical to those of calling
+  `sfmt19937_get_gaussian` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of Gaussian numbers to be generated.
+******************************************************************************/
+static void sfmt19937_fill_gaussian(void *state, double *out,
+    const size_t n) {
+  sfmt19937_state_t *stat = (sfmt19937_state_t *) state;
+  size_t i = 0;
+  if (!n) return;
+  if (stat->has_gauss) {
+    out[i++] = stat->gauss;
+    stat->has_gauss = 0;
+  }
+
+  /* Generate pairs in place from the uniform numbers. */
+  const size_t npair = (n - i) >> 1;
+  sfmt19937_fill_double_pos(state, out + i, npair << 1);
+  prand_math_kernel()->box_muller(out + i, npair);
+  i += npair << 1;
+  if (i < n) out[i] = sfmt19937_get_gaussian(state);
+}
+
+
+/*============================================================================*\
+                         Functions for multiple streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `skip_words`:
+  Jump ahead for one stream by consuming the words of the state array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `step`:     the number of words to be skipped.
+******************************************************************************/
+static void skip_words(sfmt19937_state_t *stat, uint64_t step) {
+  const sfmt19937_kernel_t *kernel = sfmt19937_kernel();
+  step += stat->idx;
+  while (step > N32) {
+    kernel->gen_all(stat->sfmt);
+    step -= N32;
+  }
+  stat->idx = step;
+  stat->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `ring_add`:
+  Add the 128-bit words stored in a circular buffer to an array.
+Arguments:
+  * `acc`:      the array with N 128-bit words;
+  * `buf`:      the circular buffer with N 128-bit words;
+  * `pos`:      the index of the first word in the buffer.
+******************************************************************************/
+static inline void ring_add(uint32_t *restrict acc,
+    const uint32_t *restrict buf, const int pos) {
+  const int n1 = (N - pos) << 2;
+  const int n2 = pos << 2;
+  for (int i = 0; i < n1; i++) acc[i] ^= buf[n2 + i];
+  for (int i = 0; i < n2; i++) acc[n1 + i] ^= buf[i];
+}
+
+/******************************************************************************
+Function `state_forward`:
+  Advance the 128-bit words of the state array with the jump-ahead
+  polynomial, i.e., compute
+      sum_i c_i * T^i s,
+  where c_i are the coefficients of the polynomial, T is the transition for
+  one 128-bit word, and s is the initial state array. The position of the
+  next output in the state array is not changed.
+Arguments:
+  * `out`:      the pointer to the resulting state;
+  * `in`:       the pointer to the initial state;
+  * `poly`:     the jump-ahead polynomial;
+  * `work`:     the workspace, with at least N32 words.
+******************************************************************************/
+static void state_forward(sfmt19937_state_t *out, const sfmt19937_state_t *in,
+    const uint32_t *poly, uint32_t *work) {
+  uint32_t *buf = work;         /* circular buffer for the transitions */
+  memcpy(buf, in->sfmt, sizeof(uint32_t) * N32);
+  out->idx = in->idx;
+  memset(out->sfmt, 0, sizeof(uint32_t) * N32);
+
+  int deg = K - 1;
+  while (deg > 0 && !COEF(poly, deg)) deg--;
+  for (int i = 0, pos = 0; i <= deg; i++) {
+    if (COEF(poly, i)) ring_add(out->sfmt, buf, pos);
+    if (i == deg) break;
+    /* The word at `pos` is replaced by the new one. */
+    const int a = pos << 2;
+    const int b = ((pos + POS1 < N) ? pos + POS1 : pos + POS1 - N) << 2;
+    const int c = ((pos >= 2) ? pos - 2 : pos + N - 2) << 2;
+    const int d = ((pos >= 1) ? pos - 1 : pos + N - 1) << 2;
+    sfmt19937_recursion(buf + a, buf + a, buf + b, buf + c, buf + d);
+    if (++pos == N) pos = 0;
+  }
+
+  /* The cached Gaussian number does not belong to the new position. */
+  out->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `jump_poly`:
+  Compute the jump-ahead polynomial for a given skipping step.
+Arguments:
+  * `poly`:     the array for storing the polynomial, with also the temporary
+                space for the evaluation, at least POLY_WORK words;
+  * `step`:     the number of steps to be skipped.
+******************************************************************************/
+static inline void jump_poly(uint32_t *poly, const uint64_t step) {
+  poly_pow_mod(poly, step >> 2, sfmt19937_phi, sfmt19937_mu, K, NW,
+      poly + NW);
+}
+
+/******************************************************************************
+Function `state_jump`:
+  Jump ahead for one stream, by consuming the words directly for short
+  jumps, or with the jump-ahead polynomial for the 128-bit words otherwise.
+Arguments:
+  * `out`:      the pointer to the resulting state;
+  * `in`:       the pointer to the initial state;
+  * `step`:     the number of steps to be skipped;
+  * `poly`:     the jump-ahead polynomial evaluated by `jump_poly`, unused
+                if step / 4 < K;
+  * `work`:     the workspace, with at least N32 words.
+******************************************************************************/
+static void state_jump(sfmt19937_state_t *out, const sfmt19937_state_t *in,
+    const uint64_t step, const uint32_t *poly, uint32_t *work) {
+  if ((step >> 2) < K) {
+    if (out != in) memcpy(out, in, sizeof(sfmt19937_state_t));
+    skip_words(out, step);
+  }
+  else {
+    state_forward(out, in, poly, work);
+    skip_words(out, step & 3);
+  }
+}
+
+/******************************************************************************
+Function `cached_poly`:
+  Retrieve the jump-ahead polynomial from the cache of the interface, and
+  evaluate it with the workspace of the cache if it is not cached.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     the number of steps to be skipped, with step / 4 >= K.
+Return:
+  The pointer to the polynomial with NW words, owned by the cache.
+******************************************************************************/
+static const uint32_t *cached_poly(prand_t *rng, const uint64_t step) {
+  prand_cache_t *cache = (prand_cache_t *) rng->cache;
+  uint32_t *poly = prand_cache_find(cache, step);
+  if (poly) return poly;
+
+  PRAND_STATS_POLY(&rng->stats, jump_poly(cache->work, step));
+  poly = prand_cache_insert(cache, step);
+  memcpy(poly, cache->work, sizeof(uint32_t) * NW);
+  return poly;
+}
+
+/******************************************************************************
+Function `sfmt19937_jump`:
+  Jump ahead for one stream. The workspace is allocated on the stack, so
+  that different streams can jump concurrently without touching the heap.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void sfmt19937_jump(void *state, const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (!step) return;
+
+  if ((step >> 2) < K) {
+    skip_words((sfmt19937_state_t *) state, step);
+    return;
+  }
+
+  /* jump-ahead polynomial, followed by the workspace for the evaluation */
+  uint32_t poly[POLY_WORK];
+  PRAND_STATS_POLY(PRAND_STATS_STREAM(state, sizeof(sfmt19937_state_t)),
+      jump_poly(poly, step));
+  state_jump(state, state, step, poly, poly + NW);
+}
+
+/******************************************************************************
+Function `sfmt19937_jump_all`:
+  Jump ahead the same number of steps for all streams.
+  If the library is compiled with OpenMP, the streams are distributed over
+  threads, which share the cached polynomial, with their own workspaces on
+  the stack.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void sfmt19937_jump_all(prand_t *rng, const uint64_t step, int *err) {
+  sfmt19937_state_t **stat = (sfmt19937_state_t **) rng->state_stream;
+  if (PRAND_IS_ERROR(*err)) return;
+  if (!step) return;
+
+  const uint32_t *poly = ((step >> 2) < K) ? NULL : cached_poly(rng, step);
+
+#ifdef _OPENMP
+  if (rng->nstream >= JUMP_ALL_PAR_MIN && omp_get_max_threads() > 1
+      && !omp_in_parallel()) {
+#pragma omp parallel
+    {
+      uint32_t work[N32];
+#pragma omp for schedule(static)
+      for (int i = 0; i < rng->nstream; i++)
+        state_jump(stat[i], stat[i], step, poly, work);
+    }
+    return;
+  }
+#endif
+
+  uint32_t *work = ((prand_cache_t *) rng->cache)->work;
+  for (int i = 0; i < rng->nstream; i++)
+    state_jump(stat[i], stat[i], step, poly, work);
+}
+
+/******************************************************************************
+Function `sfmt19937_jump_prepare`:
+  Pre-compute the jump-ahead polynomial for a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  The pre-computed jump on success; NULL on error.
+******************************************************************************/
+static prand_jump_t *sfmt19937_jump_prepare(prand_t *rng, const uint64_t step,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return NULL;
+
+  prand_jump_t *jmp = malloc(sizeof(prand_jump_t));
+  if (!jmp) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return NULL;
+  }
+  jmp->type = PRAND_RNG_SFMT19937;
+  jmp->step = step;
+  jmp->data = NULL;
+  if ((step >> 2) < K) return jmp;
+
+  if (!(jmp->data = malloc(sizeof(uint32_t) * NW))) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    free(jmp);
+    return NULL;
+  }
+  memcpy(jmp->data, cached_poly(rng, step), sizeof(uint32_t) * NW);
+  return jmp;
+}
+
+/******************************************************************************
+Function `sfmt19937_jump_apply`:
+  Jump ahead for one stream, with a pre-computed jump. The workspace is
+  allocated on the stack, as for `sfmt19937_jump`.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `jmp`:      the pre-computed jump;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void sfmt19937_jump_apply(void *state, const prand_jump_t *jmp,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (jmp->type != PRAND_RNG_SFMT19937) {
+    *err = PRAND_ERR_JUMP_TYPE;
+    return;
+  }
+  if (!jmp->step) return;
+
+  uint32_t work[N32];
+  state_jump(state, state, jmp->step, jmp->data, work);
+}
+
+/******************************************************************************
+Function `sfmt19937_reset`:
+  Reset the state for one stream, with a given seed and number of skip steps.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void sfmt19937_reset(void *state, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    sfmt19937_seed(state, DEFAULT_SEED);
+  }
+  else sfmt19937_seed(state, seed);
+
+  sfmt19937_jump(state, step, err);
+}
+
+/******************************************************************************
+Function `sfmt19937_spread`:
+  Initialise the states of all streams from the seeded first stream, with
+  the starting points separated by a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead.
+******************************************************************************/
+static void sfmt19937_spread(prand_t *rng, const uint64_t step) {
+  sfmt19937_state_t **stat = (sfmt19937_state_t **) rng->state_stream;
+
+  if (!step) {
+    for (int i = 1; i < rng->nstream; i++)
+      memcpy(stat[i], stat[0], sizeof(sfmt19937_state_t));
+    return;
+  }
+
+  const uint32_t *poly = ((step >> 2) < K) ? NULL : cached_poly(rng, step);
+  uint32_t *work = ((prand_cache_t *) rng->cache)->work;
+  if (rng->nstream <= 1) state_jump(stat[0], stat[0], step, poly, work);
+  else {
+    for (int i = 1; i < rng->nstream; i++)
+      state_jump(stat[i], stat[i - 1], step, poly, work);
+  }
+}
+
+/******************************************************************************
+Function `sfmt19937_reset_all`:
+  Reset the state for all streams, with a given seed and number of skip steps.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void sfmt19937_reset_all(prand_t *rng, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    sfmt19937_seed(rng->state, DEFAULT_SEED);
+  }
+  else sfmt19937_seed(rng->state, seed);
+
+  sfmt19937_spread(rng, step);
+}
+
+/******************************************************************************
+Macro `SFMT19937_FILL_ALL`:
+  Generate numbers from all streams in lock-step. The i-th number of the
+  s-th stream is stored as the (i * nstream + s)-th element of the output
+  array. The streams are processed one after another, with the outputs of
+  every stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream;
+  * `conv`:     the expression for converting a word `x` to a number.
+******************************************************************************/
+#define SFMT19937_FILL_ALL(rng, out, n, conv) {                         \
+  const size_t ns = (rng)->nstream;                                     \
+  for (size_t s = 0; s < ns; s++) {                                     \
+    sfmt19937_state_t *stat =                                           \
+      (sfmt19937_state_t *) (rng)->state_stream[s];                     \
+    SFMT19937_FILL(stat, (out) + s, n, ns, conv);                       \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_all`:
+  Generate integers from all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated for each stream.
+******************************************************************************/
+static void sfmt19937_fill_all(prand_t *rng, uint64_t *out, const size_t n) {
+  SFMT19937_FILL_ALL(rng, out, n, x);
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_all_double`:
+  Generate double-precision floating-point numbers in the range [0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void sfmt19937_fill_all_double(prand_t *rng, double *out,
+    const size_t n) {
+  SFMT19937_FILL_ALL(rng, out, n, x * NORM);
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_all_double_pos`:
+  Generate double-precision floating-point numbers in the range (0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void sfmt19937_fill_all_double_pos(prand_t *rng, double *out,
+    const size_t n) {
+  SFMT19937_FILL_ALL(rng, out, n, ((uint64_t) x + 1) * NORM_POS);
+}
+
+/******************************************************************************
+Function `sfmt19937_fill_all_double53`:
+  Generate double-precision floating-point numbers in the range [0,1), with
+  53-bit resolution, from all streams in lock-step.
+  The streams are processed one after another, with the outputs of every
+  stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void sfmt19937_fill_all_double53(prand_t *rng, double *out,
+    const size_t n) {
+  const size_t ns = rng->nstream;
+  for (size_t s = 0; s < ns; s++) {
+    sfmt19937_state_t *stat = (sfmt19937_state_t *) rng->state_stream[s];
+    SFMT19937_FILL53(stat, out + s, n, ns);
+  }
+}
+
+
+/*============================================================================*\
+                     Wrappers of the functions with counters
+\*============================================================================*/
+
+/* The wrappers are defined only if the library is compiled with
+ * `-DPRAND_STATS`, see `prand_stats.h`. */
+PRAND_STATS_FUNCS(sfmt19937, sfmt19937_state_t, PRAND_RNG_SFMT19937)
+
+
+/*============================================================================*\
+                          Interface for initialisation
+\*============================================================================*/
+
+/******************************************************************************
+Function `sfmt19937_init`:
+  Initialisation of the SFMT19937 generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *sfmt19937_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err) {
+  prand_t *rng = malloc(sizeof(prand_t));
+  if (!rng) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  unsigned int numstr = (nstream == 0) ? 1 : nstream;
+  rng->state_stream = malloc(sizeof(sfmt19937_state_t *) * numstr);
+  if (!rng->state_stream) {
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  void *states = prand_state_alloc(rng->state_stream,
+      sizeof(sfmt19937_state_t), numstr, PRAND_PAGE_SIZE);
+  if (!states) {
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  rng->cache = prand_cache_init(sizeof(uint32_t) * NW,
+      sizeof(uint32_t) * POLY_WORK);
+  if (!rng->cache) {
+    prand_state_free(states);
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  rng->state = rng->state_stream[0];
+  rng->substream = NULL;
+  PRAND_STATS_CLEAR(rng);
+  rng->nstream = numstr;
+  rng->type = PRAND_RNG_SFMT19937;
+  rng->min = 0;
+  rng->max = 0xffffffffUL;      /* 2^32 - 1 */
+  rng->ndraw53 = 2;
+
+  rng->get = &sfmt19937_get;
+  rng->get_double = &sfmt19937_get_double;
+  rng->get_double_pos = &sfmt19937_get_double_pos;
+  rng->get_double53 = &sfmt19937_get_double53;
+  rng->fill = &sfmt19937_fill;
+  rng->fill_double = &sfmt19937_fill_double;
+  rng->fill_double_pos = &sfmt19937_fill_double_pos;
+  rng->fill_double53 = &sfmt19937_fill_double53;
+  rng->get_gaussian = &sfmt19937_get_gaussian;
+  rng->fill_gaussian = &sfmt19937_fill_gaussian;
+  rng->fill_all = &sfmt19937_fill_all;
+  rng->fill_all_double = &sfmt19937_fill_all_double;
+  rng->fill_all_double_pos = &sfmt19937_fill_all_double_pos;
+  rng->fill_all_double53 = &sfmt19937_fill_all_double53;
+  rng->reset = &sfmt19937_reset;
+  rng->reset_all = &sfmt19937_reset_all;
+  rng->jump = &sfmt19937_jump;
+  rng->jump_all = &sfmt19937_jump_all;
+  rng->jump_prepare = &sfmt19937_jump_prepare;
+  rng->jump_apply = &sfmt19937_jump_apply;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    sfmt19937_seed(rng->state, DEFAULT_SEED);
+  }
+  else sfmt19937_seed(rng->state, seed);
+
+  sfmt19937_spread(rng, step);
+
+  PRAND_STATS_WRAP(rng, sfmt19937);
+  return rng;
+}
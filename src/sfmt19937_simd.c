@@ -0,0 +1,215 @@
+/*******************************************************************************
+* sfmt19937_simd.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+#include "sfmt19937.h"
+#include "prand_cpu.h"
+
+/*******************************************************************************
+  Kernels for generating the state array of SFMT19937, with optional
+  vectorisation. Every 128-bit word is generated with one vector register,
+  and since the recursion depends on the last two generated words, the
+  kernels do not benefit from wider vectors. All the kernels produce
+  identical results.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define N               SFMT19937_N
+#define POS1            SFMT19937_POS1
+#define SL1             SFMT19937_SL1
+#define SL2             SFMT19937_SL2
+#define SR1             SFMT19937_SR1
+#define SR2             SFMT19937_SR2
+
+
+/*============================================================================*\
+                                 Scalar kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `gen_all_scalar`:
+  Generate N 128-bit words at one time.
+Arguments:
+  * `sfmt`:     the state array.
+******************************************************************************/
+static void gen_all_scalar(uint32_t *sfmt) {
+  const uint32_t *r1 = sfmt + ((N - 2) << 2);
+  const uint32_t *r2 = sfmt + ((N - 1) << 2);
+  int i;
+  for (i = 0; i < N - POS1; i++) {
+    sfmt19937_recursion(sfmt + (i << 2), sfmt + (i << 2),
+        sfmt + ((i + POS1) << 2), r1, r2);
+    r1 = r2;
+    r2 = sfmt + (i << 2);
+  }
+  for (; i < N; i++) {
+    sfmt19937_recursion(sfmt + (i << 2), sfmt + (i << 2),
+        sfmt + ((i + POS1 - N) << 2), r1, r2);
+    r1 = r2;
+    r2 = sfmt + (i << 2);
+  }
+}
+
+static const sfmt19937_kernel_t kernel_scalar = { &gen_all_scalar };
+
+
+#ifdef PRAND_SIMD_X86
+/*============================================================================*\
+                              Kernels with SSE2
+\*============================================================================*/
+
+/******************************************************************************
+Function `recursion_sse2`:
+  Generate a 128-bit word of the state array.
+Arguments:
+  * `a`:        pointer to the word to be replaced;
+  * `b`:        pointer to the word with the offset POS1;
+  * `c`, `d`:   the last two generated words;
+  * `mask`:     the masks for the shifted `b`.
+Return:
+  The generated word.
+******************************************************************************/
+PRAND_TARGET("sse2")
+static inline __m128i recursion_sse2(const uint32_t *a, const uint32_t *b,
+    const __m128i c, const __m128i d, const __m128i mask) {
+  const __m128i x = _mm_loadu_si128((__m128i *) a);
+  const __m128i y = _mm_and_si128(
+      _mm_srli_epi32(_mm_loadu_si128((__m128i *) b), SR1), mask);
+  __m128i z = _mm_xor_si128(_mm_srli_si128(c, SR2), x);
+  z = _mm_xor_si128(z, _mm_slli_epi32(d, SL1));
+  z = _mm_xor_si128(z, _mm_slli_si128(x, SL2));
+  return _mm_xor_si128(z, y);
+}
+
+PRAND_TARGET("sse2")
+static void gen_all_sse2(uint32_t *sfmt) {
+  const __m128i mask = _mm_set_epi32((int) SFMT19937_MSK4,
+      (int) SFMT19937_MSK3, (int) SFMT19937_MSK2, (int) SFMT19937_MSK1);
+  __m128i r1 = _mm_loadu_si128((__m128i *) (sfmt + ((N - 2) << 2)));
+  __m128i r2 = _mm_loadu_si128((__m128i *) (sfmt + ((N - 1) << 2)));
+  int i;
+  for (i = 0; i < N - POS1; i++) {
+    __m128i r = recursion_sse2(sfmt + (i << 2), sfmt + ((i + POS1) << 2),
+        r1, r2, mask);
+    _mm_storeu_si128((__m128i *) (sfmt + (i << 2)), r);
+    r1 = r2;
+    r2 = r;
+  }
+  for (; i < N; i++) {
+    __m128i r = recursion_sse2(sfmt + (i << 2),
+        sfmt + ((i + POS1 - N) << 2), r1, r2, mask);
+    _mm_storeu_si128((__m128i *) (sfmt + (i << 2)), r);
+    r1 = r2;
+    r2 = r;
+  }
+}
+
+static const sfmt19937_kernel_t kernel_sse2 = { &gen_all_sse2 };
+#endif
+
+
+#ifdef PRAND_SIMD_NEON
+/*============================================================================*\
+                              Kernels with NEON
+\*============================================================================*/
+
+static inline uint32x4_t recursion_neon(const uint32_t *a, const uint32_t *b,
+    const uint32x4_t c, const uint32x4_t d, const uint32x4_t mask) {
+  const uint8x16_t zero = vdupq_n_u8(0);
+  const uint32x4_t x = vld1q_u32(a);
+  const uint32x4_t y = vandq_u32(vshrq_n_u32(vld1q_u32(b), SR1), mask);
+  /* byte shifts of the 128-bit words, as for the little-endian SSE2 */
+  const uint32x4_t xs = vreinterpretq_u32_u8(
+      vextq_u8(zero, vreinterpretq_u8_u32(x), 16 - SL2));
+  const uint32x4_t cs = vreinterpretq_u32_u8(
+      vextq_u8(vreinterpretq_u8_u32(c), zero, SR2));
+  uint32x4_t z = veorq_u32(cs, x);
+  z = veorq_u32(z, vshlq_n_u32(d, SL1));
+  z = veorq_u32(z, xs);
+  return veorq_u32(z, y);
+}
+
+static void gen_all_neon(uint32_t *sfmt) {
+  const uint32_t msk[4] = {SFMT19937_MSK1, SFMT19937_MSK2, SFMT19937_MSK3,
+    SFMT19937_MSK4};
+  const uint32x4_t mask = vld1q_u32(msk);
+  uint32x4_t r1 = vld1q_u32(sfmt + ((N - 2) << 2));
+  uint32x4_t r2 = vld1q_u32(sfmt + ((N - 1) << 2));
+  int i;
+  for (i = 0; i < N - POS1; i++) {
+    uint32x4_t r = recursion_neon(sfmt + (i << 2), sfmt + ((i + POS1) << 2),
+        r1, r2, mask);
+    vst1q_u32(sfmt + (i << 2), r);
+    r1 = r2;
+    r2 = r;
+  }
+  for (; i < N; i++) {
+    uint32x4_t r = recursion_neon(sfmt + (i << 2),
+        sfmt + ((i + POS1 - N) << 2), r1, r2, mask);
+    vst1q_u32(sfmt + (i << 2), r);
+    r1 = r2;
+    r2 = r;
+  }
+}
+
+static const sfmt19937_kernel_t kernel_neon = { &gen_all_neon };
+#endif
+
+
+/*============================================================================*\
+                            Selection of the kernels
+\*============================================================================*/
+
+/******************************************************************************
+Function `sfmt19937_kernel`:
+  Select the fastest kernels supported by the CPU.
+Return:
+  The pointer to the set of kernels.
+******************************************************************************/
+const sfmt19937_kernel_t *sfmt19937_kernel(void) {
+#if defined(PRAND_SIMD_X86)
+  if (PRAND_CPU_HAS("sse2")) return &kernel_sse2;
+#elif defined(PRAND_SIMD_NEON)
+  return &kernel_neon;
+#endif
+  return &kernel_scalar;
+}
+
+/******************************************************************************
+Function `prand_sfmt19937_gen_all`:
+  Generate `SFMT19937_N` 128-bit words of the state array at one time, with
+  the fastest kernel supported by the CPU.
+Arguments:
+  * `sfmt`:     the state array.
+******************************************************************************/
+void prand_sfmt19937_gen_all(uint32_t *sfmt) {
+  sfmt19937_kernel()->gen_all(sfmt);
+}
@@ -0,0 +1,745 @@
+/*******************************************************************************
+* xoshiro256pp.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include "xoshiro256pp.h"
+#include "xoshiro256pp_jump.h"
+#include "mt19937.h"            /* polynomial multiplication */
+#include "prand_state.h"
+#include "prand_stats.h"
+#include "prand_math.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+  Implementation of the xoshiro256++ random number generator.
+  ref: https://doi.org/10.1145/3460772
+  The outputs are identical to those of the reference implementation:
+  https://prng.di.unimi.it/xoshiro256plusplus.c
+  The integers are the 32 most significant bits of the 64-bit outputs, while
+  every floating-point number is generated from the 53 (or 52) most
+  significant bits of one output. The state is initialised with SplitMix64,
+  as recommended by the authors of the algorithm.
+
+  Jumping ahead is performed with the polynomials t^step mod phi, with phi
+  being the characteristic polynomial of the state transition, which are
+  evaluated with the same polynomial arithmetic as MT19937.
+*******************************************************************************/
+
+/*============================================================================*\
+                            Definitions of constants
+\*============================================================================*/
+
+#define K               XOSHIRO256PP_DEG
+#define NW              XOSHIRO256PP_NWORD
+
+/* Normalisation for sampling a float-point number in the range [0,1). */
+#define NORM            XOSHIRO256PP_NORM
+/* Normalisation for sampling a float-point number in the range (0,1). */
+#define NORM_POS        XOSHIRO256PP_NORM_POS
+
+#define DEFAULT_SEED    1
+
+/* Temporary space for polynomial multiplications, in words. */
+#define POLY_TMP        (NW * 8)
+
+/* Minimum number of streams for jumping ahead in parallel with OpenMP. */
+#define JUMP_ALL_PAR_MIN        1024
+
+/* The characteristic polynomial phi without the leading term t^256. */
+static const uint32_t xoshiro256pp_phi[NW] = {
+  0xb0f0f001UL, 0x9d116f2bUL, 0xcefd1a5eUL, 0x0280002bUL,
+  0x26259f85UL, 0x04b4edcfUL, 0x3f3ecb19UL, 0x0003c03cUL
+};
+
+
+/*============================================================================*\
+                            Definition of the state
+\*============================================================================*/
+
+/* The state is shared with the inline interface. */
+typedef prand_xoshiro256pp_state_t xoshiro256pp_state_t;
+
+
+/*============================================================================*\
+                     Functions for random number generation
+\*============================================================================*/
+
+/******************************************************************************
+Function `xoshiro256pp_seed`:
+  Initialise the state with an integer.
+Arguments:
+  * `state`:    the state to be intialised;
+  * `seed`:     a positive integer for the initialisation.
+******************************************************************************/
+static void xoshiro256pp_seed(void *state, uint64_t seed) {
+  xoshiro256pp_state_t *stat = (xoshiro256pp_state_t *) state;
+  /* Initialise the state with SplitMix64.
+   * validation of seed is done in `xoshiro256pp_init' */
+  for (int i = 0; i < 4; i++) {
+    uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    stat->s[i] = z ^ (z >> 31);
+  }
+  stat->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `xoshiro256pp_get`:
+  Generate an integer and update the state.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random integer.
+******************************************************************************/
+static uint64_t xoshiro256pp_get(void *state) {
+  return prand_xoshiro256pp_get((xoshiro256pp_state_t *) state);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_get_double`:
+  Generate a double-precision floating-point number in the range [0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double xoshiro256pp_get_double(void *state) {
+  return prand_xoshiro256pp_get_double((xoshiro256pp_state_t *) state);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_get_double_pos`:
+  Generate a double-precision floating-point number in the range (0,1).
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random floating-point number.
+******************************************************************************/
+static double xoshiro256pp_get_double_pos(void *state) {
+  return prand_xoshiro256pp_get_double_pos((xoshiro256pp_state_t *) state);
+}
+
+/******************************************************************************
+Macro `XOSHIRO256PP_FILL`:
+  Generate an array of numbers from one stream, with the state kept in
+  registers. The i-th number is stored as the (i * stride)-th element of the
+  output array.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated;
+  * `stride`:   the distance between consecutive outputs in the array;
+  * `conv`:     the expression for converting an output `x` to a number.
+******************************************************************************/
+#define XOSHIRO256PP_FILL(stat, out, n, stride, conv) {                 \
+  uint64_t s0 = (stat)->s[0], s1 = (stat)->s[1];                        \
+  uint64_t s2 = (stat)->s[2], s3 = (stat)->s[3];                        \
+  for (size_t i = 0; i < (n); i++) {                                    \
+    uint64_t x;                                                         \
+    XOSHIRO256PP_NEXT(x, s0, s1, s2, s3);                               \
+    (out)[i * (stride)] = conv;                                         \
+  }                                                                     \
+  (stat)->s[0] = s0; (stat)->s[1] = s1;                                 \
+  (stat)->s[2] = s2; (stat)->s[3] = s3;                                 \
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill`:
+  Generate an array of integers and update the state.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated.
+******************************************************************************/
+static void xoshiro256pp_fill(void *state, uint64_t *out, const size_t n) {
+  XOSHIRO256PP_FILL((xoshiro256pp_state_t *) state, out, n, 1, x >> 32);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_double`:
+  Generate an array of double-precision floating-point numbers in the
+  range [0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void xoshiro256pp_fill_double(void *state, double *out,
+    const size_t n) {
+  XOSHIRO256PP_FILL((xoshiro256pp_state_t *) state, out, n, 1,
+      (x >> 11) * NORM);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_double_pos`:
+  Generate an array of double-precision floating-point numbers in the
+  range (0,1).
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of floating-point numbers to be generated.
+******************************************************************************/
+static void xoshiro256pp_fill_double_pos(void *state, double *out,
+    const size_t n) {
+  XOSHIRO256PP_FILL((xoshiro256pp_state_t *) state, out, n, 1,
+      ((x >> 12) + 0.5) * NORM_POS);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_get_gaussian`:
+  Generate a Gaussian number with zero mean and unit variance, and update the
+  state. The numbers are generated in pairs with the Box-Muller method, from
+  two floating-point numbers in the range (0,1) each, and the second number
+  of a pair is cached for the next call.
+Arguments:
+  * `state`:    the state for the generator.
+Return:
+  A pseudo-random Gaussian number.
+******************************************************************************/
+static double xoshiro256pp_get_gaussian(void *state) {
+  xoshiro256pp_state_t *stat = (xoshiro256pp_state_t *) state;
+  if (stat->has_gauss) {
+    stat->has_gauss = 0;
+    return stat->gauss;
+  }
+
+  double z[2];
+  z[0] = xoshiro256pp_get_double_pos(state);
+  z[1] = xoshiro256pp_get_double_pos(state);
+  prand_box_muller(z, 1);
+  stat->gauss = z[1];
+  stat->has_gauss = 1;
+  return z[0];
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_gaussian`:
+  Generate an array of Gaussian numbers with zero mean and unit variance, and
+  update the state. The results are identical to those of calling
+  `xoshiro256pp_get_gaussian` repeatedly.
+Arguments:
+  * `state`:    the state for the generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of Gaussian numbers to be generated.
+******************************************************************************/
+static void xoshiro256pp_fill_gaussian(void *state, double *out,
+    const size_t n) {
+  xoshiro256pp_state_t *stat = (xoshiro256pp_state_t *) state;
+  size_t i = 0;
+  if (!n) return;
+  if (stat->has_gauss) {
+    out[i++] = stat->gauss;
+    stat->has_gauss = 0;
+  }
+
+  /* Generate pairs in place from the uniform numbers. */
+  const size_t npair = (n - i) >> 1;
+  xoshiro256pp_fill_double_pos(state, out + i, npair << 1);
+  prand_math_kernel()->box_muller(out + i, npair);
+  i += npair << 1;
+  if (i < n) out[i] = xoshiro256pp_get_gaussian(state);
+}
+
+
+/*============================================================================*\
+                         Functions for multiple streams
+\*============================================================================*/
+
+/******************************************************************************
+Function `poly_mod`:
+  Compute r %= phi, where phi is the characteristic polynomial of the state
+  transition, bit by bit from the highest order.
+Arguments:
+  * `r`:        the polynomial with 2 * NW words, with the first NW words
+                being the result.
+******************************************************************************/
+static void poly_mod(uint32_t *r) {
+  for (int k = (K << 1) - 1; k >= K; k--) {
+    if (!COEF(r, k)) continue;
+    r[DIV_NBIT(k)] ^= UINT32_C(1) << MOD_NBIT(k);
+    /* r += phi * t^(k - K) */
+    const int w = DIV_NBIT(k - K);
+    const int b = MOD_NBIT(k - K);
+    for (int j = 0; j < NW; j++) {
+      r[w + j] ^= xoshiro256pp_phi[j] << b;
+      if (b) r[w + j + 1] ^= xoshiro256pp_phi[j] >> (WORD_SIZE - b);
+    }
+  }
+}
+
+/******************************************************************************
+Function `poly_table`:
+  Compute the polynomial for a given skipping step from pre-computed values.
+Arguments:
+  * `poly`:     the array for storing the polynomial, with NW words;
+  * `step`:     the number of steps to be skipped, must be positive.
+******************************************************************************/
+static void poly_table(uint32_t *poly, const uint64_t step) {
+  uint32_t pm[NW << 1];         /* result of multiplication */
+  uint32_t tmp[POLY_TMP];       /* temporary array for multiplication */
+
+  /* The polynomial is simply t^step if no modular reduction is needed. */
+  memset(poly, 0, sizeof(uint32_t) * NW);
+  if (step < K) {
+    poly[DIV_NBIT(step)] = UINT32_C(1) << MOD_NBIT(step);
+    return;
+  }
+
+  /* split n with base 8 */
+  int i = 0, init = 0;
+  uint64_t n = step;
+  while (n) {
+    int j = n & 0x07UL;
+    if (j) {
+      if (!init) {      /* initialise the polynomial */
+        memcpy(poly, xoshiro256pp_poly[i][j-1], sizeof(uint32_t) * NW);
+        init = 1;
+      }
+      else {            /* polynomial multiplication and modular reduction */
+        poly_mul(pm, poly, xoshiro256pp_poly[i][j-1], NW, tmp);
+        poly_mod(pm);
+        memcpy(poly, pm, sizeof(uint32_t) * NW);
+      }
+    }
+    i += 1;
+    n >>= 3;
+  }
+}
+
+/******************************************************************************
+Function `state_forward`:
+  Update the state with the jump-ahead polynomial, i.e., compute
+      sum_i c_i * T^i s,
+  where c_i are the coefficients of the polynomial, T is the state
+  transition, and s is the initial state.
+Arguments:
+  * `out`:      the pointer to the resulting state;
+  * `in`:       the pointer to the initial state;
+  * `poly`:     the jump-ahead polynomial.
+******************************************************************************/
+static void state_forward(xoshiro256pp_state_t *out,
+    const xoshiro256pp_state_t *in, const uint32_t *poly) {
+  uint64_t s0 = in->s[0], s1 = in->s[1], s2 = in->s[2], s3 = in->s[3];
+  uint64_t t0, t1, t2, t3, x;
+  t0 = t1 = t2 = t3 = 0;
+  for (int i = 0; i < NW; i++) {
+    uint32_t c = poly[i];
+    for (int j = 0; j < WORD_SIZE; j++, c >>= 1) {
+      if (c & 1) {
+        t0 ^= s0; t1 ^= s1; t2 ^= s2; t3 ^= s3;
+      }
+      XOSHIRO256PP_NEXT(x, s0, s1, s2, s3);
+    }
+  }
+  (void) x;
+  out->s[0] = t0; out->s[1] = t1; out->s[2] = t2; out->s[3] = t3;
+  out->has_gauss = 0;
+}
+
+/******************************************************************************
+Function `state_skip`:
+  Jump ahead for one stream, by stepping the state directly for short jumps
+  or with the jump-ahead polynomial otherwise.
+Arguments:
+  * `stat`:     the state for the generator;
+  * `step`:     the number of steps to be skipped, must be positive.
+******************************************************************************/
+static void state_skip(xoshiro256pp_state_t *stat, const uint64_t step) {
+  if (step < K) {
+    for (uint64_t i = 0; i < step; i++) prand_xoshiro256pp_next(stat);
+    stat->has_gauss = 0;
+    return;
+  }
+  uint32_t poly[NW];
+  PRAND_STATS_POLY(PRAND_STATS_STREAM(stat, sizeof(xoshiro256pp_state_t)),
+      poly_table(poly, step));
+  state_forward(stat, stat, poly);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_jump`:
+  Jump ahead for one stream.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void xoshiro256pp_jump(void *state, const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (!step) return;
+  else if (step > XOSHIRO256PP_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return;
+  }
+
+  state_skip((xoshiro256pp_state_t *) state, step);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_jump_all`:
+  Jump ahead the same number of steps for all streams.
+  If the library is compiled with OpenMP, the streams are distributed over
+  threads, which share the jump-ahead polynomial.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void xoshiro256pp_jump_all(prand_t *rng, const uint64_t step,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (!step) return;
+  else if (step > XOSHIRO256PP_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return;
+  }
+
+  uint32_t poly[NW];
+  PRAND_STATS_POLY(&rng->stats, poly_table(poly, step));
+  xoshiro256pp_state_t **stat = (xoshiro256pp_state_t **) rng->state_stream;
+
+#ifdef _OPENMP
+  if (rng->nstream >= JUMP_ALL_PAR_MIN && omp_get_max_threads() > 1
+      && !omp_in_parallel()) {
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < rng->nstream; i++)
+      state_forward(stat[i], stat[i], poly);
+    return;
+  }
+#endif
+
+  for (int i = 0; i < rng->nstream; i++)
+    state_forward(stat[i], stat[i], poly);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_jump_prepare`:
+  Pre-compute the jump-ahead polynomial for a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  The pre-computed jump on success; NULL on error.
+******************************************************************************/
+static prand_jump_t *xoshiro256pp_jump_prepare(prand_t *rng,
+    const uint64_t step, int *err) {
+  (void) rng;
+  if (PRAND_IS_ERROR(*err)) return NULL;
+  if (step > XOSHIRO256PP_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return NULL;
+  }
+
+  prand_jump_t *jmp = malloc(sizeof(prand_jump_t));
+  if (!jmp) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    return NULL;
+  }
+  jmp->type = PRAND_RNG_XOSHIRO256PP;
+  jmp->step = step;
+  jmp->data = NULL;
+  if (!step) return jmp;
+
+  if (!(jmp->data = malloc(sizeof(uint32_t) * NW))) {
+    *err = PRAND_ERR_MEMORY_JUMP;
+    free(jmp);
+    return NULL;
+  }
+  PRAND_STATS_POLY(&rng->stats, poly_table(jmp->data, step));
+  return jmp;
+}
+
+/******************************************************************************
+Function `xoshiro256pp_jump_apply`:
+  Jump ahead for one stream, with a pre-computed jump.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `jmp`:      the pre-computed jump;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void xoshiro256pp_jump_apply(void *state, const prand_jump_t *jmp,
+    int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+  if (jmp->type != PRAND_RNG_XOSHIRO256PP) {
+    *err = PRAND_ERR_JUMP_TYPE;
+    return;
+  }
+  if (!jmp->step) return;
+
+  state_forward(state, state, jmp->data);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_reset`:
+  Reset the state for one stream, with a given seed and number of skip steps.
+Arguments:
+  * `state`:    the current state (to be over-written);
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void xoshiro256pp_reset(void *state, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    xoshiro256pp_seed(state, DEFAULT_SEED);
+  }
+  else xoshiro256pp_seed(state, seed);
+
+  xoshiro256pp_jump(state, step, err);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_spread`:
+  Initialise the states of all streams from the seeded first stream, with
+  the starting points separated by a given step size.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `step`:     step size for jumping ahead.
+******************************************************************************/
+static void xoshiro256pp_spread(prand_t *rng, const uint64_t step) {
+  xoshiro256pp_state_t **stat = (xoshiro256pp_state_t **) rng->state_stream;
+
+  if (!step) {
+    for (int i = 1; i < rng->nstream; i++)
+      memcpy(stat[i], stat[0], sizeof(xoshiro256pp_state_t));
+    return;
+  }
+
+  uint32_t poly[NW];
+  PRAND_STATS_POLY(&rng->stats, poly_table(poly, step));
+  if (rng->nstream <= 1) state_forward(stat[0], stat[0], poly);
+  else {
+    for (int i = 1; i < rng->nstream; i++)
+      state_forward(stat[i], stat[i - 1], poly);
+  }
+}
+
+/******************************************************************************
+Function `xoshiro256pp_reset_all`:
+  Reset the state for all streams, with a given seed and number of skip steps.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `seed`:     an integer for initalisation the generator;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+******************************************************************************/
+static void xoshiro256pp_reset_all(prand_t *rng, const uint64_t seed,
+    const uint64_t step, int *err) {
+  if (PRAND_IS_ERROR(*err)) return;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    xoshiro256pp_seed(rng->state, DEFAULT_SEED);
+  }
+  else xoshiro256pp_seed(rng->state, seed);
+
+  if (step > XOSHIRO256PP_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return;
+  }
+  xoshiro256pp_spread(rng, step);
+}
+
+/******************************************************************************
+Macro `XOSHIRO256PP_FILL_ALL`:
+  Generate numbers from all streams in lock-step. The i-th number of the
+  s-th stream is stored as the (i * nstream + s)-th element of the output
+  array. The streams are processed one after another, with the outputs of
+  every stream written with a stride of nstream.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream;
+  * `conv`:     the expression for converting an output `x` to a number.
+******************************************************************************/
+#define XOSHIRO256PP_FILL_ALL(rng, out, n, conv) {                      \
+  const size_t ns = (rng)->nstream;                                     \
+  for (size_t s = 0; s < ns; s++) {                                     \
+    xoshiro256pp_state_t *stat =                                        \
+      (xoshiro256pp_state_t *) (rng)->state_stream[s];                  \
+    XOSHIRO256PP_FILL(stat, (out) + s, n, ns, conv);                    \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_all`:
+  Generate integers from all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated integers;
+  * `n`:        the number of integers to be generated for each stream.
+******************************************************************************/
+static void xoshiro256pp_fill_all(prand_t *rng, uint64_t *out,
+    const size_t n) {
+  XOSHIRO256PP_FILL_ALL(rng, out, n, x >> 32);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_all_double`:
+  Generate double-precision floating-point numbers in the range [0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void xoshiro256pp_fill_all_double(prand_t *rng, double *out,
+    const size_t n) {
+  XOSHIRO256PP_FILL_ALL(rng, out, n, (x >> 11) * NORM);
+}
+
+/******************************************************************************
+Function `xoshiro256pp_fill_all_double_pos`:
+  Generate double-precision floating-point numbers in the range (0,1) from
+  all streams in lock-step.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `out`:      the array for storing the generated numbers;
+  * `n`:        the number of numbers to be generated for each stream.
+******************************************************************************/
+static void xoshiro256pp_fill_all_double_pos(prand_t *rng, double *out,
+    const size_t n) {
+  XOSHIRO256PP_FILL_ALL(rng, out, n, ((x >> 12) + 0.5) * NORM_POS);
+}
+
+
+/*============================================================================*\
+                     Wrappers of the functions with counters
+\*============================================================================*/
+
+/* The wrappers are defined only if the library is compiled with
+ * `-DPRAND_STATS`, see `prand_stats.h`. */
+#ifdef PRAND_STATS
+/* The numbers with 53-bit resolution are identical to the other ones. */
+#define xoshiro256pp_get_double53        xoshiro256pp_get_double
+#define xoshiro256pp_fill_double53       xoshiro256pp_fill_double
+#define xoshiro256pp_fill_all_double53   xoshiro256pp_fill_all_double
+#endif
+PRAND_STATS_FUNCS(xoshiro256pp, xoshiro256pp_state_t, PRAND_RNG_XOSHIRO256PP)
+
+
+/*============================================================================*\
+                          Interface for initialisation
+\*============================================================================*/
+
+/******************************************************************************
+Function `xoshiro256pp_init`:
+  Initialisation of the xoshiro256++ generator, with the universal API.
+Arguments:
+  * `seed`:     an integer for initalisation the generator;
+  * `nstream`:  total number of streams;
+  * `step`:     step size for jumping ahead;
+  * `err`:      an integer for storing the error message.
+Return:
+  A universal instance of the random number generator.
+******************************************************************************/
+prand_t *xoshiro256pp_init(const uint64_t seed, const unsigned int nstream,
+    const uint64_t step, int *err) {
+  /* `step` should not be larger than the pre-computed length. */
+  if (step > XOSHIRO256PP_MAX_STEP) {
+    *err = PRAND_ERR_STEP;
+    return NULL;
+  }
+
+  prand_t *rng = malloc(sizeof(prand_t));
+  if (!rng) {
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  unsigned int numstr = (nstream == 0) ? 1 : nstream;
+  rng->state_stream = malloc(sizeof(xoshiro256pp_state_t *) * numstr);
+  if (!rng->state_stream) {
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  void *states = prand_state_alloc(rng->state_stream,
+      sizeof(xoshiro256pp_state_t), numstr, PRAND_CACHE_LINE);
+  if (!states) {
+    free(rng->state_stream);
+    free(rng);
+    *err = PRAND_ERR_MEMORY;
+    return NULL;
+  }
+
+  rng->state = rng->state_stream[0];
+  rng->substream = NULL;
+  PRAND_STATS_CLEAR(rng);
+  rng->nstream = numstr;
+  rng->type = PRAND_RNG_XOSHIRO256PP;
+  rng->min = 0;
+  rng->max = 0xffffffffUL;      /* 2^32 - 1 */
+  rng->ndraw53 = 1;             /* doubles have 53-bit resolution already */
+  rng->cache = NULL;            /* jump-ahead polynomials are cheap */
+
+  rng->get = &xoshiro256pp_get;
+  rng->get_double = &xoshiro256pp_get_double;
+  rng->get_double_pos = &xoshiro256pp_get_double_pos;
+  rng->get_double53 = &xoshiro256pp_get_double;
+  rng->fill = &xoshiro256pp_fill;
+  rng->fill_double = &xoshiro256pp_fill_double;
+  rng->fill_double_pos = &xoshiro256pp_fill_double_pos;
+  rng->fill_double53 = &xoshiro256pp_fill_double;
+  rng->get_gaussian = &xoshiro256pp_get_gaussian;
+  rng->fill_gaussian = &xoshiro256pp_fill_gaussian;
+  rng->fill_all = &xoshiro256pp_fill_all;
+  rng->fill_all_double = &xoshiro256pp_fill_all_double;
+  rng->fill_all_double_pos = &xoshiro256pp_fill_all_double_pos;
+  rng->fill_all_double53 = &xoshiro256pp_fill_all_double;
+  rng->reset = &xoshiro256pp_reset;
+  rng->reset_all = &xoshiro256pp_reset_all;
+  rng->jump = &xoshiro256pp_jump;
+  rng->jump_all = &xoshiro256pp_jump_all;
+  rng->jump_prepare = &xoshiro256pp_jump_prepare;
+  rng->jump_apply = &xoshiro256pp_jump_apply;
+
+  if (seed == 0) {
+    *err = PRAND_WARN_SEED;
+    xoshiro256pp_seed(rng->state, DEFAULT_SEED);
+  }
+  else xoshiro256pp_seed(rng->state, seed);
+
+  xoshiro256pp_spread(rng, step);
+
+  PRAND_STATS_WRAP(rng, xoshiro256pp);
+  return rng;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* check.h: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef __CHECK_H__
+#define __CHECK_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "prand.h"
+
+/*============================================================================*\
+                      Definitions shared by all the tests
+\*============================================================================*/
+
+#define SEED            1
+
+/* Random number generators to be tested, with their maximum step sizes. */
+static const struct {
+  prand_rng_enum type;
+  const char *name;
+  uint64_t max_step;
+} generators[] = {
+  {PRAND_RNG_MRG32K3A, "MRG32k3a", UINT64_C(0x7fffffffffffffff)},
+  {PRAND_RNG_MT19937, "MT19937", UINT64_C(0x7fffffffffffffff)},
+  {PRAND_RNG_PHILOX4X32, "Philox4x32-10", UINT64_MAX},
+  {PRAND_RNG_XOSHIRO256PP, "xoshiro256++", UINT64_C(0x7fffffffffffffff)},
+  {PRAND_RNG_SFMT19937, "SFMT19937", UINT64_MAX},
+  {PRAND_RNG_DSFMT19937, "dSFMT19937", UINT64_MAX}
+};
+#define NUM_GENERATOR   ((int) (sizeof(generators) / sizeof(generators[0])))
+
+#define CHECK_ERROR(err)                                        \
+  if (PRAND_IS_ERROR(err)) {                                   \
+    fprintf(stderr, "Error: %s\n", prand_errmsg(err));         \
+    exit(EXIT_FAILURE);                                         \
+  }
+
+/* Number of failed checks. */
+static int num_fail = 0;
+
+/* Report a check that failed, which does not stop the test. */
+#define CHECK(cond, gen, ...) {                                 \
+  if (!(cond)) {                                                \
+    fprintf(stderr, "FAIL: %s: ", gen);                         \
+    fprintf(stderr, __VA_ARGS__);                               \
+    fprintf(stderr, "\n");                                      \
+    num_fail++;                                                 \
+  }                                                             \
+}
+
+/******************************************************************************
+Function `check_summary`:
+  Print the summary of a test.
+Arguments:
+  * `name`:     name of the test.
+Return:
+  The exit status of the test.
+******************************************************************************/
+static inline int check_summary(const char *name) {
+  if (num_fail) {
+    fprintf(stderr, "%s: %d check(s) failed\n", name, num_fail);
+    return EXIT_FAILURE;
+  }
+  printf("%s: all checks passed\n", name);
+  return EXIT_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* prand_dump.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <string.h>
+#include "check.h"
+
+/*******************************************************************************
+  Driver for external statistical test suites, such as PractRand, which
+  writes raw 32-bit words to the standard output, sampled with the batch
+  functions of the library. With multiple streams, the numbers of the streams
+  are interleaved, as they are sampled by `fill_all`. Usage:
+
+    prand_dump GENERATOR [SEED [NSTREAM [STEP [NUM]]]] | RNG_test stdin32
+
+  where GENERATOR is the index or name of the generator, and NUM is the
+  number of 32-bit words to be written, which is unlimited by default.
+*******************************************************************************/
+
+#define NUM_BUF         8192            /* words per batch */
+
+/******************************************************************************
+Function `parse_generator`:
+  Find a generator by its index or name.
+Arguments:
+  * `str`:      the argument of the command line.
+Return:
+  Index of the generator in `generators`, or -1 if it is not found.
+******************************************************************************/
+static int parse_generator(const char *str) {
+  char *end;
+  const long idx = strtol(str, &end, 10);
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    if (!strcmp(str, generators[g].name) ||
+        (*str && !*end && idx == (long) generators[g].type)) return g;
+  }
+  return -1;
+}
+
+int main(int argc, char *argv[]) {
+  const int g = (argc > 1) ? parse_generator(argv[1]) : -1;
+  if (g < 0) {
+    fprintf(stderr, "Usage: %s GENERATOR [SEED [NSTREAM [STEP [NUM]]]]\n"
+        "GENERATOR:", argv[0]);
+    for (int i = 0; i < NUM_GENERATOR; i++)
+      fprintf(stderr, " %d (%s)", (int) generators[i].type,
+          generators[i].name);
+    fprintf(stderr, "\n");
+    return EXIT_FAILURE;
+  }
+  const uint64_t seed = (argc > 2) ? strtoull(argv[2], NULL, 0) : SEED;
+  const int nstream = (argc > 3) ? atoi(argv[3]) : 1;
+  const uint64_t step = (argc > 4) ? strtoull(argv[4], NULL, 0) : 0;
+  uint64_t num = (argc > 5) ? strtoull(argv[5], NULL, 0) : 0;
+  const int unlimited = (num == 0);
+
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, seed, nstream, step, &err);
+  CHECK_ERROR(err);
+
+  /* Generators with full 32-bit outputs are dumped directly, and the others
+   * are converted from the 53-bit floating-point numbers. */
+  const int full = (rng->min == 0 && rng->max == UINT32_MAX);
+  const size_t n = NUM_BUF / nstream + 1;
+  uint64_t *ibuf = malloc(sizeof(uint64_t) * n * nstream);
+  double *dbuf = malloc(sizeof(double) * n * nstream);
+  uint32_t *out = malloc(sizeof(uint32_t) * n * nstream);
+  if (!ibuf || !dbuf || !out) {
+    fprintf(stderr, "Error: failed to allocate memory for the buffers\n");
+    return EXIT_FAILURE;
+  }
+
+  while (unlimited || num) {
+    size_t len = n * nstream;
+    if (full) {
+      if (nstream == 1) rng->fill(rng->state, ibuf, n);
+      else rng->fill_all(rng, ibuf, n);
+      for (size_t i = 0; i < len; i++) out[i] = (uint32_t) ibuf[i];
+    }
+    else {
+      if (nstream == 1) rng->fill_double53(rng->state, dbuf, n);
+      else rng->fill_all_double53(rng, dbuf, n);
+      for (size_t i = 0; i < len; i++) out[i] = (uint32_t) (dbuf[i] * 0x1p32);
+    }
+    if (!unlimited && len > num) len = num;
+    if (fwrite(out, sizeof(uint32_t), len, stdout) != len) break;
+    if (!unlimited) num -= len;
+  }
+
+  free(ibuf);
+  free(dbuf);
+  free(out);
+  prand_destroy(rng);
+  return EXIT_SUCCESS;
+}
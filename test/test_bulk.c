@@ -0,0 +1,334 @@
+/*******************************************************************************
+* test_bulk.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <string.h>
+#include "check.h"
+#include "prand_inline.h"
+
+/*******************************************************************************
+  Test of the batch sampling functions of all generators: the numbers must be
+  identical to the ones sampled one by one, for any number of outputs and any
+  starting position in the blocks of the generators, and the states must be
+  advanced by the same numbers of steps.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_STREAM      5
+#define STREAM_STEP     1000
+#define NUM_NEXT        16      /* numbers compared after the batch */
+#define MAX_LEN         4099
+
+/* Numbers consumed before the batch, for different positions in blocks. */
+static const size_t offset[] = {0, 1, 2, 7, 623, 1000};
+#define NUM_OFFSET      ((int) (sizeof(offset) / sizeof(offset[0])))
+
+/* Lengths of the batches, around the block sizes. */
+static const size_t length[] = {
+  0, 1, 2, 3, 8, 17, 255, 382, 623, 624, 625, 1249, MAX_LEN
+};
+#define NUM_LENGTH      ((int) (sizeof(length) / sizeof(length[0])))
+
+/* Types of the sampled numbers. */
+typedef enum {
+  KIND_INT, KIND_DOUBLE, KIND_DOUBLE_POS, KIND_DOUBLE53, KIND_GAUSSIAN,
+  NUM_KIND
+} kind_enum;
+
+static const char *kind_name[NUM_KIND] = {
+  "fill", "fill_double", "fill_double_pos", "fill_double53", "fill_gaussian"
+};
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `bits`:
+  Reinterpret a floating-point number as an integer, for exact comparisons.
+Arguments:
+  * `x`:        the floating-point number.
+Return:
+  The bits of the number.
+******************************************************************************/
+static uint64_t bits(const double x) {
+  uint64_t u;
+  memcpy(&u, &x, sizeof(double));
+  return u;
+}
+
+/******************************************************************************
+Function `scalar`:
+  Sample one number with the scalar function of a given type.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream;
+  * `kind`:     type of the number.
+Return:
+  The bits of the number.
+******************************************************************************/
+static uint64_t scalar(prand_t *rng, void *state, const kind_enum kind) {
+  switch (kind) {
+    case KIND_INT:        return rng->get(state);
+    case KIND_DOUBLE:     return bits(rng->get_double(state));
+    case KIND_DOUBLE_POS: return bits(rng->get_double_pos(state));
+    case KIND_DOUBLE53:   return bits(rng->get_double53(state));
+    default:              return bits(rng->get_gaussian(state));
+  }
+}
+
+/******************************************************************************
+Function `batch`:
+  Sample numbers with the batch function of a given type.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state of the stream;
+  * `kind`:     type of the numbers;
+  * `out`:      the array for the bits of the numbers;
+  * `buf`:      the buffer for floating-point numbers;
+  * `n`:        the number of numbers.
+******************************************************************************/
+static void batch(prand_t *rng, void *state, const kind_enum kind,
+    uint64_t *out, double *buf, const size_t n) {
+  switch (kind) {
+    case KIND_INT:        rng->fill(state, out, n); return;
+    case KIND_DOUBLE:     rng->fill_double(state, buf, n); break;
+    case KIND_DOUBLE_POS: rng->fill_double_pos(state, buf, n); break;
+    case KIND_DOUBLE53:   rng->fill_double53(state, buf, n); break;
+    default:              rng->fill_gaussian(state, buf, n); break;
+  }
+  for (size_t i = 0; i < n; i++) out[i] = bits(buf[i]);
+}
+
+/******************************************************************************
+Function `batch_all`:
+  Sample numbers from all streams with the lock-step function of a given
+  type, except for Gaussian numbers.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `kind`:     type of the numbers;
+  * `out`:      the array for the bits of the numbers;
+  * `buf`:      the buffer for floating-point numbers;
+  * `n`:        the number of numbers for every stream.
+******************************************************************************/
+static void batch_all(prand_t *rng, const kind_enum kind, uint64_t *out,
+    double *buf, const size_t n) {
+  switch (kind) {
+    case KIND_INT:        rng->fill_all(rng, out, n); return;
+    case KIND_DOUBLE:     rng->fill_all_double(rng, buf, n); break;
+    case KIND_DOUBLE_POS: rng->fill_all_double_pos(rng, buf, n); break;
+    default:              rng->fill_all_double53(rng, buf, n); break;
+  }
+  for (size_t i = 0; i < n * rng->nstream; i++) out[i] = bits(buf[i]);
+}
+
+static uint64_t out[MAX_LEN * NUM_STREAM];
+static double buf[MAX_LEN * NUM_STREAM];
+
+
+/*============================================================================*\
+                                 The checks
+\*============================================================================*/
+
+/******************************************************************************
+Function `check_fill`:
+  Check the batch functions for one stream.
+Arguments:
+  * `g`:        index of the generator;
+  * `kind`:     type of the numbers;
+  * `off`:      numbers consumed before the batch;
+  * `n`:        the number of numbers.
+******************************************************************************/
+static void check_fill(const int g, const kind_enum kind, const size_t off,
+    const size_t n) {
+  int err = 0;
+  prand_t *a = prand_init(generators[g].type, SEED, 1, 0, &err);
+  prand_t *b = prand_init(generators[g].type, SEED, 1, 0, &err);
+  CHECK_ERROR(err);
+  for (size_t i = 0; i < off; i++) {
+    scalar(a, a->state, kind);
+    scalar(b, b->state, kind);
+  }
+
+  batch(a, a->state, kind, out, buf, n);
+  size_t i;
+  for (i = 0; i < n; i++) {
+    if (out[i] != scalar(b, b->state, kind)) break;
+  }
+  CHECK(i == n, generators[g].name, "%s differs at %zu, offset %zu, "
+      "length %zu", kind_name[kind], i, off, n);
+  for (i = 0; i < NUM_NEXT; i++) {
+    if (scalar(a, a->state, kind) != scalar(b, b->state, kind)) break;
+  }
+  CHECK(i == NUM_NEXT, generators[g].name, "state differs after %s, "
+      "offset %zu, length %zu", kind_name[kind], off, n);
+  prand_destroy(a);
+  prand_destroy(b);
+}
+
+/******************************************************************************
+Function `check_fill_all`:
+  Check the lock-step batch functions for all streams.
+Arguments:
+  * `g`:        index of the generator;
+  * `kind`:     type of the numbers;
+  * `off`:      numbers consumed before the batch;
+  * `n`:        the number of numbers for every stream.
+******************************************************************************/
+static void check_fill_all(const int g, const kind_enum kind,
+    const size_t off, const size_t n) {
+  const prand_rng_enum type = generators[g].type;
+  int err = 0;
+  prand_t *a = prand_init(type, SEED, NUM_STREAM, STREAM_STEP, &err);
+  prand_t *b = prand_init(type, SEED, NUM_STREAM, STREAM_STEP, &err);
+  CHECK_ERROR(err);
+  for (int s = 0; s < NUM_STREAM; s++) {
+    /* different positions for different streams */
+    for (size_t i = 0; i < off * s; i++) {
+      scalar(a, a->state_stream[s], kind);
+      scalar(b, b->state_stream[s], kind);
+    }
+  }
+
+  batch_all(a, kind, out, buf, n);
+  int fail = 0;
+  for (int s = 0; s < NUM_STREAM; s++) {
+    for (size_t i = 0; i < n; i++) {
+      if (out[i * NUM_STREAM + s] != scalar(b, b->state_stream[s], kind))
+        fail = 1;
+    }
+    for (size_t i = 0; i < NUM_NEXT; i++) {
+      if (scalar(a, a->state_stream[s], kind) !=
+          scalar(b, b->state_stream[s], kind)) fail = 1;
+    }
+  }
+  CHECK(!fail, generators[g].name, "%s differs from the streams, "
+      "offset %zu, length %zu", kind_name[kind] + 4, off, n);
+  prand_destroy(a);
+  prand_destroy(b);
+}
+
+/* Compare the inline functions with the function pointers of `prand_t`. */
+#define CHECK_INLINE(gen, a, b, n, fail) {                              \
+  prand_##gen##_state_t *stat = (b)->state;                             \
+  for (size_t i = 0; i < (n); i++) {                                    \
+    if (PRAND_INLINE_GET(gen, stat) != (a)->get((a)->state) ||          \
+        bits(PRAND_INLINE_GET_DOUBLE(gen, stat)) !=                     \
+        bits((a)->get_double((a)->state)) ||                            \
+        bits(PRAND_INLINE_GET_DOUBLE_POS(gen, stat)) !=                 \
+        bits((a)->get_double_pos((a)->state)) ||                        \
+        bits(PRAND_INLINE_GET_DOUBLE53(gen, stat)) !=                   \
+        bits((a)->get_double53((a)->state))) (fail) = 1;                \
+  }                                                                     \
+}
+
+/******************************************************************************
+Function `check_inline`:
+  Check the inline interface against the function pointers.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_inline(const int g) {
+  int err = 0, fail = 0;
+  prand_t *a = prand_init(generators[g].type, SEED, 1, 0, &err);
+  prand_t *b = prand_init(generators[g].type, SEED, 1, 0, &err);
+  CHECK_ERROR(err);
+  switch (generators[g].type) {
+    case PRAND_RNG_MRG32K3A:
+      CHECK_INLINE(mrg32k3a, a, b, MAX_LEN, fail); break;
+    case PRAND_RNG_MT19937:
+      CHECK_INLINE(mt19937, a, b, MAX_LEN, fail); break;
+    case PRAND_RNG_PHILOX4X32:
+      CHECK_INLINE(philox4x32, a, b, MAX_LEN, fail); break;
+    case PRAND_RNG_XOSHIRO256PP:
+      CHECK_INLINE(xoshiro256pp, a, b, MAX_LEN, fail); break;
+    case PRAND_RNG_SFMT19937:
+      CHECK_INLINE(sfmt19937, a, b, MAX_LEN, fail); break;
+    case PRAND_RNG_DSFMT19937:
+      CHECK_INLINE(dsfmt19937, a, b, MAX_LEN, fail); break;
+  }
+  CHECK(!fail, generators[g].name, "inline functions differ");
+  prand_destroy(a);
+  prand_destroy(b);
+}
+
+/******************************************************************************
+Function `check_poisson`:
+  Check the Poisson numbers from a pre-computed table, requested in parts,
+  against the ones of the one-shot function.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_poisson(const int g) {
+  static const double mean[] = {0.3, 3.5, 1e4};
+  static uint64_t ref[MAX_LEN];
+  int err = 0;
+  for (size_t m = 0; m < sizeof(mean) / sizeof(mean[0]); m++) {
+    prand_t *a = prand_init(generators[g].type, SEED, 1, 0, &err);
+    prand_t *b = prand_init(generators[g].type, SEED, 1, 0, &err);
+    CHECK_ERROR(err);
+    prand_fill_poisson(a, a->state, ref, MAX_LEN, mean[m], &err);
+    prand_poisson_t *pois = prand_poisson_prepare(mean[m], &err);
+    CHECK_ERROR(err);
+    prand_fill_poisson_prepared(b, b->state, out, 1000, pois);
+    prand_fill_poisson_prepared(b, b->state, out + 1000, MAX_LEN - 1000, pois);
+    CHECK(!memcmp(ref, out, sizeof(uint64_t) * MAX_LEN), generators[g].name,
+        "prand_fill_poisson_prepared differs with mean %g", mean[m]);
+    prand_poisson_destroy(pois);
+    prand_destroy(a);
+    prand_destroy(b);
+  }
+
+  prand_poisson_t *pois = prand_poisson_prepare(-1, &err);
+  CHECK(!pois && err == PRAND_ERR_PARAM, generators[g].name,
+      "prand_poisson_prepare accepts a negative mean");
+  prand_poisson_destroy(pois);
+}
+
+int main(void) {
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    for (int k = 0; k < NUM_KIND; k++) {
+      for (int i = 0; i < NUM_OFFSET; i++) {
+        for (int j = 0; j < NUM_LENGTH; j++) {
+          check_fill(g, k, offset[i], length[j]);
+          if (k != KIND_GAUSSIAN) check_fill_all(g, k, offset[i], length[j]);
+        }
+      }
+    }
+    check_inline(g);
+    check_poisson(g);
+    printf("%s: batch sampling checked\n", generators[g].name);
+    fflush(stdout);
+  }
+  return check_summary("test_bulk");
+}
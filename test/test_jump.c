@@ -0,0 +1,463 @@
+/*******************************************************************************
+* test_jump.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <limits.h>
+#include "check.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+  Test of the jumps of all generators: the i-th stream of `prand_init` with
+  a given step size must be identical to skipping i * step numbers of a
+  single stream, no matter whether the numbers are sampled one by one, or
+  skipped with any of the jump functions.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_STREAM      4
+#define NUM_COMPARE     1500    /* numbers compared, longer than 2 blocks */
+#define NUM_ANCHOR      1000    /* numbers sampled after a shorter jump */
+#define NUM_ROUND       64      /* rounds of sampling a shared lazy stream */
+#define NUM_DRAW        100     /* numbers sampled in every round */
+#define NUM_OFFSET      UINT64_C(1000000000037)   /* position of the round */
+
+/* Step sizes checked against sampling the numbers one by one, around the
+ * block sizes, and the thresholds of the polynomial jumps. */
+static const uint64_t small_step[] = {
+  1, 2, 3, 4, 5, 255, 256, 257, 623, 624, 625, 1000, 1248, 39874, 39875,
+  79748, 79749, 100003
+};
+#define NUM_SMALL       ((int) (sizeof(small_step) / sizeof(small_step[0])))
+
+/* Step sizes checked against the compositions of jumps, up to the maximum
+ * step sizes of all generators. */
+static const uint64_t large_step[] = {
+  UINT64_C(1048576), UINT64_C(1000000007), UINT64_C(1099511640321),
+  UINT64_C(1000000000000037), UINT64_C(0x4000000000000001),
+  UINT64_C(0x7ffffffffffffffe), UINT64_C(0x7fffffffffffffff),
+  UINT64_C(0xfffffffffffffffe), UINT64_MAX
+};
+#define NUM_LARGE       ((int) (sizeof(large_step) / sizeof(large_step[0])))
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `single`:
+  Initialise a single stream without jumping ahead.
+Arguments:
+  * `g`:        index of the generator.
+Return:
+  The interface of the random number generator.
+******************************************************************************/
+static prand_t *single(const int g) {
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, SEED, 1, 0, &err);
+  CHECK_ERROR(err);
+  return rng;
+}
+
+/******************************************************************************
+Function `skip`:
+  Skip numbers by sampling them one by one.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `state`:    the state to be advanced;
+  * `n`:        the number of numbers to be skipped.
+******************************************************************************/
+static void skip(prand_t *rng, void *state, uint64_t n) {
+  for (; n; n--) rng->get(state);
+}
+
+/******************************************************************************
+Function `compare`:
+  Compare the numbers sampled from two states, and release the interfaces.
+Arguments:
+  * `g`:        index of the generator;
+  * `what`:     description of the comparison;
+  * `step`:     the step size;
+  * `a`, `sa`:  the first interface and state;
+  * `b`, `sb`:  the second interface and state.
+******************************************************************************/
+static void compare(const int g, const char *what, const uint64_t step,
+    prand_t *a, void *sa, prand_t *b, void *sb) {
+  int i;
+  for (i = 0; i < NUM_COMPARE; i++) {
+    if (a->get(sa) != b->get(sb)) break;
+  }
+  CHECK(i == NUM_COMPARE, generators[g].name,
+      "%s differs for step %" PRIu64 " at number %d", what, step, i);
+  prand_destroy(a);
+  if (b != a) prand_destroy(b);
+}
+
+/******************************************************************************
+Function `jumped`:
+  Initialise a single stream, and jump ahead for n * step numbers.
+Arguments:
+  * `g`:        index of the generator;
+  * `step`:     the step size;
+  * `n`:        the number of jumps.
+Return:
+  The interface of the random number generator.
+******************************************************************************/
+static prand_t *jumped(const int g, const uint64_t step, int n) {
+  int err = 0;
+  prand_t *rng = single(g);
+  for (; n; n--) rng->jump(rng->state, step, &err);
+  CHECK_ERROR(err);
+  return rng;
+}
+
+
+/*============================================================================*\
+                                 The checks
+\*============================================================================*/
+
+/******************************************************************************
+Function `check_small`:
+  Check the streams against numbers sampled one by one.
+Arguments:
+  * `g`:        index of the generator;
+  * `step`:     the step size.
+******************************************************************************/
+static void check_small(const int g, const uint64_t step) {
+  const prand_rng_enum type = generators[g].type;
+  int err = 0;
+  for (int i = 0; i < NUM_STREAM; i++) {
+    prand_t *ref, *rng;
+    /* multiple streams */
+    ref = single(g);
+    skip(ref, ref->state, step * i);
+    rng = prand_init(type, SEED, NUM_STREAM, step, &err);
+    CHECK_ERROR(err);
+    compare(g, "prand_init", step, ref, ref->state, rng,
+        rng->state_stream[i]);
+
+    /* one jump of i * step */
+    ref = single(g);
+    skip(ref, ref->state, step * i);
+    rng = jumped(g, step * i, 1);
+    compare(g, "jump", step * i, ref, ref->state, rng, rng->state);
+
+    /* i pre-computed jumps */
+    ref = single(g);
+    skip(ref, ref->state, step * i);
+    rng = single(g);
+    prand_jump_t *jmp = rng->jump_prepare(rng, step, &err);
+    CHECK_ERROR(err);
+    for (int j = 0; j < i; j++) rng->jump_apply(rng->state, jmp, &err);
+    prand_jump_destroy(jmp);
+    CHECK_ERROR(err);
+    compare(g, "jump_apply", step, ref, ref->state, rng, rng->state);
+
+    /* i jumps of all streams */
+    ref = single(g);
+    skip(ref, ref->state, step * i);
+    rng = prand_init(type, SEED, 2, 0, &err);
+    for (int j = 0; j < i; j++) rng->jump_all(rng, step, &err);
+    CHECK_ERROR(err);
+    compare(g, "jump_all", step, ref, ref->state, rng, rng->state_stream[1]);
+
+    /* a slice of the streams */
+    ref = single(g);
+    skip(ref, ref->state, step * i);
+    rng = prand_init_slice(type, SEED, i, 1, step, &err);
+    CHECK_ERROR(err);
+    compare(g, "prand_init_slice", step, ref, ref->state, rng, rng->state);
+
+    /* the last stream of a slice with multiple streams */
+    ref = single(g);
+    skip(ref, ref->state, step * (i + 2));
+    rng = prand_init_slice(type, SEED, i, 3, step, &err);
+    CHECK_ERROR(err);
+    compare(g, "prand_init_slice", step, ref, ref->state, rng,
+        rng->state_stream[2]);
+  }
+}
+
+/******************************************************************************
+Function `check_large`:
+  Check the streams against compositions of jumps.
+Arguments:
+  * `g`:        index of the generator;
+  * `step`:     the step size.
+******************************************************************************/
+static void check_large(const int g, const uint64_t step) {
+  const prand_rng_enum type = generators[g].type;
+  prand_t *ref, *rng;
+  int err = 0;
+
+  /* multiple streams */
+  for (int i = 1; i < 3; i++) {
+    ref = jumped(g, step, i);
+    rng = prand_init(type, SEED, 3, step, &err);
+    CHECK_ERROR(err);
+    compare(g, "prand_init", step, ref, ref->state, rng,
+        rng->state_stream[i]);
+  }
+
+  /* a shorter jump followed by numbers sampled one by one */
+  ref = jumped(g, step, 1);
+  rng = jumped(g, step - NUM_ANCHOR, 1);
+  skip(rng, rng->state, NUM_ANCHOR);
+  compare(g, "jump + skip", step, ref, ref->state, rng, rng->state);
+
+  /* two jumps of half the step size */
+  ref = jumped(g, step, 1);
+  rng = jumped(g, step >> 1, 2);
+  skip(rng, rng->state, step & 1);
+  compare(g, "jump / 2", step, ref, ref->state, rng, rng->state);
+
+  /* pre-computed jump */
+  ref = jumped(g, step, 1);
+  rng = single(g);
+  prand_jump_t *jmp = rng->jump_prepare(rng, step, &err);
+  CHECK_ERROR(err);
+  rng->jump_apply(rng->state, jmp, &err);
+  prand_jump_destroy(jmp);
+  CHECK_ERROR(err);
+  compare(g, "jump_apply", step, ref, ref->state, rng, rng->state);
+
+  /* jump of all streams */
+  ref = jumped(g, step, 1);
+  rng = prand_init(type, SEED, 2, 0, &err);
+  rng->jump_all(rng, step, &err);
+  CHECK_ERROR(err);
+  compare(g, "jump_all", step, ref, ref->state, rng, rng->state_stream[1]);
+
+  /* reset with a jump */
+  ref = jumped(g, step, 1);
+  rng = prand_init(type, SEED + 1, 1, 0, &err);
+  rng->reset(rng->state, SEED, step, &err);
+  CHECK_ERROR(err);
+  compare(g, "reset", step, ref, ref->state, rng, rng->state);
+
+  /* jumps with different step sizes */
+  const uint64_t steps[2] = {step / 3, step};
+  for (int i = 0; i < 2; i++) {
+    ref = jumped(g, steps[i], 1);
+    rng = prand_init(type, SEED, 2, 0, &err);
+    prand_jump_multi(rng, steps, &err);
+    CHECK_ERROR(err);
+    compare(g, "prand_jump_multi", steps[i], ref, ref->state, rng,
+        rng->state_stream[i]);
+  }
+
+  /* a slice of the streams, beyond the maximum step size */
+  ref = jumped(g, step, 2);
+  rng = prand_init_slice(type, SEED, 2, 1, step, &err);
+  CHECK_ERROR(err);
+  compare(g, "prand_init_slice", step, ref, ref->state, rng, rng->state);
+
+  /* a lazily materialised stream, compacted after sampling some numbers */
+  ref = jumped(g, step, 1);
+  skip(ref, ref->state, NUM_ANCHOR);
+  prand_lazy_t *lz = prand_init_lazy(type, SEED, 2, step, 0, &err);
+  CHECK_ERROR(err);
+  void *state = prand_lazy_stream(lz, 1, &err);
+  CHECK_ERROR(err);
+  skip(lz->rng, state, NUM_ANCHOR);
+  prand_lazy_compact(lz, 1, NUM_ANCHOR, &err);
+  CHECK_ERROR(err);
+  state = prand_lazy_stream(lz, 1, &err);
+  CHECK_ERROR(err);
+  compare(g, "prand_lazy_compact", step, ref, ref->state, ref, state);
+  prand_lazy_release(lz, 1);
+  prand_lazy_destroy(lz);
+}
+
+/******************************************************************************
+Function `check_evict`:
+  Check that an evicted lazy stream restarts only if it has not been sampled.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_evict(const int g) {
+  int err = 0;
+  prand_lazy_t *lz = prand_init_lazy(generators[g].type, SEED, 3, 1000, 1,
+      &err);
+  CHECK_ERROR(err);
+  /* Streams 0 and 1 are evicted, after stream 1 is sampled. */
+  for (unsigned int i = 0; i < 3; i++) {
+    void *state = prand_lazy_stream(lz, i, &err);
+    CHECK_ERROR(err);
+    if (i == 1) lz->rng->get(state);
+    prand_lazy_release(lz, i);
+  }
+
+  void *state = prand_lazy_stream(lz, 0, &err);
+  CHECK_ERROR(err);
+  prand_t *ref = single(g);
+  compare(g, "evicted stream", 0, ref, ref->state, ref, state);
+  prand_lazy_release(lz, 0);
+
+  state = prand_lazy_stream(lz, 1, &err);
+  CHECK(!state && err == PRAND_ERR_EVICTED, generators[g].name,
+      "a sampled stream is restarted after eviction");
+  prand_lazy_destroy(lz);
+}
+
+/******************************************************************************
+Function `check_race`:
+  Check a lazy stream that is sampled and compacted repeatedly by one
+  thread, while the other threads keep acquiring and releasing it, if the
+  test is compiled with OpenMP. The sampled numbers must continue the
+  sequence, even if the state is computed by other threads, and the stream
+  is compacted during the jumps.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_race(const int g) {
+  const uint64_t step = 1000003;
+  int err = 0, fail = 0, done = 0;
+  prand_lazy_t *lz = prand_init_lazy(generators[g].type, SEED, 2, step, 1,
+      &err);
+  CHECK_ERROR(err);
+  prand_t *ref = jumped(g, step, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(4)
+#endif
+  {
+#ifdef _OPENMP
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+    int e = 0, bad = 0;
+    if (tid == 0) {
+      uint64_t offset = 0;
+      for (int r = 0; r < NUM_ROUND && !e; r++) {
+        void *state = prand_lazy_stream(lz, 1, &e);
+        if (!state) break;
+        /* A long jump, for the state to be slow to compute afterwards. */
+        if (r == 0) {
+          lz->rng->jump(state, NUM_OFFSET, &e);
+          ref->jump(ref->state, NUM_OFFSET, &e);
+          offset = NUM_OFFSET;
+        }
+        for (int k = 0; k < NUM_DRAW; k++) {
+          if (lz->rng->get(state) != ref->get(ref->state)) bad = 1;
+        }
+        offset += NUM_DRAW;
+        /* Wait until the stream is not acquired by the other threads. */
+        do {
+          e = 0;
+          prand_lazy_compact(lz, 1, offset, &e);
+        } while (e == PRAND_ERR_STREAM);
+      }
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+      done = 1;
+    }
+    else {
+      for (int stop = 0; !stop && !e; ) {
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+        stop = done;
+        if (prand_lazy_stream(lz, 1, &e)) prand_lazy_release(lz, 1);
+      }
+    }
+    if (bad || e) {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+      fail = 1;
+    }
+  }
+
+  CHECK(!fail, generators[g].name,
+      "a lazy stream differs when compacted concurrently");
+  prand_destroy(ref);
+  prand_lazy_destroy(lz);
+}
+
+/******************************************************************************
+Function `check_limit`:
+  Check that step sizes beyond the maximum, as well as empty or unreachable
+  slices, are rejected.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_limit(const int g) {
+  int err = 0;
+  prand_t *rng = prand_init_slice(generators[g].type, SEED, 1, 0, 1000, &err);
+  CHECK(!rng && err == PRAND_ERR_STREAM, generators[g].name,
+      "prand_init_slice accepts an empty slice");
+  if (rng) prand_destroy(rng);
+
+  err = 0;
+  rng = prand_init_slice(generators[g].type, SEED, UINT_MAX, 1, UINT64_MAX,
+      &err);
+  CHECK(!rng && err == PRAND_ERR_STEP, generators[g].name,
+      "prand_init_slice accepts stream %u with step %" PRIu64, UINT_MAX,
+      UINT64_MAX);
+  if (rng) prand_destroy(rng);
+
+  const uint64_t max = generators[g].max_step;
+  if (max == UINT64_MAX) return;
+  err = 0;
+  rng = prand_init(generators[g].type, SEED, 2, max + 1, &err);
+  CHECK(err == PRAND_ERR_STEP, generators[g].name,
+      "prand_init accepts step %" PRIu64, max + 1);
+  if (rng) prand_destroy(rng);
+
+  err = 0;
+  rng = single(g);
+  rng->jump(rng->state, max + 1, &err);
+  CHECK(err == PRAND_ERR_STEP, generators[g].name,
+      "jump accepts step %" PRIu64, max + 1);
+  prand_destroy(rng);
+}
+
+int main(void) {
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    for (int i = 0; i < NUM_SMALL; i++) check_small(g, small_step[i]);
+    for (int i = 0; i < NUM_LARGE; i++) {
+      if (large_step[i] <= generators[g].max_step)
+        check_large(g, large_step[i]);
+    }
+    check_evict(g);
+    check_race(g);
+    check_limit(g);
+    printf("%s: jumps checked\n", generators[g].name);
+    fflush(stdout);
+  }
+  return check_summary("test_jump");
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* test_perf.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include <time.h>
+#include "check.h"
+
+/*******************************************************************************
+  Throughput floor of the batch sampling functions. The rates of all
+  generators are measured with `fill` and `fill_double` on a single stream,
+  and compared with lower limits that are far below the rates on any recent
+  CPU, to catch severe performance regressions only. The limits can be scaled
+  by the first command-line argument, and the test is skipped if the argument
+  is 0.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_BUF         4096            /* numbers per batch */
+#define MIN_TIME        0.2             /* seconds of sampling per check */
+
+/* Lower limits of the throughput, in millions of numbers per second, in the
+ * order of `generators`. */
+static const double floor_int[NUM_GENERATOR] = {
+  20, 300, 100, 80, 200, 100
+};
+static const double floor_double[NUM_GENERATOR] = {
+  20, 300, 80, 60, 120, 100
+};
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `now`:
+  Read the monotonic clock.
+Return:
+  The time in seconds.
+******************************************************************************/
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t ibuf[NUM_BUF];
+static double dbuf[NUM_BUF];
+static volatile uint64_t sink;          /* prevent the loops being removed */
+
+/******************************************************************************
+Function `rate`:
+  Measure the throughput of a batch sampling function.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `dbl`:      non-zero for `fill_double`, and `fill` otherwise.
+Return:
+  The throughput in millions of numbers per second.
+******************************************************************************/
+static double rate(prand_t *rng, const int dbl) {
+  uint64_t num = 0;
+  const double start = now();
+  double time;
+  do {
+    for (int i = 0; i < 64; i++) {
+      if (dbl) {
+        rng->fill_double(rng->state, dbuf, NUM_BUF);
+        sink += (uint64_t) (dbuf[i] * 0x1p32);
+      }
+      else {
+        rng->fill(rng->state, ibuf, NUM_BUF);
+        sink += ibuf[i];
+      }
+    }
+    num += 64 * NUM_BUF;
+  }
+  while ((time = now() - start) < MIN_TIME);
+  return num / time * 1e-6;
+}
+
+int main(int argc, char *argv[]) {
+  const double scale = (argc > 1) ? atof(argv[1]) : 1;
+  if (scale <= 0) {
+    printf("test_perf: skipped\n");
+    return EXIT_SUCCESS;
+  }
+
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    int err = 0;
+    prand_t *rng = prand_init(generators[g].type, SEED, 1, 0, &err);
+    CHECK_ERROR(err);
+    const double ri = rate(rng, 0);
+    const double rd = rate(rng, 1);
+    printf("%s: %.0f M integers/s, %.0f M doubles/s\n", generators[g].name,
+        ri, rd);
+    fflush(stdout);
+    CHECK(ri >= floor_int[g] * scale, generators[g].name,
+        "fill below %g M/s", floor_int[g] * scale);
+    CHECK(rd >= floor_double[g] * scale, generators[g].name,
+        "fill_double below %g M/s", floor_double[g] * scale);
+    prand_destroy(rng);
+  }
+  return check_summary("test_perf");
+}
@@ -0,0 +1,244 @@
+/*******************************************************************************
+* test_pipe.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+#include <pthread.h>
+#include "check.h"
+#include "prand_pipe.h"
+
+/*******************************************************************************
+  Test of the producer pipeline: the numbers popped from the ring buffer of
+  every stream by concurrent consumers must be identical to the ones sampled
+  from the stream directly, with rings much shorter than the numbers drawn,
+  and the pipeline must shut down no matter how full the rings are.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_STREAM      4       /* one consumer thread for every stream */
+#define STREAM_STEP     1000
+#define NUM_DRAW        20000   /* numbers drawn by every consumer */
+#define PIPE_BLOCK      100     /* not a divisor of the block sizes */
+#define PIPE_NBLOCK     3       /* the rings hold 300 numbers */
+
+static const char *kind_name[] = {
+  "PRAND_PIPE_INT", "PRAND_PIPE_DOUBLE", "PRAND_PIPE_DOUBLE_POS",
+  "PRAND_PIPE_DOUBLE53"
+};
+#define NUM_KIND        ((int) (sizeof(kind_name) / sizeof(kind_name[0])))
+
+/* Work of a consumer thread. */
+typedef struct {
+  prand_pipe_t *pipe;
+  unsigned int idx;             /* index of the stream */
+  uint64_t *out;                /* numbers popped, as bits for doubles */
+} consumer_t;
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `bits`:
+  Reinterpret a floating-point number as an integer, for exact comparisons.
+Arguments:
+  * `x`:        the floating-point number.
+Return:
+  The bits of the number.
+******************************************************************************/
+static uint64_t bits(const double x) {
+  uint64_t u;
+  memcpy(&u, &x, sizeof(double));
+  return u;
+}
+
+/******************************************************************************
+Function `consume`:
+  Pop numbers from the ring buffer of one stream, in a consumer thread.
+Arguments:
+  * `arg`:      the work of the consumer.
+Return:
+  NULL.
+******************************************************************************/
+static void *consume(void *arg) {
+  consumer_t *c = (consumer_t *) arg;
+  for (size_t j = 0; j < NUM_DRAW; j++) {
+    c->out[j] = (c->pipe->kind == PRAND_PIPE_INT) ?
+        prand_pipe_get(c->pipe, c->idx) :
+        bits(prand_pipe_get_double(c->pipe, c->idx));
+  }
+  return NULL;
+}
+
+/******************************************************************************
+Function `direct`:
+  Sample a number from a stream directly, with the function matching the
+  type of the buffered numbers.
+Arguments:
+  * `rng`:      the interface of the random number generator;
+  * `state`:    the state of the stream;
+  * `kind`:     type of the buffered numbers.
+Return:
+  The number, as bits for doubles.
+******************************************************************************/
+static uint64_t direct(prand_t *rng, void *state, const prand_pipe_enum kind) {
+  switch (kind) {
+    case PRAND_PIPE_INT:
+      return rng->get(state);
+    case PRAND_PIPE_DOUBLE:
+      return bits(rng->get_double(state));
+    case PRAND_PIPE_DOUBLE_POS:
+      return bits(rng->get_double_pos(state));
+    default:
+      return bits(rng->get_double53(state));
+  }
+}
+
+
+/*============================================================================*\
+                            Checks of the pipeline
+\*============================================================================*/
+
+/******************************************************************************
+Function `check_consumers`:
+  Check the numbers popped by concurrent consumers against direct sampling.
+Arguments:
+  * `g`:        index of the generator;
+  * `kind`:     type of the buffered numbers.
+******************************************************************************/
+static void check_consumers(const int g, const prand_pipe_enum kind) {
+  static uint64_t out[NUM_STREAM][NUM_DRAW];
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, SEED, NUM_STREAM, STREAM_STEP,
+      &err);
+  CHECK_ERROR(err);
+  prand_t *ref = prand_init(generators[g].type, SEED, NUM_STREAM,
+      STREAM_STEP, &err);
+  CHECK_ERROR(err);
+
+  prand_pipe_t *pipe = prand_pipe_init(rng, kind, PIPE_BLOCK, PIPE_NBLOCK,
+      &err);
+  CHECK_ERROR(err);
+  pthread_t thread[NUM_STREAM];
+  consumer_t work[NUM_STREAM];
+  for (unsigned int i = 0; i < NUM_STREAM; i++) {
+    work[i].pipe = pipe;
+    work[i].idx = i;
+    work[i].out = out[i];
+    if (pthread_create(thread + i, NULL, consume, work + i)) {
+      fprintf(stderr, "Error: failed to create the consumer threads\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (int i = 0; i < NUM_STREAM; i++) pthread_join(thread[i], NULL);
+  prand_pipe_destroy(pipe);
+
+  for (int i = 0; i < NUM_STREAM; i++) {
+    size_t j;
+    for (j = 0; j < NUM_DRAW; j++) {
+      if (out[i][j] != direct(ref, ref->state_stream[i], kind)) break;
+    }
+    CHECK(j == NUM_DRAW, generators[g].name,
+        "%s differs for stream %d at number %zu", kind_name[kind], i, j);
+  }
+  prand_destroy(ref);
+  prand_destroy(rng);
+}
+
+/******************************************************************************
+Function `check_shutdown`:
+  Check that the pipeline stops with empty, partially consumed, and full
+  rings, and that the interface is usable afterwards.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_shutdown(const int g) {
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, SEED, NUM_STREAM, STREAM_STEP,
+      &err);
+  CHECK_ERROR(err);
+
+  /* destroyed right away, while the producer may still be filling */
+  prand_pipe_t *pipe = prand_pipe_init(rng, PRAND_PIPE_INT, PIPE_BLOCK,
+      PIPE_NBLOCK, &err);
+  CHECK_ERROR(err);
+  prand_pipe_destroy(pipe);
+
+  /* destroyed after wrapping around one ring, with the others full */
+  pipe = prand_pipe_init(rng, PRAND_PIPE_DOUBLE, PIPE_BLOCK, PIPE_NBLOCK,
+      &err);
+  CHECK_ERROR(err);
+  double sum = 0;
+  for (int j = 0; j < PIPE_BLOCK * PIPE_NBLOCK * 3 + 1; j++)
+    sum += prand_pipe_get_double(pipe, 1);
+  prand_pipe_destroy(pipe);
+  CHECK(sum > 0, generators[g].name, "the pipeline produces only zeros");
+
+  /* The states are still valid after the pipelines are stopped. */
+  pipe = prand_pipe_init(rng, PRAND_PIPE_INT, PIPE_BLOCK, PIPE_NBLOCK, &err);
+  CHECK_ERROR(err);
+  prand_pipe_get(pipe, NUM_STREAM - 1);
+  prand_pipe_destroy(pipe);
+  prand_destroy(rng);
+}
+
+/******************************************************************************
+Function `check_invalid`:
+  Check that invalid settings of the pipeline are rejected.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_invalid(const int g) {
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, SEED, 1, 0, &err);
+  CHECK_ERROR(err);
+  prand_pipe_t *pipe = prand_pipe_init(rng, PRAND_PIPE_INT, PIPE_BLOCK, 1,
+      &err);
+  CHECK(!pipe && err == PRAND_ERR_PIPE, generators[g].name,
+      "a ring with a single block is accepted");
+  if (pipe) prand_pipe_destroy(pipe);
+  prand_destroy(rng);
+}
+
+int main(void) {
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    for (int k = 0; k < NUM_KIND; k++)
+      check_consumers(g, (prand_pipe_enum) k);
+    check_shutdown(g);
+    check_invalid(g);
+    printf("%s: producer pipeline checked\n", generators[g].name);
+    fflush(stdout);
+  }
+  return check_summary("test_pipe");
+}
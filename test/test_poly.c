@@ -0,0 +1,111 @@
+/*******************************************************************************
+* test_poly.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <string.h>
+#include "check.h"
+#include "mt19937.h"
+
+/*******************************************************************************
+  Test of the GF(2) polynomial multiplication used by the MT19937 jumps: the
+  Karatsuba and Toom-Cook 3-way algorithms, with different thresholds, must
+  agree with the grade-school algorithm on random polynomials.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_TRIAL       4       /* random polynomials for each length */
+
+/* Lengths of the polynomials (in words), around the thresholds of the base
+ * cases and the splits, and the ones for MT19937. */
+static const unsigned int poly_len[] = {
+  1, 2, 3, 6, 7, 12, 13, 14, 24, 25, 35, 47, 48, 49, 100, 311, 623,
+  MT19937_N, 625
+};
+#define NUM_LEN         ((int) (sizeof(poly_len) / sizeof(poly_len[0])))
+
+/* Thresholds of the Toom-Cook multiplication, 0 for Karatsuba only. */
+static const unsigned int toom3_thres[] = {0, 12, 13, 24, 48};
+#define NUM_TOOM3       ((int) (sizeof(toom3_thres) / sizeof(toom3_thres[0])))
+
+#define MAX_LEN         640
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `random_words`:
+  Fill an array with pseudo-random words, with a 64-bit LCG.
+Arguments:
+  * `a`:        the array to be filled;
+  * `n`:        the number of words;
+  * `x`:        state of the LCG.
+******************************************************************************/
+static void random_words(uint32_t *a, const unsigned int n, uint64_t *x) {
+  for (unsigned int i = 0; i < n; i++) {
+    *x = *x * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+    a[i] = (uint32_t) (*x >> 32);
+  }
+}
+
+int main(void) {
+  static uint32_t a[MAX_LEN], b[MAX_LEN];
+  static uint32_t ref[MAX_LEN * 2], r[MAX_LEN * 2], tmp[MAX_LEN * 8];
+  const char *name = poly_mul_clmul() ? "poly_mul (clmul)" : "poly_mul";
+  const unsigned int thres0 = poly_mul_toom3(0);
+  uint64_t x = SEED;
+
+  for (int l = 0; l < NUM_LEN; l++) {
+    const unsigned int n = poly_len[l];
+    for (int t = 0; t < NUM_TRIAL; t++) {
+      random_words(a, n, &x);
+      random_words(b, n, &x);
+      /* the highest bits are set, for catching lost carries */
+      a[n - 1] |= UINT32_C(0x80000000);
+      b[n - 1] |= UINT32_C(0x80000000);
+      poly_mul_school(ref, a, b, n);
+
+      for (int k = 0; k < NUM_TOOM3; k++) {
+        poly_mul_toom3(toom3_thres[k]);
+        memset(r, 0xff, sizeof(r));
+        poly_mul(r, a, b, n, tmp);
+        CHECK(!memcmp(r, ref, sizeof(uint32_t) * n * 2), name,
+            "threshold %u differs for %u words", toom3_thres[k], n);
+      }
+    }
+  }
+
+  poly_mul_toom3(thres0);
+  printf("%s: multiplications checked\n", name);
+  return check_summary("test_poly");
+}
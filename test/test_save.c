@@ -0,0 +1,380 @@
+/*******************************************************************************
+* test_save.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
+#include <unistd.h>
+#include "check.h"
+
+/*******************************************************************************
+  Test of the checkpoints of all generators: the streams restored from a
+  buffer or a file descriptor must continue with the same numbers as the
+  saved ones, including a cached Gaussian number and the starting points of
+  substreams, checkpoints of the first version of the format must still be
+  accepted, and corrupted checkpoints must be rejected.
+*******************************************************************************/
+
+/*============================================================================*\
+                          Settings of the test programme
+\*============================================================================*/
+
+#define NUM_STREAM      3
+#define STREAM_STEP     1000
+#define NUM_COMPARE     1500    /* numbers compared, longer than 2 blocks */
+#define SUB_STEP        5000    /* length of the substreams */
+
+/* Offsets of the fields in the header of the checkpoint. */
+#define HEAD_VERSION    4
+#define HEAD_TYPE       8
+#define HEAD_SIZE       20
+#define SUB_SIZE        8       /* size of the length of the substreams */
+
+
+/*============================================================================*\
+                               Utility functions
+\*============================================================================*/
+
+/******************************************************************************
+Function `prepare`:
+  Initialise the streams, and move them to different positions, with a
+  cached Gaussian number for the first stream.
+Arguments:
+  * `g`:        index of the generator.
+Return:
+  The interface of the random number generator.
+******************************************************************************/
+static prand_t *prepare(const int g) {
+  int err = 0;
+  prand_t *rng = prand_init(generators[g].type, SEED, NUM_STREAM,
+      STREAM_STEP, &err);
+  CHECK_ERROR(err);
+  for (int i = 0; i < NUM_STREAM; i++) {
+    for (int j = 0; j < 7 * i + 3; j++) rng->get(rng->state_stream[i]);
+  }
+  rng->get_gaussian(rng->state_stream[0]);
+  return rng;
+}
+
+/******************************************************************************
+Function `compare`:
+  Compare the numbers sampled from all the streams of two interfaces, and
+  release the restored one.
+Arguments:
+  * `g`:        index of the generator;
+  * `what`:     description of the comparison;
+  * `a`:        the saved interface;
+  * `b`:        the restored interface.
+******************************************************************************/
+static void compare(const int g, const char *what, prand_t *a, prand_t *b) {
+  CHECK(b->type == a->type && b->nstream == a->nstream, generators[g].name,
+      "%s restores a different interface", what);
+  if (b->type != a->type || b->nstream != a->nstream) {
+    prand_destroy(b);
+    return;
+  }
+  for (int i = 0; i < a->nstream; i++) {
+    void *sa = a->state_stream[i];
+    void *sb = b->state_stream[i];
+    CHECK(a->get_gaussian(sa) == b->get_gaussian(sb), generators[g].name,
+        "%s differs for the Gaussian number of stream %d", what, i);
+    int j;
+    for (j = 0; j < NUM_COMPARE; j++) {
+      if (a->get(sa) != b->get(sb)) break;
+    }
+    CHECK(j == NUM_COMPARE, generators[g].name,
+        "%s differs for stream %d at number %d", what, i, j);
+  }
+  prand_destroy(b);
+}
+
+/******************************************************************************
+Function `save`:
+  Save the streams to a newly allocated buffer.
+Arguments:
+  * `rng`:      the random number generator interface;
+  * `size`:     the size of the checkpoint.
+Return:
+  The buffer holding the checkpoint.
+******************************************************************************/
+static unsigned char *save(const prand_t *rng, size_t *size) {
+  int err = 0;
+  *size = prand_save_size(rng);
+  unsigned char *buf = malloc(*size);
+  if (!buf) {
+    fprintf(stderr, "Error: failed to allocate memory for the checkpoint\n");
+    exit(EXIT_FAILURE);
+  }
+  prand_save(rng, buf, *size, &err);
+  CHECK_ERROR(err);
+  return buf;
+}
+
+/******************************************************************************
+Function `load_file`:
+  Restore an interface by reading a checkpoint from a temporary file.
+Arguments:
+  * `buf`:      the checkpoint;
+  * `size`:     size of the checkpoint;
+  * `err`:      an integer for storing the error message.
+Return:
+  The interface of the random number generator; NULL on error.
+******************************************************************************/
+static prand_t *load_file(const unsigned char *buf, const size_t size,
+    int *err) {
+  FILE *fp = tmpfile();
+  if (!fp || fwrite(buf, 1, size, fp) != size || fflush(fp)) {
+    fprintf(stderr, "Error: failed to write the temporary file\n");
+    exit(EXIT_FAILURE);
+  }
+  rewind(fp);
+  prand_t *rng = prand_load_fd(fileno(fp), err);
+  fclose(fp);
+  return rng;
+}
+
+/******************************************************************************
+Function `check_reject`:
+  Check that a corrupted checkpoint is rejected by both loading functions.
+Arguments:
+  * `g`:        index of the generator;
+  * `what`:     description of the corruption;
+  * `buf`:      the corrupted checkpoint;
+  * `size`:     size of the checkpoint.
+******************************************************************************/
+static void check_reject(const int g, const char *what,
+    const unsigned char *buf, const size_t size) {
+  int err = 0;
+  prand_t *rng = prand_load(buf, size, &err);
+  CHECK(!rng && PRAND_IS_ERROR(err), generators[g].name,
+      "prand_load accepts %s", what);
+  if (rng) prand_destroy(rng);
+
+  err = 0;
+  rng = load_file(buf, size, &err);
+  CHECK(!rng && PRAND_IS_ERROR(err), generators[g].name,
+      "prand_load_fd accepts %s", what);
+  if (rng) prand_destroy(rng);
+}
+
+
+/*============================================================================*\
+                              Checks of checkpoints
+\*============================================================================*/
+
+/******************************************************************************
+Function `check_roundtrip`:
+  Check that the streams are restored from a buffer and a file descriptor.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_roundtrip(const int g) {
+  int err = 0;
+  size_t size;
+  prand_t *rng = prepare(g);
+  unsigned char *buf = save(rng, &size);
+
+  /* undersized buffer */
+  prand_save(rng, buf, size - 1, &err);
+  CHECK(err == PRAND_ERR_SAVE_SIZE, generators[g].name,
+      "prand_save accepts an undersized buffer");
+  err = 0;
+
+  prand_t *b = prand_load(buf, size, &err);
+  CHECK_ERROR(err);
+  compare(g, "prand_load", rng, b);
+  prand_destroy(rng);
+
+  /* the same checkpoint through a file descriptor */
+  rng = prepare(g);
+  FILE *fp = tmpfile();
+  if (!fp) {
+    fprintf(stderr, "Error: failed to create the temporary file\n");
+    exit(EXIT_FAILURE);
+  }
+  prand_save_fd(rng, fileno(fp), &err);
+  CHECK_ERROR(err);
+  CHECK(ftell(fp) == (long) size, generators[g].name,
+      "prand_save_fd writes %ld bytes instead of %zu", ftell(fp), size);
+  rewind(fp);
+  b = prand_load_fd(fileno(fp), &err);
+  fclose(fp);
+  CHECK_ERROR(err);
+  compare(g, "prand_load_fd", rng, b);
+
+  prand_destroy(rng);
+  free(buf);
+}
+
+/******************************************************************************
+Function `check_substream`:
+  Check that the starting points of the substreams are restored, so that
+  resetting and moving the substreams give the same numbers, and that an
+  invalid length of the substreams is rejected.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_substream(const int g) {
+  int err = 0;
+  size_t size;
+  prand_t *rng = prepare(g);
+  prand_substream_init(rng, SUB_STEP, &err);
+  CHECK_ERROR(err);
+  prand_next_substream(rng, 1, &err);
+  CHECK_ERROR(err);
+  for (int i = 0; i < NUM_STREAM; i++) rng->get(rng->state_stream[i]);
+  unsigned char *buf = save(rng, &size);
+  prand_destroy(rng);
+
+  for (int k = 0; k < 2; k++) {
+    prand_t *b = k ? load_file(buf, size, &err) : prand_load(buf, size, &err);
+    CHECK_ERROR(err);
+    CHECK(b->substream != NULL, generators[g].name,
+        "substreams are not restored");
+    if (!b->substream) {
+      prand_destroy(b);
+      continue;
+    }
+    /* Both interfaces are moved in the same way, and then compared. */
+    prand_t *a = prand_load(buf, size, &err);
+    CHECK_ERROR(err);
+    for (int i = 0; i < NUM_STREAM; i++) {
+      prand_reset_substream(a, i, &err);
+      prand_reset_substream(b, i, &err);
+    }
+    prand_next_substream(a, 2, &err);
+    prand_next_substream(b, 2, &err);
+    CHECK_ERROR(err);
+    compare(g, k ? "substreams of prand_load_fd" : "substreams of prand_load",
+        a, b);
+    prand_destroy(a);
+  }
+
+  /* The records of the streams and of the starting points have the same
+   * size, and the length of the substreams is stored in between. */
+  const size_t pos = HEAD_SIZE + (size - HEAD_SIZE - SUB_SIZE) / 2;
+  unsigned char *bad = malloc(size);
+  if (!bad) {
+    fprintf(stderr, "Error: failed to allocate memory for the checkpoint\n");
+    exit(EXIT_FAILURE);
+  }
+  check_reject(g, "truncated substreams", buf, size - 1);
+  if (generators[g].max_step != UINT64_MAX) {
+    memcpy(bad, buf, size);
+    memset(bad + pos, 0xff, SUB_SIZE);
+    check_reject(g, "an invalid length of substreams", bad, size);
+  }
+  free(bad);
+  free(buf);
+}
+
+/******************************************************************************
+Function `check_version1`:
+  Check that a checkpoint of the first version of the format, without the
+  length of the substreams, is accepted.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_version1(const int g) {
+  int err = 0;
+  size_t size;
+  prand_t *rng = prepare(g);
+  unsigned char *buf = save(rng, &size);
+  buf[HEAD_VERSION] = 1;
+
+  prand_t *b = prand_load(buf, size - SUB_SIZE, &err);
+  CHECK_ERROR(err);
+  CHECK(b->substream == NULL, generators[g].name,
+      "substreams are restored from version 1");
+  compare(g, "prand_load of version 1", rng, b);
+  prand_destroy(rng);
+
+  rng = prepare(g);
+  b = load_file(buf, size - SUB_SIZE, &err);
+  CHECK_ERROR(err);
+  compare(g, "prand_load_fd of version 1", rng, b);
+  prand_destroy(rng);
+  free(buf);
+}
+
+/******************************************************************************
+Function `check_corrupt`:
+  Check that checkpoints with a bad magic string, an unknown version, a
+  truncated record, or a mismatched type of generator are rejected.
+Arguments:
+  * `g`:        index of the generator.
+******************************************************************************/
+static void check_corrupt(const int g) {
+  size_t size;
+  prand_t *rng = prepare(g);
+  unsigned char *buf = save(rng, &size);
+  prand_destroy(rng);
+  unsigned char *bad = malloc(size);
+  if (!bad) {
+    fprintf(stderr, "Error: failed to allocate memory for the checkpoint\n");
+    exit(EXIT_FAILURE);
+  }
+
+  memcpy(bad, buf, size);
+  bad[0] ^= 0x20;
+  check_reject(g, "a bad magic string", bad, size);
+
+  memcpy(bad, buf, size);
+  bad[HEAD_VERSION] += 99;
+  check_reject(g, "an unknown version", bad, size);
+
+  check_reject(g, "a truncated header", buf, HEAD_TYPE);
+  check_reject(g, "a truncated record", buf, size - 1);
+
+  /* The header of another generator, with its own record size. */
+  const int h = (g + 1) % NUM_GENERATOR;
+  rng = prepare(h);
+  size_t hsize;
+  unsigned char *other = save(rng, &hsize);
+  prand_destroy(rng);
+  memcpy(bad, buf, size);
+  memcpy(bad + HEAD_TYPE, other + HEAD_TYPE, 4);
+  check_reject(g, "a mismatched type", bad, size);
+
+  free(other);
+  free(bad);
+  free(buf);
+}
+
+int main(void) {
+  for (int g = 0; g < NUM_GENERATOR; g++) {
+    check_roundtrip(g);
+    check_substream(g);
+    check_version1(g);
+    check_corrupt(g);
+    printf("%s: checkpoints checked\n", generators[g].name);
+    fflush(stdout);
+  }
+  return check_summary("test_save");
+}
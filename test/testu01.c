@@ -0,0 +1,107 @@
+/*******************************************************************************
+* testu01.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <string.h>
+#include "unif01.h"
+#include "bbattery.h"
+#include "check.h"
+
+/*******************************************************************************
+  Driver for the TestU01 batteries, which feeds the 32-bit words sampled with
+  the batch functions of the library to the tests. Usage:
+
+    testu01 GENERATOR [BATTERY [SEED]]
+
+  where GENERATOR is the index of the generator, and BATTERY is one of
+  `small`, `crush`, and `big`, for SmallCrush, Crush, and BigCrush,
+  respectively.
+*******************************************************************************/
+
+#define NUM_BUF         8192            /* words per batch */
+
+static prand_t *rng;
+static int full;                        /* indicate full 32-bit outputs */
+static uint64_t ibuf[NUM_BUF];
+static double dbuf[NUM_BUF];
+static int idx = NUM_BUF;
+
+/******************************************************************************
+Function `next_bits`:
+  Retrieve the next 32-bit word from the buffer, which is refilled with the
+  batch functions when it is exhausted.
+Return:
+  The 32-bit word.
+******************************************************************************/
+static unsigned int next_bits(void) {
+  if (idx >= NUM_BUF) {
+    if (full) rng->fill(rng->state, ibuf, NUM_BUF);
+    else {
+      rng->fill_double53(rng->state, dbuf, NUM_BUF);
+      for (int i = 0; i < NUM_BUF; i++)
+        ibuf[i] = (uint32_t) (dbuf[i] * 0x1p32);
+    }
+    idx = 0;
+  }
+  return (unsigned int) ibuf[idx++];
+}
+
+int main(int argc, char *argv[]) {
+  int g = -1;
+  if (argc > 1) {
+    char *end;
+    const long idx = strtol(argv[1], &end, 10);
+    for (int i = 0; i < NUM_GENERATOR; i++)
+      if (*argv[1] && !*end && idx == (long) generators[i].type) g = i;
+  }
+  const char *battery = (argc > 2) ? argv[2] : "small";
+  if (g < 0 || (strcmp(battery, "small") && strcmp(battery, "crush") &&
+      strcmp(battery, "big"))) {
+    fprintf(stderr, "Usage: %s GENERATOR [small|crush|big [SEED]]\n",
+        argv[0]);
+    return EXIT_FAILURE;
+  }
+  const uint64_t seed = (argc > 3) ? strtoull(argv[3], NULL, 0) : SEED;
+
+  int err = 0;
+  rng = prand_init(generators[g].type, seed, 1, 0, &err);
+  CHECK_ERROR(err);
+  full = (rng->min == 0 && rng->max == UINT32_MAX);
+
+  char name[64];
+  snprintf(name, sizeof(name), "prand %s", generators[g].name);
+  unif01_Gen *gen = unif01_CreateExternGenBits(name, next_bits);
+  if (!strcmp(battery, "small")) bbattery_SmallCrush(gen);
+  else if (!strcmp(battery, "crush")) bbattery_Crush(gen);
+  else bbattery_BigCrush(gen);
+
+  unif01_DeleteExternGenBits(gen);
+  prand_destroy(rng);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* prand_mktable.c: this file is part of the prand library.
+ 
+* prand: parallel random number generator.
+
+* Github repository:
+        https://github.com/cheng-zhao/prand
+
+* Copyright (c) 2020 Cheng Zhao <zhaocheng03@gmail.com>
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "prand.h"
+
+/*******************************************************************************
+  Command-line tool for pre-computing the starting states of all streams for
+  a given configuration, to be mapped by `prand_init_from_file`:
+
+    prand_mktable GENERATOR SEED NSTREAM STEP FILE
+
+  where GENERATOR is the name of the generator, e.g. "MT19937".
+*******************************************************************************/
+
+/* Names of the random number generators. */
+static const struct {
+  prand_rng_enum type;
+  const char *name;
+} generators[] = {
+  {PRAND_RNG_MRG32K3A, "MRG32k3a"},
+  {PRAND_RNG_MT19937, "MT19937"},
+  {PRAND_RNG_PHILOX4X32, "Philox4x32-10"},
+  {PRAND_RNG_XOSHIRO256PP, "xoshiro256++"},
+  {PRAND_RNG_SFMT19937, "SFMT19937"},
+  {PRAND_RNG_DSFMT19937, "dSFMT19937"}
+};
+#define NUM_GENERATOR   ((int) (sizeof(generators) / sizeof(generators[0])))
+
+/******************************************************************************
+Function `usage`:
+  Print the usage of the tool, and exit.
+Arguments:
+  * `pname`:    name of the programme.
+******************************************************************************/
+static void usage(const char *pname) {
+  fprintf(stderr, "Usage: %s GENERATOR SEED NSTREAM STEP FILE\n"
+      "Pre-compute the starting states of all streams.\n"
+      "GENERATOR is one of:", pname);
+  for (int g = 0; g < NUM_GENERATOR; g++)
+    fprintf(stderr, " %s", generators[g].name);
+  fprintf(stderr, "\n");
+  exit(EXIT_FAILURE);
+}
+
+/******************************************************************************
+Function `parse_uint`:
+  Parse a non-negative integer from a string.
+Arguments:
+  * `str`:      the string;
+  * `val`:      the integer.
+Return:
+  Zero on success; non-zero if the string is not a valid integer.
+******************************************************************************/
+static int parse_uint(const char *str, uint64_t *val) {
+  char *end;
+  if (!*str || *str == '-') return 1;
+  *val = strtoull(str, &end, 10);
+  return *end != '\0';
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t seed, nstream, step;
+  int g;
+  if (argc != 6) usage(argv[0]);
+  for (g = 0; g < NUM_GENERATOR; g++)
+    if (!strcmp(argv[1], generators[g].name)) break;
+  if (g == NUM_GENERATOR || parse_uint(argv[2], &seed) ||
+      parse_uint(argv[3], &nstream) || parse_uint(argv[4], &step) ||
+      nstream > 0x7fffffff) usage(argv[0]);
+
+  int err = 0;
+  prand_table_create(generators[g].type, seed, nstream, step, argv[5], &err);
+  if (PRAND_IS_ERROR(err)) {
+    fprintf(stderr, "Error: %s\n", prand_errmsg(err));
+    return EXIT_FAILURE;
+  }
+  if (PRAND_IS_WARN(err)) fprintf(stderr, "Warning: %s\n", prand_errmsg(err));
+  printf("Starting states of %" PRIu64 " %s streams written to `%s'\n",
+      nstream, generators[g].name, argv[5]);
+  return 0;
+}